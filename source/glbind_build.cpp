@@ -1,14 +1,27 @@
-#include "external/tinyxml2.cpp"
 #include <string>
 #include <vector>
+#include <unordered_map>
+#include <unordered_set>
 #include <algorithm>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <cctype>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
 #include <assert.h>
 
 #define GLB_BUILD_XML_PATH_GL   "resources/gl.xml"
 #define GLB_BUILD_XML_PATH_WGL  "resources/wgl.xml"
 #define GLB_BUILD_XML_PATH_GLX  "resources/glx.xml"
+#define GLB_BUILD_XML_PATH_EGL  "resources/egl.xml"
 #define GLB_BUILD_TEMPLATE_PATH "source/glbind_template.h"
+#define GLB_BUILD_STUB_TEMPLATE_PATH "source/glbind_stub_template.c"
+#define GLB_BUILD_SOURCE_PATH   "source/glbind_build.cpp"
+#define GLB_BUILD_CACHE_PATH    "resources/glbind_build.cache"
 
 // Edit these if you want to blacklist specific extensions.
 static const char* g_BlacklistedExtensions[] = {
@@ -22,6 +35,46 @@ static const char* g_BlacklistedExtensionVendors[] = {
     ""
 };
 
+// Platform-specific extensions that the implementation in glbind_template.h depends on. These are always output, even when a spec file lists
+// the extensions to include.
+static const char* g_RequiredPlatformExtensions[] = {
+    "WGL_ARB_extensions_string",
+    "WGL_EXT_extensions_string",
+    "WGL_ARB_create_context",
+    "WGL_ARB_create_context_profile",
+    "WGL_ARB_create_context_no_error",
+    "GLX_ARB_create_context",
+    "GLX_ARB_create_context_profile",
+    "GLX_ARB_create_context_no_error",
+    "EGL_EXT_platform_base",
+    "EGL_MESA_platform_surfaceless",
+    "EGL_KHR_create_context",
+    "EGL_KHR_create_context_no_error"
+};
+
+// Commands that are implemented by hand in glbind_stub_template.c. Every other command is a no-op in the stub library.
+static const char* g_StubImplementedCommands[] = {
+    "glXChooseVisual",
+    "glXCreateContext",
+    "glXCreateNewContext",
+    "glXDestroyContext",
+    "glXMakeCurrent",
+    "glXSwapBuffers",
+    "glXGetCurrentContext",
+    "glXGetCurrentDisplay",
+    "glXGetCurrentDrawable",
+    "glXQueryExtensionsString",
+    "glXChooseFBConfig",
+    "glXGetVisualFromFBConfig",
+    "glXCreatePbuffer",
+    "glXDestroyPbuffer",
+    "glXGetProcAddress",
+    "glXGetProcAddressARB",
+    "glGetString",
+    "glGetStringi",
+    "glGetIntegerv"
+};
+
 
 typedef int glbResult;
 #define GLB_SUCCESS                 0
@@ -33,6 +86,8 @@ typedef int glbResult;
 #define GLB_FAILED_TO_OPEN_FILE     -5
 #define GLB_FAILED_TO_READ_FILE     -6
 #define GLB_FAILED_TO_WRITE_FILE    -7
+#define GLB_INVALID_XML             -8
+#define GLB_END_OF_ELEMENT          2   /* Not an error. Used by glbXMLReaderNextChild() to indicate that there are no more children. */
 
 std::string glbLTrim(const std::string &s)
 {
@@ -243,6 +298,493 @@ glbResult glbOpenAndWriteTextFile(const char* filePath, const char* text)
 }
 
 
+/*
+The registry files are read with a small pull parser rather than being loaded into a DOM. Each call to glbXMLReaderNext() returns the next
+start tag, end tag or run of text and the glbBuildParse*() functions fill the registry structures straight from those. The file is read
+through a fixed size window so memory usage does not grow with the size of the registry.
+
+Only the subset of XML used by the Khronos registries is supported: elements, attributes, text, comments, processing instructions and
+character references. Runs of text that are only whitespace are dropped, which is what tinyxml2 used to do.
+*/
+#define GLB_XML_READER_BUFFER_SIZE  65536
+
+enum glbXMLTokenType
+{
+    GLB_XML_TOKEN_EOF,
+    GLB_XML_TOKEN_START,
+    GLB_XML_TOKEN_END,
+    GLB_XML_TOKEN_TEXT
+};
+
+struct glbXMLAttribute
+{
+    std::string name;
+    std::string value;  // Character references are decoded.
+};
+
+// Tokens are reused between calls to glbXMLReaderNext() so the strings in them don't need to be reallocated for every tag.
+struct glbXMLToken
+{
+    glbXMLTokenType type;
+    std::string name;                           // The element name for start and end tags.
+    std::vector<glbXMLAttribute> attributes;    // Start tags only.
+    std::string text;                           // Text only. Character references are decoded.
+};
+
+struct glbXMLReader
+{
+    const char* filePath;
+    FILE* pFile;
+    std::vector<char> buffer;
+    size_t cursor;          // The position of the next character in the buffer.
+    size_t size;            // The number of valid characters in the buffer.
+    int lineNumber;
+    std::vector<std::string> openElements;
+    bool hasPendingEndTag;  // Set for empty element tags such as <apientry/>. The end tag is returned by the next call to glbXMLReaderNext().
+};
+
+glbResult glbXMLReaderInit(glbXMLReader &reader, const char* filePath)
+{
+    glbResult result = glbFOpen(filePath, "rb", &reader.pFile);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    reader.filePath = filePath;
+    reader.buffer.resize(GLB_XML_READER_BUFFER_SIZE);
+    reader.cursor = 0;
+    reader.size = 0;
+    reader.lineNumber = 1;
+    reader.openElements.clear();
+    reader.hasPendingEndTag = false;
+
+    return GLB_SUCCESS;
+}
+
+void glbXMLReaderUninit(glbXMLReader &reader)
+{
+    fclose(reader.pFile);
+}
+
+glbResult glbXMLReaderError(glbXMLReader &reader, const char* message)
+{
+    printf("%s(%d): %s\n", reader.filePath, reader.lineNumber, message);
+    return GLB_INVALID_XML;
+}
+
+// Returns the character at the given offset from the cursor, or -1 if it's past the end of the file. The offset must be small compared to the
+// size of the buffer.
+int glbXMLReaderPeek(glbXMLReader &reader, size_t offset)
+{
+    if (reader.cursor + offset >= reader.size) {
+        // Move what's left to the start of the buffer and fill the rest from the file.
+        memmove(reader.buffer.data(), reader.buffer.data() + reader.cursor, reader.size - reader.cursor);
+        reader.size  -= reader.cursor;
+        reader.cursor = 0;
+        reader.size  += fread(reader.buffer.data() + reader.size, 1, reader.buffer.size() - reader.size, reader.pFile);
+
+        if (offset >= reader.size) {
+            return -1;
+        }
+    }
+
+    return (unsigned char)reader.buffer[reader.cursor + offset];
+}
+
+// Moves the cursor forward. The characters being skipped must have been peeked.
+void glbXMLReaderAdvance(glbXMLReader &reader, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        if (reader.buffer[reader.cursor] == '\n') {
+            reader.lineNumber += 1;
+        }
+        reader.cursor += 1;
+    }
+}
+
+bool glbXMLReaderStartsWith(glbXMLReader &reader, const char* str)
+{
+    for (size_t i = 0; str[i] != '\0'; ++i) {
+        if (glbXMLReaderPeek(reader, i) != (unsigned char)str[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Moves the cursor to just after the next occurrence of the terminator. Returns false if the end of the file is reached first.
+bool glbXMLReaderSkipPast(glbXMLReader &reader, const char* terminator)
+{
+    while (!glbXMLReaderStartsWith(reader, terminator)) {
+        if (glbXMLReaderPeek(reader, 0) == -1) {
+            return false;
+        }
+        glbXMLReaderAdvance(reader, 1);
+    }
+
+    glbXMLReaderAdvance(reader, strlen(terminator));
+    return true;
+}
+
+void glbXMLReaderSkipWhitespace(glbXMLReader &reader)
+{
+    for (;;) {
+        int c = glbXMLReaderPeek(reader, 0);
+        if (c != ' ' && c != '\t' && c != '\r' && c != '\n') {
+            break;
+        }
+        glbXMLReaderAdvance(reader, 1);
+    }
+}
+
+bool glbXMLIsNameChar(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == ':' || c == '-' || c == '.' || c >= 0x80;
+}
+
+/*
+Appends characters to the string for as long as they pass the predicate, taking as many as possible straight from the buffer at a time. Returns
+false if any of them was not whitespace.
+*/
+template <typename Predicate>
+bool glbXMLReaderReadWhile(glbXMLReader &reader, std::string &str, Predicate predicate)
+{
+    bool isWhitespaceOnly = true;
+
+    while (glbXMLReaderPeek(reader, 0) != -1 && predicate(reader.buffer[reader.cursor])) {
+        size_t length = 0;
+        while (reader.cursor + length < reader.size && predicate(reader.buffer[reader.cursor + length])) {
+            char c = reader.buffer[reader.cursor + length];
+            if (c == '\n') {
+                reader.lineNumber += 1;
+            } else if (c != ' ' && c != '\t') {
+                isWhitespaceOnly = false;
+            }
+            length += 1;
+        }
+
+        str.append(reader.buffer.data() + reader.cursor, length);
+        reader.cursor += length;
+    }
+
+    return isWhitespaceOnly;
+}
+
+void glbXMLReaderReadName(glbXMLReader &reader, std::string &name)
+{
+    name.clear();
+    glbXMLReaderReadWhile(reader, name, [](char c) { return glbXMLIsNameChar((unsigned char)c); });
+}
+
+void glbXMLAppendUTF8(std::string &str, unsigned int codepoint)
+{
+    if (codepoint < 0x80) {
+        str += (char)codepoint;
+    } else if (codepoint < 0x800) {
+        str += (char)(0xC0 | (codepoint >> 6));
+        str += (char)(0x80 | (codepoint & 0x3F));
+    } else if (codepoint < 0x10000) {
+        str += (char)(0xE0 | (codepoint >> 12));
+        str += (char)(0x80 | ((codepoint >> 6) & 0x3F));
+        str += (char)(0x80 | (codepoint & 0x3F));
+    } else {
+        str += (char)(0xF0 | (codepoint >> 18));
+        str += (char)(0x80 | ((codepoint >> 12) & 0x3F));
+        str += (char)(0x80 | ((codepoint >> 6) & 0x3F));
+        str += (char)(0x80 | (codepoint & 0x3F));
+    }
+}
+
+// Reads a character of text or of an attribute value, decoding character references and normalizing new lines. Unknown references are kept as-is.
+void glbXMLReaderReadChar(glbXMLReader &reader, std::string &str)
+{
+    int c = glbXMLReaderPeek(reader, 0);
+
+    if (c == '\r') {
+        glbXMLReaderAdvance(reader, 1);
+        if (glbXMLReaderPeek(reader, 0) == '\n') {
+            glbXMLReaderAdvance(reader, 1);
+        }
+        str += '\n';
+        return;
+    }
+
+    if (c == '&') {
+        // References are short so the whole thing will always fit in the buffer.
+        std::string reference;
+        for (size_t i = 1; i < 12; ++i) {
+            int referenceChar = glbXMLReaderPeek(reader, i);
+            if (referenceChar == ';') {
+                const char* pReference = reference.c_str();
+                unsigned int codepoint = 0;
+                bool isKnown = true;
+
+                if (reference == "lt") {
+                    codepoint = '<';
+                } else if (reference == "gt") {
+                    codepoint = '>';
+                } else if (reference == "amp") {
+                    codepoint = '&';
+                } else if (reference == "quot") {
+                    codepoint = '"';
+                } else if (reference == "apos") {
+                    codepoint = '\'';
+                } else if (reference.size() > 2 && pReference[0] == '#' && pReference[1] == 'x') {
+                    codepoint = (unsigned int)strtoul(pReference + 2, NULL, 16);
+                } else if (reference.size() > 1 && pReference[0] == '#') {
+                    codepoint = (unsigned int)strtoul(pReference + 1, NULL, 10);
+                } else {
+                    isKnown = false;
+                }
+
+                if (isKnown) {
+                    glbXMLAppendUTF8(str, codepoint);
+                    glbXMLReaderAdvance(reader, i + 1);
+                    return;
+                }
+
+                break;
+            }
+
+            if (referenceChar == -1 || referenceChar == '<') {
+                break;
+            }
+
+            reference += (char)referenceChar;
+        }
+    }
+
+    str += (char)c;
+    glbXMLReaderAdvance(reader, 1);
+}
+
+glbResult glbXMLReaderNext(glbXMLReader &reader, glbXMLToken &token)
+{
+    if (reader.hasPendingEndTag) {
+        reader.hasPendingEndTag = false;
+        reader.openElements.pop_back();
+
+        token.type = GLB_XML_TOKEN_END;     // The name is still set from the start tag.
+        return GLB_SUCCESS;
+    }
+
+    for (;;) {
+        int c = glbXMLReaderPeek(reader, 0);
+        if (c == -1) {
+            if (!reader.openElements.empty()) {
+                return glbXMLReaderError(reader, ("Unexpected end of file. Expecting </" + reader.openElements.back() + ">.").c_str());
+            }
+
+            token.type = GLB_XML_TOKEN_EOF;
+            return GLB_SUCCESS;
+        }
+
+        // Text.
+        if (c != '<') {
+            bool isWhitespaceOnly = true;
+
+            token.text.clear();
+            while ((c = glbXMLReaderPeek(reader, 0)) != -1 && c != '<') {
+                if (c == '&') {
+                    isWhitespaceOnly = false;
+                    glbXMLReaderReadChar(reader, token.text);
+                } else if (c == '\r') {
+                    glbXMLReaderReadChar(reader, token.text);
+                } else if (!glbXMLReaderReadWhile(reader, token.text, [](char c) { return c != '<' && c != '&' && c != '\r'; })) {
+                    isWhitespaceOnly = false;
+                }
+            }
+
+            if (isWhitespaceOnly) {
+                continue;
+            }
+
+            token.type = GLB_XML_TOKEN_TEXT;
+            return GLB_SUCCESS;
+        }
+
+        // Comments, processing instructions and declarations are skipped.
+        if (glbXMLReaderStartsWith(reader, "<!--")) {
+            if (!glbXMLReaderSkipPast(reader, "-->")) {
+                return glbXMLReaderError(reader, "Unterminated comment.");
+            }
+            continue;
+        }
+
+        if (glbXMLReaderStartsWith(reader, "<?")) {
+            if (!glbXMLReaderSkipPast(reader, "?>")) {
+                return glbXMLReaderError(reader, "Unterminated processing instruction.");
+            }
+            continue;
+        }
+
+        if (glbXMLReaderStartsWith(reader, "<!")) {
+            if (!glbXMLReaderSkipPast(reader, ">")) {
+                return glbXMLReaderError(reader, "Unterminated declaration.");
+            }
+            continue;
+        }
+
+        // End tags.
+        if (glbXMLReaderPeek(reader, 1) == '/') {
+            glbXMLReaderAdvance(reader, 2);
+            glbXMLReaderReadName(reader, token.name);
+            glbXMLReaderSkipWhitespace(reader);
+            if (glbXMLReaderPeek(reader, 0) != '>') {
+                return glbXMLReaderError(reader, "Expecting \">\".");
+            }
+            glbXMLReaderAdvance(reader, 1);
+
+            if (reader.openElements.empty() || reader.openElements.back() != token.name) {
+                return glbXMLReaderError(reader, ("Unexpected </" + token.name + ">.").c_str());
+            }
+            reader.openElements.pop_back();
+
+            token.type = GLB_XML_TOKEN_END;
+            return GLB_SUCCESS;
+        }
+
+        // Start tags.
+        glbXMLReaderAdvance(reader, 1);
+        glbXMLReaderReadName(reader, token.name);
+        if (token.name.empty()) {
+            return glbXMLReaderError(reader, "Expecting an element name.");
+        }
+
+        token.attributes.clear();
+        for (;;) {
+            glbXMLReaderSkipWhitespace(reader);
+
+            c = glbXMLReaderPeek(reader, 0);
+            if (c == '>') {
+                glbXMLReaderAdvance(reader, 1);
+                break;
+            }
+            if (c == '/' && glbXMLReaderPeek(reader, 1) == '>') {
+                glbXMLReaderAdvance(reader, 2);
+                reader.hasPendingEndTag = true;
+                break;
+            }
+
+            glbXMLAttribute attribute;
+            glbXMLReaderReadName(reader, attribute.name);
+            if (attribute.name.empty()) {
+                return glbXMLReaderError(reader, ("Unexpected character in <" + token.name + ">.").c_str());
+            }
+
+            glbXMLReaderSkipWhitespace(reader);
+            if (glbXMLReaderPeek(reader, 0) != '=') {
+                return glbXMLReaderError(reader, ("Expecting \"=\" after attribute \"" + attribute.name + "\".").c_str());
+            }
+            glbXMLReaderAdvance(reader, 1);
+            glbXMLReaderSkipWhitespace(reader);
+
+            int quote = glbXMLReaderPeek(reader, 0);
+            if (quote != '"' && quote != '\'') {
+                return glbXMLReaderError(reader, ("Expecting a quoted value for attribute \"" + attribute.name + "\".").c_str());
+            }
+            glbXMLReaderAdvance(reader, 1);
+
+            while ((c = glbXMLReaderPeek(reader, 0)) != quote) {
+                if (c == -1) {
+                    return glbXMLReaderError(reader, "Unterminated attribute value.");
+                }
+
+                if (c == '&' || c == '\r') {
+                    glbXMLReaderReadChar(reader, attribute.value);
+                } else {
+                    glbXMLReaderReadWhile(reader, attribute.value, [quote](char c) { return c != quote && c != '&' && c != '\r'; });
+                }
+            }
+            glbXMLReaderAdvance(reader, 1);
+
+            token.attributes.push_back(std::move(attribute));
+        }
+
+        reader.openElements.push_back(token.name);
+
+        token.type = GLB_XML_TOKEN_START;
+        return GLB_SUCCESS;
+    }
+}
+
+/*
+Retrieves the next child of the element whose start tag was the last token. Returns GLB_END_OF_ELEMENT once the end tag has been read. The
+child is either a start tag or text. A start tag needs to be consumed with glbXMLReaderSkip() or one of the parsing functions before moving
+on to the next child.
+*/
+glbResult glbXMLReaderNextChild(glbXMLReader &reader, glbXMLToken &token)
+{
+    glbResult result = glbXMLReaderNext(reader, token);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    if (token.type == GLB_XML_TOKEN_END) {
+        return GLB_END_OF_ELEMENT;
+    }
+
+    return GLB_SUCCESS;
+}
+
+// Skips over the element whose start tag was the last token, including its end tag. Does nothing for text.
+glbResult glbXMLReaderSkip(glbXMLReader &reader, glbXMLToken &token)
+{
+    if (token.type != GLB_XML_TOKEN_START) {
+        return GLB_SUCCESS;
+    }
+
+    size_t depth = reader.openElements.size();
+    while (reader.openElements.size() >= depth) {
+        glbResult result = glbXMLReaderNext(reader, token);
+        if (result != GLB_SUCCESS) {
+            return result;
+        }
+    }
+
+    return GLB_SUCCESS;
+}
+
+// Reads the text of the element whose start tag was the last token, up to and including its end tag. Text inside child elements is ignored.
+glbResult glbXMLReaderReadText(glbXMLReader &reader, glbXMLToken &token, std::string &text)
+{
+    glbResult result;
+
+    text.clear();
+    while ((result = glbXMLReaderNextChild(reader, token)) == GLB_SUCCESS) {
+        if (token.type == GLB_XML_TOKEN_TEXT) {
+            text += token.text;
+        } else {
+            result = glbXMLReaderSkip(reader, token);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }
+        }
+    }
+
+    return (result == GLB_END_OF_ELEMENT) ? GLB_SUCCESS : result;
+}
+
+bool glbXMLIsStartTag(const glbXMLToken &token, const char* name)
+{
+    return token.type == GLB_XML_TOKEN_START && token.name == name;
+}
+
+// Retrieves the value of an attribute of a start tag. Returns an empty string if the attribute does not exist.
+std::string glbXMLGetAttribute(const glbXMLToken &token, const char* name)
+{
+    for (size_t iAttribute = 0; iAttribute < token.attributes.size(); ++iAttribute) {
+        if (token.attributes[iAttribute].name == name) {
+            return token.attributes[iAttribute].value;
+        }
+    }
+
+    return "";
+}
+
+
+
 
 struct glbType
 {
@@ -301,6 +843,7 @@ struct glbCommands
 
 struct glbRequire
 {
+    std::string profile;    // Attribute. Empty if the block applies to every profile.
     std::vector<std::string> types;
     std::vector<std::string> enums;
     std::vector<std::string> commands;
@@ -312,6 +855,7 @@ struct glbFeature
     std::string name;
     std::string number;
     std::vector<glbRequire> requires;
+    std::vector<glbRequire> removes;
 };
 
 struct glbExtension
@@ -321,8 +865,25 @@ struct glbExtension
     std::vector<glbRequire> requires;
 };
 
+// A file written by the generator, and the hash of its content. See glbBuildWriteOutputFile().
+struct glbOutputFile
+{
+    std::string filePath;
+    uint64_t hash;
+};
+
+// An entry in the resolved command list. Platform guards are stored in-line as entries without a command. See glbBuildResolveCommands().
+struct glbResolvedCommand
+{
+    std::string guard;      // A preprocessor line such as "#if defined(GLBIND_WGL)". Empty for commands.
+    glbCommand* pCommand;   // NULL for guards.
+};
+
 struct glbBuild
 {
+    std::string profile = "compatibility";  // The OpenGL profile being generated. See glbBuildApplyProfile().
+    std::string maxVersion;                 // The highest OpenGL version being generated, such as "3.3". Empty if every version is included. See glbBuildApplySpec().
+
     std::vector<glbType>      types;
     std::vector<glbGroup>     groups;
     std::vector<glbEnums>     enums;
@@ -330,1494 +891,3762 @@ struct glbBuild
     std::vector<glbFeature>   features;
     std::vector<glbExtension> extensions;
 
-    std::vector<std::string> outputTypes;
-    std::vector<std::string> outputEnums;
-    std::vector<std::string> outputCommands;
+    // Lookups into the vectors above, built by glbBuildIndexRegistry() once everything has been loaded. Only the first item with a given
+    // name is indexed, which is the same item a linear search would find.
+    std::unordered_map<std::string, glbType*>    typesByName;
+    std::unordered_map<std::string, glbEnum*>    enumsByName;
+    std::unordered_map<std::string, glbCommand*> commandsByName;
+
+    // Every API in GLBapi in field order, and the ones declared at global scope. Every pass that outputs something for each API uses these
+    // so the struct, the name table, the enum and the binding code are always in the same order. Built by glbBuildResolveCommands().
+    std::vector<glbResolvedCommand> resolvedCommands;
+    std::vector<glbResolvedCommand> resolvedGlobalCommands;
+
+    std::unordered_set<std::string> outputTypes;
+    std::unordered_set<std::string> outputCommands;
+
+    std::vector<glbOutputFile> outputFiles;
 };
 
-glbResult glbBuildParseTypes(glbBuild &context, tinyxml2::XMLNode* pXMLElement)
+glbResult glbBuildParseTypes(glbBuild &context, glbXMLReader &reader, glbXMLToken &token)
 {
-    for (tinyxml2::XMLNode* pChild = pXMLElement->FirstChild(); pChild != NULL; pChild = pChild->NextSibling()) {
-        tinyxml2::XMLElement* pChildElement = pChild->ToElement();
-        if (pChildElement == NULL) {
-            continue;
-        }
+    glbResult result;
 
+    while ((result = glbXMLReaderNextChild(reader, token)) == GLB_SUCCESS) {
         // Ignore <comment> tags.
-        if (strcmp(pChildElement->Name(), "comment") == 0) {
+        if (token.type != GLB_XML_TOKEN_START || token.name == "comment") {
+            result = glbXMLReaderSkip(reader, token);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }
             continue;
         }
 
-        const char* name = pChildElement->Attribute("name");
-        const char* requires = pChildElement->Attribute("requires");
-
         glbType type;
-        type.name     = (name     != NULL) ? name     : "";
-        type.requires = (requires != NULL) ? requires : "";
+        type.name     = glbXMLGetAttribute(token, "name");
+        type.requires = glbXMLGetAttribute(token, "requires");
 
         // The inner content of the child will contain the C code. We need to parse this by simply appending the text content together.
-        for (tinyxml2::XMLNode* pInnerChild = pChild->FirstChild(); pInnerChild != NULL; pInnerChild = pInnerChild->NextSibling()) {
-            tinyxml2::XMLElement* pInnerChildElement = pInnerChild->ToElement();
-            if (pInnerChildElement != NULL) {
-                if (strcmp(pInnerChildElement->Name(), "name") == 0) {
-                    type.name = pInnerChildElement->FirstChild()->Value();
-                    type.valueC += type.name;
-                }
-                if (strcmp(pInnerChildElement->Name(), "apientry") == 0) {
+        while ((result = glbXMLReaderNextChild(reader, token)) == GLB_SUCCESS) {
+            if (token.type == GLB_XML_TOKEN_TEXT) {
+                type.valueC += token.text;
+            } else if (token.name == "name") {
+                result = glbXMLReaderReadText(reader, token, type.name);
+                type.valueC += type.name;
+            } else {
+                if (token.name == "apientry") {
                     type.valueC += "APIENTRY";
                 }
-            } else {
-                type.valueC += pInnerChild->Value();
+                result = glbXMLReaderSkip(reader, token);
+            }
+
+            if (result != GLB_SUCCESS) {
+                return result;
             }
         }
 
-        context.types.push_back(type);
+        if (result != GLB_END_OF_ELEMENT) {
+            return result;
+        }
+
+        context.types.push_back(std::move(type));
     }
 
-    return GLB_SUCCESS;
+    return (result == GLB_END_OF_ELEMENT) ? GLB_SUCCESS : result;
 }
 
-glbResult glbBuildParseEnum(glbBuild &context, tinyxml2::XMLElement* pXMLElement, glbEnum &theEnum)
+glbResult glbBuildParseEnum(glbBuild &context, const glbXMLToken &token, glbEnum &theEnum)
 {
     (void)context;
 
-    const char* name  = pXMLElement->Attribute("name");
-    const char* value = pXMLElement->Attribute("value");
-    const char* type  = pXMLElement->Attribute("type");
-
-    theEnum.name  = (name  != NULL) ? name  : "";
-    theEnum.value = (value != NULL) ? value : "";
-    theEnum.type  = (type  != NULL) ? type  : "";
+    theEnum.name  = glbXMLGetAttribute(token, "name");
+    theEnum.value = glbXMLGetAttribute(token, "value");
+    theEnum.type  = glbXMLGetAttribute(token, "type");
 
     return GLB_SUCCESS;
 }
 
-glbResult glbBuildParseEnums(glbBuild &context, tinyxml2::XMLElement* pXMLElement)
+glbResult glbBuildParseEnums(glbBuild &context, glbXMLReader &reader, glbXMLToken &token)
 {
-    const char* name   = pXMLElement->Attribute("name");
-    const char* namespaceAttrib = pXMLElement->Attribute("namespace");
-    const char* group  = pXMLElement->Attribute("group");
-    const char* vendor = pXMLElement->Attribute("vendor");
-    const char* type   = pXMLElement->Attribute("type");
-    const char* start  = pXMLElement->Attribute("start");
-    const char* end    = pXMLElement->Attribute("end");
+    glbResult result;
 
     glbEnums enums;
-    enums.name            = (name            != NULL) ? name            : "";
-    enums.namespaceAttrib = (namespaceAttrib != NULL) ? namespaceAttrib : "";
-    enums.group           = (group           != NULL) ? group           : "";
-    enums.vendor          = (vendor          != NULL) ? vendor          : "";
-    enums.type            = (type            != NULL) ? type            : "";
-    enums.start           = (start           != NULL) ? start           : "";
-    enums.end             = (end             != NULL) ? end             : "";
-
-    for (tinyxml2::XMLNode* pChild = pXMLElement->FirstChild(); pChild != NULL; pChild = pChild->NextSibling()) {
-        tinyxml2::XMLElement* pChildElement = pChild->ToElement();
-        if (pChildElement == NULL) {
-            continue;
-        }
-
+    enums.name            = glbXMLGetAttribute(token, "name");
+    enums.namespaceAttrib = glbXMLGetAttribute(token, "namespace");
+    enums.group           = glbXMLGetAttribute(token, "group");
+    enums.vendor          = glbXMLGetAttribute(token, "vendor");
+    enums.type            = glbXMLGetAttribute(token, "type");
+    enums.start           = glbXMLGetAttribute(token, "start");
+    enums.end             = glbXMLGetAttribute(token, "end");
+
+    while ((result = glbXMLReaderNextChild(reader, token)) == GLB_SUCCESS) {
         // Ignore <comment> tags.
-        if (strcmp(pChildElement->Name(), "enum") == 0) {
+        if (glbXMLIsStartTag(token, "enum")) {
             glbEnum theEnum;
-            glbResult result = glbBuildParseEnum(context, pChildElement, theEnum);
-            if (result == GLB_SUCCESS) {
-                enums.enums.push_back(theEnum);
+            if (glbBuildParseEnum(context, token, theEnum) == GLB_SUCCESS) {
+                enums.enums.push_back(std::move(theEnum));
             }
         }
+
+        result = glbXMLReaderSkip(reader, token);
+        if (result != GLB_SUCCESS) {
+            return result;
+        }
     }
 
-    context.enums.push_back(enums);
+    if (result != GLB_END_OF_ELEMENT) {
+        return result;
+    }
+
+    context.enums.push_back(std::move(enums));
 
     return GLB_SUCCESS;
 }
 
-glbResult glbBuildParseGroup(glbBuild &context, tinyxml2::XMLElement* pXMLElement, glbGroup &group)
+glbResult glbBuildParseGroup(glbBuild &context, glbXMLReader &reader, glbXMLToken &token, glbGroup &group)
 {
-    const char* name = pXMLElement->Attribute("name");
-
-    group.name = (name != NULL) ? name : "";
+    glbResult result;
 
-    for (tinyxml2::XMLNode* pChild = pXMLElement->FirstChild(); pChild != NULL; pChild = pChild->NextSibling()) {
-        tinyxml2::XMLElement* pChildElement = pChild->ToElement();
-        if (pChildElement == NULL) {
-            continue;
-        }
+    group.name = glbXMLGetAttribute(token, "name");
 
-        if (strcmp(pChildElement->Name(), "enum") == 0) {
+    while ((result = glbXMLReaderNextChild(reader, token)) == GLB_SUCCESS) {
+        if (glbXMLIsStartTag(token, "enum")) {
             glbEnum theEnum;
-            glbResult result = glbBuildParseEnum(context, pChildElement, theEnum);
-            if (result == GLB_SUCCESS) {
-                group.enums.push_back(theEnum);
+            if (glbBuildParseEnum(context, token, theEnum) == GLB_SUCCESS) {
+                group.enums.push_back(std::move(theEnum));
             }
         }
+
+        result = glbXMLReaderSkip(reader, token);
+        if (result != GLB_SUCCESS) {
+            return result;
+        }
     }
 
-    return GLB_SUCCESS;
+    return (result == GLB_END_OF_ELEMENT) ? GLB_SUCCESS : result;
 }
 
-glbResult glbBuildParseGroups(glbBuild &context, tinyxml2::XMLElement* pXMLElement)
+glbResult glbBuildParseGroups(glbBuild &context, glbXMLReader &reader, glbXMLToken &token)
 {
-    for (tinyxml2::XMLNode* pChild = pXMLElement->FirstChild(); pChild != NULL; pChild = pChild->NextSibling()) {
-        tinyxml2::XMLElement* pChildElement = pChild->ToElement();
-        if (pChildElement == NULL) {
-            continue;
-        }
+    glbResult result;
 
-        if (strcmp(pChildElement->Name(), "group") == 0) {
+    while ((result = glbXMLReaderNextChild(reader, token)) == GLB_SUCCESS) {
+        if (glbXMLIsStartTag(token, "group")) {
             glbGroup group;
-            glbResult result = glbBuildParseGroup(context, pChildElement, group);
-            if (result == GLB_SUCCESS) {
-                context.groups.push_back(group);
+            result = glbBuildParseGroup(context, reader, token, group);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }
+
+            context.groups.push_back(std::move(group));
+        } else {
+            result = glbXMLReaderSkip(reader, token);
+            if (result != GLB_SUCCESS) {
+                return result;
             }
         }
     }
 
-    return GLB_SUCCESS;
+    return (result == GLB_END_OF_ELEMENT) ? GLB_SUCCESS : result;
 }
 
-glbResult glbBuildParseTypeNamePair(tinyxml2::XMLElement* pXMLElement, std::string &type, std::string &typeC, std::string &name)
+glbResult glbBuildParseTypeNamePair(glbXMLReader &reader, glbXMLToken &token, std::string &type, std::string &typeC, std::string &name)
 {
+    glbResult result;
+    bool hasName = false;
+
     // Everything up to the name is the type. We set "type" to the value inside the <type> or <ptype> tag, if any. "typeC" will be set to the
-    // whole type up to, but not including, the <name> tag.
+    // whole type up to, but not including, the <name> tag. Anything after the name is ignored.
     type  = "";
     typeC = "";
     name  = "";
 
-    for (tinyxml2::XMLNode* pChild = pXMLElement->FirstChild(); pChild != NULL; pChild = pChild->NextSibling()) {
-        tinyxml2::XMLElement* pChildElement = pChild->ToElement();
-        if (pChildElement != NULL) {
-            if (strcmp(pChildElement->Name(), "name") == 0) {
-                name = pChildElement->FirstChild()->Value();
-                break;
-            } else {
-                typeC += pChildElement->FirstChild()->Value();
-                if (strcmp(pChildElement->Name(), "type") == 0 || strcmp(pChildElement->Name(), "ptype") == 0) {
-                    type = pChildElement->FirstChild()->Value();
-                }
-            }
+    while ((result = glbXMLReaderNextChild(reader, token)) == GLB_SUCCESS) {
+        if (hasName) {
+            result = glbXMLReaderSkip(reader, token);
+        } else if (token.type == GLB_XML_TOKEN_TEXT) {
+            typeC += token.text;
+        } else if (token.name == "name") {
+            result = glbXMLReaderReadText(reader, token, name);
+            hasName = true;
         } else {
-            typeC += pChild->Value();
+            bool isType = (token.name == "type" || token.name == "ptype");
+
+            std::string text;
+            result = glbXMLReaderReadText(reader, token, text);
+            typeC += text;
+            if (isType) {
+                type = text;
+            }
+        }
+
+        if (result != GLB_SUCCESS) {
+            return result;
         }
     }
 
+    if (result != GLB_END_OF_ELEMENT) {
+        return result;
+    }
+
     typeC = glbTrim(typeC);
 
     return GLB_SUCCESS;
 }
 
-glbResult glbBuildParseCommandParam(glbBuild &context, tinyxml2::XMLElement* pXMLElement, glbCommandParam &param)
+glbResult glbBuildParseCommandParam(glbBuild &context, glbXMLReader &reader, glbXMLToken &token, glbCommandParam &param)
 {
     (void)context;
 
-    return glbBuildParseTypeNamePair(pXMLElement, param.type, param.typeC, param.name);
+    return glbBuildParseTypeNamePair(reader, token, param.type, param.typeC, param.name);
 }
 
-glbResult glbBuildParseCommand(glbBuild &context, tinyxml2::XMLElement* pXMLElement, glbCommand &command)
+glbResult glbBuildParseCommand(glbBuild &context, glbXMLReader &reader, glbXMLToken &token, glbCommand &command)
 {
-    for (tinyxml2::XMLNode* pChild = pXMLElement->FirstChild(); pChild != NULL; pChild = pChild->NextSibling()) {
-        tinyxml2::XMLElement* pChildElement = pChild->ToElement();
-        if (pChildElement == NULL) {
-            continue;
-        }
-
-        if (strcmp(pChildElement->Name(), "proto") == 0) {
-            glbBuildParseTypeNamePair(pChildElement, command.returnType, command.returnTypeC, command.name);
-        }
+    glbResult result;
 
-        if (strcmp(pChildElement->Name(), "param") == 0) {
+    while ((result = glbXMLReaderNextChild(reader, token)) == GLB_SUCCESS) {
+        if (glbXMLIsStartTag(token, "proto")) {
+            result = glbBuildParseTypeNamePair(reader, token, command.returnType, command.returnTypeC, command.name);
+        } else if (glbXMLIsStartTag(token, "param")) {
             glbCommandParam param;
-            glbResult result = glbBuildParseCommandParam(context, pChildElement, param);
-            if (result != GLB_SUCCESS) {
-                return result;
+            result = glbBuildParseCommandParam(context, reader, token, param);
+            if (result == GLB_SUCCESS) {
+                command.params.push_back(std::move(param));
             }
-
-            command.params.push_back(param);
+        } else {
+            if (glbXMLIsStartTag(token, "alias")) {
+                command.alias = glbXMLGetAttribute(token, "name");
+            }
+            result = glbXMLReaderSkip(reader, token);
         }
 
-        if (strcmp(pChildElement->Name(), "alias") == 0) {
-            const char* alias = pChildElement->Attribute("name");
-            command.alias = (alias != NULL) ? alias : "";
+        if (result != GLB_SUCCESS) {
+            return result;
         }
     }
 
-    return GLB_SUCCESS;
+    return (result == GLB_END_OF_ELEMENT) ? GLB_SUCCESS : result;
 }
 
-glbResult glbBuildParseCommands(glbBuild &context, tinyxml2::XMLElement* pXMLElement)
+glbResult glbBuildParseCommands(glbBuild &context, glbXMLReader &reader, glbXMLToken &token)
 {
+    glbResult result;
     glbCommands commands;
 
-    const char* namespaceAttrib = pXMLElement->Attribute("namespace");
-    commands.namespaceAttrib = (namespaceAttrib != NULL) ? namespaceAttrib : "";
-
-    for (tinyxml2::XMLNode* pChild = pXMLElement->FirstChild(); pChild != NULL; pChild = pChild->NextSibling()) {
-        tinyxml2::XMLElement* pChildElement = pChild->ToElement();
-        if (pChildElement == NULL) {
-            continue;
-        }
+    commands.namespaceAttrib = glbXMLGetAttribute(token, "namespace");
 
-        if (strcmp(pChildElement->Name(), "command") == 0) {
+    while ((result = glbXMLReaderNextChild(reader, token)) == GLB_SUCCESS) {
+        if (glbXMLIsStartTag(token, "command")) {
             glbCommand command;
-            glbResult result = glbBuildParseCommand(context, pChildElement, command);
-            if (result == GLB_SUCCESS) {
-                commands.commands.push_back(command);
+            result = glbBuildParseCommand(context, reader, token, command);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }
+
+            commands.commands.push_back(std::move(command));
+        } else {
+            result = glbXMLReaderSkip(reader, token);
+            if (result != GLB_SUCCESS) {
+                return result;
             }
         }
     }
 
-    context.commands.push_back(commands);
+    if (result != GLB_END_OF_ELEMENT) {
+        return result;
+    }
+
+    context.commands.push_back(std::move(commands));
 
     return GLB_SUCCESS;
 }
 
-glbResult glbBuildParseRequire(glbBuild &context, tinyxml2::XMLElement* pXMLElement, glbRequire &require)
+// Also used for <remove> blocks since they have the same structure.
+glbResult glbBuildParseRequire(glbBuild &context, glbXMLReader &reader, glbXMLToken &token, glbRequire &require)
 {
     (void)context;
 
-    for (tinyxml2::XMLNode* pChild = pXMLElement->FirstChild(); pChild != NULL; pChild = pChild->NextSibling()) {
-        tinyxml2::XMLElement* pChildElement = pChild->ToElement();
-        if (pChildElement == NULL) {
-            continue;
+    glbResult result;
+
+    require.profile = glbXMLGetAttribute(token, "profile");
+
+    while ((result = glbXMLReaderNextChild(reader, token)) == GLB_SUCCESS) {
+        if (glbXMLIsStartTag(token, "type")) {
+            require.types.push_back(glbXMLGetAttribute(token, "name"));
         }
 
-        if (strcmp(pChildElement->Name(), "type") == 0) {
-            require.types.push_back(pChildElement->Attribute("name"));
+        if (glbXMLIsStartTag(token, "enum")) {
+            require.enums.push_back(glbXMLGetAttribute(token, "name"));
         }
 
-        if (strcmp(pChildElement->Name(), "enum") == 0) {
-            require.enums.push_back(pChildElement->Attribute("name"));
+        if (glbXMLIsStartTag(token, "command")) {
+            require.commands.push_back(glbXMLGetAttribute(token, "name"));
         }
 
-        if (strcmp(pChildElement->Name(), "command") == 0) {
-            require.commands.push_back(pChildElement->Attribute("name"));
+        result = glbXMLReaderSkip(reader, token);
+        if (result != GLB_SUCCESS) {
+            return result;
         }
     }
 
-    return GLB_SUCCESS;
+    return (result == GLB_END_OF_ELEMENT) ? GLB_SUCCESS : result;
 }
 
-glbResult glbBuildParseFeature(glbBuild &context, tinyxml2::XMLElement* pXMLElement)
+glbResult glbBuildParseFeature(glbBuild &context, glbXMLReader &reader, glbXMLToken &token)
 {
+    glbResult result;
     glbFeature feature;
 
-    const char* api    = pXMLElement->Attribute("api");
-    const char* name   = pXMLElement->Attribute("name");
-    const char* number = pXMLElement->Attribute("number");
-
-    feature.api    = (api    != NULL) ? api    : "";
-    feature.name   = (name   != NULL) ? name   : "";
-    feature.number = (number != NULL) ? number : "";
-
-    for (tinyxml2::XMLNode* pChild = pXMLElement->FirstChild(); pChild != NULL; pChild = pChild->NextSibling()) {
-        tinyxml2::XMLElement* pChildElement = pChild->ToElement();
-        if (pChildElement == NULL) {
-            continue;
-        }
+    feature.api    = glbXMLGetAttribute(token, "api");
+    feature.name   = glbXMLGetAttribute(token, "name");
+    feature.number = glbXMLGetAttribute(token, "number");
 
-        if (strcmp(pChildElement->Name(), "require") == 0) {
+    while ((result = glbXMLReaderNextChild(reader, token)) == GLB_SUCCESS) {
+        if (glbXMLIsStartTag(token, "require")) {
             glbRequire require;
-            glbResult result = glbBuildParseRequire(context, pChildElement, require);
+            result = glbBuildParseRequire(context, reader, token, require);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }
+
+            feature.requires.push_back(std::move(require));
+        } else if (glbXMLIsStartTag(token, "remove")) {
+            glbRequire remove;
+            result = glbBuildParseRequire(context, reader, token, remove);
             if (result != GLB_SUCCESS) {
                 return result;
             }
 
-            feature.requires.push_back(require);
+            feature.removes.push_back(std::move(remove));
+        } else {
+            result = glbXMLReaderSkip(reader, token);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }
         }
     }
 
-    context.features.push_back(feature);
+    if (result != GLB_END_OF_ELEMENT) {
+        return result;
+    }
+
+    context.features.push_back(std::move(feature));
 
     return GLB_SUCCESS;
 }
 
 
-glbResult glbBuildParseExtension(glbBuild &context, tinyxml2::XMLElement* pXMLElement, glbExtension &extension)
+glbResult glbBuildParseExtension(glbBuild &context, glbXMLReader &reader, glbXMLToken &token, glbExtension &extension)
 {
-    const char* name      = pXMLElement->Attribute("name");
-    const char* supported = pXMLElement->Attribute("supported");
-
-    extension.name      = (name      != NULL) ? name      : "";
-    extension.supported = (supported != NULL) ? supported : "";
+    glbResult result;
 
-    for (tinyxml2::XMLNode* pChild = pXMLElement->FirstChild(); pChild != NULL; pChild = pChild->NextSibling()) {
-        tinyxml2::XMLElement* pChildElement = pChild->ToElement();
-        if (pChildElement == NULL) {
-            continue;
-        }
+    extension.name      = glbXMLGetAttribute(token, "name");
+    extension.supported = glbXMLGetAttribute(token, "supported");
 
-        if (strcmp(pChildElement->Name(), "require") == 0) {
+    while ((result = glbXMLReaderNextChild(reader, token)) == GLB_SUCCESS) {
+        if (glbXMLIsStartTag(token, "require")) {
             glbRequire require;
-            glbResult result = glbBuildParseRequire(context, pChildElement, require);
+            result = glbBuildParseRequire(context, reader, token, require);
             if (result != GLB_SUCCESS) {
                 return result;
             }
 
-            extension.requires.push_back(require);
+            extension.requires.push_back(std::move(require));
+        } else {
+            result = glbXMLReaderSkip(reader, token);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }
         }
     }
 
-    return GLB_SUCCESS;
+    return (result == GLB_END_OF_ELEMENT) ? GLB_SUCCESS : result;
 }
 
-glbResult glbBuildParseExtensions(glbBuild &context, tinyxml2::XMLElement* pXMLElement)
+glbResult glbBuildParseExtensions(glbBuild &context, glbXMLReader &reader, glbXMLToken &token)
 {
-    for (tinyxml2::XMLNode* pChild = pXMLElement->FirstChild(); pChild != NULL; pChild = pChild->NextSibling()) {
-        tinyxml2::XMLElement* pChildElement = pChild->ToElement();
-        if (pChildElement == NULL) {
-            continue;
-        }
+    glbResult result;
 
-        if (strcmp(pChildElement->Name(), "extension") == 0) {
+    while ((result = glbXMLReaderNextChild(reader, token)) == GLB_SUCCESS) {
+        if (glbXMLIsStartTag(token, "extension")) {
             glbExtension extension;
-            glbResult result = glbBuildParseExtension(context, pChildElement, extension);
+            result = glbBuildParseExtension(context, reader, token, extension);
             if (result != GLB_SUCCESS) {
                 return result;
             }
 
-            context.extensions.push_back(extension);
+            context.extensions.push_back(std::move(extension));
+        } else {
+            result = glbXMLReaderSkip(reader, token);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }
         }
     }
 
-    return GLB_SUCCESS;
+    return (result == GLB_END_OF_ELEMENT) ? GLB_SUCCESS : result;
 }
 
-glbResult glbBuildLoadXML(glbBuild &context, tinyxml2::XMLDocument &doc)
+glbResult glbBuildLoadXML(glbBuild &context, glbXMLReader &reader)
 {
+    glbResult result;
+    glbXMLToken token;
+
     // The root node is the <registry> node.
-    tinyxml2::XMLElement* pRoot = doc.RootElement();
-    if (pRoot == NULL) {
+    do {
+        result = glbXMLReaderNext(reader, token);
+        if (result != GLB_SUCCESS) {
+            return result;
+        }
+    } while (token.type == GLB_XML_TOKEN_TEXT);
+
+    if (token.type != GLB_XML_TOKEN_START) {
         printf("Failed to retrieve root node.\n");
         return -1;
     }
 
-    if (strcmp(pRoot->Name(), "registry") != 0) {
-        printf("Unexpected root node. Expecting \"registry\", but got \"%s\"", pRoot->Name());
+    if (token.name != "registry") {
+        printf("Unexpected root node. Expecting \"registry\", but got \"%s\"", token.name.c_str());
         return -1;
     }
 
-    for (tinyxml2::XMLNode* pChild = pRoot->FirstChild(); pChild != NULL; pChild = pChild->NextSibling()) {
-        tinyxml2::XMLElement* pChildElement = pChild->ToElement();
-        if (pChildElement == NULL) {
-            continue;   // Could be a comment. In any case we don't care about anything that's not in a child node.
+    while ((result = glbXMLReaderNextChild(reader, token)) == GLB_SUCCESS) {
+        // Text and comments are skipped. In any case we don't care about anything that's not in a child node.
+        if (glbXMLIsStartTag(token, "types")) {
+            result = glbBuildParseTypes(context, reader, token);
+        } else if (glbXMLIsStartTag(token, "groups")) {
+            result = glbBuildParseGroups(context, reader, token);
+        } else if (glbXMLIsStartTag(token, "enums")) {
+            result = glbBuildParseEnums(context, reader, token);
+        } else if (glbXMLIsStartTag(token, "commands")) {
+            result = glbBuildParseCommands(context, reader, token);
+        } else if (glbXMLIsStartTag(token, "feature")) {
+            result = glbBuildParseFeature(context, reader, token);
+        } else if (glbXMLIsStartTag(token, "extensions")) {
+            result = glbBuildParseExtensions(context, reader, token);
+        } else {
+            result = glbXMLReaderSkip(reader, token);
         }
 
-        if (strcmp(pChildElement->Name(), "types") == 0) {
-            glbBuildParseTypes(context, pChildElement);
-        }
-        if (strcmp(pChildElement->Name(), "groups") == 0) {
-            glbBuildParseGroups(context, pChildElement);
-        }
-        if (strcmp(pChildElement->Name(), "enums") == 0) {
-            glbBuildParseEnums(context, pChildElement);
-        }
-        if (strcmp(pChildElement->Name(), "commands") == 0) {
-            glbBuildParseCommands(context, pChildElement);
-        }
-        if (strcmp(pChildElement->Name(), "feature") == 0) {
-            glbBuildParseFeature(context, pChildElement);
-        }
-        if (strcmp(pChildElement->Name(), "extensions") == 0) {
-            glbBuildParseExtensions(context, pChildElement);
+        if (result != GLB_SUCCESS) {
+            return result;
         }
     }
 
-    return GLB_SUCCESS;
+    return (result == GLB_END_OF_ELEMENT) ? GLB_SUCCESS : result;
 }
 
-glbResult glbBuildLoadXMLFile(glbBuild &context, const char* filePath)
+// Removes every item in namesToRemove from names.
+void glbEraseNames(std::vector<std::string> &names, const std::vector<std::string> &namesToRemove)
 {
-    tinyxml2::XMLDocument docGL;
-    tinyxml2::XMLError xmlError = docGL.LoadFile(filePath);
-    if (xmlError != tinyxml2::XML_SUCCESS) {
-        printf("Failed to parse %s\n", filePath);
-        return (int)xmlError;
-    }
+    std::unordered_set<std::string> namesToRemoveSet(namesToRemove.begin(), namesToRemove.end());
 
-    return glbBuildLoadXML(context, docGL);
+    names.erase(std::remove_if(names.begin(), names.end(), [&](const std::string &name) {
+        return namesToRemoveSet.count(name) > 0;
+    }), names.end());
 }
 
-
-bool glbDoesExtensionBelongToVendor(const std::string &extensionName, const std::string &vendor)
+// Removes the require blocks that are specific to a profile other than the given one.
+void glbEraseRequiresForOtherProfiles(std::vector<glbRequire> &requires, const std::string &profile)
 {
-    return extensionName.find("_" + vendor + "_") != std::string::npos;
+    requires.erase(std::remove_if(requires.begin(), requires.end(), [&](const glbRequire &require) {
+        return !require.profile.empty() && require.profile != profile;
+    }), requires.end());
 }
 
-bool glbIsExtensionBlackListed(const char* extensionName)
+/*
+Trims the registry down to the given OpenGL profile ("core" or "compatibility"). This is done on the parsed registry, before any code is
+generated, so that every generation pass sees the same set of types, enums and commands.
+
+For the compatibility profile everything is kept, as it always has been. For the core profile, the <remove> blocks of each feature are
+applied to the features that came before it, require blocks for the compatibility profile are dropped, and so are the extensions that are
+not supported by core contexts. A <remove> doesn't affect extensions, which matches how the registry defines it.
+*/
+glbResult glbBuildApplyProfile(glbBuild &context, const std::string &profile)
 {
-    for (auto blacklistedExtension : g_BlacklistedExtensions) {
-        if (strcmp(blacklistedExtension, extensionName) == 0) {
-            return true;
-        }
+    if (profile != "core" && profile != "compatibility") {
+        printf("Unknown profile \"%s\". Expecting \"core\" or \"compatibility\".\n", profile.c_str());
+        return GLB_INVALID_ARGS;
     }
 
-    for (auto vendor : g_BlacklistedExtensionVendors) {
-        if (glbDoesExtensionBelongToVendor(extensionName, vendor)) {
-            return true;
-        }
+    context.profile = profile;
+
+    if (profile == "compatibility") {
+        return GLB_SUCCESS;
     }
 
-    return false;
-}
+    // Features are in version order so anything removed by a feature only needs to be removed from the ones before it.
+    for (size_t iFeature = 0; iFeature < context.features.size(); ++iFeature) {
+        glbFeature &feature = context.features[iFeature];
+        glbEraseRequiresForOtherProfiles(feature.requires, profile);
 
-bool glbBuildIsCommandIgnored(const char* commandName)
-{
-    // The following commands should not be included in anything as they are not strictly OpenGL related.
-    static const char* ignoredCommands[] = {
-        "ChoosePixelFormat",
-        "DescribePixelFormat",
-        "GetEnhMetaFilePixelFormat",
-        "GetPixelFormat",
-        "SetPixelFormat",
-        "SwapBuffers",
-        "wglUseFontBitmaps",
-        "wglUseFontOutlines",
-    };
+        for (size_t iRemove = 0; iRemove < feature.removes.size(); ++iRemove) {
+            const glbRequire &remove = feature.removes[iRemove];
+            if (!remove.profile.empty() && remove.profile != profile) {
+                continue;
+            }
 
-    for (size_t i = 0; i < sizeof(ignoredCommands)/sizeof(ignoredCommands[0]); ++i) {
-        if (strcmp(ignoredCommands[i], commandName) == 0) {
-            return true;
+            for (size_t iPrevFeature = 0; iPrevFeature < iFeature; ++iPrevFeature) {
+                glbFeature &prevFeature = context.features[iPrevFeature];
+                if (prevFeature.api != feature.api) {
+                    continue;
+                }
+
+                for (size_t iRequire = 0; iRequire < prevFeature.requires.size(); ++iRequire) {
+                    glbEraseNames(prevFeature.requires[iRequire].types,    remove.types);
+                    glbEraseNames(prevFeature.requires[iRequire].enums,    remove.enums);
+                    glbEraseNames(prevFeature.requires[iRequire].commands, remove.commands);
+                }
+            }
         }
     }
 
-    return false;
+    // Extensions. Only the OpenGL ones are affected. The platform-specific ones have nothing to do with the context profile.
+    for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
+        glbEraseRequiresForOtherProfiles(context.extensions[iExtension].requires, profile);
+    }
+
+    context.extensions.erase(std::remove_if(context.extensions.begin(), context.extensions.end(), [](const glbExtension &extension) {
+        bool isGL = extension.supported == "gl" || glbContains(extension.supported, "gl|") || glbContains(extension.supported, "glcore");
+        return isGL && !glbContains(extension.supported, "glcore");
+    }), context.extensions.end());
+
+    return GLB_SUCCESS;
 }
 
+/*
+A spec file describes a trimmed down header. It's a plain text file with one setting per line. Everything after a # is a comment.
 
-bool glbBuildHasTypeBeenOutput(glbBuild &context, const char* typeName)
+    api        gl
+    version    3.3
+    profile    core
+    extensions GL_ARB_direct_state_access GL_KHR_debug
+
+Every setting is optional. "extensions" can be specified any number of times and can list both OpenGL and platform-specific extensions.
+When no extensions are listed every extension is included. The platform-specific extensions in g_RequiredPlatformExtensions are always
+included because glbind itself depends on them.
+*/
+struct glbSpec
 {
-    for (size_t iType = 0; iType < context.outputTypes.size(); ++iType) {
-        if (context.outputTypes[iType] == typeName) {
-            return true;
-        }
+    std::string api;
+    std::string version;
+    std::string profile;
+    std::vector<std::string> extensions;
+};
+
+glbResult glbBuildLoadSpecFile(const char* filePath, glbSpec &spec)
+{
+    char* pFileData;
+    glbResult result = glbOpenAndReadTextFile(filePath, NULL, &pFileData);
+    if (result != GLB_SUCCESS) {
+        printf("Failed to open spec file %s.\n", filePath);
+        return result;
     }
 
-    return false;   /* Not found. */
-}
+    std::string fileData = pFileData;
+    free(pFileData);
 
-bool glbBuildHasCommandBeenOutput(glbBuild &context, const char* commandName)
-{
-    for (size_t iCommand = 0; iCommand < context.outputCommands.size(); ++iCommand) {
-        if (context.outputCommands[iCommand] == commandName) {
-            return true;
+    size_t lineNumber = 0;
+    size_t lineBeg = 0;
+    while (lineBeg < fileData.size()) {
+        size_t lineEnd = fileData.find('\n', lineBeg);
+        if (lineEnd == std::string::npos) {
+            lineEnd = fileData.size();
         }
-    }
 
-    return false;   /* Not found. */
-}
+        std::string line = fileData.substr(lineBeg, lineEnd - lineBeg);
+        lineBeg = lineEnd + 1;
+        lineNumber += 1;
 
-glbResult glbBuildFindType(glbBuild &context, const char* typeName, glbType** ppType)
-{
-    *ppType = NULL;
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) {
+            line = line.substr(0, comment);
+        }
 
-    for (size_t iType = 0; iType < context.types.size(); ++iType) {
-        if (context.types[iType].name == typeName) {
-            *ppType = &context.types[iType];
-            return GLB_SUCCESS;
+        std::vector<std::string> words;
+        size_t wordBeg = line.find_first_not_of(" \t\r");
+        while (wordBeg != std::string::npos) {
+            size_t wordEnd = line.find_first_of(" \t\r", wordBeg);
+            if (wordEnd == std::string::npos) {
+                wordEnd = line.size();
+            }
+
+            words.push_back(line.substr(wordBeg, wordEnd - wordBeg));
+            wordBeg = line.find_first_not_of(" \t\r", wordEnd);
         }
-    }
-    
-    return GLB_ERROR;
-}
 
-glbResult glbBuildFindEnum(glbBuild &context, const char* enumName, glbEnum** ppEnum)
-{
-    *ppEnum = NULL;
+        if (words.empty()) {
+            continue;
+        }
 
-    for (size_t iEnums = 0; iEnums < context.enums.size(); ++iEnums) {
-        glbEnums &enums = context.enums[iEnums];
-        for (size_t iEnum = 0; iEnum < enums.enums.size(); ++iEnum) {
-            if (context.enums[iEnums].enums[iEnum].name == enumName) {
-                *ppEnum = &context.enums[iEnums].enums[iEnum];
-                return GLB_SUCCESS;
+        const std::string &key = words[0];
+        if (key == "extensions") {
+            spec.extensions.insert(spec.extensions.end(), words.begin() + 1, words.end());
+        } else if ((key == "api" || key == "version" || key == "profile") && words.size() == 2) {
+            if (key == "api") {
+                spec.api = words[1];
+            } else if (key == "version") {
+                spec.version = words[1];
+            } else {
+                spec.profile = words[1];
             }
+        } else {
+            printf("%s(%d): Unexpected setting \"%s\".\n", filePath, (int)lineNumber, glbTrim(line).c_str());
+            return GLB_INVALID_ARGS;
         }
     }
-    
-    return GLB_ERROR;
+
+    return GLB_SUCCESS;
 }
 
-glbResult glbBuildFindCommand(glbBuild &context, const char* commandName, glbCommand** ppCommand)
+/*
+Trims the registry down to what's described by the spec. Like glbBuildApplyProfile() this is done before any code is generated. Since types
+are only output when something requires them, the generated header ends up with just the closure of the selected versions and extensions.
+The profile is not applied here.
+*/
+glbResult glbBuildApplySpec(glbBuild &context, const glbSpec &spec)
 {
-    *ppCommand = NULL;
+    // Only desktop OpenGL is generated at the moment. See the TODO in glbBuildGenerateCode_C_Main().
+    if (!spec.api.empty() && spec.api != "gl") {
+        printf("Unsupported API \"%s\". Only \"gl\" is supported.\n", spec.api.c_str());
+        return GLB_INVALID_ARGS;
+    }
 
-    for (size_t iCommands = 0; iCommands < context.commands.size(); ++iCommands) {
-        glbCommands &commands = context.commands[iCommands];
-        for (size_t iCommand = 0; iCommand < commands.commands.size(); ++iCommand) {
-            if (context.commands[iCommands].commands[iCommand].name == commandName) {
-                *ppCommand = &context.commands[iCommands].commands[iCommand];
-                return GLB_SUCCESS;
+    if (!spec.version.empty()) {
+        bool isKnownVersion = false;
+        for (size_t iFeature = 0; iFeature < context.features.size(); ++iFeature) {
+            if (context.features[iFeature].api == "gl" && context.features[iFeature].number == spec.version) {
+                isKnownVersion = true;
+                break;
             }
         }
-    }
-    
-    return GLB_ERROR;
-}
 
+        if (!isKnownVersion) {
+            printf("Unknown OpenGL version \"%s\".\n", spec.version.c_str());
+            return GLB_INVALID_ARGS;
+        }
 
-glbResult glbBuildGenerateCode_C_Main_Type(glbBuild &context, const char* typeName, std::string &codeOut)
-{
-    // Special case for khrplatform. We don't want to include this because we don't use khrplatform.h. Just pretend it's already been output.
-    if (strcmp(typeName, "khrplatform") == 0) {
-        return GLB_ALREADY_PROCESSED;
+        // The version is known to be in "major.minor" format at this point.
+        int maxMajor = atoi(spec.version.c_str());
+        int maxMinor = atoi(spec.version.c_str() + spec.version.find('.') + 1);
+
+        context.features.erase(std::remove_if(context.features.begin(), context.features.end(), [&](const glbFeature &feature) {
+            if (feature.api != "gl") {
+                return false;
+            }
+
+            int major = atoi(feature.number.c_str());
+            int minor = atoi(feature.number.c_str() + feature.number.find('.') + 1);
+            return major > maxMajor || (major == maxMajor && minor > maxMinor);
+        }), context.features.end());
+
+        context.maxVersion = spec.version;
     }
 
-    // We only output the type if it hasn't already been output.
-    if (!glbBuildHasTypeBeenOutput(context, typeName)) {
-        glbType* pType;
-        glbResult result = glbBuildFindType(context, typeName, &pType);
-        if (result != GLB_SUCCESS) {
-            return result;
-        }
+    if (!spec.extensions.empty()) {
+        for (size_t iName = 0; iName < spec.extensions.size(); ++iName) {
+            bool isKnownExtension = false;
+            for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
+                if (context.extensions[iExtension].name == spec.extensions[iName]) {
+                    isKnownExtension = true;
+                    break;
+                }
+            }
 
-        if (pType->valueC != "") {
-            codeOut += pType->valueC + "\n";
+            if (!isKnownExtension) {
+                printf("Unknown extension \"%s\".\n", spec.extensions[iName].c_str());
+                return GLB_INVALID_ARGS;
+            }
         }
 
-        context.outputTypes.push_back(typeName);
+        std::unordered_set<std::string> extensionNames(spec.extensions.begin(), spec.extensions.end());
+
+        context.extensions.erase(std::remove_if(context.extensions.begin(), context.extensions.end(), [&](const glbExtension &extension) {
+            for (auto requiredExtension : g_RequiredPlatformExtensions) {
+                if (extension.name == requiredExtension) {
+                    return false;
+                }
+            }
+
+            return extensionNames.count(extension.name) == 0;
+        }), context.extensions.end());
     }
 
     return GLB_SUCCESS;
 }
 
-glbResult glbBuildGenerateCode_C_Main_RequireTypes(glbBuild &context, glbRequire &require, std::string &codeOut)
+/*
+Builds the name lookups used by glbBuildFindType(), glbBuildFindEnum() and glbBuildFindCommand(). This needs to be called after every XML
+file has been loaded, since the lookups point into the vectors in the context, and before any code is generated.
+*/
+void glbBuildIndexRegistry(glbBuild &context)
 {
-    glbResult result;
+    context.typesByName.clear();
+    context.enumsByName.clear();
+    context.commandsByName.clear();
 
-    // Standalone types.
-    for (size_t iType = 0; iType < require.types.size(); ++iType) {
-        result = glbBuildGenerateCode_C_Main_Type(context, require.types[iType].c_str(), codeOut);
-        if (result != GLB_SUCCESS && result != GLB_ALREADY_PROCESSED) {
-            return result;
+    // emplace() does not replace existing items so that the first item with a given name wins.
+    for (size_t iType = 0; iType < context.types.size(); ++iType) {
+        context.typesByName.emplace(context.types[iType].name, &context.types[iType]);
+    }
+
+    for (size_t iEnums = 0; iEnums < context.enums.size(); ++iEnums) {
+        glbEnums &enums = context.enums[iEnums];
+        for (size_t iEnum = 0; iEnum < enums.enums.size(); ++iEnum) {
+            context.enumsByName.emplace(enums.enums[iEnum].name, &enums.enums[iEnum]);
         }
     }
 
-    // Required types.
-    for (size_t iCommand = 0; iCommand < require.commands.size(); ++iCommand) {
-        glbCommand* pCommand;
-        result = glbBuildFindCommand(context, require.commands[iCommand].c_str(), &pCommand);
-        if (result != GLB_SUCCESS) {
-            return result;
+    for (size_t iCommands = 0; iCommands < context.commands.size(); ++iCommands) {
+        glbCommands &commands = context.commands[iCommands];
+        for (size_t iCommand = 0; iCommand < commands.commands.size(); ++iCommand) {
+            context.commandsByName.emplace(commands.commands[iCommand].name, &commands.commands[iCommand]);
         }
+    }
+}
 
-        if (pCommand->returnType != "") {
-            glbBuildGenerateCode_C_Main_Type(context, pCommand->returnType.c_str(), codeOut);
-        }
+glbResult glbBuildLoadXMLFile(glbBuild &context, const char* filePath)
+{
+    glbXMLReader reader;
+    glbResult result = glbXMLReaderInit(reader, filePath);
+    if (result != GLB_SUCCESS) {
+        printf("Failed to open %s\n", filePath);
+        return result;
+    }
 
-        for (size_t iParam = 0; iParam < pCommand->params.size(); ++iParam) {
-            glbCommandParam &param = pCommand->params[iParam];
-            if (param.type != "") {
-                glbBuildGenerateCode_C_Main_Type(context, param.type.c_str(), codeOut);
-            }
-        }
+    result = glbBuildLoadXML(context, reader);
+    glbXMLReaderUninit(reader);
+
+    if (result != GLB_SUCCESS) {
+        printf("Failed to parse %s\n", filePath);
+        return result;
     }
 
     return GLB_SUCCESS;
 }
 
-glbResult glbBuildGenerateCode_C_Main_RequireEnums(glbBuild &context, glbRequire &require, std::string &codeOut)
+glbResult glbBuildLoadRegistry(glbBuild &context)
 {
-    glbResult result;
+    const char* filePaths[] = {
+        GLB_BUILD_XML_PATH_GL,
+        GLB_BUILD_XML_PATH_WGL,
+        GLB_BUILD_XML_PATH_GLX,
+        GLB_BUILD_XML_PATH_EGL
+    };
 
-    for (size_t iEnum = 0; iEnum < require.enums.size(); ++iEnum) {
-        glbEnum* pEnum;
-        result = glbBuildFindEnum(context, require.enums[iEnum].c_str(), &pEnum);
+    for (size_t iFile = 0; iFile < sizeof(filePaths)/sizeof(filePaths[0]); ++iFile) {
+        glbResult result = glbBuildLoadXMLFile(context, filePaths[iFile]);
         if (result != GLB_SUCCESS) {
             return result;
         }
-
-        codeOut += "#define " + pEnum->name + " " + pEnum->value + "\n";
     }
 
     return GLB_SUCCESS;
 }
 
-glbResult glbBuildGenerateCode_C_Main_RequireCommands(glbBuild &context, glbRequire &require, std::string &codeOut)
-{
-    glbResult result;
 
-    for (size_t iCommand = 0; iCommand < require.commands.size(); ++iCommand) {
-        const char* commandName = require.commands[iCommand].c_str();
-        if (!glbBuildHasCommandBeenOutput(context, commandName)) {
-            glbCommand* pCommand;
-            result = glbBuildFindCommand(context, require.commands[iCommand].c_str(), &pCommand);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }
+/*
+Cache
 
-            codeOut += "typedef " + pCommand->returnTypeC + " (APIENTRYP PFN" + glbToUpper(pCommand->name) + "PROC)(";
-            if (pCommand->params.size() > 0) {
-                for (size_t iParam = 0; iParam < pCommand->params.size(); ++iParam) {
-                    if (iParam != 0) {
-                        codeOut += ", ";
-                    }
-                    codeOut += pCommand->params[iParam].typeC + " " + pCommand->params[iParam].name;
-                }
-            } else {
-                codeOut += "void";  // we need to use "func(void)" syntax for compatibility with older versions of C.
-            }
-            codeOut += ");\n";
+Parsing the registry and generating the code takes a while, and the output used to change on every run because of the revision and date in
+the version line. To keep incremental builds quiet the generator keeps a cache (GLB_BUILD_CACHE_PATH) with the following:
 
-            context.outputCommands.push_back(commandName);
-        }
+    - The parsed registry, keyed on a hash of the XML files and the generator source. When these haven't changed the registry is loaded
+      from the cache instead of being parsed again. Strings are stored once in a table and referred to by index.
+    - A key for everything that affects the output (the registry, the template and the command line) and the hash of every file that was
+      output. When the key matches and none of the files have been touched since, nothing needs to be done at all.
+
+Independently of the cache, output files are only written when their content has changed (see glbOutputStream).
+*/
+#define GLB_BUILD_CACHE_MAGIC       0x43424C47  /* "GLBC" */
+#define GLB_BUILD_CACHE_VERSION     1
+#define GLB_HASH_INIT               14695981039346656037ULL
+
+// 64-bit FNV-1a.
+uint64_t glbHashData(uint64_t hash, const void* pData, size_t dataSize)
+{
+    const unsigned char* pBytes = (const unsigned char*)pData;
+    for (size_t i = 0; i < dataSize; ++i) {
+        hash ^= pBytes[i];
+        hash *= 1099511628211ULL;
     }
 
-    return GLB_SUCCESS;
+    return hash;
 }
 
+// The length is included so that the boundaries between strings are part of the hash.
+uint64_t glbHashString(uint64_t hash, const std::string &str)
+{
+    uint64_t length = str.size();
+    hash = glbHashData(hash, &length, sizeof(length));
+    return glbHashData(hash, str.data(), str.size());
+}
 
-glbResult glbBuildGenerateCode_C_Main_Feature(glbBuild &context, glbFeature &feature, std::string &codeOut)
+// Files are hashed a chunk at a time so the length goes at the end rather than the start. This must match glbBuildCloseOutputStream().
+uint64_t glbHashFileSize(uint64_t hash, uint64_t fileSize)
 {
-    codeOut += "#ifndef " + feature.name + "\n";
-    codeOut += "#define " + feature.name + " 1\n";
-    {
-        // Types.
-        for (size_t iRequire = 0; iRequire < feature.requires.size(); ++iRequire) {
-            glbResult result = glbBuildGenerateCode_C_Main_RequireTypes(context, feature.requires[iRequire], codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }       
-        }
+    return glbHashData(hash, &fileSize, sizeof(fileSize));
+}
 
-        // Enums.
-        for (size_t iRequire = 0; iRequire < feature.requires.size(); ++iRequire) {
-            glbResult result = glbBuildGenerateCode_C_Main_RequireEnums(context, feature.requires[iRequire], codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }       
-        }
+// Hashes the content of a file. A file that doesn't exist is hashed as if it were empty, but differently to an empty file.
+uint64_t glbHashFile(uint64_t hash, const char* filePath)
+{
+    FILE* pFile;
+    if (glbFOpen(filePath, "rb", &pFile) != GLB_SUCCESS) {
+        return glbHashString(hash, "<missing>");
+    }
 
-        // Commands.
-        for (size_t iRequire = 0; iRequire < feature.requires.size(); ++iRequire) {
-            glbResult result = glbBuildGenerateCode_C_Main_RequireCommands(context, feature.requires[iRequire], codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }       
+    char chunk[4096];
+    uint64_t fileSize = 0;
+    for (;;) {
+        size_t bytesRead = fread(chunk, 1, sizeof(chunk), pFile);
+        if (bytesRead == 0) {
+            break;
         }
+
+        hash = glbHashData(hash, chunk, bytesRead);
+        fileSize += bytesRead;
     }
-    codeOut += "#endif /* " + feature.name + " */\n";
 
-    return GLB_SUCCESS;
+    fclose(pFile);
+
+    return glbHashFileSize(hash, fileSize);
 }
 
-glbResult glbBuildGenerateCode_C_Main_FeaturesByAPI(glbBuild &context, const char* api, std::string &codeOut)
+struct glbCache
 {
-    int counter = 0;    // Only used for knowing whether or not a new line should be added.
+    uint64_t registryKey = 0;
+    uint64_t outputKey = 0;
+    std::vector<glbOutputFile> outputs;
+    std::string registry;   // The serialized registry. See glbCacheWriteRegistry().
+};
 
-    for (size_t iFeature = 0; iFeature < context.features.size(); ++iFeature) {
-        glbFeature &feature = context.features[iFeature];
-        if (feature.api == api) {
-            if (counter > 0) {
-                codeOut += "\n";
-            }
+struct glbCacheWriter
+{
+    std::string data;
+    std::vector<const std::string*> strings;
+    std::unordered_map<std::string, uint32_t> stringIndices;
+};
 
-            glbResult result = glbBuildGenerateCode_C_Main_Feature(context, feature, codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }
+void glbCacheWriteU32(std::string &data, uint32_t value)
+{
+    data.append((const char*)&value, sizeof(value));
+}
 
-            counter += 1;
-        }
+void glbCacheWriteU64(std::string &data, uint64_t value)
+{
+    data.append((const char*)&value, sizeof(value));
+}
+
+void glbCacheWrite(glbCacheWriter &writer, const std::string &str)
+{
+    auto inserted = writer.stringIndices.emplace(str, (uint32_t)writer.strings.size());
+    if (inserted.second) {
+        writer.strings.push_back(&inserted.first->first);
     }
 
-    return GLB_SUCCESS;
+    glbCacheWriteU32(writer.data, inserted.first->second);
 }
 
-glbResult glbBuildGenerateCode_C_Main_Extension(glbBuild &context, glbExtension &extension, std::string &codeOut)
+template <typename T>
+void glbCacheWrite(glbCacheWriter &writer, const std::vector<T> &items)
 {
-    codeOut += "#ifndef " + extension.name + "\n";
-    codeOut += "#define " + extension.name + " 1\n";
-    {
-        // Types.
-        for (size_t iRequire = 0; iRequire < extension.requires.size(); ++iRequire) {
-            glbResult result = glbBuildGenerateCode_C_Main_RequireTypes(context, extension.requires[iRequire], codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }       
-        }
+    glbCacheWriteU32(writer.data, (uint32_t)items.size());
+    for (size_t iItem = 0; iItem < items.size(); ++iItem) {
+        glbCacheWrite(writer, items[iItem]);
+    }
+}
 
-        // Enums.
-        for (size_t iRequire = 0; iRequire < extension.requires.size(); ++iRequire) {
-            glbResult result = glbBuildGenerateCode_C_Main_RequireEnums(context, extension.requires[iRequire], codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }       
-        }
+void glbCacheWrite(glbCacheWriter &writer, const glbType &type)
+{
+    glbCacheWrite(writer, type.name);
+    glbCacheWrite(writer, type.valueC);
+    glbCacheWrite(writer, type.requires);
+}
 
-        // Commands.
-        for (size_t iRequire = 0; iRequire < extension.requires.size(); ++iRequire) {
-            glbResult result = glbBuildGenerateCode_C_Main_RequireCommands(context, extension.requires[iRequire], codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }       
-        }
-    }
-    codeOut += "#endif /* " + extension.name + " */\n";
+void glbCacheWrite(glbCacheWriter &writer, const glbEnum &theEnum)
+{
+    glbCacheWrite(writer, theEnum.name);
+    glbCacheWrite(writer, theEnum.value);
+    glbCacheWrite(writer, theEnum.type);
+}
 
-    return GLB_SUCCESS;
+void glbCacheWrite(glbCacheWriter &writer, const glbGroup &group)
+{
+    glbCacheWrite(writer, group.name);
+    glbCacheWrite(writer, group.enums);
 }
 
-glbResult glbBuildGenerateCode_C_Main(glbBuild &context, std::string &codeOut)
+void glbCacheWrite(glbCacheWriter &writer, const glbEnums &enums)
 {
-    glbResult result;
-    int counter;    // Used for tracking whether or not new lines need to be added.
+    glbCacheWrite(writer, enums.name);
+    glbCacheWrite(writer, enums.namespaceAttrib);
+    glbCacheWrite(writer, enums.group);
+    glbCacheWrite(writer, enums.vendor);
+    glbCacheWrite(writer, enums.type);
+    glbCacheWrite(writer, enums.start);
+    glbCacheWrite(writer, enums.end);
+    glbCacheWrite(writer, enums.enums);
+}
 
-    // Feature order is the following.
-    //  - gl
-    //  - wgl
-    //  - glx
-    result = glbBuildGenerateCode_C_Main_FeaturesByAPI(context, "gl", codeOut);
-    if (result != GLB_SUCCESS) {
-        return result;
+void glbCacheWrite(glbCacheWriter &writer, const glbCommandParam &param)
+{
+    glbCacheWrite(writer, param.type);
+    glbCacheWrite(writer, param.typeC);
+    glbCacheWrite(writer, param.name);
+    glbCacheWrite(writer, param.group);
+}
+
+void glbCacheWrite(glbCacheWriter &writer, const glbCommand &command)
+{
+    glbCacheWrite(writer, command.returnType);
+    glbCacheWrite(writer, command.returnTypeC);
+    glbCacheWrite(writer, command.name);
+    glbCacheWrite(writer, command.params);
+    glbCacheWrite(writer, command.alias);
+}
+
+void glbCacheWrite(glbCacheWriter &writer, const glbCommands &commands)
+{
+    glbCacheWrite(writer, commands.namespaceAttrib);
+    glbCacheWrite(writer, commands.commands);
+}
+
+void glbCacheWrite(glbCacheWriter &writer, const glbRequire &require)
+{
+    glbCacheWrite(writer, require.profile);
+    glbCacheWrite(writer, require.types);
+    glbCacheWrite(writer, require.enums);
+    glbCacheWrite(writer, require.commands);
+}
+
+void glbCacheWrite(glbCacheWriter &writer, const glbFeature &feature)
+{
+    glbCacheWrite(writer, feature.api);
+    glbCacheWrite(writer, feature.name);
+    glbCacheWrite(writer, feature.number);
+    glbCacheWrite(writer, feature.requires);
+    glbCacheWrite(writer, feature.removes);
+}
+
+void glbCacheWrite(glbCacheWriter &writer, const glbExtension &extension)
+{
+    glbCacheWrite(writer, extension.name);
+    glbCacheWrite(writer, extension.supported);
+    glbCacheWrite(writer, extension.requires);
+}
+
+// Serializes the registry as it was parsed. This needs to be done before the spec and profile are applied.
+std::string glbCacheWriteRegistry(const glbBuild &context)
+{
+    glbCacheWriter writer;
+    glbCacheWrite(writer, context.types);
+    glbCacheWrite(writer, context.groups);
+    glbCacheWrite(writer, context.enums);
+    glbCacheWrite(writer, context.commands);
+    glbCacheWrite(writer, context.features);
+    glbCacheWrite(writer, context.extensions);
+
+    // The string table goes first so that the strings are available when the rest is read back.
+    std::string registry;
+    glbCacheWriteU32(registry, (uint32_t)writer.strings.size());
+    for (size_t iString = 0; iString < writer.strings.size(); ++iString) {
+        glbCacheWriteU32(registry, (uint32_t)writer.strings[iString]->size());
+        registry += *writer.strings[iString];
     }
+    registry += writer.data;
 
-    codeOut += "\n#if defined(GLBIND_WGL)\n";
-    result = glbBuildGenerateCode_C_Main_FeaturesByAPI(context, "wgl", codeOut);
-    if (result != GLB_SUCCESS) {
-        return result;
+    return registry;
+}
+
+struct glbCacheReader
+{
+    const std::string* pData;
+    size_t cursor;
+    std::vector<std::string> strings;
+};
+
+bool glbCacheReadU32(glbCacheReader &reader, uint32_t &value)
+{
+    if (reader.pData->size() - reader.cursor < sizeof(value)) {
+        return false;
     }
-    codeOut += "#endif /* GLBIND_WGL */\n";
 
-    codeOut += "\n#if defined(GLBIND_GLX)\n";
-    result = glbBuildGenerateCode_C_Main_FeaturesByAPI(context, "glx", codeOut);
-    if (result != GLB_SUCCESS) {
-        return result;
+    memcpy(&value, reader.pData->data() + reader.cursor, sizeof(value));
+    reader.cursor += sizeof(value);
+    return true;
+}
+
+bool glbCacheReadU64(glbCacheReader &reader, uint64_t &value)
+{
+    if (reader.pData->size() - reader.cursor < sizeof(value)) {
+        return false;
     }
-    codeOut += "#endif /* GLBIND_GLX */\n";
 
-    // TODO: All other APIs no in gl, wgl and glx (gles2, etc.)?
+    memcpy(&value, reader.pData->data() + reader.cursor, sizeof(value));
+    reader.cursor += sizeof(value);
+    return true;
+}
 
+// Reads a string that's stored in place rather than in the string table.
+bool glbCacheReadInlineString(glbCacheReader &reader, std::string &str)
+{
+    uint32_t length;
+    if (!glbCacheReadU32(reader, length) || reader.pData->size() - reader.cursor < length) {
+        return false;
+    }
 
-    // Now we need to do extensions. For cleanliness we want to group extensions. We do gl/glcore first, then wgl, then glx.
-    counter = 0;
-    for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
-        glbExtension &extension = context.extensions[iExtension];
-        if (!glbIsExtensionBlackListed(extension.name.c_str()) && (extension.supported == "gl" || glbContains(extension.supported, "gl|") || glbContains(extension.supported, "glcore"))) {
-            if (counter > 0) {
-                codeOut += "\n";
-            }
-            counter += 1;
+    str.assign(reader.pData->data() + reader.cursor, length);
+    reader.cursor += length;
+    return true;
+}
 
-            result = glbBuildGenerateCode_C_Main_Extension(context, extension, codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }
-        }
+bool glbCacheRead(glbCacheReader &reader, std::string &str)
+{
+    uint32_t index;
+    if (!glbCacheReadU32(reader, index) || index >= reader.strings.size()) {
+        return false;
     }
 
-    // WGL extensions.
-    codeOut += "\n#if defined(GLBIND_WGL)\n";
-    counter = 0;
-    for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
-        glbExtension &extension = context.extensions[iExtension];
-        if (!glbIsExtensionBlackListed(extension.name.c_str()) && glbContains(extension.supported, "wgl")) {
-            if (counter > 0) {
-                codeOut += "\n";
-            }
-            counter += 1;
+    str = reader.strings[index];
+    return true;
+}
 
-            result = glbBuildGenerateCode_C_Main_Extension(context, extension, codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }
+template <typename T>
+bool glbCacheRead(glbCacheReader &reader, std::vector<T> &items)
+{
+    uint32_t count;
+    if (!glbCacheReadU32(reader, count)) {
+        return false;
+    }
+
+    items.resize(count);
+    for (size_t iItem = 0; iItem < items.size(); ++iItem) {
+        if (!glbCacheRead(reader, items[iItem])) {
+            return false;
         }
     }
-    codeOut += "#endif /* GLBIND_WGL */\n";
 
-    // GLX extensions.
-    codeOut += "\n#if defined(GLBIND_GLX)\n";
-    counter = 0;
-    for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
-        glbExtension &extension = context.extensions[iExtension];
-        if (!glbIsExtensionBlackListed(extension.name.c_str()) && glbContains(extension.supported, "glx")) {
-            if (counter > 0) {
-                codeOut += "\n";
+    return true;
+}
+
+bool glbCacheRead(glbCacheReader &reader, glbType &type)
+{
+    return
+        glbCacheRead(reader, type.name) &&
+        glbCacheRead(reader, type.valueC) &&
+        glbCacheRead(reader, type.requires);
+}
+
+bool glbCacheRead(glbCacheReader &reader, glbEnum &theEnum)
+{
+    return
+        glbCacheRead(reader, theEnum.name) &&
+        glbCacheRead(reader, theEnum.value) &&
+        glbCacheRead(reader, theEnum.type);
+}
+
+bool glbCacheRead(glbCacheReader &reader, glbGroup &group)
+{
+    return
+        glbCacheRead(reader, group.name) &&
+        glbCacheRead(reader, group.enums);
+}
+
+bool glbCacheRead(glbCacheReader &reader, glbEnums &enums)
+{
+    return
+        glbCacheRead(reader, enums.name) &&
+        glbCacheRead(reader, enums.namespaceAttrib) &&
+        glbCacheRead(reader, enums.group) &&
+        glbCacheRead(reader, enums.vendor) &&
+        glbCacheRead(reader, enums.type) &&
+        glbCacheRead(reader, enums.start) &&
+        glbCacheRead(reader, enums.end) &&
+        glbCacheRead(reader, enums.enums);
+}
+
+bool glbCacheRead(glbCacheReader &reader, glbCommandParam &param)
+{
+    return
+        glbCacheRead(reader, param.type) &&
+        glbCacheRead(reader, param.typeC) &&
+        glbCacheRead(reader, param.name) &&
+        glbCacheRead(reader, param.group);
+}
+
+bool glbCacheRead(glbCacheReader &reader, glbCommand &command)
+{
+    return
+        glbCacheRead(reader, command.returnType) &&
+        glbCacheRead(reader, command.returnTypeC) &&
+        glbCacheRead(reader, command.name) &&
+        glbCacheRead(reader, command.params) &&
+        glbCacheRead(reader, command.alias);
+}
+
+bool glbCacheRead(glbCacheReader &reader, glbCommands &commands)
+{
+    return
+        glbCacheRead(reader, commands.namespaceAttrib) &&
+        glbCacheRead(reader, commands.commands);
+}
+
+bool glbCacheRead(glbCacheReader &reader, glbRequire &require)
+{
+    return
+        glbCacheRead(reader, require.profile) &&
+        glbCacheRead(reader, require.types) &&
+        glbCacheRead(reader, require.enums) &&
+        glbCacheRead(reader, require.commands);
+}
+
+bool glbCacheRead(glbCacheReader &reader, glbFeature &feature)
+{
+    return
+        glbCacheRead(reader, feature.api) &&
+        glbCacheRead(reader, feature.name) &&
+        glbCacheRead(reader, feature.number) &&
+        glbCacheRead(reader, feature.requires) &&
+        glbCacheRead(reader, feature.removes);
+}
+
+bool glbCacheRead(glbCacheReader &reader, glbExtension &extension)
+{
+    return
+        glbCacheRead(reader, extension.name) &&
+        glbCacheRead(reader, extension.supported) &&
+        glbCacheRead(reader, extension.requires);
+}
+
+// The inverse of glbCacheWriteRegistry(). The context should be empty.
+glbResult glbCacheReadRegistry(glbBuild &context, const std::string &registry)
+{
+    glbCacheReader reader;
+    reader.pData = &registry;
+    reader.cursor = 0;
+
+    uint32_t stringCount;
+    if (!glbCacheReadU32(reader, stringCount)) {
+        return GLB_ERROR;
+    }
+
+    reader.strings.resize(stringCount);
+    for (size_t iString = 0; iString < reader.strings.size(); ++iString) {
+        if (!glbCacheReadInlineString(reader, reader.strings[iString])) {
+            return GLB_ERROR;
+        }
+    }
+
+    bool isValid =
+        glbCacheRead(reader, context.types) &&
+        glbCacheRead(reader, context.groups) &&
+        glbCacheRead(reader, context.enums) &&
+        glbCacheRead(reader, context.commands) &&
+        glbCacheRead(reader, context.features) &&
+        glbCacheRead(reader, context.extensions);
+    if (!isValid || reader.cursor != registry.size()) {
+        return GLB_ERROR;
+    }
+
+    return GLB_SUCCESS;
+}
+
+// Loads the cache. Fails if the file doesn't exist or was written by a different version of the generator, in which case it's ignored.
+glbResult glbBuildLoadCache(const char* filePath, glbCache &cache)
+{
+    size_t fileSize;
+    void* pFileData;
+    glbResult result = glbOpenAndReadFile(filePath, &fileSize, &pFileData);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    std::string data((const char*)pFileData, fileSize);
+    free(pFileData);
+
+    glbCacheReader reader;
+    reader.pData = &data;
+    reader.cursor = 0;
+
+    uint32_t magic;
+    uint32_t version;
+    uint32_t outputCount;
+    if (!glbCacheReadU32(reader, magic) || magic != GLB_BUILD_CACHE_MAGIC || !glbCacheReadU32(reader, version) || version != GLB_BUILD_CACHE_VERSION) {
+        return GLB_ERROR;
+    }
+
+    if (!glbCacheReadU64(reader, cache.registryKey) || !glbCacheReadU64(reader, cache.outputKey) || !glbCacheReadU32(reader, outputCount)) {
+        return GLB_ERROR;
+    }
+
+    cache.outputs.resize(outputCount);
+    for (size_t iOutput = 0; iOutput < cache.outputs.size(); ++iOutput) {
+        if (!glbCacheReadInlineString(reader, cache.outputs[iOutput].filePath) || !glbCacheReadU64(reader, cache.outputs[iOutput].hash)) {
+            return GLB_ERROR;
+        }
+    }
+
+    if (!glbCacheReadInlineString(reader, cache.registry)) {
+        return GLB_ERROR;
+    }
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildSaveCache(const char* filePath, const glbCache &cache)
+{
+    std::string data;
+    glbCacheWriteU32(data, GLB_BUILD_CACHE_MAGIC);
+    glbCacheWriteU32(data, GLB_BUILD_CACHE_VERSION);
+    glbCacheWriteU64(data, cache.registryKey);
+    glbCacheWriteU64(data, cache.outputKey);
+    glbCacheWriteU32(data, (uint32_t)cache.outputs.size());
+    for (size_t iOutput = 0; iOutput < cache.outputs.size(); ++iOutput) {
+        glbCacheWriteU32(data, (uint32_t)cache.outputs[iOutput].filePath.size());
+        data += cache.outputs[iOutput].filePath;
+        glbCacheWriteU64(data, cache.outputs[iOutput].hash);
+    }
+    glbCacheWriteU32(data, (uint32_t)cache.registry.size());
+    data += cache.registry;
+
+    return glbOpenAndWriteFile(filePath, data.data(), data.size());
+}
+
+// Whether or not every file that was output by the previous run is still exactly as it was left.
+bool glbBuildAreCachedOutputsUnchanged(const glbCache &cache)
+{
+    if (cache.outputs.empty()) {
+        return false;
+    }
+
+    for (size_t iOutput = 0; iOutput < cache.outputs.size(); ++iOutput) {
+        if (glbHashFile(GLB_HASH_INIT, cache.outputs[iOutput].filePath.c_str()) != cache.outputs[iOutput].hash) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool glbDoesExtensionBelongToVendor(const std::string &extensionName, const std::string &vendor)
+{
+    return extensionName.find("_" + vendor + "_") != std::string::npos;
+}
+
+bool glbIsExtensionBlackListed(const char* extensionName)
+{
+    for (auto blacklistedExtension : g_BlacklistedExtensions) {
+        if (strcmp(blacklistedExtension, extensionName) == 0) {
+            return true;
+        }
+    }
+
+    for (auto vendor : g_BlacklistedExtensionVendors) {
+        if (glbDoesExtensionBelongToVendor(extensionName, vendor)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool glbBuildIsCommandIgnored(const char* commandName)
+{
+    // The following commands should not be included in anything as they are not strictly OpenGL related.
+    static const char* ignoredCommands[] = {
+        "ChoosePixelFormat",
+        "DescribePixelFormat",
+        "GetEnhMetaFilePixelFormat",
+        "GetPixelFormat",
+        "SetPixelFormat",
+        "SwapBuffers",
+        "wglUseFontBitmaps",
+        "wglUseFontOutlines",
+    };
+
+    for (size_t i = 0; i < sizeof(ignoredCommands)/sizeof(ignoredCommands[0]); ++i) {
+        if (strcmp(ignoredCommands[i], commandName) == 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+bool glbBuildHasTypeBeenOutput(glbBuild &context, const char* typeName)
+{
+    return context.outputTypes.count(typeName) > 0;
+}
+
+bool glbBuildHasCommandBeenOutput(glbBuild &context, const char* commandName)
+{
+    return context.outputCommands.count(commandName) > 0;
+}
+
+glbResult glbBuildFindType(glbBuild &context, const char* typeName, glbType** ppType)
+{
+    auto iType = context.typesByName.find(typeName);
+    if (iType == context.typesByName.end()) {
+        *ppType = NULL;
+        return GLB_ERROR;
+    }
+
+    *ppType = iType->second;
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildFindEnum(glbBuild &context, const char* enumName, glbEnum** ppEnum)
+{
+    auto iEnum = context.enumsByName.find(enumName);
+    if (iEnum == context.enumsByName.end()) {
+        *ppEnum = NULL;
+        return GLB_ERROR;
+    }
+
+    *ppEnum = iEnum->second;
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildFindCommand(glbBuild &context, const char* commandName, glbCommand** ppCommand)
+{
+    auto iCommand = context.commandsByName.find(commandName);
+    if (iCommand == context.commandsByName.end()) {
+        *ppCommand = NULL;
+        return GLB_ERROR;
+    }
+
+    *ppCommand = iCommand->second;
+    return GLB_SUCCESS;
+}
+
+
+glbResult glbBuildGenerateCode_C_Main_Type(glbBuild &context, const char* typeName, std::string &codeOut)
+{
+    // Special case for khrplatform. We don't want to include this because we don't use khrplatform.h. Just pretend it's already been output.
+    if (strcmp(typeName, "khrplatform") == 0) {
+        return GLB_ALREADY_PROCESSED;
+    }
+
+    // We only output the type if it hasn't already been output.
+    if (!glbBuildHasTypeBeenOutput(context, typeName)) {
+        glbType* pType;
+        glbResult result = glbBuildFindType(context, typeName, &pType);
+        if (result != GLB_SUCCESS) {
+            return result;
+        }
+
+        if (pType->valueC != "") {
+            codeOut += pType->valueC + "\n";
+        }
+
+        context.outputTypes.insert(typeName);
+    }
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGenerateCode_C_Main_RequireTypes(glbBuild &context, glbRequire &require, std::string &codeOut)
+{
+    glbResult result;
+
+    // Standalone types.
+    for (size_t iType = 0; iType < require.types.size(); ++iType) {
+        result = glbBuildGenerateCode_C_Main_Type(context, require.types[iType].c_str(), codeOut);
+        if (result != GLB_SUCCESS && result != GLB_ALREADY_PROCESSED) {
+            return result;
+        }
+    }
+
+    // Required types.
+    for (size_t iCommand = 0; iCommand < require.commands.size(); ++iCommand) {
+        glbCommand* pCommand;
+        result = glbBuildFindCommand(context, require.commands[iCommand].c_str(), &pCommand);
+        if (result != GLB_SUCCESS) {
+            return result;
+        }
+
+        if (pCommand->returnType != "") {
+            glbBuildGenerateCode_C_Main_Type(context, pCommand->returnType.c_str(), codeOut);
+        }
+
+        for (size_t iParam = 0; iParam < pCommand->params.size(); ++iParam) {
+            glbCommandParam &param = pCommand->params[iParam];
+            if (param.type != "") {
+                glbBuildGenerateCode_C_Main_Type(context, param.type.c_str(), codeOut);
+            }
+        }
+    }
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGenerateCode_C_Main_RequireEnums(glbBuild &context, glbRequire &require, std::string &codeOut)
+{
+    glbResult result;
+
+    for (size_t iEnum = 0; iEnum < require.enums.size(); ++iEnum) {
+        glbEnum* pEnum;
+        result = glbBuildFindEnum(context, require.enums[iEnum].c_str(), &pEnum);
+        if (result != GLB_SUCCESS) {
+            return result;
+        }
+
+        codeOut += "#define " + pEnum->name + " " + pEnum->value + "\n";
+    }
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGenerateCode_C_Main_RequireCommands(glbBuild &context, glbRequire &require, std::string &codeOut)
+{
+    glbResult result;
+
+    for (size_t iCommand = 0; iCommand < require.commands.size(); ++iCommand) {
+        const char* commandName = require.commands[iCommand].c_str();
+        if (!glbBuildHasCommandBeenOutput(context, commandName)) {
+            glbCommand* pCommand;
+            result = glbBuildFindCommand(context, require.commands[iCommand].c_str(), &pCommand);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }
+
+            codeOut += "typedef " + pCommand->returnTypeC + " (APIENTRYP PFN" + glbToUpper(pCommand->name) + "PROC)(";
+            if (pCommand->params.size() > 0) {
+                for (size_t iParam = 0; iParam < pCommand->params.size(); ++iParam) {
+                    if (iParam != 0) {
+                        codeOut += ", ";
+                    }
+                    codeOut += pCommand->params[iParam].typeC + " " + pCommand->params[iParam].name;
+                }
+            } else {
+                codeOut += "void";  // we need to use "func(void)" syntax for compatibility with older versions of C.
+            }
+            codeOut += ");\n";
+
+            context.outputCommands.insert(commandName);
+        }
+    }
+
+    return GLB_SUCCESS;
+}
+
+
+glbResult glbBuildGenerateCode_C_Main_Feature(glbBuild &context, glbFeature &feature, std::string &codeOut)
+{
+    codeOut += "#ifndef " + feature.name + "\n";
+    codeOut += "#define " + feature.name + " 1\n";
+    {
+        // Types.
+        for (size_t iRequire = 0; iRequire < feature.requires.size(); ++iRequire) {
+            glbResult result = glbBuildGenerateCode_C_Main_RequireTypes(context, feature.requires[iRequire], codeOut);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }       
+        }
+
+        // Enums.
+        for (size_t iRequire = 0; iRequire < feature.requires.size(); ++iRequire) {
+            glbResult result = glbBuildGenerateCode_C_Main_RequireEnums(context, feature.requires[iRequire], codeOut);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }       
+        }
+
+        // Commands.
+        for (size_t iRequire = 0; iRequire < feature.requires.size(); ++iRequire) {
+            glbResult result = glbBuildGenerateCode_C_Main_RequireCommands(context, feature.requires[iRequire], codeOut);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }       
+        }
+    }
+    codeOut += "#endif /* " + feature.name + " */\n";
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGenerateCode_C_Main_FeaturesByAPI(glbBuild &context, const char* api, std::string &codeOut)
+{
+    int counter = 0;    // Only used for knowing whether or not a new line should be added.
+
+    for (size_t iFeature = 0; iFeature < context.features.size(); ++iFeature) {
+        glbFeature &feature = context.features[iFeature];
+        if (feature.api == api) {
+            if (counter > 0) {
+                codeOut += "\n";
+            }
+
+            glbResult result = glbBuildGenerateCode_C_Main_Feature(context, feature, codeOut);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }
+
+            counter += 1;
+        }
+    }
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGenerateCode_C_Main_Extension(glbBuild &context, glbExtension &extension, std::string &codeOut)
+{
+    codeOut += "#ifndef " + extension.name + "\n";
+    codeOut += "#define " + extension.name + " 1\n";
+    {
+        // Types.
+        for (size_t iRequire = 0; iRequire < extension.requires.size(); ++iRequire) {
+            glbResult result = glbBuildGenerateCode_C_Main_RequireTypes(context, extension.requires[iRequire], codeOut);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }       
+        }
+
+        // Enums.
+        for (size_t iRequire = 0; iRequire < extension.requires.size(); ++iRequire) {
+            glbResult result = glbBuildGenerateCode_C_Main_RequireEnums(context, extension.requires[iRequire], codeOut);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }       
+        }
+
+        // Commands.
+        for (size_t iRequire = 0; iRequire < extension.requires.size(); ++iRequire) {
+            glbResult result = glbBuildGenerateCode_C_Main_RequireCommands(context, extension.requires[iRequire], codeOut);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }       
+        }
+    }
+    codeOut += "#endif /* " + extension.name + " */\n";
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGenerateCode_C_Main(glbBuild &context, std::string &codeOut)
+{
+    glbResult result;
+    int counter;    // Used for tracking whether or not new lines need to be added.
+
+    // Feature order is the following.
+    //  - gl
+    //  - wgl
+    //  - glx
+    //  - egl
+    result = glbBuildGenerateCode_C_Main_FeaturesByAPI(context, "gl", codeOut);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    codeOut += "\n#if defined(GLBIND_WGL)\n";
+    result = glbBuildGenerateCode_C_Main_FeaturesByAPI(context, "wgl", codeOut);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+    codeOut += "#endif /* GLBIND_WGL */\n";
+
+    codeOut += "\n#if defined(GLBIND_GLX)\n";
+    result = glbBuildGenerateCode_C_Main_FeaturesByAPI(context, "glx", codeOut);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+    codeOut += "#endif /* GLBIND_GLX */\n";
+
+    codeOut += "\n#if defined(GLBIND_EGL)\n";
+    result = glbBuildGenerateCode_C_Main_FeaturesByAPI(context, "egl", codeOut);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+    codeOut += "#endif /* GLBIND_EGL */\n";
+
+    // TODO: All other APIs no in gl, wgl, glx and egl (gles2, etc.)?
+
+
+    // Now we need to do extensions. For cleanliness we want to group extensions. We do gl/glcore first, then wgl, then glx, then egl.
+    counter = 0;
+    for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
+        glbExtension &extension = context.extensions[iExtension];
+        if (!glbIsExtensionBlackListed(extension.name.c_str()) && (extension.supported == "gl" || glbContains(extension.supported, "gl|") || glbContains(extension.supported, "glcore"))) {
+            if (counter > 0) {
+                codeOut += "\n";
+            }
+            counter += 1;
+
+            result = glbBuildGenerateCode_C_Main_Extension(context, extension, codeOut);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }
+        }
+    }
+
+    // WGL extensions.
+    codeOut += "\n#if defined(GLBIND_WGL)\n";
+    counter = 0;
+    for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
+        glbExtension &extension = context.extensions[iExtension];
+        if (!glbIsExtensionBlackListed(extension.name.c_str()) && glbContains(extension.supported, "wgl")) {
+            if (counter > 0) {
+                codeOut += "\n";
+            }
+            counter += 1;
+
+            result = glbBuildGenerateCode_C_Main_Extension(context, extension, codeOut);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }
+        }
+    }
+    codeOut += "#endif /* GLBIND_WGL */\n";
+
+    // GLX extensions.
+    codeOut += "\n#if defined(GLBIND_GLX)\n";
+    counter = 0;
+    for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
+        glbExtension &extension = context.extensions[iExtension];
+        if (!glbIsExtensionBlackListed(extension.name.c_str()) && glbContains(extension.supported, "glx")) {
+            if (counter > 0) {
+                codeOut += "\n";
+            }
+            counter += 1;
+
+            result = glbBuildGenerateCode_C_Main_Extension(context, extension, codeOut);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }
+        }
+    }
+    codeOut += "#endif /* GLBIND_GLX */\n";
+
+    // EGL extensions.
+    codeOut += "\n#if defined(GLBIND_EGL)\n";
+    counter = 0;
+    for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
+        glbExtension &extension = context.extensions[iExtension];
+        if (!glbIsExtensionBlackListed(extension.name.c_str()) && glbContains(extension.supported, "egl")) {
+            if (counter > 0) {
+                codeOut += "\n";
+            }
+            counter += 1;
+
+            result = glbBuildGenerateCode_C_Main_Extension(context, extension, codeOut);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }
+        }
+    }
+    codeOut += "#endif /* GLBIND_EGL */\n";
+
+    return GLB_SUCCESS;
+}
+
+
+
+glbResult glbBuildResolveCommands_Require(glbBuild &context, const glbRequire &require, std::unordered_set<std::string> &processedCommands, std::vector<glbResolvedCommand> &resolvedCommands)
+{
+    glbResult result;
+
+    for (size_t iCommand = 0; iCommand < require.commands.size(); ++iCommand) {
+        const std::string &commandName = require.commands[iCommand];
+        if (!glbBuildIsCommandIgnored(commandName.c_str()) && processedCommands.count(commandName) == 0) {
+            glbResolvedCommand resolvedCommand;
+            result = glbBuildFindCommand(context, commandName.c_str(), &resolvedCommand.pCommand);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }
+
+            resolvedCommands.push_back(resolvedCommand);
+            processedCommands.insert(commandName);
+        }
+    }
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildResolveCommands_Features(glbBuild &context, const char* api, std::unordered_set<std::string> &processedCommands, std::vector<glbResolvedCommand> &resolvedCommands)
+{
+    for (size_t iFeature = 0; iFeature < context.features.size(); ++iFeature) {
+        glbFeature &feature = context.features[iFeature];
+        if (feature.api == api) {
+            for (size_t iRequire = 0; iRequire < feature.requires.size(); ++iRequire) {
+                glbResult result = glbBuildResolveCommands_Require(context, feature.requires[iRequire], processedCommands, resolvedCommands);
+                if (result != GLB_SUCCESS) {
+                    return result;
+                }
+            }
+        }
+    }
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildResolveCommands_Extensions(glbBuild &context, const char* api, std::unordered_set<std::string> &processedCommands, std::vector<glbResolvedCommand> &resolvedCommands)
+{
+    for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
+        glbExtension &extension = context.extensions[iExtension];
+        if (glbIsExtensionBlackListed(extension.name.c_str())) {
+            continue;
+        }
+
+        bool isSupported;
+        if (strcmp(api, "gl") == 0) {
+            isSupported = extension.supported == "gl" || glbContains(extension.supported, "gl|") || glbContains(extension.supported, "glcore");
+        } else {
+            isSupported = glbContains(extension.supported, api);
+        }
+
+        if (isSupported) {
+            for (size_t iRequire = 0; iRequire < extension.requires.size(); ++iRequire) {
+                glbResult result = glbBuildResolveCommands_Require(context, extension.requires[iRequire], processedCommands, resolvedCommands);
+                if (result != GLB_SUCCESS) {
+                    return result;
+                }
+            }
+        }
+    }
+
+    return GLB_SUCCESS;
+}
+
+void glbBuildResolveCommands_Guard(const std::string &guard, std::vector<glbResolvedCommand> &resolvedCommands)
+{
+    glbResolvedCommand resolvedCommand;
+    resolvedCommand.guard    = guard;
+    resolvedCommand.pCommand = NULL;
+    resolvedCommands.push_back(resolvedCommand);
+}
+
+// Resolves the APIs in the order they're laid out in GLBapi. Features come first, followed by extensions, with each group sorted into gl, wgl,
+// glx and egl. When an API is used by more than one feature or extension it's only listed under the first one.
+//
+// NOTE: Some headers define their own symbols for some APIs, such as the common WGL functions (wglCreateContext, etc.). This causes compiler
+// errors so I'm working around this by simply not outputting them to global scope. We do, however, need these to be included in the GLBapi
+// structure. When isGlobalScope is true the WGL features are left out.
+glbResult glbBuildResolveCommandList(glbBuild &context, bool isGlobalScope, std::vector<glbResolvedCommand> &resolvedCommands)
+{
+    static const char* platformAPIs[]   = {"wgl", "glx", "egl"};
+    static const char* platformGuards[] = {"GLBIND_WGL", "GLBIND_GLX", "GLBIND_EGL"};
+
+    glbResult result;
+    std::unordered_set<std::string> processedCommands;
+
+    // Features.
+    result = glbBuildResolveCommands_Features(context, "gl", processedCommands, resolvedCommands);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    for (size_t iPlatform = 0; iPlatform < 3; ++iPlatform) {
+        if (isGlobalScope && iPlatform == 0) {
+            continue;
+        }
+
+        glbBuildResolveCommands_Guard("#if defined(" + std::string(platformGuards[iPlatform]) + ")", resolvedCommands);
+        result = glbBuildResolveCommands_Features(context, platformAPIs[iPlatform], processedCommands, resolvedCommands);
+        if (result != GLB_SUCCESS) {
+            return result;
+        }
+        glbBuildResolveCommands_Guard("#endif /* " + std::string(platformGuards[iPlatform]) + " */", resolvedCommands);
+    }
+
+    // Extensions.
+    result = glbBuildResolveCommands_Extensions(context, "gl", processedCommands, resolvedCommands);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    for (size_t iPlatform = 0; iPlatform < 3; ++iPlatform) {
+        glbBuildResolveCommands_Guard("#if defined(" + std::string(platformGuards[iPlatform]) + ")", resolvedCommands);
+        result = glbBuildResolveCommands_Extensions(context, platformAPIs[iPlatform], processedCommands, resolvedCommands);
+        if (result != GLB_SUCCESS) {
+            return result;
+        }
+        glbBuildResolveCommands_Guard("#endif /* " + std::string(platformGuards[iPlatform]) + " */", resolvedCommands);
+    }
+
+    return GLB_SUCCESS;
+}
+
+// Resolves the lists of APIs that are output by each pass. This needs to be done after the spec and profile have been applied.
+glbResult glbBuildResolveCommands(glbBuild &context)
+{
+    glbResult result;
+
+    context.resolvedCommands.clear();
+    context.resolvedGlobalCommands.clear();
+
+    result = glbBuildResolveCommandList(context, false, context.resolvedCommands);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    result = glbBuildResolveCommandList(context, true, context.resolvedGlobalCommands);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGenerateCode_C_FuncPointersDeclGlobal(glbBuild &context, int indentation, std::string &codeOut)
+{
+    bool isGlobalScope = (indentation == 0); // If the indentation is 0 it means we're generating the global symbols. Bit of a hack, but it works.
+    const std::vector<glbResolvedCommand> &resolvedCommands = isGlobalScope ? context.resolvedGlobalCommands : context.resolvedCommands;
+
+    for (size_t iCommand = 0; iCommand < resolvedCommands.size(); ++iCommand) {
+        const glbResolvedCommand &resolvedCommand = resolvedCommands[iCommand];
+        if (resolvedCommand.pCommand == NULL) {
+            codeOut += resolvedCommand.guard + "\n";
+            continue;
+        }
+
+        for (int i = 0; i < indentation; ++i) {
+            codeOut += " ";
+        }
+        codeOut += "PFN" + glbToUpper(resolvedCommand.pCommand->name) + "PROC " + resolvedCommand.pCommand->name + ";\n";
+    }
+
+    codeOut.pop_back();
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGenerateCode_C_InitCurrentContextAPI(glbBuild &context, std::string &codeOut)
+{
+    const std::vector<glbResolvedCommand> &resolvedCommands = context.resolvedCommands;
+
+    /*
+    The names are packed into a struct of exactly sized char arrays rather than one big string literal. This keeps all of the names in a single
+    block of memory without any relocations, avoids hitting compiler limits on the length of string literals, and lets the compiler calculate
+    the offsets for us with offsetof() which means the platform guards just work.
+    */
+    codeOut += "typedef struct\n{\n";
+    for (size_t iCommand = 0; iCommand < resolvedCommands.size(); ++iCommand) {
+        if (resolvedCommands[iCommand].pCommand == NULL) {
+            codeOut += resolvedCommands[iCommand].guard + "\n";
+        } else {
+            codeOut += "    char " + resolvedCommands[iCommand].pCommand->name + "[" + std::to_string(resolvedCommands[iCommand].pCommand->name.size() + 1) + "];\n";
+        }
+    }
+    codeOut += "} glbind_ProcNameTable;\n";
+    codeOut += "\n";
+
+    codeOut += "static const glbind_ProcNameTable glbind_ProcNames =\n{\n";
+    for (size_t iCommand = 0; iCommand < resolvedCommands.size(); ++iCommand) {
+        if (resolvedCommands[iCommand].pCommand == NULL) {
+            codeOut += resolvedCommands[iCommand].guard + "\n";
+        } else {
+            codeOut += "    \"" + resolvedCommands[iCommand].pCommand->name + "\",\n";
+        }
+    }
+    codeOut += "};\n";
+    codeOut += "\n";
+
+    codeOut += "static const GLuint glbind_ProcNameOffsets[] =\n{\n";
+    for (size_t iCommand = 0; iCommand < resolvedCommands.size(); ++iCommand) {
+        if (resolvedCommands[iCommand].pCommand == NULL) {
+            codeOut += resolvedCommands[iCommand].guard + "\n";
+        } else {
+            codeOut += "    (GLuint)offsetof(glbind_ProcNameTable, " + resolvedCommands[iCommand].pCommand->name + "),\n";
+        }
+    }
+    codeOut += "};";
+
+    return GLB_SUCCESS;
+}
+
+
+// Retrieves the names of the commands required by the given require blocks, excluding ignored commands and duplicates.
+glbResult glbBuildGetRequiredCommands(glbBuild &context, const std::vector<glbRequire> &requires, std::vector<std::string> &commandsOut)
+{
+    std::unordered_set<std::string> processedCommands(commandsOut.begin(), commandsOut.end());
+
+    for (size_t iRequire = 0; iRequire < requires.size(); ++iRequire) {
+        for (size_t iCommand = 0; iCommand < requires[iRequire].commands.size(); ++iCommand) {
+            const std::string &commandName = requires[iRequire].commands[iCommand];
+            if (!glbBuildIsCommandIgnored(commandName.c_str()) && processedCommands.insert(commandName).second) {
+                glbCommand* pCommand;
+                glbResult result = glbBuildFindCommand(context, commandName.c_str(), &pCommand);
+                if (result != GLB_SUCCESS) {
+                    return result;
+                }
+
+                commandsOut.push_back(commandName);
+            }
+        }
+    }
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGetFeatureVersion(const glbFeature &feature, std::string &majorOut, std::string &minorOut)
+{
+    size_t dot = feature.number.find('.');
+    if (dot == std::string::npos) {
+        printf("Unexpected version number \"%s\" for feature %s.\n", feature.number.c_str(), feature.name.c_str());
+        return GLB_ERROR;
+    }
+
+    majorOut = feature.number.substr(0, dot);
+    minorOut = feature.number.substr(dot + 1);
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGenerateCode_C_RequireLists_Entry(glbBuild &context, const std::string &header, const std::string &comment, const std::vector<glbRequire> &requires, std::string &codeOut)
+{
+    std::vector<std::string> commands;
+    glbResult result = glbBuildGetRequiredCommands(context, requires, commands);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    codeOut += "    /* " + comment + " */\n";
+    codeOut += "    " + header + std::to_string(commands.size()) + ",\n";
+    for (size_t iCommand = 0; iCommand < commands.size(); ++iCommand) {
+        codeOut += "        GLB_PROC_" + commands[iCommand] + ",\n";
+    }
+
+    return GLB_SUCCESS;
+}
+
+struct glbExtensionGroup
+{
+    const char* guard;  // NULL for cross-platform extensions.
+    std::vector<glbExtension*> extensions;
+};
+
+// Retrieves the extensions that are output, grouped by platform (gl, wgl, glx, egl) and sorted by name within each group. The order of these is the order of GLBextension.
+glbResult glbBuildGetExtensionGroups(glbBuild &context, std::vector<glbExtensionGroup> &groupsOut)
+{
+    groupsOut.clear();
+    groupsOut.resize(4);
+    groupsOut[0].guard = NULL;
+    groupsOut[1].guard = "GLBIND_WGL";
+    groupsOut[2].guard = "GLBIND_GLX";
+    groupsOut[3].guard = "GLBIND_EGL";
+
+    for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
+        glbExtension &extension = context.extensions[iExtension];
+        if (glbIsExtensionBlackListed(extension.name.c_str())) {
+            continue;
+        }
+
+        if (extension.supported == "gl" || glbContains(extension.supported, "gl|") || glbContains(extension.supported, "glcore")) {
+            groupsOut[0].extensions.push_back(&extension);
+        }
+        if (glbContains(extension.supported, "wgl")) {
+            groupsOut[1].extensions.push_back(&extension);
+        }
+        if (glbContains(extension.supported, "glx")) {
+            groupsOut[2].extensions.push_back(&extension);
+        }
+        if (glbContains(extension.supported, "egl")) {
+            groupsOut[3].extensions.push_back(&extension);
+        }
+    }
+
+    for (auto &group : groupsOut) {
+        std::sort(group.extensions.begin(), group.extensions.end(), [](const glbExtension* a, const glbExtension* b) { return a->name < b->name; });
+    }
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGenerateCode_C_ExtensionEnum(glbBuild &context, std::string &codeOut)
+{
+    std::vector<glbExtensionGroup> groups;
+    glbResult result = glbBuildGetExtensionGroups(context, groups);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    // Platform extensions follow on from the cross-platform extensions. Only one platform is ever enabled so they will always start at the same index.
+    codeOut += "typedef enum\n{\n";
+    for (auto &group : groups) {
+        if (group.guard != NULL) {
+            codeOut += "#if defined(" + std::string(group.guard) + ")\n";
+        }
+        for (auto pExtension : group.extensions) {
+            codeOut += "    GLB_EXTENSION_" + pExtension->name + ",\n";
+        }
+        if (group.guard != NULL) {
+            codeOut += "#endif /* " + std::string(group.guard) + " */\n";
+        }
+    }
+    codeOut += "    GLB_EXTENSION_COUNT\n";
+    codeOut += "} GLBextension;";
+
+    return GLB_SUCCESS;
+}
+
+// The index of each function pointer in GLBapi. This is generated from the same list as the struct so the two are always in the same order.
+glbResult glbBuildGenerateCode_C_ProcEnum(glbBuild &context, std::string &codeOut)
+{
+    const std::vector<glbResolvedCommand> &resolvedCommands = context.resolvedCommands;
+
+    codeOut += "typedef enum\n{\n";
+    for (size_t iCommand = 0; iCommand < resolvedCommands.size(); ++iCommand) {
+        if (resolvedCommands[iCommand].pCommand == NULL) {
+            codeOut += resolvedCommands[iCommand].guard + "\n";
+        } else {
+            codeOut += "    GLB_PROC_" + resolvedCommands[iCommand].pCommand->name + ",\n";
+        }
+    }
+    codeOut += "    GLB_PROC_COUNT\n";
+    codeOut += "} GLBprocIndex;";
+
+    return GLB_SUCCESS;
+}
+
+uint32_t glbBuildHashExtensionName(const std::string &name, uint32_t seed)
+{
+    // FNV-1a. This must match glbHashExtensionName() in the template.
+    uint32_t hash = 2166136261u ^ seed;
+    for (size_t i = 0; i < name.size(); ++i) {
+        hash ^= (unsigned char)name[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+/*
+Builds a perfect hash table using the "hash and displace" method. Names are first hashed into buckets. Then, starting with the biggest
+bucket, a seed is searched for such that every name in the bucket hashes to a free slot. Lookups therefore always take two hashes and
+a single string comparison.
+*/
+glbResult glbBuildPerfectHash(const std::vector<std::string> &names, std::vector<uint32_t> &seedsOut, std::vector<uint32_t> &slotsOut)
+{
+    const uint32_t emptySlot = 0xFFFFFFFF;
+
+    uint32_t slotCount = 1;
+    while (slotCount < names.size()) {
+        slotCount *= 2;
+    }
+
+    uint32_t bucketCount = (slotCount >= 4) ? slotCount / 4 : 1;
+
+    std::vector<std::vector<uint32_t>> buckets(bucketCount);
+    for (uint32_t iName = 0; iName < (uint32_t)names.size(); ++iName) {
+        buckets[glbBuildHashExtensionName(names[iName], 0) & (bucketCount - 1)].push_back(iName);
+    }
+
+    std::vector<uint32_t> bucketOrder(bucketCount);
+    for (uint32_t iBucket = 0; iBucket < bucketCount; ++iBucket) {
+        bucketOrder[iBucket] = iBucket;
+    }
+    std::stable_sort(bucketOrder.begin(), bucketOrder.end(), [&](uint32_t a, uint32_t b) { return buckets[a].size() > buckets[b].size(); });
+
+    seedsOut.assign(bucketCount, 0);
+    slotsOut.assign(slotCount, emptySlot);
+
+    for (uint32_t iBucket : bucketOrder) {
+        const std::vector<uint32_t> &bucket = buckets[iBucket];
+        if (bucket.empty()) {
+            break;
+        }
+
+        bool found = false;
+        for (uint32_t seed = 1; seed < 0x10000000 && !found; ++seed) {
+            std::vector<uint32_t> candidateSlots;
+            for (uint32_t iName : bucket) {
+                uint32_t slot = glbBuildHashExtensionName(names[iName], seed) & (slotCount - 1);
+                if (slotsOut[slot] != emptySlot || std::find(candidateSlots.begin(), candidateSlots.end(), slot) != candidateSlots.end()) {
+                    break;
+                }
+                candidateSlots.push_back(slot);
+            }
+
+            if (candidateSlots.size() == bucket.size()) {
+                for (size_t i = 0; i < bucket.size(); ++i) {
+                    slotsOut[candidateSlots[i]] = bucket[i];
+                }
+                seedsOut[iBucket] = seed;
+                found = true;
+            }
+        }
+
+        if (!found) {
+            printf("Failed to build perfect hash table for extension names.\n");
+            return GLB_ERROR;
+        }
+    }
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGenerateCode_C_ExtensionNames(glbBuild &context, std::string &codeOut)
+{
+    std::vector<glbExtensionGroup> groups;
+    glbResult result = glbBuildGetExtensionGroups(context, groups);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    codeOut += "#define GLBIND_GL_EXTENSION_COUNT   " + std::to_string(groups[0].extensions.size()) + "\n";
+    codeOut += "#define GLBIND_WGL_EXTENSION_COUNT  " + std::to_string(groups[1].extensions.size()) + "\n";
+    codeOut += "#define GLBIND_GLX_EXTENSION_COUNT  " + std::to_string(groups[2].extensions.size()) + "\n";
+    codeOut += "#define GLBIND_EGL_EXTENSION_COUNT  " + std::to_string(groups[3].extensions.size()) + "\n";
+    codeOut += "\n";
+
+    // Extension names. The members are prefixed because the extension names themselves are defined as macros.
+    codeOut += "typedef struct\n{\n";
+    for (auto &group : groups) {
+        if (group.guard != NULL) {
+            codeOut += "#if defined(" + std::string(group.guard) + ")\n";
+        }
+        for (auto pExtension : group.extensions) {
+            codeOut += "    char ext_" + pExtension->name + "[" + std::to_string(pExtension->name.size() + 1) + "];\n";
+        }
+        if (group.guard != NULL) {
+            codeOut += "#endif /* " + std::string(group.guard) + " */\n";
+        }
+    }
+    codeOut += "} glbind_ExtensionNameTable;\n";
+    codeOut += "\n";
+
+    codeOut += "static const glbind_ExtensionNameTable glbind_ExtensionNames =\n{\n";
+    for (auto &group : groups) {
+        if (group.guard != NULL) {
+            codeOut += "#if defined(" + std::string(group.guard) + ")\n";
+        }
+        for (auto pExtension : group.extensions) {
+            codeOut += "    \"" + pExtension->name + "\",\n";
+        }
+        if (group.guard != NULL) {
+            codeOut += "#endif /* " + std::string(group.guard) + " */\n";
+        }
+    }
+    codeOut += "};\n";
+    codeOut += "\n";
+
+    codeOut += "static const GLuint glbind_ExtensionNameOffsets[] =\n{\n";
+    for (auto &group : groups) {
+        if (group.guard != NULL) {
+            codeOut += "#if defined(" + std::string(group.guard) + ")\n";
+        }
+        for (auto pExtension : group.extensions) {
+            codeOut += "    (GLuint)offsetof(glbind_ExtensionNameTable, ext_" + pExtension->name + "),\n";
+        }
+        if (group.guard != NULL) {
+            codeOut += "#endif /* " + std::string(group.guard) + " */\n";
+        }
+    }
+    codeOut += "};\n";
+    codeOut += "\n";
+
+    // The hash table covers the extensions of every platform. Each slot is an index into the list of every extension in gl, wgl, glx, egl order.
+    std::vector<std::string> names;
+    for (auto &group : groups) {
+        for (auto pExtension : group.extensions) {
+            names.push_back(pExtension->name);
+        }
+    }
+
+    std::vector<uint32_t> seeds;
+    std::vector<uint32_t> slots;
+    result = glbBuildPerfectHash(names, seeds, slots);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    codeOut += "#define GLBIND_EXTENSION_HASH_BUCKET_COUNT  " + std::to_string(seeds.size()) + "\n";
+    codeOut += "#define GLBIND_EXTENSION_HASH_SLOT_COUNT    " + std::to_string(slots.size()) + "\n";
+    codeOut += "#define GLBIND_EXTENSION_HASH_EMPTY_SLOT    0xFFFF\n";
+    codeOut += "\n";
+
+    codeOut += "static const GLuint glbind_ExtensionHashSeeds[GLBIND_EXTENSION_HASH_BUCKET_COUNT] =\n{";
+    for (size_t i = 0; i < seeds.size(); ++i) {
+        codeOut += ((i % 16) == 0) ? "\n    " : " ";
+        codeOut += std::to_string(seeds[i]) + ",";
+    }
+    codeOut += "\n};\n";
+    codeOut += "\n";
+
+    codeOut += "static const GLushort glbind_ExtensionHashSlots[GLBIND_EXTENSION_HASH_SLOT_COUNT] =\n{";
+    for (size_t i = 0; i < slots.size(); ++i) {
+        codeOut += ((i % 16) == 0) ? "\n    " : " ";
+        codeOut += ((slots[i] == 0xFFFFFFFF) ? std::string("0xFFFF") : std::to_string(slots[i])) + ",";
+    }
+    codeOut += "\n};";
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGenerateCode_C_RequireLists(glbBuild &context, std::string &codeOut)
+{
+    glbResult result;
+
+    std::vector<glbExtensionGroup> groups;
+    result = glbBuildGetExtensionGroups(context, groups);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    // Core features. Platform features are always loaded so they are given a version of 0.0.
+    codeOut += "/* The commands required by each version. Each entry is the major version, minor version and command count, followed by the index of each command. */\n";
+    codeOut += "static const GLushort glbind_FeatureRequires[] =\n{\n";
+    const char* featureAPIs[] = {"gl", "wgl", "glx", "egl"};
+    for (const char* api : featureAPIs) {
+        std::string guard = (strcmp(api, "wgl") == 0) ? "GLBIND_WGL" : (strcmp(api, "glx") == 0) ? "GLBIND_GLX" : (strcmp(api, "egl") == 0) ? "GLBIND_EGL" : "";
+        if (guard != "") {
+            codeOut += "#if defined(" + guard + ")\n";
+        }
+        for (size_t iFeature = 0; iFeature < context.features.size(); ++iFeature) {
+            glbFeature &feature = context.features[iFeature];
+            if (feature.api != api) {
+                continue;
+            }
+
+            std::string header = "0, 0, ";
+            if (guard == "") {
+                std::string major;
+                std::string minor;
+                result = glbBuildGetFeatureVersion(feature, major, minor);
+                if (result != GLB_SUCCESS) {
+                    return result;
+                }
+
+                header = major + ", " + minor + ", ";
+            }
+
+            result = glbBuildGenerateCode_C_RequireLists_Entry(context, header, feature.name, feature.requires, codeOut);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }
+        }
+        if (guard != "") {
+            codeOut += "#endif /* " + guard + " */\n";
+        }
+    }
+    codeOut += "};\n";
+    codeOut += "\n";
+
+    // Extensions. These are in the same order as the name table.
+    codeOut += "/* The commands required by each extension, in the same order as glbind_ExtensionNames. Each entry is the command count, followed by the index of each command. */\n";
+    codeOut += "static const GLushort glbind_ExtensionRequires[] =\n{\n";
+    for (auto &group : groups) {
+        if (group.guard != NULL) {
+            codeOut += "#if defined(" + std::string(group.guard) + ")\n";
+        }
+        for (auto pExtension : group.extensions) {
+            result = glbBuildGenerateCode_C_RequireLists_Entry(context, "", pExtension->name, pExtension->requires, codeOut);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }
+        }
+        if (group.guard != NULL) {
+            codeOut += "#endif /* " + std::string(group.guard) + " */\n";
+        }
+    }
+    codeOut += "};";
+
+    return GLB_SUCCESS;
+}
+
+// Retrieves the parameter list of a command for use in a declaration, and the argument list for forwarding those parameters to another call.
+void glbBuildGetCommandParamsAndArgs(const glbCommand &command, std::string &paramsOut, std::string &argsOut)
+{
+    paramsOut.clear();
+    argsOut.clear();
+
+    if (command.params.size() == 0) {
+        paramsOut = "void";
+        return;
+    }
+
+    for (size_t iParam = 0; iParam < command.params.size(); ++iParam) {
+        if (iParam != 0) {
+            paramsOut += ", ";
+            argsOut   += ", ";
+        }
+        paramsOut += command.params[iParam].typeC + " " + command.params[iParam].name;
+        argsOut   += command.params[iParam].name;
+    }
+}
+
+glbResult glbBuildGenerateCode_C_LazyTrampolines(glbBuild &context, std::string &codeOut)
+{
+    const std::vector<glbResolvedCommand> &resolvedCommands = context.resolvedGlobalCommands;
+
+    /*
+    Each global function pointer is initialized to a trampoline. The first time the trampoline is called it resolves the real function,
+    replaces the global function pointer with it and then forwards the call.
+    */
+    for (size_t iCommand = 0; iCommand < resolvedCommands.size(); ++iCommand) {
+        if (resolvedCommands[iCommand].pCommand == NULL) {
+            codeOut += resolvedCommands[iCommand].guard + "\n";
+            continue;
+        }
+
+        const glbCommand* pCommand = resolvedCommands[iCommand].pCommand;
+
+        std::string params;
+        std::string args;
+        glbBuildGetCommandParamsAndArgs(*pCommand, params, args);
+
+        std::string trampolineName = "glbind_Lazy_" + pCommand->name;
+        std::string trampolineDecl = "static " + pCommand->returnTypeC + " APIENTRY " + trampolineName + "(" + params + ")";
+
+        codeOut += trampolineDecl + ";\n";
+        codeOut += "PFN" + glbToUpper(pCommand->name) + "PROC " + pCommand->name + " = " + trampolineName + ";\n";
+        codeOut += trampolineDecl + "\n";
+        codeOut += "{\n";
+        codeOut += "    " + pCommand->name + " = (PFN" + glbToUpper(pCommand->name) + "PROC)glbGetProcAddressByIndex(GLB_PROC_" + pCommand->name + ");\n";
+        if (pCommand->returnTypeC == "void") {
+            codeOut += "    " + pCommand->name + "(" + args + ");\n";
+        } else {
+            codeOut += "    return " + pCommand->name + "(" + args + ");\n";
+        }
+        codeOut += "}\n";
+    }
+
+    // The template takes care of the new line at the end.
+    if (!codeOut.empty() && codeOut.back() == '\n') {
+        codeOut.pop_back();
+    }
+
+    return GLB_SUCCESS;
+}
+
+// Points every global function pointer back at its trampoline. This is the body of glbResetLazyTrampolines() which is called by glbUninit().
+glbResult glbBuildGenerateCode_C_ResetLazyTrampolines(glbBuild &context, std::string &codeOut)
+{
+    const std::vector<glbResolvedCommand> &resolvedCommands = context.resolvedGlobalCommands;
+
+    for (size_t iCommand = 0; iCommand < resolvedCommands.size(); ++iCommand) {
+        if (resolvedCommands[iCommand].pCommand == NULL) {
+            codeOut += resolvedCommands[iCommand].guard + "\n";
+        } else {
+            codeOut += "    " + resolvedCommands[iCommand].pCommand->name + " = glbind_Lazy_" + resolvedCommands[iCommand].pCommand->name + ";\n";
+        }
+    }
+
+    codeOut.pop_back();
+
+    return GLB_SUCCESS;
+}
+
+
+// In thread-local dispatch mode the global names are real functions which forward to the API that is current on the calling thread.
+glbResult glbBuildGenerateCode_C_TLSDispatch(glbBuild &context, bool isDeclaration, std::string &codeOut)
+{
+    const std::vector<glbResolvedCommand> &resolvedCommands = context.resolvedGlobalCommands;
+
+    for (size_t iCommand = 0; iCommand < resolvedCommands.size(); ++iCommand) {
+        if (resolvedCommands[iCommand].pCommand == NULL) {
+            codeOut += resolvedCommands[iCommand].guard + "\n";
+            continue;
+        }
+
+        const glbCommand* pCommand = resolvedCommands[iCommand].pCommand;
+
+        std::string params;
+        std::string args;
+        glbBuildGetCommandParamsAndArgs(*pCommand, params, args);
+
+        std::string decl = pCommand->returnTypeC + " APIENTRY " + pCommand->name + "(" + params + ")";
+        if (isDeclaration) {
+            codeOut += decl + ";\n";
+        } else {
+            codeOut += decl + "\n";
+            codeOut += "{\n";
+            if (pCommand->returnTypeC == "void") {
+                codeOut += "    glbind_pCurrentAPI->" + pCommand->name + "(" + args + ");\n";
+            } else {
+                codeOut += "    return glbind_pCurrentAPI->" + pCommand->name + "(" + args + ");\n";
+            }
+            codeOut += "}\n";
+        }
+    }
+
+    // The template takes care of the new line at the end.
+    if (!codeOut.empty() && codeOut.back() == '\n') {
+        codeOut.pop_back();
+    }
+
+    return GLB_SUCCESS;
+}
+
+/*
+The stub library. See glbind_stub_template.c. It's only implemented for GLX so it has every GL and GLX command that's declared in global
+scope. Each one is defined as a no-op that counts how many times it's been called, with the exception of the ones in
+g_StubImplementedCommands. glXGetProcAddress() finds them with a binary search so they're listed by name rather than in registry order.
+*/
+bool glbBuildIsStubImplementedCommand(const std::string &commandName)
+{
+    for (size_t i = 0; i < sizeof(g_StubImplementedCommands)/sizeof(g_StubImplementedCommands[0]); ++i) {
+        if (commandName == g_StubImplementedCommands[i]) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void glbBuildGetStubCommands(glbBuild &context, std::vector<glbCommand*> &commandsOut)
+{
+    const std::vector<glbResolvedCommand> &resolvedCommands = context.resolvedGlobalCommands;
+
+    bool isPlatformIncluded = true;
+    for (size_t iCommand = 0; iCommand < resolvedCommands.size(); ++iCommand) {
+        if (resolvedCommands[iCommand].pCommand == NULL) {
+            const std::string &guard = resolvedCommands[iCommand].guard;
+            isPlatformIncluded = guard.compare(0, 3, "#if") != 0 || guard == "#if defined(GLBIND_GLX)";
+            continue;
+        }
+
+        if (isPlatformIncluded) {
+            commandsOut.push_back(resolvedCommands[iCommand].pCommand);
+        }
+    }
+
+    // Must match the strcmp() in glbStubCompareProcEntry().
+    std::sort(commandsOut.begin(), commandsOut.end(), [](const glbCommand* a, const glbCommand* b) {
+        return strcmp(a->name.c_str(), b->name.c_str()) < 0;
+    });
+}
+
+glbResult glbBuildGenerateCode_C_StubProcEnum(glbBuild &context, std::string &codeOut)
+{
+    std::vector<glbCommand*> commands;
+    glbBuildGetStubCommands(context, commands);
+
+    for (size_t iCommand = 0; iCommand < commands.size(); ++iCommand) {
+        codeOut += "    GLB_STUB_PROC_" + commands[iCommand]->name + ",\n";
+    }
+
+    // The template takes care of the new line at the end.
+    if (!codeOut.empty() && codeOut.back() == '\n') {
+        codeOut.pop_back();
+    }
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGenerateCode_C_StubProcs(glbBuild &context, std::string &codeOut)
+{
+    std::vector<glbCommand*> commands;
+    glbBuildGetStubCommands(context, commands);
+
+    for (size_t iCommand = 0; iCommand < commands.size(); ++iCommand) {
+        const glbCommand* pCommand = commands[iCommand];
+        if (glbBuildIsStubImplementedCommand(pCommand->name)) {
+            continue;
+        }
+
+        std::string params;
+        std::string args;
+        glbBuildGetCommandParamsAndArgs(*pCommand, params, args);
+
+        codeOut += pCommand->returnTypeC + " APIENTRY " + pCommand->name + "(" + params + ")\n";
+        codeOut += "{\n";
+        codeOut += "    GLB_STUB_CALL(GLB_STUB_PROC_" + pCommand->name + ");\n";
+        if (pCommand->returnTypeC != "void") {
+            codeOut += "    return (" + pCommand->returnTypeC + ")0;\n";
+        }
+        codeOut += "}\n";
+    }
+
+    // The template takes care of the new line at the end.
+    if (!codeOut.empty() && codeOut.back() == '\n') {
+        codeOut.pop_back();
+    }
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGenerateCode_C_StubProcTable(glbBuild &context, std::string &codeOut)
+{
+    std::vector<glbCommand*> commands;
+    glbBuildGetStubCommands(context, commands);
+
+    for (size_t iCommand = 0; iCommand < commands.size(); ++iCommand) {
+        codeOut += "    {\"" + commands[iCommand]->name + "\", (GLBproc)" + commands[iCommand]->name + "},\n";
+    }
+
+    // The template takes care of the new line at the end.
+    if (!codeOut.empty() && codeOut.back() == '\n') {
+        codeOut.pop_back();
+    }
+
+    return GLB_SUCCESS;
+}
+
+// Retrieves the GL versions that get a capability flag. Only core GL versions are included since the platform versions are implied by the platform itself.
+glbResult glbBuildGetVersionFeatures(glbBuild &context, std::vector<glbFeature*> &featuresOut)
+{
+    featuresOut.clear();
+    for (size_t iFeature = 0; iFeature < context.features.size(); ++iFeature) {
+        glbFeature &feature = context.features[iFeature];
+        if (feature.api == "gl") {
+            featuresOut.push_back(&feature);
+        }
+    }
+
+    return GLB_SUCCESS;
+}
+
+// Generates the capability flags. The declaration is used for both global scope and the GLBapi structure depending on indentation.
+glbResult glbBuildGenerateCode_C_CapabilityFlagsDecl(glbBuild &context, int indentation, std::string &codeOut)
+{
+    std::string indent(indentation, ' ');
+
+    std::vector<glbFeature*> features;
+    glbResult result = glbBuildGetVersionFeatures(context, features);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    std::vector<glbExtensionGroup> groups;
+    result = glbBuildGetExtensionGroups(context, groups);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    for (auto pFeature : features) {
+        codeOut += indent + "GLboolean GLB_" + pFeature->name + ";\n";
+    }
+
+    for (auto &group : groups) {
+        if (group.guard != NULL) {
+            codeOut += "#if defined(" + std::string(group.guard) + ")\n";
+        }
+        for (auto pExtension : group.extensions) {
+            codeOut += indent + "GLboolean GLB_HAS_" + pExtension->name + ";\n";
+        }
+        if (group.guard != NULL) {
+            codeOut += "#endif /* " + std::string(group.guard) + " */\n";
+        }
+    }
+
+    codeOut.pop_back();  // Remove the trailing new line.
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGenerateCode_C_SetCapabilityFlags(glbBuild &context, std::string &codeOut)
+{
+    std::vector<glbFeature*> features;
+    glbResult result = glbBuildGetVersionFeatures(context, features);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    std::vector<glbExtensionGroup> groups;
+    result = glbBuildGetExtensionGroups(context, groups);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    for (auto pFeature : features) {
+        std::string major;
+        std::string minor;
+        result = glbBuildGetFeatureVersion(*pFeature, major, minor);
+        if (result != GLB_SUCCESS) {
+            return result;
+        }
+
+        codeOut += "    pAPI->GLB_" + pFeature->name + " = glbIsVersionAtLeast(majorVersion, minorVersion, " + major + ", " + minor + ");\n";
+    }
+
+    for (auto &group : groups) {
+        if (group.guard != NULL) {
+            codeOut += "#if defined(" + std::string(group.guard) + ")\n";
+        }
+        for (auto pExtension : group.extensions) {
+            codeOut += "    pAPI->GLB_HAS_" + pExtension->name + " = glbHasExtensionSupportFlag(pAPI->extensionSupportFlags, GLB_EXTENSION_" + pExtension->name + ");\n";
+        }
+        if (group.guard != NULL) {
+            codeOut += "#endif /* " + std::string(group.guard) + " */\n";
+        }
+    }
+
+    codeOut.pop_back();
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGenerateCode_C_SetGlobalCapabilityFlagsFromStruct(glbBuild &context, std::string &codeOut)
+{
+    std::vector<glbFeature*> features;
+    glbResult result = glbBuildGetVersionFeatures(context, features);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    std::vector<glbExtensionGroup> groups;
+    result = glbBuildGetExtensionGroups(context, groups);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    for (auto pFeature : features) {
+        codeOut += "    GLB_" + pFeature->name + " = pAPI->GLB_" + pFeature->name + ";\n";
+    }
+
+    for (auto &group : groups) {
+        if (group.guard != NULL) {
+            codeOut += "#if defined(" + std::string(group.guard) + ")\n";
+        }
+        for (auto pExtension : group.extensions) {
+            codeOut += "    GLB_HAS_" + pExtension->name + " = pAPI->GLB_HAS_" + pExtension->name + ";\n";
+        }
+        if (group.guard != NULL) {
+            codeOut += "#endif /* " + std::string(group.guard) + " */\n";
+        }
+    }
+
+    codeOut.pop_back();
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGenerateCode_C_SetGlobalAPIFromStruct(glbBuild &context, std::string &codeOut)
+{
+    const std::vector<glbResolvedCommand> &resolvedCommands = context.resolvedGlobalCommands;
+
+    for (size_t iCommand = 0; iCommand < resolvedCommands.size(); ++iCommand) {
+        if (resolvedCommands[iCommand].pCommand == NULL) {
+            codeOut += resolvedCommands[iCommand].guard + "\n";
+        } else {
+            codeOut += "    " + resolvedCommands[iCommand].pCommand->name + " = pAPI->" + resolvedCommands[iCommand].pCommand->name + ";\n";
+        }
+    }
+
+    codeOut.pop_back();
+
+    return GLB_SUCCESS;
+}
+
+#include <time.h>
+// Lets applications check which profile and version the header was generated for. Nothing is output for the full compatibility profile.
+glbResult glbBuildGenerateCode_C_Profile(glbBuild &context, std::string &codeOut)
+{
+    if (context.profile == "core") {
+        codeOut += "\n";
+        codeOut += "/* This header was generated for the core profile. APIs that have been removed from core contexts are not included. */\n";
+        codeOut += "#define GLBIND_PROFILE_CORE\n";
+    }
+
+    if (!context.maxVersion.empty()) {
+        size_t dot = context.maxVersion.find('.');
+
+        codeOut += "\n";
+        codeOut += "/* This header was generated for OpenGL " + context.maxVersion + ". APIs from later versions are not included. */\n";
+        codeOut += "#define GLBIND_GL_VERSION_MAX_MAJOR " + context.maxVersion.substr(0, dot) + "\n";
+        codeOut += "#define GLBIND_GL_VERSION_MAX_MINOR " + context.maxVersion.substr(dot + 1) + "\n";
+    }
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGenerateCode_C_Date(glbBuild &context, std::string &codeOut)
+{
+    (void)context;
+
+    time_t t = time(NULL);
+
+    char dateStr[32];
+#if defined(_MSC_VER)
+    struct tm local;
+    localtime_s(&local, &t);
+    strftime(dateStr, sizeof(dateStr), "%Y-%m-%d", &local);
+#else
+    struct tm *local = localtime(&t);
+    strftime(dateStr, sizeof(dateStr), "%Y-%m-%d", local);
+#endif
+
+    codeOut += dateStr;
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGetOpenGLVersion(glbBuild &context, std::string &versionOut)
+{
+    // The version can be retrieved from the last "gl" feature section.
+    std::string versionStr;
+    for (auto feature : context.features) {
+        if (feature.api == "gl") {
+            versionStr = feature.number;
+        }
+    }
+
+    versionOut = versionStr;
+
+    return GLB_SUCCESS;
+}
+
+glbResult vkbBuildGenerateCode_C_OpenGLVersion(glbBuild &context, std::string &codeOut)
+{
+    std::string version;
+    glbResult result = glbBuildGetOpenGLVersion(context, version);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    codeOut += version;
+
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGenerateCode_C_Revision(glbBuild &context, std::string &codeOut)
+{
+    // Rules for the revision number:
+    // 1) If the OpenGL version has changed, reset the revision to 0, otherwise increment by 1.
+    // 2) If glbind.h cannot be found, set to 0.
+    std::string revision;
+
+    // The version is at the top of the file so there's no need to read all of it.
+    FILE* pFile;
+    if (glbFOpen("glbind.h", "rb", &pFile) == GLB_SUCCESS) {
+        char fileHead[1024];
+        size_t fileHeadSize = fread(fileHead, 1, sizeof(fileHead) - 1, pFile);
+        fileHead[fileHeadSize] = '\0';
+        fclose(pFile);
+
+        // We need to parse the previous version.
+        std::string prevVersionMajor;
+        std::string prevVersionMinor;
+        std::string prevVersionRevision;
+        const char* versionBeg = strstr(fileHead, "glbind - v");
+        if (versionBeg != NULL) {
+            versionBeg += strlen("glbind - v");
+
+            std::string currentOpenGLVersion;
+            glbResult result = glbBuildGetOpenGLVersion(context, currentOpenGLVersion);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }
+
+            const char* cursorBeg = versionBeg;
+            const char* cursorEnd = versionBeg;
+
+            cursorEnd = strstr(cursorBeg, ".");
+            prevVersionMajor = std::string(cursorBeg, cursorEnd-cursorBeg);
+            cursorBeg = cursorEnd + 1;
+
+            cursorEnd = strstr(cursorBeg, ".");
+            prevVersionMinor = std::string(cursorBeg, cursorEnd-cursorBeg);
+            cursorBeg = cursorEnd + 1;
+
+            cursorEnd = strstr(cursorBeg, " ");
+            prevVersionRevision = std::string(cursorBeg, cursorEnd-cursorBeg);
+            cursorBeg = cursorEnd + 1;
+
+            std::string previousOpenGLVersion = prevVersionMajor + "." + prevVersionMinor;
+            if (currentOpenGLVersion == previousOpenGLVersion) {
+                // OpenGL versions are the same, so increment.
+                revision = std::to_string(atoi(prevVersionRevision.c_str()) + 1);
+            } else {
+                // OpenGL versions are different, so reset.
+                revision = "0";
+            }
+        } else {
+            // Couldn't find the previous version.
+            revision = "0";
+        }
+    } else {
+        // vkbind.h was not found.
+        revision = "0";
+    }
+
+    codeOut += revision;
+    return GLB_SUCCESS;
+}
+
+glbResult glbBuildGenerateCode_C(glbBuild &context, const char* tag, std::string &codeOut)
+{
+    if (tag == NULL) {
+        return GLB_INVALID_ARGS;
+    }
+
+    glbResult result = GLB_INVALID_ARGS;
+    if (strcmp(tag, "/*<<opengl_main>>*/") == 0) {
+        result = glbBuildGenerateCode_C_Main(context, codeOut);
+    }
+    if (strcmp(tag, "/*<<opengl_funcpointers_decl_global>>*/") == 0) {
+        result = glbBuildGenerateCode_C_FuncPointersDeclGlobal(context, 0, codeOut);
+    }
+    if (strcmp(tag, "/*<<opengl_funcpointers_decl_global:4>>*/") == 0) {
+        result = glbBuildGenerateCode_C_FuncPointersDeclGlobal(context, 4, codeOut);
+    }
+    if (strcmp(tag, "/*<<init_current_context_api>>*/") == 0) {
+        result = glbBuildGenerateCode_C_InitCurrentContextAPI(context, codeOut);
+    }
+    if (strcmp(tag, "/*<<profile>>*/") == 0) {
+        result = glbBuildGenerateCode_C_Profile(context, codeOut);
+    }
+    if (strcmp(tag, "/*<<proc_enum>>*/") == 0) {
+        result = glbBuildGenerateCode_C_ProcEnum(context, codeOut);
+    }
+    if (strcmp(tag, "/*<<extension_enum>>*/") == 0) {
+        result = glbBuildGenerateCode_C_ExtensionEnum(context, codeOut);
+    }
+    if (strcmp(tag, "/*<<extension_names>>*/") == 0) {
+        result = glbBuildGenerateCode_C_ExtensionNames(context, codeOut);
+    }
+    if (strcmp(tag, "/*<<require_lists>>*/") == 0) {
+        result = glbBuildGenerateCode_C_RequireLists(context, codeOut);
+    }
+    if (strcmp(tag, "/*<<lazy_trampolines>>*/") == 0) {
+        result = glbBuildGenerateCode_C_LazyTrampolines(context, codeOut);
+    }
+    if (strcmp(tag, "/*<<reset_lazy_trampolines>>*/") == 0) {
+        result = glbBuildGenerateCode_C_ResetLazyTrampolines(context, codeOut);
+    }
+    if (strcmp(tag, "/*<<tls_dispatch_decl>>*/") == 0) {
+        result = glbBuildGenerateCode_C_TLSDispatch(context, true, codeOut);
+    }
+    if (strcmp(tag, "/*<<tls_dispatch>>*/") == 0) {
+        result = glbBuildGenerateCode_C_TLSDispatch(context, false, codeOut);
+    }
+    if (strcmp(tag, "/*<<set_global_api_from_struct>>*/") == 0) {
+        result = glbBuildGenerateCode_C_SetGlobalAPIFromStruct(context, codeOut);
+    }
+    if (strcmp(tag, "/*<<capability_flags_decl_global>>*/") == 0) {
+        result = glbBuildGenerateCode_C_CapabilityFlagsDecl(context, 0, codeOut);
+    }
+    if (strcmp(tag, "/*<<capability_flags_decl_global:4>>*/") == 0) {
+        result = glbBuildGenerateCode_C_CapabilityFlagsDecl(context, 4, codeOut);
+    }
+    if (strcmp(tag, "/*<<set_capability_flags>>*/") == 0) {
+        result = glbBuildGenerateCode_C_SetCapabilityFlags(context, codeOut);
+    }
+    if (strcmp(tag, "/*<<set_global_capability_flags_from_struct>>*/") == 0) {
+        result = glbBuildGenerateCode_C_SetGlobalCapabilityFlagsFromStruct(context, codeOut);
+    }
+    if (strcmp(tag, "/*<<stub_proc_enum>>*/") == 0) {
+        result = glbBuildGenerateCode_C_StubProcEnum(context, codeOut);
+    }
+    if (strcmp(tag, "/*<<stub_procs>>*/") == 0) {
+        result = glbBuildGenerateCode_C_StubProcs(context, codeOut);
+    }
+    if (strcmp(tag, "/*<<stub_proc_table>>*/") == 0) {
+        result = glbBuildGenerateCode_C_StubProcTable(context, codeOut);
+    }
+    if (strcmp(tag, "<<opengl_version>>") == 0) {
+        result = vkbBuildGenerateCode_C_OpenGLVersion(context, codeOut);
+    }
+    if (strcmp(tag, "<<revision>>") == 0) {
+        result = glbBuildGenerateCode_C_Revision(context, codeOut);
+    }
+    if (strcmp(tag, "<<date>>") == 0) {
+        result = glbBuildGenerateCode_C_Date(context, codeOut);
+    }
+
+    return result;
+}
+
+// The X11 types that are renamed to glbind_<name> so that Xlib.h is not required. See the platform headers section of the template.
+static const char* g_X11TypeNames[] = {
+    "Display",
+    "Visual",
+    "VisualID",
+    "XVisualInfo",
+    "XSetWindowAttributes",
+    "XID",
+    "Window",
+    "Colormap",
+    "Pixmap",
+    "Font",
+    "Atom",
+    "Cursor",
+    "Bool",
+    "Status"
+};
+
+bool glbIsIdentifierChar(char c, bool isFirst)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || (!isFirst && c >= '0' && c <= '9');
+}
+
+/*
+Renames the X11 types in the generated code to our own names in a single pass. Only whole identifiers are renamed so that names like
+GLXWindow and glXCreateWindow are left alone. Comments and string and character literals are copied as-is. An identifier that is followed
+by its own glbind_ name is also left alone since that's how the template defines the glbind_ types in terms of the real ones:
+
+    typedef Display glbind_Display;
+*/
+void glbBuildReplaceX11Names(std::string &outputStr)
+{
+    const std::string prefix = "glbind_";
+    const char* src = outputStr.c_str();
+    size_t len = outputStr.size();
+    size_t i = 0;
+
+    std::string result;
+    result.reserve(len + len/32);
+
+    while (i < len) {
+        size_t beg = i;
+
+        if (src[i] == '/' && src[i+1] == '*') {
+            const char* end = strstr(src + i + 2, "*/");
+            i = (end != NULL) ? (size_t)(end - src) + 2 : len;
+        } else if (src[i] == '/' && src[i+1] == '/') {
+            while (i < len && src[i] != '\n') {
+                i += 1;
+            }
+        } else if (src[i] == '"' || src[i] == '\'') {
+            char quote = src[i];
+            i += 1;
+            while (i < len && src[i] != quote && src[i] != '\n') {
+                i += (src[i] == '\\' && i + 1 < len) ? 2 : 1;
+            }
+            i += (i < len && src[i] == quote) ? 1 : 0;
+        } else if (glbIsIdentifierChar(src[i], true)) {
+            while (i < len && glbIsIdentifierChar(src[i], false)) {
+                i += 1;
             }
-            counter += 1;
 
-            result = glbBuildGenerateCode_C_Main_Extension(context, extension, codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
+            for (auto x11TypeName : g_X11TypeNames) {
+                size_t nameLen = strlen(x11TypeName);
+                if (i - beg == nameLen && strncmp(src + beg, x11TypeName, nameLen) == 0) {
+                    size_t next = i;
+                    while (next < len && (src[next] == ' ' || src[next] == '\t')) {
+                        next += 1;
+                    }
+
+                    bool isAliasDefinition = strncmp(src + next, prefix.c_str(), prefix.size()) == 0 && strncmp(src + next + prefix.size(), x11TypeName, nameLen) == 0 && !glbIsIdentifierChar(src[next + prefix.size() + nameLen], false);
+                    if (!isAliasDefinition) {
+                        result += prefix;
+                        result.append(src + beg, i - beg);
+
+                        // Pointers are written as "glbind_Display*" rather than "glbind_Display *".
+                        if (next < len && src[next] == '*') {
+                            i = next;
+                        }
+
+                        beg = i;
+                    }
+
+                    break;
+                }
+            }
+        } else if (src[i] >= '0' && src[i] <= '9') {
+            // Numbers are skipped as a whole so that suffixes and hex digits are not mistaken for identifiers.
+            while (i < len && (glbIsIdentifierChar(src[i], false) || src[i] == '.')) {
+                i += 1;
             }
+        } else {
+            i += 1;
         }
+
+        result.append(src + beg, i - beg);
     }
-    codeOut += "#endif /* GLBIND_GLX */\n";
 
-    return GLB_SUCCESS;
+    outputStr.swap(result);
 }
+/*
+Generated files are streamed to disk as they're spliced together rather than being built up in memory first. The content goes to a
+temporary file next to the output and is compared line by line against the existing file as it's written. If it turns out to be the same,
+not counting the revision and date in the version line (glbind - vX.Y.Z - date) which change on every run, the temporary file is deleted
+and the existing file is left alone, version line and all, so that anything depending on it doesn't need to be rebuilt. Otherwise the
+temporary file replaces the existing file.
+*/
+#define GLB_OUTPUT_STREAM_BUFFER_SIZE   65536
+
+struct glbOutputStream
+{
+    std::string filePath;
+    std::string tempFilePath;
+    FILE* pFile;
+    uint64_t hash;
+    uint64_t size;
+    bool hasWriteFailed;
+
+    FILE* pExistingFile;                // Closed and set to NULL as soon as the content is known to be different.
+    std::vector<char> existingBuffer;
+    size_t existingCursor;
+    size_t existingSize;                // The number of valid characters in existingBuffer.
+    uint64_t existingHash;
+    uint64_t existingFileSize;
+    std::string line;                   // The line currently being written. It's compared once its new line character is written.
+    std::string existingLine;
+    bool hasSkippedVersionLine;
+};
 
-
-
-glbResult glbBuildGenerateCode_C_FuncPointersDeclGlobal_RequireCommands(glbBuild &context, int indentation, const glbRequire &require, std::vector<std::string> &processedCommands, std::string &codeOut)
+// Reads the next line of the existing file, including the new line character. Returns false at the end of the file.
+bool glbOutputStreamReadExistingLine(glbOutputStream &stream)
 {
-    glbResult result;
+    stream.existingLine.clear();
 
-    for (size_t iCommand = 0; iCommand < require.commands.size(); ++iCommand) {
-        std::string commandName = require.commands[iCommand];
-        if (!glbBuildIsCommandIgnored(commandName.c_str()) && std::find(processedCommands.begin(), processedCommands.end(), commandName) == processedCommands.end()) {
-            glbCommand* pCommand;
-            result = glbBuildFindCommand(context, require.commands[iCommand].c_str(), &pCommand);
-            if (result != GLB_SUCCESS) {
-                return result;
+    for (;;) {
+        if (stream.existingCursor == stream.existingSize) {
+            stream.existingCursor = 0;
+            stream.existingSize   = fread(stream.existingBuffer.data(), 1, stream.existingBuffer.size(), stream.pExistingFile);
+            if (stream.existingSize == 0) {
+                break;
             }
 
-            for (int i = 0; i < indentation; ++i) {
-                codeOut += " ";
-            }
-            codeOut += "PFN" + glbToUpper(pCommand->name) + "PROC " + pCommand->name + ";\n";
+            stream.existingHash      = glbHashData(stream.existingHash, stream.existingBuffer.data(), stream.existingSize);
+            stream.existingFileSize += stream.existingSize;
+        }
 
-            processedCommands.push_back(commandName);
+        const char* pBeg = stream.existingBuffer.data() + stream.existingCursor;
+        const char* pEnd = stream.existingBuffer.data() + stream.existingSize;
+        const char* pNewLine = (const char*)memchr(pBeg, '\n', pEnd - pBeg);
+        if (pNewLine != NULL) {
+            stream.existingLine.append(pBeg, pNewLine + 1);
+            stream.existingCursor += (pNewLine + 1) - pBeg;
+            return true;
         }
+
+        stream.existingLine.append(pBeg, pEnd);
+        stream.existingCursor = stream.existingSize;
     }
 
-    return GLB_SUCCESS;
+    return !stream.existingLine.empty();
 }
 
-glbResult glbBuildGenerateCode_C_FuncPointersDeclGlobal_Extension(glbBuild &context, int indentation, const glbExtension &extension, std::vector<std::string> &processedCommands, std::string &codeOut)
+// Compares the line that has just been written with the next line of the existing file.
+void glbOutputStreamCompareLine(glbOutputStream &stream)
 {
-    for (size_t iRequire = 0; iRequire < extension.requires.size(); ++iRequire) {
-        glbResult result = glbBuildGenerateCode_C_FuncPointersDeclGlobal_RequireCommands(context, indentation, extension.requires[iRequire], processedCommands, codeOut);
-        if (result != GLB_SUCCESS) {
-            return result;
-        }       
+    bool hasExistingLine = glbOutputStreamReadExistingLine(stream);
+
+    bool isSame;
+    if (!stream.hasSkippedVersionLine && glbContains(stream.line, "glbind - v")) {
+        isSame = hasExistingLine && glbContains(stream.existingLine, "glbind - v");
+        stream.hasSkippedVersionLine = true;
+    } else {
+        isSame = hasExistingLine && stream.line == stream.existingLine;
     }
 
-    return GLB_SUCCESS;
+    if (!isSame) {
+        fclose(stream.pExistingFile);
+        stream.pExistingFile = NULL;
+    }
+
+    stream.line.clear();
 }
 
-glbResult glbBuildGenerateCode_C_FuncPointersDeclGlobal_Feature(glbBuild &context, int indentation, const glbFeature &feature, std::vector<std::string> &processedCommands, std::string &codeOut)
+glbResult glbBuildOpenOutputStream(const std::string &filePath, glbOutputStream &stream)
 {
-    for (size_t iRequire = 0; iRequire < feature.requires.size(); ++iRequire) {
-        glbResult result = glbBuildGenerateCode_C_FuncPointersDeclGlobal_RequireCommands(context, indentation, feature.requires[iRequire], processedCommands, codeOut);
-        if (result != GLB_SUCCESS) {
-            return result;
-        }       
+    stream.filePath       = filePath;
+    stream.tempFilePath   = filePath + ".tmp";
+    stream.hash           = GLB_HASH_INIT;
+    stream.size           = 0;
+    stream.hasWriteFailed = false;
+
+    glbResult result = glbFOpen(stream.tempFilePath.c_str(), "wb", &stream.pFile);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    // It's fine for the file to not exist yet. It's just treated as being different.
+    if (glbFOpen(filePath.c_str(), "rb", &stream.pExistingFile) != GLB_SUCCESS) {
+        stream.pExistingFile = NULL;
     }
 
+    stream.existingBuffer.resize(GLB_OUTPUT_STREAM_BUFFER_SIZE);
+    stream.existingCursor        = 0;
+    stream.existingSize          = 0;
+    stream.existingHash          = GLB_HASH_INIT;
+    stream.existingFileSize      = 0;
+    stream.hasSkippedVersionLine = false;
+    stream.line.clear();
+    stream.existingLine.clear();
+
     return GLB_SUCCESS;
 }
 
-glbResult glbBuildGenerateCode_C_FuncPointersDeclGlobal(glbBuild &context, int indentation, std::string &codeOut)
+void glbBuildWriteOutputStream(glbOutputStream &stream, const char* pData, size_t dataSize)
 {
-    glbResult result;
-    std::vector<std::string> processedCommands;
-    bool isGlobalScope = (indentation == 0); // If the indentation is 0 it means we're generating the global symbols. Bit of a hack, but it works.
-
-    // GL features.
-    for (size_t iFeature = 0; iFeature < context.features.size(); ++iFeature) {
-        glbFeature &feature = context.features[iFeature];
-        if (feature.api == "gl") {
-            result = glbBuildGenerateCode_C_FuncPointersDeclGlobal_Feature(context, indentation, context.features[iFeature], processedCommands, codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }
-        }
+    if (dataSize == 0) {
+        return;
     }
 
-    // NOTE: Some headers define their own symbols for some APIs, such as the common WGL functions (wglCreateContext, etc.). This causes compiler errors
-    // so I'm working around this by simply not outputting them to global scope. We do, however, need these to be included in the GLBapi structure.
-
-    // WGL features.
-    if (!isGlobalScope) {
-        codeOut += "#if defined(GLBIND_WGL)\n";
-        for (size_t iFeature = 0; iFeature < context.features.size(); ++iFeature) {
-            glbFeature &feature = context.features[iFeature];
-            if (feature.api == "wgl") {
-                result = glbBuildGenerateCode_C_FuncPointersDeclGlobal_Feature(context, indentation, context.features[iFeature], processedCommands, codeOut);
-                if (result != GLB_SUCCESS) {
-                    return result;
-                }
-            }
-        }
-        codeOut += "#endif /* GLBIND_WGL */\n";
+    if (fwrite(pData, 1, dataSize, stream.pFile) != dataSize) {
+        stream.hasWriteFailed = true;
     }
 
-    codeOut += "#if defined(GLBIND_GLX)\n";
-    for (size_t iFeature = 0; iFeature < context.features.size(); ++iFeature) {
-        glbFeature &feature = context.features[iFeature];
-        if (feature.api == "glx") {
-            result = glbBuildGenerateCode_C_FuncPointersDeclGlobal_Feature(context, indentation, context.features[iFeature], processedCommands, codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }
-        }
-    }
-    codeOut += "#endif /* GLBIND_GLX */\n";
+    stream.hash  = glbHashData(stream.hash, pData, dataSize);
+    stream.size += dataSize;
 
-    // GL extensions.
-    for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
-        glbExtension &extension = context.extensions[iExtension];
-        if (!glbIsExtensionBlackListed(extension.name.c_str()) && (extension.supported == "gl" || glbContains(extension.supported, "gl|") || glbContains(extension.supported, "glcore"))) {
-            result = glbBuildGenerateCode_C_FuncPointersDeclGlobal_Extension(context, indentation, extension, processedCommands, codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }
+    // Once a difference has been found there's no need to keep comparing.
+    while (stream.pExistingFile != NULL) {
+        const char* pNewLine = (const char*)memchr(pData, '\n', dataSize);
+        if (pNewLine == NULL) {
+            stream.line.append(pData, dataSize);
+            break;
         }
-    }
 
-    // WGL extensions.
-    codeOut += "#if defined(GLBIND_WGL)\n";
-    for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
-        glbExtension &extension = context.extensions[iExtension];
-        if (!glbIsExtensionBlackListed(extension.name.c_str()) && glbContains(extension.supported, "wgl")) {
-            result = glbBuildGenerateCode_C_FuncPointersDeclGlobal_Extension(context, indentation, extension, processedCommands, codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }
-        }
-    }
-    codeOut += "#endif /* GLBIND_WGL */\n";
+        size_t lineLength = (pNewLine + 1) - pData;
+        stream.line.append(pData, lineLength);
+        glbOutputStreamCompareLine(stream);
 
-    // GLX extensions.
-    codeOut += "#if defined(GLBIND_GLX)\n";
-    for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
-        glbExtension &extension = context.extensions[iExtension];
-        if (!glbIsExtensionBlackListed(extension.name.c_str()) && glbContains(extension.supported, "glx")) {
-            result = glbBuildGenerateCode_C_FuncPointersDeclGlobal_Extension(context, indentation, extension, processedCommands, codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }
-        }
+        pData    += lineLength;
+        dataSize -= lineLength;
     }
-    codeOut += "#endif /* GLBIND_GLX */";
-
-    return GLB_SUCCESS;
 }
 
+void glbBuildWriteOutputStream(glbOutputStream &stream, const std::string &str)
+{
+    glbBuildWriteOutputStream(stream, str.data(), str.size());
+}
 
-glbResult glbBuildGenerateCode_C_InitCurrentContextAPI_RequireCommands(glbBuild &context, const glbRequire &require, std::vector<std::string> &processedCommands, std::string &codeOut)
+// Discards everything that's been written to the stream. The existing file is left alone.
+void glbBuildAbortOutputStream(glbOutputStream &stream)
 {
-    glbResult result;
+    if (stream.pExistingFile != NULL) {
+        fclose(stream.pExistingFile);
+        stream.pExistingFile = NULL;
+    }
 
-    for (size_t iCommand = 0; iCommand < require.commands.size(); ++iCommand) {
-        std::string commandName = require.commands[iCommand];
-        if (!glbBuildIsCommandIgnored(commandName.c_str()) && std::find(processedCommands.begin(), processedCommands.end(), commandName) == processedCommands.end()) {
-            glbCommand* pCommand;
-            result = glbBuildFindCommand(context, require.commands[iCommand].c_str(), &pCommand);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }
+    fclose(stream.pFile);
+    remove(stream.tempFilePath.c_str());
+}
 
-            codeOut += "    pAPI->" + pCommand->name + " = (PFN" + glbToUpper(pCommand->name) + "PROC)glbGetProcAddress(\"" + pCommand->name + "\");\n";
+// Finishes writing the file, replacing the existing file if anything has changed, and adds it to the list of output files for the cache.
+glbResult glbBuildCloseOutputStream(glbBuild &context, glbOutputStream &stream)
+{
+    bool isSame = false;
+    if (stream.pExistingFile != NULL) {
+        // The last line might not end with a new line character.
+        if (!stream.line.empty()) {
+            glbOutputStreamCompareLine(stream);
+        }
 
-            processedCommands.push_back(commandName);
+        // The existing file can't have anything left over.
+        if (stream.pExistingFile != NULL) {
+            isSame = !glbOutputStreamReadExistingLine(stream);
+            fclose(stream.pExistingFile);
+            stream.pExistingFile = NULL;
         }
     }
 
-    return GLB_SUCCESS;
-}
+    if (fclose(stream.pFile) != 0 || stream.hasWriteFailed) {
+        remove(stream.tempFilePath.c_str());
+        return GLB_FAILED_TO_WRITE_FILE;
+    }
 
-glbResult glbBuildGenerateCode_C_InitCurrentContextAPI_Feature(glbBuild &context, const glbFeature &feature, std::vector<std::string> &processedCommands, std::string &codeOut)
-{
-    for (size_t iRequire = 0; iRequire < feature.requires.size(); ++iRequire) {
-        glbResult result = glbBuildGenerateCode_C_InitCurrentContextAPI_RequireCommands(context, feature.requires[iRequire], processedCommands, codeOut);
-        if (result != GLB_SUCCESS) {
-            return result;
+    glbOutputFile outputFile;
+    outputFile.filePath = stream.filePath;
+
+    if (isSame) {
+        remove(stream.tempFilePath.c_str());
+        outputFile.hash = glbHashFileSize(stream.existingHash, stream.existingFileSize);
+    } else {
+        remove(stream.filePath.c_str());    // rename() won't replace an existing file on Windows.
+        if (rename(stream.tempFilePath.c_str(), stream.filePath.c_str()) != 0) {
+            remove(stream.tempFilePath.c_str());
+            return GLB_FAILED_TO_WRITE_FILE;
         }
+
+        outputFile.hash = glbHashFileSize(stream.hash, stream.size);
     }
 
+    context.outputFiles.push_back(outputFile);
+
     return GLB_SUCCESS;
 }
 
-glbResult glbBuildGenerateCode_C_InitCurrentContextAPI_Extension(glbBuild &context, const glbExtension &extension, std::vector<std::string> &processedCommands, std::string &codeOut)
+// Writes a generated file that's already in memory, but only if it has changed.
+glbResult glbBuildWriteOutputFile(glbBuild &context, const std::string &filePath, const std::string &content)
 {
-    for (size_t iRequire = 0; iRequire < extension.requires.size(); ++iRequire) {
-        glbResult result = glbBuildGenerateCode_C_InitCurrentContextAPI_RequireCommands(context, extension.requires[iRequire], processedCommands, codeOut);
-        if (result != GLB_SUCCESS) {
-            return result;
-        }
+    glbOutputStream stream;
+    glbResult result = glbBuildOpenOutputStream(filePath, stream);
+    if (result != GLB_SUCCESS) {
+        return result;
     }
 
-    return GLB_SUCCESS;
+    glbBuildWriteOutputStream(stream, content);
+
+    return glbBuildCloseOutputStream(context, stream);
 }
 
-glbResult glbBuildGenerateCode_C_InitCurrentContextAPI(glbBuild &context, std::string &codeOut)
+/*
+Replaces every tag in the template with generated code, renames the X11 types (see glbBuildReplaceX11Names()) and writes the result to
+the output stream. Tags that have already been replaced by the caller are skipped.
+
+The tags are independent of each other so they're generated at the same time, each into its own buffer, by a pool of threads. They're
+claimed in the order they appear in the template. The calling thread renames the X11 types in the template and then writes it out,
+splicing in the code for each tag as soon as it's ready and freeing it after its last use. While it's waiting for a tag it generates the
+next unclaimed one itself, so when there are no other threads each tag is generated just before it's needed and the output is never held
+in memory in its entirety. Generating the code only reads from the context, with the exception of the opengl_main tag which is the only
+user of outputTypes and outputCommands.
+*/
+glbResult glbBuildGenerateCodeFromTemplate(glbBuild &context, std::string &templateStr, glbOutputStream &stream)
 {
-    glbResult result;
-    std::vector<std::string> processedCommands;
+    // There will be a series of tags that we need to replace with generated code.
+    const char* tags[] = {
+        "/*<<opengl_main>>*/",
+        "/*<<profile>>*/",
+        "/*<<opengl_funcpointers_decl_global>>*/",
+        "/*<<opengl_funcpointers_decl_global:4>>*/",
+        "/*<<proc_enum>>*/",
+        "/*<<extension_enum>>*/",
+        "/*<<init_current_context_api>>*/",
+        "/*<<extension_names>>*/",
+        "/*<<require_lists>>*/",
+        "/*<<lazy_trampolines>>*/",
+        "/*<<reset_lazy_trampolines>>*/",
+        "/*<<tls_dispatch_decl>>*/",
+        "/*<<tls_dispatch>>*/",
+        "/*<<set_global_api_from_struct>>*/",
+        "/*<<capability_flags_decl_global>>*/",
+        "/*<<capability_flags_decl_global:4>>*/",
+        "/*<<set_capability_flags>>*/",
+        "/*<<set_global_capability_flags_from_struct>>*/",
+        "/*<<stub_proc_enum>>*/",
+        "/*<<stub_procs>>*/",
+        "/*<<stub_proc_table>>*/",
+        "<<opengl_version>>",
+        "<<revision>>",
+        "<<date>>",
+    };
 
-    // GL features.
-    for (size_t iFeature = 0; iFeature < context.features.size(); ++iFeature) {
-        glbFeature &feature = context.features[iFeature];
-        if (feature.api == "gl") {
-            result = glbBuildGenerateCode_C_InitCurrentContextAPI_Feature(context, context.features[iFeature], processedCommands, codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }
+    std::vector<std::pair<size_t, const char*>> firstOccurrences;
+    for (size_t iTag = 0; iTag < sizeof(tags)/sizeof(tags[0]); ++iTag) {
+        size_t pos = templateStr.find(tags[iTag]);
+        if (pos != std::string::npos) {
+            firstOccurrences.push_back(std::make_pair(pos, tags[iTag]));
         }
     }
 
-    // WGL features.
-    codeOut += "#if defined(GLBIND_WGL)\n";
-    for (size_t iFeature = 0; iFeature < context.features.size(); ++iFeature) {
-        glbFeature &feature = context.features[iFeature];
-        if (feature.api == "wgl") {
-            result = glbBuildGenerateCode_C_InitCurrentContextAPI_Feature(context, context.features[iFeature], processedCommands, codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }
-        }
+    std::sort(firstOccurrences.begin(), firstOccurrences.end());
+
+    std::vector<const char*> templateTags;
+    for (size_t iTag = 0; iTag < firstOccurrences.size(); ++iTag) {
+        templateTags.push_back(firstOccurrences[iTag].second);
     }
-    codeOut += "#endif /* GLBIND_WGL */\n";
 
-    // GLX features.
-    codeOut += "#if defined(GLBIND_GLX)\n";
-    for (size_t iFeature = 0; iFeature < context.features.size(); ++iFeature) {
-        glbFeature &feature = context.features[iFeature];
-        if (feature.api == "glx") {
-            result = glbBuildGenerateCode_C_InitCurrentContextAPI_Feature(context, context.features[iFeature], processedCommands, codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }
+    std::vector<std::string> generatedCode(templateTags.size());
+    std::vector<glbResult> results(templateTags.size(), GLB_SUCCESS);
+    std::vector<bool> isGenerated(templateTags.size(), false);     // Protected by the mutex.
+    std::mutex mutex;
+    std::condition_variable generatedCondition;
+    std::atomic<size_t> nextTag(0);
+
+    auto generateTag = [&](size_t iTag) {
+        results[iTag] = glbBuildGenerateCode_C(context, templateTags[iTag], generatedCode[iTag]);
+        if (results[iTag] == GLB_SUCCESS) {
+            glbBuildReplaceX11Names(generatedCode[iTag]);
         }
-    }
-    codeOut += "#endif /* GLBIND_GLX */\n";
 
+        std::lock_guard<std::mutex> lock(mutex);
+        isGenerated[iTag] = true;
+        generatedCondition.notify_all();
+    };
 
-    // GL extensions.
-    for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
-        glbExtension &extension = context.extensions[iExtension];
-        if (!glbIsExtensionBlackListed(extension.name.c_str()) && (extension.supported == "gl" || glbContains(extension.supported, "gl|") || glbContains(extension.supported, "glcore"))) {
-            result = glbBuildGenerateCode_C_InitCurrentContextAPI_Extension(context, extension, processedCommands, codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
+    auto generateTags = [&]() {
+        for (;;) {
+            size_t iTag = nextTag++;
+            if (iTag >= templateTags.size()) {
+                break;
             }
-        }
-    }
 
-    // WGL extensions.
-    codeOut += "#if defined(GLBIND_WGL)\n";
-    for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
-        glbExtension &extension = context.extensions[iExtension];
-        if (!glbIsExtensionBlackListed(extension.name.c_str()) && glbContains(extension.supported, "wgl")) {
-            result = glbBuildGenerateCode_C_InitCurrentContextAPI_Extension(context, extension, processedCommands, codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }
+            generateTag(iTag);
         }
+    };
+
+    size_t threadCount = std::min((size_t)std::max(std::thread::hardware_concurrency(), 1U), templateTags.size() + 1);
+
+    std::vector<std::thread> threads;
+    for (size_t iThread = 1; iThread < threadCount; ++iThread) {
+        threads.push_back(std::thread(generateTags));
     }
-    codeOut += "#endif /* GLBIND_WGL */\n";
 
-    // GLX extensions.
-    codeOut += "#if defined(GLBIND_GLX)\n";
-    for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
-        glbExtension &extension = context.extensions[iExtension];
-        if (!glbIsExtensionBlackListed(extension.name.c_str()) && glbContains(extension.supported, "glx")) {
-            result = glbBuildGenerateCode_C_InitCurrentContextAPI_Extension(context, extension, processedCommands, codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }
+    glbBuildReplaceX11Names(templateStr);
+
+    // Tags can be used more than once so every occurrence needs to be found. The code for a tag is freed after its last occurrence.
+    std::vector<std::pair<size_t, size_t>> occurrences;  // Position in the template and index of the tag.
+    for (size_t iTag = 0; iTag < templateTags.size(); ++iTag) {
+        size_t tagLength = strlen(templateTags[iTag]);
+        for (size_t pos = templateStr.find(templateTags[iTag]); pos != std::string::npos; pos = templateStr.find(templateTags[iTag], pos + tagLength)) {
+            occurrences.push_back(std::make_pair(pos, iTag));
         }
     }
-    codeOut += "#endif /* GLBIND_GLX */";
 
-    return GLB_SUCCESS;
-}
+    std::sort(occurrences.begin(), occurrences.end());
 
+    std::vector<size_t> lastOccurrences(templateTags.size());
+    for (size_t iOccurrence = 0; iOccurrence < occurrences.size(); ++iOccurrence) {
+        lastOccurrences[occurrences[iOccurrence].second] = iOccurrence;
+    }
 
-glbResult glbBuildGenerateCode_C_SetGlobalAPIFromStruct_RequireCommands(glbBuild &context, const glbRequire &require, std::vector<std::string> &processedCommands, std::string &codeOut)
-{
-    glbResult result;
+    glbResult result = GLB_SUCCESS;
+    size_t templatePos = 0;
+    for (size_t iOccurrence = 0; iOccurrence < occurrences.size(); ++iOccurrence) {
+        size_t pos  = occurrences[iOccurrence].first;
+        size_t iTag = occurrences[iOccurrence].second;
+
+        glbBuildWriteOutputStream(stream, templateStr.data() + templatePos, pos - templatePos);
+        templatePos = pos + strlen(templateTags[iTag]);
+
+        // Tags are claimed in order so this one will have been claimed by the time there's nothing left to claim.
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                if (isGenerated[iTag]) {
+                    break;
+                }
 
-    for (size_t iCommand = 0; iCommand < require.commands.size(); ++iCommand) {
-        std::string commandName = require.commands[iCommand];
-        if (!glbBuildIsCommandIgnored(commandName.c_str()) && std::find(processedCommands.begin(), processedCommands.end(), commandName) == processedCommands.end()) {
-            glbCommand* pCommand;
-            result = glbBuildFindCommand(context, require.commands[iCommand].c_str(), &pCommand);
-            if (result != GLB_SUCCESS) {
-                return result;
+                if (nextTag >= templateTags.size()) {
+                    generatedCondition.wait(lock, [&]() { return (bool)isGenerated[iTag]; });
+                    break;
+                }
+            }
+
+            size_t iNextTag = nextTag++;
+            if (iNextTag < templateTags.size()) {
+                generateTag(iNextTag);
             }
+        }
+
+        if (results[iTag] != GLB_SUCCESS) {
+            result = results[iTag];
+            nextTag = templateTags.size();  // Don't let the other threads start on anything else.
+            break;
+        }
 
-            codeOut += "    " + pCommand->name + " = pAPI->" + pCommand->name + ";\n";
+        glbBuildWriteOutputStream(stream, generatedCode[iTag]);
 
-            processedCommands.push_back(commandName);
+        if (lastOccurrences[iTag] == iOccurrence) {
+            std::string().swap(generatedCode[iTag]);
         }
     }
 
-    return GLB_SUCCESS;
+    if (result == GLB_SUCCESS) {
+        glbBuildWriteOutputStream(stream, templateStr.data() + templatePos, templateStr.size() - templatePos);
+    }
+
+    for (size_t iThread = 0; iThread < threads.size(); ++iThread) {
+        threads[iThread].join();
+    }
+
+    return result;
 }
 
-glbResult glbBuildGenerateCode_C_SetGlobalAPIFromStruct_Feature(glbBuild &context, const glbFeature &feature, std::vector<std::string> &processedCommands, std::string &codeOut)
+glbResult glbBuildGenerateOutputFile(glbBuild &context, const char* templateFilePath, const char* outputFilePath)
 {
-    for (size_t iRequire = 0; iRequire < feature.requires.size(); ++iRequire) {
-        glbResult result = glbBuildGenerateCode_C_SetGlobalAPIFromStruct_RequireCommands(context, feature.requires[iRequire], processedCommands, codeOut);
-        if (result != GLB_SUCCESS) {
-            return result;
-        }
+    // Before doing anything we need to grab the template.
+    size_t templateFileSize;
+    char* pTemplateFileData;
+    glbResult result = glbOpenAndReadTextFile(templateFilePath, &templateFileSize, &pTemplateFileData);
+    if (result != GLB_SUCCESS) {
+        return result;
     }
 
-    return GLB_SUCCESS;
+    std::string templateStr = pTemplateFileData;
+    free(pTemplateFileData);
+
+    glbOutputStream stream;
+    result = glbBuildOpenOutputStream(outputFilePath, stream);
+    if (result != GLB_SUCCESS) {
+        return result;
+    }
+
+    result = glbBuildGenerateCodeFromTemplate(context, templateStr, stream);
+    if (result != GLB_SUCCESS) {
+        glbBuildAbortOutputStream(stream);
+        return result;
+    }
+
+    return glbBuildCloseOutputStream(context, stream);
 }
 
-glbResult glbBuildGenerateCode_C_SetGlobalAPIFromStruct_Extension(glbBuild &context, const glbExtension &extension, std::vector<std::string> &processedCommands, std::string &codeOut)
+
+
+/*
+Split output. Instead of a single file, this writes the declarations from the opengl_main section to a set of smaller headers so that
+translation units can include only what they use:
+
+    glbind_types.h                 The platform detection and sized types from the top of the template, and every type from the registry.
+    glbind_core_X_Y.h              The enums and function pointer types for one OpenGL version. Each includes the one before it.
+    glbind_<extension>.h           The enums and function pointer types for one OpenGL extension.
+    glbind_wgl.h, glx.h and egl.h  The platform-specific versions and extensions.
+    glbind.h                       The umbrella header. It includes all of the above and is otherwise the same as the single file version.
+
+A function pointer type is only declared in the first header that requires it, in the same order as the single file version. Any later
+header that requires it includes that header instead. This avoids duplicate typedefs, which are not allowed before C11.
+*/
+struct glbSplitBlock
+{
+    std::string name;                       // The feature or extension name. Used for the #ifndef guard.
+    std::vector<glbRequire>* pRequires;
+};
+
+struct glbSplitHeader
 {
-    for (size_t iRequire = 0; iRequire < extension.requires.size(); ++iRequire) {
-        glbResult result = glbBuildGenerateCode_C_SetGlobalAPIFromStruct_RequireCommands(context, extension.requires[iRequire], processedCommands, codeOut);
-        if (result != GLB_SUCCESS) {
-            return result;
-        }
-    }
-
-    return GLB_SUCCESS;
-}
+    std::string fileName;
+    std::string platform;                   // GLBIND_WGL, GLBIND_GLX or GLBIND_EGL. Empty for OpenGL headers.
+    std::vector<std::string> includes;      // Headers other than glbind_types.h.
+    std::vector<glbSplitBlock> blocks;
+};
 
-glbResult glbBuildGenerateCode_C_SetGlobalAPIFromStruct(glbBuild &context, std::string &codeOut)
+void glbBuildGetSplitHeaders(glbBuild &context, std::vector<glbSplitHeader> &headersOut)
 {
-    glbResult result;
-    std::vector<std::string> processedCommands;
+    const char* platformAPIs[]   = {"wgl", "glx", "egl"};
+    const char* platformMacros[] = {"GLBIND_WGL", "GLBIND_GLX", "GLBIND_EGL"};
 
-    // GL features.
+    // OpenGL versions.
     for (size_t iFeature = 0; iFeature < context.features.size(); ++iFeature) {
         glbFeature &feature = context.features[iFeature];
         if (feature.api == "gl") {
-            result = glbBuildGenerateCode_C_SetGlobalAPIFromStruct_Feature(context, context.features[iFeature], processedCommands, codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
+            glbSplitHeader header;
+            header.fileName = "glbind_core_" + glbReplaceAll(feature.number, ".", "_") + ".h";
+            header.blocks.push_back({feature.name, &feature.requires});
+
+            if (!headersOut.empty()) {
+                header.includes.push_back(headersOut.back().fileName);
             }
+
+            headersOut.push_back(header);
+        }
+    }
+
+    // OpenGL extensions.
+    for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
+        glbExtension &extension = context.extensions[iExtension];
+        if (!glbIsExtensionBlackListed(extension.name.c_str()) && (extension.supported == "gl" || glbContains(extension.supported, "gl|") || glbContains(extension.supported, "glcore"))) {
+            glbSplitHeader header;
+            header.fileName = "glbind_" + extension.name + ".h";
+            header.blocks.push_back({extension.name, &extension.requires});
+            headersOut.push_back(header);
         }
     }
 
-    // WGL features.
+    // Platform-specific versions and extensions. These go into one header per platform.
+    for (size_t iPlatform = 0; iPlatform < sizeof(platformAPIs)/sizeof(platformAPIs[0]); ++iPlatform) {
+        glbSplitHeader header;
+        header.fileName = std::string("glbind_") + platformAPIs[iPlatform] + ".h";
+        header.platform = platformMacros[iPlatform];
 
-    // GLX features.
-    codeOut += "#if defined(GLBIND_GLX)\n";
-    for (size_t iFeature = 0; iFeature < context.features.size(); ++iFeature) {
-        glbFeature &feature = context.features[iFeature];
-        if (feature.api == "glx") {
-            result = glbBuildGenerateCode_C_SetGlobalAPIFromStruct_Feature(context, context.features[iFeature], processedCommands, codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
+        for (size_t iFeature = 0; iFeature < context.features.size(); ++iFeature) {
+            glbFeature &feature = context.features[iFeature];
+            if (feature.api == platformAPIs[iPlatform]) {
+                header.blocks.push_back({feature.name, &feature.requires});
             }
         }
-    }
-    codeOut += "#endif /* GLBIND_GLX */\n";
 
+        for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
+            glbExtension &extension = context.extensions[iExtension];
+            if (!glbIsExtensionBlackListed(extension.name.c_str()) && glbContains(extension.supported, platformAPIs[iPlatform])) {
+                header.blocks.push_back({extension.name, &extension.requires});
+            }
+        }
 
-    // GL extensions.
-    for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
-        glbExtension &extension = context.extensions[iExtension];
-        if (!glbIsExtensionBlackListed(extension.name.c_str()) && (extension.supported == "gl" || glbContains(extension.supported, "gl|") || glbContains(extension.supported, "glcore"))) {
-            result = glbBuildGenerateCode_C_SetGlobalAPIFromStruct_Extension(context, extension, processedCommands, codeOut);
-            if (result != GLB_SUCCESS) {
-                return result;
+        headersOut.push_back(header);
+    }
+
+    // Any function pointer type that has already been declared by an earlier header needs that header to be included.
+    std::unordered_map<std::string, size_t> commandOwners;
+    for (size_t iHeader = 0; iHeader < headersOut.size(); ++iHeader) {
+        glbSplitHeader &header = headersOut[iHeader];
+        for (size_t iBlock = 0; iBlock < header.blocks.size(); ++iBlock) {
+            const std::vector<glbRequire> &requires = *header.blocks[iBlock].pRequires;
+            for (size_t iRequire = 0; iRequire < requires.size(); ++iRequire) {
+                for (size_t iCommand = 0; iCommand < requires[iRequire].commands.size(); ++iCommand) {
+                    auto owner = commandOwners.emplace(requires[iRequire].commands[iCommand], iHeader).first;
+                    if (owner->second != iHeader) {
+                        const std::string &ownerFileName = headersOut[owner->second].fileName;
+                        if (std::find(header.includes.begin(), header.includes.end(), ownerFileName) == header.includes.end()) {
+                            header.includes.push_back(ownerFileName);
+                        }
+                    }
+                }
             }
         }
     }
+}
+
+glbResult glbBuildGenerateCode_C_SplitHeader(glbBuild &context, const glbSplitHeader &header, std::string &codeOut)
+{
+    std::string guard = "GLBIND_" + glbToUpper(glbReplaceAll(header.fileName.substr(7), ".", "_"));   // Skip the "glbind_" prefix.
+
+    codeOut += "/* This file was generated by glbind_build. See glbind.h for details and license. */\n";
+    codeOut += "#ifndef " + guard + "\n";
+    codeOut += "#define " + guard + "\n";
+    codeOut += "\n";
+    codeOut += "#include \"glbind_types.h\"\n";
+    for (size_t iInclude = 0; iInclude < header.includes.size(); ++iInclude) {
+        codeOut += "#include \"" + header.includes[iInclude] + "\"\n";
+    }
+    codeOut += "\n";
+    codeOut += "#ifdef __cplusplus\n";
+    codeOut += "extern \"C\" {\n";
+    codeOut += "#endif\n";
+    codeOut += "\n";
+
+    if (!header.platform.empty()) {
+        codeOut += "#if defined(" + header.platform + ")\n";
+    }
 
-    // WGL extensions.
-    codeOut += "#if defined(GLBIND_WGL)\n";
-    for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
-        glbExtension &extension = context.extensions[iExtension];
-        if (!glbIsExtensionBlackListed(extension.name.c_str()) && glbContains(extension.supported, "wgl")) {
-            result = glbBuildGenerateCode_C_SetGlobalAPIFromStruct_Extension(context, extension, processedCommands, codeOut);
+    for (size_t iBlock = 0; iBlock < header.blocks.size(); ++iBlock) {
+        const glbSplitBlock &block = header.blocks[iBlock];
+        std::vector<glbRequire> &requires = *block.pRequires;
+
+        if (iBlock > 0) {
+            codeOut += "\n";
+        }
+
+        codeOut += "#ifndef " + block.name + "\n";
+        codeOut += "#define " + block.name + " 1\n";
+        for (size_t iRequire = 0; iRequire < requires.size(); ++iRequire) {
+            glbResult result = glbBuildGenerateCode_C_Main_RequireEnums(context, requires[iRequire], codeOut);
             if (result != GLB_SUCCESS) {
                 return result;
             }
         }
-    }
-    codeOut += "#endif /* GLBIND_WGL */\n";
-
-    // GLX extensions.
-    codeOut += "#if defined(GLBIND_GLX)\n";
-    for (size_t iExtension = 0; iExtension < context.extensions.size(); ++iExtension) {
-        glbExtension &extension = context.extensions[iExtension];
-        if (!glbIsExtensionBlackListed(extension.name.c_str()) && glbContains(extension.supported, "glx")) {
-            result = glbBuildGenerateCode_C_SetGlobalAPIFromStruct_Extension(context, extension, processedCommands, codeOut);
+        for (size_t iRequire = 0; iRequire < requires.size(); ++iRequire) {
+            glbResult result = glbBuildGenerateCode_C_Main_RequireCommands(context, requires[iRequire], codeOut);
             if (result != GLB_SUCCESS) {
                 return result;
             }
         }
+        codeOut += "#endif /* " + block.name + " */\n";
     }
-    codeOut += "#endif /* GLBIND_GLX */";
-
-    return GLB_SUCCESS;
-}
-
-#include <time.h>
-glbResult glbBuildGenerateCode_C_Date(glbBuild &context, std::string &codeOut)
-{
-    (void)context;
 
-    time_t t = time(NULL);
+    if (!header.platform.empty()) {
+        codeOut += "#endif /* " + header.platform + " */\n";
+    }
 
-    char dateStr[32];
-#if defined(_MSC_VER)
-    struct tm local;
-    localtime_s(&local, &t);
-    strftime(dateStr, sizeof(dateStr), "%Y-%m-%d", &local);
-#else
-    struct tm *local = localtime(&t);
-    strftime(dateStr, sizeof(dateStr), "%Y-%m-%d", local);
-#endif
+    codeOut += "\n";
+    codeOut += "#ifdef __cplusplus\n";
+    codeOut += "}\n";
+    codeOut += "#endif\n";
+    codeOut += "#endif /* " + guard + " */\n";
 
-    codeOut += dateStr;
     return GLB_SUCCESS;
 }
 
-glbResult glbBuildGetOpenGLVersion(glbBuild &context, std::string &versionOut)
+glbResult glbBuildGenerateCode_C_SplitTypes(glbBuild &context, const std::string &preamble, const std::vector<glbSplitHeader> &headers, std::string &codeOut)
 {
-    // The version can be retrieved from the last "gl" feature section.
-    std::string versionStr;
-    for (auto feature : context.features) {
-        if (feature.api == "gl") {
-            versionStr = feature.number;
+    codeOut += "/* This file was generated by glbind_build. See glbind.h for details and license. */\n";
+    codeOut += "#ifndef GLBIND_TYPES_H\n";
+    codeOut += "#define GLBIND_TYPES_H\n";
+    codeOut += "\n";
+    codeOut += "#ifdef __cplusplus\n";
+    codeOut += "extern \"C\" {\n";
+    codeOut += "#endif\n";
+    codeOut += preamble;
+
+    // Every type goes in here, including the ones for the platform-specific headers. These need to be wrapped in the relevant platform check.
+    for (size_t iHeader = 0; iHeader < headers.size(); ++iHeader) {
+        const glbSplitHeader &header = headers[iHeader];
+        std::string types;
+
+        for (size_t iBlock = 0; iBlock < header.blocks.size(); ++iBlock) {
+            std::vector<glbRequire> &requires = *header.blocks[iBlock].pRequires;
+            for (size_t iRequire = 0; iRequire < requires.size(); ++iRequire) {
+                glbResult result = glbBuildGenerateCode_C_Main_RequireTypes(context, requires[iRequire], types);
+                if (result != GLB_SUCCESS) {
+                    return result;
+                }
+            }
+        }
+
+        if (!types.empty()) {
+            if (!header.platform.empty()) {
+                codeOut += "\n#if defined(" + header.platform + ")\n" + types + "#endif /* " + header.platform + " */\n";
+            } else {
+                codeOut += types;
+            }
         }
     }
 
-    versionOut = versionStr;
+    codeOut += "\n";
+    codeOut += "#ifdef __cplusplus\n";
+    codeOut += "}\n";
+    codeOut += "#endif\n";
+    codeOut += "#endif /* GLBIND_TYPES_H */\n";
 
     return GLB_SUCCESS;
 }
 
-glbResult vkbBuildGenerateCode_C_OpenGLVersion(glbBuild &context, std::string &codeOut)
+glbResult glbBuildGenerateSplitOutputFiles(glbBuild &context, const std::string &outputDirectory)
 {
-    std::string version;
-    glbResult result = glbBuildGetOpenGLVersion(context, version);
+    size_t templateFileSize;
+    char* pTemplateFileData;
+    glbResult result = glbOpenAndReadTextFile(GLB_BUILD_TEMPLATE_PATH, &templateFileSize, &pTemplateFileData);
     if (result != GLB_SUCCESS) {
         return result;
     }
 
-    codeOut += version;
+    std::string outputStr = pTemplateFileData;
+    free(pTemplateFileData);
 
-    return GLB_SUCCESS;
-}
+    // The preamble is everything between the opening of the extern "C" block and the opengl_main tag. This is moved to glbind_types.h.
+    size_t preambleBeg = outputStr.find("#endif\n", outputStr.find("extern \"C\" {"));
+    size_t preambleEnd = outputStr.find("/*<<opengl_main>>*/");
+    if (preambleBeg == std::string::npos || preambleEnd == std::string::npos) {
+        printf("Failed to find the preamble in the template.\n");
+        return GLB_ERROR;
+    }
+    preambleBeg += strlen("#endif\n");
 
-glbResult glbBuildGenerateCode_C_Revision(glbBuild &context, std::string &codeOut)
-{
-    // Rules for the revision number:
-    // 1) If the OpenGL version has changed, reset the revision to 0, otherwise increment by 1.
-    // 2) If glbind.h cannot be found, set to 0.
-    std::string revision;
+    std::string preamble = outputStr.substr(preambleBeg, preambleEnd - preambleBeg);
+    preamble = glbRTrim(preamble) + "\n";
 
-    size_t fileSize;
-    char* pFileData;
-    if (glbOpenAndReadTextFile("glbind.h", &fileSize, &pFileData) == GLB_SUCCESS) {
-        // We need to parse the previous version.
-        std::string prevVersionMajor;
-        std::string prevVersionMinor;
-        std::string prevVersionRevision;
-        const char* versionBeg = strstr((const char*)pFileData, "glbind - v");
-        if (versionBeg != NULL) {
-            versionBeg += strlen("glbind - v");
+    std::vector<glbSplitHeader> headers;
+    glbBuildGetSplitHeaders(context, headers);
 
-            std::string currentOpenGLVersion;
-            glbResult result = glbBuildGetOpenGLVersion(context, currentOpenGLVersion);
-            if (result != GLB_SUCCESS) {
-                return result;
-            }
+    std::string dir = outputDirectory;
+    if (!dir.empty() && dir.back() != '/' && dir.back() != '\\') {
+        dir += "/";
+    }
 
-            const char* cursorBeg = versionBeg;
-            const char* cursorEnd = versionBeg;
+    // Types first so that the sub-headers only contain enums and commands.
+    {
+        std::string types;
+        result = glbBuildGenerateCode_C_SplitTypes(context, preamble, headers, types);
+        if (result != GLB_SUCCESS) {
+            return result;
+        }
 
-            cursorEnd = strstr(cursorBeg, ".");
-            prevVersionMajor = std::string(cursorBeg, cursorEnd-cursorBeg);
-            cursorBeg = cursorEnd + 1;
+        glbBuildReplaceX11Names(types);
 
-            cursorEnd = strstr(cursorBeg, ".");
-            prevVersionMinor = std::string(cursorBeg, cursorEnd-cursorBeg);
-            cursorBeg = cursorEnd + 1;
+        result = glbBuildWriteOutputFile(context, dir + "glbind_types.h", types);
+        if (result != GLB_SUCCESS) {
+            printf("Failed to write %sglbind_types.h. Does the directory exist?\n", dir.c_str());
+            return result;
+        }
+    }
 
-            cursorEnd = strstr(cursorBeg, " ");
-            prevVersionRevision = std::string(cursorBeg, cursorEnd-cursorBeg);
-            cursorBeg = cursorEnd + 1;
+    std::string includes;
+    for (size_t iHeader = 0; iHeader < headers.size(); ++iHeader) {
+        std::string code;
+        result = glbBuildGenerateCode_C_SplitHeader(context, headers[iHeader], code);
+        if (result != GLB_SUCCESS) {
+            return result;
+        }
 
-            std::string previousOpenGLVersion = prevVersionMajor + "." + prevVersionMinor;
-            if (currentOpenGLVersion == previousOpenGLVersion) {
-                // OpenGL versions are the same, so increment.
-                revision = std::to_string(atoi(prevVersionRevision.c_str()) + 1);
-            } else {
-                // OpenGL versions are different, so reset.
-                revision = "0";
-            }
-        } else {
-            // Couldn't find the previous version.
-            revision = "0";
+        glbBuildReplaceX11Names(code);
+
+        result = glbBuildWriteOutputFile(context, dir + headers[iHeader].fileName, code);
+        if (result != GLB_SUCCESS) {
+            printf("Failed to write %s%s.\n", dir.c_str(), headers[iHeader].fileName.c_str());
+            return result;
         }
-    } else {
-        // vkbind.h was not found.
-        revision = "0";
+
+        includes += "#include \"" + headers[iHeader].fileName + "\"\n";
     }
 
-    codeOut += revision;
-    return GLB_SUCCESS;
-}
+    // The umbrella header.
+    outputStr.replace(preambleEnd, strlen("/*<<opengl_main>>*/"), includes);
+    outputStr.replace(preambleBeg, preambleEnd - preambleBeg, "\n#include \"glbind_types.h\"\n\n");
 
-glbResult glbBuildGenerateCode_C(glbBuild &context, const char* tag, std::string &codeOut)
-{
-    if (tag == NULL) {
-        return GLB_INVALID_ARGS;
+    glbOutputStream stream;
+    result = glbBuildOpenOutputStream(dir + "glbind.h", stream);
+    if (result != GLB_SUCCESS) {
+        return result;
     }
 
-    glbResult result = GLB_INVALID_ARGS;
-    if (strcmp(tag, "/*<<opengl_main>>*/") == 0) {
-        result = glbBuildGenerateCode_C_Main(context, codeOut);
-    }
-    if (strcmp(tag, "/*<<opengl_funcpointers_decl_global>>*/") == 0) {
-        result = glbBuildGenerateCode_C_FuncPointersDeclGlobal(context, 0, codeOut);
-    }
-    if (strcmp(tag, "/*<<opengl_funcpointers_decl_global:4>>*/") == 0) {
-        result = glbBuildGenerateCode_C_FuncPointersDeclGlobal(context, 4, codeOut);
-    }
-    if (strcmp(tag, "/*<<init_current_context_api>>*/") == 0) {
-        result = glbBuildGenerateCode_C_InitCurrentContextAPI(context, codeOut);
-    }
-    if (strcmp(tag, "/*<<set_global_api_from_struct>>*/") == 0) {
-        result = glbBuildGenerateCode_C_SetGlobalAPIFromStruct(context, codeOut);
-    }
-    if (strcmp(tag, "<<opengl_version>>") == 0) {
-        result = vkbBuildGenerateCode_C_OpenGLVersion(context, codeOut);
-    }
-    if (strcmp(tag, "<<revision>>") == 0) {
-        result = glbBuildGenerateCode_C_Revision(context, codeOut);
-    }
-    if (strcmp(tag, "<<date>>") == 0) {
-        result = glbBuildGenerateCode_C_Date(context, codeOut);
+    result = glbBuildGenerateCodeFromTemplate(context, outputStr, stream);
+    if (result != GLB_SUCCESS) {
+        glbBuildAbortOutputStream(stream);
+        return result;
     }
 
-    return result;
+    return glbBuildCloseOutputStream(context, stream);
 }
 
-glbResult glbBuildGenerateOutputFile(glbBuild &context, const char* outputFilePath)
+
+int main(int argc, char** argv)
 {
-    // Before doing anything we need to grab the template.
-    size_t templateFileSize;
-    char* pTemplateFileData;
-    glbResult result = glbOpenAndReadTextFile(GLB_BUILD_TEMPLATE_PATH, &templateFileSize, &pTemplateFileData);
-    if (result != GLB_SUCCESS) {
-        return result;
+    glbBuild context;
+    glbResult result;
+    std::string profile;
+    std::string outputFilePath = "glbind.h";
+    std::string splitDirectory;
+    std::string stubFilePath;
+    bool useCache = true;
+    glbSpec spec;
+
+    // Command line. Everything is optional.
+    //   --profile <core|compatibility>   The OpenGL profile to generate. The default is compatibility which includes everything. Overrides the spec file.
+    //   --spec <file>                    A spec file describing a trimmed down header. See glbSpec.
+    //   --output <file>                  Where to write the generated header. The default is glbind.h.
+    //   --split <directory>              Write a set of smaller headers to an existing directory instead. See glbSplitHeader.
+    //   --stub <file>                    Also write the source of a stub OpenGL library for testing. See glbind_stub_template.c.
+    //   --no-cache                       Don't read or write the cache. The output files are still only written when they have changed. See glbCache.
+    for (int iArg = 1; iArg < argc; ++iArg) {
+        if (strcmp(argv[iArg], "--profile") == 0 && iArg + 1 < argc) {
+            profile = argv[++iArg];
+        } else if (strcmp(argv[iArg], "--spec") == 0 && iArg + 1 < argc) {
+            result = glbBuildLoadSpecFile(argv[++iArg], spec);
+            if (result != GLB_SUCCESS) {
+                return result;
+            }
+        } else if (strcmp(argv[iArg], "--output") == 0 && iArg + 1 < argc) {
+            outputFilePath = argv[++iArg];
+        } else if (strcmp(argv[iArg], "--split") == 0 && iArg + 1 < argc) {
+            splitDirectory = argv[++iArg];
+        } else if (strcmp(argv[iArg], "--stub") == 0 && iArg + 1 < argc) {
+            stubFilePath = argv[++iArg];
+        } else if (strcmp(argv[iArg], "--no-cache") == 0) {
+            useCache = false;
+        } else {
+            printf("Unknown or incomplete argument \"%s\".\n", argv[iArg]);
+            return GLB_INVALID_ARGS;
+        }
     }
 
-    std::string outputStr = pTemplateFileData;
-    free(pTemplateFileData);
+    // Cache. The registry key covers everything that affects the parsed registry, and the output key everything that affects the output.
+    uint64_t registryKey = GLB_HASH_INIT;
+    registryKey = glbHashFile(registryKey, GLB_BUILD_SOURCE_PATH);
+    registryKey = glbHashFile(registryKey, GLB_BUILD_XML_PATH_GL);
+    registryKey = glbHashFile(registryKey, GLB_BUILD_XML_PATH_WGL);
+    registryKey = glbHashFile(registryKey, GLB_BUILD_XML_PATH_GLX);
+    registryKey = glbHashFile(registryKey, GLB_BUILD_XML_PATH_EGL);
+
+    uint64_t outputKey = registryKey;
+    outputKey = glbHashFile(outputKey, GLB_BUILD_TEMPLATE_PATH);
+    outputKey = glbHashString(outputKey, profile);
+    outputKey = glbHashString(outputKey, spec.api);
+    outputKey = glbHashString(outputKey, spec.version);
+    outputKey = glbHashString(outputKey, spec.profile);
+    for (size_t iExtension = 0; iExtension < spec.extensions.size(); ++iExtension) {
+        outputKey = glbHashString(outputKey, spec.extensions[iExtension]);
+    }
+    outputKey = glbHashString(outputKey, outputFilePath);
+    outputKey = glbHashString(outputKey, splitDirectory);
+    outputKey = glbHashString(outputKey, stubFilePath);
+    if (!stubFilePath.empty()) {
+        outputKey = glbHashFile(outputKey, GLB_BUILD_STUB_TEMPLATE_PATH);
+    }
 
-    // There will be a series of tags that we need to replace with generated code.
-    const char* tags[] = {
-        "/*<<opengl_main>>*/",
-        "/*<<opengl_funcpointers_decl_global>>*/",
-        "/*<<opengl_funcpointers_decl_global:4>>*/",
-        "/*<<init_current_context_api>>*/",
-        "/*<<set_global_api_from_struct>>*/",
-        "<<opengl_version>>",
-        "<<revision>>",
-        "<<date>>",
-    };
+    glbCache cache;
+    bool hasCache = useCache && glbBuildLoadCache(GLB_BUILD_CACHE_PATH, cache) == GLB_SUCCESS;
 
-    for (size_t iTag = 0; iTag < sizeof(tags)/sizeof(tags[0]); ++iTag) {
-        std::string generatedCode;
-        result = glbBuildGenerateCode_C(context, tags[iTag], generatedCode);
+    if (hasCache && cache.outputKey == outputKey && glbBuildAreCachedOutputsUnchanged(cache)) {
+        printf("Everything is up to date.\n");
+        return 0;
+    }
+
+    if (!hasCache || cache.registryKey != registryKey || glbCacheReadRegistry(context, cache.registry) != GLB_SUCCESS) {
+        context = glbBuild();   // In case the cache was only partially read.
+
+        result = glbBuildLoadRegistry(context);
         if (result != GLB_SUCCESS) {
             return result;
         }
 
-        glbReplaceAllInline(outputStr, tags[iTag], generatedCode);
-    }
-
-    /* Normalize all occurances of Display and then convert to our alternate name. */
-    glbReplaceAllInline(outputStr, "glbind_Display*", "Display*");
-    glbReplaceAllInline(outputStr, "Display *", "Display*");
-    glbReplaceAllInline(outputStr, "Display*", "glbind_Display*");
-
-    glbReplaceAllInline(outputStr, "glbind_XVisualInfo*", "XVisualInfo*");
-    glbReplaceAllInline(outputStr, "XVisualInfo *", "XVisualInfo*");
-    glbReplaceAllInline(outputStr, "XVisualInfo*", "glbind_XVisualInfo*");
-
-    glbReplaceAllInline(outputStr, "glbind_Visual*", "Visual*");
-    glbReplaceAllInline(outputStr, "Visual *", "Visual*");
-    glbReplaceAllInline(outputStr, "Visual*", "glbind_Visual*");
-
-    glbReplaceAllInline(outputStr, "glbind_XSetWindowAttributes*", "XSetWindowAttributes*");
-    glbReplaceAllInline(outputStr, "XSetWindowAttributes *", "XSetWindowAttributes*");
-    glbReplaceAllInline(outputStr, "XSetWindowAttributes*", "glbind_XSetWindowAttributes*");
-
-    glbReplaceAllInline(outputStr, "glbind_XID", "XID");
-    glbReplaceAllInline(outputStr, "XID ", "glbind_XID ");
-    glbReplaceAllInline(outputStr, " XID;", " glbind_XID;");
-    glbReplaceAllInline(outputStr, "[XID]", "[glbind_XID]");
-    glbReplaceAllInline(outputStr, "[glbind_XID]", "XID");
-
-    glbReplaceAllInline(outputStr, "glbind_Window", "Window");
-    glbReplaceAllInline(outputStr, "Window ", "glbind_Window ");
-    glbReplaceAllInline(outputStr, " Window;", " glbind_Window;");
-    glbReplaceAllInline(outputStr, "typedef glbind_Window", "typedef Window");
-    glbReplaceAllInline(outputStr, "GLXglbind_Window", "GLXWindow");
-    glbReplaceAllInline(outputStr, "glbind_Dummyglbind_Window", "glbind_DummyWindow");
-    glbReplaceAllInline(outputStr, "typedef Window   (", "typedef glbind_Window   (");
-    glbReplaceAllInline(outputStr, "glbind_XCreateglbind_Window", "glbind_XCreateWindow");
-    glbReplaceAllInline(outputStr, "glbind_XDestroyglbind_Window", "glbind_XDestroyWindow");
-    glbReplaceAllInline(outputStr, "glbind_XRootglbind_Window", "glbind_XRootWindow");
-    glbReplaceAllInline(outputStr, "glXCreateglbind_Window", "glXCreateWindow");
-    glbReplaceAllInline(outputStr, "glXDestroyglbind_Window", "glXDestroyWindow");
-    
-    glbReplaceAllInline(outputStr, "glbind_Colormap", "Colormap");
-    glbReplaceAllInline(outputStr, "Colormap ", "glbind_Colormap ");
-    glbReplaceAllInline(outputStr, " Colormap;", " glbind_Colormap;");
-    glbReplaceAllInline(outputStr, "typedef glbind_Colormap", "typedef Colormap");
-    glbReplaceAllInline(outputStr, "typedef Colormap (", "typedef glbind_Colormap (");
-    glbReplaceAllInline(outputStr, "glbind_XCreateglbind_Colormap", "glbind_XCreateColormap");
-    glbReplaceAllInline(outputStr, "glbind_XFreeglbind_Colormap", "glbind_XFreeColormap");
-    glbReplaceAllInline(outputStr, "glbind_Dummyglbind_Colormap", "glbind_DummyColormap");
-    glbReplaceAllInline(outputStr, "glbind_CWglbind_Colormap", "glbind_CWColormap");
-
-    glbReplaceAllInline(outputStr, "glbind_Pixmap", "Pixmap");
-    glbReplaceAllInline(outputStr, "Pixmap ", "glbind_Pixmap ");
-    glbReplaceAllInline(outputStr, " Pixmap;", " glbind_Pixmap;");
-    glbReplaceAllInline(outputStr, "typedef glbind_Pixmap", "typedef Pixmap");
-    glbReplaceAllInline(outputStr, "GLXglbind_Pixmap", "GLXPixmap");
-    glbReplaceAllInline(outputStr, "glXCreateglbind_Pixmap", "glXCreatePixmap");
-    glbReplaceAllInline(outputStr, "glXDestroyglbind_Pixmap", "glXDestroyPixmap");
-
-    glbReplaceAllInline(outputStr, "glbind_Font", "Font");
-    glbReplaceAllInline(outputStr, "Font ", "glbind_Font ");
-    glbReplaceAllInline(outputStr, " Font;", " glbind_Font;");
-    glbReplaceAllInline(outputStr, "typedef glbind_Font", "typedef Font");
-    glbReplaceAllInline(outputStr, "glXUseXglbind_Font", "glXUseXFont");
-
-    glbReplaceAllInline(outputStr, "glbind_Atom", "Atom");
-    glbReplaceAllInline(outputStr, "Atom ", "glbind_Atom ");
-    glbReplaceAllInline(outputStr, " Atom;", " glbind_Atom;");
-    glbReplaceAllInline(outputStr, "typedef glbind_Atom", "typedef Atom");
-
-    glbReplaceAllInline(outputStr, "glbind_Cursor", "Cursor");
-    glbReplaceAllInline(outputStr, "Cursor ", "glbind_Cursor ");
-    glbReplaceAllInline(outputStr, " Cursor;", " glbind_Cursor;");
-    glbReplaceAllInline(outputStr, "typedef glbind_Cursor", "typedef Cursor");
-
-    glbReplaceAllInline(outputStr, "glbind_Bool", "Bool");
-    glbReplaceAllInline(outputStr, "Bool ", "glbind_Bool ");
-    glbReplaceAllInline(outputStr, " Bool;", " glbind_Bool;");
-    glbReplaceAllInline(outputStr, "typedef glbind_Bool", "typedef Bool");
-    glbReplaceAllInline(outputStr, "typedef Bool (", "typedef glbind_Bool (");
-
-    glbReplaceAllInline(outputStr, "glbind_Status", "Status");
-    //glbReplaceAllInline(outputStr, "Status ", "glbind_Status ");
-    glbReplaceAllInline(outputStr, " Status;", " glbind_Status;");
-    glbReplaceAllInline(outputStr, "typedef glbind_Status", "typedef Status");
-    glbReplaceAllInline(outputStr, "typedef Status (", "typedef glbind_Status (");
-
-    glbOpenAndWriteTextFile(outputFilePath, outputStr.c_str());
-    return GLB_SUCCESS;
-}
-
+        cache.registryKey = registryKey;
+        cache.registry    = glbCacheWriteRegistry(context);
+    }
 
-int main(int argc, char** argv)
-{
-    glbBuild context;
-    glbResult result;
+    glbBuildIndexRegistry(context);
 
-    // GL
-    result = glbBuildLoadXMLFile(context, GLB_BUILD_XML_PATH_GL);
+    // Spec and profile. This needs to be done after everything has been loaded, but before any code is generated.
+    result = glbBuildApplySpec(context, spec);
     if (result != GLB_SUCCESS) {
         return result;
     }
-    
-    // WGL
-    result = glbBuildLoadXMLFile(context, GLB_BUILD_XML_PATH_WGL);
+
+    if (profile.empty()) {
+        profile = !spec.profile.empty() ? spec.profile : "compatibility";
+    }
+
+    result = glbBuildApplyProfile(context, profile);
     if (result != GLB_SUCCESS) {
         return result;
     }
 
-    // GLX
-    result = glbBuildLoadXMLFile(context, GLB_BUILD_XML_PATH_GLX);
+    result = glbBuildResolveCommands(context);
     if (result != GLB_SUCCESS) {
         return result;
     }
@@ -1856,14 +4685,33 @@ int main(int argc, char** argv)
 
 
     // Output file.
-    result = glbBuildGenerateOutputFile(context, "glbind.h");
+    if (!splitDirectory.empty()) {
+        result = glbBuildGenerateSplitOutputFiles(context, splitDirectory);
+    } else {
+        result = glbBuildGenerateOutputFile(context, GLB_BUILD_TEMPLATE_PATH, outputFilePath.c_str());
+    }
     if (result != GLB_SUCCESS) {
         printf("Failed to generate output file.\n");
         return (int)result;
     }
 
+    if (!stubFilePath.empty()) {
+        result = glbBuildGenerateOutputFile(context, GLB_BUILD_STUB_TEMPLATE_PATH, stubFilePath.c_str());
+        if (result != GLB_SUCCESS) {
+            printf("Failed to generate the stub library.\n");
+            return (int)result;
+        }
+    }
+
+    if (useCache) {
+        cache.outputKey = outputKey;
+        cache.outputs   = context.outputFiles;
+
+        if (glbBuildSaveCache(GLB_BUILD_CACHE_PATH, cache) != GLB_SUCCESS) {
+            printf("Failed to save the cache to %s.\n", GLB_BUILD_CACHE_PATH);   // Not an error. It'll just be slower next time.
+        }
+    }
+
     // Getting here means we're done.
-    (void)argc;
-    (void)argv;
     return 0;
 }
\ No newline at end of file
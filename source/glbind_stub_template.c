@@ -0,0 +1,492 @@
+/*
+A stub OpenGL library for testing and benchmarking glbind without a GPU or an X server. This file is generated by glbind_build from
+source/glbind_stub_template.c with --stub. Don't edit it directly.
+
+Build it as a shared library called libGL.so.1, with hidden visibility by default, and put it in front of the real one with
+LD_LIBRARY_PATH. The only functions it exports are the GLX functions used by glbInit() and the glbStub*() functions below.
+glXGetProcAddress() returns a no-op for every command in the registry, which does nothing except count how many times it's been called.
+Since nothing else is exported, commands that glXGetProcAddress() returns NULL for can't be found with dlsym() either.
+
+There's no X server so the application needs to give glbInit() a display and a context in GLBconfig. These are never dereferenced so they
+can be any non-null value:
+
+    config.pDisplay = (glbind_Display*)&dummy;
+    config.rc       = (GLXContext)&dummy;
+    config.drawable = 1;
+
+What the context supports is set with these environment variables, or with the glbStub*() functions which take precedence:
+
+    GLBIND_STUB_VERSION           The OpenGL version, such as "3.3". The default is the latest version in the registry.
+    GLBIND_STUB_EXTENSIONS        The OpenGL extensions separated by spaces. The default is none.
+    GLBIND_STUB_GLX_EXTENSIONS    The GLX extensions separated by spaces. The default is none.
+    GLBIND_STUB_NULL_PROCS        The commands glXGetProcAddress() returns NULL for, separated by spaces. Use "*" for every command.
+
+The settings and counters start over each time the library is loaded, and glbUninit() unloads it. The settings are freed by a destructor
+when it's unloaded so that the stub doesn't add leaks of its own to tests run under a leak checker. None of this is thread-safe.
+*/
+#define GLBIND_TLS_DISPATCH     /* Declares the global names as functions rather than function pointers so they can be defined here. */
+#include "glbind.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(GLBIND_GLX)
+#error "The stub library is only implemented for GLX."
+#endif
+
+#if defined(__GNUC__)
+    #define GLB_STUB_EXPORT __attribute__((visibility("default")))
+    #define GLB_STUB_DESTRUCTOR __attribute__((destructor))
+    #pragma GCC diagnostic ignored "-Wunused-parameter"     /* The no-ops don't use any of their parameters. */
+#else
+    #define GLB_STUB_EXPORT
+    #define GLB_STUB_DESTRUCTOR
+#endif
+
+#define GLB_STUB_DEFAULT_VERSION    "<<opengl_version>>"
+
+/* glGetStringi() was added in OpenGL 3.0 so it won't exist in headers that were generated for an older maximum version. */
+#if !defined(GLBIND_GL_VERSION_MAX_MAJOR) || GLBIND_GL_VERSION_MAX_MAJOR >= 3
+#define GLB_STUB_HAS_GET_STRINGI
+#endif
+
+typedef enum
+{
+/*<<stub_proc_enum>>*/
+    GLB_STUB_PROC_COUNT
+} glbStubProc;
+
+typedef struct
+{
+    const char* pName;
+    GLBproc proc;
+} glbStubProcEntry;
+
+static unsigned long g_glbStubCallCounts[GLB_STUB_PROC_COUNT];
+static unsigned long g_glbStubLookupCount = 0;
+
+#define GLB_STUB_CALL(proc) g_glbStubCallCounts[proc] += 1
+
+static GLboolean g_glbStubIsInitialized = GL_FALSE;
+static GLint g_glbStubMajorVersion = 0;
+static GLint g_glbStubMinorVersion = 0;
+static char g_glbStubVersionString[64];
+static char* g_glbStubExtensions = NULL;            /* Space separated, for glGetString(GL_EXTENSIONS). */
+static char* g_glbStubExtensionNames = NULL;        /* The same as g_glbStubExtensions, but with a null terminator after each name. */
+static const char** g_glbStubExtensionList = NULL;  /* Points into g_glbStubExtensionNames, for glGetStringi(). */
+static GLint g_glbStubExtensionCount = 0;
+static GLint g_glbStubProfileMask = 0;
+static GLint g_glbStubContextFlags = 0;
+static char* g_glbStubGLXExtensions = NULL;
+static char* g_glbStubNullProcs = NULL;
+
+/* The objects handed out by the GLX functions. Nothing is ever done with them. */
+static int g_glbStubContext;
+static int g_glbStubFBConfig;
+static GLXFBConfig g_glbStubFBConfigs[1] = {(GLXFBConfig)&g_glbStubFBConfig};
+static glbind_XVisualInfo g_glbStubVisualInfo;
+static glbind_Display* g_glbStubCurrentDisplay = NULL;
+static GLXDrawable g_glbStubCurrentDrawable = 0;
+static GLXContext g_glbStubCurrentContext = NULL;
+
+static char* glbStubCopyString(const char* pString)
+{
+    size_t length;
+    char* pCopy;
+
+    if (pString == NULL) {
+        pString = "";
+    }
+
+    length = strlen(pString);
+    pCopy = (char*)malloc(length + 1);
+    if (pCopy != NULL) {
+        memcpy(pCopy, pString, length + 1);
+    }
+
+    return pCopy;
+}
+
+/* Whether or not a name is in a list of names separated by spaces. "*" matches everything. */
+static GLboolean glbStubIsNameInList(const char* pName, const char* pList)
+{
+    size_t nameLength = strlen(pName);
+
+    while (pList != NULL && pList[0] != '\0') {
+        size_t length;
+
+        while (pList[0] == ' ') {
+            pList += 1;
+        }
+
+        length = 0;
+        while (pList[length] != '\0' && pList[length] != ' ') {
+            length += 1;
+        }
+
+        if ((length == 1 && pList[0] == '*') || (length == nameLength && strncmp(pList, pName, length) == 0)) {
+            return GL_TRUE;
+        }
+
+        pList += length;
+    }
+
+    return GL_FALSE;
+}
+
+static void glbStubInit(void);
+
+GLB_STUB_EXPORT void glbStubSetVersion(int majorVersion, int minorVersion)
+{
+    glbStubInit();
+
+    g_glbStubMajorVersion = majorVersion;
+    g_glbStubMinorVersion = minorVersion;
+
+    /* The version string is what glbind parses so it needs to look like a real one. */
+    sprintf(g_glbStubVersionString, "%d.%d glbind stub", majorVersion, minorVersion);
+}
+
+GLB_STUB_EXPORT void glbStubSetExtensions(const char* pExtensions)
+{
+    size_t i;
+    GLint iExtension;
+
+    glbStubInit();
+
+    free(g_glbStubExtensions);
+    free(g_glbStubExtensionNames);
+    free((void*)g_glbStubExtensionList);
+    g_glbStubExtensions     = glbStubCopyString(pExtensions);
+    g_glbStubExtensionNames = glbStubCopyString(pExtensions);
+    g_glbStubExtensionList  = NULL;
+    g_glbStubExtensionCount = 0;
+
+    if (g_glbStubExtensions == NULL || g_glbStubExtensionNames == NULL) {
+        return;
+    }
+
+    /* Split the names up for glGetStringi(). There can't be more names than there are characters. */
+    g_glbStubExtensionList = (const char**)malloc(sizeof(*g_glbStubExtensionList) * (strlen(g_glbStubExtensionNames) + 1));
+    if (g_glbStubExtensionList == NULL) {
+        return;
+    }
+
+    iExtension = 0;
+    for (i = 0; g_glbStubExtensionNames[i] != '\0'; ++i) {
+        if (g_glbStubExtensionNames[i] == ' ') {
+            g_glbStubExtensionNames[i] = '\0';
+        } else if (i == 0 || g_glbStubExtensionNames[i - 1] == '\0') {
+            g_glbStubExtensionList[iExtension] = g_glbStubExtensionNames + i;
+            iExtension += 1;
+        }
+    }
+
+    g_glbStubExtensionCount = iExtension;
+}
+
+GLB_STUB_EXPORT void glbStubSetGLXExtensions(const char* pExtensions)
+{
+    glbStubInit();
+
+    free(g_glbStubGLXExtensions);
+    g_glbStubGLXExtensions = glbStubCopyString(pExtensions);
+}
+
+/* What glGetIntegerv() returns for GL_CONTEXT_PROFILE_MASK and GL_CONTEXT_FLAGS. Both are zero by default. */
+GLB_STUB_EXPORT void glbStubSetContextProfile(int profileMask, int contextFlags)
+{
+    glbStubInit();
+
+    g_glbStubProfileMask  = profileMask;
+    g_glbStubContextFlags = contextFlags;
+}
+
+GLB_STUB_EXPORT void glbStubSetNullProcs(const char* pNames)
+{
+    glbStubInit();
+
+    free(g_glbStubNullProcs);
+    g_glbStubNullProcs = glbStubCopyString(pNames);
+}
+
+static void glbStubInit(void)
+{
+    const char* pVersion;
+    int majorVersion = 0;
+    int minorVersion = 0;
+
+    if (g_glbStubIsInitialized) {
+        return;
+    }
+
+    g_glbStubIsInitialized = GL_TRUE;
+
+    pVersion = getenv("GLBIND_STUB_VERSION");
+    if (pVersion == NULL || pVersion[0] == '\0') {
+        pVersion = GLB_STUB_DEFAULT_VERSION;
+    }
+
+    majorVersion = atoi(pVersion);
+    if (strchr(pVersion, '.') != NULL) {
+        minorVersion = atoi(strchr(pVersion, '.') + 1);
+    }
+
+    glbStubSetVersion(majorVersion, minorVersion);
+    glbStubSetExtensions(getenv("GLBIND_STUB_EXTENSIONS"));
+    glbStubSetGLXExtensions(getenv("GLBIND_STUB_GLX_EXTENSIONS"));
+    glbStubSetNullProcs(getenv("GLBIND_STUB_NULL_PROCS"));
+}
+
+/* Frees the settings when the library is unloaded. */
+GLB_STUB_DESTRUCTOR static void glbStubUninit(void)
+{
+    free(g_glbStubExtensions);
+    free(g_glbStubExtensionNames);
+    free((void*)g_glbStubExtensionList);
+    free(g_glbStubGLXExtensions);
+    free(g_glbStubNullProcs);
+
+    g_glbStubExtensions     = NULL;
+    g_glbStubExtensionNames = NULL;
+    g_glbStubExtensionList  = NULL;
+    g_glbStubExtensionCount = 0;
+    g_glbStubGLXExtensions  = NULL;
+    g_glbStubNullProcs      = NULL;
+    g_glbStubIsInitialized  = GL_FALSE;
+}
+
+/* The number of times a command has been called since the library was loaded or the counts were last reset. */
+GLB_STUB_EXPORT unsigned long glbStubGetCallCount(const char* pName);
+
+/* The number of times glXGetProcAddress() has been called since the library was loaded or the counts were last reset. */
+GLB_STUB_EXPORT unsigned long glbStubGetLookupCount(void)
+{
+    return g_glbStubLookupCount;
+}
+
+GLB_STUB_EXPORT void glbStubResetCounts(void)
+{
+    memset(g_glbStubCallCounts, 0, sizeof(g_glbStubCallCounts));
+    g_glbStubLookupCount = 0;
+}
+
+
+/* GLX. These are all exported because glbInit() retrieves them with dlsym(). */
+GLB_STUB_EXPORT glbind_XVisualInfo* APIENTRY glXChooseVisual(glbind_Display* dpy, int screen, int * attribList)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXChooseVisual);
+    return &g_glbStubVisualInfo;
+}
+
+GLB_STUB_EXPORT GLXContext APIENTRY glXCreateContext(glbind_Display* dpy, glbind_XVisualInfo* vis, GLXContext shareList, glbind_Bool direct)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXCreateContext);
+    return (GLXContext)&g_glbStubContext;
+}
+
+GLB_STUB_EXPORT GLXContext APIENTRY glXCreateNewContext(glbind_Display* dpy, GLXFBConfig config, int render_type, GLXContext share_list, glbind_Bool direct)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXCreateNewContext);
+    return (GLXContext)&g_glbStubContext;
+}
+
+GLB_STUB_EXPORT void APIENTRY glXDestroyContext(glbind_Display* dpy, GLXContext ctx)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXDestroyContext);
+}
+
+GLB_STUB_EXPORT glbind_Bool APIENTRY glXMakeCurrent(glbind_Display* dpy, GLXDrawable drawable, GLXContext ctx)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXMakeCurrent);
+
+    g_glbStubCurrentDisplay  = dpy;
+    g_glbStubCurrentDrawable = drawable;
+    g_glbStubCurrentContext  = ctx;
+
+    return 1;
+}
+
+GLB_STUB_EXPORT void APIENTRY glXSwapBuffers(glbind_Display* dpy, GLXDrawable drawable)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXSwapBuffers);
+}
+
+GLB_STUB_EXPORT GLXContext APIENTRY glXGetCurrentContext(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetCurrentContext);
+    return g_glbStubCurrentContext;
+}
+
+GLB_STUB_EXPORT glbind_Display* APIENTRY glXGetCurrentDisplay(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetCurrentDisplay);
+    return g_glbStubCurrentDisplay;
+}
+
+GLB_STUB_EXPORT GLXDrawable APIENTRY glXGetCurrentDrawable(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetCurrentDrawable);
+    return g_glbStubCurrentDrawable;
+}
+
+GLB_STUB_EXPORT const char * APIENTRY glXQueryExtensionsString(glbind_Display* dpy, int screen)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryExtensionsString);
+
+    glbStubInit();
+    return g_glbStubGLXExtensions;
+}
+
+GLB_STUB_EXPORT GLXFBConfig * APIENTRY glXChooseFBConfig(glbind_Display* dpy, int screen, const int * attrib_list, int * nelements)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXChooseFBConfig);
+
+    if (nelements != NULL) {
+        *nelements = 1;
+    }
+
+    return g_glbStubFBConfigs;
+}
+
+GLB_STUB_EXPORT glbind_XVisualInfo* APIENTRY glXGetVisualFromFBConfig(glbind_Display* dpy, GLXFBConfig config)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetVisualFromFBConfig);
+    return &g_glbStubVisualInfo;
+}
+
+GLB_STUB_EXPORT GLXPbuffer APIENTRY glXCreatePbuffer(glbind_Display* dpy, GLXFBConfig config, const int * attrib_list)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXCreatePbuffer);
+    return 1;
+}
+
+GLB_STUB_EXPORT void APIENTRY glXDestroyPbuffer(glbind_Display* dpy, GLXPbuffer pbuf)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXDestroyPbuffer);
+}
+
+GLB_STUB_EXPORT __GLXextFuncPtr APIENTRY glXGetProcAddress(const GLubyte * procName);
+
+/* Headers generated from a spec file don't necessarily include the extension. */
+#if defined(GLX_ARB_get_proc_address)
+GLB_STUB_EXPORT __GLXextFuncPtr APIENTRY glXGetProcAddressARB(const GLubyte * procName)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetProcAddressARB);
+    return glXGetProcAddress(procName);
+}
+#endif
+
+
+/* The queries glbind uses to find out what the context supports. */
+const GLubyte * APIENTRY glGetString(GLenum name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetString);
+
+    glbStubInit();
+
+    switch (name)
+    {
+        case GL_VENDOR:     return (const GLubyte*)"glbind";
+        case GL_RENDERER:   return (const GLubyte*)"glbind stub";
+        case GL_VERSION:    return (const GLubyte*)g_glbStubVersionString;
+        case GL_EXTENSIONS: return (const GLubyte*)g_glbStubExtensions;
+        default: return NULL;
+    }
+}
+
+#if defined(GLB_STUB_HAS_GET_STRINGI)
+const GLubyte * APIENTRY glGetStringi(GLenum name, GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetStringi);
+
+    glbStubInit();
+
+    if (name != GL_EXTENSIONS || index >= (GLuint)g_glbStubExtensionCount) {
+        return NULL;
+    }
+
+    return (const GLubyte*)g_glbStubExtensionList[index];
+}
+#endif
+
+void APIENTRY glGetIntegerv(GLenum pname, GLint * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetIntegerv);
+
+    glbStubInit();
+
+    switch (pname)
+    {
+    #if defined(GLB_STUB_HAS_GET_STRINGI)
+        case GL_MAJOR_VERSION:          *data = g_glbStubMajorVersion;   break;
+        case GL_MINOR_VERSION:          *data = g_glbStubMinorVersion;   break;
+        case GL_NUM_EXTENSIONS:         *data = g_glbStubExtensionCount; break;
+    #endif
+    #if defined(GL_CONTEXT_FLAGS)
+        case GL_CONTEXT_FLAGS:          *data = g_glbStubContextFlags;   break;
+    #endif
+    #if defined(GL_CONTEXT_PROFILE_MASK)
+        case GL_CONTEXT_PROFILE_MASK:   *data = g_glbStubProfileMask;    break;
+    #endif
+        default:                        *data = 0;                       break;
+    }
+}
+
+
+/* Everything else is a no-op. */
+/*<<stub_procs>>*/
+
+
+/* Sorted by name for glXGetProcAddress(). */
+static const glbStubProcEntry g_glbStubProcs[] = {
+/*<<stub_proc_table>>*/
+};
+
+static int glbStubCompareProcEntry(const void* pName, const void* pEntry)
+{
+    return strcmp((const char*)pName, ((const glbStubProcEntry*)pEntry)->pName);
+}
+
+static const glbStubProcEntry* glbStubFindProc(const char* pName)
+{
+    return (const glbStubProcEntry*)bsearch(pName, g_glbStubProcs, GLB_STUB_PROC_COUNT, sizeof(g_glbStubProcs[0]), glbStubCompareProcEntry);
+}
+
+GLB_STUB_EXPORT __GLXextFuncPtr APIENTRY glXGetProcAddress(const GLubyte * procName)
+{
+    const glbStubProcEntry* pEntry;
+
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetProcAddress);
+    g_glbStubLookupCount += 1;
+
+    glbStubInit();
+
+    if (procName == NULL || glbStubIsNameInList((const char*)procName, g_glbStubNullProcs)) {
+        return NULL;
+    }
+
+    pEntry = glbStubFindProc((const char*)procName);
+    if (pEntry == NULL) {
+        return NULL;
+    }
+
+    return (__GLXextFuncPtr)pEntry->proc;
+}
+
+GLB_STUB_EXPORT unsigned long glbStubGetCallCount(const char* pName)
+{
+    const glbStubProcEntry* pEntry;
+
+    if (pName == NULL) {
+        return 0;
+    }
+
+    pEntry = glbStubFindProc(pName);
+    if (pEntry == NULL) {
+        return 0;
+    }
+
+    return g_glbStubCallCounts[pEntry - g_glbStubProcs];
+}
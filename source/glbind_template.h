@@ -7,15 +7,21 @@ David Reid - davidreidsoftware@gmail.com
 
 #ifndef GLBIND_H
 #define GLBIND_H
-
+/*<<profile>>*/
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-/* For platform detection, I'm just assuming GLX if it's not Win32. Happy to look at making this more flexible, especially when it comes to GLES. */
+/*
+For platform detection, I'm just assuming GLX if it's not Win32. Happy to look at making this more flexible, especially when it comes to GLES.
+Define GLBIND_EGL to use EGL instead of GLX. This does not need an X server which makes it useful for headless rendering.
+*/
 #if defined(_WIN32)
+    #if defined(GLBIND_EGL)
+        #error "GLBIND_EGL is not supported on Win32."
+    #endif
     #define GLBIND_WGL
-#else
+#elif !defined(GLBIND_EGL)
     #define GLBIND_GLX
 #endif
 
@@ -93,6 +99,8 @@ single header, and that we can't just copy-and-paste the contents of khrplatform
     #endif
 #endif
 typedef float khronos_float_t;
+typedef khronos_uint64_t khronos_utime_nanoseconds_t;
+typedef khronos_int64_t  khronos_stime_nanoseconds_t;
 #endif  /* __khrplatform_h_ */
 
 /* Platform headers. */
@@ -109,7 +117,7 @@ typedef float khronos_float_t;
         typedef VisualID                glbind_VisualID;
         typedef XVisualInfo             glbind_XVisualInfo;
         typedef XSetWindowAttributes    glbind_XSetWindowAttributes;
-        typedef [XID]                     glbind_XID;
+        typedef XID                     glbind_XID;
         typedef Window                  glbind_Window;
         typedef Colormap                glbind_Colormap;
         typedef Pixmap                  glbind_Pixmap;
@@ -185,6 +193,25 @@ typedef float khronos_float_t;
         } glbind_XSetWindowAttributes;
     #endif
 #endif
+#if defined(GLBIND_EGL)
+    /*
+    The official EGL headers get these from eglplatform.h which pulls in the headers of the window system. We only need surfaceless and
+    pbuffer contexts so we just use the generic definitions instead.
+    */
+    #ifndef __eglplatform_h_
+        typedef void*             EGLNativeDisplayType;
+        typedef khronos_uintptr_t EGLNativePixmapType;
+        typedef khronos_uintptr_t EGLNativeWindowType;
+
+        typedef EGLNativeDisplayType NativeDisplayType;
+        typedef EGLNativePixmapType  NativePixmapType;
+        typedef EGLNativeWindowType  NativeWindowType;
+
+        typedef khronos_int32_t EGLint;
+
+        #define EGL_CAST(type, value) ((type) (value))
+    #endif
+#endif
 
 /*
 The official OpenGL headers have traditionally defined their APIs with APIENTRY, APIENTRYP and GLAPI. I'm including these just in case
@@ -204,21 +231,97 @@ some program wants to use them.
 
 /*<<opengl_main>>*/
 
+#if defined(GLBIND_LAZY) && defined(GLBIND_TLS_DISPATCH)
+#error "GLBIND_LAZY and GLBIND_TLS_DISPATCH cannot be used together."
+#endif
+
+#if defined(GLBIND_TLS_DISPATCH)
+/* In thread-local dispatch mode the global names are functions which forward to the API that is current on the calling thread. */
+/*<<tls_dispatch_decl>>*/
+#elif !defined(GLBIND_LAZY) || !defined(GLBIND_IMPLEMENTATION)
+/* In lazy mode the global function pointers are defined, with an initial value, by the implementation. */
 /*<<opengl_funcpointers_decl_global>>*/
+#endif
+
+/*<<capability_flags_decl_global>>*/
+
+/*<<proc_enum>>*/
+
+/*<<extension_enum>>*/
+
+typedef void (* GLBproc)(void);
+
+/*
+Retrieves a function by name for glbInitFromLoader(). pUserData is the pointer that was passed to glbInitFromLoader(). Return NULL if
+the function is unavailable.
+*/
+typedef GLBproc (* GLBloadproc)(const char* pName, void* pUserData);
 
 typedef struct
 {
+    /* The function pointers are laid out in the order of GLBprocIndex. Use GLB_PROCS() to access them as an array. */
 /*<<opengl_funcpointers_decl_global:4>>*/
+
+    /*
+    One bit for each extension in GLBextension that is supported by the context. This is filled out when the API is initialized so that
+    extensions can be checked without needing to call into the driver. Use glbIsExtensionSupportedByIndex() to check these.
+    */
+    GLubyte extensionSupportFlags[(GLB_EXTENSION_COUNT + 7) / 8];
+    GLboolean hasExtensionSupportFlags;
+
+    /*
+    Capability flags. GLB_GL_VERSION_X_Y is set if the context supports that version of OpenGL and GLB_HAS_<extension> is set if the context
+    supports that extension. These are set when the API is initialized and are bound to global scope with glbBindAPI().
+    */
+/*<<capability_flags_decl_global:4>>*/
 } GLBapi;
 
+/*
+Accesses the function pointers in a GLBapi object as an array of GLB_PROC_COUNT items, indexed with GLBprocIndex. This is useful for
+scanning or copying the whole table at once. GLB_PROC() retrieves a single function pointer by index, cast to the specified type:
+
+    PFNGLCLEARPROC pClear = GLB_PROC(&gl, GLB_PROC_glClear, PFNGLCLEARPROC);
+*/
+#define GLB_PROCS(pAPI)                 ((GLBproc*)(pAPI))
+#define GLB_PROC(pAPI, index, type)     ((type)GLB_PROCS(pAPI)[index])
+
+/* The profile to request for the internal rendering context. */
+typedef enum
+{
+    GLB_PROFILE_DEFAULT = 0,        /* Let the driver decide. This is the default. */
+    GLB_PROFILE_CORE,
+    GLB_PROFILE_COMPATIBILITY
+} GLBprofile;
+
+#if defined(GLBIND_GLX)
+/* The drawable the internal rendering context is made current with when it's created by glbInit(). */
+typedef enum
+{
+    GLB_DUMMY_DRAWABLE_WINDOW = 0,  /* A 1x1 window which is never mapped. This is the default. */
+    GLB_DUMMY_DRAWABLE_PBUFFER,     /* A 1x1 pbuffer. No window or colormap is created. */
+    GLB_DUMMY_DRAWABLE_NONE         /* No drawable at all. This needs GLX_ARB_create_context. Falls back to a pbuffer if it's unavailable. */
+} GLBdummyDrawable;
+#endif
+
 typedef struct
 {
     GLboolean singleBuffered;
+    GLint versionMajor;                 /* The version of OpenGL to request. Leave both at 0 for whatever the driver gives a legacy context. */
+    GLint versionMinor;
+    GLBprofile profile;                 /* Only meaningful for OpenGL 3.2 and newer. */
+    GLboolean debug;                    /* Creates a debug context. */
+    GLboolean noError;                  /* Creates a context with no error checking (KHR_no_error). Ignored if unsupported or if debug is set. */
 #if defined(GLBIND_WGL)
     HWND hWnd;
 #endif
 #if defined(GLBIND_GLX)
-    glbind_Display* pDisplay;
+    glbind_Display* pDisplay;           /* Optional. When null, glbInit() will open its own connection to the X server. */
+    GLXContext rc;                      /* Optional. When set, glbInit() will use this context instead of creating its own. Requires pDisplay. */
+    GLXDrawable drawable;               /* A valid drawable to make rc current with. None only works if rc was created with GLX_ARB_create_context. */
+    GLBdummyDrawable dummyDrawable;     /* The drawable to use when glbInit() creates its own context. */
+#endif
+#if defined(GLBIND_EGL)
+    EGLDisplay display;
 #endif
 } GLBconfig;
 
@@ -246,6 +349,19 @@ pointers are valid for that context.
 You can configure the internal rendering context by specifying a GLBconfig object. This can NULL in which case it will use
 defaults. Initialize the config object with glbConfigInit(). The default config creates a context with 32-bit color, 24-bit depth,
 8-bit stencil and double-buffered.
+
+Setting a version, profile, debug or noError in the config object will create the context with wglCreateContextAttribsARB(),
+glXCreateContextAttribsARB() or EGL_KHR_create_context. If these are unavailable, or the driver can't create the requested context,
+glbInit() will fail rather than silently fall back to a different kind of context. noError is only a hint and will be dropped if
+the driver does not support it.
+
+With GLX, the display and context in the config object are used instead of creating new ones if they are set. Such objects are
+not destroyed by glbUninit(). A context needs the display it was created on, and GL_INVALID_VALUE is returned if rc is set without
+pDisplay. Otherwise the internal rendering context is made current on a dummy window by default. Set
+dummyDrawable to GLB_DUMMY_DRAWABLE_PBUFFER or GLB_DUMMY_DRAWABLE_NONE to avoid creating a window.
+
+When GLBIND_LAZY is defined and pAPI is NULL, no APIs are retrieved here. Instead each global function pointer will retrieve the
+real function the first time it's called.
 */
 GLenum glbInit(GLBapi* pAPI, GLBconfig* pConfig);
 
@@ -253,6 +369,9 @@ GLenum glbInit(GLBapi* pAPI, GLBconfig* pConfig);
 Loads context-specific APIs into the specified API object.
 
 This does not bind these APIs to global scope. Use glbBindAPI() for this.
+
+The APIs are copied from the shared table of the context's driver (see glbGetSharedContextAPI()) so only the first context of each
+driver needs to retrieve them. Define GLBIND_NO_CONTEXT_API_CACHE to always retrieve them from scratch instead.
 */
 #if defined(GLBIND_WGL)
 GLenum glbInitContextAPI(HDC dc, HGLRC rc, GLBapi* pAPI);
@@ -260,14 +379,103 @@ GLenum glbInitContextAPI(HDC dc, HGLRC rc, GLBapi* pAPI);
 #if defined(GLBIND_GLX)
 GLenum glbInitContextAPI(glbind_Display* dpy, GLXDrawable drawable, GLXContext rc, GLBapi* pAPI);
 #endif
+#if defined(GLBIND_EGL)
+GLenum glbInitContextAPI(EGLDisplay dpy, EGLSurface surface, EGLContext rc, GLBapi* pAPI);
+#endif
+
+/*
+Retrieves a shared, read-only API object for the specified context.
+
+API objects are cached by driver, as identified by GL_VENDOR, GL_RENDERER and GL_VERSION, so every context with the same driver will
+share the same object and only the first one needs to retrieve anything. Contexts with a different profile or different flags, or on a
+different display or screen, get an object of their own since they can support different extensions. The returned object remains
+valid until the last call to glbUninit(). Returns NULL if the context could not be queried.
+*/
+#if defined(GLBIND_WGL)
+const GLBapi* glbGetSharedContextAPI(HDC dc, HGLRC rc);
+#endif
+#if defined(GLBIND_GLX)
+const GLBapi* glbGetSharedContextAPI(glbind_Display* dpy, GLXDrawable drawable, GLXContext rc);
+#endif
+#if defined(GLBIND_EGL)
+const GLBapi* glbGetSharedContextAPI(EGLDisplay dpy, EGLSurface surface, EGLContext rc);
+#endif
+
+/*
+Retrieves a shared, read-only API object for the current context. See glbGetSharedContextAPI().
+*/
+const GLBapi* glbGetSharedCurrentContextAPI(void);
 
 /*
 Loads context-specific APIs from the current context into the specified API object.
 
 This does not bind these APIs to global scope. Use glbBindAPI() for this.
+
+When GLBIND_LOAD_SUPPORTED_ONLY is defined, only the APIs belonging to the versions and extensions reported by the current context
+are loaded. Everything else will be left as NULL.
 */
 GLenum glbInitCurrentContextAPI(GLBapi* pAPI);
 
+/*
+Loads APIs into the specified API object using a loader supplied by the application, such as a wrapper around glfwGetProcAddress() or
+SDL_GL_GetProcAddress().
+
+This can be used without glbInit(). No libraries are loaded and no windows or contexts are created, and every function, including
+the platform-specific ones, is retrieved through pLoadProc. The application's context should be current so that its version and
+extensions can be queried. pUserData is passed through to pLoadProc untouched.
+
+This does not bind these APIs to global scope. Use glbBindAPI() for this. Since glbInit() is not required, glbUninit() should not be
+called unless glbInit() was also called.
+*/
+GLenum glbInitFromLoader(GLBloadproc pLoadProc, void* pUserData, GLBapi* pAPI);
+
+/*
+The phases of initialization which are timed by glbGetInitStats().
+*/
+typedef enum
+{
+    GLB_INIT_PHASE_LOAD_LIBRARIES = 0,  /* glbLoadOpenGLSO() and retrieving the platform functions with dlsym() or GetProcAddress(). */
+    GLB_INIT_PHASE_OPEN_DISPLAY,        /* XOpenDisplay(), eglGetDisplay() and eglInitialize(), or creating the dummy window with WGL. */
+    GLB_INIT_PHASE_CHOOSE_CONFIG,       /* glXChooseVisual(), glXChooseFBConfig(), eglChooseConfig() or ChoosePixelFormat(). */
+    GLB_INIT_PHASE_CREATE_CONTEXT,      /* Creating the context and its dummy drawable, and making it current. */
+    GLB_INIT_PHASE_LOAD_PROCS,          /* Retrieving every function pointer and the supported extensions, or copying them from the cache. */
+    GLB_INIT_PHASE_COUNT
+} GLBinitPhase;
+
+typedef struct
+{
+    double timeBeg;                     /* In seconds. Both are 0 if the phase was skipped. */
+    double timeEnd;                     /* 0 if initialization failed during this phase. */
+} GLBinitPhaseTimes;
+
+typedef struct
+{
+    GLenum result;                      /* What the call returned. */
+    double timeBeg;                     /* In seconds from an arbitrary point in time. */
+    double timeEnd;
+    GLBinitPhaseTimes phases[GLB_INIT_PHASE_COUNT];
+    GLuint lookupCount;                 /* The number of function pointers that were looked up by name. */
+    GLuint nullLookupCount;             /* The number of lookups that returned NULL. */
+    GLuint dlsymFallbackCount;          /* The number of lookups that fell back to dlsym() or GetProcAddress() because the driver returned NULL. */
+    GLboolean fromCache;                /* The APIs were copied from the shared table of the context's driver. See glbGetSharedContextAPI(). */
+} GLBinitStats;
+
+/*
+Retrieves timings and counters for the most recent call to glbInit(), glbInitContextAPI() or glbInitCurrentContextAPI(), whether
+or not it succeeded.
+
+Times are taken from a monotonic clock: QueryPerformanceCounter() on Windows and clock_gettime(CLOCK_MONOTONIC) elsewhere. The latter
+is only declared when POSIX features are enabled, so with something like -std=c89 and no _POSIX_C_SOURCE, gettimeofday() is used
+instead which can jump if the system time changes. Phases that are skipped, such as creating a context after the first call to
+glbInit(), are left at 0. Loaders supplied with glbInitFromLoader() aren't counted.
+*/
+void glbGetInitStats(GLBinitStats* pStats);
+
+/*
+Retrieves the name of an initialization phase, such as "loadLibraries", for reporting. Returns NULL if the phase is invalid.
+*/
+const char* glbGetInitPhaseName(GLBinitPhase phase);
+
 /*
 Uninitializes glbind.
 
@@ -277,9 +485,41 @@ void glbUninit(void);
 
 /*
 Binds the function pointers in pAPI to global scope.
+
+When GLBIND_TLS_DISPATCH is defined, pAPI is copied into an internal object which becomes the default API for every thread that has
+not set its own with glbSetCurrentAPI() or glbMakeCurrent(). The calling thread is also switched over to it.
 */
 GLenum glbBindAPI(const GLBapi* pAPI);
 
+#if defined(GLBIND_TLS_DISPATCH)
+/*
+Sets the API that the global names dispatch through on the calling thread. The API object is not copied so it must remain valid
+for as long as it's current. Passing NULL restores the API that was bound with glbBindAPI().
+*/
+void glbSetCurrentAPI(const GLBapi* pAPI);
+
+/*
+Retrieves the API that the global names dispatch through on the calling thread.
+*/
+const GLBapi* glbGetCurrentAPI(void);
+#endif
+
+/*
+Makes a context current on the calling thread and makes pAPI the API that is used for it.
+
+When GLBIND_TLS_DISPATCH is defined this just swaps the thread-local API pointer with glbSetCurrentAPI() after making the context
+current. Otherwise pAPI is bound to global scope with glbBindAPI(). If pAPI is NULL only the context is made current.
+*/
+#if defined(GLBIND_WGL)
+GLboolean glbMakeCurrent(HDC dc, HGLRC rc, const GLBapi* pAPI);
+#endif
+#if defined(GLBIND_GLX)
+GLboolean glbMakeCurrent(glbind_Display* dpy, GLXDrawable drawable, GLXContext rc, const GLBapi* pAPI);
+#endif
+#if defined(GLBIND_EGL)
+GLboolean glbMakeCurrent(EGLDisplay dpy, EGLSurface surface, EGLContext rc, const GLBapi* pAPI);
+#endif
+
 /* Platform-specific APIs. */
 #if defined(GLBIND_WGL)
 /*
@@ -313,21 +553,53 @@ in the config object, that Display will be returned.
 glbind_Display* glbGetDisplay(void);
 
 /*
-Retrieves the rendering context that was created on the first call to glbInit().
+Retrieves the rendering context that was created on the first call to glbInit(). If the context was set in the config object, that
+context will be returned.
 */
 GLXContext glbGetRC(void);
 
 /*
-Retrieves the color map that was created on the first call to glbInit().
+Retrieves the drawable the rendering context was made current with on the first call to glbInit(). This will be None if the context
+was made current without a drawable.
+*/
+GLXDrawable glbGetDrawable(void);
+
+/*
+Retrieves the color map that was created on the first call to glbInit(). This is only created when a dummy window is used.
 */
 Colormap glbGetColormap(void);
 
 /*
-Retrieves the framebuffer visual info that was created on the first call to glbInit().
+Retrieves the framebuffer visual info that was created on the first call to glbInit(). This will be null if the context was set in
+the config object.
 */
 XVisualInfo* glbGetFBVisualInfo(void);
 #endif
 
+#if defined(GLBIND_EGL)
+/*
+Retrieves the display that was initialized with the first call to glbInit(). If the display was set in the config object, that
+display will be returned.
+*/
+EGLDisplay glbGetDisplay(void);
+
+/*
+Retrieves the rendering context that was created on the first call to glbInit().
+*/
+EGLContext glbGetRC(void);
+
+/*
+Retrieves the surface the rendering context was made current with on the first call to glbInit(). This will be EGL_NO_SURFACE
+if the display supports EGL_KHR_surfaceless_context. Otherwise it will be a 1x1 pbuffer.
+*/
+EGLSurface glbGetSurface(void);
+
+/*
+Retrieves the framebuffer config that was used to create the rendering context on the first call to glbInit().
+*/
+EGLConfig glbGetConfig(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -335,13 +607,21 @@ XVisualInfo* glbGetFBVisualInfo(void);
 /*
 Helper API for checking if an extension is supported based on the current rendering context.
 
-This checks cross-platform extensions, WGL extensions and GLX extensions (in that order).
+This checks cross-platform extensions, then WGL, GLX or EGL extensions depending on the platform.
 
 pAPI is optional. If non-null, this relevant APIs from this object will be used. Otherwise, whatever is bound to global
 scope will be used.
 */
 GLboolean glbIsExtensionSupported(GLBapi* pAPI, const char* extensionName);
 
+/*
+Checks if an extension is supported using its index in GLBextension. This uses the flags that were cached when the API was initialized
+and does not call into the driver.
+
+pAPI is optional. If null, the flags of the API that was most recently bound to global scope will be used.
+*/
+GLboolean glbIsExtensionSupportedByIndex(GLBapi* pAPI, GLBextension extension);
+
 #endif  /* GLBIND_H */
 
 
@@ -355,13 +635,22 @@ GLboolean glbIsExtensionSupported(GLBapi* pAPI, const char* extensionName);
 #ifdef GLBIND_IMPLEMENTATION
 #if defined(GLBIND_WGL)
 #endif
-#if defined(GLBIND_GLX)
+#include <stddef.h> /* For offsetof(). */
+#include <stdlib.h> /* For malloc() and free(). */
+
+#if defined(GLBIND_GLX) || defined(GLBIND_EGL)
     #include <unistd.h>
     #include <dlfcn.h>
+    #include <time.h>       /* For clock_gettime(). */
+    #include <sys/time.h>   /* For gettimeofday() when clock_gettime() isn't declared. */
 #endif
 
 typedef void* GLBhandle;
-typedef void (* GLBproc)(void);
+
+/* glGetStringi() was added in OpenGL 3.0 so it won't exist in headers that were generated for an older maximum version. */
+#if !defined(GLBIND_GL_VERSION_MAX_MAJOR) || GLBIND_GL_VERSION_MAX_MAJOR >= 3
+#define GLBIND_HAS_GET_STRINGI
+#endif
 
 void glbZeroMemory(void* p, size_t sz)
 {
@@ -373,6 +662,41 @@ void glbZeroMemory(void* p, size_t sz)
 
 #define glbZeroObject(p) glbZeroMemory((p), sizeof(*(p)));
 
+int glb_strcmp(const char* s1, const char* s2)
+{
+    while ((*s1) && (*s1 == *s2)) {
+        ++s1;
+        ++s2;
+    }
+
+    return (*(unsigned char*)s1 - *(unsigned char*)s2);
+}
+
+size_t glb_strlen(const char* s)
+{
+    const char* end = s;
+    while (end[0] != '\0') {
+        end += 1;
+    }
+
+    return (size_t)(end - s);
+}
+
+int glb_strncmp(const char* s1, const char* s2, size_t n)
+{
+    while (n && *s1 && (*s1 == *s2)) {
+        ++s1;
+        ++s2;
+        --n;
+    }
+
+    if (n == 0) {
+        return 0;
+    } else {
+        return (*(unsigned char*)s1 - *(unsigned char*)s2);
+    }
+}
+
 GLBhandle glb_dlopen(const char* filename)
 {
 #ifdef _WIN32
@@ -408,9 +732,170 @@ GLBproc glb_dlsym(GLBhandle handle, const char* symbol)
 }
 
 
+GLboolean glbIsExtensionInString(const char* ext, const char* str)
+{
+    const char* ext2beg;
+    const char* ext2end;
+
+    if (ext == NULL || str == NULL) {
+        return GL_FALSE;
+    }
+
+    ext2beg = str;
+    ext2end = ext2beg;
+
+    for (;;) {
+        while (ext2end[0] != ' ' && ext2end[0] != '\0') {
+            ext2end += 1;
+        }
+
+        if (glb_strncmp(ext, ext2beg, ext2end - ext2beg) == 0 && ext[ext2end - ext2beg] == '\0') {
+            return GL_TRUE;
+        }
+
+        /* Break if we've reached the end. Otherwise, just move to start fo the next extension. */
+        if (ext2end[0] == '\0') {
+            break;
+        } else {
+            ext2beg = ext2end + 1;
+            ext2end = ext2beg;
+        }
+    }
+
+    return GL_FALSE;
+}
+
+
+void glbSpinLock(volatile long* pLock)
+{
+#if defined(GLBIND_WGL)
+    while (InterlockedExchange(pLock, 1) != 0) {
+    }
+#else
+    while (__sync_lock_test_and_set(pLock, 1) != 0) {
+    }
+#endif
+}
+
+void glbSpinUnlock(volatile long* pLock)
+{
+#if defined(GLBIND_WGL)
+    InterlockedExchange(pLock, 0);
+#else
+    __sync_lock_release(pLock);
+#endif
+}
+
+/* Seconds from an arbitrary point in time. */
+double glbGetMonotonicTime(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER counter;
+    LARGE_INTEGER frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1000000000.0;
+#elif defined(GLBIND_GLX) || defined(GLBIND_EGL)
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec + (double)tv.tv_usec / 1000000.0;
+#else
+    return 0;
+#endif
+}
+
+/*
+The stats of the most recent initialization. Each initialization records into its own object which is passed down to the loader as
+the user data of glbDefaultLoadProc(), and is only copied here at the end, because glbInitContextAPI() can be called on several
+threads at once.
+*/
+static GLBinitStats g_glbInitStats;
+static volatile long g_glbInitStatsLock = 0;
+
+void glbInitStatsBeg(GLBinitStats* pStats)
+{
+    glbZeroObject(pStats);
+    pStats->timeBeg = glbGetMonotonicTime();
+}
+
+void glbInitStatsEnd(GLBinitStats* pStats, GLenum result)
+{
+    pStats->result  = result;
+    pStats->timeEnd = glbGetMonotonicTime();
+
+    glbSpinLock(&g_glbInitStatsLock);
+    {
+        g_glbInitStats = *pStats;
+    }
+    glbSpinUnlock(&g_glbInitStatsLock);
+}
+
+void glbInitPhaseBeg(GLBinitStats* pStats, GLBinitPhase phase)
+{
+    if (pStats != NULL) {
+        pStats->phases[phase].timeBeg = glbGetMonotonicTime();
+    }
+}
+
+void glbInitPhaseEnd(GLBinitStats* pStats, GLBinitPhase phase)
+{
+    if (pStats != NULL) {
+        pStats->phases[phase].timeEnd = glbGetMonotonicTime();
+    }
+}
+
+void glbGetInitStats(GLBinitStats* pStats)
+{
+    if (pStats == NULL) {
+        return;
+    }
+
+    glbSpinLock(&g_glbInitStatsLock);
+    {
+        *pStats = g_glbInitStats;
+    }
+    glbSpinUnlock(&g_glbInitStatsLock);
+}
+
+const char* glbGetInitPhaseName(GLBinitPhase phase)
+{
+    switch (phase)
+    {
+        case GLB_INIT_PHASE_LOAD_LIBRARIES: return "loadLibraries";
+        case GLB_INIT_PHASE_OPEN_DISPLAY:   return "openDisplay";
+        case GLB_INIT_PHASE_CHOOSE_CONFIG:  return "chooseConfig";
+        case GLB_INIT_PHASE_CREATE_CONTEXT: return "createContext";
+        case GLB_INIT_PHASE_LOAD_PROCS:     return "loadProcs";
+        default: return NULL;
+    }
+}
+
+
 static unsigned int g_glbInitCount = 0;
 static GLBhandle g_glbOpenGLSO = NULL;
 
+#if defined(GLBIND_TLS_DISPATCH)
+    #if defined(_MSC_VER)
+        #define GLBIND_THREAD_LOCAL __declspec(thread)
+    #elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+        #define GLBIND_THREAD_LOCAL _Thread_local
+    #else
+        #define GLBIND_THREAD_LOCAL __thread
+    #endif
+
+/* The API bound with glbBindAPI(). Every thread dispatches through this one until it sets its own. */
+static GLBapi g_glbBoundAPI;
+static GLBIND_THREAD_LOCAL const GLBapi* glbind_pCurrentAPI = &g_glbBoundAPI;
+#endif
+
+/* The extension support flags of the API that was most recently bound to global scope with glbBindAPI(). */
+static GLubyte   g_glbExtensionSupportFlags[(GLB_EXTENSION_COUNT + 7) / 8];
+static GLboolean g_glbHasExtensionSupportFlags = GL_FALSE;
+
 #if defined(GLBIND_WGL)
 HWND  glbind_DummyHWND = 0;
 HDC   glbind_DC   = 0;
@@ -426,10 +911,20 @@ static LRESULT GLBIND_DummyWindowProcWin32(HWND hWnd, UINT msg, WPARAM wParam, L
 #if defined(GLBIND_GLX)
 glbind_Display*     glbind_pDisplay      = 0;
 glbind_Window       glbind_DummyWindow   = 0;
+GLXPbuffer          glbind_DummyPbuffer  = 0;
+GLXDrawable         glbind_DummyDrawable = 0;   /* The drawable glbind_RC is made current with. Either the dummy window, the dummy pbuffer or None. */
 GLXContext          glbind_RC            = 0;
 glbind_Colormap     glbind_DummyColormap = 0;
 glbind_XVisualInfo* glbind_pFBVisualInfo = 0;
 GLboolean           glbind_OwnsDisplay   = GL_FALSE;
+GLboolean           glbind_OwnsRC        = GL_FALSE;
+#endif
+#if defined(GLBIND_EGL)
+EGLDisplay glbind_EGLDisplay  = EGL_NO_DISPLAY;
+EGLSurface glbind_EGLSurface  = EGL_NO_SURFACE;
+EGLContext glbind_RC          = EGL_NO_CONTEXT;
+EGLConfig  glbind_EGLConfig   = 0;
+GLboolean  glbind_OwnsDisplay = GL_FALSE;
 #endif
 
 #if defined(GLBIND_WGL)
@@ -459,6 +954,9 @@ typedef GLXDrawable         (* GLB_PFNGLXGETCURRENTDRAWABLEPROC)   (void);
 typedef glbind_XVisualInfo* (* GLB_PFNGLXGETVISUALFROMFBCONFIGPROC)(glbind_Display* pDisplay, GLXFBConfig config);
 typedef GLXFBConfig*        (* GLB_PFNGLXCHOOSEFBCONFIGPROC)       (glbind_Display* pDisplay, int screen, const int* pAttribList, int* pCount);
 typedef GLBproc             (* GLB_PFNGLXGETPROCADDRESSPROC)       (const GLubyte* pName);
+typedef GLXContext          (* GLB_PFNGLXCREATENEWCONTEXTPROC)     (glbind_Display* pDisplay, GLXFBConfig config, int renderType, GLXContext shareList, glbind_Bool direct);
+typedef GLXPbuffer          (* GLB_PFNGLXCREATEPBUFFERPROC)        (glbind_Display* pDisplay, GLXFBConfig config, const int* pAttribList);
+typedef void                (* GLB_PFNGLXDESTROYPBUFFERPROC)       (glbind_Display* pDisplay, GLXPbuffer pbuffer);
 
 /* Declare our global functions using the types above. */
 GLB_PFNGLXCHOOSEVISUALPROC          glbind_glXChooseVisual;
@@ -473,6 +971,9 @@ GLB_PFNGLXGETCURRENTDRAWABLEPROC    glbind_glXGetCurrentDrawable;
 GLB_PFNGLXGETVISUALFROMFBCONFIGPROC glbind_glXGetVisualFromFBConfig;
 GLB_PFNGLXCHOOSEFBCONFIGPROC        glbind_glXChooseFBConfig;
 GLB_PFNGLXGETPROCADDRESSPROC        glbind_glXGetProcAddress;
+GLB_PFNGLXCREATENEWCONTEXTPROC      glbind_glXCreateNewContext;
+GLB_PFNGLXCREATEPBUFFERPROC         glbind_glXCreatePbuffer;
+GLB_PFNGLXDESTROYPBUFFERPROC        glbind_glXDestroyPbuffer;
 
 
 static GLBhandle g_glbX11SO = NULL;
@@ -484,6 +985,10 @@ typedef glbind_Colormap (* GLB_PFNXCREATECOLORMAPPROC)(glbind_Display* pDisplay,
 typedef int             (* GLB_PFNXFREECOLORMAPPROC)  (glbind_Display* pDisplay, glbind_Colormap colormap);
 typedef int             (* GLB_PFNXDEFAULTSCREENPROC) (glbind_Display* pDisplay);
 typedef glbind_Window   (* GLB_PFNXROOTWINDOWPROC)    (glbind_Display* pDisplay, int screenNumber);
+typedef int             (* GLB_PFNXFREEPROC)          (void* pData);
+typedef int             (* GLB_PFNXERRORHANDLERPROC)  (glbind_Display* pDisplay, void* pErrorEvent);
+typedef GLB_PFNXERRORHANDLERPROC (* GLB_PFNXSETERRORHANDLERPROC)(GLB_PFNXERRORHANDLERPROC handler);
+typedef int             (* GLB_PFNXSYNCPROC)          (glbind_Display* pDisplay, glbind_Bool discard);
 
 GLB_PFNXOPENDISPLAYPROC    glbind_XOpenDisplay;
 GLB_PFNXCLOSEDISPLAYPROC   glbind_XCloseDisplay;
@@ -493,9 +998,32 @@ GLB_PFNXCREATECOLORMAPPROC glbind_XCreateColormap;
 GLB_PFNXFREECOLORMAPPROC   glbind_XFreeColormap;
 GLB_PFNXDEFAULTSCREENPROC  glbind_XDefaultScreen;
 GLB_PFNXROOTWINDOWPROC     glbind_XRootWindow;
+GLB_PFNXFREEPROC           glbind_XFree;
+GLB_PFNXSETERRORHANDLERPROC glbind_XSetErrorHandler;
+GLB_PFNXSYNCPROC           glbind_XSync;
+#endif
+#if defined(GLBIND_EGL)
+static GLBhandle g_glbEGLSO = NULL;
+PFNEGLGETPROCADDRESSPROC        glbind_eglGetProcAddress;
+PFNEGLGETDISPLAYPROC            glbind_eglGetDisplay;
+PFNEGLGETPLATFORMDISPLAYEXTPROC glbind_eglGetPlatformDisplayEXT;
+PFNEGLINITIALIZEPROC            glbind_eglInitialize;
+PFNEGLTERMINATEPROC             glbind_eglTerminate;
+PFNEGLQUERYSTRINGPROC           glbind_eglQueryString;
+PFNEGLBINDAPIPROC               glbind_eglBindAPI;
+PFNEGLCHOOSECONFIGPROC          glbind_eglChooseConfig;
+PFNEGLCREATECONTEXTPROC         glbind_eglCreateContext;
+PFNEGLDESTROYCONTEXTPROC        glbind_eglDestroyContext;
+PFNEGLCREATEPBUFFERSURFACEPROC  glbind_eglCreatePbufferSurface;
+PFNEGLDESTROYSURFACEPROC        glbind_eglDestroySurface;
+PFNEGLMAKECURRENTPROC           glbind_eglMakeCurrent;
+PFNEGLGETCURRENTCONTEXTPROC     glbind_eglGetCurrentContext;
+PFNEGLGETCURRENTSURFACEPROC     glbind_eglGetCurrentSurface;
+PFNEGLGETCURRENTDISPLAYPROC     glbind_eglGetCurrentDisplay;
 #endif
 
-GLBproc glbGetProcAddress(const char* name)
+/* Looks up a function, counting it in pStats which can be NULL. */
+GLBproc glbGetProcAddressWithStats(const char* name, GLBinitStats* pStats)
 {
     GLBproc func = NULL;
 #if defined(GLBIND_WGL)
@@ -508,14 +1036,42 @@ GLBproc glbGetProcAddress(const char* name)
         func = (GLBproc)glbind_glXGetProcAddress((const GLubyte*)name);
     }
 #endif
+#if defined(GLBIND_EGL)
+    if (glbind_eglGetProcAddress) {
+        func = (GLBproc)glbind_eglGetProcAddress(name);
+    }
+#endif
 
     if (func == NULL) {
+        if (pStats != NULL) {
+            pStats->dlsymFallbackCount += 1;
+        }
+
         func = glb_dlsym(g_glbOpenGLSO, name);
     }
 
+#if defined(GLBIND_EGL)
+    /* The EGL APIs are not exported by the OpenGL library. */
+    if (func == NULL) {
+        func = glb_dlsym(g_glbEGLSO, name);
+    }
+#endif
+
+    if (pStats != NULL) {
+        pStats->lookupCount += 1;
+        if (func == NULL) {
+            pStats->nullLookupCount += 1;
+        }
+    }
+
     return func;
 }
 
+GLBproc glbGetProcAddress(const char* name)
+{
+    return glbGetProcAddressWithStats(name, NULL);
+}
+
 GLenum glbLoadOpenGLSO(void)
 {
     GLenum result;
@@ -525,6 +1081,10 @@ GLenum glbLoadOpenGLSO(void)
 #if defined(_WIN32)
         "OpenGL32.dll"
 #elif defined(__APPLE__)
+#elif defined(GLBIND_EGL)
+        "libOpenGL.so.0",   /* GLVND. Unlike libGL.so this does not depend on GLX. */
+        "libGL.so.1",
+        "libGL.so"
 #else
         "libGL.so.1",
         "libGL.so"
@@ -555,6 +1115,22 @@ GLenum glbLoadOpenGLSO(void)
             g_glbOpenGLSO = NULL;
             return GL_INVALID_OPERATION;
         }
+    #elif defined(GLBIND_EGL)
+        /* EGL */
+        const char* eglSONames[] = {
+            "libEGL.so.1",
+            "libEGL.so"
+        };
+
+        result = GL_INVALID_OPERATION;
+        for (i = 0; i < sizeof(eglSONames)/sizeof(eglSONames[0]); ++i) {
+            GLBhandle handle = glb_dlopen(eglSONames[i]);
+            if (handle != NULL) {
+                g_glbEGLSO = handle;
+                result = GL_NO_ERROR;
+                break;
+            }
+        }
     #elif defined(__APPLE_)
         /* Apple */
     #else
@@ -596,12 +1172,17 @@ void glbUnloadOpenGLSO(void)
         /* Win32 */
         glb_dlclose(g_glbGdi32DLL);
         g_glbGdi32DLL = NULL;
+    #elif defined(GLBIND_EGL)
+        /* EGL */
+        glb_dlclose(g_glbEGLSO);
+        g_glbEGLSO = NULL;
     #elif defined(__APPLE_)
         /* Apple */
     #else
         /* X11 */
         glb_dlclose(g_glbX11SO);
         g_glbX11SO = NULL;
+        glbind_XDefaultScreen = NULL;   /* Checked by the extension queries since it's only retrieved by glbInit(). */
     #endif
     }
 
@@ -609,6 +1190,422 @@ void glbUnloadOpenGLSO(void)
     g_glbOpenGLSO = NULL;
 }
 
+/*
+The attributes for creating a context with a specific version, profile or flags mean the same thing on each platform. Only their names
+are different.
+*/
+#if defined(GLBIND_WGL)
+typedef int glbind_ContextAttrib;
+#define GLBIND_CONTEXT_MAJOR_VERSION                WGL_CONTEXT_MAJOR_VERSION_ARB
+#define GLBIND_CONTEXT_MINOR_VERSION                WGL_CONTEXT_MINOR_VERSION_ARB
+#define GLBIND_CONTEXT_PROFILE_MASK                 WGL_CONTEXT_PROFILE_MASK_ARB
+#define GLBIND_CONTEXT_CORE_PROFILE_BIT             WGL_CONTEXT_CORE_PROFILE_BIT_ARB
+#define GLBIND_CONTEXT_COMPATIBILITY_PROFILE_BIT    WGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB
+#define GLBIND_CONTEXT_FLAGS                        WGL_CONTEXT_FLAGS_ARB
+#define GLBIND_CONTEXT_DEBUG_BIT                    WGL_CONTEXT_DEBUG_BIT_ARB
+#define GLBIND_CONTEXT_NO_ERROR                     WGL_CONTEXT_OPENGL_NO_ERROR_ARB
+#define GLBIND_CONTEXT_ATTRIBS_END                  0
+#endif
+#if defined(GLBIND_GLX)
+typedef int glbind_ContextAttrib;
+#define GLBIND_CONTEXT_MAJOR_VERSION                GLX_CONTEXT_MAJOR_VERSION_ARB
+#define GLBIND_CONTEXT_MINOR_VERSION                GLX_CONTEXT_MINOR_VERSION_ARB
+#define GLBIND_CONTEXT_PROFILE_MASK                 GLX_CONTEXT_PROFILE_MASK_ARB
+#define GLBIND_CONTEXT_CORE_PROFILE_BIT             GLX_CONTEXT_CORE_PROFILE_BIT_ARB
+#define GLBIND_CONTEXT_COMPATIBILITY_PROFILE_BIT    GLX_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB
+#define GLBIND_CONTEXT_FLAGS                        GLX_CONTEXT_FLAGS_ARB
+#define GLBIND_CONTEXT_DEBUG_BIT                    GLX_CONTEXT_DEBUG_BIT_ARB
+#define GLBIND_CONTEXT_NO_ERROR                     GLX_CONTEXT_OPENGL_NO_ERROR_ARB
+#define GLBIND_CONTEXT_ATTRIBS_END                  glbind_None
+#endif
+#if defined(GLBIND_EGL)
+typedef EGLint glbind_ContextAttrib;
+#define GLBIND_CONTEXT_MAJOR_VERSION                EGL_CONTEXT_MAJOR_VERSION_KHR
+#define GLBIND_CONTEXT_MINOR_VERSION                EGL_CONTEXT_MINOR_VERSION_KHR
+#define GLBIND_CONTEXT_PROFILE_MASK                 EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR
+#define GLBIND_CONTEXT_CORE_PROFILE_BIT             EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR
+#define GLBIND_CONTEXT_COMPATIBILITY_PROFILE_BIT    EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT_KHR
+#define GLBIND_CONTEXT_FLAGS                        EGL_CONTEXT_FLAGS_KHR
+#define GLBIND_CONTEXT_DEBUG_BIT                    EGL_CONTEXT_OPENGL_DEBUG_BIT_KHR
+#define GLBIND_CONTEXT_NO_ERROR                     EGL_CONTEXT_OPENGL_NO_ERROR_KHR
+#define GLBIND_CONTEXT_ATTRIBS_END                  EGL_NONE
+#endif
+#define GLBIND_MAX_CONTEXT_ATTRIBS                  16
+
+/* Whether or not the config asks for a kind of context that can only be created with the context creation extensions. */
+GLboolean glbConfigRequiresContextAttribs(const GLBconfig* pConfig)
+{
+    if (pConfig == NULL) {
+        return GL_FALSE;
+    }
+
+    return (pConfig->versionMajor > 0 || pConfig->profile != GLB_PROFILE_DEFAULT || pConfig->debug) ? GL_TRUE : GL_FALSE;
+}
+
+/* Whether or not the context creation extensions should be used for the context described by the config. */
+GLboolean glbConfigWantsContextAttribs(const GLBconfig* pConfig)
+{
+    return (glbConfigRequiresContextAttribs(pConfig) || (pConfig != NULL && pConfig->noError)) ? GL_TRUE : GL_FALSE;
+}
+
+/*
+Builds the attribute list for the context creation extensions from the config. pAttribs must have room for GLBIND_MAX_CONTEXT_ATTRIBS
+items. Returns GL_FALSE if a profile is requested but profileSupported is false. noError is left out if noErrorSupported is false.
+*/
+GLboolean glbBuildContextAttribs(const GLBconfig* pConfig, GLboolean profileSupported, GLboolean noErrorSupported, glbind_ContextAttrib* pAttribs)
+{
+    int count = 0;
+
+    if (pConfig != NULL) {
+        if (pConfig->versionMajor > 0) {
+            pAttribs[count++] = GLBIND_CONTEXT_MAJOR_VERSION;
+            pAttribs[count++] = pConfig->versionMajor;
+            pAttribs[count++] = GLBIND_CONTEXT_MINOR_VERSION;
+            pAttribs[count++] = pConfig->versionMinor;
+        }
+
+        if (pConfig->profile != GLB_PROFILE_DEFAULT) {
+            if (!profileSupported) {
+                return GL_FALSE;
+            }
+
+            pAttribs[count++] = GLBIND_CONTEXT_PROFILE_MASK;
+            pAttribs[count++] = (pConfig->profile == GLB_PROFILE_CORE) ? GLBIND_CONTEXT_CORE_PROFILE_BIT : GLBIND_CONTEXT_COMPATIBILITY_PROFILE_BIT;
+        }
+
+        /* A context can't be both a debug and a no-error context. Creation fails if both are requested so debug takes priority. */
+        if (pConfig->debug) {
+            pAttribs[count++] = GLBIND_CONTEXT_FLAGS;
+            pAttribs[count++] = GLBIND_CONTEXT_DEBUG_BIT;
+        } else if (pConfig->noError && noErrorSupported) {
+            pAttribs[count++] = GLBIND_CONTEXT_NO_ERROR;
+            pAttribs[count++] = GL_TRUE;
+        }
+    }
+
+    pAttribs[count] = GLBIND_CONTEXT_ATTRIBS_END;
+    return GL_TRUE;
+}
+
+#if defined(GLBIND_WGL)
+/* Creates a context with wglCreateContextAttribsARB(). A context must be current. Returns NULL if the extension is unavailable or the context could not be created. */
+HGLRC glbCreateContextAttribsWGL(HDC dc, const GLBconfig* pConfig)
+{
+    PFNWGLGETEXTENSIONSSTRINGARBPROC  _wglGetExtensionsStringARB  = (PFNWGLGETEXTENSIONSSTRINGARBPROC )glbGetProcAddress("wglGetExtensionsStringARB");
+    PFNWGLCREATECONTEXTATTRIBSARBPROC _wglCreateContextAttribsARB = (PFNWGLCREATECONTEXTATTRIBSARBPROC)glbGetProcAddress("wglCreateContextAttribsARB");
+    const char* pExtensions;
+    int contextAttribs[GLBIND_MAX_CONTEXT_ATTRIBS];
+
+    if (_wglGetExtensionsStringARB == NULL || _wglCreateContextAttribsARB == NULL) {
+        return NULL;
+    }
+
+    pExtensions = _wglGetExtensionsStringARB(dc);
+    if (!glbBuildContextAttribs(pConfig, glbIsExtensionInString("WGL_ARB_create_context_profile", pExtensions), glbIsExtensionInString("WGL_ARB_create_context_no_error", pExtensions), contextAttribs)) {
+        return NULL;
+    }
+
+    return _wglCreateContextAttribsARB(dc, NULL, contextAttribs);
+}
+#endif
+
+#if defined(GLBIND_EGL)
+/* Destroys the objects created by the first call to glbInit(). The display is only terminated if it was initialized by glbind. */
+void glbUninitEGLObjects(void)
+{
+    if (glbind_EGLDisplay == EGL_NO_DISPLAY) {
+        return;
+    }
+
+    if (glbind_RC != EGL_NO_CONTEXT) {
+        if (glbind_eglGetCurrentContext() == glbind_RC) {
+            glbind_eglMakeCurrent(glbind_EGLDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        }
+
+        glbind_eglDestroyContext(glbind_EGLDisplay, glbind_RC);
+        glbind_RC = EGL_NO_CONTEXT;
+    }
+    if (glbind_EGLSurface != EGL_NO_SURFACE) {
+        glbind_eglDestroySurface(glbind_EGLDisplay, glbind_EGLSurface);
+        glbind_EGLSurface = EGL_NO_SURFACE;
+    }
+    if (glbind_OwnsDisplay) {
+        glbind_eglTerminate(glbind_EGLDisplay);
+        glbind_OwnsDisplay = GL_FALSE;
+    }
+
+    glbind_EGLDisplay = EGL_NO_DISPLAY;
+    glbind_EGLConfig  = 0;
+}
+#endif
+
+#if defined(GLBIND_GLX)
+/* Destroys the objects created by the first call to glbInit(). Objects that were set in the config object are left alone. */
+void glbUninitGLXObjects(void)
+{
+    if (glbind_RC && glbind_OwnsRC) {
+        glbind_glXDestroyContext(glbind_pDisplay, glbind_RC);
+    }
+    glbind_RC     = 0;
+    glbind_OwnsRC = GL_FALSE;
+
+    if (glbind_DummyPbuffer) {
+        glbind_glXDestroyPbuffer(glbind_pDisplay, glbind_DummyPbuffer);
+        glbind_DummyPbuffer = 0;
+    }
+    if (glbind_DummyWindow) {
+        glbind_XDestroyWindow(glbind_pDisplay, glbind_DummyWindow);
+        glbind_DummyWindow = 0;
+    }
+    if (glbind_DummyColormap) {
+        glbind_XFreeColormap(glbind_pDisplay, glbind_DummyColormap);
+        glbind_DummyColormap = 0;
+    }
+    if (glbind_pFBVisualInfo) {
+        glbind_XFree(glbind_pFBVisualInfo);
+        glbind_pFBVisualInfo = 0;
+    }
+    glbind_DummyDrawable = 0;
+
+    if (glbind_pDisplay && glbind_OwnsDisplay) {
+        glbind_XCloseDisplay(glbind_pDisplay);
+    }
+    glbind_pDisplay    = 0;
+    glbind_OwnsDisplay = GL_FALSE;
+}
+
+/* Creates the dummy window from the visual in glbind_pFBVisualInfo. */
+GLenum glbCreateDummyWindowGLX(void)
+{
+    glbind_XSetWindowAttributes wa;
+
+    glbind_DummyColormap = glbind_XCreateColormap(glbind_pDisplay, glbind_XRootWindow(glbind_pDisplay, glbind_pFBVisualInfo->screen), glbind_pFBVisualInfo->visual, glbind_AllocNone);
+
+    wa.colormap = glbind_DummyColormap;
+    wa.border_pixel = 0;
+
+    /* Window's can not have dimensions of 0 in X11. We stick with dimensions of 1. */
+    glbind_DummyWindow = glbind_XCreateWindow(glbind_pDisplay, glbind_XRootWindow(glbind_pDisplay, glbind_pFBVisualInfo->screen), 0, 0, 1, 1, 0, glbind_pFBVisualInfo->depth, glbind_InputOutput, glbind_pFBVisualInfo->visual, glbind_CWBorderPixel | glbind_CWColormap, &wa);
+    if (glbind_DummyWindow == 0) {
+        return GL_INVALID_OPERATION;
+    }
+
+    glbind_DummyDrawable = glbind_DummyWindow;
+    return GL_NO_ERROR;
+}
+
+/* Creates the internal rendering context with a legacy visual and a dummy window to make it current with. The caller ends the context creation phase. */
+GLenum glbInitDummyWindowGLX(GLboolean singleBuffered, GLBinitStats* pStats)
+{
+    int attribs[] = {
+        GLX_RGBA,
+        GLX_RED_SIZE,      8,
+        GLX_GREEN_SIZE,    8,
+        GLX_BLUE_SIZE,     8,
+        GLX_ALPHA_SIZE,    8,
+        GLX_DEPTH_SIZE,    24,
+        GLX_STENCIL_SIZE,  8,
+        GLX_DOUBLEBUFFER,
+        glbind_None, glbind_None
+    };
+
+    if (singleBuffered) {
+        attribs[13] = glbind_None;
+    }
+
+    glbInitPhaseBeg(pStats, GLB_INIT_PHASE_CHOOSE_CONFIG);
+
+    glbind_pFBVisualInfo = glbind_glXChooseVisual(glbind_pDisplay, glbind_XDefaultScreen(glbind_pDisplay), attribs);
+    if (glbind_pFBVisualInfo == NULL) {
+        return GL_INVALID_OPERATION;
+    }
+
+    glbInitPhaseEnd(pStats, GLB_INIT_PHASE_CHOOSE_CONFIG);
+    glbInitPhaseBeg(pStats, GLB_INIT_PHASE_CREATE_CONTEXT);
+
+    glbind_RC = glbind_glXCreateContext(glbind_pDisplay, glbind_pFBVisualInfo, NULL, GL_TRUE);
+    if (glbind_RC == NULL) {
+        return GL_INVALID_OPERATION;
+    }
+    glbind_OwnsRC = GL_TRUE;
+
+    /* We cannot call any OpenGL APIs until a context is made current. In order to make a context current we will need a window. We just use a dummy window for this. */
+    return glbCreateDummyWindowGLX();
+}
+
+/* Set while glXCreateContextAttribsARB() is being called so that a failure doesn't trigger the default error handler which exits the process. */
+static GLboolean g_glbCreateContextFailedGLX = GL_FALSE;
+
+int glbCreateContextErrorHandlerGLX(glbind_Display* pDisplay, void* pErrorEvent)
+{
+    (void)pDisplay;
+    (void)pErrorEvent;
+
+    g_glbCreateContextFailedGLX = GL_TRUE;
+    return 0;
+}
+
+/* Creates a context with glXCreateContextAttribsARB(). Returns NULL if the extension is unavailable or the context could not be created. */
+GLXContext glbCreateContextAttribsGLX(GLXFBConfig fbConfig, const GLBconfig* pConfig)
+{
+    PFNGLXCREATECONTEXTATTRIBSARBPROC _glXCreateContextAttribsARB;
+    GLB_PFNXERRORHANDLERPROC prevErrorHandler;
+    const char* pExtensions;
+    int contextAttribs[GLBIND_MAX_CONTEXT_ATTRIBS];
+    GLXContext rc;
+
+    pExtensions = glbind_glXQueryExtensionsString(glbind_pDisplay, glbind_XDefaultScreen(glbind_pDisplay));
+    if (!glbIsExtensionInString("GLX_ARB_create_context", pExtensions)) {
+        return NULL;
+    }
+
+    _glXCreateContextAttribsARB = (PFNGLXCREATECONTEXTATTRIBSARBPROC)glbind_glXGetProcAddress((const GLubyte*)"glXCreateContextAttribsARB");
+    if (_glXCreateContextAttribsARB == NULL) {
+        return NULL;
+    }
+
+    if (!glbBuildContextAttribs(pConfig, glbIsExtensionInString("GLX_ARB_create_context_profile", pExtensions), glbIsExtensionInString("GLX_ARB_create_context_no_error", pExtensions), contextAttribs)) {
+        return NULL;
+    }
+
+    g_glbCreateContextFailedGLX = GL_FALSE;
+    prevErrorHandler = glbind_XSetErrorHandler(glbCreateContextErrorHandlerGLX);
+    rc = _glXCreateContextAttribsARB(glbind_pDisplay, fbConfig, NULL, GL_TRUE, contextAttribs);
+    glbind_XSync(glbind_pDisplay, GL_FALSE);    /* Make sure any error has been received before restoring the previous handler. */
+    glbind_XSetErrorHandler(prevErrorHandler);
+
+    if (g_glbCreateContextFailedGLX && rc != NULL) {
+        glbind_glXDestroyContext(glbind_pDisplay, rc);
+        rc = NULL;
+    }
+
+    return rc;
+}
+
+/*
+Creates the internal rendering context from a framebuffer config, and a drawable of the specified type to make it current with. The
+context is created with glXCreateContextAttribsARB() if the config asks for a specific version, profile or flags. With
+GLB_DUMMY_DRAWABLE_NONE an OpenGL 3.0 context is created by default so that it can be made current without a drawable. A pbuffer is
+only used if that fails. The caller ends the context creation phase.
+*/
+GLenum glbInitDummyFBConfigGLX(const GLBconfig* pConfig, GLboolean singleBuffered, GLBdummyDrawable dummyDrawable, GLBinitStats* pStats)
+{
+    int configAttribs[] = {
+        GLX_DRAWABLE_TYPE, GLX_WINDOW_BIT | GLX_PBUFFER_BIT,   /* The window bit is so glbGetFBVisualInfo() can be used for creating compatible windows. */
+        GLX_RENDER_TYPE,   GLX_RGBA_BIT,
+        GLX_RED_SIZE,      8,
+        GLX_GREEN_SIZE,    8,
+        GLX_BLUE_SIZE,     8,
+        GLX_ALPHA_SIZE,    8,
+        GLX_DEPTH_SIZE,    24,
+        GLX_STENCIL_SIZE,  8,
+        GLX_DOUBLEBUFFER,  GL_TRUE,
+        glbind_None
+    };
+    int pbufferAttribs[] = {
+        GLX_PBUFFER_WIDTH,  1,
+        GLX_PBUFFER_HEIGHT, 1,
+        glbind_None
+    };
+    GLXFBConfig* pFBConfigs;
+    GLXFBConfig fbConfig = NULL;
+    int fbConfigCount = 0;
+    int iFBConfig;
+
+    if (singleBuffered) {
+        configAttribs[19] = GL_FALSE;
+    }
+
+    glbInitPhaseBeg(pStats, GLB_INIT_PHASE_CHOOSE_CONFIG);
+
+    pFBConfigs = glbind_glXChooseFBConfig(glbind_pDisplay, glbind_XDefaultScreen(glbind_pDisplay), configAttribs, &fbConfigCount);
+    if (pFBConfigs == NULL || fbConfigCount == 0) {
+        return GL_INVALID_OPERATION;
+    }
+
+    /* Not every config is guaranteed to have a visual, but the dummy window and glbGetFBVisualInfo() need one. */
+    for (iFBConfig = 0; iFBConfig < fbConfigCount; ++iFBConfig) {
+        glbind_pFBVisualInfo = glbind_glXGetVisualFromFBConfig(glbind_pDisplay, pFBConfigs[iFBConfig]);
+        if (glbind_pFBVisualInfo != NULL) {
+            fbConfig = pFBConfigs[iFBConfig];
+            break;
+        }
+    }
+
+    glbind_XFree(pFBConfigs);
+
+    if (glbind_pFBVisualInfo == NULL) {
+        return GL_INVALID_OPERATION;
+    }
+
+    glbInitPhaseEnd(pStats, GLB_INIT_PHASE_CHOOSE_CONFIG);
+    glbInitPhaseBeg(pStats, GLB_INIT_PHASE_CREATE_CONTEXT);
+
+    if (glbConfigWantsContextAttribs(pConfig) || dummyDrawable == GLB_DUMMY_DRAWABLE_NONE) {
+        GLBconfig contextConfig;
+        if (pConfig != NULL) {
+            contextConfig = *pConfig;
+        } else {
+            contextConfig = glbConfigInit();
+        }
+
+        /* Only OpenGL 3.0+ contexts can be made current without a drawable. */
+        if (dummyDrawable == GLB_DUMMY_DRAWABLE_NONE && contextConfig.versionMajor == 0) {
+            contextConfig.versionMajor = 3;
+            contextConfig.versionMinor = 0;
+        }
+
+        glbind_RC = glbCreateContextAttribsGLX(fbConfig, &contextConfig);
+        if (glbind_RC != NULL) {
+            glbind_OwnsRC = GL_TRUE;
+
+            if (dummyDrawable == GLB_DUMMY_DRAWABLE_NONE && contextConfig.versionMajor >= 3) {
+                glbind_DummyDrawable = glbind_None;
+                return GL_NO_ERROR;
+            }
+        } else {
+            /* Don't silently fall back to a different kind of context than the one that was asked for. */
+            if (glbConfigRequiresContextAttribs(pConfig)) {
+                return GL_INVALID_OPERATION;
+            }
+        }
+    }
+
+    if (glbind_RC == NULL) {
+        glbind_RC = glbind_glXCreateNewContext(glbind_pDisplay, fbConfig, GLX_RGBA_TYPE, NULL, GL_TRUE);
+        if (glbind_RC == NULL) {
+            return GL_INVALID_OPERATION;
+        }
+        glbind_OwnsRC = GL_TRUE;
+    }
+
+    if (dummyDrawable == GLB_DUMMY_DRAWABLE_WINDOW) {
+        return glbCreateDummyWindowGLX();
+    }
+
+    glbind_DummyPbuffer = glbind_glXCreatePbuffer(glbind_pDisplay, fbConfig, pbufferAttribs);
+    if (glbind_DummyPbuffer == 0) {
+        return GL_INVALID_OPERATION;
+    }
+
+    glbind_DummyDrawable = glbind_DummyPbuffer;
+    return GL_NO_ERROR;
+}
+#endif
+
+/* These are the same as the public APIs of the same name except they record into pStats, which can be NULL. */
+#if defined(GLBIND_WGL)
+GLenum glbInitContextAPIWithStats(HDC dc, HGLRC rc, GLBapi* pAPI, GLBinitStats* pStats);
+#endif
+#if defined(GLBIND_GLX)
+GLenum glbInitContextAPIWithStats(glbind_Display* dpy, GLXDrawable drawable, GLXContext rc, GLBapi* pAPI, GLBinitStats* pStats);
+#endif
+#if defined(GLBIND_EGL)
+GLenum glbInitContextAPIWithStats(EGLDisplay dpy, EGLSurface surface, EGLContext rc, GLBapi* pAPI, GLBinitStats* pStats);
+#endif
+GLenum glbInitCurrentContextAPIWithStats(GLBapi* pAPI, GLBinitStats* pStats);
+const GLBapi* glbGetSharedCurrentContextAPIWithStats(GLBinitStats* pStats);
+
 GLBconfig glbConfigInit(void)
 {
     GLBconfig config;
@@ -617,11 +1614,20 @@ GLBconfig glbConfigInit(void)
     return config;
 }
 
-GLenum glbInit(GLBapi* pAPI, GLBconfig* pConfig)
+GLenum glbInitWithStats(GLBapi* pAPI, GLBconfig* pConfig, GLBinitStats* pStats)
 {
     GLenum result;
 
     if (g_glbInitCount == 0) {
+#if defined(GLBIND_GLX)
+        /* The application's context can't be made current on a display we opened ourselves. */
+        if (pConfig != NULL && pConfig->rc != NULL && pConfig->pDisplay == NULL) {
+            return GL_INVALID_VALUE;
+        }
+#endif
+
+        glbInitPhaseBeg(pStats, GLB_INIT_PHASE_LOAD_LIBRARIES);
+
         result = glbLoadOpenGLSO();
         if (result != GL_NO_ERROR) {
             return result;
@@ -670,6 +1676,9 @@ GLenum glbInit(GLBapi* pAPI, GLBconfig* pConfig)
         glbind_glXChooseFBConfig        = (GLB_PFNGLXCHOOSEFBCONFIGPROC       )glb_dlsym(g_glbOpenGLSO, "glXChooseFBConfig");
         glbind_glXGetVisualFromFBConfig = (GLB_PFNGLXGETVISUALFROMFBCONFIGPROC)glb_dlsym(g_glbOpenGLSO, "glXGetVisualFromFBConfig");
         glbind_glXGetProcAddress        = (GLB_PFNGLXGETPROCADDRESSPROC       )glb_dlsym(g_glbOpenGLSO, "glXGetProcAddress");
+        glbind_glXCreateNewContext      = (GLB_PFNGLXCREATENEWCONTEXTPROC     )glb_dlsym(g_glbOpenGLSO, "glXCreateNewContext");
+        glbind_glXCreatePbuffer         = (GLB_PFNGLXCREATEPBUFFERPROC        )glb_dlsym(g_glbOpenGLSO, "glXCreatePbuffer");
+        glbind_glXDestroyPbuffer        = (GLB_PFNGLXDESTROYPBUFFERPROC       )glb_dlsym(g_glbOpenGLSO, "glXDestroyPbuffer");
 
         if (glbind_glXChooseVisual          == NULL ||
             glbind_glXCreateContext         == NULL ||
@@ -682,7 +1691,10 @@ GLenum glbInit(GLBapi* pAPI, GLBconfig* pConfig)
             glbind_glXGetCurrentDrawable    == NULL ||
             glbind_glXChooseFBConfig        == NULL ||
             glbind_glXGetVisualFromFBConfig == NULL ||
-            glbind_glXGetProcAddress        == NULL) {
+            glbind_glXGetProcAddress        == NULL ||
+            glbind_glXCreateNewContext      == NULL ||
+            glbind_glXCreatePbuffer         == NULL ||
+            glbind_glXDestroyPbuffer        == NULL) {
             glbUnloadOpenGLSO();
             return GL_INVALID_OPERATION;
         }
@@ -695,6 +1707,9 @@ GLenum glbInit(GLBapi* pAPI, GLBconfig* pConfig)
         glbind_XFreeColormap   = (GLB_PFNXFREECOLORMAPPROC  )glb_dlsym(g_glbX11SO, "XFreeColormap");
         glbind_XDefaultScreen  = (GLB_PFNXDEFAULTSCREENPROC )glb_dlsym(g_glbX11SO, "XDefaultScreen");
         glbind_XRootWindow     = (GLB_PFNXROOTWINDOWPROC    )glb_dlsym(g_glbX11SO, "XRootWindow");
+        glbind_XFree           = (GLB_PFNXFREEPROC          )glb_dlsym(g_glbX11SO, "XFree");
+        glbind_XSetErrorHandler = (GLB_PFNXSETERRORHANDLERPROC)glb_dlsym(g_glbX11SO, "XSetErrorHandler");
+        glbind_XSync           = (GLB_PFNXSYNCPROC          )glb_dlsym(g_glbX11SO, "XSync");
 
         if (glbind_XOpenDisplay    == NULL ||
             glbind_XCloseDisplay   == NULL ||
@@ -703,17 +1718,63 @@ GLenum glbInit(GLBapi* pAPI, GLBconfig* pConfig)
             glbind_XCreateColormap == NULL ||
             glbind_XFreeColormap   == NULL ||
             glbind_XDefaultScreen  == NULL ||
-            glbind_XRootWindow     == NULL) {
+            glbind_XRootWindow     == NULL ||
+            glbind_XFree           == NULL ||
+            glbind_XSetErrorHandler == NULL ||
+            glbind_XSync           == NULL) {
+            glbUnloadOpenGLSO();
+            return GL_INVALID_OPERATION;
+        }
+#endif
+#if defined(GLBIND_EGL)
+        glbind_eglGetProcAddress        = (PFNEGLGETPROCADDRESSPROC      )glb_dlsym(g_glbEGLSO, "eglGetProcAddress");
+        glbind_eglGetDisplay            = (PFNEGLGETDISPLAYPROC          )glb_dlsym(g_glbEGLSO, "eglGetDisplay");
+        glbind_eglInitialize            = (PFNEGLINITIALIZEPROC          )glb_dlsym(g_glbEGLSO, "eglInitialize");
+        glbind_eglTerminate             = (PFNEGLTERMINATEPROC           )glb_dlsym(g_glbEGLSO, "eglTerminate");
+        glbind_eglQueryString           = (PFNEGLQUERYSTRINGPROC         )glb_dlsym(g_glbEGLSO, "eglQueryString");
+        glbind_eglBindAPI               = (PFNEGLBINDAPIPROC             )glb_dlsym(g_glbEGLSO, "eglBindAPI");
+        glbind_eglChooseConfig          = (PFNEGLCHOOSECONFIGPROC        )glb_dlsym(g_glbEGLSO, "eglChooseConfig");
+        glbind_eglCreateContext         = (PFNEGLCREATECONTEXTPROC       )glb_dlsym(g_glbEGLSO, "eglCreateContext");
+        glbind_eglDestroyContext        = (PFNEGLDESTROYCONTEXTPROC      )glb_dlsym(g_glbEGLSO, "eglDestroyContext");
+        glbind_eglCreatePbufferSurface  = (PFNEGLCREATEPBUFFERSURFACEPROC)glb_dlsym(g_glbEGLSO, "eglCreatePbufferSurface");
+        glbind_eglDestroySurface        = (PFNEGLDESTROYSURFACEPROC      )glb_dlsym(g_glbEGLSO, "eglDestroySurface");
+        glbind_eglMakeCurrent           = (PFNEGLMAKECURRENTPROC         )glb_dlsym(g_glbEGLSO, "eglMakeCurrent");
+        glbind_eglGetCurrentContext     = (PFNEGLGETCURRENTCONTEXTPROC   )glb_dlsym(g_glbEGLSO, "eglGetCurrentContext");
+        glbind_eglGetCurrentSurface     = (PFNEGLGETCURRENTSURFACEPROC   )glb_dlsym(g_glbEGLSO, "eglGetCurrentSurface");
+        glbind_eglGetCurrentDisplay     = (PFNEGLGETCURRENTDISPLAYPROC   )glb_dlsym(g_glbEGLSO, "eglGetCurrentDisplay");
+
+        if (glbind_eglGetProcAddress       == NULL ||
+            glbind_eglGetDisplay           == NULL ||
+            glbind_eglInitialize           == NULL ||
+            glbind_eglTerminate            == NULL ||
+            glbind_eglQueryString          == NULL ||
+            glbind_eglBindAPI              == NULL ||
+            glbind_eglChooseConfig         == NULL ||
+            glbind_eglCreateContext        == NULL ||
+            glbind_eglDestroyContext       == NULL ||
+            glbind_eglCreatePbufferSurface == NULL ||
+            glbind_eglDestroySurface       == NULL ||
+            glbind_eglMakeCurrent          == NULL ||
+            glbind_eglGetCurrentContext    == NULL ||
+            glbind_eglGetCurrentSurface    == NULL ||
+            glbind_eglGetCurrentDisplay    == NULL) {
             glbUnloadOpenGLSO();
             return GL_INVALID_OPERATION;
         }
+
+        /* This is an extension so it's allowed to be null. It's only used for getting a surfaceless display. */
+        glbind_eglGetPlatformDisplayEXT = (PFNEGLGETPLATFORMDISPLAYEXTPROC)glbind_eglGetProcAddress("eglGetPlatformDisplayEXT");
 #endif
 
+        glbInitPhaseEnd(pStats, GLB_INIT_PHASE_LOAD_LIBRARIES);
+
         /* Here is where we need to initialize our dummy objects so we can get a context and retrieve some API pointers. */
 #if defined(GLBIND_WGL)
         {
             HWND hWnd = NULL;
 
+            glbInitPhaseBeg(pStats, GLB_INIT_PHASE_OPEN_DISPLAY);
+
             if (pConfig != NULL) {
                 hWnd = pConfig->hWnd;
             }
@@ -737,6 +1798,9 @@ GLenum glbInit(GLBapi* pAPI, GLBconfig* pConfig)
 
             glbind_DC = GetDC(hWnd);
 
+            glbInitPhaseEnd(pStats, GLB_INIT_PHASE_OPEN_DISPLAY);
+            glbInitPhaseBeg(pStats, GLB_INIT_PHASE_CHOOSE_CONFIG);
+
             memset(&glbind_PFD, 0, sizeof(glbind_PFD));
             glbind_PFD.nSize        = sizeof(glbind_PFD);
             glbind_PFD.nVersion     = 1;
@@ -758,6 +1822,9 @@ GLenum glbInit(GLBapi* pAPI, GLBconfig* pConfig)
                 return GL_INVALID_OPERATION;
             }
 
+            glbInitPhaseEnd(pStats, GLB_INIT_PHASE_CHOOSE_CONFIG);
+            glbInitPhaseBeg(pStats, GLB_INIT_PHASE_CREATE_CONTEXT);
+
             glbind_RC = glbind_wglCreateContext(glbind_DC);
             if (glbind_RC == NULL) {
                 DestroyWindow(hWnd);
@@ -766,73 +1833,206 @@ GLenum glbInit(GLBapi* pAPI, GLBconfig* pConfig)
             }
 
             glbind_wglMakeCurrent(glbind_DC, glbind_RC);
+
+            /* wglCreateContextAttribsARB() can only be retrieved while a context is current so the legacy context is replaced afterwards. */
+            if (glbConfigWantsContextAttribs(pConfig)) {
+                HGLRC hRC = glbCreateContextAttribsWGL(glbind_DC, pConfig);
+                if (hRC != NULL) {
+                    glbind_wglMakeCurrent(glbind_DC, hRC);
+                    glbind_wglDeleteContext(glbind_RC);
+                    glbind_RC = hRC;
+                } else if (glbConfigRequiresContextAttribs(pConfig)) {
+                    glbind_wglMakeCurrent(NULL, NULL);
+                    glbind_wglDeleteContext(glbind_RC);
+                    glbind_RC = 0;
+                    DestroyWindow(hWnd);
+                    glbUnloadOpenGLSO();
+                    return GL_INVALID_OPERATION;
+                }
+            }
+
+            glbInitPhaseEnd(pStats, GLB_INIT_PHASE_CREATE_CONTEXT);
         }
 #endif
 
 #if defined(GLBIND_GLX)
         {
-            static int attribs[] = {
-                GLX_RGBA,
-                GLX_RED_SIZE,      8,
-                GLX_GREEN_SIZE,    8,
-                GLX_BLUE_SIZE,     8,
-                GLX_ALPHA_SIZE,    8,
-                GLX_DEPTH_SIZE,    24,
-                GLX_STENCIL_SIZE,  8,
-                GLX_DOUBLEBUFFER,
-                glbind_None, glbind_None
+            GLBdummyDrawable dummyDrawable = GLB_DUMMY_DRAWABLE_WINDOW;
+            GLboolean singleBuffered = GL_FALSE;
+
+            if (pConfig != NULL) {
+                glbind_pDisplay = pConfig->pDisplay;
+                dummyDrawable   = pConfig->dummyDrawable;
+                singleBuffered  = pConfig->singleBuffered;
+            }
+
+            if (glbind_pDisplay == NULL) {
+                glbInitPhaseBeg(pStats, GLB_INIT_PHASE_OPEN_DISPLAY);
+
+                glbind_pDisplay = glbind_XOpenDisplay(NULL);
+                if (glbind_pDisplay == NULL) {
+                    glbUnloadOpenGLSO();
+                    return GL_INVALID_OPERATION;
+                }
+
+                glbind_OwnsDisplay = GL_TRUE;
+
+                glbInitPhaseEnd(pStats, GLB_INIT_PHASE_OPEN_DISPLAY);
+            }
+
+            if (pConfig != NULL && pConfig->rc != NULL) {
+                /* The application's context is used as-is. */
+                glbInitPhaseBeg(pStats, GLB_INIT_PHASE_CREATE_CONTEXT);
+                glbind_RC            = pConfig->rc;
+                glbind_DummyDrawable = pConfig->drawable;
+                result = GL_NO_ERROR;
+            } else if (dummyDrawable == GLB_DUMMY_DRAWABLE_WINDOW && !glbConfigWantsContextAttribs(pConfig)) {
+                result = glbInitDummyWindowGLX(singleBuffered, pStats);
+            } else {
+                result = glbInitDummyFBConfigGLX(pConfig, singleBuffered, dummyDrawable, pStats);
+            }
+
+            if (result == GL_NO_ERROR) {
+                if (!glbind_glXMakeCurrent(glbind_pDisplay, glbind_DummyDrawable, glbind_RC)) {
+                    result = GL_INVALID_OPERATION;
+                }
+            }
+
+            if (result == GL_NO_ERROR) {
+                glbInitPhaseEnd(pStats, GLB_INIT_PHASE_CREATE_CONTEXT);
+            }
+
+            if (result != GL_NO_ERROR) {
+                glbUninitGLXObjects();
+                glbUnloadOpenGLSO();
+                return result;
+            }
+        }
+#endif
+
+#if defined(GLBIND_EGL)
+        {
+            static EGLint configAttribs[] = {
+                EGL_SURFACE_TYPE,    EGL_PBUFFER_BIT,
+                EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+                EGL_RED_SIZE,        8,
+                EGL_GREEN_SIZE,      8,
+                EGL_BLUE_SIZE,       8,
+                EGL_ALPHA_SIZE,      8,
+                EGL_DEPTH_SIZE,      24,
+                EGL_STENCIL_SIZE,    8,
+                EGL_NONE
+            };
+            static EGLint pbufferAttribs[] = {
+                EGL_WIDTH,  1,
+                EGL_HEIGHT, 1,
+                EGL_NONE
             };
+            EGLint contextAttribs[GLBIND_MAX_CONTEXT_ATTRIBS];
+            EGLint configCount = 0;
+
+            glbInitPhaseBeg(pStats, GLB_INIT_PHASE_OPEN_DISPLAY);
 
             if (pConfig != NULL) {
-                if (!pConfig->singleBuffered) {
-                    attribs[13] = glbind_None;
+                glbind_EGLDisplay = pConfig->display;
+            }
+
+            if (glbind_EGLDisplay == EGL_NO_DISPLAY) {
+                /*
+                The surfaceless platform is preferred because it does not need a window system at all. The client extensions can only be
+                queried on EGL 1.5 or with EGL_EXT_client_extensions. Otherwise NULL is returned and we just use the default display.
+                */
+                if (glbind_eglGetPlatformDisplayEXT != NULL && glbIsExtensionInString("EGL_MESA_platform_surfaceless", glbind_eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS))) {
+                    glbind_EGLDisplay = glbind_eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+                }
+
+                if (glbind_EGLDisplay == EGL_NO_DISPLAY) {
+                    glbind_EGLDisplay = glbind_eglGetDisplay(EGL_DEFAULT_DISPLAY);
+                }
+
+                if (glbind_EGLDisplay == EGL_NO_DISPLAY) {
+                    glbUnloadOpenGLSO();
+                    return GL_INVALID_OPERATION;
                 }
+
+                glbind_OwnsDisplay = GL_TRUE;
             }
-    
-            glbind_OwnsDisplay = GL_TRUE;
-            glbind_pDisplay = glbind_XOpenDisplay(NULL);
-            if (glbind_pDisplay == NULL) {
+
+            /* Initializing a display that has already been initialized by the application is fine. */
+            if (!glbind_eglInitialize(glbind_EGLDisplay, NULL, NULL) || !glbind_eglBindAPI(EGL_OPENGL_API)) {
+                glbUninitEGLObjects();
                 glbUnloadOpenGLSO();
                 return GL_INVALID_OPERATION;
             }
 
-            glbind_pFBVisualInfo = glbind_glXChooseVisual(glbind_pDisplay, glbind_XDefaultScreen(glbind_pDisplay), attribs);
-            if (glbind_pFBVisualInfo == NULL) {
+            glbInitPhaseEnd(pStats, GLB_INIT_PHASE_OPEN_DISPLAY);
+            glbInitPhaseBeg(pStats, GLB_INIT_PHASE_CHOOSE_CONFIG);
+
+            if (!glbind_eglChooseConfig(glbind_EGLDisplay, configAttribs, &glbind_EGLConfig, 1, &configCount) || configCount == 0) {
+                glbUninitEGLObjects();
                 glbUnloadOpenGLSO();
                 return GL_INVALID_OPERATION;
             }
 
-            glbind_DummyColormap = glbind_XCreateColormap(glbind_pDisplay, glbind_XRootWindow(glbind_pDisplay, glbind_pFBVisualInfo->screen), glbind_pFBVisualInfo->visual, glbind_AllocNone);
+            glbInitPhaseEnd(pStats, GLB_INIT_PHASE_CHOOSE_CONFIG);
+            glbInitPhaseBeg(pStats, GLB_INIT_PHASE_CREATE_CONTEXT);
+
+            /* A specific version, profile or flags need EGL_KHR_create_context. */
+            contextAttribs[0] = EGL_NONE;
+            if (glbConfigWantsContextAttribs(pConfig)) {
+                const char* pExtensions = glbind_eglQueryString(glbind_EGLDisplay, EGL_EXTENSIONS);
+                if (!glbIsExtensionInString("EGL_KHR_create_context", pExtensions) || !glbBuildContextAttribs(pConfig, GL_TRUE, glbIsExtensionInString("EGL_KHR_create_context_no_error", pExtensions), contextAttribs)) {
+                    if (glbConfigRequiresContextAttribs(pConfig)) {
+                        glbUninitEGLObjects();
+                        glbUnloadOpenGLSO();
+                        return GL_INVALID_OPERATION;
+                    }
+
+                    contextAttribs[0] = EGL_NONE;
+                }
+            }
 
-            glbind_RC = glbind_glXCreateContext(glbind_pDisplay, glbind_pFBVisualInfo, NULL, GL_TRUE);
-            if (glbind_RC == NULL) {
+            glbind_RC = glbind_eglCreateContext(glbind_EGLDisplay, glbind_EGLConfig, EGL_NO_CONTEXT, contextAttribs);
+            if (glbind_RC == EGL_NO_CONTEXT && contextAttribs[0] != EGL_NONE && !glbConfigRequiresContextAttribs(pConfig)) {
+                /* noError is only a hint. Drivers can refuse it for some kinds of contexts in which case we just use a normal context. */
+                glbind_RC = glbind_eglCreateContext(glbind_EGLDisplay, glbind_EGLConfig, EGL_NO_CONTEXT, NULL);
+            }
+            if (glbind_RC == EGL_NO_CONTEXT) {
+                glbUninitEGLObjects();
                 glbUnloadOpenGLSO();
                 return GL_INVALID_OPERATION;
             }
 
-            /* We cannot call any OpenGL APIs until a context is made current. In order to make a context current we will need a window. We just use a dummy window for this. */
-            glbind_XSetWindowAttributes wa;
-            wa.colormap = glbind_DummyColormap;
-            wa.border_pixel = 0;
+            /* We don't need a surface at all if the display supports surfaceless contexts. Otherwise we just use a 1x1 pbuffer. */
+            if (!glbIsExtensionInString("EGL_KHR_surfaceless_context", glbind_eglQueryString(glbind_EGLDisplay, EGL_EXTENSIONS))) {
+                glbind_EGLSurface = glbind_eglCreatePbufferSurface(glbind_EGLDisplay, glbind_EGLConfig, pbufferAttribs);
+                if (glbind_EGLSurface == EGL_NO_SURFACE) {
+                    glbUninitEGLObjects();
+                    glbUnloadOpenGLSO();
+                    return GL_INVALID_OPERATION;
+                }
+            }
 
-            /* Window's can not have dimensions of 0 in X11. We stick with dimensions of 1. */
-            glbind_DummyWindow = glbind_XCreateWindow(glbind_pDisplay, glbind_XRootWindow(glbind_pDisplay, glbind_pFBVisualInfo->screen), 0, 0, 1, 1, 0, glbind_pFBVisualInfo->depth, glbind_InputOutput, glbind_pFBVisualInfo->visual, glbind_CWBorderPixel | glbind_CWColormap, &wa);
-            if (glbind_DummyWindow == 0) {
+            if (!glbind_eglMakeCurrent(glbind_EGLDisplay, glbind_EGLSurface, glbind_EGLSurface, glbind_RC)) {
+                glbUninitEGLObjects();
                 glbUnloadOpenGLSO();
                 return GL_INVALID_OPERATION;
             }
 
-            glbind_glXMakeCurrent(glbind_pDisplay, glbind_DummyWindow, glbind_RC);
+            glbInitPhaseEnd(pStats, GLB_INIT_PHASE_CREATE_CONTEXT);
         }
 #endif
     }
 
     if (pAPI != NULL) {
 #if defined(GLBIND_WGL)
-        result = glbInitContextAPI(glbind_DC, glbind_RC, pAPI);
+        result = glbInitContextAPIWithStats(glbind_DC, glbind_RC, pAPI, pStats);
 #endif
 #if defined(GLBIND_GLX)
-        result = glbInitContextAPI(glbind_pDisplay, glbind_DummyWindow, glbind_RC, pAPI);
+        result = glbInitContextAPIWithStats(glbind_pDisplay, glbind_DummyDrawable, glbind_RC, pAPI, pStats);
+#endif
+#if defined(GLBIND_EGL)
+        result = glbInitContextAPIWithStats(glbind_EGLDisplay, glbind_EGLSurface, glbind_RC, pAPI, pStats);
 #endif
         if (result == GL_NO_ERROR) {
             if (g_glbInitCount == 0) {
@@ -840,18 +2040,26 @@ GLenum glbInit(GLBapi* pAPI, GLBconfig* pConfig)
             }
         }
     } else {
+#if defined(GLBIND_LAZY)
+        /* The global function pointers resolve themselves the first time they're called so there's nothing to do here. */
+        result = GL_NO_ERROR;
+#else
         GLBapi tempAPI;
 #if defined(GLBIND_WGL)
-        result = glbInitContextAPI(glbind_DC, glbind_RC, &tempAPI);
+        result = glbInitContextAPIWithStats(glbind_DC, glbind_RC, &tempAPI, pStats);
 #endif
 #if defined(GLBIND_GLX)
-        result = glbInitContextAPI(glbind_pDisplay, glbind_DummyWindow, glbind_RC, &tempAPI);
+        result = glbInitContextAPIWithStats(glbind_pDisplay, glbind_DummyDrawable, glbind_RC, &tempAPI, pStats);
+#endif
+#if defined(GLBIND_EGL)
+        result = glbInitContextAPIWithStats(glbind_EGLDisplay, glbind_EGLSurface, glbind_RC, &tempAPI, pStats);
 #endif
         if (result == GL_NO_ERROR) {
             if (g_glbInitCount == 0) {
-                result = glbBindAPI(pAPI);
+                result = glbBindAPI(&tempAPI);
             }
         }
+#endif
     }
 
     /* If at this point we have an error we need to uninitialize the global objects (if this is the initial initialization) and return. */
@@ -869,19 +2077,10 @@ GLenum glbInit(GLBapi* pAPI, GLBconfig* pConfig)
             glbind_DC = 0;
 #endif
 #if defined(GLBIND_GLX)
-            if (glbind_RC) {
-                glbind_glXDestroyContext(glbind_pDisplay, glbind_RC);
-                glbind_RC = 0;
-            }
-            if (glbind_DummyWindow) {
-                glbind_XDestroyWindow(glbind_pDisplay, glbind_DummyWindow);
-                glbind_DummyWindow = 0;
-            }
-            if (glbind_pDisplay && glbind_OwnsDisplay) {
-                glbind_XCloseDisplay(glbind_pDisplay);
-                glbind_pDisplay    = 0;
-                glbind_OwnsDisplay = GL_FALSE;
-            }
+            glbUninitGLXObjects();
+#endif
+#if defined(GLBIND_EGL)
+            glbUninitEGLObjects();
 #endif
 
             glbUnloadOpenGLSO();
@@ -894,33 +2093,848 @@ GLenum glbInit(GLBapi* pAPI, GLBconfig* pConfig)
     return GL_NO_ERROR;
 }
 
-#if defined(GLBIND_WGL)
-GLenum glbInitContextAPI(HDC dc, HGLRC rc, GLBapi* pAPI)
+GLenum glbInit(GLBapi* pAPI, GLBconfig* pConfig)
 {
+    GLBinitStats stats;
     GLenum result;
+
+    glbInitStatsBeg(&stats);
+    result = glbInitWithStats(pAPI, pConfig, &stats);
+    glbInitStatsEnd(&stats, result);
+
+    return result;
+}
+
+/* Initializes an API object for the current context by copying it from the shared table of the context's driver. */
+GLenum glbInitCurrentContextAPIFromCache(GLBapi* pAPI, GLBinitStats* pStats)
+{
+#if !defined(GLBIND_NO_CONTEXT_API_CACHE)
+    const GLBapi* pSharedAPI;
+
+    if (pAPI == NULL) {
+        return GL_INVALID_OPERATION;
+    }
+
+    pSharedAPI = glbGetSharedCurrentContextAPIWithStats(pStats);
+    if (pSharedAPI != NULL) {
+        *pAPI = *pSharedAPI;
+        return GL_NO_ERROR;
+    }
+#endif
+
+    /* Fall back to loading everything from scratch. */
+    return glbInitCurrentContextAPIWithStats(pAPI, pStats);
+}
+
+#if defined(GLBIND_WGL)
+GLenum glbInitContextAPIWithStats(HDC dc, HGLRC rc, GLBapi* pAPI, GLBinitStats* pStats)
+{
+    GLenum result;
+    HDC dcPrev;
+    HGLRC rcPrev;
+    
+    dcPrev = glbind_wglGetCurrentDC();
+    rcPrev = glbind_wglGetCurrentContext();
+
+    if (dcPrev != dc && rcPrev != rc) {
+        glbind_wglMakeCurrent(dc, rc);
+    }
+    
+    glbInitPhaseBeg(pStats, GLB_INIT_PHASE_LOAD_PROCS);
+    result = glbInitCurrentContextAPIFromCache(pAPI, pStats);
+    glbInitPhaseEnd(pStats, GLB_INIT_PHASE_LOAD_PROCS);
+    
+    if (dcPrev != dc && rcPrev != rc) {
+        glbind_wglMakeCurrent(dcPrev, rcPrev);
+    }
+
+    return result;
+}
+#endif
+#if defined(GLBIND_GLX)
+GLenum glbInitContextAPIWithStats(glbind_Display* dpy, GLXDrawable drawable, GLXContext rc, GLBapi* pAPI, GLBinitStats* pStats)
+{
+    GLenum result;
+    GLXContext rcPrev = 0;
+    GLXDrawable drawablePrev = 0;
+    glbind_Display* dpyPrev = NULL;
+
+    if (glbind_glXGetCurrentContext && glbind_glXGetCurrentDrawable && glbind_glXGetCurrentDisplay) {
+        rcPrev       = glbind_glXGetCurrentContext();
+        drawablePrev = glbind_glXGetCurrentDrawable();
+        dpyPrev      = glbind_glXGetCurrentDisplay();
+    }
+
+    glbind_glXMakeCurrent(dpy, drawable, rc);
+    glbInitPhaseBeg(pStats, GLB_INIT_PHASE_LOAD_PROCS);
+    result = glbInitCurrentContextAPIFromCache(pAPI, pStats);
+    glbInitPhaseEnd(pStats, GLB_INIT_PHASE_LOAD_PROCS);
+    glbind_glXMakeCurrent(dpyPrev, drawablePrev, rcPrev);
+
+    return result;
+}
+#endif
+#if defined(GLBIND_EGL)
+GLenum glbInitContextAPIWithStats(EGLDisplay dpy, EGLSurface surface, EGLContext rc, GLBapi* pAPI, GLBinitStats* pStats)
+{
+    GLenum result;
+    EGLDisplay dpyPrev;
+    EGLSurface drawPrev;
+    EGLSurface readPrev;
+    EGLContext rcPrev;
+
+    dpyPrev  = glbind_eglGetCurrentDisplay();
+    drawPrev = glbind_eglGetCurrentSurface(EGL_DRAW);
+    readPrev = glbind_eglGetCurrentSurface(EGL_READ);
+    rcPrev   = glbind_eglGetCurrentContext();
+
+    if (rcPrev != rc) {
+        glbind_eglMakeCurrent(dpy, surface, surface, rc);
+    }
+
+    glbInitPhaseBeg(pStats, GLB_INIT_PHASE_LOAD_PROCS);
+    result = glbInitCurrentContextAPIFromCache(pAPI, pStats);
+    glbInitPhaseEnd(pStats, GLB_INIT_PHASE_LOAD_PROCS);
+
+    if (rcPrev != rc) {
+        if (dpyPrev != EGL_NO_DISPLAY) {
+            glbind_eglMakeCurrent(dpyPrev, drawPrev, readPrev, rcPrev);
+        } else {
+            glbind_eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);  /* Nothing was current beforehand. */
+        }
+    }
+
+    return result;
+}
+#endif
+
+#if defined(GLBIND_WGL)
+GLenum glbInitContextAPI(HDC dc, HGLRC rc, GLBapi* pAPI)
+{
+    GLBinitStats stats;
+    GLenum result;
+
+    glbInitStatsBeg(&stats);
+    result = glbInitContextAPIWithStats(dc, rc, pAPI, &stats);
+    glbInitStatsEnd(&stats, result);
+
+    return result;
+}
+#endif
+#if defined(GLBIND_GLX)
+GLenum glbInitContextAPI(glbind_Display* dpy, GLXDrawable drawable, GLXContext rc, GLBapi* pAPI)
+{
+    GLBinitStats stats;
+    GLenum result;
+
+    glbInitStatsBeg(&stats);
+    result = glbInitContextAPIWithStats(dpy, drawable, rc, pAPI, &stats);
+    glbInitStatsEnd(&stats, result);
+
+    return result;
+}
+#endif
+#if defined(GLBIND_EGL)
+GLenum glbInitContextAPI(EGLDisplay dpy, EGLSurface surface, EGLContext rc, GLBapi* pAPI)
+{
+    GLBinitStats stats;
+    GLenum result;
+
+    glbInitStatsBeg(&stats);
+    result = glbInitContextAPIWithStats(dpy, surface, rc, pAPI, &stats);
+    glbInitStatsEnd(&stats, result);
+
+    return result;
+}
+#endif
+
+/*<<init_current_context_api>>*/
+
+/* The function pointers in GLBapi are retrieved by index, so the struct must start with exactly one pointer for each name in the table. */
+typedef char glbind_ProcNameTableSizeCheck[(offsetof(GLBapi, extensionSupportFlags) == sizeof(GLBproc)*GLB_PROC_COUNT && sizeof(glbind_ProcNameOffsets) == sizeof(glbind_ProcNameOffsets[0])*GLB_PROC_COUNT) ? 1 : -1];
+
+const char* glbGetProcNameByIndex(size_t iProc)
+{
+    return (const char*)&glbind_ProcNames + glbind_ProcNameOffsets[iProc];
+}
+
+/* Retrieves a function pointer by its index in GLBapi. */
+GLBproc glbGetProcAddressByIndex(size_t iProc)
+{
+    return glbGetProcAddress(glbGetProcNameByIndex(iProc));
+}
+
+/* The loader used when the application doesn't supply its own. This goes through the libraries loaded by glbInit(). pUserData is a GLBinitStats object, or NULL. */
+GLBproc glbDefaultLoadProc(const char* pName, void* pUserData)
+{
+    return glbGetProcAddressWithStats(pName, (GLBinitStats*)pUserData);
+}
+
+GLenum glbLoadAllProcs(GLBapi* pAPI, GLBloadproc pLoadProc, void* pUserData)
+{
+    GLBproc* pProcs;
+    size_t iProc;
+
+    /* GLBapi is laid out in the same order as the name table, which means we can just treat it as an array. */
+    pProcs = GLB_PROCS(pAPI);
+    for (iProc = 0; iProc < GLB_PROC_COUNT; ++iProc) {
+        pProcs[iProc] = pLoadProc(glbGetProcNameByIndex(iProc), pUserData);
+    }
+
+    return GL_NO_ERROR;
+}
+
+/*<<extension_names>>*/
+
+GLuint glbHashExtensionName(const char* pName, size_t nameLen, GLuint seed)
+{
+    /* FNV-1a. This must match the hash used by the generator. */
+    GLuint hash = 2166136261u ^ seed;
+    size_t i;
+
+    for (i = 0; i < nameLen; ++i) {
+        hash ^= (unsigned char)pName[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+const char* glbGetExtensionNameByIndex(size_t iExtension)
+{
+    return (const char*)&glbind_ExtensionNames + glbind_ExtensionNameOffsets[iExtension];
+}
+
+/*
+Finds the index of an extension in GLBextension with a perfect hash table. The name does not need to be null terminated. Returns
+GLB_EXTENSION_COUNT if the extension is unknown.
+*/
+size_t glbFindExtensionIndex(const char* pName, size_t nameLen)
+{
+    GLuint bucket;
+    GLuint slot;
+    size_t iExtension;
+    const char* pExtensionName;
+
+    bucket = glbHashExtensionName(pName, nameLen, 0) & (GLBIND_EXTENSION_HASH_BUCKET_COUNT - 1);
+    slot   = glbHashExtensionName(pName, nameLen, glbind_ExtensionHashSeeds[bucket]) & (GLBIND_EXTENSION_HASH_SLOT_COUNT - 1);
+
+    iExtension = glbind_ExtensionHashSlots[slot];
+    if (iExtension == GLBIND_EXTENSION_HASH_EMPTY_SLOT) {
+        return GLB_EXTENSION_COUNT;
+    }
+
+    /*
+    The hash table covers the extensions of every platform, in gl, wgl, glx, egl order. Only the extensions of the current platform are
+    in GLBextension, where they follow on from the cross-platform extensions, so these need to be converted to our own indexing.
+    */
+    if (iExtension >= GLBIND_GL_EXTENSION_COUNT) {
+        size_t platformFirst;
+        size_t platformCount;
+
+    #if defined(GLBIND_WGL)
+        platformFirst = GLBIND_GL_EXTENSION_COUNT;
+        platformCount = GLBIND_WGL_EXTENSION_COUNT;
+    #elif defined(GLBIND_GLX)
+        platformFirst = GLBIND_GL_EXTENSION_COUNT + GLBIND_WGL_EXTENSION_COUNT;
+        platformCount = GLBIND_GLX_EXTENSION_COUNT;
+    #elif defined(GLBIND_EGL)
+        platformFirst = GLBIND_GL_EXTENSION_COUNT + GLBIND_WGL_EXTENSION_COUNT + GLBIND_GLX_EXTENSION_COUNT;
+        platformCount = GLBIND_EGL_EXTENSION_COUNT;
+    #else
+        platformFirst = GLBIND_GL_EXTENSION_COUNT;
+        platformCount = 0;
+    #endif
+
+        if (iExtension < platformFirst || iExtension >= platformFirst + platformCount) {
+            return GLB_EXTENSION_COUNT;
+        }
+
+        iExtension = GLBIND_GL_EXTENSION_COUNT + (iExtension - platformFirst);
+    }
+
+    /* Any name can hash to an occupied slot so we need to make sure it's actually the same extension. */
+    pExtensionName = glbGetExtensionNameByIndex(iExtension);
+    if (glb_strncmp(pName, pExtensionName, nameLen) != 0 || pExtensionName[nameLen] != '\0') {
+        return GLB_EXTENSION_COUNT;
+    }
+
+    return iExtension;
+}
+
+/* Flags each known extension in a space separated list of extensions as supported. A single extension name is also valid. */
+void glbMarkSupportedExtensions(const char* pExtensions, GLubyte* pExtensionSupportFlags)
+{
+    const char* pNameBeg;
+    const char* pNameEnd;
+
+    if (pExtensions == NULL) {
+        return;
+    }
+
+    pNameBeg = pExtensions;
+    for (;;) {
+        size_t iExtension;
+
+        while (pNameBeg[0] == ' ') {
+            pNameBeg += 1;
+        }
+
+        if (pNameBeg[0] == '\0') {
+            break;
+        }
+
+        pNameEnd = pNameBeg;
+        while (pNameEnd[0] != ' ' && pNameEnd[0] != '\0') {
+            pNameEnd += 1;
+        }
+
+        iExtension = glbFindExtensionIndex(pNameBeg, (size_t)(pNameEnd - pNameBeg));
+        if (iExtension < GLB_EXTENSION_COUNT) {
+            pExtensionSupportFlags[iExtension >> 3] |= (GLubyte)(1 << (iExtension & 7));
+        }
+
+        pNameBeg = pNameEnd;
+    }
+}
+
+GLboolean glbHasExtensionSupportFlag(const GLubyte* pExtensionSupportFlags, size_t iExtension)
+{
+    return ((pExtensionSupportFlags[iExtension >> 3] & (1 << (iExtension & 7))) != 0) ? GL_TRUE : GL_FALSE;
+}
+
+/* Parses the "major.minor" at the start of a GL_VERSION string. OpenGL ES prefixes it with "OpenGL ES". */
+void glbParseVersionString(const char* pVersion, GLint* pMajorVersion, GLint* pMinorVersion)
+{
+    GLint majorVersion = 0;
+    GLint minorVersion = 0;
+
+    while (pVersion[0] != '\0' && (pVersion[0] < '0' || pVersion[0] > '9')) {
+        pVersion += 1;
+    }
+    while (pVersion[0] >= '0' && pVersion[0] <= '9') {
+        majorVersion = (majorVersion * 10) + (pVersion[0] - '0');
+        pVersion += 1;
+    }
+    if (pVersion[0] == '.') {
+        pVersion += 1;
+        while (pVersion[0] >= '0' && pVersion[0] <= '9') {
+            minorVersion = (minorVersion * 10) + (pVersion[0] - '0');
+            pVersion += 1;
+        }
+    }
+
+    *pMajorVersion = majorVersion;
+    *pMinorVersion = minorVersion;
+}
+
+/* Retrieves the major and minor version of the current context. */
+GLenum glbGetContextVersion(GLBapi* pAPI, GLint* pMajorVersion, GLint* pMinorVersion)
+{
+    const char* pVersion;
+
+    *pMajorVersion = 0;
+    *pMinorVersion = 0;
+
+    if (pAPI->glGetString == NULL) {
+        return GL_INVALID_OPERATION;
+    }
+
+    pVersion = (const char*)pAPI->glGetString(GL_VERSION);
+    if (pVersion == NULL) {
+        return GL_INVALID_OPERATION;    /* Probably no context is current. */
+    }
+
+    glbParseVersionString(pVersion, pMajorVersion, pMinorVersion);
+
+    return GL_NO_ERROR;
+}
+
+/*
+Queries the extensions supported by the current context and caches them in the API object. glGetString(), glGetStringi() and glGetIntegerv()
+must have been loaded beforehand, as well as the platform-specific core APIs. Platform-specific extension APIs are retrieved with pLoadProc.
+*/
+void glbLoadExtensionSupportFlags(GLBapi* pAPI, GLint majorVersion, GLBloadproc pLoadProc, void* pUserData)
+{
+    GLboolean hasQueriedExtensions = GL_FALSE;
+
+    glbZeroMemory(pAPI->extensionSupportFlags, sizeof(pAPI->extensionSupportFlags));
+
+#if defined(GLBIND_HAS_GET_STRINGI)
+    if (majorVersion >= 3 && pAPI->glGetStringi != NULL && pAPI->glGetIntegerv != NULL) {
+        GLint iSupportedExtension;
+        GLint supportedExtensionCount = 0;
+        pAPI->glGetIntegerv(GL_NUM_EXTENSIONS, &supportedExtensionCount);
+
+        for (iSupportedExtension = 0; iSupportedExtension < supportedExtensionCount; ++iSupportedExtension) {
+            glbMarkSupportedExtensions((const char*)pAPI->glGetStringi(GL_EXTENSIONS, (GLuint)iSupportedExtension), pAPI->extensionSupportFlags);
+        }
+
+        hasQueriedExtensions = GL_TRUE;
+    }
+#else
+    (void)majorVersion;
+#endif
+
+    if (!hasQueriedExtensions && pAPI->glGetString != NULL) {
+        glbMarkSupportedExtensions((const char*)pAPI->glGetString(GL_EXTENSIONS), pAPI->extensionSupportFlags);
+    }
+
+#if defined(GLBIND_WGL)
+    {
+        PFNWGLGETEXTENSIONSSTRINGARBPROC _wglGetExtensionsStringARB = (PFNWGLGETEXTENSIONSSTRINGARBPROC)pLoadProc(glbGetProcNameByIndex(GLB_PROC_wglGetExtensionsStringARB), pUserData);
+        PFNWGLGETEXTENSIONSSTRINGEXTPROC _wglGetExtensionsStringEXT = (PFNWGLGETEXTENSIONSSTRINGEXTPROC)pLoadProc(glbGetProcNameByIndex(GLB_PROC_wglGetExtensionsStringEXT), pUserData);
+
+        if (_wglGetExtensionsStringARB != NULL && pAPI->wglGetCurrentDC != NULL) {
+            glbMarkSupportedExtensions(_wglGetExtensionsStringARB(pAPI->wglGetCurrentDC()), pAPI->extensionSupportFlags);
+        } else if (_wglGetExtensionsStringEXT != NULL) {
+            glbMarkSupportedExtensions(_wglGetExtensionsStringEXT(), pAPI->extensionSupportFlags);
+        }
+    }
+#endif
+#if defined(GLBIND_GLX)
+    if (pAPI->glXQueryExtensionsString != NULL) {
+        glbind_Display* pDisplay = (pAPI->glXGetCurrentDisplay != NULL) ? pAPI->glXGetCurrentDisplay() : NULL;
+        GLXContext rc = (pAPI->glXGetCurrentContext != NULL) ? pAPI->glXGetCurrentContext() : NULL;
+        int screen = 0;
+
+        if (pDisplay == NULL) {
+            pDisplay = glbGetDisplay();
+        }
+
+        if (pDisplay != NULL) {
+            /* X11 itself is not loaded when the APIs come from the application's loader so XDefaultScreen() is only a fallback. */
+            if (rc != NULL && pAPI->glXQueryContext != NULL) {
+                pAPI->glXQueryContext(pDisplay, rc, GLX_SCREEN, &screen);
+            } else if (g_glbX11SO != NULL && glbind_XDefaultScreen != NULL) {
+                screen = glbind_XDefaultScreen(pDisplay);
+            }
+
+            glbMarkSupportedExtensions(pAPI->glXQueryExtensionsString(pDisplay, screen), pAPI->extensionSupportFlags);
+        }
+    }
+#endif
+#if defined(GLBIND_EGL)
+    if (pAPI->eglQueryString != NULL) {
+        EGLDisplay display = (pAPI->eglGetCurrentDisplay != NULL) ? pAPI->eglGetCurrentDisplay() : EGL_NO_DISPLAY;
+        if (display == EGL_NO_DISPLAY) {
+            display = glbGetDisplay();
+        }
+
+        /* Client extensions, which includes the platform extensions, are not tied to a display. */
+        glbMarkSupportedExtensions(pAPI->eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS), pAPI->extensionSupportFlags);
+
+        if (display != EGL_NO_DISPLAY) {
+            glbMarkSupportedExtensions(pAPI->eglQueryString(display, EGL_EXTENSIONS), pAPI->extensionSupportFlags);
+        }
+    }
+#endif
+
+    pAPI->hasExtensionSupportFlags = GL_TRUE;
+
+    (void)pLoadProc;
+    (void)pUserData;
+}
+
+GLboolean glbIsVersionAtLeast(GLint majorVersion, GLint minorVersion, GLint requiredMajorVersion, GLint requiredMinorVersion)
+{
+    return (majorVersion > requiredMajorVersion || (majorVersion == requiredMajorVersion && minorVersion >= requiredMinorVersion)) ? GL_TRUE : GL_FALSE;
+}
+
+/* Sets the GLB_GL_VERSION_X_Y and GLB_HAS_<extension> flags. The extension support flags must have been loaded beforehand. */
+void glbLoadCapabilityFlags(GLBapi* pAPI, GLint majorVersion, GLint minorVersion)
+{
+/*<<set_capability_flags>>*/
+}
+
+#if defined(GLBIND_LOAD_SUPPORTED_ONLY)
+/*<<require_lists>>*/
+
+void glbLoadProcsByIndex(GLBproc* pProcs, const GLushort* pIndices, size_t count, GLBloadproc pLoadProc, void* pUserData)
+{
+    size_t i;
+    for (i = 0; i < count; ++i) {
+        if (pProcs[pIndices[i]] == NULL) {
+            pProcs[pIndices[i]] = pLoadProc(glbGetProcNameByIndex(pIndices[i]), pUserData);
+        }
+    }
+}
+
+/*
+Only loads the APIs for the versions and extensions supported by the current context. This requires that a context be current because
+the version and extensions are queried before loading anything else.
+*/
+GLenum glbLoadSupportedProcs(GLBapi* pAPI, GLBloadproc pLoadProc, void* pUserData)
+{
+    GLenum result;
+    GLBproc* pProcs;
+    GLint majorVersion;
+    GLint minorVersion;
+    size_t iRequire;
+    size_t iExtension;
+
+    pProcs = GLB_PROCS(pAPI);
+
+    /* These are needed up front for querying the version and the supported extensions. */
+    pAPI->glGetString   = (PFNGLGETSTRINGPROC  )pLoadProc(glbGetProcNameByIndex(GLB_PROC_glGetString),   pUserData);
+#if defined(GLBIND_HAS_GET_STRINGI)
+    pAPI->glGetStringi  = (PFNGLGETSTRINGIPROC )pLoadProc(glbGetProcNameByIndex(GLB_PROC_glGetStringi),  pUserData);
+#endif
+    pAPI->glGetIntegerv = (PFNGLGETINTEGERVPROC)pLoadProc(glbGetProcNameByIndex(GLB_PROC_glGetIntegerv), pUserData);
+
+    result = glbGetContextVersion(pAPI, &majorVersion, &minorVersion);
+    if (result != GL_NO_ERROR) {
+        return result;
+    }
+
+    /* Versions. Platform-specific APIs are given a version of 0.0 so they're always loaded. */
+    iRequire = 0;
+    while (iRequire < sizeof(glbind_FeatureRequires) / sizeof(glbind_FeatureRequires[0])) {
+        GLint  featureMajorVersion = glbind_FeatureRequires[iRequire + 0];
+        GLint  featureMinorVersion = glbind_FeatureRequires[iRequire + 1];
+        size_t count               = glbind_FeatureRequires[iRequire + 2];
+        iRequire += 3;
+
+        if (glbIsVersionAtLeast(majorVersion, minorVersion, featureMajorVersion, featureMinorVersion)) {
+            glbLoadProcsByIndex(pProcs, glbind_FeatureRequires + iRequire, count, pLoadProc, pUserData);
+        }
+
+        iRequire += count;
+    }
+
+    /* Extensions. */
+    glbLoadExtensionSupportFlags(pAPI, majorVersion, pLoadProc, pUserData);
+
+    iRequire = 0;
+    for (iExtension = 0; iExtension < GLB_EXTENSION_COUNT; ++iExtension) {
+        size_t count = glbind_ExtensionRequires[iRequire];
+        iRequire += 1;
+
+        if (glbHasExtensionSupportFlag(pAPI->extensionSupportFlags, iExtension)) {
+            glbLoadProcsByIndex(pProcs, glbind_ExtensionRequires + iRequire, count, pLoadProc, pUserData);
+        }
+
+        iRequire += count;
+    }
+
+    glbLoadCapabilityFlags(pAPI, majorVersion, minorVersion);
+
+    return GL_NO_ERROR;
+}
+#endif  /* GLBIND_LOAD_SUPPORTED_ONLY */
+
+GLenum glbInitFromLoader(GLBloadproc pLoadProc, void* pUserData, GLBapi* pAPI)
+{
+    if (pLoadProc == NULL || pAPI == NULL) {
+        return GL_INVALID_OPERATION;
+    }
+
+    glbZeroObject(pAPI);
+
+#if defined(GLBIND_LOAD_SUPPORTED_ONLY)
+    return glbLoadSupportedProcs(pAPI, pLoadProc, pUserData);
+#else
+    {
+        GLenum result;
+        GLint majorVersion;
+        GLint minorVersion;
+
+        result = glbLoadAllProcs(pAPI, pLoadProc, pUserData);
+        if (result != GL_NO_ERROR) {
+            return result;
+        }
+
+        /* Cache the supported extensions. If no context is current we just leave the flags unset and extension checks will query the driver instead. */
+        if (glbGetContextVersion(pAPI, &majorVersion, &minorVersion) == GL_NO_ERROR) {
+            glbLoadExtensionSupportFlags(pAPI, majorVersion, pLoadProc, pUserData);
+            glbLoadCapabilityFlags(pAPI, majorVersion, minorVersion);
+        }
+
+        return GL_NO_ERROR;
+    }
+#endif
+}
+
+GLenum glbInitCurrentContextAPIWithStats(GLBapi* pAPI, GLBinitStats* pStats)
+{
+    return glbInitFromLoader(glbDefaultLoadProc, pStats, pAPI);
+}
+
+GLenum glbInitCurrentContextAPI(GLBapi* pAPI)
+{
+    GLBinitStats stats;
+    GLenum result;
+
+    glbInitStatsBeg(&stats);
+    glbInitPhaseBeg(&stats, GLB_INIT_PHASE_LOAD_PROCS);
+    result = glbInitCurrentContextAPIWithStats(pAPI, &stats);
+    glbInitPhaseEnd(&stats, GLB_INIT_PHASE_LOAD_PROCS);
+    glbInitStatsEnd(&stats, result);
+
+    return result;
+}
+
+typedef struct glbind_ContextAPICacheEntry glbind_ContextAPICacheEntry;
+struct glbind_ContextAPICacheEntry
+{
+    glbind_ContextAPICacheEntry* pNext;
+    const char* pDriverID;  /* "vendor\nrenderer\nversion". Allocated along with the entry. */
+
+    /*
+    The driver strings are the same for core and compatibility contexts, and for debug and non-debug contexts, so these are part of the
+    key as well. The extension flags and, with LOAD_SUPPORTED_ONLY, the procs that were loaded can depend on both.
+    */
+    GLint profileMask;      /* GL_CONTEXT_PROFILE_MASK. Zero before OpenGL 3.2. */
+    GLint contextFlags;     /* GL_CONTEXT_FLAGS. Zero before OpenGL 3.0. */
+
+    /* The platform extensions are queried per display, and with GLX, per screen. */
+#if defined(GLBIND_GLX)
+    glbind_Display* pDisplay;
+    int screen;
+#endif
+#if defined(GLBIND_EGL)
+    EGLDisplay display;
+#endif
+
+    GLBapi api;
+};
+
+static glbind_ContextAPICacheEntry* g_glbContextAPICache = NULL;
+static volatile long g_glbContextAPICacheLock = 0;
+
+void glbContextAPICacheLock(void)
+{
+    glbSpinLock(&g_glbContextAPICacheLock);
+}
+
+void glbContextAPICacheUnlock(void)
+{
+    glbSpinUnlock(&g_glbContextAPICacheLock);
+}
+
+/* Must be called while the lock is held. Everything other than pNext and api is compared. */
+const GLBapi* glbFindContextAPIInCache(const glbind_ContextAPICacheEntry* pKey)
+{
+    glbind_ContextAPICacheEntry* pEntry;
+    for (pEntry = g_glbContextAPICache; pEntry != NULL; pEntry = pEntry->pNext) {
+        if (pEntry->profileMask  != pKey->profileMask  ||
+            pEntry->contextFlags != pKey->contextFlags) {
+            continue;
+        }
+    #if defined(GLBIND_GLX)
+        if (pEntry->pDisplay != pKey->pDisplay || pEntry->screen != pKey->screen) {
+            continue;
+        }
+    #endif
+    #if defined(GLBIND_EGL)
+        if (pEntry->display != pKey->display) {
+            continue;
+        }
+    #endif
+
+        if (glb_strcmp(pEntry->pDriverID, pKey->pDriverID) == 0) {
+            return &pEntry->api;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+Fills in the parts of a cache entry's key which aren't in the driver ID. This needs to match how glbInitFromLoader() queries the extensions,
+in particular which display and screen the platform extensions come from.
+*/
+void glbInitContextAPICacheKey(glbind_ContextAPICacheEntry* pEntry, GLint majorVersion, GLint minorVersion, GLBinitStats* pStats)
+{
+    PFNGLGETINTEGERVPROC _glGetIntegerv;
+
+    (void)majorVersion;
+    (void)minorVersion;
+
+    pEntry->profileMask  = 0;
+    pEntry->contextFlags = 0;
+
+    _glGetIntegerv = (PFNGLGETINTEGERVPROC)glbGetProcAddressWithStats(glbGetProcNameByIndex(GLB_PROC_glGetIntegerv), pStats);
+    if (_glGetIntegerv != NULL) {
+    #if defined(GL_CONTEXT_FLAGS)
+        if (majorVersion >= 3) {
+            _glGetIntegerv(GL_CONTEXT_FLAGS, &pEntry->contextFlags);
+        }
+    #endif
+    #if defined(GL_CONTEXT_PROFILE_MASK)
+        if (majorVersion > 3 || (majorVersion == 3 && minorVersion >= 2)) {
+            _glGetIntegerv(GL_CONTEXT_PROFILE_MASK, &pEntry->profileMask);
+        }
+    #endif
+    }
+
+#if defined(GLBIND_GLX)
+    {
+        GLXContext rc = (glbind_glXGetCurrentContext != NULL) ? glbind_glXGetCurrentContext() : NULL;
+
+        pEntry->pDisplay = (glbind_glXGetCurrentDisplay != NULL) ? glbind_glXGetCurrentDisplay() : NULL;
+        pEntry->screen   = 0;
+
+        if (pEntry->pDisplay == NULL) {
+            pEntry->pDisplay = glbGetDisplay();
+        }
+
+        if (pEntry->pDisplay != NULL) {
+            PFNGLXQUERYCONTEXTPROC _glXQueryContext = (PFNGLXQUERYCONTEXTPROC)glbGetProcAddressWithStats("glXQueryContext", pStats);
+            if (rc != NULL && _glXQueryContext != NULL) {
+                _glXQueryContext(pEntry->pDisplay, rc, GLX_SCREEN, &pEntry->screen);
+            } else if (g_glbX11SO != NULL && glbind_XDefaultScreen != NULL) {
+                pEntry->screen = glbind_XDefaultScreen(pEntry->pDisplay);
+            }
+        }
+    }
+#endif
+#if defined(GLBIND_EGL)
+    pEntry->display = (glbind_eglGetCurrentDisplay != NULL) ? glbind_eglGetCurrentDisplay() : EGL_NO_DISPLAY;
+    if (pEntry->display == EGL_NO_DISPLAY) {
+        pEntry->display = glbGetDisplay();
+    }
+#endif
+}
+
+void glbFreeContextAPICache(void)
+{
+    glbContextAPICacheLock();
+    {
+        while (g_glbContextAPICache != NULL) {
+            glbind_ContextAPICacheEntry* pNext = g_glbContextAPICache->pNext;
+            free(g_glbContextAPICache);
+            g_glbContextAPICache = pNext;
+        }
+    }
+    glbContextAPICacheUnlock();
+}
+
+const GLBapi* glbGetSharedCurrentContextAPIWithStats(GLBinitStats* pStats)
+{
+    PFNGLGETSTRINGPROC _glGetString;
+    const char* pDriverStrings[3];
+    size_t driverStringLengths[3];
+    size_t driverIDLength;
+    size_t i;
+    glbind_ContextAPICacheEntry* pNewEntry;
+    char* pDriverID;
+    GLint majorVersion;
+    GLint minorVersion;
+    const GLBapi* pSharedAPI;
+
+    _glGetString = (PFNGLGETSTRINGPROC)glbGetProcAddressWithStats(glbGetProcNameByIndex(GLB_PROC_glGetString), pStats);
+    if (_glGetString == NULL) {
+        return NULL;
+    }
+
+    pDriverStrings[0] = (const char*)_glGetString(GL_VENDOR);
+    pDriverStrings[1] = (const char*)_glGetString(GL_RENDERER);
+    pDriverStrings[2] = (const char*)_glGetString(GL_VERSION);
+
+    driverIDLength = 0;
+    for (i = 0; i < 3; ++i) {
+        if (pDriverStrings[i] == NULL) {
+            return NULL;    /* Probably no context is current. */
+        }
+
+        driverStringLengths[i] = glb_strlen(pDriverStrings[i]);
+        driverIDLength += driverStringLengths[i] + 1;   /* +1 for the separator or null terminator. */
+    }
+
+    /* The ID and the entry are allocated together. The ID is built up front since we need it for the lookup anyway. */
+    pNewEntry = (glbind_ContextAPICacheEntry*)malloc(sizeof(*pNewEntry) + driverIDLength);
+    if (pNewEntry == NULL) {
+        return NULL;
+    }
+
+    pDriverID = (char*)(pNewEntry + 1);
+    pNewEntry->pDriverID = pDriverID;
+    for (i = 0; i < 3; ++i) {
+        size_t iChar;
+        for (iChar = 0; iChar < driverStringLengths[i]; ++iChar) {
+            pDriverID[iChar] = pDriverStrings[i][iChar];
+        }
+        pDriverID[driverStringLengths[i]] = (i < 2) ? '\n' : '\0';
+        pDriverID += driverStringLengths[i] + 1;
+    }
+
+    glbParseVersionString(pDriverStrings[2], &majorVersion, &minorVersion);
+    glbInitContextAPICacheKey(pNewEntry, majorVersion, minorVersion, pStats);
+
+    glbContextAPICacheLock();
+    {
+        pSharedAPI = glbFindContextAPIInCache(pNewEntry);
+    }
+    glbContextAPICacheUnlock();
+
+    if (pSharedAPI != NULL) {
+        if (pStats != NULL) {
+            pStats->fromCache = GL_TRUE;
+        }
+
+        free(pNewEntry);
+        return pSharedAPI;
+    }
+
+    /* Not cached yet. The APIs are retrieved without holding the lock since this is the slow part. */
+    if (glbInitCurrentContextAPIWithStats(&pNewEntry->api, pStats) != GL_NO_ERROR) {
+        free(pNewEntry);
+        return NULL;
+    }
+
+    glbContextAPICacheLock();
+    {
+        /* Another thread may have cached the same driver in the meantime. */
+        pSharedAPI = glbFindContextAPIInCache(pNewEntry);
+        if (pSharedAPI == NULL) {
+            pNewEntry->pNext = g_glbContextAPICache;
+            g_glbContextAPICache = pNewEntry;
+            pSharedAPI = &pNewEntry->api;
+            pNewEntry = NULL;
+        }
+    }
+    glbContextAPICacheUnlock();
+
+    if (pNewEntry != NULL) {
+        free(pNewEntry);
+    }
+
+    return pSharedAPI;
+}
+
+const GLBapi* glbGetSharedCurrentContextAPI(void)
+{
+    return glbGetSharedCurrentContextAPIWithStats(NULL);
+}
+
+#if defined(GLBIND_WGL)
+const GLBapi* glbGetSharedContextAPI(HDC dc, HGLRC rc)
+{
+    const GLBapi* pSharedAPI;
     HDC dcPrev;
     HGLRC rcPrev;
-    
+
     dcPrev = glbind_wglGetCurrentDC();
     rcPrev = glbind_wglGetCurrentContext();
 
     if (dcPrev != dc && rcPrev != rc) {
         glbind_wglMakeCurrent(dc, rc);
     }
-    
-    result = glbInitCurrentContextAPI(pAPI);
-    
+
+    pSharedAPI = glbGetSharedCurrentContextAPI();
+
     if (dcPrev != dc && rcPrev != rc) {
         glbind_wglMakeCurrent(dcPrev, rcPrev);
     }
 
-    return result;
+    return pSharedAPI;
 }
 #endif
 #if defined(GLBIND_GLX)
-GLenum glbInitContextAPI(Display *dpy, GLXDrawable drawable, GLXContext rc, GLBapi* pAPI)
+const GLBapi* glbGetSharedContextAPI(glbind_Display* dpy, GLXDrawable drawable, GLXContext rc)
 {
-    GLenum result;
+    const GLBapi* pSharedAPI;
     GLXContext rcPrev = 0;
     GLXDrawable drawablePrev = 0;
     glbind_Display* dpyPrev = NULL;
@@ -932,25 +2946,57 @@ GLenum glbInitContextAPI(Display *dpy, GLXDrawable drawable, GLXContext rc, GLBa
     }
 
     glbind_glXMakeCurrent(dpy, drawable, rc);
-    result = glbInitCurrentContextAPI(pAPI);
+    pSharedAPI = glbGetSharedCurrentContextAPI();
     glbind_glXMakeCurrent(dpyPrev, drawablePrev, rcPrev);
 
-    return result;
+    return pSharedAPI;
 }
 #endif
-
-GLenum glbInitCurrentContextAPI(GLBapi* pAPI)
+#if defined(GLBIND_EGL)
+const GLBapi* glbGetSharedContextAPI(EGLDisplay dpy, EGLSurface surface, EGLContext rc)
 {
-    if (pAPI == NULL) {
-        return GL_INVALID_OPERATION;
+    const GLBapi* pSharedAPI;
+    EGLDisplay dpyPrev;
+    EGLSurface drawPrev;
+    EGLSurface readPrev;
+    EGLContext rcPrev;
+
+    dpyPrev  = glbind_eglGetCurrentDisplay();
+    drawPrev = glbind_eglGetCurrentSurface(EGL_DRAW);
+    readPrev = glbind_eglGetCurrentSurface(EGL_READ);
+    rcPrev   = glbind_eglGetCurrentContext();
+
+    if (rcPrev != rc) {
+        glbind_eglMakeCurrent(dpy, surface, surface, rc);
     }
 
-    glbZeroObject(pAPI);
+    pSharedAPI = glbGetSharedCurrentContextAPI();
 
-/*<<init_current_context_api>>*/
+    if (rcPrev != rc) {
+        if (dpyPrev != EGL_NO_DISPLAY) {
+            glbind_eglMakeCurrent(dpyPrev, drawPrev, readPrev, rcPrev);
+        } else {
+            glbind_eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);  /* Nothing was current beforehand. */
+        }
+    }
 
-    return GL_NO_ERROR;
+    return pSharedAPI;
+}
+#endif
+
+#if defined(GLBIND_LAZY)
+/*<<lazy_trampolines>>*/
+
+/* Points every global function pointer back at its trampoline so that none of them are left pointing into the library once it's unloaded. */
+void glbResetLazyTrampolines(void)
+{
+/*<<reset_lazy_trampolines>>*/
 }
+#endif  /* GLBIND_LAZY */
+
+#if defined(GLBIND_TLS_DISPATCH)
+/*<<tls_dispatch>>*/
+#endif  /* GLBIND_TLS_DISPATCH */
 
 void glbUninit(void)
 {
@@ -972,23 +3018,19 @@ void glbUninit(void)
         glbind_DC = 0;
 #endif
 #if defined(GLBIND_GLX)
-        if (glbind_RC) {
-            glbind_glXDestroyContext(glbind_pDisplay, glbind_RC);
-            glbind_RC = 0;
-        }
-        if (glbind_DummyWindow) {
-            glbind_XDestroyWindow(glbind_pDisplay, glbind_DummyWindow);
-            glbind_DummyWindow = 0;
-        }
-        if (glbind_pDisplay && glbind_OwnsDisplay) {
-            glbind_XCloseDisplay(glbind_pDisplay);
-            glbind_pDisplay    = 0;
-            glbind_OwnsDisplay = GL_FALSE;
-        }
+        glbUninitGLXObjects();
+#endif
+#if defined(GLBIND_EGL)
+        glbUninitEGLObjects();
 #endif
 
-        glb_dlclose(g_glbOpenGLSO);
-        g_glbOpenGLSO = NULL;
+        glbFreeContextAPICache();
+
+#if defined(GLBIND_LAZY)
+        glbResetLazyTrampolines();
+#endif
+
+        glbUnloadOpenGLSO();
     }
 }
 
@@ -999,10 +3041,13 @@ GLenum glbBindAPI(const GLBapi* pAPI)
     if (pAPI == NULL) {
         GLBapi tempAPI;
 #if defined(GLBIND_WGL)
-        result = glbInitContextAPI(glbind_DC, glbind_RC, &tempAPI);
+        result = glbInitContextAPIWithStats(glbind_DC, glbind_RC, &tempAPI, NULL);
 #endif
 #if defined(GLBIND_GLX)
-        result = glbInitContextAPI(glbind_pDisplay, glbind_DummyWindow, glbind_RC, &tempAPI);
+        result = glbInitContextAPIWithStats(glbind_pDisplay, glbind_DummyDrawable, glbind_RC, &tempAPI, NULL);
+#endif
+#if defined(GLBIND_EGL)
+        result = glbInitContextAPIWithStats(glbind_EGLDisplay, glbind_EGLSurface, glbind_RC, &tempAPI, NULL);
 #endif
         if (result != GL_NO_ERROR) {
             return result;
@@ -1011,11 +3056,84 @@ GLenum glbBindAPI(const GLBapi* pAPI)
         return glbBindAPI(&tempAPI);
     }
 
+#if defined(GLBIND_TLS_DISPATCH)
+    g_glbBoundAPI = *pAPI;
+    glbind_pCurrentAPI = &g_glbBoundAPI;
+#else
 /*<<set_global_api_from_struct>>*/
+#endif
+
+    {
+        size_t i;
+        for (i = 0; i < sizeof(g_glbExtensionSupportFlags); ++i) {
+            g_glbExtensionSupportFlags[i] = pAPI->extensionSupportFlags[i];
+        }
+
+        g_glbHasExtensionSupportFlags = pAPI->hasExtensionSupportFlags;
+    }
+
+/*<<set_global_capability_flags_from_struct>>*/
 
     return GL_NO_ERROR;
 }
 
+#if defined(GLBIND_TLS_DISPATCH)
+void glbSetCurrentAPI(const GLBapi* pAPI)
+{
+    glbind_pCurrentAPI = (pAPI != NULL) ? pAPI : &g_glbBoundAPI;
+}
+
+const GLBapi* glbGetCurrentAPI(void)
+{
+    return glbind_pCurrentAPI;
+}
+#endif
+
+GLboolean glbMakeCurrentAPI(const GLBapi* pAPI)
+{
+    if (pAPI == NULL) {
+        return GL_TRUE;
+    }
+
+#if defined(GLBIND_TLS_DISPATCH)
+    glbSetCurrentAPI(pAPI);
+    return GL_TRUE;
+#else
+    return (glbBindAPI(pAPI) == GL_NO_ERROR) ? GL_TRUE : GL_FALSE;
+#endif
+}
+
+#if defined(GLBIND_WGL)
+GLboolean glbMakeCurrent(HDC dc, HGLRC rc, const GLBapi* pAPI)
+{
+    if (!glbind_wglMakeCurrent(dc, rc)) {
+        return GL_FALSE;
+    }
+
+    return glbMakeCurrentAPI(pAPI);
+}
+#endif
+#if defined(GLBIND_GLX)
+GLboolean glbMakeCurrent(glbind_Display* dpy, GLXDrawable drawable, GLXContext rc, const GLBapi* pAPI)
+{
+    if (!glbind_glXMakeCurrent(dpy, drawable, rc)) {
+        return GL_FALSE;
+    }
+
+    return glbMakeCurrentAPI(pAPI);
+}
+#endif
+#if defined(GLBIND_EGL)
+GLboolean glbMakeCurrent(EGLDisplay dpy, EGLSurface surface, EGLContext rc, const GLBapi* pAPI)
+{
+    if (!glbind_eglMakeCurrent(dpy, surface, surface, rc)) {
+        return GL_FALSE;
+    }
+
+    return glbMakeCurrentAPI(pAPI);
+}
+#endif
+
 #if defined(GLBIND_WGL)
 HGLRC glbGetRC(void)
 {
@@ -1049,6 +3167,11 @@ GLXContext glbGetRC(void)
     return glbind_RC;
 }
 
+GLXDrawable glbGetDrawable(void)
+{
+    return glbind_DummyDrawable;
+}
+
 Colormap glbGetColormap(void)
 {
     return glbind_DummyColormap;
@@ -1060,64 +3183,28 @@ XVisualInfo* glbGetFBVisualInfo(void)
 }
 #endif
 
-
-int glb_strcmp(const char* s1, const char* s2)
+#if defined(GLBIND_EGL)
+EGLDisplay glbGetDisplay(void)
 {
-    while ((*s1) && (*s1 == *s2)) {
-        ++s1;
-        ++s2;
-    }
-
-    return (*(unsigned char*)s1 - *(unsigned char*)s2);
+    return glbind_EGLDisplay;
 }
 
-int glb_strncmp(const char* s1, const char* s2, size_t n)
+EGLContext glbGetRC(void)
 {
-    while (n && *s1 && (*s1 == *s2)) {
-        ++s1;
-        ++s2;
-        --n;
-    }
-
-    if (n == 0) {
-        return 0;
-    } else {
-        return (*(unsigned char*)s1 - *(unsigned char*)s2);
-    }
+    return glbind_RC;
 }
 
-GLboolean glbIsExtensionInString(const char* ext, const char* str)
+EGLSurface glbGetSurface(void)
 {
-    const char* ext2beg;
-    const char* ext2end;
-
-    if (ext == NULL || str == NULL) {
-        return GL_FALSE;
-    }
-
-    ext2beg = str;
-    ext2end = ext2beg;
-
-    for (;;) {
-        while (ext2end[0] != ' ' && ext2end[0] != '\0') {
-            ext2end += 1;
-        }
-
-        if (glb_strncmp(ext, ext2beg, ext2end - ext2beg) == 0) {
-            return GL_TRUE;
-        }
-
-        /* Break if we've reached the end. Otherwise, just move to start fo the next extension. */
-        if (ext2end[0] == '\0') {
-            break;
-        } else {
-            ext2beg = ext2end + 1;
-            ext2end = ext2beg;
-        }
-    }
+    return glbind_EGLSurface;
+}
 
-    return GL_FALSE;
+EGLConfig glbGetConfig(void)
+{
+    return glbind_EGLConfig;
 }
+#endif
+
 
 #if defined(GLBIND_WGL)
 GLboolean glbIsExtensionSupportedWGL(GLBapi* pAPI, const char* extensionName)
@@ -1126,6 +3213,14 @@ GLboolean glbIsExtensionSupportedWGL(GLBapi* pAPI, const char* extensionName)
     PFNWGLGETEXTENSIONSSTRINGEXTPROC _wglGetExtensionsStringEXT = (pAPI != NULL) ? pAPI->wglGetExtensionsStringEXT : wglGetExtensionsStringEXT;
     PFNWGLGETCURRENTDCPROC           _wglGetCurrentDC           = (pAPI != NULL) ? pAPI->wglGetCurrentDC           : glbind_wglGetCurrentDC;
 
+#if defined(GLBIND_LAZY)
+    /* In lazy mode the global function pointers are never null so we need to explicitly check whether or not these are available. */
+    if (pAPI == NULL) {
+        _wglGetExtensionsStringARB = (PFNWGLGETEXTENSIONSSTRINGARBPROC)glbGetProcAddressByIndex(GLB_PROC_wglGetExtensionsStringARB);
+        _wglGetExtensionsStringEXT = (PFNWGLGETEXTENSIONSSTRINGEXTPROC)glbGetProcAddressByIndex(GLB_PROC_wglGetExtensionsStringEXT);
+    }
+#endif
+
     if (_wglGetExtensionsStringARB) {
         return glbIsExtensionInString(extensionName, _wglGetExtensionsStringARB(_wglGetCurrentDC()));
     }
@@ -1141,21 +3236,112 @@ GLboolean glbIsExtensionSupportedWGL(GLBapi* pAPI, const char* extensionName)
 GLboolean glbIsExtensionSupportedGLX(GLBapi* pAPI, const char* extensionName)
 {
     PFNGLXQUERYEXTENSIONSSTRINGPROC _glXQueryExtensionsString = (pAPI != NULL) ? pAPI->glXQueryExtensionsString : glbind_glXQueryExtensionsString;
+    glbind_Display* pDisplay;
+    GLXContext rc;
+    int screen = 0;
+
+    if (_glXQueryExtensionsString == NULL) {
+        return GL_FALSE;
+    }
+
+    /* None of glbind's own objects exist when the API object came from glbInitFromLoader() without glbInit(). */
+    if (pAPI != NULL) {
+        pDisplay = (pAPI->glXGetCurrentDisplay != NULL) ? pAPI->glXGetCurrentDisplay() : NULL;
+        rc       = (pAPI->glXGetCurrentContext != NULL) ? pAPI->glXGetCurrentContext() : NULL;
+    } else {
+        pDisplay = (glbind_glXGetCurrentDisplay != NULL) ? glbind_glXGetCurrentDisplay() : NULL;
+        rc       = (glbind_glXGetCurrentContext != NULL) ? glbind_glXGetCurrentContext() : NULL;
+    }
 
-    if (_glXQueryExtensionsString) {
-        return glbIsExtensionInString(extensionName, _glXQueryExtensionsString(glbGetDisplay(), glbind_XDefaultScreen(glbGetDisplay())));
+    if (pDisplay == NULL) {
+        pDisplay = glbGetDisplay();
     }
 
-    return GL_FALSE;
+    if (pDisplay == NULL) {
+        return GL_FALSE;
+    }
+
+    /* The same as glbLoadExtensionSupportFlags(). X11 itself is not loaded when the APIs come from the application's loader. */
+    if (pAPI != NULL && rc != NULL && pAPI->glXQueryContext != NULL) {
+        pAPI->glXQueryContext(pDisplay, rc, GLX_SCREEN, &screen);
+    } else if (g_glbX11SO != NULL && glbind_XDefaultScreen != NULL) {
+        screen = glbind_XDefaultScreen(pDisplay);
+    }
+
+    return glbIsExtensionInString(extensionName, _glXQueryExtensionsString(pDisplay, screen));
+}
+#endif
+
+#if defined(GLBIND_EGL)
+GLboolean glbIsExtensionSupportedEGL(GLBapi* pAPI, const char* extensionName)
+{
+    PFNEGLQUERYSTRINGPROC _eglQueryString = (pAPI != NULL) ? pAPI->eglQueryString : glbind_eglQueryString;
+    EGLDisplay display;
+
+    if (_eglQueryString == NULL) {
+        return GL_FALSE;
+    }
+
+    /* Client extensions first. These are not tied to a display. */
+    if (glbIsExtensionInString(extensionName, _eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS))) {
+        return GL_TRUE;
+    }
+
+    if (pAPI != NULL) {
+        display = (pAPI->eglGetCurrentDisplay != NULL) ? pAPI->eglGetCurrentDisplay() : EGL_NO_DISPLAY;
+    } else {
+        display = (glbind_eglGetCurrentDisplay != NULL) ? glbind_eglGetCurrentDisplay() : EGL_NO_DISPLAY;
+    }
+
+    if (display == EGL_NO_DISPLAY) {
+        display = glbGetDisplay();
+    }
+
+    if (display == EGL_NO_DISPLAY) {
+        return GL_FALSE;
+    }
+
+    return glbIsExtensionInString(extensionName, _eglQueryString(display, EGL_EXTENSIONS));
 }
 #endif
 
 GLboolean glbIsExtensionSupported(GLBapi* pAPI, const char* extensionName)
 {
     GLboolean isSupported = GL_FALSE;
+#if defined(GLBIND_HAS_GET_STRINGI)
     PFNGLGETSTRINGIPROC  _glGetStringi  = (pAPI != NULL) ? pAPI->glGetStringi  : glGetStringi;
-    PFNGLGETSTRINGPROC   _glGetString   = (pAPI != NULL) ? pAPI->glGetString   : glGetString;
     PFNGLGETINTEGERVPROC _glGetIntegerv = (pAPI != NULL) ? pAPI->glGetIntegerv : glGetIntegerv;
+#endif
+    PFNGLGETSTRINGPROC   _glGetString   = (pAPI != NULL) ? pAPI->glGetString   : glGetString;
+    const GLubyte* pExtensionSupportFlags   = (pAPI != NULL) ? pAPI->extensionSupportFlags    : g_glbExtensionSupportFlags;
+    GLboolean      hasExtensionSupportFlags = (pAPI != NULL) ? pAPI->hasExtensionSupportFlags : g_glbHasExtensionSupportFlags;
+
+#if defined(GLBIND_TLS_DISPATCH)
+    /* Global scope is specific to the calling thread in this mode. */
+    if (pAPI == NULL) {
+        return glbIsExtensionSupported((GLBapi*)glbind_pCurrentAPI, extensionName);
+    }
+#endif
+
+    if (extensionName == NULL) {
+        return GL_FALSE;
+    }
+
+    /* Known extensions can be checked with the flags that were cached when the API was initialized. Unknown extensions need to query the driver. */
+    if (hasExtensionSupportFlags) {
+        size_t iExtension = glbFindExtensionIndex(extensionName, glb_strlen(extensionName));
+        if (iExtension < GLB_EXTENSION_COUNT) {
+            return glbHasExtensionSupportFlag(pExtensionSupportFlags, iExtension);
+        }
+    }
+
+#if defined(GLBIND_HAS_GET_STRINGI)
+#if defined(GLBIND_LAZY)
+    /* In lazy mode the global function pointers are never null so we need to explicitly check whether or not glGetStringi() is available. */
+    if (pAPI == NULL) {
+        _glGetStringi = (PFNGLGETSTRINGIPROC)glbGetProcAddressByIndex(GLB_PROC_glGetStringi);
+    }
+#endif
 
     /* Try the new way first. */
     if (_glGetStringi && _glGetIntegerv) {
@@ -1179,9 +3365,13 @@ GLboolean glbIsExtensionSupported(GLBapi* pAPI, const char* extensionName)
 #endif
 #if defined(GLBIND_GLX)
         isSupported = glbIsExtensionSupportedGLX(pAPI, extensionName);
+#endif
+#if defined(GLBIND_EGL)
+        isSupported = glbIsExtensionSupportedEGL(pAPI, extensionName);
 #endif
         return isSupported;
     }
+#endif
 
     /* Fall back to old style. */
     if (_glGetString) {
@@ -1192,6 +3382,9 @@ GLboolean glbIsExtensionSupported(GLBapi* pAPI, const char* extensionName)
 #endif
 #if defined(GLBIND_GLX)
             isSupported = glbIsExtensionSupportedGLX(pAPI, extensionName);
+#endif
+#if defined(GLBIND_EGL)
+            isSupported = glbIsExtensionSupportedEGL(pAPI, extensionName);
 #endif
         }
     }
@@ -1199,6 +3392,29 @@ GLboolean glbIsExtensionSupported(GLBapi* pAPI, const char* extensionName)
     return isSupported;
 }
 
+GLboolean glbIsExtensionSupportedByIndex(GLBapi* pAPI, GLBextension extension)
+{
+    const GLubyte* pExtensionSupportFlags   = (pAPI != NULL) ? pAPI->extensionSupportFlags    : g_glbExtensionSupportFlags;
+    GLboolean      hasExtensionSupportFlags = (pAPI != NULL) ? pAPI->hasExtensionSupportFlags : g_glbHasExtensionSupportFlags;
+
+#if defined(GLBIND_TLS_DISPATCH)
+    if (pAPI == NULL) {
+        return glbIsExtensionSupportedByIndex((GLBapi*)glbind_pCurrentAPI, extension);
+    }
+#endif
+
+    if ((size_t)extension >= GLB_EXTENSION_COUNT) {
+        return GL_FALSE;
+    }
+
+    if (hasExtensionSupportFlags) {
+        return glbHasExtensionSupportFlag(pExtensionSupportFlags, (size_t)extension);
+    }
+
+    /* The flags were never filled out, probably because no context was current at initialization time. Fall back to querying the driver. */
+    return glbIsExtensionSupported(pAPI, glbGetExtensionNameByIndex((size_t)extension));
+}
+
 #endif  /* GLBIND_IMPLEMENTATION */
 
 /*
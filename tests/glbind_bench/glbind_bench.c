@@ -0,0 +1,297 @@
+/*
+Measures how long glbind takes to start up. Each phase is run a number of times and the percentiles of the timings are reported in
+microseconds. The first run of each phase is reported separately because it's usually the only one that's cold.
+
+    glbind_bench [iterations]
+
+The phases are:
+
+    glbLoadOpenGLSO             glb_dlopen() of the OpenGL library and the platform library (libX11, libEGL, gdi32).
+    glbInit                     Everything, including loading the libraries, creating the internal context and retrieving every API.
+    context bootstrap           The part of glbInit() that opens the display, chooses a config and creates the context, from glbGetInitStats().
+    glbInitCurrentContextAPI    Retrieving every API for the current context.
+    glbBindAPI                  Copying an API object to global scope.
+    glbIsExtensionSupported     Checking every known extension by name, as a single batch.
+
+This is followed by a breakdown of a single call to glbInit() from glbGetInitStats().
+
+No GPU is needed. On Linux it can be run against Mesa's llvmpipe under Xvfb:
+
+    xvfb-run -a env LIBGL_ALWAYS_SOFTWARE=1 ./glbind_bench
+
+or without an X server at all by defining GLBIND_EGL when compiling. For numbers that don't depend on the driver at all it can also be run
+against the stub library in tests/glbind_stub, which is what the glbind_bench_stub test does:
+
+    LD_LIBRARY_PATH=stub ./glbind_bench
+*/
+#if !defined(_WIN32)
+#define _POSIX_C_SOURCE 199309L     /* For clock_gettime(). */
+#include <time.h>
+#endif
+
+#define GLBIND_IMPLEMENTATION
+#include "../../glbind.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define GLB_BENCH_DEFAULT_ITERATIONS    100
+
+typedef struct
+{
+    const char* name;
+    double* pSamples;   /* In microseconds. */
+    size_t sampleCount;
+} glbBenchPhase;
+
+/* Microseconds from an arbitrary point in time. */
+double glbBenchNow(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER counter;
+    LARGE_INTEGER frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (double)counter.QuadPart * 1000000.0 / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000000.0 + (double)ts.tv_nsec / 1000.0;
+#endif
+}
+
+GLboolean glbBenchPhaseInit(glbBenchPhase* pPhase, const char* name, size_t iterations)
+{
+    pPhase->name        = name;
+    pPhase->pSamples    = (double*)malloc(sizeof(*pPhase->pSamples) * iterations);
+    pPhase->sampleCount = 0;
+
+    return pPhase->pSamples != NULL;
+}
+
+void glbBenchPhaseUninit(glbBenchPhase* pPhase)
+{
+    free(pPhase->pSamples);
+    pPhase->pSamples = NULL;
+}
+
+void glbBenchPhaseRecord(glbBenchPhase* pPhase, double timeBeg, double timeEnd)
+{
+    pPhase->pSamples[pPhase->sampleCount] = timeEnd - timeBeg;
+    pPhase->sampleCount += 1;
+}
+
+/* Records the combined time of a range of glbInit() phases. Phases that didn't run have no times and add nothing. */
+void glbBenchPhaseRecordInitStats(glbBenchPhase* pPhase, const GLBinitStats* pStats, GLBinitPhase firstPhase, GLBinitPhase lastPhase)
+{
+    double time = 0;
+    int iPhase;
+
+    for (iPhase = (int)firstPhase; iPhase <= (int)lastPhase; ++iPhase) {
+        time += (pStats->phases[iPhase].timeEnd - pStats->phases[iPhase].timeBeg) * 1000000.0;
+    }
+
+    glbBenchPhaseRecord(pPhase, 0, time);
+}
+
+int glbBenchCompareSamples(const void* a, const void* b)
+{
+    double sampleA = *(const double*)a;
+    double sampleB = *(const double*)b;
+
+    if (sampleA < sampleB) {
+        return -1;
+    }
+    if (sampleA > sampleB) {
+        return +1;
+    }
+
+    return 0;
+}
+
+/* Nearest rank. The samples must be sorted. */
+double glbBenchPercentile(const glbBenchPhase* pPhase, size_t percentile)
+{
+    size_t rank = (percentile * pPhase->sampleCount + 99) / 100;
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    return pPhase->pSamples[rank - 1];
+}
+
+void glbBenchPrintHeader(void)
+{
+    printf("%-26s %10s %10s %10s %10s %10s %10s\n", "Phase (us)", "First", "Min", "P50", "P90", "P99", "Max");
+}
+
+void glbBenchPhaseReport(glbBenchPhase* pPhase)
+{
+    double first;
+
+    if (pPhase->sampleCount == 0) {
+        return;
+    }
+
+    first = pPhase->pSamples[0];
+    qsort(pPhase->pSamples, pPhase->sampleCount, sizeof(*pPhase->pSamples), glbBenchCompareSamples);
+
+    printf("%-26s %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n", pPhase->name, first,
+        pPhase->pSamples[0],
+        glbBenchPercentile(pPhase, 50),
+        glbBenchPercentile(pPhase, 90),
+        glbBenchPercentile(pPhase, 99),
+        pPhase->pSamples[pPhase->sampleCount - 1]);
+}
+
+int main(int argc, char** argv)
+{
+    GLenum result;
+    GLBapi api;
+    GLBconfig config;
+    GLBinitStats initStats;
+    GLboolean isStub = GL_FALSE;
+    int stubObject = 0;
+    size_t iterations = GLB_BENCH_DEFAULT_ITERATIONS;
+    size_t iteration;
+    size_t iExtension;
+    int iPhase;
+    size_t supportedExtensionCount = 0;
+    double timeBeg;
+    glbBenchPhase loadPhase;
+    glbBenchPhase initPhase;
+    glbBenchPhase bootstrapPhase;
+    glbBenchPhase initCurrentContextAPIPhase;
+    glbBenchPhase bindPhase;
+    glbBenchPhase extensionPhase;
+
+    if (argc > 1) {
+        iterations = (size_t)atoi(argv[1]);
+        if (iterations == 0) {
+            printf("Usage: glbind_bench [iterations]\n");
+            return -1;
+        }
+    }
+
+    if (!glbBenchPhaseInit(&loadPhase,                  "glbLoadOpenGLSO",          iterations) ||
+        !glbBenchPhaseInit(&initPhase,                  "glbInit",                  iterations) ||
+        !glbBenchPhaseInit(&bootstrapPhase,             "context bootstrap",        iterations) ||
+        !glbBenchPhaseInit(&initCurrentContextAPIPhase, "glbInitCurrentContextAPI", iterations) ||
+        !glbBenchPhaseInit(&bindPhase,                  "glbBindAPI",               iterations) ||
+        !glbBenchPhaseInit(&extensionPhase,             "glbIsExtensionSupported",  iterations)) {
+        printf("Out of memory.\n");
+        return -1;
+    }
+
+    /* This needs to be done before anything else so that the first run is loading the libraries for real. */
+    for (iteration = 0; iteration < iterations; ++iteration) {
+        timeBeg = glbBenchNow();
+        result = glbLoadOpenGLSO();
+        glbBenchPhaseRecord(&loadPhase, timeBeg, glbBenchNow());
+
+        if (result != GL_NO_ERROR) {
+            printf("Failed to load the OpenGL library.\n");
+            return (int)result;
+        }
+
+        isStub = glb_dlsym(g_glbOpenGLSO, "glbStubGetCallCount") != NULL;
+        glbUnloadOpenGLSO();
+    }
+
+    config = glbConfigInit();
+
+#if defined(GLBIND_GLX)
+    /* There's no X server behind the stub library so it needs to be given a display and a context. See glbind_stub_template.c. */
+    if (isStub) {
+        config.pDisplay = (glbind_Display*)&stubObject;
+        config.rc       = (GLXContext)&stubObject;
+        config.drawable = 1;
+    }
+#else
+    (void)isStub;
+    (void)stubObject;
+#endif
+
+    for (iteration = 0; iteration < iterations; ++iteration) {
+        timeBeg = glbBenchNow();
+        result = glbInit(&api, &config);
+        glbBenchPhaseRecord(&initPhase, timeBeg, glbBenchNow());
+
+        if (result != GL_NO_ERROR) {
+            printf("Failed to initialize glbind.\n");
+            return (int)result;
+        }
+
+        glbGetInitStats(&initStats);
+        glbBenchPhaseRecordInitStats(&bootstrapPhase, &initStats, GLB_INIT_PHASE_OPEN_DISPLAY, GLB_INIT_PHASE_CREATE_CONTEXT);
+
+        glbUninit();
+    }
+
+    /* The rest of the phases need a context. */
+    result = glbInit(&api, &config);
+    if (result != GL_NO_ERROR) {
+        printf("Failed to initialize glbind.\n");
+        return (int)result;
+    }
+
+    glbGetInitStats(&initStats);
+
+    for (iteration = 0; iteration < iterations; ++iteration) {
+        timeBeg = glbBenchNow();
+        glbInitCurrentContextAPI(&api);
+        glbBenchPhaseRecord(&initCurrentContextAPIPhase, timeBeg, glbBenchNow());
+    }
+
+    for (iteration = 0; iteration < iterations; ++iteration) {
+        timeBeg = glbBenchNow();
+        glbBindAPI(&api);
+        glbBenchPhaseRecord(&bindPhase, timeBeg, glbBenchNow());
+    }
+
+    for (iteration = 0; iteration < iterations; ++iteration) {
+        supportedExtensionCount = 0;
+
+        timeBeg = glbBenchNow();
+        for (iExtension = 0; iExtension < GLB_EXTENSION_COUNT; ++iExtension) {
+            if (glbIsExtensionSupported(&api, glbGetExtensionNameByIndex(iExtension))) {
+                supportedExtensionCount += 1;
+            }
+        }
+        glbBenchPhaseRecord(&extensionPhase, timeBeg, glbBenchNow());
+    }
+
+    printf("Renderer:   %s\n", (const char*)api.glGetString(GL_RENDERER));
+    printf("Version:    %s\n", (const char*)api.glGetString(GL_VERSION));
+    printf("Iterations: %u\n", (unsigned int)iterations);
+    printf("Extensions: %u known, %u supported\n\n", (unsigned int)GLB_EXTENSION_COUNT, (unsigned int)supportedExtensionCount);
+
+    glbBenchPrintHeader();
+    glbBenchPhaseReport(&loadPhase);
+    glbBenchPhaseReport(&initPhase);
+    glbBenchPhaseReport(&bootstrapPhase);
+    glbBenchPhaseReport(&initCurrentContextAPIPhase);
+    glbBenchPhaseReport(&bindPhase);
+    glbBenchPhaseReport(&extensionPhase);
+
+    printf("\n%-26s %10s\n", "glbInit (us)", "Time");
+    for (iPhase = 0; iPhase < GLB_INIT_PHASE_COUNT; ++iPhase) {
+        const GLBinitPhaseTimes* pTimes = &initStats.phases[iPhase];
+        if (pTimes->timeBeg != 0) {
+            printf("%-26s %10.1f\n", glbGetInitPhaseName((GLBinitPhase)iPhase), (pTimes->timeEnd - pTimes->timeBeg) * 1000000.0);
+        }
+    }
+    printf("%-26s %10.1f\n", "total", (initStats.timeEnd - initStats.timeBeg) * 1000000.0);
+    printf("Lookups: %u, %u returned NULL, %u fell back to dlsym()\n", initStats.lookupCount, initStats.nullLookupCount, initStats.dlsymFallbackCount);
+
+    glbUninit();
+
+    glbBenchPhaseUninit(&loadPhase);
+    glbBenchPhaseUninit(&initPhase);
+    glbBenchPhaseUninit(&bootstrapPhase);
+    glbBenchPhaseUninit(&initCurrentContextAPIPhase);
+    glbBenchPhaseUninit(&bindPhase);
+    glbBenchPhaseUninit(&extensionPhase);
+
+    return 0;
+}
@@ -0,0 +1,19432 @@
+/*
+A stub OpenGL library for testing and benchmarking glbind without a GPU or an X server. This file is generated by glbind_build from
+source/glbind_stub_template.c with --stub. Don't edit it directly.
+
+Build it as a shared library called libGL.so.1, with hidden visibility by default, and put it in front of the real one with
+LD_LIBRARY_PATH. The only functions it exports are the GLX functions used by glbInit() and the glbStub*() functions below.
+glXGetProcAddress() returns a no-op for every command in the registry, which does nothing except count how many times it's been called.
+Since nothing else is exported, commands that glXGetProcAddress() returns NULL for can't be found with dlsym() either.
+
+There's no X server so the application needs to give glbInit() a display and a context in GLBconfig. These are never dereferenced so they
+can be any non-null value:
+
+    config.pDisplay = (glbind_Display*)&dummy;
+    config.rc       = (GLXContext)&dummy;
+    config.drawable = 1;
+
+What the context supports is set with these environment variables, or with the glbStub*() functions which take precedence:
+
+    GLBIND_STUB_VERSION           The OpenGL version, such as "3.3". The default is the latest version in the registry.
+    GLBIND_STUB_EXTENSIONS        The OpenGL extensions separated by spaces. The default is none.
+    GLBIND_STUB_GLX_EXTENSIONS    The GLX extensions separated by spaces. The default is none.
+    GLBIND_STUB_NULL_PROCS        The commands glXGetProcAddress() returns NULL for, separated by spaces. Use "*" for every command.
+
+The settings and counters start over each time the library is loaded, and glbUninit() unloads it. The settings are freed by a destructor
+when it's unloaded so that the stub doesn't add leaks of its own to tests run under a leak checker. None of this is thread-safe.
+*/
+#define GLBIND_TLS_DISPATCH     /* Declares the global names as functions rather than function pointers so they can be defined here. */
+#include "glbind.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(GLBIND_GLX)
+#error "The stub library is only implemented for GLX."
+#endif
+
+#if defined(__GNUC__)
+    #define GLB_STUB_EXPORT __attribute__((visibility("default")))
+    #define GLB_STUB_DESTRUCTOR __attribute__((destructor))
+    #pragma GCC diagnostic ignored "-Wunused-parameter"     /* The no-ops don't use any of their parameters. */
+#else
+    #define GLB_STUB_EXPORT
+    #define GLB_STUB_DESTRUCTOR
+#endif
+
+#define GLB_STUB_DEFAULT_VERSION    "4.6"
+
+/* glGetStringi() was added in OpenGL 3.0 so it won't exist in headers that were generated for an older maximum version. */
+#if !defined(GLBIND_GL_VERSION_MAX_MAJOR) || GLBIND_GL_VERSION_MAX_MAJOR >= 3
+#define GLB_STUB_HAS_GET_STRINGI
+#endif
+
+typedef enum
+{
+    GLB_STUB_PROC_glAccum,
+    GLB_STUB_PROC_glAccumxOES,
+    GLB_STUB_PROC_glAcquireKeyedMutexWin32EXT,
+    GLB_STUB_PROC_glActiveProgramEXT,
+    GLB_STUB_PROC_glActiveShaderProgram,
+    GLB_STUB_PROC_glActiveShaderProgramEXT,
+    GLB_STUB_PROC_glActiveStencilFaceEXT,
+    GLB_STUB_PROC_glActiveTexture,
+    GLB_STUB_PROC_glActiveTextureARB,
+    GLB_STUB_PROC_glActiveVaryingNV,
+    GLB_STUB_PROC_glAlphaFragmentOp1ATI,
+    GLB_STUB_PROC_glAlphaFragmentOp2ATI,
+    GLB_STUB_PROC_glAlphaFragmentOp3ATI,
+    GLB_STUB_PROC_glAlphaFunc,
+    GLB_STUB_PROC_glAlphaFuncxOES,
+    GLB_STUB_PROC_glAlphaToCoverageDitherControlNV,
+    GLB_STUB_PROC_glApplyFramebufferAttachmentCMAAINTEL,
+    GLB_STUB_PROC_glApplyTextureEXT,
+    GLB_STUB_PROC_glAreProgramsResidentNV,
+    GLB_STUB_PROC_glAreTexturesResident,
+    GLB_STUB_PROC_glAreTexturesResidentEXT,
+    GLB_STUB_PROC_glArrayElement,
+    GLB_STUB_PROC_glArrayElementEXT,
+    GLB_STUB_PROC_glArrayObjectATI,
+    GLB_STUB_PROC_glAsyncCopyBufferSubDataNVX,
+    GLB_STUB_PROC_glAsyncCopyImageSubDataNVX,
+    GLB_STUB_PROC_glAsyncMarkerSGIX,
+    GLB_STUB_PROC_glAttachObjectARB,
+    GLB_STUB_PROC_glAttachShader,
+    GLB_STUB_PROC_glBegin,
+    GLB_STUB_PROC_glBeginConditionalRender,
+    GLB_STUB_PROC_glBeginConditionalRenderNV,
+    GLB_STUB_PROC_glBeginConditionalRenderNVX,
+    GLB_STUB_PROC_glBeginFragmentShaderATI,
+    GLB_STUB_PROC_glBeginOcclusionQueryNV,
+    GLB_STUB_PROC_glBeginPerfMonitorAMD,
+    GLB_STUB_PROC_glBeginPerfQueryINTEL,
+    GLB_STUB_PROC_glBeginQuery,
+    GLB_STUB_PROC_glBeginQueryARB,
+    GLB_STUB_PROC_glBeginQueryIndexed,
+    GLB_STUB_PROC_glBeginTransformFeedback,
+    GLB_STUB_PROC_glBeginTransformFeedbackEXT,
+    GLB_STUB_PROC_glBeginTransformFeedbackNV,
+    GLB_STUB_PROC_glBeginVertexShaderEXT,
+    GLB_STUB_PROC_glBeginVideoCaptureNV,
+    GLB_STUB_PROC_glBindAttribLocation,
+    GLB_STUB_PROC_glBindAttribLocationARB,
+    GLB_STUB_PROC_glBindBuffer,
+    GLB_STUB_PROC_glBindBufferARB,
+    GLB_STUB_PROC_glBindBufferBase,
+    GLB_STUB_PROC_glBindBufferBaseEXT,
+    GLB_STUB_PROC_glBindBufferBaseNV,
+    GLB_STUB_PROC_glBindBufferOffsetEXT,
+    GLB_STUB_PROC_glBindBufferOffsetNV,
+    GLB_STUB_PROC_glBindBufferRange,
+    GLB_STUB_PROC_glBindBufferRangeEXT,
+    GLB_STUB_PROC_glBindBufferRangeNV,
+    GLB_STUB_PROC_glBindBuffersBase,
+    GLB_STUB_PROC_glBindBuffersRange,
+    GLB_STUB_PROC_glBindFragDataLocation,
+    GLB_STUB_PROC_glBindFragDataLocationEXT,
+    GLB_STUB_PROC_glBindFragDataLocationIndexed,
+    GLB_STUB_PROC_glBindFragmentShaderATI,
+    GLB_STUB_PROC_glBindFramebuffer,
+    GLB_STUB_PROC_glBindFramebufferEXT,
+    GLB_STUB_PROC_glBindImageTexture,
+    GLB_STUB_PROC_glBindImageTextureEXT,
+    GLB_STUB_PROC_glBindImageTextures,
+    GLB_STUB_PROC_glBindLightParameterEXT,
+    GLB_STUB_PROC_glBindMaterialParameterEXT,
+    GLB_STUB_PROC_glBindMultiTextureEXT,
+    GLB_STUB_PROC_glBindParameterEXT,
+    GLB_STUB_PROC_glBindProgramARB,
+    GLB_STUB_PROC_glBindProgramNV,
+    GLB_STUB_PROC_glBindProgramPipeline,
+    GLB_STUB_PROC_glBindProgramPipelineEXT,
+    GLB_STUB_PROC_glBindRenderbuffer,
+    GLB_STUB_PROC_glBindRenderbufferEXT,
+    GLB_STUB_PROC_glBindSampler,
+    GLB_STUB_PROC_glBindSamplers,
+    GLB_STUB_PROC_glBindShadingRateImageNV,
+    GLB_STUB_PROC_glBindTexGenParameterEXT,
+    GLB_STUB_PROC_glBindTexture,
+    GLB_STUB_PROC_glBindTextureEXT,
+    GLB_STUB_PROC_glBindTextureUnit,
+    GLB_STUB_PROC_glBindTextureUnitParameterEXT,
+    GLB_STUB_PROC_glBindTextures,
+    GLB_STUB_PROC_glBindTransformFeedback,
+    GLB_STUB_PROC_glBindTransformFeedbackNV,
+    GLB_STUB_PROC_glBindVertexArray,
+    GLB_STUB_PROC_glBindVertexArrayAPPLE,
+    GLB_STUB_PROC_glBindVertexBuffer,
+    GLB_STUB_PROC_glBindVertexBuffers,
+    GLB_STUB_PROC_glBindVertexShaderEXT,
+    GLB_STUB_PROC_glBindVideoCaptureStreamBufferNV,
+    GLB_STUB_PROC_glBindVideoCaptureStreamTextureNV,
+    GLB_STUB_PROC_glBinormal3bEXT,
+    GLB_STUB_PROC_glBinormal3bvEXT,
+    GLB_STUB_PROC_glBinormal3dEXT,
+    GLB_STUB_PROC_glBinormal3dvEXT,
+    GLB_STUB_PROC_glBinormal3fEXT,
+    GLB_STUB_PROC_glBinormal3fvEXT,
+    GLB_STUB_PROC_glBinormal3iEXT,
+    GLB_STUB_PROC_glBinormal3ivEXT,
+    GLB_STUB_PROC_glBinormal3sEXT,
+    GLB_STUB_PROC_glBinormal3svEXT,
+    GLB_STUB_PROC_glBinormalPointerEXT,
+    GLB_STUB_PROC_glBitmap,
+    GLB_STUB_PROC_glBitmapxOES,
+    GLB_STUB_PROC_glBlendBarrierKHR,
+    GLB_STUB_PROC_glBlendBarrierNV,
+    GLB_STUB_PROC_glBlendColor,
+    GLB_STUB_PROC_glBlendColorEXT,
+    GLB_STUB_PROC_glBlendColorxOES,
+    GLB_STUB_PROC_glBlendEquation,
+    GLB_STUB_PROC_glBlendEquationEXT,
+    GLB_STUB_PROC_glBlendEquationIndexedAMD,
+    GLB_STUB_PROC_glBlendEquationSeparate,
+    GLB_STUB_PROC_glBlendEquationSeparateEXT,
+    GLB_STUB_PROC_glBlendEquationSeparateIndexedAMD,
+    GLB_STUB_PROC_glBlendEquationSeparatei,
+    GLB_STUB_PROC_glBlendEquationSeparateiARB,
+    GLB_STUB_PROC_glBlendEquationi,
+    GLB_STUB_PROC_glBlendEquationiARB,
+    GLB_STUB_PROC_glBlendFunc,
+    GLB_STUB_PROC_glBlendFuncIndexedAMD,
+    GLB_STUB_PROC_glBlendFuncSeparate,
+    GLB_STUB_PROC_glBlendFuncSeparateEXT,
+    GLB_STUB_PROC_glBlendFuncSeparateINGR,
+    GLB_STUB_PROC_glBlendFuncSeparateIndexedAMD,
+    GLB_STUB_PROC_glBlendFuncSeparatei,
+    GLB_STUB_PROC_glBlendFuncSeparateiARB,
+    GLB_STUB_PROC_glBlendFunci,
+    GLB_STUB_PROC_glBlendFunciARB,
+    GLB_STUB_PROC_glBlendParameteriNV,
+    GLB_STUB_PROC_glBlitFramebuffer,
+    GLB_STUB_PROC_glBlitFramebufferEXT,
+    GLB_STUB_PROC_glBlitNamedFramebuffer,
+    GLB_STUB_PROC_glBufferAddressRangeNV,
+    GLB_STUB_PROC_glBufferAttachMemoryNV,
+    GLB_STUB_PROC_glBufferData,
+    GLB_STUB_PROC_glBufferDataARB,
+    GLB_STUB_PROC_glBufferPageCommitmentARB,
+    GLB_STUB_PROC_glBufferPageCommitmentMemNV,
+    GLB_STUB_PROC_glBufferParameteriAPPLE,
+    GLB_STUB_PROC_glBufferStorage,
+    GLB_STUB_PROC_glBufferStorageExternalEXT,
+    GLB_STUB_PROC_glBufferStorageMemEXT,
+    GLB_STUB_PROC_glBufferSubData,
+    GLB_STUB_PROC_glBufferSubDataARB,
+    GLB_STUB_PROC_glCallCommandListNV,
+    GLB_STUB_PROC_glCallList,
+    GLB_STUB_PROC_glCallLists,
+    GLB_STUB_PROC_glCheckFramebufferStatus,
+    GLB_STUB_PROC_glCheckFramebufferStatusEXT,
+    GLB_STUB_PROC_glCheckNamedFramebufferStatus,
+    GLB_STUB_PROC_glCheckNamedFramebufferStatusEXT,
+    GLB_STUB_PROC_glClampColor,
+    GLB_STUB_PROC_glClampColorARB,
+    GLB_STUB_PROC_glClear,
+    GLB_STUB_PROC_glClearAccum,
+    GLB_STUB_PROC_glClearAccumxOES,
+    GLB_STUB_PROC_glClearBufferData,
+    GLB_STUB_PROC_glClearBufferSubData,
+    GLB_STUB_PROC_glClearBufferfi,
+    GLB_STUB_PROC_glClearBufferfv,
+    GLB_STUB_PROC_glClearBufferiv,
+    GLB_STUB_PROC_glClearBufferuiv,
+    GLB_STUB_PROC_glClearColor,
+    GLB_STUB_PROC_glClearColorIiEXT,
+    GLB_STUB_PROC_glClearColorIuiEXT,
+    GLB_STUB_PROC_glClearColorxOES,
+    GLB_STUB_PROC_glClearDepth,
+    GLB_STUB_PROC_glClearDepthdNV,
+    GLB_STUB_PROC_glClearDepthf,
+    GLB_STUB_PROC_glClearDepthfOES,
+    GLB_STUB_PROC_glClearDepthxOES,
+    GLB_STUB_PROC_glClearIndex,
+    GLB_STUB_PROC_glClearNamedBufferData,
+    GLB_STUB_PROC_glClearNamedBufferDataEXT,
+    GLB_STUB_PROC_glClearNamedBufferSubData,
+    GLB_STUB_PROC_glClearNamedBufferSubDataEXT,
+    GLB_STUB_PROC_glClearNamedFramebufferfi,
+    GLB_STUB_PROC_glClearNamedFramebufferfv,
+    GLB_STUB_PROC_glClearNamedFramebufferiv,
+    GLB_STUB_PROC_glClearNamedFramebufferuiv,
+    GLB_STUB_PROC_glClearStencil,
+    GLB_STUB_PROC_glClearTexImage,
+    GLB_STUB_PROC_glClearTexSubImage,
+    GLB_STUB_PROC_glClientActiveTexture,
+    GLB_STUB_PROC_glClientActiveTextureARB,
+    GLB_STUB_PROC_glClientActiveVertexStreamATI,
+    GLB_STUB_PROC_glClientAttribDefaultEXT,
+    GLB_STUB_PROC_glClientWaitSemaphoreui64NVX,
+    GLB_STUB_PROC_glClientWaitSync,
+    GLB_STUB_PROC_glClipControl,
+    GLB_STUB_PROC_glClipPlane,
+    GLB_STUB_PROC_glClipPlanefOES,
+    GLB_STUB_PROC_glClipPlanexOES,
+    GLB_STUB_PROC_glColor3b,
+    GLB_STUB_PROC_glColor3bv,
+    GLB_STUB_PROC_glColor3d,
+    GLB_STUB_PROC_glColor3dv,
+    GLB_STUB_PROC_glColor3f,
+    GLB_STUB_PROC_glColor3fVertex3fSUN,
+    GLB_STUB_PROC_glColor3fVertex3fvSUN,
+    GLB_STUB_PROC_glColor3fv,
+    GLB_STUB_PROC_glColor3hNV,
+    GLB_STUB_PROC_glColor3hvNV,
+    GLB_STUB_PROC_glColor3i,
+    GLB_STUB_PROC_glColor3iv,
+    GLB_STUB_PROC_glColor3s,
+    GLB_STUB_PROC_glColor3sv,
+    GLB_STUB_PROC_glColor3ub,
+    GLB_STUB_PROC_glColor3ubv,
+    GLB_STUB_PROC_glColor3ui,
+    GLB_STUB_PROC_glColor3uiv,
+    GLB_STUB_PROC_glColor3us,
+    GLB_STUB_PROC_glColor3usv,
+    GLB_STUB_PROC_glColor3xOES,
+    GLB_STUB_PROC_glColor3xvOES,
+    GLB_STUB_PROC_glColor4b,
+    GLB_STUB_PROC_glColor4bv,
+    GLB_STUB_PROC_glColor4d,
+    GLB_STUB_PROC_glColor4dv,
+    GLB_STUB_PROC_glColor4f,
+    GLB_STUB_PROC_glColor4fNormal3fVertex3fSUN,
+    GLB_STUB_PROC_glColor4fNormal3fVertex3fvSUN,
+    GLB_STUB_PROC_glColor4fv,
+    GLB_STUB_PROC_glColor4hNV,
+    GLB_STUB_PROC_glColor4hvNV,
+    GLB_STUB_PROC_glColor4i,
+    GLB_STUB_PROC_glColor4iv,
+    GLB_STUB_PROC_glColor4s,
+    GLB_STUB_PROC_glColor4sv,
+    GLB_STUB_PROC_glColor4ub,
+    GLB_STUB_PROC_glColor4ubVertex2fSUN,
+    GLB_STUB_PROC_glColor4ubVertex2fvSUN,
+    GLB_STUB_PROC_glColor4ubVertex3fSUN,
+    GLB_STUB_PROC_glColor4ubVertex3fvSUN,
+    GLB_STUB_PROC_glColor4ubv,
+    GLB_STUB_PROC_glColor4ui,
+    GLB_STUB_PROC_glColor4uiv,
+    GLB_STUB_PROC_glColor4us,
+    GLB_STUB_PROC_glColor4usv,
+    GLB_STUB_PROC_glColor4xOES,
+    GLB_STUB_PROC_glColor4xvOES,
+    GLB_STUB_PROC_glColorFormatNV,
+    GLB_STUB_PROC_glColorFragmentOp1ATI,
+    GLB_STUB_PROC_glColorFragmentOp2ATI,
+    GLB_STUB_PROC_glColorFragmentOp3ATI,
+    GLB_STUB_PROC_glColorMask,
+    GLB_STUB_PROC_glColorMaskIndexedEXT,
+    GLB_STUB_PROC_glColorMaski,
+    GLB_STUB_PROC_glColorMaterial,
+    GLB_STUB_PROC_glColorP3ui,
+    GLB_STUB_PROC_glColorP3uiv,
+    GLB_STUB_PROC_glColorP4ui,
+    GLB_STUB_PROC_glColorP4uiv,
+    GLB_STUB_PROC_glColorPointer,
+    GLB_STUB_PROC_glColorPointerEXT,
+    GLB_STUB_PROC_glColorPointerListIBM,
+    GLB_STUB_PROC_glColorPointervINTEL,
+    GLB_STUB_PROC_glColorSubTable,
+    GLB_STUB_PROC_glColorSubTableEXT,
+    GLB_STUB_PROC_glColorTable,
+    GLB_STUB_PROC_glColorTableEXT,
+    GLB_STUB_PROC_glColorTableParameterfv,
+    GLB_STUB_PROC_glColorTableParameterfvSGI,
+    GLB_STUB_PROC_glColorTableParameteriv,
+    GLB_STUB_PROC_glColorTableParameterivSGI,
+    GLB_STUB_PROC_glColorTableSGI,
+    GLB_STUB_PROC_glCombinerInputNV,
+    GLB_STUB_PROC_glCombinerOutputNV,
+    GLB_STUB_PROC_glCombinerParameterfNV,
+    GLB_STUB_PROC_glCombinerParameterfvNV,
+    GLB_STUB_PROC_glCombinerParameteriNV,
+    GLB_STUB_PROC_glCombinerParameterivNV,
+    GLB_STUB_PROC_glCombinerStageParameterfvNV,
+    GLB_STUB_PROC_glCommandListSegmentsNV,
+    GLB_STUB_PROC_glCompileCommandListNV,
+    GLB_STUB_PROC_glCompileShader,
+    GLB_STUB_PROC_glCompileShaderARB,
+    GLB_STUB_PROC_glCompileShaderIncludeARB,
+    GLB_STUB_PROC_glCompressedMultiTexImage1DEXT,
+    GLB_STUB_PROC_glCompressedMultiTexImage2DEXT,
+    GLB_STUB_PROC_glCompressedMultiTexImage3DEXT,
+    GLB_STUB_PROC_glCompressedMultiTexSubImage1DEXT,
+    GLB_STUB_PROC_glCompressedMultiTexSubImage2DEXT,
+    GLB_STUB_PROC_glCompressedMultiTexSubImage3DEXT,
+    GLB_STUB_PROC_glCompressedTexImage1D,
+    GLB_STUB_PROC_glCompressedTexImage1DARB,
+    GLB_STUB_PROC_glCompressedTexImage2D,
+    GLB_STUB_PROC_glCompressedTexImage2DARB,
+    GLB_STUB_PROC_glCompressedTexImage3D,
+    GLB_STUB_PROC_glCompressedTexImage3DARB,
+    GLB_STUB_PROC_glCompressedTexSubImage1D,
+    GLB_STUB_PROC_glCompressedTexSubImage1DARB,
+    GLB_STUB_PROC_glCompressedTexSubImage2D,
+    GLB_STUB_PROC_glCompressedTexSubImage2DARB,
+    GLB_STUB_PROC_glCompressedTexSubImage3D,
+    GLB_STUB_PROC_glCompressedTexSubImage3DARB,
+    GLB_STUB_PROC_glCompressedTextureImage1DEXT,
+    GLB_STUB_PROC_glCompressedTextureImage2DEXT,
+    GLB_STUB_PROC_glCompressedTextureImage3DEXT,
+    GLB_STUB_PROC_glCompressedTextureSubImage1D,
+    GLB_STUB_PROC_glCompressedTextureSubImage1DEXT,
+    GLB_STUB_PROC_glCompressedTextureSubImage2D,
+    GLB_STUB_PROC_glCompressedTextureSubImage2DEXT,
+    GLB_STUB_PROC_glCompressedTextureSubImage3D,
+    GLB_STUB_PROC_glCompressedTextureSubImage3DEXT,
+    GLB_STUB_PROC_glConservativeRasterParameterfNV,
+    GLB_STUB_PROC_glConservativeRasterParameteriNV,
+    GLB_STUB_PROC_glConvolutionFilter1D,
+    GLB_STUB_PROC_glConvolutionFilter1DEXT,
+    GLB_STUB_PROC_glConvolutionFilter2D,
+    GLB_STUB_PROC_glConvolutionFilter2DEXT,
+    GLB_STUB_PROC_glConvolutionParameterf,
+    GLB_STUB_PROC_glConvolutionParameterfEXT,
+    GLB_STUB_PROC_glConvolutionParameterfv,
+    GLB_STUB_PROC_glConvolutionParameterfvEXT,
+    GLB_STUB_PROC_glConvolutionParameteri,
+    GLB_STUB_PROC_glConvolutionParameteriEXT,
+    GLB_STUB_PROC_glConvolutionParameteriv,
+    GLB_STUB_PROC_glConvolutionParameterivEXT,
+    GLB_STUB_PROC_glConvolutionParameterxOES,
+    GLB_STUB_PROC_glConvolutionParameterxvOES,
+    GLB_STUB_PROC_glCopyBufferSubData,
+    GLB_STUB_PROC_glCopyColorSubTable,
+    GLB_STUB_PROC_glCopyColorSubTableEXT,
+    GLB_STUB_PROC_glCopyColorTable,
+    GLB_STUB_PROC_glCopyColorTableSGI,
+    GLB_STUB_PROC_glCopyConvolutionFilter1D,
+    GLB_STUB_PROC_glCopyConvolutionFilter1DEXT,
+    GLB_STUB_PROC_glCopyConvolutionFilter2D,
+    GLB_STUB_PROC_glCopyConvolutionFilter2DEXT,
+    GLB_STUB_PROC_glCopyImageSubData,
+    GLB_STUB_PROC_glCopyImageSubDataNV,
+    GLB_STUB_PROC_glCopyMultiTexImage1DEXT,
+    GLB_STUB_PROC_glCopyMultiTexImage2DEXT,
+    GLB_STUB_PROC_glCopyMultiTexSubImage1DEXT,
+    GLB_STUB_PROC_glCopyMultiTexSubImage2DEXT,
+    GLB_STUB_PROC_glCopyMultiTexSubImage3DEXT,
+    GLB_STUB_PROC_glCopyNamedBufferSubData,
+    GLB_STUB_PROC_glCopyPathNV,
+    GLB_STUB_PROC_glCopyPixels,
+    GLB_STUB_PROC_glCopyTexImage1D,
+    GLB_STUB_PROC_glCopyTexImage1DEXT,
+    GLB_STUB_PROC_glCopyTexImage2D,
+    GLB_STUB_PROC_glCopyTexImage2DEXT,
+    GLB_STUB_PROC_glCopyTexSubImage1D,
+    GLB_STUB_PROC_glCopyTexSubImage1DEXT,
+    GLB_STUB_PROC_glCopyTexSubImage2D,
+    GLB_STUB_PROC_glCopyTexSubImage2DEXT,
+    GLB_STUB_PROC_glCopyTexSubImage3D,
+    GLB_STUB_PROC_glCopyTexSubImage3DEXT,
+    GLB_STUB_PROC_glCopyTextureImage1DEXT,
+    GLB_STUB_PROC_glCopyTextureImage2DEXT,
+    GLB_STUB_PROC_glCopyTextureSubImage1D,
+    GLB_STUB_PROC_glCopyTextureSubImage1DEXT,
+    GLB_STUB_PROC_glCopyTextureSubImage2D,
+    GLB_STUB_PROC_glCopyTextureSubImage2DEXT,
+    GLB_STUB_PROC_glCopyTextureSubImage3D,
+    GLB_STUB_PROC_glCopyTextureSubImage3DEXT,
+    GLB_STUB_PROC_glCoverFillPathInstancedNV,
+    GLB_STUB_PROC_glCoverFillPathNV,
+    GLB_STUB_PROC_glCoverStrokePathInstancedNV,
+    GLB_STUB_PROC_glCoverStrokePathNV,
+    GLB_STUB_PROC_glCoverageModulationNV,
+    GLB_STUB_PROC_glCoverageModulationTableNV,
+    GLB_STUB_PROC_glCreateBuffers,
+    GLB_STUB_PROC_glCreateCommandListsNV,
+    GLB_STUB_PROC_glCreateFramebuffers,
+    GLB_STUB_PROC_glCreateMemoryObjectsEXT,
+    GLB_STUB_PROC_glCreatePerfQueryINTEL,
+    GLB_STUB_PROC_glCreateProgram,
+    GLB_STUB_PROC_glCreateProgramObjectARB,
+    GLB_STUB_PROC_glCreateProgramPipelines,
+    GLB_STUB_PROC_glCreateProgressFenceNVX,
+    GLB_STUB_PROC_glCreateQueries,
+    GLB_STUB_PROC_glCreateRenderbuffers,
+    GLB_STUB_PROC_glCreateSamplers,
+    GLB_STUB_PROC_glCreateSemaphoresNV,
+    GLB_STUB_PROC_glCreateShader,
+    GLB_STUB_PROC_glCreateShaderObjectARB,
+    GLB_STUB_PROC_glCreateShaderProgramEXT,
+    GLB_STUB_PROC_glCreateShaderProgramv,
+    GLB_STUB_PROC_glCreateShaderProgramvEXT,
+    GLB_STUB_PROC_glCreateStatesNV,
+    GLB_STUB_PROC_glCreateSyncFromCLeventARB,
+    GLB_STUB_PROC_glCreateTextures,
+    GLB_STUB_PROC_glCreateTransformFeedbacks,
+    GLB_STUB_PROC_glCreateVertexArrays,
+    GLB_STUB_PROC_glCullFace,
+    GLB_STUB_PROC_glCullParameterdvEXT,
+    GLB_STUB_PROC_glCullParameterfvEXT,
+    GLB_STUB_PROC_glCurrentPaletteMatrixARB,
+    GLB_STUB_PROC_glDebugMessageCallback,
+    GLB_STUB_PROC_glDebugMessageCallbackAMD,
+    GLB_STUB_PROC_glDebugMessageCallbackARB,
+    GLB_STUB_PROC_glDebugMessageCallbackKHR,
+    GLB_STUB_PROC_glDebugMessageControl,
+    GLB_STUB_PROC_glDebugMessageControlARB,
+    GLB_STUB_PROC_glDebugMessageControlKHR,
+    GLB_STUB_PROC_glDebugMessageEnableAMD,
+    GLB_STUB_PROC_glDebugMessageInsert,
+    GLB_STUB_PROC_glDebugMessageInsertAMD,
+    GLB_STUB_PROC_glDebugMessageInsertARB,
+    GLB_STUB_PROC_glDebugMessageInsertKHR,
+    GLB_STUB_PROC_glDeformSGIX,
+    GLB_STUB_PROC_glDeformationMap3dSGIX,
+    GLB_STUB_PROC_glDeformationMap3fSGIX,
+    GLB_STUB_PROC_glDeleteAsyncMarkersSGIX,
+    GLB_STUB_PROC_glDeleteBuffers,
+    GLB_STUB_PROC_glDeleteBuffersARB,
+    GLB_STUB_PROC_glDeleteCommandListsNV,
+    GLB_STUB_PROC_glDeleteFencesAPPLE,
+    GLB_STUB_PROC_glDeleteFencesNV,
+    GLB_STUB_PROC_glDeleteFragmentShaderATI,
+    GLB_STUB_PROC_glDeleteFramebuffers,
+    GLB_STUB_PROC_glDeleteFramebuffersEXT,
+    GLB_STUB_PROC_glDeleteLists,
+    GLB_STUB_PROC_glDeleteMemoryObjectsEXT,
+    GLB_STUB_PROC_glDeleteNamedStringARB,
+    GLB_STUB_PROC_glDeleteNamesAMD,
+    GLB_STUB_PROC_glDeleteObjectARB,
+    GLB_STUB_PROC_glDeleteOcclusionQueriesNV,
+    GLB_STUB_PROC_glDeletePathsNV,
+    GLB_STUB_PROC_glDeletePerfMonitorsAMD,
+    GLB_STUB_PROC_glDeletePerfQueryINTEL,
+    GLB_STUB_PROC_glDeleteProgram,
+    GLB_STUB_PROC_glDeleteProgramPipelines,
+    GLB_STUB_PROC_glDeleteProgramPipelinesEXT,
+    GLB_STUB_PROC_glDeleteProgramsARB,
+    GLB_STUB_PROC_glDeleteProgramsNV,
+    GLB_STUB_PROC_glDeleteQueries,
+    GLB_STUB_PROC_glDeleteQueriesARB,
+    GLB_STUB_PROC_glDeleteQueryResourceTagNV,
+    GLB_STUB_PROC_glDeleteRenderbuffers,
+    GLB_STUB_PROC_glDeleteRenderbuffersEXT,
+    GLB_STUB_PROC_glDeleteSamplers,
+    GLB_STUB_PROC_glDeleteSemaphoresEXT,
+    GLB_STUB_PROC_glDeleteShader,
+    GLB_STUB_PROC_glDeleteStatesNV,
+    GLB_STUB_PROC_glDeleteSync,
+    GLB_STUB_PROC_glDeleteTextures,
+    GLB_STUB_PROC_glDeleteTexturesEXT,
+    GLB_STUB_PROC_glDeleteTransformFeedbacks,
+    GLB_STUB_PROC_glDeleteTransformFeedbacksNV,
+    GLB_STUB_PROC_glDeleteVertexArrays,
+    GLB_STUB_PROC_glDeleteVertexArraysAPPLE,
+    GLB_STUB_PROC_glDeleteVertexShaderEXT,
+    GLB_STUB_PROC_glDepthBoundsEXT,
+    GLB_STUB_PROC_glDepthBoundsdNV,
+    GLB_STUB_PROC_glDepthFunc,
+    GLB_STUB_PROC_glDepthMask,
+    GLB_STUB_PROC_glDepthRange,
+    GLB_STUB_PROC_glDepthRangeArraydvNV,
+    GLB_STUB_PROC_glDepthRangeArrayv,
+    GLB_STUB_PROC_glDepthRangeIndexed,
+    GLB_STUB_PROC_glDepthRangeIndexeddNV,
+    GLB_STUB_PROC_glDepthRangedNV,
+    GLB_STUB_PROC_glDepthRangef,
+    GLB_STUB_PROC_glDepthRangefOES,
+    GLB_STUB_PROC_glDepthRangexOES,
+    GLB_STUB_PROC_glDetachObjectARB,
+    GLB_STUB_PROC_glDetachShader,
+    GLB_STUB_PROC_glDetailTexFuncSGIS,
+    GLB_STUB_PROC_glDisable,
+    GLB_STUB_PROC_glDisableClientState,
+    GLB_STUB_PROC_glDisableClientStateIndexedEXT,
+    GLB_STUB_PROC_glDisableClientStateiEXT,
+    GLB_STUB_PROC_glDisableIndexedEXT,
+    GLB_STUB_PROC_glDisableVariantClientStateEXT,
+    GLB_STUB_PROC_glDisableVertexArrayAttrib,
+    GLB_STUB_PROC_glDisableVertexArrayAttribEXT,
+    GLB_STUB_PROC_glDisableVertexArrayEXT,
+    GLB_STUB_PROC_glDisableVertexAttribAPPLE,
+    GLB_STUB_PROC_glDisableVertexAttribArray,
+    GLB_STUB_PROC_glDisableVertexAttribArrayARB,
+    GLB_STUB_PROC_glDisablei,
+    GLB_STUB_PROC_glDispatchCompute,
+    GLB_STUB_PROC_glDispatchComputeGroupSizeARB,
+    GLB_STUB_PROC_glDispatchComputeIndirect,
+    GLB_STUB_PROC_glDrawArrays,
+    GLB_STUB_PROC_glDrawArraysEXT,
+    GLB_STUB_PROC_glDrawArraysIndirect,
+    GLB_STUB_PROC_glDrawArraysInstanced,
+    GLB_STUB_PROC_glDrawArraysInstancedARB,
+    GLB_STUB_PROC_glDrawArraysInstancedBaseInstance,
+    GLB_STUB_PROC_glDrawArraysInstancedEXT,
+    GLB_STUB_PROC_glDrawBuffer,
+    GLB_STUB_PROC_glDrawBuffers,
+    GLB_STUB_PROC_glDrawBuffersARB,
+    GLB_STUB_PROC_glDrawBuffersATI,
+    GLB_STUB_PROC_glDrawCommandsAddressNV,
+    GLB_STUB_PROC_glDrawCommandsNV,
+    GLB_STUB_PROC_glDrawCommandsStatesAddressNV,
+    GLB_STUB_PROC_glDrawCommandsStatesNV,
+    GLB_STUB_PROC_glDrawElementArrayAPPLE,
+    GLB_STUB_PROC_glDrawElementArrayATI,
+    GLB_STUB_PROC_glDrawElements,
+    GLB_STUB_PROC_glDrawElementsBaseVertex,
+    GLB_STUB_PROC_glDrawElementsIndirect,
+    GLB_STUB_PROC_glDrawElementsInstanced,
+    GLB_STUB_PROC_glDrawElementsInstancedARB,
+    GLB_STUB_PROC_glDrawElementsInstancedBaseInstance,
+    GLB_STUB_PROC_glDrawElementsInstancedBaseVertex,
+    GLB_STUB_PROC_glDrawElementsInstancedBaseVertexBaseInstance,
+    GLB_STUB_PROC_glDrawElementsInstancedEXT,
+    GLB_STUB_PROC_glDrawMeshArraysSUN,
+    GLB_STUB_PROC_glDrawMeshTasksIndirectNV,
+    GLB_STUB_PROC_glDrawMeshTasksNV,
+    GLB_STUB_PROC_glDrawPixels,
+    GLB_STUB_PROC_glDrawRangeElementArrayAPPLE,
+    GLB_STUB_PROC_glDrawRangeElementArrayATI,
+    GLB_STUB_PROC_glDrawRangeElements,
+    GLB_STUB_PROC_glDrawRangeElementsBaseVertex,
+    GLB_STUB_PROC_glDrawRangeElementsEXT,
+    GLB_STUB_PROC_glDrawTextureNV,
+    GLB_STUB_PROC_glDrawTransformFeedback,
+    GLB_STUB_PROC_glDrawTransformFeedbackInstanced,
+    GLB_STUB_PROC_glDrawTransformFeedbackNV,
+    GLB_STUB_PROC_glDrawTransformFeedbackStream,
+    GLB_STUB_PROC_glDrawTransformFeedbackStreamInstanced,
+    GLB_STUB_PROC_glDrawVkImageNV,
+    GLB_STUB_PROC_glEGLImageTargetTexStorageEXT,
+    GLB_STUB_PROC_glEGLImageTargetTextureStorageEXT,
+    GLB_STUB_PROC_glEdgeFlag,
+    GLB_STUB_PROC_glEdgeFlagFormatNV,
+    GLB_STUB_PROC_glEdgeFlagPointer,
+    GLB_STUB_PROC_glEdgeFlagPointerEXT,
+    GLB_STUB_PROC_glEdgeFlagPointerListIBM,
+    GLB_STUB_PROC_glEdgeFlagv,
+    GLB_STUB_PROC_glElementPointerAPPLE,
+    GLB_STUB_PROC_glElementPointerATI,
+    GLB_STUB_PROC_glEnable,
+    GLB_STUB_PROC_glEnableClientState,
+    GLB_STUB_PROC_glEnableClientStateIndexedEXT,
+    GLB_STUB_PROC_glEnableClientStateiEXT,
+    GLB_STUB_PROC_glEnableIndexedEXT,
+    GLB_STUB_PROC_glEnableVariantClientStateEXT,
+    GLB_STUB_PROC_glEnableVertexArrayAttrib,
+    GLB_STUB_PROC_glEnableVertexArrayAttribEXT,
+    GLB_STUB_PROC_glEnableVertexArrayEXT,
+    GLB_STUB_PROC_glEnableVertexAttribAPPLE,
+    GLB_STUB_PROC_glEnableVertexAttribArray,
+    GLB_STUB_PROC_glEnableVertexAttribArrayARB,
+    GLB_STUB_PROC_glEnablei,
+    GLB_STUB_PROC_glEnd,
+    GLB_STUB_PROC_glEndConditionalRender,
+    GLB_STUB_PROC_glEndConditionalRenderNV,
+    GLB_STUB_PROC_glEndConditionalRenderNVX,
+    GLB_STUB_PROC_glEndFragmentShaderATI,
+    GLB_STUB_PROC_glEndList,
+    GLB_STUB_PROC_glEndOcclusionQueryNV,
+    GLB_STUB_PROC_glEndPerfMonitorAMD,
+    GLB_STUB_PROC_glEndPerfQueryINTEL,
+    GLB_STUB_PROC_glEndQuery,
+    GLB_STUB_PROC_glEndQueryARB,
+    GLB_STUB_PROC_glEndQueryIndexed,
+    GLB_STUB_PROC_glEndTransformFeedback,
+    GLB_STUB_PROC_glEndTransformFeedbackEXT,
+    GLB_STUB_PROC_glEndTransformFeedbackNV,
+    GLB_STUB_PROC_glEndVertexShaderEXT,
+    GLB_STUB_PROC_glEndVideoCaptureNV,
+    GLB_STUB_PROC_glEvalCoord1d,
+    GLB_STUB_PROC_glEvalCoord1dv,
+    GLB_STUB_PROC_glEvalCoord1f,
+    GLB_STUB_PROC_glEvalCoord1fv,
+    GLB_STUB_PROC_glEvalCoord1xOES,
+    GLB_STUB_PROC_glEvalCoord1xvOES,
+    GLB_STUB_PROC_glEvalCoord2d,
+    GLB_STUB_PROC_glEvalCoord2dv,
+    GLB_STUB_PROC_glEvalCoord2f,
+    GLB_STUB_PROC_glEvalCoord2fv,
+    GLB_STUB_PROC_glEvalCoord2xOES,
+    GLB_STUB_PROC_glEvalCoord2xvOES,
+    GLB_STUB_PROC_glEvalMapsNV,
+    GLB_STUB_PROC_glEvalMesh1,
+    GLB_STUB_PROC_glEvalMesh2,
+    GLB_STUB_PROC_glEvalPoint1,
+    GLB_STUB_PROC_glEvalPoint2,
+    GLB_STUB_PROC_glEvaluateDepthValuesARB,
+    GLB_STUB_PROC_glExecuteProgramNV,
+    GLB_STUB_PROC_glExtractComponentEXT,
+    GLB_STUB_PROC_glFeedbackBuffer,
+    GLB_STUB_PROC_glFeedbackBufferxOES,
+    GLB_STUB_PROC_glFenceSync,
+    GLB_STUB_PROC_glFinalCombinerInputNV,
+    GLB_STUB_PROC_glFinish,
+    GLB_STUB_PROC_glFinishAsyncSGIX,
+    GLB_STUB_PROC_glFinishFenceAPPLE,
+    GLB_STUB_PROC_glFinishFenceNV,
+    GLB_STUB_PROC_glFinishObjectAPPLE,
+    GLB_STUB_PROC_glFinishTextureSUNX,
+    GLB_STUB_PROC_glFlush,
+    GLB_STUB_PROC_glFlushMappedBufferRange,
+    GLB_STUB_PROC_glFlushMappedBufferRangeAPPLE,
+    GLB_STUB_PROC_glFlushMappedNamedBufferRange,
+    GLB_STUB_PROC_glFlushMappedNamedBufferRangeEXT,
+    GLB_STUB_PROC_glFlushPixelDataRangeNV,
+    GLB_STUB_PROC_glFlushRasterSGIX,
+    GLB_STUB_PROC_glFlushStaticDataIBM,
+    GLB_STUB_PROC_glFlushVertexArrayRangeAPPLE,
+    GLB_STUB_PROC_glFlushVertexArrayRangeNV,
+    GLB_STUB_PROC_glFogCoordFormatNV,
+    GLB_STUB_PROC_glFogCoordPointer,
+    GLB_STUB_PROC_glFogCoordPointerEXT,
+    GLB_STUB_PROC_glFogCoordPointerListIBM,
+    GLB_STUB_PROC_glFogCoordd,
+    GLB_STUB_PROC_glFogCoorddEXT,
+    GLB_STUB_PROC_glFogCoorddv,
+    GLB_STUB_PROC_glFogCoorddvEXT,
+    GLB_STUB_PROC_glFogCoordf,
+    GLB_STUB_PROC_glFogCoordfEXT,
+    GLB_STUB_PROC_glFogCoordfv,
+    GLB_STUB_PROC_glFogCoordfvEXT,
+    GLB_STUB_PROC_glFogCoordhNV,
+    GLB_STUB_PROC_glFogCoordhvNV,
+    GLB_STUB_PROC_glFogFuncSGIS,
+    GLB_STUB_PROC_glFogf,
+    GLB_STUB_PROC_glFogfv,
+    GLB_STUB_PROC_glFogi,
+    GLB_STUB_PROC_glFogiv,
+    GLB_STUB_PROC_glFogxOES,
+    GLB_STUB_PROC_glFogxvOES,
+    GLB_STUB_PROC_glFragmentColorMaterialSGIX,
+    GLB_STUB_PROC_glFragmentCoverageColorNV,
+    GLB_STUB_PROC_glFragmentLightModelfSGIX,
+    GLB_STUB_PROC_glFragmentLightModelfvSGIX,
+    GLB_STUB_PROC_glFragmentLightModeliSGIX,
+    GLB_STUB_PROC_glFragmentLightModelivSGIX,
+    GLB_STUB_PROC_glFragmentLightfSGIX,
+    GLB_STUB_PROC_glFragmentLightfvSGIX,
+    GLB_STUB_PROC_glFragmentLightiSGIX,
+    GLB_STUB_PROC_glFragmentLightivSGIX,
+    GLB_STUB_PROC_glFragmentMaterialfSGIX,
+    GLB_STUB_PROC_glFragmentMaterialfvSGIX,
+    GLB_STUB_PROC_glFragmentMaterialiSGIX,
+    GLB_STUB_PROC_glFragmentMaterialivSGIX,
+    GLB_STUB_PROC_glFrameTerminatorGREMEDY,
+    GLB_STUB_PROC_glFrameZoomSGIX,
+    GLB_STUB_PROC_glFramebufferDrawBufferEXT,
+    GLB_STUB_PROC_glFramebufferDrawBuffersEXT,
+    GLB_STUB_PROC_glFramebufferFetchBarrierEXT,
+    GLB_STUB_PROC_glFramebufferParameteri,
+    GLB_STUB_PROC_glFramebufferParameteriMESA,
+    GLB_STUB_PROC_glFramebufferReadBufferEXT,
+    GLB_STUB_PROC_glFramebufferRenderbuffer,
+    GLB_STUB_PROC_glFramebufferRenderbufferEXT,
+    GLB_STUB_PROC_glFramebufferSampleLocationsfvARB,
+    GLB_STUB_PROC_glFramebufferSampleLocationsfvNV,
+    GLB_STUB_PROC_glFramebufferSamplePositionsfvAMD,
+    GLB_STUB_PROC_glFramebufferTexture,
+    GLB_STUB_PROC_glFramebufferTexture1D,
+    GLB_STUB_PROC_glFramebufferTexture1DEXT,
+    GLB_STUB_PROC_glFramebufferTexture2D,
+    GLB_STUB_PROC_glFramebufferTexture2DEXT,
+    GLB_STUB_PROC_glFramebufferTexture3D,
+    GLB_STUB_PROC_glFramebufferTexture3DEXT,
+    GLB_STUB_PROC_glFramebufferTextureARB,
+    GLB_STUB_PROC_glFramebufferTextureEXT,
+    GLB_STUB_PROC_glFramebufferTextureFaceARB,
+    GLB_STUB_PROC_glFramebufferTextureFaceEXT,
+    GLB_STUB_PROC_glFramebufferTextureLayer,
+    GLB_STUB_PROC_glFramebufferTextureLayerARB,
+    GLB_STUB_PROC_glFramebufferTextureLayerEXT,
+    GLB_STUB_PROC_glFramebufferTextureMultiviewOVR,
+    GLB_STUB_PROC_glFreeObjectBufferATI,
+    GLB_STUB_PROC_glFrontFace,
+    GLB_STUB_PROC_glFrustum,
+    GLB_STUB_PROC_glFrustumfOES,
+    GLB_STUB_PROC_glFrustumxOES,
+    GLB_STUB_PROC_glGenAsyncMarkersSGIX,
+    GLB_STUB_PROC_glGenBuffers,
+    GLB_STUB_PROC_glGenBuffersARB,
+    GLB_STUB_PROC_glGenFencesAPPLE,
+    GLB_STUB_PROC_glGenFencesNV,
+    GLB_STUB_PROC_glGenFragmentShadersATI,
+    GLB_STUB_PROC_glGenFramebuffers,
+    GLB_STUB_PROC_glGenFramebuffersEXT,
+    GLB_STUB_PROC_glGenLists,
+    GLB_STUB_PROC_glGenNamesAMD,
+    GLB_STUB_PROC_glGenOcclusionQueriesNV,
+    GLB_STUB_PROC_glGenPathsNV,
+    GLB_STUB_PROC_glGenPerfMonitorsAMD,
+    GLB_STUB_PROC_glGenProgramPipelines,
+    GLB_STUB_PROC_glGenProgramPipelinesEXT,
+    GLB_STUB_PROC_glGenProgramsARB,
+    GLB_STUB_PROC_glGenProgramsNV,
+    GLB_STUB_PROC_glGenQueries,
+    GLB_STUB_PROC_glGenQueriesARB,
+    GLB_STUB_PROC_glGenQueryResourceTagNV,
+    GLB_STUB_PROC_glGenRenderbuffers,
+    GLB_STUB_PROC_glGenRenderbuffersEXT,
+    GLB_STUB_PROC_glGenSamplers,
+    GLB_STUB_PROC_glGenSemaphoresEXT,
+    GLB_STUB_PROC_glGenSymbolsEXT,
+    GLB_STUB_PROC_glGenTextures,
+    GLB_STUB_PROC_glGenTexturesEXT,
+    GLB_STUB_PROC_glGenTransformFeedbacks,
+    GLB_STUB_PROC_glGenTransformFeedbacksNV,
+    GLB_STUB_PROC_glGenVertexArrays,
+    GLB_STUB_PROC_glGenVertexArraysAPPLE,
+    GLB_STUB_PROC_glGenVertexShadersEXT,
+    GLB_STUB_PROC_glGenerateMipmap,
+    GLB_STUB_PROC_glGenerateMipmapEXT,
+    GLB_STUB_PROC_glGenerateMultiTexMipmapEXT,
+    GLB_STUB_PROC_glGenerateTextureMipmap,
+    GLB_STUB_PROC_glGenerateTextureMipmapEXT,
+    GLB_STUB_PROC_glGetActiveAtomicCounterBufferiv,
+    GLB_STUB_PROC_glGetActiveAttrib,
+    GLB_STUB_PROC_glGetActiveAttribARB,
+    GLB_STUB_PROC_glGetActiveSubroutineName,
+    GLB_STUB_PROC_glGetActiveSubroutineUniformName,
+    GLB_STUB_PROC_glGetActiveSubroutineUniformiv,
+    GLB_STUB_PROC_glGetActiveUniform,
+    GLB_STUB_PROC_glGetActiveUniformARB,
+    GLB_STUB_PROC_glGetActiveUniformBlockName,
+    GLB_STUB_PROC_glGetActiveUniformBlockiv,
+    GLB_STUB_PROC_glGetActiveUniformName,
+    GLB_STUB_PROC_glGetActiveUniformsiv,
+    GLB_STUB_PROC_glGetActiveVaryingNV,
+    GLB_STUB_PROC_glGetArrayObjectfvATI,
+    GLB_STUB_PROC_glGetArrayObjectivATI,
+    GLB_STUB_PROC_glGetAttachedObjectsARB,
+    GLB_STUB_PROC_glGetAttachedShaders,
+    GLB_STUB_PROC_glGetAttribLocation,
+    GLB_STUB_PROC_glGetAttribLocationARB,
+    GLB_STUB_PROC_glGetBooleanIndexedvEXT,
+    GLB_STUB_PROC_glGetBooleani_v,
+    GLB_STUB_PROC_glGetBooleanv,
+    GLB_STUB_PROC_glGetBufferParameteri64v,
+    GLB_STUB_PROC_glGetBufferParameteriv,
+    GLB_STUB_PROC_glGetBufferParameterivARB,
+    GLB_STUB_PROC_glGetBufferParameterui64vNV,
+    GLB_STUB_PROC_glGetBufferPointerv,
+    GLB_STUB_PROC_glGetBufferPointervARB,
+    GLB_STUB_PROC_glGetBufferSubData,
+    GLB_STUB_PROC_glGetBufferSubDataARB,
+    GLB_STUB_PROC_glGetClipPlane,
+    GLB_STUB_PROC_glGetClipPlanefOES,
+    GLB_STUB_PROC_glGetClipPlanexOES,
+    GLB_STUB_PROC_glGetColorTable,
+    GLB_STUB_PROC_glGetColorTableEXT,
+    GLB_STUB_PROC_glGetColorTableParameterfv,
+    GLB_STUB_PROC_glGetColorTableParameterfvEXT,
+    GLB_STUB_PROC_glGetColorTableParameterfvSGI,
+    GLB_STUB_PROC_glGetColorTableParameteriv,
+    GLB_STUB_PROC_glGetColorTableParameterivEXT,
+    GLB_STUB_PROC_glGetColorTableParameterivSGI,
+    GLB_STUB_PROC_glGetColorTableSGI,
+    GLB_STUB_PROC_glGetCombinerInputParameterfvNV,
+    GLB_STUB_PROC_glGetCombinerInputParameterivNV,
+    GLB_STUB_PROC_glGetCombinerOutputParameterfvNV,
+    GLB_STUB_PROC_glGetCombinerOutputParameterivNV,
+    GLB_STUB_PROC_glGetCombinerStageParameterfvNV,
+    GLB_STUB_PROC_glGetCommandHeaderNV,
+    GLB_STUB_PROC_glGetCompressedMultiTexImageEXT,
+    GLB_STUB_PROC_glGetCompressedTexImage,
+    GLB_STUB_PROC_glGetCompressedTexImageARB,
+    GLB_STUB_PROC_glGetCompressedTextureImage,
+    GLB_STUB_PROC_glGetCompressedTextureImageEXT,
+    GLB_STUB_PROC_glGetCompressedTextureSubImage,
+    GLB_STUB_PROC_glGetConvolutionFilter,
+    GLB_STUB_PROC_glGetConvolutionFilterEXT,
+    GLB_STUB_PROC_glGetConvolutionParameterfv,
+    GLB_STUB_PROC_glGetConvolutionParameterfvEXT,
+    GLB_STUB_PROC_glGetConvolutionParameteriv,
+    GLB_STUB_PROC_glGetConvolutionParameterivEXT,
+    GLB_STUB_PROC_glGetConvolutionParameterxvOES,
+    GLB_STUB_PROC_glGetCoverageModulationTableNV,
+    GLB_STUB_PROC_glGetDebugMessageLog,
+    GLB_STUB_PROC_glGetDebugMessageLogAMD,
+    GLB_STUB_PROC_glGetDebugMessageLogARB,
+    GLB_STUB_PROC_glGetDebugMessageLogKHR,
+    GLB_STUB_PROC_glGetDetailTexFuncSGIS,
+    GLB_STUB_PROC_glGetDoubleIndexedvEXT,
+    GLB_STUB_PROC_glGetDoublei_v,
+    GLB_STUB_PROC_glGetDoublei_vEXT,
+    GLB_STUB_PROC_glGetDoublev,
+    GLB_STUB_PROC_glGetError,
+    GLB_STUB_PROC_glGetFenceivNV,
+    GLB_STUB_PROC_glGetFinalCombinerInputParameterfvNV,
+    GLB_STUB_PROC_glGetFinalCombinerInputParameterivNV,
+    GLB_STUB_PROC_glGetFirstPerfQueryIdINTEL,
+    GLB_STUB_PROC_glGetFixedvOES,
+    GLB_STUB_PROC_glGetFloatIndexedvEXT,
+    GLB_STUB_PROC_glGetFloati_v,
+    GLB_STUB_PROC_glGetFloati_vEXT,
+    GLB_STUB_PROC_glGetFloatv,
+    GLB_STUB_PROC_glGetFogFuncSGIS,
+    GLB_STUB_PROC_glGetFragDataIndex,
+    GLB_STUB_PROC_glGetFragDataLocation,
+    GLB_STUB_PROC_glGetFragDataLocationEXT,
+    GLB_STUB_PROC_glGetFragmentLightfvSGIX,
+    GLB_STUB_PROC_glGetFragmentLightivSGIX,
+    GLB_STUB_PROC_glGetFragmentMaterialfvSGIX,
+    GLB_STUB_PROC_glGetFragmentMaterialivSGIX,
+    GLB_STUB_PROC_glGetFramebufferAttachmentParameteriv,
+    GLB_STUB_PROC_glGetFramebufferAttachmentParameterivEXT,
+    GLB_STUB_PROC_glGetFramebufferParameterfvAMD,
+    GLB_STUB_PROC_glGetFramebufferParameteriv,
+    GLB_STUB_PROC_glGetFramebufferParameterivEXT,
+    GLB_STUB_PROC_glGetFramebufferParameterivMESA,
+    GLB_STUB_PROC_glGetGraphicsResetStatus,
+    GLB_STUB_PROC_glGetGraphicsResetStatusARB,
+    GLB_STUB_PROC_glGetGraphicsResetStatusKHR,
+    GLB_STUB_PROC_glGetHandleARB,
+    GLB_STUB_PROC_glGetHistogram,
+    GLB_STUB_PROC_glGetHistogramEXT,
+    GLB_STUB_PROC_glGetHistogramParameterfv,
+    GLB_STUB_PROC_glGetHistogramParameterfvEXT,
+    GLB_STUB_PROC_glGetHistogramParameteriv,
+    GLB_STUB_PROC_glGetHistogramParameterivEXT,
+    GLB_STUB_PROC_glGetHistogramParameterxvOES,
+    GLB_STUB_PROC_glGetImageHandleARB,
+    GLB_STUB_PROC_glGetImageHandleNV,
+    GLB_STUB_PROC_glGetImageTransformParameterfvHP,
+    GLB_STUB_PROC_glGetImageTransformParameterivHP,
+    GLB_STUB_PROC_glGetInfoLogARB,
+    GLB_STUB_PROC_glGetInstrumentsSGIX,
+    GLB_STUB_PROC_glGetInteger64i_v,
+    GLB_STUB_PROC_glGetInteger64v,
+    GLB_STUB_PROC_glGetIntegerIndexedvEXT,
+    GLB_STUB_PROC_glGetIntegeri_v,
+    GLB_STUB_PROC_glGetIntegerui64i_vNV,
+    GLB_STUB_PROC_glGetIntegerui64vNV,
+    GLB_STUB_PROC_glGetIntegerv,
+    GLB_STUB_PROC_glGetInternalformatSampleivNV,
+    GLB_STUB_PROC_glGetInternalformati64v,
+    GLB_STUB_PROC_glGetInternalformativ,
+    GLB_STUB_PROC_glGetInvariantBooleanvEXT,
+    GLB_STUB_PROC_glGetInvariantFloatvEXT,
+    GLB_STUB_PROC_glGetInvariantIntegervEXT,
+    GLB_STUB_PROC_glGetLightfv,
+    GLB_STUB_PROC_glGetLightiv,
+    GLB_STUB_PROC_glGetLightxOES,
+    GLB_STUB_PROC_glGetLightxvOES,
+    GLB_STUB_PROC_glGetListParameterfvSGIX,
+    GLB_STUB_PROC_glGetListParameterivSGIX,
+    GLB_STUB_PROC_glGetLocalConstantBooleanvEXT,
+    GLB_STUB_PROC_glGetLocalConstantFloatvEXT,
+    GLB_STUB_PROC_glGetLocalConstantIntegervEXT,
+    GLB_STUB_PROC_glGetMapAttribParameterfvNV,
+    GLB_STUB_PROC_glGetMapAttribParameterivNV,
+    GLB_STUB_PROC_glGetMapControlPointsNV,
+    GLB_STUB_PROC_glGetMapParameterfvNV,
+    GLB_STUB_PROC_glGetMapParameterivNV,
+    GLB_STUB_PROC_glGetMapdv,
+    GLB_STUB_PROC_glGetMapfv,
+    GLB_STUB_PROC_glGetMapiv,
+    GLB_STUB_PROC_glGetMapxvOES,
+    GLB_STUB_PROC_glGetMaterialfv,
+    GLB_STUB_PROC_glGetMaterialiv,
+    GLB_STUB_PROC_glGetMaterialxOES,
+    GLB_STUB_PROC_glGetMaterialxvOES,
+    GLB_STUB_PROC_glGetMemoryObjectDetachedResourcesuivNV,
+    GLB_STUB_PROC_glGetMemoryObjectParameterivEXT,
+    GLB_STUB_PROC_glGetMinmax,
+    GLB_STUB_PROC_glGetMinmaxEXT,
+    GLB_STUB_PROC_glGetMinmaxParameterfv,
+    GLB_STUB_PROC_glGetMinmaxParameterfvEXT,
+    GLB_STUB_PROC_glGetMinmaxParameteriv,
+    GLB_STUB_PROC_glGetMinmaxParameterivEXT,
+    GLB_STUB_PROC_glGetMultiTexEnvfvEXT,
+    GLB_STUB_PROC_glGetMultiTexEnvivEXT,
+    GLB_STUB_PROC_glGetMultiTexGendvEXT,
+    GLB_STUB_PROC_glGetMultiTexGenfvEXT,
+    GLB_STUB_PROC_glGetMultiTexGenivEXT,
+    GLB_STUB_PROC_glGetMultiTexImageEXT,
+    GLB_STUB_PROC_glGetMultiTexLevelParameterfvEXT,
+    GLB_STUB_PROC_glGetMultiTexLevelParameterivEXT,
+    GLB_STUB_PROC_glGetMultiTexParameterIivEXT,
+    GLB_STUB_PROC_glGetMultiTexParameterIuivEXT,
+    GLB_STUB_PROC_glGetMultiTexParameterfvEXT,
+    GLB_STUB_PROC_glGetMultiTexParameterivEXT,
+    GLB_STUB_PROC_glGetMultisamplefv,
+    GLB_STUB_PROC_glGetMultisamplefvNV,
+    GLB_STUB_PROC_glGetNamedBufferParameteri64v,
+    GLB_STUB_PROC_glGetNamedBufferParameteriv,
+    GLB_STUB_PROC_glGetNamedBufferParameterivEXT,
+    GLB_STUB_PROC_glGetNamedBufferParameterui64vNV,
+    GLB_STUB_PROC_glGetNamedBufferPointerv,
+    GLB_STUB_PROC_glGetNamedBufferPointervEXT,
+    GLB_STUB_PROC_glGetNamedBufferSubData,
+    GLB_STUB_PROC_glGetNamedBufferSubDataEXT,
+    GLB_STUB_PROC_glGetNamedFramebufferAttachmentParameteriv,
+    GLB_STUB_PROC_glGetNamedFramebufferAttachmentParameterivEXT,
+    GLB_STUB_PROC_glGetNamedFramebufferParameterfvAMD,
+    GLB_STUB_PROC_glGetNamedFramebufferParameteriv,
+    GLB_STUB_PROC_glGetNamedFramebufferParameterivEXT,
+    GLB_STUB_PROC_glGetNamedProgramLocalParameterIivEXT,
+    GLB_STUB_PROC_glGetNamedProgramLocalParameterIuivEXT,
+    GLB_STUB_PROC_glGetNamedProgramLocalParameterdvEXT,
+    GLB_STUB_PROC_glGetNamedProgramLocalParameterfvEXT,
+    GLB_STUB_PROC_glGetNamedProgramStringEXT,
+    GLB_STUB_PROC_glGetNamedProgramivEXT,
+    GLB_STUB_PROC_glGetNamedRenderbufferParameteriv,
+    GLB_STUB_PROC_glGetNamedRenderbufferParameterivEXT,
+    GLB_STUB_PROC_glGetNamedStringARB,
+    GLB_STUB_PROC_glGetNamedStringivARB,
+    GLB_STUB_PROC_glGetNextPerfQueryIdINTEL,
+    GLB_STUB_PROC_glGetObjectBufferfvATI,
+    GLB_STUB_PROC_glGetObjectBufferivATI,
+    GLB_STUB_PROC_glGetObjectLabel,
+    GLB_STUB_PROC_glGetObjectLabelEXT,
+    GLB_STUB_PROC_glGetObjectLabelKHR,
+    GLB_STUB_PROC_glGetObjectParameterfvARB,
+    GLB_STUB_PROC_glGetObjectParameterivAPPLE,
+    GLB_STUB_PROC_glGetObjectParameterivARB,
+    GLB_STUB_PROC_glGetObjectPtrLabel,
+    GLB_STUB_PROC_glGetObjectPtrLabelKHR,
+    GLB_STUB_PROC_glGetOcclusionQueryivNV,
+    GLB_STUB_PROC_glGetOcclusionQueryuivNV,
+    GLB_STUB_PROC_glGetPathColorGenfvNV,
+    GLB_STUB_PROC_glGetPathColorGenivNV,
+    GLB_STUB_PROC_glGetPathCommandsNV,
+    GLB_STUB_PROC_glGetPathCoordsNV,
+    GLB_STUB_PROC_glGetPathDashArrayNV,
+    GLB_STUB_PROC_glGetPathLengthNV,
+    GLB_STUB_PROC_glGetPathMetricRangeNV,
+    GLB_STUB_PROC_glGetPathMetricsNV,
+    GLB_STUB_PROC_glGetPathParameterfvNV,
+    GLB_STUB_PROC_glGetPathParameterivNV,
+    GLB_STUB_PROC_glGetPathSpacingNV,
+    GLB_STUB_PROC_glGetPathTexGenfvNV,
+    GLB_STUB_PROC_glGetPathTexGenivNV,
+    GLB_STUB_PROC_glGetPerfCounterInfoINTEL,
+    GLB_STUB_PROC_glGetPerfMonitorCounterDataAMD,
+    GLB_STUB_PROC_glGetPerfMonitorCounterInfoAMD,
+    GLB_STUB_PROC_glGetPerfMonitorCounterStringAMD,
+    GLB_STUB_PROC_glGetPerfMonitorCountersAMD,
+    GLB_STUB_PROC_glGetPerfMonitorGroupStringAMD,
+    GLB_STUB_PROC_glGetPerfMonitorGroupsAMD,
+    GLB_STUB_PROC_glGetPerfQueryDataINTEL,
+    GLB_STUB_PROC_glGetPerfQueryIdByNameINTEL,
+    GLB_STUB_PROC_glGetPerfQueryInfoINTEL,
+    GLB_STUB_PROC_glGetPixelMapfv,
+    GLB_STUB_PROC_glGetPixelMapuiv,
+    GLB_STUB_PROC_glGetPixelMapusv,
+    GLB_STUB_PROC_glGetPixelMapxv,
+    GLB_STUB_PROC_glGetPixelTexGenParameterfvSGIS,
+    GLB_STUB_PROC_glGetPixelTexGenParameterivSGIS,
+    GLB_STUB_PROC_glGetPixelTransformParameterfvEXT,
+    GLB_STUB_PROC_glGetPixelTransformParameterivEXT,
+    GLB_STUB_PROC_glGetPointerIndexedvEXT,
+    GLB_STUB_PROC_glGetPointeri_vEXT,
+    GLB_STUB_PROC_glGetPointerv,
+    GLB_STUB_PROC_glGetPointervEXT,
+    GLB_STUB_PROC_glGetPointervKHR,
+    GLB_STUB_PROC_glGetPolygonStipple,
+    GLB_STUB_PROC_glGetProgramBinary,
+    GLB_STUB_PROC_glGetProgramEnvParameterIivNV,
+    GLB_STUB_PROC_glGetProgramEnvParameterIuivNV,
+    GLB_STUB_PROC_glGetProgramEnvParameterdvARB,
+    GLB_STUB_PROC_glGetProgramEnvParameterfvARB,
+    GLB_STUB_PROC_glGetProgramInfoLog,
+    GLB_STUB_PROC_glGetProgramInterfaceiv,
+    GLB_STUB_PROC_glGetProgramLocalParameterIivNV,
+    GLB_STUB_PROC_glGetProgramLocalParameterIuivNV,
+    GLB_STUB_PROC_glGetProgramLocalParameterdvARB,
+    GLB_STUB_PROC_glGetProgramLocalParameterfvARB,
+    GLB_STUB_PROC_glGetProgramNamedParameterdvNV,
+    GLB_STUB_PROC_glGetProgramNamedParameterfvNV,
+    GLB_STUB_PROC_glGetProgramParameterdvNV,
+    GLB_STUB_PROC_glGetProgramParameterfvNV,
+    GLB_STUB_PROC_glGetProgramPipelineInfoLog,
+    GLB_STUB_PROC_glGetProgramPipelineInfoLogEXT,
+    GLB_STUB_PROC_glGetProgramPipelineiv,
+    GLB_STUB_PROC_glGetProgramPipelineivEXT,
+    GLB_STUB_PROC_glGetProgramResourceIndex,
+    GLB_STUB_PROC_glGetProgramResourceLocation,
+    GLB_STUB_PROC_glGetProgramResourceLocationIndex,
+    GLB_STUB_PROC_glGetProgramResourceName,
+    GLB_STUB_PROC_glGetProgramResourcefvNV,
+    GLB_STUB_PROC_glGetProgramResourceiv,
+    GLB_STUB_PROC_glGetProgramStageiv,
+    GLB_STUB_PROC_glGetProgramStringARB,
+    GLB_STUB_PROC_glGetProgramStringNV,
+    GLB_STUB_PROC_glGetProgramSubroutineParameteruivNV,
+    GLB_STUB_PROC_glGetProgramiv,
+    GLB_STUB_PROC_glGetProgramivARB,
+    GLB_STUB_PROC_glGetProgramivNV,
+    GLB_STUB_PROC_glGetQueryBufferObjecti64v,
+    GLB_STUB_PROC_glGetQueryBufferObjectiv,
+    GLB_STUB_PROC_glGetQueryBufferObjectui64v,
+    GLB_STUB_PROC_glGetQueryBufferObjectuiv,
+    GLB_STUB_PROC_glGetQueryIndexediv,
+    GLB_STUB_PROC_glGetQueryObjecti64v,
+    GLB_STUB_PROC_glGetQueryObjecti64vEXT,
+    GLB_STUB_PROC_glGetQueryObjectiv,
+    GLB_STUB_PROC_glGetQueryObjectivARB,
+    GLB_STUB_PROC_glGetQueryObjectui64v,
+    GLB_STUB_PROC_glGetQueryObjectui64vEXT,
+    GLB_STUB_PROC_glGetQueryObjectuiv,
+    GLB_STUB_PROC_glGetQueryObjectuivARB,
+    GLB_STUB_PROC_glGetQueryiv,
+    GLB_STUB_PROC_glGetQueryivARB,
+    GLB_STUB_PROC_glGetRenderbufferParameteriv,
+    GLB_STUB_PROC_glGetRenderbufferParameterivEXT,
+    GLB_STUB_PROC_glGetSamplerParameterIiv,
+    GLB_STUB_PROC_glGetSamplerParameterIuiv,
+    GLB_STUB_PROC_glGetSamplerParameterfv,
+    GLB_STUB_PROC_glGetSamplerParameteriv,
+    GLB_STUB_PROC_glGetSemaphoreParameterivNV,
+    GLB_STUB_PROC_glGetSemaphoreParameterui64vEXT,
+    GLB_STUB_PROC_glGetSeparableFilter,
+    GLB_STUB_PROC_glGetSeparableFilterEXT,
+    GLB_STUB_PROC_glGetShaderInfoLog,
+    GLB_STUB_PROC_glGetShaderPrecisionFormat,
+    GLB_STUB_PROC_glGetShaderSource,
+    GLB_STUB_PROC_glGetShaderSourceARB,
+    GLB_STUB_PROC_glGetShaderiv,
+    GLB_STUB_PROC_glGetShadingRateImagePaletteNV,
+    GLB_STUB_PROC_glGetShadingRateSampleLocationivNV,
+    GLB_STUB_PROC_glGetSharpenTexFuncSGIS,
+    GLB_STUB_PROC_glGetStageIndexNV,
+    GLB_STUB_PROC_glGetString,
+    GLB_STUB_PROC_glGetStringi,
+    GLB_STUB_PROC_glGetSubroutineIndex,
+    GLB_STUB_PROC_glGetSubroutineUniformLocation,
+    GLB_STUB_PROC_glGetSynciv,
+    GLB_STUB_PROC_glGetTexBumpParameterfvATI,
+    GLB_STUB_PROC_glGetTexBumpParameterivATI,
+    GLB_STUB_PROC_glGetTexEnvfv,
+    GLB_STUB_PROC_glGetTexEnviv,
+    GLB_STUB_PROC_glGetTexEnvxvOES,
+    GLB_STUB_PROC_glGetTexFilterFuncSGIS,
+    GLB_STUB_PROC_glGetTexGendv,
+    GLB_STUB_PROC_glGetTexGenfv,
+    GLB_STUB_PROC_glGetTexGeniv,
+    GLB_STUB_PROC_glGetTexGenxvOES,
+    GLB_STUB_PROC_glGetTexImage,
+    GLB_STUB_PROC_glGetTexLevelParameterfv,
+    GLB_STUB_PROC_glGetTexLevelParameteriv,
+    GLB_STUB_PROC_glGetTexLevelParameterxvOES,
+    GLB_STUB_PROC_glGetTexParameterIiv,
+    GLB_STUB_PROC_glGetTexParameterIivEXT,
+    GLB_STUB_PROC_glGetTexParameterIuiv,
+    GLB_STUB_PROC_glGetTexParameterIuivEXT,
+    GLB_STUB_PROC_glGetTexParameterPointervAPPLE,
+    GLB_STUB_PROC_glGetTexParameterfv,
+    GLB_STUB_PROC_glGetTexParameteriv,
+    GLB_STUB_PROC_glGetTexParameterxvOES,
+    GLB_STUB_PROC_glGetTextureHandleARB,
+    GLB_STUB_PROC_glGetTextureHandleNV,
+    GLB_STUB_PROC_glGetTextureImage,
+    GLB_STUB_PROC_glGetTextureImageEXT,
+    GLB_STUB_PROC_glGetTextureLevelParameterfv,
+    GLB_STUB_PROC_glGetTextureLevelParameterfvEXT,
+    GLB_STUB_PROC_glGetTextureLevelParameteriv,
+    GLB_STUB_PROC_glGetTextureLevelParameterivEXT,
+    GLB_STUB_PROC_glGetTextureParameterIiv,
+    GLB_STUB_PROC_glGetTextureParameterIivEXT,
+    GLB_STUB_PROC_glGetTextureParameterIuiv,
+    GLB_STUB_PROC_glGetTextureParameterIuivEXT,
+    GLB_STUB_PROC_glGetTextureParameterfv,
+    GLB_STUB_PROC_glGetTextureParameterfvEXT,
+    GLB_STUB_PROC_glGetTextureParameteriv,
+    GLB_STUB_PROC_glGetTextureParameterivEXT,
+    GLB_STUB_PROC_glGetTextureSamplerHandleARB,
+    GLB_STUB_PROC_glGetTextureSamplerHandleNV,
+    GLB_STUB_PROC_glGetTextureSubImage,
+    GLB_STUB_PROC_glGetTrackMatrixivNV,
+    GLB_STUB_PROC_glGetTransformFeedbackVarying,
+    GLB_STUB_PROC_glGetTransformFeedbackVaryingEXT,
+    GLB_STUB_PROC_glGetTransformFeedbackVaryingNV,
+    GLB_STUB_PROC_glGetTransformFeedbacki64_v,
+    GLB_STUB_PROC_glGetTransformFeedbacki_v,
+    GLB_STUB_PROC_glGetTransformFeedbackiv,
+    GLB_STUB_PROC_glGetUniformBlockIndex,
+    GLB_STUB_PROC_glGetUniformBufferSizeEXT,
+    GLB_STUB_PROC_glGetUniformIndices,
+    GLB_STUB_PROC_glGetUniformLocation,
+    GLB_STUB_PROC_glGetUniformLocationARB,
+    GLB_STUB_PROC_glGetUniformOffsetEXT,
+    GLB_STUB_PROC_glGetUniformSubroutineuiv,
+    GLB_STUB_PROC_glGetUniformdv,
+    GLB_STUB_PROC_glGetUniformfv,
+    GLB_STUB_PROC_glGetUniformfvARB,
+    GLB_STUB_PROC_glGetUniformi64vARB,
+    GLB_STUB_PROC_glGetUniformi64vNV,
+    GLB_STUB_PROC_glGetUniformiv,
+    GLB_STUB_PROC_glGetUniformivARB,
+    GLB_STUB_PROC_glGetUniformui64vARB,
+    GLB_STUB_PROC_glGetUniformui64vNV,
+    GLB_STUB_PROC_glGetUniformuiv,
+    GLB_STUB_PROC_glGetUniformuivEXT,
+    GLB_STUB_PROC_glGetUnsignedBytei_vEXT,
+    GLB_STUB_PROC_glGetUnsignedBytevEXT,
+    GLB_STUB_PROC_glGetVariantArrayObjectfvATI,
+    GLB_STUB_PROC_glGetVariantArrayObjectivATI,
+    GLB_STUB_PROC_glGetVariantBooleanvEXT,
+    GLB_STUB_PROC_glGetVariantFloatvEXT,
+    GLB_STUB_PROC_glGetVariantIntegervEXT,
+    GLB_STUB_PROC_glGetVariantPointervEXT,
+    GLB_STUB_PROC_glGetVaryingLocationNV,
+    GLB_STUB_PROC_glGetVertexArrayIndexed64iv,
+    GLB_STUB_PROC_glGetVertexArrayIndexediv,
+    GLB_STUB_PROC_glGetVertexArrayIntegeri_vEXT,
+    GLB_STUB_PROC_glGetVertexArrayIntegervEXT,
+    GLB_STUB_PROC_glGetVertexArrayPointeri_vEXT,
+    GLB_STUB_PROC_glGetVertexArrayPointervEXT,
+    GLB_STUB_PROC_glGetVertexArrayiv,
+    GLB_STUB_PROC_glGetVertexAttribArrayObjectfvATI,
+    GLB_STUB_PROC_glGetVertexAttribArrayObjectivATI,
+    GLB_STUB_PROC_glGetVertexAttribIiv,
+    GLB_STUB_PROC_glGetVertexAttribIivEXT,
+    GLB_STUB_PROC_glGetVertexAttribIuiv,
+    GLB_STUB_PROC_glGetVertexAttribIuivEXT,
+    GLB_STUB_PROC_glGetVertexAttribLdv,
+    GLB_STUB_PROC_glGetVertexAttribLdvEXT,
+    GLB_STUB_PROC_glGetVertexAttribLi64vNV,
+    GLB_STUB_PROC_glGetVertexAttribLui64vARB,
+    GLB_STUB_PROC_glGetVertexAttribLui64vNV,
+    GLB_STUB_PROC_glGetVertexAttribPointerv,
+    GLB_STUB_PROC_glGetVertexAttribPointervARB,
+    GLB_STUB_PROC_glGetVertexAttribPointervNV,
+    GLB_STUB_PROC_glGetVertexAttribdv,
+    GLB_STUB_PROC_glGetVertexAttribdvARB,
+    GLB_STUB_PROC_glGetVertexAttribdvNV,
+    GLB_STUB_PROC_glGetVertexAttribfv,
+    GLB_STUB_PROC_glGetVertexAttribfvARB,
+    GLB_STUB_PROC_glGetVertexAttribfvNV,
+    GLB_STUB_PROC_glGetVertexAttribiv,
+    GLB_STUB_PROC_glGetVertexAttribivARB,
+    GLB_STUB_PROC_glGetVertexAttribivNV,
+    GLB_STUB_PROC_glGetVideoCaptureStreamdvNV,
+    GLB_STUB_PROC_glGetVideoCaptureStreamfvNV,
+    GLB_STUB_PROC_glGetVideoCaptureStreamivNV,
+    GLB_STUB_PROC_glGetVideoCaptureivNV,
+    GLB_STUB_PROC_glGetVideoi64vNV,
+    GLB_STUB_PROC_glGetVideoivNV,
+    GLB_STUB_PROC_glGetVideoui64vNV,
+    GLB_STUB_PROC_glGetVideouivNV,
+    GLB_STUB_PROC_glGetVkProcAddrNV,
+    GLB_STUB_PROC_glGetnColorTable,
+    GLB_STUB_PROC_glGetnColorTableARB,
+    GLB_STUB_PROC_glGetnCompressedTexImage,
+    GLB_STUB_PROC_glGetnCompressedTexImageARB,
+    GLB_STUB_PROC_glGetnConvolutionFilter,
+    GLB_STUB_PROC_glGetnConvolutionFilterARB,
+    GLB_STUB_PROC_glGetnHistogram,
+    GLB_STUB_PROC_glGetnHistogramARB,
+    GLB_STUB_PROC_glGetnMapdv,
+    GLB_STUB_PROC_glGetnMapdvARB,
+    GLB_STUB_PROC_glGetnMapfv,
+    GLB_STUB_PROC_glGetnMapfvARB,
+    GLB_STUB_PROC_glGetnMapiv,
+    GLB_STUB_PROC_glGetnMapivARB,
+    GLB_STUB_PROC_glGetnMinmax,
+    GLB_STUB_PROC_glGetnMinmaxARB,
+    GLB_STUB_PROC_glGetnPixelMapfv,
+    GLB_STUB_PROC_glGetnPixelMapfvARB,
+    GLB_STUB_PROC_glGetnPixelMapuiv,
+    GLB_STUB_PROC_glGetnPixelMapuivARB,
+    GLB_STUB_PROC_glGetnPixelMapusv,
+    GLB_STUB_PROC_glGetnPixelMapusvARB,
+    GLB_STUB_PROC_glGetnPolygonStipple,
+    GLB_STUB_PROC_glGetnPolygonStippleARB,
+    GLB_STUB_PROC_glGetnSeparableFilter,
+    GLB_STUB_PROC_glGetnSeparableFilterARB,
+    GLB_STUB_PROC_glGetnTexImage,
+    GLB_STUB_PROC_glGetnTexImageARB,
+    GLB_STUB_PROC_glGetnUniformdv,
+    GLB_STUB_PROC_glGetnUniformdvARB,
+    GLB_STUB_PROC_glGetnUniformfv,
+    GLB_STUB_PROC_glGetnUniformfvARB,
+    GLB_STUB_PROC_glGetnUniformfvKHR,
+    GLB_STUB_PROC_glGetnUniformi64vARB,
+    GLB_STUB_PROC_glGetnUniformiv,
+    GLB_STUB_PROC_glGetnUniformivARB,
+    GLB_STUB_PROC_glGetnUniformivKHR,
+    GLB_STUB_PROC_glGetnUniformui64vARB,
+    GLB_STUB_PROC_glGetnUniformuiv,
+    GLB_STUB_PROC_glGetnUniformuivARB,
+    GLB_STUB_PROC_glGetnUniformuivKHR,
+    GLB_STUB_PROC_glGlobalAlphaFactorbSUN,
+    GLB_STUB_PROC_glGlobalAlphaFactordSUN,
+    GLB_STUB_PROC_glGlobalAlphaFactorfSUN,
+    GLB_STUB_PROC_glGlobalAlphaFactoriSUN,
+    GLB_STUB_PROC_glGlobalAlphaFactorsSUN,
+    GLB_STUB_PROC_glGlobalAlphaFactorubSUN,
+    GLB_STUB_PROC_glGlobalAlphaFactoruiSUN,
+    GLB_STUB_PROC_glGlobalAlphaFactorusSUN,
+    GLB_STUB_PROC_glHint,
+    GLB_STUB_PROC_glHintPGI,
+    GLB_STUB_PROC_glHistogram,
+    GLB_STUB_PROC_glHistogramEXT,
+    GLB_STUB_PROC_glIglooInterfaceSGIX,
+    GLB_STUB_PROC_glImageTransformParameterfHP,
+    GLB_STUB_PROC_glImageTransformParameterfvHP,
+    GLB_STUB_PROC_glImageTransformParameteriHP,
+    GLB_STUB_PROC_glImageTransformParameterivHP,
+    GLB_STUB_PROC_glImportMemoryFdEXT,
+    GLB_STUB_PROC_glImportMemoryWin32HandleEXT,
+    GLB_STUB_PROC_glImportMemoryWin32NameEXT,
+    GLB_STUB_PROC_glImportSemaphoreFdEXT,
+    GLB_STUB_PROC_glImportSemaphoreWin32HandleEXT,
+    GLB_STUB_PROC_glImportSemaphoreWin32NameEXT,
+    GLB_STUB_PROC_glImportSyncEXT,
+    GLB_STUB_PROC_glIndexFormatNV,
+    GLB_STUB_PROC_glIndexFuncEXT,
+    GLB_STUB_PROC_glIndexMask,
+    GLB_STUB_PROC_glIndexMaterialEXT,
+    GLB_STUB_PROC_glIndexPointer,
+    GLB_STUB_PROC_glIndexPointerEXT,
+    GLB_STUB_PROC_glIndexPointerListIBM,
+    GLB_STUB_PROC_glIndexd,
+    GLB_STUB_PROC_glIndexdv,
+    GLB_STUB_PROC_glIndexf,
+    GLB_STUB_PROC_glIndexfv,
+    GLB_STUB_PROC_glIndexi,
+    GLB_STUB_PROC_glIndexiv,
+    GLB_STUB_PROC_glIndexs,
+    GLB_STUB_PROC_glIndexsv,
+    GLB_STUB_PROC_glIndexub,
+    GLB_STUB_PROC_glIndexubv,
+    GLB_STUB_PROC_glIndexxOES,
+    GLB_STUB_PROC_glIndexxvOES,
+    GLB_STUB_PROC_glInitNames,
+    GLB_STUB_PROC_glInsertComponentEXT,
+    GLB_STUB_PROC_glInsertEventMarkerEXT,
+    GLB_STUB_PROC_glInstrumentsBufferSGIX,
+    GLB_STUB_PROC_glInterleavedArrays,
+    GLB_STUB_PROC_glInterpolatePathsNV,
+    GLB_STUB_PROC_glInvalidateBufferData,
+    GLB_STUB_PROC_glInvalidateBufferSubData,
+    GLB_STUB_PROC_glInvalidateFramebuffer,
+    GLB_STUB_PROC_glInvalidateNamedFramebufferData,
+    GLB_STUB_PROC_glInvalidateNamedFramebufferSubData,
+    GLB_STUB_PROC_glInvalidateSubFramebuffer,
+    GLB_STUB_PROC_glInvalidateTexImage,
+    GLB_STUB_PROC_glInvalidateTexSubImage,
+    GLB_STUB_PROC_glIsAsyncMarkerSGIX,
+    GLB_STUB_PROC_glIsBuffer,
+    GLB_STUB_PROC_glIsBufferARB,
+    GLB_STUB_PROC_glIsBufferResidentNV,
+    GLB_STUB_PROC_glIsCommandListNV,
+    GLB_STUB_PROC_glIsEnabled,
+    GLB_STUB_PROC_glIsEnabledIndexedEXT,
+    GLB_STUB_PROC_glIsEnabledi,
+    GLB_STUB_PROC_glIsFenceAPPLE,
+    GLB_STUB_PROC_glIsFenceNV,
+    GLB_STUB_PROC_glIsFramebuffer,
+    GLB_STUB_PROC_glIsFramebufferEXT,
+    GLB_STUB_PROC_glIsImageHandleResidentARB,
+    GLB_STUB_PROC_glIsImageHandleResidentNV,
+    GLB_STUB_PROC_glIsList,
+    GLB_STUB_PROC_glIsMemoryObjectEXT,
+    GLB_STUB_PROC_glIsNameAMD,
+    GLB_STUB_PROC_glIsNamedBufferResidentNV,
+    GLB_STUB_PROC_glIsNamedStringARB,
+    GLB_STUB_PROC_glIsObjectBufferATI,
+    GLB_STUB_PROC_glIsOcclusionQueryNV,
+    GLB_STUB_PROC_glIsPathNV,
+    GLB_STUB_PROC_glIsPointInFillPathNV,
+    GLB_STUB_PROC_glIsPointInStrokePathNV,
+    GLB_STUB_PROC_glIsProgram,
+    GLB_STUB_PROC_glIsProgramARB,
+    GLB_STUB_PROC_glIsProgramNV,
+    GLB_STUB_PROC_glIsProgramPipeline,
+    GLB_STUB_PROC_glIsProgramPipelineEXT,
+    GLB_STUB_PROC_glIsQuery,
+    GLB_STUB_PROC_glIsQueryARB,
+    GLB_STUB_PROC_glIsRenderbuffer,
+    GLB_STUB_PROC_glIsRenderbufferEXT,
+    GLB_STUB_PROC_glIsSampler,
+    GLB_STUB_PROC_glIsSemaphoreEXT,
+    GLB_STUB_PROC_glIsShader,
+    GLB_STUB_PROC_glIsStateNV,
+    GLB_STUB_PROC_glIsSync,
+    GLB_STUB_PROC_glIsTexture,
+    GLB_STUB_PROC_glIsTextureEXT,
+    GLB_STUB_PROC_glIsTextureHandleResidentARB,
+    GLB_STUB_PROC_glIsTextureHandleResidentNV,
+    GLB_STUB_PROC_glIsTransformFeedback,
+    GLB_STUB_PROC_glIsTransformFeedbackNV,
+    GLB_STUB_PROC_glIsVariantEnabledEXT,
+    GLB_STUB_PROC_glIsVertexArray,
+    GLB_STUB_PROC_glIsVertexArrayAPPLE,
+    GLB_STUB_PROC_glIsVertexAttribEnabledAPPLE,
+    GLB_STUB_PROC_glLGPUCopyImageSubDataNVX,
+    GLB_STUB_PROC_glLGPUInterlockNVX,
+    GLB_STUB_PROC_glLGPUNamedBufferSubDataNVX,
+    GLB_STUB_PROC_glLabelObjectEXT,
+    GLB_STUB_PROC_glLightEnviSGIX,
+    GLB_STUB_PROC_glLightModelf,
+    GLB_STUB_PROC_glLightModelfv,
+    GLB_STUB_PROC_glLightModeli,
+    GLB_STUB_PROC_glLightModeliv,
+    GLB_STUB_PROC_glLightModelxOES,
+    GLB_STUB_PROC_glLightModelxvOES,
+    GLB_STUB_PROC_glLightf,
+    GLB_STUB_PROC_glLightfv,
+    GLB_STUB_PROC_glLighti,
+    GLB_STUB_PROC_glLightiv,
+    GLB_STUB_PROC_glLightxOES,
+    GLB_STUB_PROC_glLightxvOES,
+    GLB_STUB_PROC_glLineStipple,
+    GLB_STUB_PROC_glLineWidth,
+    GLB_STUB_PROC_glLineWidthxOES,
+    GLB_STUB_PROC_glLinkProgram,
+    GLB_STUB_PROC_glLinkProgramARB,
+    GLB_STUB_PROC_glListBase,
+    GLB_STUB_PROC_glListDrawCommandsStatesClientNV,
+    GLB_STUB_PROC_glListParameterfSGIX,
+    GLB_STUB_PROC_glListParameterfvSGIX,
+    GLB_STUB_PROC_glListParameteriSGIX,
+    GLB_STUB_PROC_glListParameterivSGIX,
+    GLB_STUB_PROC_glLoadIdentity,
+    GLB_STUB_PROC_glLoadIdentityDeformationMapSGIX,
+    GLB_STUB_PROC_glLoadMatrixd,
+    GLB_STUB_PROC_glLoadMatrixf,
+    GLB_STUB_PROC_glLoadMatrixxOES,
+    GLB_STUB_PROC_glLoadName,
+    GLB_STUB_PROC_glLoadProgramNV,
+    GLB_STUB_PROC_glLoadTransposeMatrixd,
+    GLB_STUB_PROC_glLoadTransposeMatrixdARB,
+    GLB_STUB_PROC_glLoadTransposeMatrixf,
+    GLB_STUB_PROC_glLoadTransposeMatrixfARB,
+    GLB_STUB_PROC_glLoadTransposeMatrixxOES,
+    GLB_STUB_PROC_glLockArraysEXT,
+    GLB_STUB_PROC_glLogicOp,
+    GLB_STUB_PROC_glMakeBufferNonResidentNV,
+    GLB_STUB_PROC_glMakeBufferResidentNV,
+    GLB_STUB_PROC_glMakeImageHandleNonResidentARB,
+    GLB_STUB_PROC_glMakeImageHandleNonResidentNV,
+    GLB_STUB_PROC_glMakeImageHandleResidentARB,
+    GLB_STUB_PROC_glMakeImageHandleResidentNV,
+    GLB_STUB_PROC_glMakeNamedBufferNonResidentNV,
+    GLB_STUB_PROC_glMakeNamedBufferResidentNV,
+    GLB_STUB_PROC_glMakeTextureHandleNonResidentARB,
+    GLB_STUB_PROC_glMakeTextureHandleNonResidentNV,
+    GLB_STUB_PROC_glMakeTextureHandleResidentARB,
+    GLB_STUB_PROC_glMakeTextureHandleResidentNV,
+    GLB_STUB_PROC_glMap1d,
+    GLB_STUB_PROC_glMap1f,
+    GLB_STUB_PROC_glMap1xOES,
+    GLB_STUB_PROC_glMap2d,
+    GLB_STUB_PROC_glMap2f,
+    GLB_STUB_PROC_glMap2xOES,
+    GLB_STUB_PROC_glMapBuffer,
+    GLB_STUB_PROC_glMapBufferARB,
+    GLB_STUB_PROC_glMapBufferRange,
+    GLB_STUB_PROC_glMapControlPointsNV,
+    GLB_STUB_PROC_glMapGrid1d,
+    GLB_STUB_PROC_glMapGrid1f,
+    GLB_STUB_PROC_glMapGrid1xOES,
+    GLB_STUB_PROC_glMapGrid2d,
+    GLB_STUB_PROC_glMapGrid2f,
+    GLB_STUB_PROC_glMapGrid2xOES,
+    GLB_STUB_PROC_glMapNamedBuffer,
+    GLB_STUB_PROC_glMapNamedBufferEXT,
+    GLB_STUB_PROC_glMapNamedBufferRange,
+    GLB_STUB_PROC_glMapNamedBufferRangeEXT,
+    GLB_STUB_PROC_glMapObjectBufferATI,
+    GLB_STUB_PROC_glMapParameterfvNV,
+    GLB_STUB_PROC_glMapParameterivNV,
+    GLB_STUB_PROC_glMapTexture2DINTEL,
+    GLB_STUB_PROC_glMapVertexAttrib1dAPPLE,
+    GLB_STUB_PROC_glMapVertexAttrib1fAPPLE,
+    GLB_STUB_PROC_glMapVertexAttrib2dAPPLE,
+    GLB_STUB_PROC_glMapVertexAttrib2fAPPLE,
+    GLB_STUB_PROC_glMaterialf,
+    GLB_STUB_PROC_glMaterialfv,
+    GLB_STUB_PROC_glMateriali,
+    GLB_STUB_PROC_glMaterialiv,
+    GLB_STUB_PROC_glMaterialxOES,
+    GLB_STUB_PROC_glMaterialxvOES,
+    GLB_STUB_PROC_glMatrixFrustumEXT,
+    GLB_STUB_PROC_glMatrixIndexPointerARB,
+    GLB_STUB_PROC_glMatrixIndexubvARB,
+    GLB_STUB_PROC_glMatrixIndexuivARB,
+    GLB_STUB_PROC_glMatrixIndexusvARB,
+    GLB_STUB_PROC_glMatrixLoad3x2fNV,
+    GLB_STUB_PROC_glMatrixLoad3x3fNV,
+    GLB_STUB_PROC_glMatrixLoadIdentityEXT,
+    GLB_STUB_PROC_glMatrixLoadTranspose3x3fNV,
+    GLB_STUB_PROC_glMatrixLoadTransposedEXT,
+    GLB_STUB_PROC_glMatrixLoadTransposefEXT,
+    GLB_STUB_PROC_glMatrixLoaddEXT,
+    GLB_STUB_PROC_glMatrixLoadfEXT,
+    GLB_STUB_PROC_glMatrixMode,
+    GLB_STUB_PROC_glMatrixMult3x2fNV,
+    GLB_STUB_PROC_glMatrixMult3x3fNV,
+    GLB_STUB_PROC_glMatrixMultTranspose3x3fNV,
+    GLB_STUB_PROC_glMatrixMultTransposedEXT,
+    GLB_STUB_PROC_glMatrixMultTransposefEXT,
+    GLB_STUB_PROC_glMatrixMultdEXT,
+    GLB_STUB_PROC_glMatrixMultfEXT,
+    GLB_STUB_PROC_glMatrixOrthoEXT,
+    GLB_STUB_PROC_glMatrixPopEXT,
+    GLB_STUB_PROC_glMatrixPushEXT,
+    GLB_STUB_PROC_glMatrixRotatedEXT,
+    GLB_STUB_PROC_glMatrixRotatefEXT,
+    GLB_STUB_PROC_glMatrixScaledEXT,
+    GLB_STUB_PROC_glMatrixScalefEXT,
+    GLB_STUB_PROC_glMatrixTranslatedEXT,
+    GLB_STUB_PROC_glMatrixTranslatefEXT,
+    GLB_STUB_PROC_glMaxShaderCompilerThreadsARB,
+    GLB_STUB_PROC_glMaxShaderCompilerThreadsKHR,
+    GLB_STUB_PROC_glMemoryBarrier,
+    GLB_STUB_PROC_glMemoryBarrierByRegion,
+    GLB_STUB_PROC_glMemoryBarrierEXT,
+    GLB_STUB_PROC_glMemoryObjectParameterivEXT,
+    GLB_STUB_PROC_glMinSampleShading,
+    GLB_STUB_PROC_glMinSampleShadingARB,
+    GLB_STUB_PROC_glMinmax,
+    GLB_STUB_PROC_glMinmaxEXT,
+    GLB_STUB_PROC_glMultMatrixd,
+    GLB_STUB_PROC_glMultMatrixf,
+    GLB_STUB_PROC_glMultMatrixxOES,
+    GLB_STUB_PROC_glMultTransposeMatrixd,
+    GLB_STUB_PROC_glMultTransposeMatrixdARB,
+    GLB_STUB_PROC_glMultTransposeMatrixf,
+    GLB_STUB_PROC_glMultTransposeMatrixfARB,
+    GLB_STUB_PROC_glMultTransposeMatrixxOES,
+    GLB_STUB_PROC_glMultiDrawArrays,
+    GLB_STUB_PROC_glMultiDrawArraysEXT,
+    GLB_STUB_PROC_glMultiDrawArraysIndirect,
+    GLB_STUB_PROC_glMultiDrawArraysIndirectAMD,
+    GLB_STUB_PROC_glMultiDrawArraysIndirectBindlessCountNV,
+    GLB_STUB_PROC_glMultiDrawArraysIndirectBindlessNV,
+    GLB_STUB_PROC_glMultiDrawArraysIndirectCount,
+    GLB_STUB_PROC_glMultiDrawArraysIndirectCountARB,
+    GLB_STUB_PROC_glMultiDrawElementArrayAPPLE,
+    GLB_STUB_PROC_glMultiDrawElements,
+    GLB_STUB_PROC_glMultiDrawElementsBaseVertex,
+    GLB_STUB_PROC_glMultiDrawElementsEXT,
+    GLB_STUB_PROC_glMultiDrawElementsIndirect,
+    GLB_STUB_PROC_glMultiDrawElementsIndirectAMD,
+    GLB_STUB_PROC_glMultiDrawElementsIndirectBindlessCountNV,
+    GLB_STUB_PROC_glMultiDrawElementsIndirectBindlessNV,
+    GLB_STUB_PROC_glMultiDrawElementsIndirectCount,
+    GLB_STUB_PROC_glMultiDrawElementsIndirectCountARB,
+    GLB_STUB_PROC_glMultiDrawMeshTasksIndirectCountNV,
+    GLB_STUB_PROC_glMultiDrawMeshTasksIndirectNV,
+    GLB_STUB_PROC_glMultiDrawRangeElementArrayAPPLE,
+    GLB_STUB_PROC_glMultiModeDrawArraysIBM,
+    GLB_STUB_PROC_glMultiModeDrawElementsIBM,
+    GLB_STUB_PROC_glMultiTexBufferEXT,
+    GLB_STUB_PROC_glMultiTexCoord1bOES,
+    GLB_STUB_PROC_glMultiTexCoord1bvOES,
+    GLB_STUB_PROC_glMultiTexCoord1d,
+    GLB_STUB_PROC_glMultiTexCoord1dARB,
+    GLB_STUB_PROC_glMultiTexCoord1dv,
+    GLB_STUB_PROC_glMultiTexCoord1dvARB,
+    GLB_STUB_PROC_glMultiTexCoord1f,
+    GLB_STUB_PROC_glMultiTexCoord1fARB,
+    GLB_STUB_PROC_glMultiTexCoord1fv,
+    GLB_STUB_PROC_glMultiTexCoord1fvARB,
+    GLB_STUB_PROC_glMultiTexCoord1hNV,
+    GLB_STUB_PROC_glMultiTexCoord1hvNV,
+    GLB_STUB_PROC_glMultiTexCoord1i,
+    GLB_STUB_PROC_glMultiTexCoord1iARB,
+    GLB_STUB_PROC_glMultiTexCoord1iv,
+    GLB_STUB_PROC_glMultiTexCoord1ivARB,
+    GLB_STUB_PROC_glMultiTexCoord1s,
+    GLB_STUB_PROC_glMultiTexCoord1sARB,
+    GLB_STUB_PROC_glMultiTexCoord1sv,
+    GLB_STUB_PROC_glMultiTexCoord1svARB,
+    GLB_STUB_PROC_glMultiTexCoord1xOES,
+    GLB_STUB_PROC_glMultiTexCoord1xvOES,
+    GLB_STUB_PROC_glMultiTexCoord2bOES,
+    GLB_STUB_PROC_glMultiTexCoord2bvOES,
+    GLB_STUB_PROC_glMultiTexCoord2d,
+    GLB_STUB_PROC_glMultiTexCoord2dARB,
+    GLB_STUB_PROC_glMultiTexCoord2dv,
+    GLB_STUB_PROC_glMultiTexCoord2dvARB,
+    GLB_STUB_PROC_glMultiTexCoord2f,
+    GLB_STUB_PROC_glMultiTexCoord2fARB,
+    GLB_STUB_PROC_glMultiTexCoord2fv,
+    GLB_STUB_PROC_glMultiTexCoord2fvARB,
+    GLB_STUB_PROC_glMultiTexCoord2hNV,
+    GLB_STUB_PROC_glMultiTexCoord2hvNV,
+    GLB_STUB_PROC_glMultiTexCoord2i,
+    GLB_STUB_PROC_glMultiTexCoord2iARB,
+    GLB_STUB_PROC_glMultiTexCoord2iv,
+    GLB_STUB_PROC_glMultiTexCoord2ivARB,
+    GLB_STUB_PROC_glMultiTexCoord2s,
+    GLB_STUB_PROC_glMultiTexCoord2sARB,
+    GLB_STUB_PROC_glMultiTexCoord2sv,
+    GLB_STUB_PROC_glMultiTexCoord2svARB,
+    GLB_STUB_PROC_glMultiTexCoord2xOES,
+    GLB_STUB_PROC_glMultiTexCoord2xvOES,
+    GLB_STUB_PROC_glMultiTexCoord3bOES,
+    GLB_STUB_PROC_glMultiTexCoord3bvOES,
+    GLB_STUB_PROC_glMultiTexCoord3d,
+    GLB_STUB_PROC_glMultiTexCoord3dARB,
+    GLB_STUB_PROC_glMultiTexCoord3dv,
+    GLB_STUB_PROC_glMultiTexCoord3dvARB,
+    GLB_STUB_PROC_glMultiTexCoord3f,
+    GLB_STUB_PROC_glMultiTexCoord3fARB,
+    GLB_STUB_PROC_glMultiTexCoord3fv,
+    GLB_STUB_PROC_glMultiTexCoord3fvARB,
+    GLB_STUB_PROC_glMultiTexCoord3hNV,
+    GLB_STUB_PROC_glMultiTexCoord3hvNV,
+    GLB_STUB_PROC_glMultiTexCoord3i,
+    GLB_STUB_PROC_glMultiTexCoord3iARB,
+    GLB_STUB_PROC_glMultiTexCoord3iv,
+    GLB_STUB_PROC_glMultiTexCoord3ivARB,
+    GLB_STUB_PROC_glMultiTexCoord3s,
+    GLB_STUB_PROC_glMultiTexCoord3sARB,
+    GLB_STUB_PROC_glMultiTexCoord3sv,
+    GLB_STUB_PROC_glMultiTexCoord3svARB,
+    GLB_STUB_PROC_glMultiTexCoord3xOES,
+    GLB_STUB_PROC_glMultiTexCoord3xvOES,
+    GLB_STUB_PROC_glMultiTexCoord4bOES,
+    GLB_STUB_PROC_glMultiTexCoord4bvOES,
+    GLB_STUB_PROC_glMultiTexCoord4d,
+    GLB_STUB_PROC_glMultiTexCoord4dARB,
+    GLB_STUB_PROC_glMultiTexCoord4dv,
+    GLB_STUB_PROC_glMultiTexCoord4dvARB,
+    GLB_STUB_PROC_glMultiTexCoord4f,
+    GLB_STUB_PROC_glMultiTexCoord4fARB,
+    GLB_STUB_PROC_glMultiTexCoord4fv,
+    GLB_STUB_PROC_glMultiTexCoord4fvARB,
+    GLB_STUB_PROC_glMultiTexCoord4hNV,
+    GLB_STUB_PROC_glMultiTexCoord4hvNV,
+    GLB_STUB_PROC_glMultiTexCoord4i,
+    GLB_STUB_PROC_glMultiTexCoord4iARB,
+    GLB_STUB_PROC_glMultiTexCoord4iv,
+    GLB_STUB_PROC_glMultiTexCoord4ivARB,
+    GLB_STUB_PROC_glMultiTexCoord4s,
+    GLB_STUB_PROC_glMultiTexCoord4sARB,
+    GLB_STUB_PROC_glMultiTexCoord4sv,
+    GLB_STUB_PROC_glMultiTexCoord4svARB,
+    GLB_STUB_PROC_glMultiTexCoord4xOES,
+    GLB_STUB_PROC_glMultiTexCoord4xvOES,
+    GLB_STUB_PROC_glMultiTexCoordP1ui,
+    GLB_STUB_PROC_glMultiTexCoordP1uiv,
+    GLB_STUB_PROC_glMultiTexCoordP2ui,
+    GLB_STUB_PROC_glMultiTexCoordP2uiv,
+    GLB_STUB_PROC_glMultiTexCoordP3ui,
+    GLB_STUB_PROC_glMultiTexCoordP3uiv,
+    GLB_STUB_PROC_glMultiTexCoordP4ui,
+    GLB_STUB_PROC_glMultiTexCoordP4uiv,
+    GLB_STUB_PROC_glMultiTexCoordPointerEXT,
+    GLB_STUB_PROC_glMultiTexEnvfEXT,
+    GLB_STUB_PROC_glMultiTexEnvfvEXT,
+    GLB_STUB_PROC_glMultiTexEnviEXT,
+    GLB_STUB_PROC_glMultiTexEnvivEXT,
+    GLB_STUB_PROC_glMultiTexGendEXT,
+    GLB_STUB_PROC_glMultiTexGendvEXT,
+    GLB_STUB_PROC_glMultiTexGenfEXT,
+    GLB_STUB_PROC_glMultiTexGenfvEXT,
+    GLB_STUB_PROC_glMultiTexGeniEXT,
+    GLB_STUB_PROC_glMultiTexGenivEXT,
+    GLB_STUB_PROC_glMultiTexImage1DEXT,
+    GLB_STUB_PROC_glMultiTexImage2DEXT,
+    GLB_STUB_PROC_glMultiTexImage3DEXT,
+    GLB_STUB_PROC_glMultiTexParameterIivEXT,
+    GLB_STUB_PROC_glMultiTexParameterIuivEXT,
+    GLB_STUB_PROC_glMultiTexParameterfEXT,
+    GLB_STUB_PROC_glMultiTexParameterfvEXT,
+    GLB_STUB_PROC_glMultiTexParameteriEXT,
+    GLB_STUB_PROC_glMultiTexParameterivEXT,
+    GLB_STUB_PROC_glMultiTexRenderbufferEXT,
+    GLB_STUB_PROC_glMultiTexSubImage1DEXT,
+    GLB_STUB_PROC_glMultiTexSubImage2DEXT,
+    GLB_STUB_PROC_glMultiTexSubImage3DEXT,
+    GLB_STUB_PROC_glMulticastBarrierNV,
+    GLB_STUB_PROC_glMulticastBlitFramebufferNV,
+    GLB_STUB_PROC_glMulticastBufferSubDataNV,
+    GLB_STUB_PROC_glMulticastCopyBufferSubDataNV,
+    GLB_STUB_PROC_glMulticastCopyImageSubDataNV,
+    GLB_STUB_PROC_glMulticastFramebufferSampleLocationsfvNV,
+    GLB_STUB_PROC_glMulticastGetQueryObjecti64vNV,
+    GLB_STUB_PROC_glMulticastGetQueryObjectivNV,
+    GLB_STUB_PROC_glMulticastGetQueryObjectui64vNV,
+    GLB_STUB_PROC_glMulticastGetQueryObjectuivNV,
+    GLB_STUB_PROC_glMulticastScissorArrayvNVX,
+    GLB_STUB_PROC_glMulticastViewportArrayvNVX,
+    GLB_STUB_PROC_glMulticastViewportPositionWScaleNVX,
+    GLB_STUB_PROC_glMulticastWaitSyncNV,
+    GLB_STUB_PROC_glNamedBufferAttachMemoryNV,
+    GLB_STUB_PROC_glNamedBufferData,
+    GLB_STUB_PROC_glNamedBufferDataEXT,
+    GLB_STUB_PROC_glNamedBufferPageCommitmentARB,
+    GLB_STUB_PROC_glNamedBufferPageCommitmentEXT,
+    GLB_STUB_PROC_glNamedBufferPageCommitmentMemNV,
+    GLB_STUB_PROC_glNamedBufferStorage,
+    GLB_STUB_PROC_glNamedBufferStorageEXT,
+    GLB_STUB_PROC_glNamedBufferStorageExternalEXT,
+    GLB_STUB_PROC_glNamedBufferStorageMemEXT,
+    GLB_STUB_PROC_glNamedBufferSubData,
+    GLB_STUB_PROC_glNamedBufferSubDataEXT,
+    GLB_STUB_PROC_glNamedCopyBufferSubDataEXT,
+    GLB_STUB_PROC_glNamedFramebufferDrawBuffer,
+    GLB_STUB_PROC_glNamedFramebufferDrawBuffers,
+    GLB_STUB_PROC_glNamedFramebufferParameteri,
+    GLB_STUB_PROC_glNamedFramebufferParameteriEXT,
+    GLB_STUB_PROC_glNamedFramebufferReadBuffer,
+    GLB_STUB_PROC_glNamedFramebufferRenderbuffer,
+    GLB_STUB_PROC_glNamedFramebufferRenderbufferEXT,
+    GLB_STUB_PROC_glNamedFramebufferSampleLocationsfvARB,
+    GLB_STUB_PROC_glNamedFramebufferSampleLocationsfvNV,
+    GLB_STUB_PROC_glNamedFramebufferSamplePositionsfvAMD,
+    GLB_STUB_PROC_glNamedFramebufferTexture,
+    GLB_STUB_PROC_glNamedFramebufferTexture1DEXT,
+    GLB_STUB_PROC_glNamedFramebufferTexture2DEXT,
+    GLB_STUB_PROC_glNamedFramebufferTexture3DEXT,
+    GLB_STUB_PROC_glNamedFramebufferTextureEXT,
+    GLB_STUB_PROC_glNamedFramebufferTextureFaceEXT,
+    GLB_STUB_PROC_glNamedFramebufferTextureLayer,
+    GLB_STUB_PROC_glNamedFramebufferTextureLayerEXT,
+    GLB_STUB_PROC_glNamedProgramLocalParameter4dEXT,
+    GLB_STUB_PROC_glNamedProgramLocalParameter4dvEXT,
+    GLB_STUB_PROC_glNamedProgramLocalParameter4fEXT,
+    GLB_STUB_PROC_glNamedProgramLocalParameter4fvEXT,
+    GLB_STUB_PROC_glNamedProgramLocalParameterI4iEXT,
+    GLB_STUB_PROC_glNamedProgramLocalParameterI4ivEXT,
+    GLB_STUB_PROC_glNamedProgramLocalParameterI4uiEXT,
+    GLB_STUB_PROC_glNamedProgramLocalParameterI4uivEXT,
+    GLB_STUB_PROC_glNamedProgramLocalParameters4fvEXT,
+    GLB_STUB_PROC_glNamedProgramLocalParametersI4ivEXT,
+    GLB_STUB_PROC_glNamedProgramLocalParametersI4uivEXT,
+    GLB_STUB_PROC_glNamedProgramStringEXT,
+    GLB_STUB_PROC_glNamedRenderbufferStorage,
+    GLB_STUB_PROC_glNamedRenderbufferStorageEXT,
+    GLB_STUB_PROC_glNamedRenderbufferStorageMultisample,
+    GLB_STUB_PROC_glNamedRenderbufferStorageMultisampleAdvancedAMD,
+    GLB_STUB_PROC_glNamedRenderbufferStorageMultisampleCoverageEXT,
+    GLB_STUB_PROC_glNamedRenderbufferStorageMultisampleEXT,
+    GLB_STUB_PROC_glNamedStringARB,
+    GLB_STUB_PROC_glNewList,
+    GLB_STUB_PROC_glNewObjectBufferATI,
+    GLB_STUB_PROC_glNormal3b,
+    GLB_STUB_PROC_glNormal3bv,
+    GLB_STUB_PROC_glNormal3d,
+    GLB_STUB_PROC_glNormal3dv,
+    GLB_STUB_PROC_glNormal3f,
+    GLB_STUB_PROC_glNormal3fVertex3fSUN,
+    GLB_STUB_PROC_glNormal3fVertex3fvSUN,
+    GLB_STUB_PROC_glNormal3fv,
+    GLB_STUB_PROC_glNormal3hNV,
+    GLB_STUB_PROC_glNormal3hvNV,
+    GLB_STUB_PROC_glNormal3i,
+    GLB_STUB_PROC_glNormal3iv,
+    GLB_STUB_PROC_glNormal3s,
+    GLB_STUB_PROC_glNormal3sv,
+    GLB_STUB_PROC_glNormal3xOES,
+    GLB_STUB_PROC_glNormal3xvOES,
+    GLB_STUB_PROC_glNormalFormatNV,
+    GLB_STUB_PROC_glNormalP3ui,
+    GLB_STUB_PROC_glNormalP3uiv,
+    GLB_STUB_PROC_glNormalPointer,
+    GLB_STUB_PROC_glNormalPointerEXT,
+    GLB_STUB_PROC_glNormalPointerListIBM,
+    GLB_STUB_PROC_glNormalPointervINTEL,
+    GLB_STUB_PROC_glNormalStream3bATI,
+    GLB_STUB_PROC_glNormalStream3bvATI,
+    GLB_STUB_PROC_glNormalStream3dATI,
+    GLB_STUB_PROC_glNormalStream3dvATI,
+    GLB_STUB_PROC_glNormalStream3fATI,
+    GLB_STUB_PROC_glNormalStream3fvATI,
+    GLB_STUB_PROC_glNormalStream3iATI,
+    GLB_STUB_PROC_glNormalStream3ivATI,
+    GLB_STUB_PROC_glNormalStream3sATI,
+    GLB_STUB_PROC_glNormalStream3svATI,
+    GLB_STUB_PROC_glObjectLabel,
+    GLB_STUB_PROC_glObjectLabelKHR,
+    GLB_STUB_PROC_glObjectPtrLabel,
+    GLB_STUB_PROC_glObjectPtrLabelKHR,
+    GLB_STUB_PROC_glObjectPurgeableAPPLE,
+    GLB_STUB_PROC_glObjectUnpurgeableAPPLE,
+    GLB_STUB_PROC_glOrtho,
+    GLB_STUB_PROC_glOrthofOES,
+    GLB_STUB_PROC_glOrthoxOES,
+    GLB_STUB_PROC_glPNTrianglesfATI,
+    GLB_STUB_PROC_glPNTrianglesiATI,
+    GLB_STUB_PROC_glPassTexCoordATI,
+    GLB_STUB_PROC_glPassThrough,
+    GLB_STUB_PROC_glPassThroughxOES,
+    GLB_STUB_PROC_glPatchParameterfv,
+    GLB_STUB_PROC_glPatchParameteri,
+    GLB_STUB_PROC_glPathColorGenNV,
+    GLB_STUB_PROC_glPathCommandsNV,
+    GLB_STUB_PROC_glPathCoordsNV,
+    GLB_STUB_PROC_glPathCoverDepthFuncNV,
+    GLB_STUB_PROC_glPathDashArrayNV,
+    GLB_STUB_PROC_glPathFogGenNV,
+    GLB_STUB_PROC_glPathGlyphIndexArrayNV,
+    GLB_STUB_PROC_glPathGlyphIndexRangeNV,
+    GLB_STUB_PROC_glPathGlyphRangeNV,
+    GLB_STUB_PROC_glPathGlyphsNV,
+    GLB_STUB_PROC_glPathMemoryGlyphIndexArrayNV,
+    GLB_STUB_PROC_glPathParameterfNV,
+    GLB_STUB_PROC_glPathParameterfvNV,
+    GLB_STUB_PROC_glPathParameteriNV,
+    GLB_STUB_PROC_glPathParameterivNV,
+    GLB_STUB_PROC_glPathStencilDepthOffsetNV,
+    GLB_STUB_PROC_glPathStencilFuncNV,
+    GLB_STUB_PROC_glPathStringNV,
+    GLB_STUB_PROC_glPathSubCommandsNV,
+    GLB_STUB_PROC_glPathSubCoordsNV,
+    GLB_STUB_PROC_glPathTexGenNV,
+    GLB_STUB_PROC_glPauseTransformFeedback,
+    GLB_STUB_PROC_glPauseTransformFeedbackNV,
+    GLB_STUB_PROC_glPixelDataRangeNV,
+    GLB_STUB_PROC_glPixelMapfv,
+    GLB_STUB_PROC_glPixelMapuiv,
+    GLB_STUB_PROC_glPixelMapusv,
+    GLB_STUB_PROC_glPixelMapx,
+    GLB_STUB_PROC_glPixelStoref,
+    GLB_STUB_PROC_glPixelStorei,
+    GLB_STUB_PROC_glPixelStorex,
+    GLB_STUB_PROC_glPixelTexGenParameterfSGIS,
+    GLB_STUB_PROC_glPixelTexGenParameterfvSGIS,
+    GLB_STUB_PROC_glPixelTexGenParameteriSGIS,
+    GLB_STUB_PROC_glPixelTexGenParameterivSGIS,
+    GLB_STUB_PROC_glPixelTexGenSGIX,
+    GLB_STUB_PROC_glPixelTransferf,
+    GLB_STUB_PROC_glPixelTransferi,
+    GLB_STUB_PROC_glPixelTransferxOES,
+    GLB_STUB_PROC_glPixelTransformParameterfEXT,
+    GLB_STUB_PROC_glPixelTransformParameterfvEXT,
+    GLB_STUB_PROC_glPixelTransformParameteriEXT,
+    GLB_STUB_PROC_glPixelTransformParameterivEXT,
+    GLB_STUB_PROC_glPixelZoom,
+    GLB_STUB_PROC_glPixelZoomxOES,
+    GLB_STUB_PROC_glPointAlongPathNV,
+    GLB_STUB_PROC_glPointParameterf,
+    GLB_STUB_PROC_glPointParameterfARB,
+    GLB_STUB_PROC_glPointParameterfEXT,
+    GLB_STUB_PROC_glPointParameterfSGIS,
+    GLB_STUB_PROC_glPointParameterfv,
+    GLB_STUB_PROC_glPointParameterfvARB,
+    GLB_STUB_PROC_glPointParameterfvEXT,
+    GLB_STUB_PROC_glPointParameterfvSGIS,
+    GLB_STUB_PROC_glPointParameteri,
+    GLB_STUB_PROC_glPointParameteriNV,
+    GLB_STUB_PROC_glPointParameteriv,
+    GLB_STUB_PROC_glPointParameterivNV,
+    GLB_STUB_PROC_glPointParameterxOES,
+    GLB_STUB_PROC_glPointParameterxvOES,
+    GLB_STUB_PROC_glPointSize,
+    GLB_STUB_PROC_glPointSizexOES,
+    GLB_STUB_PROC_glPollAsyncSGIX,
+    GLB_STUB_PROC_glPollInstrumentsSGIX,
+    GLB_STUB_PROC_glPolygonMode,
+    GLB_STUB_PROC_glPolygonOffset,
+    GLB_STUB_PROC_glPolygonOffsetClamp,
+    GLB_STUB_PROC_glPolygonOffsetClampEXT,
+    GLB_STUB_PROC_glPolygonOffsetEXT,
+    GLB_STUB_PROC_glPolygonOffsetxOES,
+    GLB_STUB_PROC_glPolygonStipple,
+    GLB_STUB_PROC_glPopAttrib,
+    GLB_STUB_PROC_glPopClientAttrib,
+    GLB_STUB_PROC_glPopDebugGroup,
+    GLB_STUB_PROC_glPopDebugGroupKHR,
+    GLB_STUB_PROC_glPopGroupMarkerEXT,
+    GLB_STUB_PROC_glPopMatrix,
+    GLB_STUB_PROC_glPopName,
+    GLB_STUB_PROC_glPresentFrameDualFillNV,
+    GLB_STUB_PROC_glPresentFrameKeyedNV,
+    GLB_STUB_PROC_glPrimitiveBoundingBoxARB,
+    GLB_STUB_PROC_glPrimitiveRestartIndex,
+    GLB_STUB_PROC_glPrimitiveRestartIndexNV,
+    GLB_STUB_PROC_glPrimitiveRestartNV,
+    GLB_STUB_PROC_glPrioritizeTextures,
+    GLB_STUB_PROC_glPrioritizeTexturesEXT,
+    GLB_STUB_PROC_glPrioritizeTexturesxOES,
+    GLB_STUB_PROC_glProgramBinary,
+    GLB_STUB_PROC_glProgramBufferParametersIivNV,
+    GLB_STUB_PROC_glProgramBufferParametersIuivNV,
+    GLB_STUB_PROC_glProgramBufferParametersfvNV,
+    GLB_STUB_PROC_glProgramEnvParameter4dARB,
+    GLB_STUB_PROC_glProgramEnvParameter4dvARB,
+    GLB_STUB_PROC_glProgramEnvParameter4fARB,
+    GLB_STUB_PROC_glProgramEnvParameter4fvARB,
+    GLB_STUB_PROC_glProgramEnvParameterI4iNV,
+    GLB_STUB_PROC_glProgramEnvParameterI4ivNV,
+    GLB_STUB_PROC_glProgramEnvParameterI4uiNV,
+    GLB_STUB_PROC_glProgramEnvParameterI4uivNV,
+    GLB_STUB_PROC_glProgramEnvParameters4fvEXT,
+    GLB_STUB_PROC_glProgramEnvParametersI4ivNV,
+    GLB_STUB_PROC_glProgramEnvParametersI4uivNV,
+    GLB_STUB_PROC_glProgramLocalParameter4dARB,
+    GLB_STUB_PROC_glProgramLocalParameter4dvARB,
+    GLB_STUB_PROC_glProgramLocalParameter4fARB,
+    GLB_STUB_PROC_glProgramLocalParameter4fvARB,
+    GLB_STUB_PROC_glProgramLocalParameterI4iNV,
+    GLB_STUB_PROC_glProgramLocalParameterI4ivNV,
+    GLB_STUB_PROC_glProgramLocalParameterI4uiNV,
+    GLB_STUB_PROC_glProgramLocalParameterI4uivNV,
+    GLB_STUB_PROC_glProgramLocalParameters4fvEXT,
+    GLB_STUB_PROC_glProgramLocalParametersI4ivNV,
+    GLB_STUB_PROC_glProgramLocalParametersI4uivNV,
+    GLB_STUB_PROC_glProgramNamedParameter4dNV,
+    GLB_STUB_PROC_glProgramNamedParameter4dvNV,
+    GLB_STUB_PROC_glProgramNamedParameter4fNV,
+    GLB_STUB_PROC_glProgramNamedParameter4fvNV,
+    GLB_STUB_PROC_glProgramParameter4dNV,
+    GLB_STUB_PROC_glProgramParameter4dvNV,
+    GLB_STUB_PROC_glProgramParameter4fNV,
+    GLB_STUB_PROC_glProgramParameter4fvNV,
+    GLB_STUB_PROC_glProgramParameteri,
+    GLB_STUB_PROC_glProgramParameteriARB,
+    GLB_STUB_PROC_glProgramParameteriEXT,
+    GLB_STUB_PROC_glProgramParameters4dvNV,
+    GLB_STUB_PROC_glProgramParameters4fvNV,
+    GLB_STUB_PROC_glProgramPathFragmentInputGenNV,
+    GLB_STUB_PROC_glProgramStringARB,
+    GLB_STUB_PROC_glProgramSubroutineParametersuivNV,
+    GLB_STUB_PROC_glProgramUniform1d,
+    GLB_STUB_PROC_glProgramUniform1dEXT,
+    GLB_STUB_PROC_glProgramUniform1dv,
+    GLB_STUB_PROC_glProgramUniform1dvEXT,
+    GLB_STUB_PROC_glProgramUniform1f,
+    GLB_STUB_PROC_glProgramUniform1fEXT,
+    GLB_STUB_PROC_glProgramUniform1fv,
+    GLB_STUB_PROC_glProgramUniform1fvEXT,
+    GLB_STUB_PROC_glProgramUniform1i,
+    GLB_STUB_PROC_glProgramUniform1i64ARB,
+    GLB_STUB_PROC_glProgramUniform1i64NV,
+    GLB_STUB_PROC_glProgramUniform1i64vARB,
+    GLB_STUB_PROC_glProgramUniform1i64vNV,
+    GLB_STUB_PROC_glProgramUniform1iEXT,
+    GLB_STUB_PROC_glProgramUniform1iv,
+    GLB_STUB_PROC_glProgramUniform1ivEXT,
+    GLB_STUB_PROC_glProgramUniform1ui,
+    GLB_STUB_PROC_glProgramUniform1ui64ARB,
+    GLB_STUB_PROC_glProgramUniform1ui64NV,
+    GLB_STUB_PROC_glProgramUniform1ui64vARB,
+    GLB_STUB_PROC_glProgramUniform1ui64vNV,
+    GLB_STUB_PROC_glProgramUniform1uiEXT,
+    GLB_STUB_PROC_glProgramUniform1uiv,
+    GLB_STUB_PROC_glProgramUniform1uivEXT,
+    GLB_STUB_PROC_glProgramUniform2d,
+    GLB_STUB_PROC_glProgramUniform2dEXT,
+    GLB_STUB_PROC_glProgramUniform2dv,
+    GLB_STUB_PROC_glProgramUniform2dvEXT,
+    GLB_STUB_PROC_glProgramUniform2f,
+    GLB_STUB_PROC_glProgramUniform2fEXT,
+    GLB_STUB_PROC_glProgramUniform2fv,
+    GLB_STUB_PROC_glProgramUniform2fvEXT,
+    GLB_STUB_PROC_glProgramUniform2i,
+    GLB_STUB_PROC_glProgramUniform2i64ARB,
+    GLB_STUB_PROC_glProgramUniform2i64NV,
+    GLB_STUB_PROC_glProgramUniform2i64vARB,
+    GLB_STUB_PROC_glProgramUniform2i64vNV,
+    GLB_STUB_PROC_glProgramUniform2iEXT,
+    GLB_STUB_PROC_glProgramUniform2iv,
+    GLB_STUB_PROC_glProgramUniform2ivEXT,
+    GLB_STUB_PROC_glProgramUniform2ui,
+    GLB_STUB_PROC_glProgramUniform2ui64ARB,
+    GLB_STUB_PROC_glProgramUniform2ui64NV,
+    GLB_STUB_PROC_glProgramUniform2ui64vARB,
+    GLB_STUB_PROC_glProgramUniform2ui64vNV,
+    GLB_STUB_PROC_glProgramUniform2uiEXT,
+    GLB_STUB_PROC_glProgramUniform2uiv,
+    GLB_STUB_PROC_glProgramUniform2uivEXT,
+    GLB_STUB_PROC_glProgramUniform3d,
+    GLB_STUB_PROC_glProgramUniform3dEXT,
+    GLB_STUB_PROC_glProgramUniform3dv,
+    GLB_STUB_PROC_glProgramUniform3dvEXT,
+    GLB_STUB_PROC_glProgramUniform3f,
+    GLB_STUB_PROC_glProgramUniform3fEXT,
+    GLB_STUB_PROC_glProgramUniform3fv,
+    GLB_STUB_PROC_glProgramUniform3fvEXT,
+    GLB_STUB_PROC_glProgramUniform3i,
+    GLB_STUB_PROC_glProgramUniform3i64ARB,
+    GLB_STUB_PROC_glProgramUniform3i64NV,
+    GLB_STUB_PROC_glProgramUniform3i64vARB,
+    GLB_STUB_PROC_glProgramUniform3i64vNV,
+    GLB_STUB_PROC_glProgramUniform3iEXT,
+    GLB_STUB_PROC_glProgramUniform3iv,
+    GLB_STUB_PROC_glProgramUniform3ivEXT,
+    GLB_STUB_PROC_glProgramUniform3ui,
+    GLB_STUB_PROC_glProgramUniform3ui64ARB,
+    GLB_STUB_PROC_glProgramUniform3ui64NV,
+    GLB_STUB_PROC_glProgramUniform3ui64vARB,
+    GLB_STUB_PROC_glProgramUniform3ui64vNV,
+    GLB_STUB_PROC_glProgramUniform3uiEXT,
+    GLB_STUB_PROC_glProgramUniform3uiv,
+    GLB_STUB_PROC_glProgramUniform3uivEXT,
+    GLB_STUB_PROC_glProgramUniform4d,
+    GLB_STUB_PROC_glProgramUniform4dEXT,
+    GLB_STUB_PROC_glProgramUniform4dv,
+    GLB_STUB_PROC_glProgramUniform4dvEXT,
+    GLB_STUB_PROC_glProgramUniform4f,
+    GLB_STUB_PROC_glProgramUniform4fEXT,
+    GLB_STUB_PROC_glProgramUniform4fv,
+    GLB_STUB_PROC_glProgramUniform4fvEXT,
+    GLB_STUB_PROC_glProgramUniform4i,
+    GLB_STUB_PROC_glProgramUniform4i64ARB,
+    GLB_STUB_PROC_glProgramUniform4i64NV,
+    GLB_STUB_PROC_glProgramUniform4i64vARB,
+    GLB_STUB_PROC_glProgramUniform4i64vNV,
+    GLB_STUB_PROC_glProgramUniform4iEXT,
+    GLB_STUB_PROC_glProgramUniform4iv,
+    GLB_STUB_PROC_glProgramUniform4ivEXT,
+    GLB_STUB_PROC_glProgramUniform4ui,
+    GLB_STUB_PROC_glProgramUniform4ui64ARB,
+    GLB_STUB_PROC_glProgramUniform4ui64NV,
+    GLB_STUB_PROC_glProgramUniform4ui64vARB,
+    GLB_STUB_PROC_glProgramUniform4ui64vNV,
+    GLB_STUB_PROC_glProgramUniform4uiEXT,
+    GLB_STUB_PROC_glProgramUniform4uiv,
+    GLB_STUB_PROC_glProgramUniform4uivEXT,
+    GLB_STUB_PROC_glProgramUniformHandleui64ARB,
+    GLB_STUB_PROC_glProgramUniformHandleui64NV,
+    GLB_STUB_PROC_glProgramUniformHandleui64vARB,
+    GLB_STUB_PROC_glProgramUniformHandleui64vNV,
+    GLB_STUB_PROC_glProgramUniformMatrix2dv,
+    GLB_STUB_PROC_glProgramUniformMatrix2dvEXT,
+    GLB_STUB_PROC_glProgramUniformMatrix2fv,
+    GLB_STUB_PROC_glProgramUniformMatrix2fvEXT,
+    GLB_STUB_PROC_glProgramUniformMatrix2x3dv,
+    GLB_STUB_PROC_glProgramUniformMatrix2x3dvEXT,
+    GLB_STUB_PROC_glProgramUniformMatrix2x3fv,
+    GLB_STUB_PROC_glProgramUniformMatrix2x3fvEXT,
+    GLB_STUB_PROC_glProgramUniformMatrix2x4dv,
+    GLB_STUB_PROC_glProgramUniformMatrix2x4dvEXT,
+    GLB_STUB_PROC_glProgramUniformMatrix2x4fv,
+    GLB_STUB_PROC_glProgramUniformMatrix2x4fvEXT,
+    GLB_STUB_PROC_glProgramUniformMatrix3dv,
+    GLB_STUB_PROC_glProgramUniformMatrix3dvEXT,
+    GLB_STUB_PROC_glProgramUniformMatrix3fv,
+    GLB_STUB_PROC_glProgramUniformMatrix3fvEXT,
+    GLB_STUB_PROC_glProgramUniformMatrix3x2dv,
+    GLB_STUB_PROC_glProgramUniformMatrix3x2dvEXT,
+    GLB_STUB_PROC_glProgramUniformMatrix3x2fv,
+    GLB_STUB_PROC_glProgramUniformMatrix3x2fvEXT,
+    GLB_STUB_PROC_glProgramUniformMatrix3x4dv,
+    GLB_STUB_PROC_glProgramUniformMatrix3x4dvEXT,
+    GLB_STUB_PROC_glProgramUniformMatrix3x4fv,
+    GLB_STUB_PROC_glProgramUniformMatrix3x4fvEXT,
+    GLB_STUB_PROC_glProgramUniformMatrix4dv,
+    GLB_STUB_PROC_glProgramUniformMatrix4dvEXT,
+    GLB_STUB_PROC_glProgramUniformMatrix4fv,
+    GLB_STUB_PROC_glProgramUniformMatrix4fvEXT,
+    GLB_STUB_PROC_glProgramUniformMatrix4x2dv,
+    GLB_STUB_PROC_glProgramUniformMatrix4x2dvEXT,
+    GLB_STUB_PROC_glProgramUniformMatrix4x2fv,
+    GLB_STUB_PROC_glProgramUniformMatrix4x2fvEXT,
+    GLB_STUB_PROC_glProgramUniformMatrix4x3dv,
+    GLB_STUB_PROC_glProgramUniformMatrix4x3dvEXT,
+    GLB_STUB_PROC_glProgramUniformMatrix4x3fv,
+    GLB_STUB_PROC_glProgramUniformMatrix4x3fvEXT,
+    GLB_STUB_PROC_glProgramUniformui64NV,
+    GLB_STUB_PROC_glProgramUniformui64vNV,
+    GLB_STUB_PROC_glProgramVertexLimitNV,
+    GLB_STUB_PROC_glProvokingVertex,
+    GLB_STUB_PROC_glProvokingVertexEXT,
+    GLB_STUB_PROC_glPushAttrib,
+    GLB_STUB_PROC_glPushClientAttrib,
+    GLB_STUB_PROC_glPushClientAttribDefaultEXT,
+    GLB_STUB_PROC_glPushDebugGroup,
+    GLB_STUB_PROC_glPushDebugGroupKHR,
+    GLB_STUB_PROC_glPushGroupMarkerEXT,
+    GLB_STUB_PROC_glPushMatrix,
+    GLB_STUB_PROC_glPushName,
+    GLB_STUB_PROC_glQueryCounter,
+    GLB_STUB_PROC_glQueryMatrixxOES,
+    GLB_STUB_PROC_glQueryObjectParameteruiAMD,
+    GLB_STUB_PROC_glQueryResourceNV,
+    GLB_STUB_PROC_glQueryResourceTagNV,
+    GLB_STUB_PROC_glRasterPos2d,
+    GLB_STUB_PROC_glRasterPos2dv,
+    GLB_STUB_PROC_glRasterPos2f,
+    GLB_STUB_PROC_glRasterPos2fv,
+    GLB_STUB_PROC_glRasterPos2i,
+    GLB_STUB_PROC_glRasterPos2iv,
+    GLB_STUB_PROC_glRasterPos2s,
+    GLB_STUB_PROC_glRasterPos2sv,
+    GLB_STUB_PROC_glRasterPos2xOES,
+    GLB_STUB_PROC_glRasterPos2xvOES,
+    GLB_STUB_PROC_glRasterPos3d,
+    GLB_STUB_PROC_glRasterPos3dv,
+    GLB_STUB_PROC_glRasterPos3f,
+    GLB_STUB_PROC_glRasterPos3fv,
+    GLB_STUB_PROC_glRasterPos3i,
+    GLB_STUB_PROC_glRasterPos3iv,
+    GLB_STUB_PROC_glRasterPos3s,
+    GLB_STUB_PROC_glRasterPos3sv,
+    GLB_STUB_PROC_glRasterPos3xOES,
+    GLB_STUB_PROC_glRasterPos3xvOES,
+    GLB_STUB_PROC_glRasterPos4d,
+    GLB_STUB_PROC_glRasterPos4dv,
+    GLB_STUB_PROC_glRasterPos4f,
+    GLB_STUB_PROC_glRasterPos4fv,
+    GLB_STUB_PROC_glRasterPos4i,
+    GLB_STUB_PROC_glRasterPos4iv,
+    GLB_STUB_PROC_glRasterPos4s,
+    GLB_STUB_PROC_glRasterPos4sv,
+    GLB_STUB_PROC_glRasterPos4xOES,
+    GLB_STUB_PROC_glRasterPos4xvOES,
+    GLB_STUB_PROC_glRasterSamplesEXT,
+    GLB_STUB_PROC_glReadBuffer,
+    GLB_STUB_PROC_glReadInstrumentsSGIX,
+    GLB_STUB_PROC_glReadPixels,
+    GLB_STUB_PROC_glReadnPixels,
+    GLB_STUB_PROC_glReadnPixelsARB,
+    GLB_STUB_PROC_glReadnPixelsKHR,
+    GLB_STUB_PROC_glRectd,
+    GLB_STUB_PROC_glRectdv,
+    GLB_STUB_PROC_glRectf,
+    GLB_STUB_PROC_glRectfv,
+    GLB_STUB_PROC_glRecti,
+    GLB_STUB_PROC_glRectiv,
+    GLB_STUB_PROC_glRects,
+    GLB_STUB_PROC_glRectsv,
+    GLB_STUB_PROC_glRectxOES,
+    GLB_STUB_PROC_glRectxvOES,
+    GLB_STUB_PROC_glReferencePlaneSGIX,
+    GLB_STUB_PROC_glReleaseKeyedMutexWin32EXT,
+    GLB_STUB_PROC_glReleaseShaderCompiler,
+    GLB_STUB_PROC_glRenderGpuMaskNV,
+    GLB_STUB_PROC_glRenderMode,
+    GLB_STUB_PROC_glRenderbufferStorage,
+    GLB_STUB_PROC_glRenderbufferStorageEXT,
+    GLB_STUB_PROC_glRenderbufferStorageMultisample,
+    GLB_STUB_PROC_glRenderbufferStorageMultisampleAdvancedAMD,
+    GLB_STUB_PROC_glRenderbufferStorageMultisampleCoverageNV,
+    GLB_STUB_PROC_glRenderbufferStorageMultisampleEXT,
+    GLB_STUB_PROC_glReplacementCodePointerSUN,
+    GLB_STUB_PROC_glReplacementCodeubSUN,
+    GLB_STUB_PROC_glReplacementCodeubvSUN,
+    GLB_STUB_PROC_glReplacementCodeuiColor3fVertex3fSUN,
+    GLB_STUB_PROC_glReplacementCodeuiColor3fVertex3fvSUN,
+    GLB_STUB_PROC_glReplacementCodeuiColor4fNormal3fVertex3fSUN,
+    GLB_STUB_PROC_glReplacementCodeuiColor4fNormal3fVertex3fvSUN,
+    GLB_STUB_PROC_glReplacementCodeuiColor4ubVertex3fSUN,
+    GLB_STUB_PROC_glReplacementCodeuiColor4ubVertex3fvSUN,
+    GLB_STUB_PROC_glReplacementCodeuiNormal3fVertex3fSUN,
+    GLB_STUB_PROC_glReplacementCodeuiNormal3fVertex3fvSUN,
+    GLB_STUB_PROC_glReplacementCodeuiSUN,
+    GLB_STUB_PROC_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN,
+    GLB_STUB_PROC_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN,
+    GLB_STUB_PROC_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN,
+    GLB_STUB_PROC_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN,
+    GLB_STUB_PROC_glReplacementCodeuiTexCoord2fVertex3fSUN,
+    GLB_STUB_PROC_glReplacementCodeuiTexCoord2fVertex3fvSUN,
+    GLB_STUB_PROC_glReplacementCodeuiVertex3fSUN,
+    GLB_STUB_PROC_glReplacementCodeuiVertex3fvSUN,
+    GLB_STUB_PROC_glReplacementCodeuivSUN,
+    GLB_STUB_PROC_glReplacementCodeusSUN,
+    GLB_STUB_PROC_glReplacementCodeusvSUN,
+    GLB_STUB_PROC_glRequestResidentProgramsNV,
+    GLB_STUB_PROC_glResetHistogram,
+    GLB_STUB_PROC_glResetHistogramEXT,
+    GLB_STUB_PROC_glResetMemoryObjectParameterNV,
+    GLB_STUB_PROC_glResetMinmax,
+    GLB_STUB_PROC_glResetMinmaxEXT,
+    GLB_STUB_PROC_glResizeBuffersMESA,
+    GLB_STUB_PROC_glResolveDepthValuesNV,
+    GLB_STUB_PROC_glResumeTransformFeedback,
+    GLB_STUB_PROC_glResumeTransformFeedbackNV,
+    GLB_STUB_PROC_glRotated,
+    GLB_STUB_PROC_glRotatef,
+    GLB_STUB_PROC_glRotatexOES,
+    GLB_STUB_PROC_glSampleCoverage,
+    GLB_STUB_PROC_glSampleCoverageARB,
+    GLB_STUB_PROC_glSampleCoveragexOES,
+    GLB_STUB_PROC_glSampleMapATI,
+    GLB_STUB_PROC_glSampleMaskEXT,
+    GLB_STUB_PROC_glSampleMaskIndexedNV,
+    GLB_STUB_PROC_glSampleMaskSGIS,
+    GLB_STUB_PROC_glSampleMaski,
+    GLB_STUB_PROC_glSamplePatternEXT,
+    GLB_STUB_PROC_glSamplePatternSGIS,
+    GLB_STUB_PROC_glSamplerParameterIiv,
+    GLB_STUB_PROC_glSamplerParameterIuiv,
+    GLB_STUB_PROC_glSamplerParameterf,
+    GLB_STUB_PROC_glSamplerParameterfv,
+    GLB_STUB_PROC_glSamplerParameteri,
+    GLB_STUB_PROC_glSamplerParameteriv,
+    GLB_STUB_PROC_glScaled,
+    GLB_STUB_PROC_glScalef,
+    GLB_STUB_PROC_glScalexOES,
+    GLB_STUB_PROC_glScissor,
+    GLB_STUB_PROC_glScissorArrayv,
+    GLB_STUB_PROC_glScissorExclusiveArrayvNV,
+    GLB_STUB_PROC_glScissorExclusiveNV,
+    GLB_STUB_PROC_glScissorIndexed,
+    GLB_STUB_PROC_glScissorIndexedv,
+    GLB_STUB_PROC_glSecondaryColor3b,
+    GLB_STUB_PROC_glSecondaryColor3bEXT,
+    GLB_STUB_PROC_glSecondaryColor3bv,
+    GLB_STUB_PROC_glSecondaryColor3bvEXT,
+    GLB_STUB_PROC_glSecondaryColor3d,
+    GLB_STUB_PROC_glSecondaryColor3dEXT,
+    GLB_STUB_PROC_glSecondaryColor3dv,
+    GLB_STUB_PROC_glSecondaryColor3dvEXT,
+    GLB_STUB_PROC_glSecondaryColor3f,
+    GLB_STUB_PROC_glSecondaryColor3fEXT,
+    GLB_STUB_PROC_glSecondaryColor3fv,
+    GLB_STUB_PROC_glSecondaryColor3fvEXT,
+    GLB_STUB_PROC_glSecondaryColor3hNV,
+    GLB_STUB_PROC_glSecondaryColor3hvNV,
+    GLB_STUB_PROC_glSecondaryColor3i,
+    GLB_STUB_PROC_glSecondaryColor3iEXT,
+    GLB_STUB_PROC_glSecondaryColor3iv,
+    GLB_STUB_PROC_glSecondaryColor3ivEXT,
+    GLB_STUB_PROC_glSecondaryColor3s,
+    GLB_STUB_PROC_glSecondaryColor3sEXT,
+    GLB_STUB_PROC_glSecondaryColor3sv,
+    GLB_STUB_PROC_glSecondaryColor3svEXT,
+    GLB_STUB_PROC_glSecondaryColor3ub,
+    GLB_STUB_PROC_glSecondaryColor3ubEXT,
+    GLB_STUB_PROC_glSecondaryColor3ubv,
+    GLB_STUB_PROC_glSecondaryColor3ubvEXT,
+    GLB_STUB_PROC_glSecondaryColor3ui,
+    GLB_STUB_PROC_glSecondaryColor3uiEXT,
+    GLB_STUB_PROC_glSecondaryColor3uiv,
+    GLB_STUB_PROC_glSecondaryColor3uivEXT,
+    GLB_STUB_PROC_glSecondaryColor3us,
+    GLB_STUB_PROC_glSecondaryColor3usEXT,
+    GLB_STUB_PROC_glSecondaryColor3usv,
+    GLB_STUB_PROC_glSecondaryColor3usvEXT,
+    GLB_STUB_PROC_glSecondaryColorFormatNV,
+    GLB_STUB_PROC_glSecondaryColorP3ui,
+    GLB_STUB_PROC_glSecondaryColorP3uiv,
+    GLB_STUB_PROC_glSecondaryColorPointer,
+    GLB_STUB_PROC_glSecondaryColorPointerEXT,
+    GLB_STUB_PROC_glSecondaryColorPointerListIBM,
+    GLB_STUB_PROC_glSelectBuffer,
+    GLB_STUB_PROC_glSelectPerfMonitorCountersAMD,
+    GLB_STUB_PROC_glSemaphoreParameterivNV,
+    GLB_STUB_PROC_glSemaphoreParameterui64vEXT,
+    GLB_STUB_PROC_glSeparableFilter2D,
+    GLB_STUB_PROC_glSeparableFilter2DEXT,
+    GLB_STUB_PROC_glSetFenceAPPLE,
+    GLB_STUB_PROC_glSetFenceNV,
+    GLB_STUB_PROC_glSetFragmentShaderConstantATI,
+    GLB_STUB_PROC_glSetInvariantEXT,
+    GLB_STUB_PROC_glSetLocalConstantEXT,
+    GLB_STUB_PROC_glSetMultisamplefvAMD,
+    GLB_STUB_PROC_glShadeModel,
+    GLB_STUB_PROC_glShaderBinary,
+    GLB_STUB_PROC_glShaderOp1EXT,
+    GLB_STUB_PROC_glShaderOp2EXT,
+    GLB_STUB_PROC_glShaderOp3EXT,
+    GLB_STUB_PROC_glShaderSource,
+    GLB_STUB_PROC_glShaderSourceARB,
+    GLB_STUB_PROC_glShaderStorageBlockBinding,
+    GLB_STUB_PROC_glShadingRateImageBarrierNV,
+    GLB_STUB_PROC_glShadingRateImagePaletteNV,
+    GLB_STUB_PROC_glShadingRateSampleOrderCustomNV,
+    GLB_STUB_PROC_glShadingRateSampleOrderNV,
+    GLB_STUB_PROC_glSharpenTexFuncSGIS,
+    GLB_STUB_PROC_glSignalSemaphoreEXT,
+    GLB_STUB_PROC_glSignalSemaphoreui64NVX,
+    GLB_STUB_PROC_glSignalVkFenceNV,
+    GLB_STUB_PROC_glSignalVkSemaphoreNV,
+    GLB_STUB_PROC_glSpecializeShader,
+    GLB_STUB_PROC_glSpecializeShaderARB,
+    GLB_STUB_PROC_glSpriteParameterfSGIX,
+    GLB_STUB_PROC_glSpriteParameterfvSGIX,
+    GLB_STUB_PROC_glSpriteParameteriSGIX,
+    GLB_STUB_PROC_glSpriteParameterivSGIX,
+    GLB_STUB_PROC_glStartInstrumentsSGIX,
+    GLB_STUB_PROC_glStateCaptureNV,
+    GLB_STUB_PROC_glStencilClearTagEXT,
+    GLB_STUB_PROC_glStencilFillPathInstancedNV,
+    GLB_STUB_PROC_glStencilFillPathNV,
+    GLB_STUB_PROC_glStencilFunc,
+    GLB_STUB_PROC_glStencilFuncSeparate,
+    GLB_STUB_PROC_glStencilFuncSeparateATI,
+    GLB_STUB_PROC_glStencilMask,
+    GLB_STUB_PROC_glStencilMaskSeparate,
+    GLB_STUB_PROC_glStencilOp,
+    GLB_STUB_PROC_glStencilOpSeparate,
+    GLB_STUB_PROC_glStencilOpSeparateATI,
+    GLB_STUB_PROC_glStencilOpValueAMD,
+    GLB_STUB_PROC_glStencilStrokePathInstancedNV,
+    GLB_STUB_PROC_glStencilStrokePathNV,
+    GLB_STUB_PROC_glStencilThenCoverFillPathInstancedNV,
+    GLB_STUB_PROC_glStencilThenCoverFillPathNV,
+    GLB_STUB_PROC_glStencilThenCoverStrokePathInstancedNV,
+    GLB_STUB_PROC_glStencilThenCoverStrokePathNV,
+    GLB_STUB_PROC_glStopInstrumentsSGIX,
+    GLB_STUB_PROC_glStringMarkerGREMEDY,
+    GLB_STUB_PROC_glSubpixelPrecisionBiasNV,
+    GLB_STUB_PROC_glSwizzleEXT,
+    GLB_STUB_PROC_glSyncTextureINTEL,
+    GLB_STUB_PROC_glTagSampleBufferSGIX,
+    GLB_STUB_PROC_glTangent3bEXT,
+    GLB_STUB_PROC_glTangent3bvEXT,
+    GLB_STUB_PROC_glTangent3dEXT,
+    GLB_STUB_PROC_glTangent3dvEXT,
+    GLB_STUB_PROC_glTangent3fEXT,
+    GLB_STUB_PROC_glTangent3fvEXT,
+    GLB_STUB_PROC_glTangent3iEXT,
+    GLB_STUB_PROC_glTangent3ivEXT,
+    GLB_STUB_PROC_glTangent3sEXT,
+    GLB_STUB_PROC_glTangent3svEXT,
+    GLB_STUB_PROC_glTangentPointerEXT,
+    GLB_STUB_PROC_glTbufferMask3DFX,
+    GLB_STUB_PROC_glTessellationFactorAMD,
+    GLB_STUB_PROC_glTessellationModeAMD,
+    GLB_STUB_PROC_glTestFenceAPPLE,
+    GLB_STUB_PROC_glTestFenceNV,
+    GLB_STUB_PROC_glTestObjectAPPLE,
+    GLB_STUB_PROC_glTexAttachMemoryNV,
+    GLB_STUB_PROC_glTexBuffer,
+    GLB_STUB_PROC_glTexBufferARB,
+    GLB_STUB_PROC_glTexBufferEXT,
+    GLB_STUB_PROC_glTexBufferRange,
+    GLB_STUB_PROC_glTexBumpParameterfvATI,
+    GLB_STUB_PROC_glTexBumpParameterivATI,
+    GLB_STUB_PROC_glTexCoord1bOES,
+    GLB_STUB_PROC_glTexCoord1bvOES,
+    GLB_STUB_PROC_glTexCoord1d,
+    GLB_STUB_PROC_glTexCoord1dv,
+    GLB_STUB_PROC_glTexCoord1f,
+    GLB_STUB_PROC_glTexCoord1fv,
+    GLB_STUB_PROC_glTexCoord1hNV,
+    GLB_STUB_PROC_glTexCoord1hvNV,
+    GLB_STUB_PROC_glTexCoord1i,
+    GLB_STUB_PROC_glTexCoord1iv,
+    GLB_STUB_PROC_glTexCoord1s,
+    GLB_STUB_PROC_glTexCoord1sv,
+    GLB_STUB_PROC_glTexCoord1xOES,
+    GLB_STUB_PROC_glTexCoord1xvOES,
+    GLB_STUB_PROC_glTexCoord2bOES,
+    GLB_STUB_PROC_glTexCoord2bvOES,
+    GLB_STUB_PROC_glTexCoord2d,
+    GLB_STUB_PROC_glTexCoord2dv,
+    GLB_STUB_PROC_glTexCoord2f,
+    GLB_STUB_PROC_glTexCoord2fColor3fVertex3fSUN,
+    GLB_STUB_PROC_glTexCoord2fColor3fVertex3fvSUN,
+    GLB_STUB_PROC_glTexCoord2fColor4fNormal3fVertex3fSUN,
+    GLB_STUB_PROC_glTexCoord2fColor4fNormal3fVertex3fvSUN,
+    GLB_STUB_PROC_glTexCoord2fColor4ubVertex3fSUN,
+    GLB_STUB_PROC_glTexCoord2fColor4ubVertex3fvSUN,
+    GLB_STUB_PROC_glTexCoord2fNormal3fVertex3fSUN,
+    GLB_STUB_PROC_glTexCoord2fNormal3fVertex3fvSUN,
+    GLB_STUB_PROC_glTexCoord2fVertex3fSUN,
+    GLB_STUB_PROC_glTexCoord2fVertex3fvSUN,
+    GLB_STUB_PROC_glTexCoord2fv,
+    GLB_STUB_PROC_glTexCoord2hNV,
+    GLB_STUB_PROC_glTexCoord2hvNV,
+    GLB_STUB_PROC_glTexCoord2i,
+    GLB_STUB_PROC_glTexCoord2iv,
+    GLB_STUB_PROC_glTexCoord2s,
+    GLB_STUB_PROC_glTexCoord2sv,
+    GLB_STUB_PROC_glTexCoord2xOES,
+    GLB_STUB_PROC_glTexCoord2xvOES,
+    GLB_STUB_PROC_glTexCoord3bOES,
+    GLB_STUB_PROC_glTexCoord3bvOES,
+    GLB_STUB_PROC_glTexCoord3d,
+    GLB_STUB_PROC_glTexCoord3dv,
+    GLB_STUB_PROC_glTexCoord3f,
+    GLB_STUB_PROC_glTexCoord3fv,
+    GLB_STUB_PROC_glTexCoord3hNV,
+    GLB_STUB_PROC_glTexCoord3hvNV,
+    GLB_STUB_PROC_glTexCoord3i,
+    GLB_STUB_PROC_glTexCoord3iv,
+    GLB_STUB_PROC_glTexCoord3s,
+    GLB_STUB_PROC_glTexCoord3sv,
+    GLB_STUB_PROC_glTexCoord3xOES,
+    GLB_STUB_PROC_glTexCoord3xvOES,
+    GLB_STUB_PROC_glTexCoord4bOES,
+    GLB_STUB_PROC_glTexCoord4bvOES,
+    GLB_STUB_PROC_glTexCoord4d,
+    GLB_STUB_PROC_glTexCoord4dv,
+    GLB_STUB_PROC_glTexCoord4f,
+    GLB_STUB_PROC_glTexCoord4fColor4fNormal3fVertex4fSUN,
+    GLB_STUB_PROC_glTexCoord4fColor4fNormal3fVertex4fvSUN,
+    GLB_STUB_PROC_glTexCoord4fVertex4fSUN,
+    GLB_STUB_PROC_glTexCoord4fVertex4fvSUN,
+    GLB_STUB_PROC_glTexCoord4fv,
+    GLB_STUB_PROC_glTexCoord4hNV,
+    GLB_STUB_PROC_glTexCoord4hvNV,
+    GLB_STUB_PROC_glTexCoord4i,
+    GLB_STUB_PROC_glTexCoord4iv,
+    GLB_STUB_PROC_glTexCoord4s,
+    GLB_STUB_PROC_glTexCoord4sv,
+    GLB_STUB_PROC_glTexCoord4xOES,
+    GLB_STUB_PROC_glTexCoord4xvOES,
+    GLB_STUB_PROC_glTexCoordFormatNV,
+    GLB_STUB_PROC_glTexCoordP1ui,
+    GLB_STUB_PROC_glTexCoordP1uiv,
+    GLB_STUB_PROC_glTexCoordP2ui,
+    GLB_STUB_PROC_glTexCoordP2uiv,
+    GLB_STUB_PROC_glTexCoordP3ui,
+    GLB_STUB_PROC_glTexCoordP3uiv,
+    GLB_STUB_PROC_glTexCoordP4ui,
+    GLB_STUB_PROC_glTexCoordP4uiv,
+    GLB_STUB_PROC_glTexCoordPointer,
+    GLB_STUB_PROC_glTexCoordPointerEXT,
+    GLB_STUB_PROC_glTexCoordPointerListIBM,
+    GLB_STUB_PROC_glTexCoordPointervINTEL,
+    GLB_STUB_PROC_glTexEnvf,
+    GLB_STUB_PROC_glTexEnvfv,
+    GLB_STUB_PROC_glTexEnvi,
+    GLB_STUB_PROC_glTexEnviv,
+    GLB_STUB_PROC_glTexEnvxOES,
+    GLB_STUB_PROC_glTexEnvxvOES,
+    GLB_STUB_PROC_glTexFilterFuncSGIS,
+    GLB_STUB_PROC_glTexGend,
+    GLB_STUB_PROC_glTexGendv,
+    GLB_STUB_PROC_glTexGenf,
+    GLB_STUB_PROC_glTexGenfv,
+    GLB_STUB_PROC_glTexGeni,
+    GLB_STUB_PROC_glTexGeniv,
+    GLB_STUB_PROC_glTexGenxOES,
+    GLB_STUB_PROC_glTexGenxvOES,
+    GLB_STUB_PROC_glTexImage1D,
+    GLB_STUB_PROC_glTexImage2D,
+    GLB_STUB_PROC_glTexImage2DMultisample,
+    GLB_STUB_PROC_glTexImage2DMultisampleCoverageNV,
+    GLB_STUB_PROC_glTexImage3D,
+    GLB_STUB_PROC_glTexImage3DEXT,
+    GLB_STUB_PROC_glTexImage3DMultisample,
+    GLB_STUB_PROC_glTexImage3DMultisampleCoverageNV,
+    GLB_STUB_PROC_glTexImage4DSGIS,
+    GLB_STUB_PROC_glTexPageCommitmentARB,
+    GLB_STUB_PROC_glTexPageCommitmentMemNV,
+    GLB_STUB_PROC_glTexParameterIiv,
+    GLB_STUB_PROC_glTexParameterIivEXT,
+    GLB_STUB_PROC_glTexParameterIuiv,
+    GLB_STUB_PROC_glTexParameterIuivEXT,
+    GLB_STUB_PROC_glTexParameterf,
+    GLB_STUB_PROC_glTexParameterfv,
+    GLB_STUB_PROC_glTexParameteri,
+    GLB_STUB_PROC_glTexParameteriv,
+    GLB_STUB_PROC_glTexParameterxOES,
+    GLB_STUB_PROC_glTexParameterxvOES,
+    GLB_STUB_PROC_glTexRenderbufferNV,
+    GLB_STUB_PROC_glTexStorage1D,
+    GLB_STUB_PROC_glTexStorage2D,
+    GLB_STUB_PROC_glTexStorage2DMultisample,
+    GLB_STUB_PROC_glTexStorage3D,
+    GLB_STUB_PROC_glTexStorage3DMultisample,
+    GLB_STUB_PROC_glTexStorageMem1DEXT,
+    GLB_STUB_PROC_glTexStorageMem2DEXT,
+    GLB_STUB_PROC_glTexStorageMem2DMultisampleEXT,
+    GLB_STUB_PROC_glTexStorageMem3DEXT,
+    GLB_STUB_PROC_glTexStorageMem3DMultisampleEXT,
+    GLB_STUB_PROC_glTexStorageSparseAMD,
+    GLB_STUB_PROC_glTexSubImage1D,
+    GLB_STUB_PROC_glTexSubImage1DEXT,
+    GLB_STUB_PROC_glTexSubImage2D,
+    GLB_STUB_PROC_glTexSubImage2DEXT,
+    GLB_STUB_PROC_glTexSubImage3D,
+    GLB_STUB_PROC_glTexSubImage3DEXT,
+    GLB_STUB_PROC_glTexSubImage4DSGIS,
+    GLB_STUB_PROC_glTextureAttachMemoryNV,
+    GLB_STUB_PROC_glTextureBarrier,
+    GLB_STUB_PROC_glTextureBarrierNV,
+    GLB_STUB_PROC_glTextureBuffer,
+    GLB_STUB_PROC_glTextureBufferEXT,
+    GLB_STUB_PROC_glTextureBufferRange,
+    GLB_STUB_PROC_glTextureBufferRangeEXT,
+    GLB_STUB_PROC_glTextureColorMaskSGIS,
+    GLB_STUB_PROC_glTextureImage1DEXT,
+    GLB_STUB_PROC_glTextureImage2DEXT,
+    GLB_STUB_PROC_glTextureImage2DMultisampleCoverageNV,
+    GLB_STUB_PROC_glTextureImage2DMultisampleNV,
+    GLB_STUB_PROC_glTextureImage3DEXT,
+    GLB_STUB_PROC_glTextureImage3DMultisampleCoverageNV,
+    GLB_STUB_PROC_glTextureImage3DMultisampleNV,
+    GLB_STUB_PROC_glTextureLightEXT,
+    GLB_STUB_PROC_glTextureMaterialEXT,
+    GLB_STUB_PROC_glTextureNormalEXT,
+    GLB_STUB_PROC_glTexturePageCommitmentEXT,
+    GLB_STUB_PROC_glTexturePageCommitmentMemNV,
+    GLB_STUB_PROC_glTextureParameterIiv,
+    GLB_STUB_PROC_glTextureParameterIivEXT,
+    GLB_STUB_PROC_glTextureParameterIuiv,
+    GLB_STUB_PROC_glTextureParameterIuivEXT,
+    GLB_STUB_PROC_glTextureParameterf,
+    GLB_STUB_PROC_glTextureParameterfEXT,
+    GLB_STUB_PROC_glTextureParameterfv,
+    GLB_STUB_PROC_glTextureParameterfvEXT,
+    GLB_STUB_PROC_glTextureParameteri,
+    GLB_STUB_PROC_glTextureParameteriEXT,
+    GLB_STUB_PROC_glTextureParameteriv,
+    GLB_STUB_PROC_glTextureParameterivEXT,
+    GLB_STUB_PROC_glTextureRangeAPPLE,
+    GLB_STUB_PROC_glTextureRenderbufferEXT,
+    GLB_STUB_PROC_glTextureStorage1D,
+    GLB_STUB_PROC_glTextureStorage1DEXT,
+    GLB_STUB_PROC_glTextureStorage2D,
+    GLB_STUB_PROC_glTextureStorage2DEXT,
+    GLB_STUB_PROC_glTextureStorage2DMultisample,
+    GLB_STUB_PROC_glTextureStorage2DMultisampleEXT,
+    GLB_STUB_PROC_glTextureStorage3D,
+    GLB_STUB_PROC_glTextureStorage3DEXT,
+    GLB_STUB_PROC_glTextureStorage3DMultisample,
+    GLB_STUB_PROC_glTextureStorage3DMultisampleEXT,
+    GLB_STUB_PROC_glTextureStorageMem1DEXT,
+    GLB_STUB_PROC_glTextureStorageMem2DEXT,
+    GLB_STUB_PROC_glTextureStorageMem2DMultisampleEXT,
+    GLB_STUB_PROC_glTextureStorageMem3DEXT,
+    GLB_STUB_PROC_glTextureStorageMem3DMultisampleEXT,
+    GLB_STUB_PROC_glTextureStorageSparseAMD,
+    GLB_STUB_PROC_glTextureSubImage1D,
+    GLB_STUB_PROC_glTextureSubImage1DEXT,
+    GLB_STUB_PROC_glTextureSubImage2D,
+    GLB_STUB_PROC_glTextureSubImage2DEXT,
+    GLB_STUB_PROC_glTextureSubImage3D,
+    GLB_STUB_PROC_glTextureSubImage3DEXT,
+    GLB_STUB_PROC_glTextureView,
+    GLB_STUB_PROC_glTrackMatrixNV,
+    GLB_STUB_PROC_glTransformFeedbackAttribsNV,
+    GLB_STUB_PROC_glTransformFeedbackBufferBase,
+    GLB_STUB_PROC_glTransformFeedbackBufferRange,
+    GLB_STUB_PROC_glTransformFeedbackStreamAttribsNV,
+    GLB_STUB_PROC_glTransformFeedbackVaryings,
+    GLB_STUB_PROC_glTransformFeedbackVaryingsEXT,
+    GLB_STUB_PROC_glTransformFeedbackVaryingsNV,
+    GLB_STUB_PROC_glTransformPathNV,
+    GLB_STUB_PROC_glTranslated,
+    GLB_STUB_PROC_glTranslatef,
+    GLB_STUB_PROC_glTranslatexOES,
+    GLB_STUB_PROC_glUniform1d,
+    GLB_STUB_PROC_glUniform1dv,
+    GLB_STUB_PROC_glUniform1f,
+    GLB_STUB_PROC_glUniform1fARB,
+    GLB_STUB_PROC_glUniform1fv,
+    GLB_STUB_PROC_glUniform1fvARB,
+    GLB_STUB_PROC_glUniform1i,
+    GLB_STUB_PROC_glUniform1i64ARB,
+    GLB_STUB_PROC_glUniform1i64NV,
+    GLB_STUB_PROC_glUniform1i64vARB,
+    GLB_STUB_PROC_glUniform1i64vNV,
+    GLB_STUB_PROC_glUniform1iARB,
+    GLB_STUB_PROC_glUniform1iv,
+    GLB_STUB_PROC_glUniform1ivARB,
+    GLB_STUB_PROC_glUniform1ui,
+    GLB_STUB_PROC_glUniform1ui64ARB,
+    GLB_STUB_PROC_glUniform1ui64NV,
+    GLB_STUB_PROC_glUniform1ui64vARB,
+    GLB_STUB_PROC_glUniform1ui64vNV,
+    GLB_STUB_PROC_glUniform1uiEXT,
+    GLB_STUB_PROC_glUniform1uiv,
+    GLB_STUB_PROC_glUniform1uivEXT,
+    GLB_STUB_PROC_glUniform2d,
+    GLB_STUB_PROC_glUniform2dv,
+    GLB_STUB_PROC_glUniform2f,
+    GLB_STUB_PROC_glUniform2fARB,
+    GLB_STUB_PROC_glUniform2fv,
+    GLB_STUB_PROC_glUniform2fvARB,
+    GLB_STUB_PROC_glUniform2i,
+    GLB_STUB_PROC_glUniform2i64ARB,
+    GLB_STUB_PROC_glUniform2i64NV,
+    GLB_STUB_PROC_glUniform2i64vARB,
+    GLB_STUB_PROC_glUniform2i64vNV,
+    GLB_STUB_PROC_glUniform2iARB,
+    GLB_STUB_PROC_glUniform2iv,
+    GLB_STUB_PROC_glUniform2ivARB,
+    GLB_STUB_PROC_glUniform2ui,
+    GLB_STUB_PROC_glUniform2ui64ARB,
+    GLB_STUB_PROC_glUniform2ui64NV,
+    GLB_STUB_PROC_glUniform2ui64vARB,
+    GLB_STUB_PROC_glUniform2ui64vNV,
+    GLB_STUB_PROC_glUniform2uiEXT,
+    GLB_STUB_PROC_glUniform2uiv,
+    GLB_STUB_PROC_glUniform2uivEXT,
+    GLB_STUB_PROC_glUniform3d,
+    GLB_STUB_PROC_glUniform3dv,
+    GLB_STUB_PROC_glUniform3f,
+    GLB_STUB_PROC_glUniform3fARB,
+    GLB_STUB_PROC_glUniform3fv,
+    GLB_STUB_PROC_glUniform3fvARB,
+    GLB_STUB_PROC_glUniform3i,
+    GLB_STUB_PROC_glUniform3i64ARB,
+    GLB_STUB_PROC_glUniform3i64NV,
+    GLB_STUB_PROC_glUniform3i64vARB,
+    GLB_STUB_PROC_glUniform3i64vNV,
+    GLB_STUB_PROC_glUniform3iARB,
+    GLB_STUB_PROC_glUniform3iv,
+    GLB_STUB_PROC_glUniform3ivARB,
+    GLB_STUB_PROC_glUniform3ui,
+    GLB_STUB_PROC_glUniform3ui64ARB,
+    GLB_STUB_PROC_glUniform3ui64NV,
+    GLB_STUB_PROC_glUniform3ui64vARB,
+    GLB_STUB_PROC_glUniform3ui64vNV,
+    GLB_STUB_PROC_glUniform3uiEXT,
+    GLB_STUB_PROC_glUniform3uiv,
+    GLB_STUB_PROC_glUniform3uivEXT,
+    GLB_STUB_PROC_glUniform4d,
+    GLB_STUB_PROC_glUniform4dv,
+    GLB_STUB_PROC_glUniform4f,
+    GLB_STUB_PROC_glUniform4fARB,
+    GLB_STUB_PROC_glUniform4fv,
+    GLB_STUB_PROC_glUniform4fvARB,
+    GLB_STUB_PROC_glUniform4i,
+    GLB_STUB_PROC_glUniform4i64ARB,
+    GLB_STUB_PROC_glUniform4i64NV,
+    GLB_STUB_PROC_glUniform4i64vARB,
+    GLB_STUB_PROC_glUniform4i64vNV,
+    GLB_STUB_PROC_glUniform4iARB,
+    GLB_STUB_PROC_glUniform4iv,
+    GLB_STUB_PROC_glUniform4ivARB,
+    GLB_STUB_PROC_glUniform4ui,
+    GLB_STUB_PROC_glUniform4ui64ARB,
+    GLB_STUB_PROC_glUniform4ui64NV,
+    GLB_STUB_PROC_glUniform4ui64vARB,
+    GLB_STUB_PROC_glUniform4ui64vNV,
+    GLB_STUB_PROC_glUniform4uiEXT,
+    GLB_STUB_PROC_glUniform4uiv,
+    GLB_STUB_PROC_glUniform4uivEXT,
+    GLB_STUB_PROC_glUniformBlockBinding,
+    GLB_STUB_PROC_glUniformBufferEXT,
+    GLB_STUB_PROC_glUniformHandleui64ARB,
+    GLB_STUB_PROC_glUniformHandleui64NV,
+    GLB_STUB_PROC_glUniformHandleui64vARB,
+    GLB_STUB_PROC_glUniformHandleui64vNV,
+    GLB_STUB_PROC_glUniformMatrix2dv,
+    GLB_STUB_PROC_glUniformMatrix2fv,
+    GLB_STUB_PROC_glUniformMatrix2fvARB,
+    GLB_STUB_PROC_glUniformMatrix2x3dv,
+    GLB_STUB_PROC_glUniformMatrix2x3fv,
+    GLB_STUB_PROC_glUniformMatrix2x4dv,
+    GLB_STUB_PROC_glUniformMatrix2x4fv,
+    GLB_STUB_PROC_glUniformMatrix3dv,
+    GLB_STUB_PROC_glUniformMatrix3fv,
+    GLB_STUB_PROC_glUniformMatrix3fvARB,
+    GLB_STUB_PROC_glUniformMatrix3x2dv,
+    GLB_STUB_PROC_glUniformMatrix3x2fv,
+    GLB_STUB_PROC_glUniformMatrix3x4dv,
+    GLB_STUB_PROC_glUniformMatrix3x4fv,
+    GLB_STUB_PROC_glUniformMatrix4dv,
+    GLB_STUB_PROC_glUniformMatrix4fv,
+    GLB_STUB_PROC_glUniformMatrix4fvARB,
+    GLB_STUB_PROC_glUniformMatrix4x2dv,
+    GLB_STUB_PROC_glUniformMatrix4x2fv,
+    GLB_STUB_PROC_glUniformMatrix4x3dv,
+    GLB_STUB_PROC_glUniformMatrix4x3fv,
+    GLB_STUB_PROC_glUniformSubroutinesuiv,
+    GLB_STUB_PROC_glUniformui64NV,
+    GLB_STUB_PROC_glUniformui64vNV,
+    GLB_STUB_PROC_glUnlockArraysEXT,
+    GLB_STUB_PROC_glUnmapBuffer,
+    GLB_STUB_PROC_glUnmapBufferARB,
+    GLB_STUB_PROC_glUnmapNamedBuffer,
+    GLB_STUB_PROC_glUnmapNamedBufferEXT,
+    GLB_STUB_PROC_glUnmapObjectBufferATI,
+    GLB_STUB_PROC_glUnmapTexture2DINTEL,
+    GLB_STUB_PROC_glUpdateObjectBufferATI,
+    GLB_STUB_PROC_glUploadGpuMaskNVX,
+    GLB_STUB_PROC_glUseProgram,
+    GLB_STUB_PROC_glUseProgramObjectARB,
+    GLB_STUB_PROC_glUseProgramStages,
+    GLB_STUB_PROC_glUseProgramStagesEXT,
+    GLB_STUB_PROC_glUseShaderProgramEXT,
+    GLB_STUB_PROC_glVDPAUFiniNV,
+    GLB_STUB_PROC_glVDPAUGetSurfaceivNV,
+    GLB_STUB_PROC_glVDPAUInitNV,
+    GLB_STUB_PROC_glVDPAUIsSurfaceNV,
+    GLB_STUB_PROC_glVDPAUMapSurfacesNV,
+    GLB_STUB_PROC_glVDPAURegisterOutputSurfaceNV,
+    GLB_STUB_PROC_glVDPAURegisterVideoSurfaceNV,
+    GLB_STUB_PROC_glVDPAURegisterVideoSurfaceWithPictureStructureNV,
+    GLB_STUB_PROC_glVDPAUSurfaceAccessNV,
+    GLB_STUB_PROC_glVDPAUUnmapSurfacesNV,
+    GLB_STUB_PROC_glVDPAUUnregisterSurfaceNV,
+    GLB_STUB_PROC_glValidateProgram,
+    GLB_STUB_PROC_glValidateProgramARB,
+    GLB_STUB_PROC_glValidateProgramPipeline,
+    GLB_STUB_PROC_glValidateProgramPipelineEXT,
+    GLB_STUB_PROC_glVariantArrayObjectATI,
+    GLB_STUB_PROC_glVariantPointerEXT,
+    GLB_STUB_PROC_glVariantbvEXT,
+    GLB_STUB_PROC_glVariantdvEXT,
+    GLB_STUB_PROC_glVariantfvEXT,
+    GLB_STUB_PROC_glVariantivEXT,
+    GLB_STUB_PROC_glVariantsvEXT,
+    GLB_STUB_PROC_glVariantubvEXT,
+    GLB_STUB_PROC_glVariantuivEXT,
+    GLB_STUB_PROC_glVariantusvEXT,
+    GLB_STUB_PROC_glVertex2bOES,
+    GLB_STUB_PROC_glVertex2bvOES,
+    GLB_STUB_PROC_glVertex2d,
+    GLB_STUB_PROC_glVertex2dv,
+    GLB_STUB_PROC_glVertex2f,
+    GLB_STUB_PROC_glVertex2fv,
+    GLB_STUB_PROC_glVertex2hNV,
+    GLB_STUB_PROC_glVertex2hvNV,
+    GLB_STUB_PROC_glVertex2i,
+    GLB_STUB_PROC_glVertex2iv,
+    GLB_STUB_PROC_glVertex2s,
+    GLB_STUB_PROC_glVertex2sv,
+    GLB_STUB_PROC_glVertex2xOES,
+    GLB_STUB_PROC_glVertex2xvOES,
+    GLB_STUB_PROC_glVertex3bOES,
+    GLB_STUB_PROC_glVertex3bvOES,
+    GLB_STUB_PROC_glVertex3d,
+    GLB_STUB_PROC_glVertex3dv,
+    GLB_STUB_PROC_glVertex3f,
+    GLB_STUB_PROC_glVertex3fv,
+    GLB_STUB_PROC_glVertex3hNV,
+    GLB_STUB_PROC_glVertex3hvNV,
+    GLB_STUB_PROC_glVertex3i,
+    GLB_STUB_PROC_glVertex3iv,
+    GLB_STUB_PROC_glVertex3s,
+    GLB_STUB_PROC_glVertex3sv,
+    GLB_STUB_PROC_glVertex3xOES,
+    GLB_STUB_PROC_glVertex3xvOES,
+    GLB_STUB_PROC_glVertex4bOES,
+    GLB_STUB_PROC_glVertex4bvOES,
+    GLB_STUB_PROC_glVertex4d,
+    GLB_STUB_PROC_glVertex4dv,
+    GLB_STUB_PROC_glVertex4f,
+    GLB_STUB_PROC_glVertex4fv,
+    GLB_STUB_PROC_glVertex4hNV,
+    GLB_STUB_PROC_glVertex4hvNV,
+    GLB_STUB_PROC_glVertex4i,
+    GLB_STUB_PROC_glVertex4iv,
+    GLB_STUB_PROC_glVertex4s,
+    GLB_STUB_PROC_glVertex4sv,
+    GLB_STUB_PROC_glVertex4xOES,
+    GLB_STUB_PROC_glVertex4xvOES,
+    GLB_STUB_PROC_glVertexArrayAttribBinding,
+    GLB_STUB_PROC_glVertexArrayAttribFormat,
+    GLB_STUB_PROC_glVertexArrayAttribIFormat,
+    GLB_STUB_PROC_glVertexArrayAttribLFormat,
+    GLB_STUB_PROC_glVertexArrayBindVertexBufferEXT,
+    GLB_STUB_PROC_glVertexArrayBindingDivisor,
+    GLB_STUB_PROC_glVertexArrayColorOffsetEXT,
+    GLB_STUB_PROC_glVertexArrayEdgeFlagOffsetEXT,
+    GLB_STUB_PROC_glVertexArrayElementBuffer,
+    GLB_STUB_PROC_glVertexArrayFogCoordOffsetEXT,
+    GLB_STUB_PROC_glVertexArrayIndexOffsetEXT,
+    GLB_STUB_PROC_glVertexArrayMultiTexCoordOffsetEXT,
+    GLB_STUB_PROC_glVertexArrayNormalOffsetEXT,
+    GLB_STUB_PROC_glVertexArrayParameteriAPPLE,
+    GLB_STUB_PROC_glVertexArrayRangeAPPLE,
+    GLB_STUB_PROC_glVertexArrayRangeNV,
+    GLB_STUB_PROC_glVertexArraySecondaryColorOffsetEXT,
+    GLB_STUB_PROC_glVertexArrayTexCoordOffsetEXT,
+    GLB_STUB_PROC_glVertexArrayVertexAttribBindingEXT,
+    GLB_STUB_PROC_glVertexArrayVertexAttribDivisorEXT,
+    GLB_STUB_PROC_glVertexArrayVertexAttribFormatEXT,
+    GLB_STUB_PROC_glVertexArrayVertexAttribIFormatEXT,
+    GLB_STUB_PROC_glVertexArrayVertexAttribIOffsetEXT,
+    GLB_STUB_PROC_glVertexArrayVertexAttribLFormatEXT,
+    GLB_STUB_PROC_glVertexArrayVertexAttribLOffsetEXT,
+    GLB_STUB_PROC_glVertexArrayVertexAttribOffsetEXT,
+    GLB_STUB_PROC_glVertexArrayVertexBindingDivisorEXT,
+    GLB_STUB_PROC_glVertexArrayVertexBuffer,
+    GLB_STUB_PROC_glVertexArrayVertexBuffers,
+    GLB_STUB_PROC_glVertexArrayVertexOffsetEXT,
+    GLB_STUB_PROC_glVertexAttrib1d,
+    GLB_STUB_PROC_glVertexAttrib1dARB,
+    GLB_STUB_PROC_glVertexAttrib1dNV,
+    GLB_STUB_PROC_glVertexAttrib1dv,
+    GLB_STUB_PROC_glVertexAttrib1dvARB,
+    GLB_STUB_PROC_glVertexAttrib1dvNV,
+    GLB_STUB_PROC_glVertexAttrib1f,
+    GLB_STUB_PROC_glVertexAttrib1fARB,
+    GLB_STUB_PROC_glVertexAttrib1fNV,
+    GLB_STUB_PROC_glVertexAttrib1fv,
+    GLB_STUB_PROC_glVertexAttrib1fvARB,
+    GLB_STUB_PROC_glVertexAttrib1fvNV,
+    GLB_STUB_PROC_glVertexAttrib1hNV,
+    GLB_STUB_PROC_glVertexAttrib1hvNV,
+    GLB_STUB_PROC_glVertexAttrib1s,
+    GLB_STUB_PROC_glVertexAttrib1sARB,
+    GLB_STUB_PROC_glVertexAttrib1sNV,
+    GLB_STUB_PROC_glVertexAttrib1sv,
+    GLB_STUB_PROC_glVertexAttrib1svARB,
+    GLB_STUB_PROC_glVertexAttrib1svNV,
+    GLB_STUB_PROC_glVertexAttrib2d,
+    GLB_STUB_PROC_glVertexAttrib2dARB,
+    GLB_STUB_PROC_glVertexAttrib2dNV,
+    GLB_STUB_PROC_glVertexAttrib2dv,
+    GLB_STUB_PROC_glVertexAttrib2dvARB,
+    GLB_STUB_PROC_glVertexAttrib2dvNV,
+    GLB_STUB_PROC_glVertexAttrib2f,
+    GLB_STUB_PROC_glVertexAttrib2fARB,
+    GLB_STUB_PROC_glVertexAttrib2fNV,
+    GLB_STUB_PROC_glVertexAttrib2fv,
+    GLB_STUB_PROC_glVertexAttrib2fvARB,
+    GLB_STUB_PROC_glVertexAttrib2fvNV,
+    GLB_STUB_PROC_glVertexAttrib2hNV,
+    GLB_STUB_PROC_glVertexAttrib2hvNV,
+    GLB_STUB_PROC_glVertexAttrib2s,
+    GLB_STUB_PROC_glVertexAttrib2sARB,
+    GLB_STUB_PROC_glVertexAttrib2sNV,
+    GLB_STUB_PROC_glVertexAttrib2sv,
+    GLB_STUB_PROC_glVertexAttrib2svARB,
+    GLB_STUB_PROC_glVertexAttrib2svNV,
+    GLB_STUB_PROC_glVertexAttrib3d,
+    GLB_STUB_PROC_glVertexAttrib3dARB,
+    GLB_STUB_PROC_glVertexAttrib3dNV,
+    GLB_STUB_PROC_glVertexAttrib3dv,
+    GLB_STUB_PROC_glVertexAttrib3dvARB,
+    GLB_STUB_PROC_glVertexAttrib3dvNV,
+    GLB_STUB_PROC_glVertexAttrib3f,
+    GLB_STUB_PROC_glVertexAttrib3fARB,
+    GLB_STUB_PROC_glVertexAttrib3fNV,
+    GLB_STUB_PROC_glVertexAttrib3fv,
+    GLB_STUB_PROC_glVertexAttrib3fvARB,
+    GLB_STUB_PROC_glVertexAttrib3fvNV,
+    GLB_STUB_PROC_glVertexAttrib3hNV,
+    GLB_STUB_PROC_glVertexAttrib3hvNV,
+    GLB_STUB_PROC_glVertexAttrib3s,
+    GLB_STUB_PROC_glVertexAttrib3sARB,
+    GLB_STUB_PROC_glVertexAttrib3sNV,
+    GLB_STUB_PROC_glVertexAttrib3sv,
+    GLB_STUB_PROC_glVertexAttrib3svARB,
+    GLB_STUB_PROC_glVertexAttrib3svNV,
+    GLB_STUB_PROC_glVertexAttrib4Nbv,
+    GLB_STUB_PROC_glVertexAttrib4NbvARB,
+    GLB_STUB_PROC_glVertexAttrib4Niv,
+    GLB_STUB_PROC_glVertexAttrib4NivARB,
+    GLB_STUB_PROC_glVertexAttrib4Nsv,
+    GLB_STUB_PROC_glVertexAttrib4NsvARB,
+    GLB_STUB_PROC_glVertexAttrib4Nub,
+    GLB_STUB_PROC_glVertexAttrib4NubARB,
+    GLB_STUB_PROC_glVertexAttrib4Nubv,
+    GLB_STUB_PROC_glVertexAttrib4NubvARB,
+    GLB_STUB_PROC_glVertexAttrib4Nuiv,
+    GLB_STUB_PROC_glVertexAttrib4NuivARB,
+    GLB_STUB_PROC_glVertexAttrib4Nusv,
+    GLB_STUB_PROC_glVertexAttrib4NusvARB,
+    GLB_STUB_PROC_glVertexAttrib4bv,
+    GLB_STUB_PROC_glVertexAttrib4bvARB,
+    GLB_STUB_PROC_glVertexAttrib4d,
+    GLB_STUB_PROC_glVertexAttrib4dARB,
+    GLB_STUB_PROC_glVertexAttrib4dNV,
+    GLB_STUB_PROC_glVertexAttrib4dv,
+    GLB_STUB_PROC_glVertexAttrib4dvARB,
+    GLB_STUB_PROC_glVertexAttrib4dvNV,
+    GLB_STUB_PROC_glVertexAttrib4f,
+    GLB_STUB_PROC_glVertexAttrib4fARB,
+    GLB_STUB_PROC_glVertexAttrib4fNV,
+    GLB_STUB_PROC_glVertexAttrib4fv,
+    GLB_STUB_PROC_glVertexAttrib4fvARB,
+    GLB_STUB_PROC_glVertexAttrib4fvNV,
+    GLB_STUB_PROC_glVertexAttrib4hNV,
+    GLB_STUB_PROC_glVertexAttrib4hvNV,
+    GLB_STUB_PROC_glVertexAttrib4iv,
+    GLB_STUB_PROC_glVertexAttrib4ivARB,
+    GLB_STUB_PROC_glVertexAttrib4s,
+    GLB_STUB_PROC_glVertexAttrib4sARB,
+    GLB_STUB_PROC_glVertexAttrib4sNV,
+    GLB_STUB_PROC_glVertexAttrib4sv,
+    GLB_STUB_PROC_glVertexAttrib4svARB,
+    GLB_STUB_PROC_glVertexAttrib4svNV,
+    GLB_STUB_PROC_glVertexAttrib4ubNV,
+    GLB_STUB_PROC_glVertexAttrib4ubv,
+    GLB_STUB_PROC_glVertexAttrib4ubvARB,
+    GLB_STUB_PROC_glVertexAttrib4ubvNV,
+    GLB_STUB_PROC_glVertexAttrib4uiv,
+    GLB_STUB_PROC_glVertexAttrib4uivARB,
+    GLB_STUB_PROC_glVertexAttrib4usv,
+    GLB_STUB_PROC_glVertexAttrib4usvARB,
+    GLB_STUB_PROC_glVertexAttribArrayObjectATI,
+    GLB_STUB_PROC_glVertexAttribBinding,
+    GLB_STUB_PROC_glVertexAttribDivisor,
+    GLB_STUB_PROC_glVertexAttribDivisorARB,
+    GLB_STUB_PROC_glVertexAttribFormat,
+    GLB_STUB_PROC_glVertexAttribFormatNV,
+    GLB_STUB_PROC_glVertexAttribI1i,
+    GLB_STUB_PROC_glVertexAttribI1iEXT,
+    GLB_STUB_PROC_glVertexAttribI1iv,
+    GLB_STUB_PROC_glVertexAttribI1ivEXT,
+    GLB_STUB_PROC_glVertexAttribI1ui,
+    GLB_STUB_PROC_glVertexAttribI1uiEXT,
+    GLB_STUB_PROC_glVertexAttribI1uiv,
+    GLB_STUB_PROC_glVertexAttribI1uivEXT,
+    GLB_STUB_PROC_glVertexAttribI2i,
+    GLB_STUB_PROC_glVertexAttribI2iEXT,
+    GLB_STUB_PROC_glVertexAttribI2iv,
+    GLB_STUB_PROC_glVertexAttribI2ivEXT,
+    GLB_STUB_PROC_glVertexAttribI2ui,
+    GLB_STUB_PROC_glVertexAttribI2uiEXT,
+    GLB_STUB_PROC_glVertexAttribI2uiv,
+    GLB_STUB_PROC_glVertexAttribI2uivEXT,
+    GLB_STUB_PROC_glVertexAttribI3i,
+    GLB_STUB_PROC_glVertexAttribI3iEXT,
+    GLB_STUB_PROC_glVertexAttribI3iv,
+    GLB_STUB_PROC_glVertexAttribI3ivEXT,
+    GLB_STUB_PROC_glVertexAttribI3ui,
+    GLB_STUB_PROC_glVertexAttribI3uiEXT,
+    GLB_STUB_PROC_glVertexAttribI3uiv,
+    GLB_STUB_PROC_glVertexAttribI3uivEXT,
+    GLB_STUB_PROC_glVertexAttribI4bv,
+    GLB_STUB_PROC_glVertexAttribI4bvEXT,
+    GLB_STUB_PROC_glVertexAttribI4i,
+    GLB_STUB_PROC_glVertexAttribI4iEXT,
+    GLB_STUB_PROC_glVertexAttribI4iv,
+    GLB_STUB_PROC_glVertexAttribI4ivEXT,
+    GLB_STUB_PROC_glVertexAttribI4sv,
+    GLB_STUB_PROC_glVertexAttribI4svEXT,
+    GLB_STUB_PROC_glVertexAttribI4ubv,
+    GLB_STUB_PROC_glVertexAttribI4ubvEXT,
+    GLB_STUB_PROC_glVertexAttribI4ui,
+    GLB_STUB_PROC_glVertexAttribI4uiEXT,
+    GLB_STUB_PROC_glVertexAttribI4uiv,
+    GLB_STUB_PROC_glVertexAttribI4uivEXT,
+    GLB_STUB_PROC_glVertexAttribI4usv,
+    GLB_STUB_PROC_glVertexAttribI4usvEXT,
+    GLB_STUB_PROC_glVertexAttribIFormat,
+    GLB_STUB_PROC_glVertexAttribIFormatNV,
+    GLB_STUB_PROC_glVertexAttribIPointer,
+    GLB_STUB_PROC_glVertexAttribIPointerEXT,
+    GLB_STUB_PROC_glVertexAttribL1d,
+    GLB_STUB_PROC_glVertexAttribL1dEXT,
+    GLB_STUB_PROC_glVertexAttribL1dv,
+    GLB_STUB_PROC_glVertexAttribL1dvEXT,
+    GLB_STUB_PROC_glVertexAttribL1i64NV,
+    GLB_STUB_PROC_glVertexAttribL1i64vNV,
+    GLB_STUB_PROC_glVertexAttribL1ui64ARB,
+    GLB_STUB_PROC_glVertexAttribL1ui64NV,
+    GLB_STUB_PROC_glVertexAttribL1ui64vARB,
+    GLB_STUB_PROC_glVertexAttribL1ui64vNV,
+    GLB_STUB_PROC_glVertexAttribL2d,
+    GLB_STUB_PROC_glVertexAttribL2dEXT,
+    GLB_STUB_PROC_glVertexAttribL2dv,
+    GLB_STUB_PROC_glVertexAttribL2dvEXT,
+    GLB_STUB_PROC_glVertexAttribL2i64NV,
+    GLB_STUB_PROC_glVertexAttribL2i64vNV,
+    GLB_STUB_PROC_glVertexAttribL2ui64NV,
+    GLB_STUB_PROC_glVertexAttribL2ui64vNV,
+    GLB_STUB_PROC_glVertexAttribL3d,
+    GLB_STUB_PROC_glVertexAttribL3dEXT,
+    GLB_STUB_PROC_glVertexAttribL3dv,
+    GLB_STUB_PROC_glVertexAttribL3dvEXT,
+    GLB_STUB_PROC_glVertexAttribL3i64NV,
+    GLB_STUB_PROC_glVertexAttribL3i64vNV,
+    GLB_STUB_PROC_glVertexAttribL3ui64NV,
+    GLB_STUB_PROC_glVertexAttribL3ui64vNV,
+    GLB_STUB_PROC_glVertexAttribL4d,
+    GLB_STUB_PROC_glVertexAttribL4dEXT,
+    GLB_STUB_PROC_glVertexAttribL4dv,
+    GLB_STUB_PROC_glVertexAttribL4dvEXT,
+    GLB_STUB_PROC_glVertexAttribL4i64NV,
+    GLB_STUB_PROC_glVertexAttribL4i64vNV,
+    GLB_STUB_PROC_glVertexAttribL4ui64NV,
+    GLB_STUB_PROC_glVertexAttribL4ui64vNV,
+    GLB_STUB_PROC_glVertexAttribLFormat,
+    GLB_STUB_PROC_glVertexAttribLFormatNV,
+    GLB_STUB_PROC_glVertexAttribLPointer,
+    GLB_STUB_PROC_glVertexAttribLPointerEXT,
+    GLB_STUB_PROC_glVertexAttribP1ui,
+    GLB_STUB_PROC_glVertexAttribP1uiv,
+    GLB_STUB_PROC_glVertexAttribP2ui,
+    GLB_STUB_PROC_glVertexAttribP2uiv,
+    GLB_STUB_PROC_glVertexAttribP3ui,
+    GLB_STUB_PROC_glVertexAttribP3uiv,
+    GLB_STUB_PROC_glVertexAttribP4ui,
+    GLB_STUB_PROC_glVertexAttribP4uiv,
+    GLB_STUB_PROC_glVertexAttribParameteriAMD,
+    GLB_STUB_PROC_glVertexAttribPointer,
+    GLB_STUB_PROC_glVertexAttribPointerARB,
+    GLB_STUB_PROC_glVertexAttribPointerNV,
+    GLB_STUB_PROC_glVertexAttribs1dvNV,
+    GLB_STUB_PROC_glVertexAttribs1fvNV,
+    GLB_STUB_PROC_glVertexAttribs1hvNV,
+    GLB_STUB_PROC_glVertexAttribs1svNV,
+    GLB_STUB_PROC_glVertexAttribs2dvNV,
+    GLB_STUB_PROC_glVertexAttribs2fvNV,
+    GLB_STUB_PROC_glVertexAttribs2hvNV,
+    GLB_STUB_PROC_glVertexAttribs2svNV,
+    GLB_STUB_PROC_glVertexAttribs3dvNV,
+    GLB_STUB_PROC_glVertexAttribs3fvNV,
+    GLB_STUB_PROC_glVertexAttribs3hvNV,
+    GLB_STUB_PROC_glVertexAttribs3svNV,
+    GLB_STUB_PROC_glVertexAttribs4dvNV,
+    GLB_STUB_PROC_glVertexAttribs4fvNV,
+    GLB_STUB_PROC_glVertexAttribs4hvNV,
+    GLB_STUB_PROC_glVertexAttribs4svNV,
+    GLB_STUB_PROC_glVertexAttribs4ubvNV,
+    GLB_STUB_PROC_glVertexBindingDivisor,
+    GLB_STUB_PROC_glVertexBlendARB,
+    GLB_STUB_PROC_glVertexBlendEnvfATI,
+    GLB_STUB_PROC_glVertexBlendEnviATI,
+    GLB_STUB_PROC_glVertexFormatNV,
+    GLB_STUB_PROC_glVertexP2ui,
+    GLB_STUB_PROC_glVertexP2uiv,
+    GLB_STUB_PROC_glVertexP3ui,
+    GLB_STUB_PROC_glVertexP3uiv,
+    GLB_STUB_PROC_glVertexP4ui,
+    GLB_STUB_PROC_glVertexP4uiv,
+    GLB_STUB_PROC_glVertexPointer,
+    GLB_STUB_PROC_glVertexPointerEXT,
+    GLB_STUB_PROC_glVertexPointerListIBM,
+    GLB_STUB_PROC_glVertexPointervINTEL,
+    GLB_STUB_PROC_glVertexStream1dATI,
+    GLB_STUB_PROC_glVertexStream1dvATI,
+    GLB_STUB_PROC_glVertexStream1fATI,
+    GLB_STUB_PROC_glVertexStream1fvATI,
+    GLB_STUB_PROC_glVertexStream1iATI,
+    GLB_STUB_PROC_glVertexStream1ivATI,
+    GLB_STUB_PROC_glVertexStream1sATI,
+    GLB_STUB_PROC_glVertexStream1svATI,
+    GLB_STUB_PROC_glVertexStream2dATI,
+    GLB_STUB_PROC_glVertexStream2dvATI,
+    GLB_STUB_PROC_glVertexStream2fATI,
+    GLB_STUB_PROC_glVertexStream2fvATI,
+    GLB_STUB_PROC_glVertexStream2iATI,
+    GLB_STUB_PROC_glVertexStream2ivATI,
+    GLB_STUB_PROC_glVertexStream2sATI,
+    GLB_STUB_PROC_glVertexStream2svATI,
+    GLB_STUB_PROC_glVertexStream3dATI,
+    GLB_STUB_PROC_glVertexStream3dvATI,
+    GLB_STUB_PROC_glVertexStream3fATI,
+    GLB_STUB_PROC_glVertexStream3fvATI,
+    GLB_STUB_PROC_glVertexStream3iATI,
+    GLB_STUB_PROC_glVertexStream3ivATI,
+    GLB_STUB_PROC_glVertexStream3sATI,
+    GLB_STUB_PROC_glVertexStream3svATI,
+    GLB_STUB_PROC_glVertexStream4dATI,
+    GLB_STUB_PROC_glVertexStream4dvATI,
+    GLB_STUB_PROC_glVertexStream4fATI,
+    GLB_STUB_PROC_glVertexStream4fvATI,
+    GLB_STUB_PROC_glVertexStream4iATI,
+    GLB_STUB_PROC_glVertexStream4ivATI,
+    GLB_STUB_PROC_glVertexStream4sATI,
+    GLB_STUB_PROC_glVertexStream4svATI,
+    GLB_STUB_PROC_glVertexWeightPointerEXT,
+    GLB_STUB_PROC_glVertexWeightfEXT,
+    GLB_STUB_PROC_glVertexWeightfvEXT,
+    GLB_STUB_PROC_glVertexWeighthNV,
+    GLB_STUB_PROC_glVertexWeighthvNV,
+    GLB_STUB_PROC_glVideoCaptureNV,
+    GLB_STUB_PROC_glVideoCaptureStreamParameterdvNV,
+    GLB_STUB_PROC_glVideoCaptureStreamParameterfvNV,
+    GLB_STUB_PROC_glVideoCaptureStreamParameterivNV,
+    GLB_STUB_PROC_glViewport,
+    GLB_STUB_PROC_glViewportArrayv,
+    GLB_STUB_PROC_glViewportIndexedf,
+    GLB_STUB_PROC_glViewportIndexedfv,
+    GLB_STUB_PROC_glViewportPositionWScaleNV,
+    GLB_STUB_PROC_glViewportSwizzleNV,
+    GLB_STUB_PROC_glWaitSemaphoreEXT,
+    GLB_STUB_PROC_glWaitSemaphoreui64NVX,
+    GLB_STUB_PROC_glWaitSync,
+    GLB_STUB_PROC_glWaitVkSemaphoreNV,
+    GLB_STUB_PROC_glWeightPathsNV,
+    GLB_STUB_PROC_glWeightPointerARB,
+    GLB_STUB_PROC_glWeightbvARB,
+    GLB_STUB_PROC_glWeightdvARB,
+    GLB_STUB_PROC_glWeightfvARB,
+    GLB_STUB_PROC_glWeightivARB,
+    GLB_STUB_PROC_glWeightsvARB,
+    GLB_STUB_PROC_glWeightubvARB,
+    GLB_STUB_PROC_glWeightuivARB,
+    GLB_STUB_PROC_glWeightusvARB,
+    GLB_STUB_PROC_glWindowPos2d,
+    GLB_STUB_PROC_glWindowPos2dARB,
+    GLB_STUB_PROC_glWindowPos2dMESA,
+    GLB_STUB_PROC_glWindowPos2dv,
+    GLB_STUB_PROC_glWindowPos2dvARB,
+    GLB_STUB_PROC_glWindowPos2dvMESA,
+    GLB_STUB_PROC_glWindowPos2f,
+    GLB_STUB_PROC_glWindowPos2fARB,
+    GLB_STUB_PROC_glWindowPos2fMESA,
+    GLB_STUB_PROC_glWindowPos2fv,
+    GLB_STUB_PROC_glWindowPos2fvARB,
+    GLB_STUB_PROC_glWindowPos2fvMESA,
+    GLB_STUB_PROC_glWindowPos2i,
+    GLB_STUB_PROC_glWindowPos2iARB,
+    GLB_STUB_PROC_glWindowPos2iMESA,
+    GLB_STUB_PROC_glWindowPos2iv,
+    GLB_STUB_PROC_glWindowPos2ivARB,
+    GLB_STUB_PROC_glWindowPos2ivMESA,
+    GLB_STUB_PROC_glWindowPos2s,
+    GLB_STUB_PROC_glWindowPos2sARB,
+    GLB_STUB_PROC_glWindowPos2sMESA,
+    GLB_STUB_PROC_glWindowPos2sv,
+    GLB_STUB_PROC_glWindowPos2svARB,
+    GLB_STUB_PROC_glWindowPos2svMESA,
+    GLB_STUB_PROC_glWindowPos3d,
+    GLB_STUB_PROC_glWindowPos3dARB,
+    GLB_STUB_PROC_glWindowPos3dMESA,
+    GLB_STUB_PROC_glWindowPos3dv,
+    GLB_STUB_PROC_glWindowPos3dvARB,
+    GLB_STUB_PROC_glWindowPos3dvMESA,
+    GLB_STUB_PROC_glWindowPos3f,
+    GLB_STUB_PROC_glWindowPos3fARB,
+    GLB_STUB_PROC_glWindowPos3fMESA,
+    GLB_STUB_PROC_glWindowPos3fv,
+    GLB_STUB_PROC_glWindowPos3fvARB,
+    GLB_STUB_PROC_glWindowPos3fvMESA,
+    GLB_STUB_PROC_glWindowPos3i,
+    GLB_STUB_PROC_glWindowPos3iARB,
+    GLB_STUB_PROC_glWindowPos3iMESA,
+    GLB_STUB_PROC_glWindowPos3iv,
+    GLB_STUB_PROC_glWindowPos3ivARB,
+    GLB_STUB_PROC_glWindowPos3ivMESA,
+    GLB_STUB_PROC_glWindowPos3s,
+    GLB_STUB_PROC_glWindowPos3sARB,
+    GLB_STUB_PROC_glWindowPos3sMESA,
+    GLB_STUB_PROC_glWindowPos3sv,
+    GLB_STUB_PROC_glWindowPos3svARB,
+    GLB_STUB_PROC_glWindowPos3svMESA,
+    GLB_STUB_PROC_glWindowPos4dMESA,
+    GLB_STUB_PROC_glWindowPos4dvMESA,
+    GLB_STUB_PROC_glWindowPos4fMESA,
+    GLB_STUB_PROC_glWindowPos4fvMESA,
+    GLB_STUB_PROC_glWindowPos4iMESA,
+    GLB_STUB_PROC_glWindowPos4ivMESA,
+    GLB_STUB_PROC_glWindowPos4sMESA,
+    GLB_STUB_PROC_glWindowPos4svMESA,
+    GLB_STUB_PROC_glWindowRectanglesEXT,
+    GLB_STUB_PROC_glWriteMaskEXT,
+    GLB_STUB_PROC_glXBindChannelToWindowSGIX,
+    GLB_STUB_PROC_glXBindHyperpipeSGIX,
+    GLB_STUB_PROC_glXBindSwapBarrierNV,
+    GLB_STUB_PROC_glXBindSwapBarrierSGIX,
+    GLB_STUB_PROC_glXBindTexImageEXT,
+    GLB_STUB_PROC_glXBindVideoCaptureDeviceNV,
+    GLB_STUB_PROC_glXBindVideoDeviceNV,
+    GLB_STUB_PROC_glXBindVideoImageNV,
+    GLB_STUB_PROC_glXBlitContextFramebufferAMD,
+    GLB_STUB_PROC_glXChannelRectSGIX,
+    GLB_STUB_PROC_glXChannelRectSyncSGIX,
+    GLB_STUB_PROC_glXChooseFBConfig,
+    GLB_STUB_PROC_glXChooseFBConfigSGIX,
+    GLB_STUB_PROC_glXChooseVisual,
+    GLB_STUB_PROC_glXCopyBufferSubDataNV,
+    GLB_STUB_PROC_glXCopyContext,
+    GLB_STUB_PROC_glXCopyImageSubDataNV,
+    GLB_STUB_PROC_glXCopySubBufferMESA,
+    GLB_STUB_PROC_glXCreateAssociatedContextAMD,
+    GLB_STUB_PROC_glXCreateAssociatedContextAttribsAMD,
+    GLB_STUB_PROC_glXCreateContext,
+    GLB_STUB_PROC_glXCreateContextAttribsARB,
+    GLB_STUB_PROC_glXCreateContextWithConfigSGIX,
+    GLB_STUB_PROC_glXCreateGLXPbufferSGIX,
+    GLB_STUB_PROC_glXCreateGLXPixmap,
+    GLB_STUB_PROC_glXCreateGLXPixmapMESA,
+    GLB_STUB_PROC_glXCreateGLXPixmapWithConfigSGIX,
+    GLB_STUB_PROC_glXCreateNewContext,
+    GLB_STUB_PROC_glXCreatePbuffer,
+    GLB_STUB_PROC_glXCreatePixmap,
+    GLB_STUB_PROC_glXCreateWindow,
+    GLB_STUB_PROC_glXCushionSGI,
+    GLB_STUB_PROC_glXDelayBeforeSwapNV,
+    GLB_STUB_PROC_glXDeleteAssociatedContextAMD,
+    GLB_STUB_PROC_glXDestroyContext,
+    GLB_STUB_PROC_glXDestroyGLXPbufferSGIX,
+    GLB_STUB_PROC_glXDestroyGLXPixmap,
+    GLB_STUB_PROC_glXDestroyHyperpipeConfigSGIX,
+    GLB_STUB_PROC_glXDestroyPbuffer,
+    GLB_STUB_PROC_glXDestroyPixmap,
+    GLB_STUB_PROC_glXDestroyWindow,
+    GLB_STUB_PROC_glXEnumerateVideoCaptureDevicesNV,
+    GLB_STUB_PROC_glXEnumerateVideoDevicesNV,
+    GLB_STUB_PROC_glXFreeContextEXT,
+    GLB_STUB_PROC_glXGetAGPOffsetMESA,
+    GLB_STUB_PROC_glXGetClientString,
+    GLB_STUB_PROC_glXGetConfig,
+    GLB_STUB_PROC_glXGetContextGPUIDAMD,
+    GLB_STUB_PROC_glXGetContextIDEXT,
+    GLB_STUB_PROC_glXGetCurrentAssociatedContextAMD,
+    GLB_STUB_PROC_glXGetCurrentContext,
+    GLB_STUB_PROC_glXGetCurrentDisplay,
+    GLB_STUB_PROC_glXGetCurrentDisplayEXT,
+    GLB_STUB_PROC_glXGetCurrentDrawable,
+    GLB_STUB_PROC_glXGetCurrentReadDrawable,
+    GLB_STUB_PROC_glXGetCurrentReadDrawableSGI,
+    GLB_STUB_PROC_glXGetFBConfigAttrib,
+    GLB_STUB_PROC_glXGetFBConfigAttribSGIX,
+    GLB_STUB_PROC_glXGetFBConfigFromVisualSGIX,
+    GLB_STUB_PROC_glXGetFBConfigs,
+    GLB_STUB_PROC_glXGetGPUIDsAMD,
+    GLB_STUB_PROC_glXGetGPUInfoAMD,
+    GLB_STUB_PROC_glXGetMscRateOML,
+    GLB_STUB_PROC_glXGetProcAddress,
+    GLB_STUB_PROC_glXGetProcAddressARB,
+    GLB_STUB_PROC_glXGetSelectedEvent,
+    GLB_STUB_PROC_glXGetSelectedEventSGIX,
+    GLB_STUB_PROC_glXGetSwapIntervalMESA,
+    GLB_STUB_PROC_glXGetSyncValuesOML,
+    GLB_STUB_PROC_glXGetTransparentIndexSUN,
+    GLB_STUB_PROC_glXGetVideoDeviceNV,
+    GLB_STUB_PROC_glXGetVideoInfoNV,
+    GLB_STUB_PROC_glXGetVideoSyncSGI,
+    GLB_STUB_PROC_glXGetVisualFromFBConfig,
+    GLB_STUB_PROC_glXGetVisualFromFBConfigSGIX,
+    GLB_STUB_PROC_glXHyperpipeAttribSGIX,
+    GLB_STUB_PROC_glXHyperpipeConfigSGIX,
+    GLB_STUB_PROC_glXImportContextEXT,
+    GLB_STUB_PROC_glXIsDirect,
+    GLB_STUB_PROC_glXJoinSwapGroupNV,
+    GLB_STUB_PROC_glXJoinSwapGroupSGIX,
+    GLB_STUB_PROC_glXLockVideoCaptureDeviceNV,
+    GLB_STUB_PROC_glXMakeAssociatedContextCurrentAMD,
+    GLB_STUB_PROC_glXMakeContextCurrent,
+    GLB_STUB_PROC_glXMakeCurrent,
+    GLB_STUB_PROC_glXMakeCurrentReadSGI,
+    GLB_STUB_PROC_glXNamedCopyBufferSubDataNV,
+    GLB_STUB_PROC_glXQueryChannelDeltasSGIX,
+    GLB_STUB_PROC_glXQueryChannelRectSGIX,
+    GLB_STUB_PROC_glXQueryContext,
+    GLB_STUB_PROC_glXQueryContextInfoEXT,
+    GLB_STUB_PROC_glXQueryCurrentRendererIntegerMESA,
+    GLB_STUB_PROC_glXQueryCurrentRendererStringMESA,
+    GLB_STUB_PROC_glXQueryDrawable,
+    GLB_STUB_PROC_glXQueryExtension,
+    GLB_STUB_PROC_glXQueryExtensionsString,
+    GLB_STUB_PROC_glXQueryFrameCountNV,
+    GLB_STUB_PROC_glXQueryGLXPbufferSGIX,
+    GLB_STUB_PROC_glXQueryHyperpipeAttribSGIX,
+    GLB_STUB_PROC_glXQueryHyperpipeBestAttribSGIX,
+    GLB_STUB_PROC_glXQueryHyperpipeConfigSGIX,
+    GLB_STUB_PROC_glXQueryHyperpipeNetworkSGIX,
+    GLB_STUB_PROC_glXQueryMaxSwapBarriersSGIX,
+    GLB_STUB_PROC_glXQueryMaxSwapGroupsNV,
+    GLB_STUB_PROC_glXQueryRendererIntegerMESA,
+    GLB_STUB_PROC_glXQueryRendererStringMESA,
+    GLB_STUB_PROC_glXQueryServerString,
+    GLB_STUB_PROC_glXQuerySwapGroupNV,
+    GLB_STUB_PROC_glXQueryVersion,
+    GLB_STUB_PROC_glXQueryVideoCaptureDeviceNV,
+    GLB_STUB_PROC_glXReleaseBuffersMESA,
+    GLB_STUB_PROC_glXReleaseTexImageEXT,
+    GLB_STUB_PROC_glXReleaseVideoCaptureDeviceNV,
+    GLB_STUB_PROC_glXReleaseVideoDeviceNV,
+    GLB_STUB_PROC_glXReleaseVideoImageNV,
+    GLB_STUB_PROC_glXResetFrameCountNV,
+    GLB_STUB_PROC_glXSelectEvent,
+    GLB_STUB_PROC_glXSelectEventSGIX,
+    GLB_STUB_PROC_glXSendPbufferToVideoNV,
+    GLB_STUB_PROC_glXSet3DfxModeMESA,
+    GLB_STUB_PROC_glXSwapBuffers,
+    GLB_STUB_PROC_glXSwapBuffersMscOML,
+    GLB_STUB_PROC_glXSwapIntervalEXT,
+    GLB_STUB_PROC_glXSwapIntervalMESA,
+    GLB_STUB_PROC_glXSwapIntervalSGI,
+    GLB_STUB_PROC_glXUseXFont,
+    GLB_STUB_PROC_glXWaitForMscOML,
+    GLB_STUB_PROC_glXWaitForSbcOML,
+    GLB_STUB_PROC_glXWaitGL,
+    GLB_STUB_PROC_glXWaitVideoSyncSGI,
+    GLB_STUB_PROC_glXWaitX,
+    GLB_STUB_PROC_COUNT
+} glbStubProc;
+
+typedef struct
+{
+    const char* pName;
+    GLBproc proc;
+} glbStubProcEntry;
+
+static unsigned long g_glbStubCallCounts[GLB_STUB_PROC_COUNT];
+static unsigned long g_glbStubLookupCount = 0;
+
+#define GLB_STUB_CALL(proc) g_glbStubCallCounts[proc] += 1
+
+static GLboolean g_glbStubIsInitialized = GL_FALSE;
+static GLint g_glbStubMajorVersion = 0;
+static GLint g_glbStubMinorVersion = 0;
+static char g_glbStubVersionString[64];
+static char* g_glbStubExtensions = NULL;            /* Space separated, for glGetString(GL_EXTENSIONS). */
+static char* g_glbStubExtensionNames = NULL;        /* The same as g_glbStubExtensions, but with a null terminator after each name. */
+static const char** g_glbStubExtensionList = NULL;  /* Points into g_glbStubExtensionNames, for glGetStringi(). */
+static GLint g_glbStubExtensionCount = 0;
+static GLint g_glbStubProfileMask = 0;
+static GLint g_glbStubContextFlags = 0;
+static char* g_glbStubGLXExtensions = NULL;
+static char* g_glbStubNullProcs = NULL;
+
+/* The objects handed out by the GLX functions. Nothing is ever done with them. */
+static int g_glbStubContext;
+static int g_glbStubFBConfig;
+static GLXFBConfig g_glbStubFBConfigs[1] = {(GLXFBConfig)&g_glbStubFBConfig};
+static glbind_XVisualInfo g_glbStubVisualInfo;
+static glbind_Display* g_glbStubCurrentDisplay = NULL;
+static GLXDrawable g_glbStubCurrentDrawable = 0;
+static GLXContext g_glbStubCurrentContext = NULL;
+
+static char* glbStubCopyString(const char* pString)
+{
+    size_t length;
+    char* pCopy;
+
+    if (pString == NULL) {
+        pString = "";
+    }
+
+    length = strlen(pString);
+    pCopy = (char*)malloc(length + 1);
+    if (pCopy != NULL) {
+        memcpy(pCopy, pString, length + 1);
+    }
+
+    return pCopy;
+}
+
+/* Whether or not a name is in a list of names separated by spaces. "*" matches everything. */
+static GLboolean glbStubIsNameInList(const char* pName, const char* pList)
+{
+    size_t nameLength = strlen(pName);
+
+    while (pList != NULL && pList[0] != '\0') {
+        size_t length;
+
+        while (pList[0] == ' ') {
+            pList += 1;
+        }
+
+        length = 0;
+        while (pList[length] != '\0' && pList[length] != ' ') {
+            length += 1;
+        }
+
+        if ((length == 1 && pList[0] == '*') || (length == nameLength && strncmp(pList, pName, length) == 0)) {
+            return GL_TRUE;
+        }
+
+        pList += length;
+    }
+
+    return GL_FALSE;
+}
+
+static void glbStubInit(void);
+
+GLB_STUB_EXPORT void glbStubSetVersion(int majorVersion, int minorVersion)
+{
+    glbStubInit();
+
+    g_glbStubMajorVersion = majorVersion;
+    g_glbStubMinorVersion = minorVersion;
+
+    /* The version string is what glbind parses so it needs to look like a real one. */
+    sprintf(g_glbStubVersionString, "%d.%d glbind stub", majorVersion, minorVersion);
+}
+
+GLB_STUB_EXPORT void glbStubSetExtensions(const char* pExtensions)
+{
+    size_t i;
+    GLint iExtension;
+
+    glbStubInit();
+
+    free(g_glbStubExtensions);
+    free(g_glbStubExtensionNames);
+    free((void*)g_glbStubExtensionList);
+    g_glbStubExtensions     = glbStubCopyString(pExtensions);
+    g_glbStubExtensionNames = glbStubCopyString(pExtensions);
+    g_glbStubExtensionList  = NULL;
+    g_glbStubExtensionCount = 0;
+
+    if (g_glbStubExtensions == NULL || g_glbStubExtensionNames == NULL) {
+        return;
+    }
+
+    /* Split the names up for glGetStringi(). There can't be more names than there are characters. */
+    g_glbStubExtensionList = (const char**)malloc(sizeof(*g_glbStubExtensionList) * (strlen(g_glbStubExtensionNames) + 1));
+    if (g_glbStubExtensionList == NULL) {
+        return;
+    }
+
+    iExtension = 0;
+    for (i = 0; g_glbStubExtensionNames[i] != '\0'; ++i) {
+        if (g_glbStubExtensionNames[i] == ' ') {
+            g_glbStubExtensionNames[i] = '\0';
+        } else if (i == 0 || g_glbStubExtensionNames[i - 1] == '\0') {
+            g_glbStubExtensionList[iExtension] = g_glbStubExtensionNames + i;
+            iExtension += 1;
+        }
+    }
+
+    g_glbStubExtensionCount = iExtension;
+}
+
+GLB_STUB_EXPORT void glbStubSetGLXExtensions(const char* pExtensions)
+{
+    glbStubInit();
+
+    free(g_glbStubGLXExtensions);
+    g_glbStubGLXExtensions = glbStubCopyString(pExtensions);
+}
+
+/* What glGetIntegerv() returns for GL_CONTEXT_PROFILE_MASK and GL_CONTEXT_FLAGS. Both are zero by default. */
+GLB_STUB_EXPORT void glbStubSetContextProfile(int profileMask, int contextFlags)
+{
+    glbStubInit();
+
+    g_glbStubProfileMask  = profileMask;
+    g_glbStubContextFlags = contextFlags;
+}
+
+GLB_STUB_EXPORT void glbStubSetNullProcs(const char* pNames)
+{
+    glbStubInit();
+
+    free(g_glbStubNullProcs);
+    g_glbStubNullProcs = glbStubCopyString(pNames);
+}
+
+static void glbStubInit(void)
+{
+    const char* pVersion;
+    int majorVersion = 0;
+    int minorVersion = 0;
+
+    if (g_glbStubIsInitialized) {
+        return;
+    }
+
+    g_glbStubIsInitialized = GL_TRUE;
+
+    pVersion = getenv("GLBIND_STUB_VERSION");
+    if (pVersion == NULL || pVersion[0] == '\0') {
+        pVersion = GLB_STUB_DEFAULT_VERSION;
+    }
+
+    majorVersion = atoi(pVersion);
+    if (strchr(pVersion, '.') != NULL) {
+        minorVersion = atoi(strchr(pVersion, '.') + 1);
+    }
+
+    glbStubSetVersion(majorVersion, minorVersion);
+    glbStubSetExtensions(getenv("GLBIND_STUB_EXTENSIONS"));
+    glbStubSetGLXExtensions(getenv("GLBIND_STUB_GLX_EXTENSIONS"));
+    glbStubSetNullProcs(getenv("GLBIND_STUB_NULL_PROCS"));
+}
+
+/* Frees the settings when the library is unloaded. */
+GLB_STUB_DESTRUCTOR static void glbStubUninit(void)
+{
+    free(g_glbStubExtensions);
+    free(g_glbStubExtensionNames);
+    free((void*)g_glbStubExtensionList);
+    free(g_glbStubGLXExtensions);
+    free(g_glbStubNullProcs);
+
+    g_glbStubExtensions     = NULL;
+    g_glbStubExtensionNames = NULL;
+    g_glbStubExtensionList  = NULL;
+    g_glbStubExtensionCount = 0;
+    g_glbStubGLXExtensions  = NULL;
+    g_glbStubNullProcs      = NULL;
+    g_glbStubIsInitialized  = GL_FALSE;
+}
+
+/* The number of times a command has been called since the library was loaded or the counts were last reset. */
+GLB_STUB_EXPORT unsigned long glbStubGetCallCount(const char* pName);
+
+/* The number of times glXGetProcAddress() has been called since the library was loaded or the counts were last reset. */
+GLB_STUB_EXPORT unsigned long glbStubGetLookupCount(void)
+{
+    return g_glbStubLookupCount;
+}
+
+GLB_STUB_EXPORT void glbStubResetCounts(void)
+{
+    memset(g_glbStubCallCounts, 0, sizeof(g_glbStubCallCounts));
+    g_glbStubLookupCount = 0;
+}
+
+
+/* GLX. These are all exported because glbInit() retrieves them with dlsym(). */
+GLB_STUB_EXPORT glbind_XVisualInfo* APIENTRY glXChooseVisual(glbind_Display* dpy, int screen, int * attribList)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXChooseVisual);
+    return &g_glbStubVisualInfo;
+}
+
+GLB_STUB_EXPORT GLXContext APIENTRY glXCreateContext(glbind_Display* dpy, glbind_XVisualInfo* vis, GLXContext shareList, glbind_Bool direct)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXCreateContext);
+    return (GLXContext)&g_glbStubContext;
+}
+
+GLB_STUB_EXPORT GLXContext APIENTRY glXCreateNewContext(glbind_Display* dpy, GLXFBConfig config, int render_type, GLXContext share_list, glbind_Bool direct)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXCreateNewContext);
+    return (GLXContext)&g_glbStubContext;
+}
+
+GLB_STUB_EXPORT void APIENTRY glXDestroyContext(glbind_Display* dpy, GLXContext ctx)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXDestroyContext);
+}
+
+GLB_STUB_EXPORT glbind_Bool APIENTRY glXMakeCurrent(glbind_Display* dpy, GLXDrawable drawable, GLXContext ctx)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXMakeCurrent);
+
+    g_glbStubCurrentDisplay  = dpy;
+    g_glbStubCurrentDrawable = drawable;
+    g_glbStubCurrentContext  = ctx;
+
+    return 1;
+}
+
+GLB_STUB_EXPORT void APIENTRY glXSwapBuffers(glbind_Display* dpy, GLXDrawable drawable)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXSwapBuffers);
+}
+
+GLB_STUB_EXPORT GLXContext APIENTRY glXGetCurrentContext(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetCurrentContext);
+    return g_glbStubCurrentContext;
+}
+
+GLB_STUB_EXPORT glbind_Display* APIENTRY glXGetCurrentDisplay(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetCurrentDisplay);
+    return g_glbStubCurrentDisplay;
+}
+
+GLB_STUB_EXPORT GLXDrawable APIENTRY glXGetCurrentDrawable(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetCurrentDrawable);
+    return g_glbStubCurrentDrawable;
+}
+
+GLB_STUB_EXPORT const char * APIENTRY glXQueryExtensionsString(glbind_Display* dpy, int screen)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryExtensionsString);
+
+    glbStubInit();
+    return g_glbStubGLXExtensions;
+}
+
+GLB_STUB_EXPORT GLXFBConfig * APIENTRY glXChooseFBConfig(glbind_Display* dpy, int screen, const int * attrib_list, int * nelements)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXChooseFBConfig);
+
+    if (nelements != NULL) {
+        *nelements = 1;
+    }
+
+    return g_glbStubFBConfigs;
+}
+
+GLB_STUB_EXPORT glbind_XVisualInfo* APIENTRY glXGetVisualFromFBConfig(glbind_Display* dpy, GLXFBConfig config)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetVisualFromFBConfig);
+    return &g_glbStubVisualInfo;
+}
+
+GLB_STUB_EXPORT GLXPbuffer APIENTRY glXCreatePbuffer(glbind_Display* dpy, GLXFBConfig config, const int * attrib_list)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXCreatePbuffer);
+    return 1;
+}
+
+GLB_STUB_EXPORT void APIENTRY glXDestroyPbuffer(glbind_Display* dpy, GLXPbuffer pbuf)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXDestroyPbuffer);
+}
+
+GLB_STUB_EXPORT __GLXextFuncPtr APIENTRY glXGetProcAddress(const GLubyte * procName);
+
+/* Headers generated from a spec file don't necessarily include the extension. */
+#if defined(GLX_ARB_get_proc_address)
+GLB_STUB_EXPORT __GLXextFuncPtr APIENTRY glXGetProcAddressARB(const GLubyte * procName)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetProcAddressARB);
+    return glXGetProcAddress(procName);
+}
+#endif
+
+
+/* The queries glbind uses to find out what the context supports. */
+const GLubyte * APIENTRY glGetString(GLenum name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetString);
+
+    glbStubInit();
+
+    switch (name)
+    {
+        case GL_VENDOR:     return (const GLubyte*)"glbind";
+        case GL_RENDERER:   return (const GLubyte*)"glbind stub";
+        case GL_VERSION:    return (const GLubyte*)g_glbStubVersionString;
+        case GL_EXTENSIONS: return (const GLubyte*)g_glbStubExtensions;
+        default: return NULL;
+    }
+}
+
+#if defined(GLB_STUB_HAS_GET_STRINGI)
+const GLubyte * APIENTRY glGetStringi(GLenum name, GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetStringi);
+
+    glbStubInit();
+
+    if (name != GL_EXTENSIONS || index >= (GLuint)g_glbStubExtensionCount) {
+        return NULL;
+    }
+
+    return (const GLubyte*)g_glbStubExtensionList[index];
+}
+#endif
+
+void APIENTRY glGetIntegerv(GLenum pname, GLint * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetIntegerv);
+
+    glbStubInit();
+
+    switch (pname)
+    {
+    #if defined(GLB_STUB_HAS_GET_STRINGI)
+        case GL_MAJOR_VERSION:          *data = g_glbStubMajorVersion;   break;
+        case GL_MINOR_VERSION:          *data = g_glbStubMinorVersion;   break;
+        case GL_NUM_EXTENSIONS:         *data = g_glbStubExtensionCount; break;
+    #endif
+    #if defined(GL_CONTEXT_FLAGS)
+        case GL_CONTEXT_FLAGS:          *data = g_glbStubContextFlags;   break;
+    #endif
+    #if defined(GL_CONTEXT_PROFILE_MASK)
+        case GL_CONTEXT_PROFILE_MASK:   *data = g_glbStubProfileMask;    break;
+    #endif
+        default:                        *data = 0;                       break;
+    }
+}
+
+
+/* Everything else is a no-op. */
+void APIENTRY glAccum(GLenum op, GLfloat value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glAccum);
+}
+void APIENTRY glAccumxOES(GLenum op, GLfixed value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glAccumxOES);
+}
+GLboolean APIENTRY glAcquireKeyedMutexWin32EXT(GLuint memory, GLuint64 key, GLuint timeout)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glAcquireKeyedMutexWin32EXT);
+    return (GLboolean)0;
+}
+void APIENTRY glActiveProgramEXT(GLuint program)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glActiveProgramEXT);
+}
+void APIENTRY glActiveShaderProgram(GLuint pipeline, GLuint program)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glActiveShaderProgram);
+}
+void APIENTRY glActiveShaderProgramEXT(GLuint pipeline, GLuint program)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glActiveShaderProgramEXT);
+}
+void APIENTRY glActiveStencilFaceEXT(GLenum face)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glActiveStencilFaceEXT);
+}
+void APIENTRY glActiveTexture(GLenum texture)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glActiveTexture);
+}
+void APIENTRY glActiveTextureARB(GLenum texture)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glActiveTextureARB);
+}
+void APIENTRY glActiveVaryingNV(GLuint program, const GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glActiveVaryingNV);
+}
+void APIENTRY glAlphaFragmentOp1ATI(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glAlphaFragmentOp1ATI);
+}
+void APIENTRY glAlphaFragmentOp2ATI(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glAlphaFragmentOp2ATI);
+}
+void APIENTRY glAlphaFragmentOp3ATI(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glAlphaFragmentOp3ATI);
+}
+void APIENTRY glAlphaFunc(GLenum func, GLfloat ref)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glAlphaFunc);
+}
+void APIENTRY glAlphaFuncxOES(GLenum func, GLfixed ref)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glAlphaFuncxOES);
+}
+void APIENTRY glAlphaToCoverageDitherControlNV(GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glAlphaToCoverageDitherControlNV);
+}
+void APIENTRY glApplyFramebufferAttachmentCMAAINTEL(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glApplyFramebufferAttachmentCMAAINTEL);
+}
+void APIENTRY glApplyTextureEXT(GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glApplyTextureEXT);
+}
+GLboolean APIENTRY glAreProgramsResidentNV(GLsizei n, const GLuint * programs, GLboolean * residences)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glAreProgramsResidentNV);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glAreTexturesResident(GLsizei n, const GLuint * textures, GLboolean * residences)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glAreTexturesResident);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glAreTexturesResidentEXT(GLsizei n, const GLuint * textures, GLboolean * residences)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glAreTexturesResidentEXT);
+    return (GLboolean)0;
+}
+void APIENTRY glArrayElement(GLint i)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glArrayElement);
+}
+void APIENTRY glArrayElementEXT(GLint i)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glArrayElementEXT);
+}
+void APIENTRY glArrayObjectATI(GLenum array, GLint size, GLenum type, GLsizei stride, GLuint buffer, GLuint offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glArrayObjectATI);
+}
+GLuint APIENTRY glAsyncCopyBufferSubDataNVX(GLsizei waitSemaphoreCount, const GLuint * waitSemaphoreArray, const GLuint64 * fenceValueArray, GLuint readGpu, GLbitfield writeGpuMask, GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size, GLsizei signalSemaphoreCount, const GLuint * signalSemaphoreArray, const GLuint64 * signalValueArray)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glAsyncCopyBufferSubDataNVX);
+    return (GLuint)0;
+}
+GLuint APIENTRY glAsyncCopyImageSubDataNVX(GLsizei waitSemaphoreCount, const GLuint * waitSemaphoreArray, const GLuint64 * waitValueArray, GLuint srcGpu, GLbitfield dstGpuMask, GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth, GLsizei signalSemaphoreCount, const GLuint * signalSemaphoreArray, const GLuint64 * signalValueArray)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glAsyncCopyImageSubDataNVX);
+    return (GLuint)0;
+}
+void APIENTRY glAsyncMarkerSGIX(GLuint marker)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glAsyncMarkerSGIX);
+}
+void APIENTRY glAttachObjectARB(GLhandleARB containerObj, GLhandleARB obj)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glAttachObjectARB);
+}
+void APIENTRY glAttachShader(GLuint program, GLuint shader)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glAttachShader);
+}
+void APIENTRY glBegin(GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBegin);
+}
+void APIENTRY glBeginConditionalRender(GLuint id, GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBeginConditionalRender);
+}
+void APIENTRY glBeginConditionalRenderNV(GLuint id, GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBeginConditionalRenderNV);
+}
+void APIENTRY glBeginConditionalRenderNVX(GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBeginConditionalRenderNVX);
+}
+void APIENTRY glBeginFragmentShaderATI(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBeginFragmentShaderATI);
+}
+void APIENTRY glBeginOcclusionQueryNV(GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBeginOcclusionQueryNV);
+}
+void APIENTRY glBeginPerfMonitorAMD(GLuint monitor)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBeginPerfMonitorAMD);
+}
+void APIENTRY glBeginPerfQueryINTEL(GLuint queryHandle)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBeginPerfQueryINTEL);
+}
+void APIENTRY glBeginQuery(GLenum target, GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBeginQuery);
+}
+void APIENTRY glBeginQueryARB(GLenum target, GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBeginQueryARB);
+}
+void APIENTRY glBeginQueryIndexed(GLenum target, GLuint index, GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBeginQueryIndexed);
+}
+void APIENTRY glBeginTransformFeedback(GLenum primitiveMode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBeginTransformFeedback);
+}
+void APIENTRY glBeginTransformFeedbackEXT(GLenum primitiveMode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBeginTransformFeedbackEXT);
+}
+void APIENTRY glBeginTransformFeedbackNV(GLenum primitiveMode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBeginTransformFeedbackNV);
+}
+void APIENTRY glBeginVertexShaderEXT(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBeginVertexShaderEXT);
+}
+void APIENTRY glBeginVideoCaptureNV(GLuint video_capture_slot)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBeginVideoCaptureNV);
+}
+void APIENTRY glBindAttribLocation(GLuint program, GLuint index, const GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindAttribLocation);
+}
+void APIENTRY glBindAttribLocationARB(GLhandleARB programObj, GLuint index, const GLcharARB * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindAttribLocationARB);
+}
+void APIENTRY glBindBuffer(GLenum target, GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindBuffer);
+}
+void APIENTRY glBindBufferARB(GLenum target, GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindBufferARB);
+}
+void APIENTRY glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindBufferBase);
+}
+void APIENTRY glBindBufferBaseEXT(GLenum target, GLuint index, GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindBufferBaseEXT);
+}
+void APIENTRY glBindBufferBaseNV(GLenum target, GLuint index, GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindBufferBaseNV);
+}
+void APIENTRY glBindBufferOffsetEXT(GLenum target, GLuint index, GLuint buffer, GLintptr offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindBufferOffsetEXT);
+}
+void APIENTRY glBindBufferOffsetNV(GLenum target, GLuint index, GLuint buffer, GLintptr offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindBufferOffsetNV);
+}
+void APIENTRY glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindBufferRange);
+}
+void APIENTRY glBindBufferRangeEXT(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindBufferRangeEXT);
+}
+void APIENTRY glBindBufferRangeNV(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindBufferRangeNV);
+}
+void APIENTRY glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint * buffers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindBuffersBase);
+}
+void APIENTRY glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint * buffers, const GLintptr * offsets, const GLsizeiptr * sizes)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindBuffersRange);
+}
+void APIENTRY glBindFragDataLocation(GLuint program, GLuint color, const GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindFragDataLocation);
+}
+void APIENTRY glBindFragDataLocationEXT(GLuint program, GLuint color, const GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindFragDataLocationEXT);
+}
+void APIENTRY glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindFragDataLocationIndexed);
+}
+void APIENTRY glBindFragmentShaderATI(GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindFragmentShaderATI);
+}
+void APIENTRY glBindFramebuffer(GLenum target, GLuint framebuffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindFramebuffer);
+}
+void APIENTRY glBindFramebufferEXT(GLenum target, GLuint framebuffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindFramebufferEXT);
+}
+void APIENTRY glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindImageTexture);
+}
+void APIENTRY glBindImageTextureEXT(GLuint index, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLint format)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindImageTextureEXT);
+}
+void APIENTRY glBindImageTextures(GLuint first, GLsizei count, const GLuint * textures)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindImageTextures);
+}
+GLuint APIENTRY glBindLightParameterEXT(GLenum light, GLenum value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindLightParameterEXT);
+    return (GLuint)0;
+}
+GLuint APIENTRY glBindMaterialParameterEXT(GLenum face, GLenum value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindMaterialParameterEXT);
+    return (GLuint)0;
+}
+void APIENTRY glBindMultiTextureEXT(GLenum texunit, GLenum target, GLuint texture)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindMultiTextureEXT);
+}
+GLuint APIENTRY glBindParameterEXT(GLenum value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindParameterEXT);
+    return (GLuint)0;
+}
+void APIENTRY glBindProgramARB(GLenum target, GLuint program)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindProgramARB);
+}
+void APIENTRY glBindProgramNV(GLenum target, GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindProgramNV);
+}
+void APIENTRY glBindProgramPipeline(GLuint pipeline)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindProgramPipeline);
+}
+void APIENTRY glBindProgramPipelineEXT(GLuint pipeline)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindProgramPipelineEXT);
+}
+void APIENTRY glBindRenderbuffer(GLenum target, GLuint renderbuffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindRenderbuffer);
+}
+void APIENTRY glBindRenderbufferEXT(GLenum target, GLuint renderbuffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindRenderbufferEXT);
+}
+void APIENTRY glBindSampler(GLuint unit, GLuint sampler)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindSampler);
+}
+void APIENTRY glBindSamplers(GLuint first, GLsizei count, const GLuint * samplers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindSamplers);
+}
+void APIENTRY glBindShadingRateImageNV(GLuint texture)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindShadingRateImageNV);
+}
+GLuint APIENTRY glBindTexGenParameterEXT(GLenum unit, GLenum coord, GLenum value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindTexGenParameterEXT);
+    return (GLuint)0;
+}
+void APIENTRY glBindTexture(GLenum target, GLuint texture)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindTexture);
+}
+void APIENTRY glBindTextureEXT(GLenum target, GLuint texture)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindTextureEXT);
+}
+void APIENTRY glBindTextureUnit(GLuint unit, GLuint texture)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindTextureUnit);
+}
+GLuint APIENTRY glBindTextureUnitParameterEXT(GLenum unit, GLenum value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindTextureUnitParameterEXT);
+    return (GLuint)0;
+}
+void APIENTRY glBindTextures(GLuint first, GLsizei count, const GLuint * textures)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindTextures);
+}
+void APIENTRY glBindTransformFeedback(GLenum target, GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindTransformFeedback);
+}
+void APIENTRY glBindTransformFeedbackNV(GLenum target, GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindTransformFeedbackNV);
+}
+void APIENTRY glBindVertexArray(GLuint array)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindVertexArray);
+}
+void APIENTRY glBindVertexArrayAPPLE(GLuint array)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindVertexArrayAPPLE);
+}
+void APIENTRY glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindVertexBuffer);
+}
+void APIENTRY glBindVertexBuffers(GLuint first, GLsizei count, const GLuint * buffers, const GLintptr * offsets, const GLsizei * strides)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindVertexBuffers);
+}
+void APIENTRY glBindVertexShaderEXT(GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindVertexShaderEXT);
+}
+void APIENTRY glBindVideoCaptureStreamBufferNV(GLuint video_capture_slot, GLuint stream, GLenum frame_region, GLintptrARB offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindVideoCaptureStreamBufferNV);
+}
+void APIENTRY glBindVideoCaptureStreamTextureNV(GLuint video_capture_slot, GLuint stream, GLenum frame_region, GLenum target, GLuint texture)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBindVideoCaptureStreamTextureNV);
+}
+void APIENTRY glBinormal3bEXT(GLbyte bx, GLbyte by, GLbyte bz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBinormal3bEXT);
+}
+void APIENTRY glBinormal3bvEXT(const GLbyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBinormal3bvEXT);
+}
+void APIENTRY glBinormal3dEXT(GLdouble bx, GLdouble by, GLdouble bz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBinormal3dEXT);
+}
+void APIENTRY glBinormal3dvEXT(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBinormal3dvEXT);
+}
+void APIENTRY glBinormal3fEXT(GLfloat bx, GLfloat by, GLfloat bz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBinormal3fEXT);
+}
+void APIENTRY glBinormal3fvEXT(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBinormal3fvEXT);
+}
+void APIENTRY glBinormal3iEXT(GLint bx, GLint by, GLint bz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBinormal3iEXT);
+}
+void APIENTRY glBinormal3ivEXT(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBinormal3ivEXT);
+}
+void APIENTRY glBinormal3sEXT(GLshort bx, GLshort by, GLshort bz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBinormal3sEXT);
+}
+void APIENTRY glBinormal3svEXT(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBinormal3svEXT);
+}
+void APIENTRY glBinormalPointerEXT(GLenum type, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBinormalPointerEXT);
+}
+void APIENTRY glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte * bitmap)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBitmap);
+}
+void APIENTRY glBitmapxOES(GLsizei width, GLsizei height, GLfixed xorig, GLfixed yorig, GLfixed xmove, GLfixed ymove, const GLubyte * bitmap)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBitmapxOES);
+}
+void APIENTRY glBlendBarrierKHR(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendBarrierKHR);
+}
+void APIENTRY glBlendBarrierNV(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendBarrierNV);
+}
+void APIENTRY glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendColor);
+}
+void APIENTRY glBlendColorEXT(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendColorEXT);
+}
+void APIENTRY glBlendColorxOES(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendColorxOES);
+}
+void APIENTRY glBlendEquation(GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendEquation);
+}
+void APIENTRY glBlendEquationEXT(GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendEquationEXT);
+}
+void APIENTRY glBlendEquationIndexedAMD(GLuint buf, GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendEquationIndexedAMD);
+}
+void APIENTRY glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendEquationSeparate);
+}
+void APIENTRY glBlendEquationSeparateEXT(GLenum modeRGB, GLenum modeAlpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendEquationSeparateEXT);
+}
+void APIENTRY glBlendEquationSeparateIndexedAMD(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendEquationSeparateIndexedAMD);
+}
+void APIENTRY glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendEquationSeparatei);
+}
+void APIENTRY glBlendEquationSeparateiARB(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendEquationSeparateiARB);
+}
+void APIENTRY glBlendEquationi(GLuint buf, GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendEquationi);
+}
+void APIENTRY glBlendEquationiARB(GLuint buf, GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendEquationiARB);
+}
+void APIENTRY glBlendFunc(GLenum sfactor, GLenum dfactor)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendFunc);
+}
+void APIENTRY glBlendFuncIndexedAMD(GLuint buf, GLenum src, GLenum dst)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendFuncIndexedAMD);
+}
+void APIENTRY glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendFuncSeparate);
+}
+void APIENTRY glBlendFuncSeparateEXT(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendFuncSeparateEXT);
+}
+void APIENTRY glBlendFuncSeparateINGR(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendFuncSeparateINGR);
+}
+void APIENTRY glBlendFuncSeparateIndexedAMD(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendFuncSeparateIndexedAMD);
+}
+void APIENTRY glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendFuncSeparatei);
+}
+void APIENTRY glBlendFuncSeparateiARB(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendFuncSeparateiARB);
+}
+void APIENTRY glBlendFunci(GLuint buf, GLenum src, GLenum dst)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendFunci);
+}
+void APIENTRY glBlendFunciARB(GLuint buf, GLenum src, GLenum dst)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendFunciARB);
+}
+void APIENTRY glBlendParameteriNV(GLenum pname, GLint value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlendParameteriNV);
+}
+void APIENTRY glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlitFramebuffer);
+}
+void APIENTRY glBlitFramebufferEXT(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlitFramebufferEXT);
+}
+void APIENTRY glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBlitNamedFramebuffer);
+}
+void APIENTRY glBufferAddressRangeNV(GLenum pname, GLuint index, GLuint64EXT address, GLsizeiptr length)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBufferAddressRangeNV);
+}
+void APIENTRY glBufferAttachMemoryNV(GLenum target, GLuint memory, GLuint64 offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBufferAttachMemoryNV);
+}
+void APIENTRY glBufferData(GLenum target, GLsizeiptr size, const void * data, GLenum usage)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBufferData);
+}
+void APIENTRY glBufferDataARB(GLenum target, GLsizeiptrARB size, const void * data, GLenum usage)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBufferDataARB);
+}
+void APIENTRY glBufferPageCommitmentARB(GLenum target, GLintptr offset, GLsizeiptr size, GLboolean commit)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBufferPageCommitmentARB);
+}
+void APIENTRY glBufferPageCommitmentMemNV(GLenum target, GLintptr offset, GLsizeiptr size, GLuint memory, GLuint64 memOffset, GLboolean commit)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBufferPageCommitmentMemNV);
+}
+void APIENTRY glBufferParameteriAPPLE(GLenum target, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBufferParameteriAPPLE);
+}
+void APIENTRY glBufferStorage(GLenum target, GLsizeiptr size, const void * data, GLbitfield flags)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBufferStorage);
+}
+void APIENTRY glBufferStorageExternalEXT(GLenum target, GLintptr offset, GLsizeiptr size, GLeglClientBufferEXT clientBuffer, GLbitfield flags)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBufferStorageExternalEXT);
+}
+void APIENTRY glBufferStorageMemEXT(GLenum target, GLsizeiptr size, GLuint memory, GLuint64 offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBufferStorageMemEXT);
+}
+void APIENTRY glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBufferSubData);
+}
+void APIENTRY glBufferSubDataARB(GLenum target, GLintptrARB offset, GLsizeiptrARB size, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glBufferSubDataARB);
+}
+void APIENTRY glCallCommandListNV(GLuint list)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCallCommandListNV);
+}
+void APIENTRY glCallList(GLuint list)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCallList);
+}
+void APIENTRY glCallLists(GLsizei n, GLenum type, const void * lists)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCallLists);
+}
+GLenum APIENTRY glCheckFramebufferStatus(GLenum target)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCheckFramebufferStatus);
+    return (GLenum)0;
+}
+GLenum APIENTRY glCheckFramebufferStatusEXT(GLenum target)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCheckFramebufferStatusEXT);
+    return (GLenum)0;
+}
+GLenum APIENTRY glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCheckNamedFramebufferStatus);
+    return (GLenum)0;
+}
+GLenum APIENTRY glCheckNamedFramebufferStatusEXT(GLuint framebuffer, GLenum target)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCheckNamedFramebufferStatusEXT);
+    return (GLenum)0;
+}
+void APIENTRY glClampColor(GLenum target, GLenum clamp)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClampColor);
+}
+void APIENTRY glClampColorARB(GLenum target, GLenum clamp)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClampColorARB);
+}
+void APIENTRY glClear(GLbitfield mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClear);
+}
+void APIENTRY glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearAccum);
+}
+void APIENTRY glClearAccumxOES(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearAccumxOES);
+}
+void APIENTRY glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearBufferData);
+}
+void APIENTRY glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearBufferSubData);
+}
+void APIENTRY glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearBufferfi);
+}
+void APIENTRY glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearBufferfv);
+}
+void APIENTRY glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearBufferiv);
+}
+void APIENTRY glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearBufferuiv);
+}
+void APIENTRY glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearColor);
+}
+void APIENTRY glClearColorIiEXT(GLint red, GLint green, GLint blue, GLint alpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearColorIiEXT);
+}
+void APIENTRY glClearColorIuiEXT(GLuint red, GLuint green, GLuint blue, GLuint alpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearColorIuiEXT);
+}
+void APIENTRY glClearColorxOES(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearColorxOES);
+}
+void APIENTRY glClearDepth(GLdouble depth)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearDepth);
+}
+void APIENTRY glClearDepthdNV(GLdouble depth)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearDepthdNV);
+}
+void APIENTRY glClearDepthf(GLfloat d)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearDepthf);
+}
+void APIENTRY glClearDepthfOES(GLclampf depth)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearDepthfOES);
+}
+void APIENTRY glClearDepthxOES(GLfixed depth)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearDepthxOES);
+}
+void APIENTRY glClearIndex(GLfloat c)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearIndex);
+}
+void APIENTRY glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearNamedBufferData);
+}
+void APIENTRY glClearNamedBufferDataEXT(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearNamedBufferDataEXT);
+}
+void APIENTRY glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearNamedBufferSubData);
+}
+void APIENTRY glClearNamedBufferSubDataEXT(GLuint buffer, GLenum internalformat, GLsizeiptr offset, GLsizeiptr size, GLenum format, GLenum type, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearNamedBufferSubDataEXT);
+}
+void APIENTRY glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearNamedFramebufferfi);
+}
+void APIENTRY glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearNamedFramebufferfv);
+}
+void APIENTRY glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearNamedFramebufferiv);
+}
+void APIENTRY glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearNamedFramebufferuiv);
+}
+void APIENTRY glClearStencil(GLint s)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearStencil);
+}
+void APIENTRY glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearTexImage);
+}
+void APIENTRY glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClearTexSubImage);
+}
+void APIENTRY glClientActiveTexture(GLenum texture)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClientActiveTexture);
+}
+void APIENTRY glClientActiveTextureARB(GLenum texture)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClientActiveTextureARB);
+}
+void APIENTRY glClientActiveVertexStreamATI(GLenum stream)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClientActiveVertexStreamATI);
+}
+void APIENTRY glClientAttribDefaultEXT(GLbitfield mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClientAttribDefaultEXT);
+}
+void APIENTRY glClientWaitSemaphoreui64NVX(GLsizei fenceObjectCount, const GLuint * semaphoreArray, const GLuint64 * fenceValueArray)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClientWaitSemaphoreui64NVX);
+}
+GLenum APIENTRY glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClientWaitSync);
+    return (GLenum)0;
+}
+void APIENTRY glClipControl(GLenum origin, GLenum depth)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClipControl);
+}
+void APIENTRY glClipPlane(GLenum plane, const GLdouble * equation)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClipPlane);
+}
+void APIENTRY glClipPlanefOES(GLenum plane, const GLfloat * equation)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClipPlanefOES);
+}
+void APIENTRY glClipPlanexOES(GLenum plane, const GLfixed * equation)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glClipPlanexOES);
+}
+void APIENTRY glColor3b(GLbyte red, GLbyte green, GLbyte blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3b);
+}
+void APIENTRY glColor3bv(const GLbyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3bv);
+}
+void APIENTRY glColor3d(GLdouble red, GLdouble green, GLdouble blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3d);
+}
+void APIENTRY glColor3dv(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3dv);
+}
+void APIENTRY glColor3f(GLfloat red, GLfloat green, GLfloat blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3f);
+}
+void APIENTRY glColor3fVertex3fSUN(GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3fVertex3fSUN);
+}
+void APIENTRY glColor3fVertex3fvSUN(const GLfloat * c, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3fVertex3fvSUN);
+}
+void APIENTRY glColor3fv(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3fv);
+}
+void APIENTRY glColor3hNV(GLhalfNV red, GLhalfNV green, GLhalfNV blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3hNV);
+}
+void APIENTRY glColor3hvNV(const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3hvNV);
+}
+void APIENTRY glColor3i(GLint red, GLint green, GLint blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3i);
+}
+void APIENTRY glColor3iv(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3iv);
+}
+void APIENTRY glColor3s(GLshort red, GLshort green, GLshort blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3s);
+}
+void APIENTRY glColor3sv(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3sv);
+}
+void APIENTRY glColor3ub(GLubyte red, GLubyte green, GLubyte blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3ub);
+}
+void APIENTRY glColor3ubv(const GLubyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3ubv);
+}
+void APIENTRY glColor3ui(GLuint red, GLuint green, GLuint blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3ui);
+}
+void APIENTRY glColor3uiv(const GLuint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3uiv);
+}
+void APIENTRY glColor3us(GLushort red, GLushort green, GLushort blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3us);
+}
+void APIENTRY glColor3usv(const GLushort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3usv);
+}
+void APIENTRY glColor3xOES(GLfixed red, GLfixed green, GLfixed blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3xOES);
+}
+void APIENTRY glColor3xvOES(const GLfixed * components)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor3xvOES);
+}
+void APIENTRY glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4b);
+}
+void APIENTRY glColor4bv(const GLbyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4bv);
+}
+void APIENTRY glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4d);
+}
+void APIENTRY glColor4dv(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4dv);
+}
+void APIENTRY glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4f);
+}
+void APIENTRY glColor4fNormal3fVertex3fSUN(GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4fNormal3fVertex3fSUN);
+}
+void APIENTRY glColor4fNormal3fVertex3fvSUN(const GLfloat * c, const GLfloat * n, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4fNormal3fVertex3fvSUN);
+}
+void APIENTRY glColor4fv(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4fv);
+}
+void APIENTRY glColor4hNV(GLhalfNV red, GLhalfNV green, GLhalfNV blue, GLhalfNV alpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4hNV);
+}
+void APIENTRY glColor4hvNV(const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4hvNV);
+}
+void APIENTRY glColor4i(GLint red, GLint green, GLint blue, GLint alpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4i);
+}
+void APIENTRY glColor4iv(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4iv);
+}
+void APIENTRY glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4s);
+}
+void APIENTRY glColor4sv(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4sv);
+}
+void APIENTRY glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4ub);
+}
+void APIENTRY glColor4ubVertex2fSUN(GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4ubVertex2fSUN);
+}
+void APIENTRY glColor4ubVertex2fvSUN(const GLubyte * c, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4ubVertex2fvSUN);
+}
+void APIENTRY glColor4ubVertex3fSUN(GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4ubVertex3fSUN);
+}
+void APIENTRY glColor4ubVertex3fvSUN(const GLubyte * c, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4ubVertex3fvSUN);
+}
+void APIENTRY glColor4ubv(const GLubyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4ubv);
+}
+void APIENTRY glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4ui);
+}
+void APIENTRY glColor4uiv(const GLuint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4uiv);
+}
+void APIENTRY glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4us);
+}
+void APIENTRY glColor4usv(const GLushort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4usv);
+}
+void APIENTRY glColor4xOES(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4xOES);
+}
+void APIENTRY glColor4xvOES(const GLfixed * components)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColor4xvOES);
+}
+void APIENTRY glColorFormatNV(GLint size, GLenum type, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorFormatNV);
+}
+void APIENTRY glColorFragmentOp1ATI(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorFragmentOp1ATI);
+}
+void APIENTRY glColorFragmentOp2ATI(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorFragmentOp2ATI);
+}
+void APIENTRY glColorFragmentOp3ATI(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorFragmentOp3ATI);
+}
+void APIENTRY glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorMask);
+}
+void APIENTRY glColorMaskIndexedEXT(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorMaskIndexedEXT);
+}
+void APIENTRY glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorMaski);
+}
+void APIENTRY glColorMaterial(GLenum face, GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorMaterial);
+}
+void APIENTRY glColorP3ui(GLenum type, GLuint color)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorP3ui);
+}
+void APIENTRY glColorP3uiv(GLenum type, const GLuint * color)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorP3uiv);
+}
+void APIENTRY glColorP4ui(GLenum type, GLuint color)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorP4ui);
+}
+void APIENTRY glColorP4uiv(GLenum type, const GLuint * color)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorP4uiv);
+}
+void APIENTRY glColorPointer(GLint size, GLenum type, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorPointer);
+}
+void APIENTRY glColorPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei count, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorPointerEXT);
+}
+void APIENTRY glColorPointerListIBM(GLint size, GLenum type, GLint stride, const void ** pointer, GLint ptrstride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorPointerListIBM);
+}
+void APIENTRY glColorPointervINTEL(GLint size, GLenum type, const void ** pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorPointervINTEL);
+}
+void APIENTRY glColorSubTable(GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorSubTable);
+}
+void APIENTRY glColorSubTableEXT(GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorSubTableEXT);
+}
+void APIENTRY glColorTable(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void * table)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorTable);
+}
+void APIENTRY glColorTableEXT(GLenum target, GLenum internalFormat, GLsizei width, GLenum format, GLenum type, const void * table)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorTableEXT);
+}
+void APIENTRY glColorTableParameterfv(GLenum target, GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorTableParameterfv);
+}
+void APIENTRY glColorTableParameterfvSGI(GLenum target, GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorTableParameterfvSGI);
+}
+void APIENTRY glColorTableParameteriv(GLenum target, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorTableParameteriv);
+}
+void APIENTRY glColorTableParameterivSGI(GLenum target, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorTableParameterivSGI);
+}
+void APIENTRY glColorTableSGI(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void * table)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glColorTableSGI);
+}
+void APIENTRY glCombinerInputNV(GLenum stage, GLenum portion, GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCombinerInputNV);
+}
+void APIENTRY glCombinerOutputNV(GLenum stage, GLenum portion, GLenum abOutput, GLenum cdOutput, GLenum sumOutput, GLenum scale, GLenum bias, GLboolean abDotProduct, GLboolean cdDotProduct, GLboolean muxSum)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCombinerOutputNV);
+}
+void APIENTRY glCombinerParameterfNV(GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCombinerParameterfNV);
+}
+void APIENTRY glCombinerParameterfvNV(GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCombinerParameterfvNV);
+}
+void APIENTRY glCombinerParameteriNV(GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCombinerParameteriNV);
+}
+void APIENTRY glCombinerParameterivNV(GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCombinerParameterivNV);
+}
+void APIENTRY glCombinerStageParameterfvNV(GLenum stage, GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCombinerStageParameterfvNV);
+}
+void APIENTRY glCommandListSegmentsNV(GLuint list, GLuint segments)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCommandListSegmentsNV);
+}
+void APIENTRY glCompileCommandListNV(GLuint list)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompileCommandListNV);
+}
+void APIENTRY glCompileShader(GLuint shader)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompileShader);
+}
+void APIENTRY glCompileShaderARB(GLhandleARB shaderObj)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompileShaderARB);
+}
+void APIENTRY glCompileShaderIncludeARB(GLuint shader, GLsizei count, const GLchar *const* path, const GLint * length)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompileShaderIncludeARB);
+}
+void APIENTRY glCompressedMultiTexImage1DEXT(GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void * bits)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedMultiTexImage1DEXT);
+}
+void APIENTRY glCompressedMultiTexImage2DEXT(GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void * bits)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedMultiTexImage2DEXT);
+}
+void APIENTRY glCompressedMultiTexImage3DEXT(GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void * bits)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedMultiTexImage3DEXT);
+}
+void APIENTRY glCompressedMultiTexSubImage1DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void * bits)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedMultiTexSubImage1DEXT);
+}
+void APIENTRY glCompressedMultiTexSubImage2DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void * bits)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedMultiTexSubImage2DEXT);
+}
+void APIENTRY glCompressedMultiTexSubImage3DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void * bits)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedMultiTexSubImage3DEXT);
+}
+void APIENTRY glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedTexImage1D);
+}
+void APIENTRY glCompressedTexImage1DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedTexImage1DARB);
+}
+void APIENTRY glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedTexImage2D);
+}
+void APIENTRY glCompressedTexImage2DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedTexImage2DARB);
+}
+void APIENTRY glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedTexImage3D);
+}
+void APIENTRY glCompressedTexImage3DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedTexImage3DARB);
+}
+void APIENTRY glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedTexSubImage1D);
+}
+void APIENTRY glCompressedTexSubImage1DARB(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedTexSubImage1DARB);
+}
+void APIENTRY glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedTexSubImage2D);
+}
+void APIENTRY glCompressedTexSubImage2DARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedTexSubImage2DARB);
+}
+void APIENTRY glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedTexSubImage3D);
+}
+void APIENTRY glCompressedTexSubImage3DARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedTexSubImage3DARB);
+}
+void APIENTRY glCompressedTextureImage1DEXT(GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void * bits)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedTextureImage1DEXT);
+}
+void APIENTRY glCompressedTextureImage2DEXT(GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void * bits)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedTextureImage2DEXT);
+}
+void APIENTRY glCompressedTextureImage3DEXT(GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void * bits)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedTextureImage3DEXT);
+}
+void APIENTRY glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedTextureSubImage1D);
+}
+void APIENTRY glCompressedTextureSubImage1DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void * bits)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedTextureSubImage1DEXT);
+}
+void APIENTRY glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedTextureSubImage2D);
+}
+void APIENTRY glCompressedTextureSubImage2DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void * bits)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedTextureSubImage2DEXT);
+}
+void APIENTRY glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedTextureSubImage3D);
+}
+void APIENTRY glCompressedTextureSubImage3DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void * bits)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCompressedTextureSubImage3DEXT);
+}
+void APIENTRY glConservativeRasterParameterfNV(GLenum pname, GLfloat value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glConservativeRasterParameterfNV);
+}
+void APIENTRY glConservativeRasterParameteriNV(GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glConservativeRasterParameteriNV);
+}
+void APIENTRY glConvolutionFilter1D(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void * image)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glConvolutionFilter1D);
+}
+void APIENTRY glConvolutionFilter1DEXT(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void * image)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glConvolutionFilter1DEXT);
+}
+void APIENTRY glConvolutionFilter2D(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * image)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glConvolutionFilter2D);
+}
+void APIENTRY glConvolutionFilter2DEXT(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * image)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glConvolutionFilter2DEXT);
+}
+void APIENTRY glConvolutionParameterf(GLenum target, GLenum pname, GLfloat params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glConvolutionParameterf);
+}
+void APIENTRY glConvolutionParameterfEXT(GLenum target, GLenum pname, GLfloat params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glConvolutionParameterfEXT);
+}
+void APIENTRY glConvolutionParameterfv(GLenum target, GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glConvolutionParameterfv);
+}
+void APIENTRY glConvolutionParameterfvEXT(GLenum target, GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glConvolutionParameterfvEXT);
+}
+void APIENTRY glConvolutionParameteri(GLenum target, GLenum pname, GLint params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glConvolutionParameteri);
+}
+void APIENTRY glConvolutionParameteriEXT(GLenum target, GLenum pname, GLint params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glConvolutionParameteriEXT);
+}
+void APIENTRY glConvolutionParameteriv(GLenum target, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glConvolutionParameteriv);
+}
+void APIENTRY glConvolutionParameterivEXT(GLenum target, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glConvolutionParameterivEXT);
+}
+void APIENTRY glConvolutionParameterxOES(GLenum target, GLenum pname, GLfixed param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glConvolutionParameterxOES);
+}
+void APIENTRY glConvolutionParameterxvOES(GLenum target, GLenum pname, const GLfixed * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glConvolutionParameterxvOES);
+}
+void APIENTRY glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyBufferSubData);
+}
+void APIENTRY glCopyColorSubTable(GLenum target, GLsizei start, GLint x, GLint y, GLsizei width)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyColorSubTable);
+}
+void APIENTRY glCopyColorSubTableEXT(GLenum target, GLsizei start, GLint x, GLint y, GLsizei width)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyColorSubTableEXT);
+}
+void APIENTRY glCopyColorTable(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyColorTable);
+}
+void APIENTRY glCopyColorTableSGI(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyColorTableSGI);
+}
+void APIENTRY glCopyConvolutionFilter1D(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyConvolutionFilter1D);
+}
+void APIENTRY glCopyConvolutionFilter1DEXT(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyConvolutionFilter1DEXT);
+}
+void APIENTRY glCopyConvolutionFilter2D(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyConvolutionFilter2D);
+}
+void APIENTRY glCopyConvolutionFilter2DEXT(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyConvolutionFilter2DEXT);
+}
+void APIENTRY glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyImageSubData);
+}
+void APIENTRY glCopyImageSubDataNV(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei width, GLsizei height, GLsizei depth)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyImageSubDataNV);
+}
+void APIENTRY glCopyMultiTexImage1DEXT(GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyMultiTexImage1DEXT);
+}
+void APIENTRY glCopyMultiTexImage2DEXT(GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyMultiTexImage2DEXT);
+}
+void APIENTRY glCopyMultiTexSubImage1DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyMultiTexSubImage1DEXT);
+}
+void APIENTRY glCopyMultiTexSubImage2DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyMultiTexSubImage2DEXT);
+}
+void APIENTRY glCopyMultiTexSubImage3DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyMultiTexSubImage3DEXT);
+}
+void APIENTRY glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyNamedBufferSubData);
+}
+void APIENTRY glCopyPathNV(GLuint resultPath, GLuint srcPath)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyPathNV);
+}
+void APIENTRY glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyPixels);
+}
+void APIENTRY glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyTexImage1D);
+}
+void APIENTRY glCopyTexImage1DEXT(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyTexImage1DEXT);
+}
+void APIENTRY glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyTexImage2D);
+}
+void APIENTRY glCopyTexImage2DEXT(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyTexImage2DEXT);
+}
+void APIENTRY glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyTexSubImage1D);
+}
+void APIENTRY glCopyTexSubImage1DEXT(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyTexSubImage1DEXT);
+}
+void APIENTRY glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyTexSubImage2D);
+}
+void APIENTRY glCopyTexSubImage2DEXT(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyTexSubImage2DEXT);
+}
+void APIENTRY glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyTexSubImage3D);
+}
+void APIENTRY glCopyTexSubImage3DEXT(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyTexSubImage3DEXT);
+}
+void APIENTRY glCopyTextureImage1DEXT(GLuint texture, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyTextureImage1DEXT);
+}
+void APIENTRY glCopyTextureImage2DEXT(GLuint texture, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyTextureImage2DEXT);
+}
+void APIENTRY glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyTextureSubImage1D);
+}
+void APIENTRY glCopyTextureSubImage1DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyTextureSubImage1DEXT);
+}
+void APIENTRY glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyTextureSubImage2D);
+}
+void APIENTRY glCopyTextureSubImage2DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyTextureSubImage2DEXT);
+}
+void APIENTRY glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyTextureSubImage3D);
+}
+void APIENTRY glCopyTextureSubImage3DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCopyTextureSubImage3DEXT);
+}
+void APIENTRY glCoverFillPathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void * paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat * transformValues)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCoverFillPathInstancedNV);
+}
+void APIENTRY glCoverFillPathNV(GLuint path, GLenum coverMode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCoverFillPathNV);
+}
+void APIENTRY glCoverStrokePathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void * paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat * transformValues)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCoverStrokePathInstancedNV);
+}
+void APIENTRY glCoverStrokePathNV(GLuint path, GLenum coverMode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCoverStrokePathNV);
+}
+void APIENTRY glCoverageModulationNV(GLenum components)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCoverageModulationNV);
+}
+void APIENTRY glCoverageModulationTableNV(GLsizei n, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCoverageModulationTableNV);
+}
+void APIENTRY glCreateBuffers(GLsizei n, GLuint * buffers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateBuffers);
+}
+void APIENTRY glCreateCommandListsNV(GLsizei n, GLuint * lists)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateCommandListsNV);
+}
+void APIENTRY glCreateFramebuffers(GLsizei n, GLuint * framebuffers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateFramebuffers);
+}
+void APIENTRY glCreateMemoryObjectsEXT(GLsizei n, GLuint * memoryObjects)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateMemoryObjectsEXT);
+}
+void APIENTRY glCreatePerfQueryINTEL(GLuint queryId, GLuint * queryHandle)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreatePerfQueryINTEL);
+}
+GLuint APIENTRY glCreateProgram(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateProgram);
+    return (GLuint)0;
+}
+GLhandleARB APIENTRY glCreateProgramObjectARB(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateProgramObjectARB);
+    return (GLhandleARB)0;
+}
+void APIENTRY glCreateProgramPipelines(GLsizei n, GLuint * pipelines)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateProgramPipelines);
+}
+GLuint APIENTRY glCreateProgressFenceNVX(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateProgressFenceNVX);
+    return (GLuint)0;
+}
+void APIENTRY glCreateQueries(GLenum target, GLsizei n, GLuint * ids)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateQueries);
+}
+void APIENTRY glCreateRenderbuffers(GLsizei n, GLuint * renderbuffers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateRenderbuffers);
+}
+void APIENTRY glCreateSamplers(GLsizei n, GLuint * samplers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateSamplers);
+}
+void APIENTRY glCreateSemaphoresNV(GLsizei n, GLuint * semaphores)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateSemaphoresNV);
+}
+GLuint APIENTRY glCreateShader(GLenum type)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateShader);
+    return (GLuint)0;
+}
+GLhandleARB APIENTRY glCreateShaderObjectARB(GLenum shaderType)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateShaderObjectARB);
+    return (GLhandleARB)0;
+}
+GLuint APIENTRY glCreateShaderProgramEXT(GLenum type, const GLchar * string)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateShaderProgramEXT);
+    return (GLuint)0;
+}
+GLuint APIENTRY glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const* strings)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateShaderProgramv);
+    return (GLuint)0;
+}
+GLuint APIENTRY glCreateShaderProgramvEXT(GLenum type, GLsizei count, const GLchar ** strings)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateShaderProgramvEXT);
+    return (GLuint)0;
+}
+void APIENTRY glCreateStatesNV(GLsizei n, GLuint * states)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateStatesNV);
+}
+GLsync APIENTRY glCreateSyncFromCLeventARB(struct _cl_context * context, struct _cl_event * event, GLbitfield flags)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateSyncFromCLeventARB);
+    return (GLsync)0;
+}
+void APIENTRY glCreateTextures(GLenum target, GLsizei n, GLuint * textures)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateTextures);
+}
+void APIENTRY glCreateTransformFeedbacks(GLsizei n, GLuint * ids)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateTransformFeedbacks);
+}
+void APIENTRY glCreateVertexArrays(GLsizei n, GLuint * arrays)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCreateVertexArrays);
+}
+void APIENTRY glCullFace(GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCullFace);
+}
+void APIENTRY glCullParameterdvEXT(GLenum pname, GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCullParameterdvEXT);
+}
+void APIENTRY glCullParameterfvEXT(GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCullParameterfvEXT);
+}
+void APIENTRY glCurrentPaletteMatrixARB(GLint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glCurrentPaletteMatrixARB);
+}
+void APIENTRY glDebugMessageCallback(GLDEBUGPROC callback, const void * userParam)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDebugMessageCallback);
+}
+void APIENTRY glDebugMessageCallbackAMD(GLDEBUGPROCAMD callback, void * userParam)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDebugMessageCallbackAMD);
+}
+void APIENTRY glDebugMessageCallbackARB(GLDEBUGPROCARB callback, const void * userParam)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDebugMessageCallbackARB);
+}
+void APIENTRY glDebugMessageCallbackKHR(GLDEBUGPROCKHR callback, const void * userParam)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDebugMessageCallbackKHR);
+}
+void APIENTRY glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint * ids, GLboolean enabled)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDebugMessageControl);
+}
+void APIENTRY glDebugMessageControlARB(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint * ids, GLboolean enabled)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDebugMessageControlARB);
+}
+void APIENTRY glDebugMessageControlKHR(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint * ids, GLboolean enabled)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDebugMessageControlKHR);
+}
+void APIENTRY glDebugMessageEnableAMD(GLenum category, GLenum severity, GLsizei count, const GLuint * ids, GLboolean enabled)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDebugMessageEnableAMD);
+}
+void APIENTRY glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar * buf)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDebugMessageInsert);
+}
+void APIENTRY glDebugMessageInsertAMD(GLenum category, GLenum severity, GLuint id, GLsizei length, const GLchar * buf)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDebugMessageInsertAMD);
+}
+void APIENTRY glDebugMessageInsertARB(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar * buf)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDebugMessageInsertARB);
+}
+void APIENTRY glDebugMessageInsertKHR(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar * buf)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDebugMessageInsertKHR);
+}
+void APIENTRY glDeformSGIX(GLbitfield mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeformSGIX);
+}
+void APIENTRY glDeformationMap3dSGIX(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, GLdouble w1, GLdouble w2, GLint wstride, GLint worder, const GLdouble * points)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeformationMap3dSGIX);
+}
+void APIENTRY glDeformationMap3fSGIX(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, GLfloat w1, GLfloat w2, GLint wstride, GLint worder, const GLfloat * points)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeformationMap3fSGIX);
+}
+void APIENTRY glDeleteAsyncMarkersSGIX(GLuint marker, GLsizei range)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteAsyncMarkersSGIX);
+}
+void APIENTRY glDeleteBuffers(GLsizei n, const GLuint * buffers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteBuffers);
+}
+void APIENTRY glDeleteBuffersARB(GLsizei n, const GLuint * buffers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteBuffersARB);
+}
+void APIENTRY glDeleteCommandListsNV(GLsizei n, const GLuint * lists)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteCommandListsNV);
+}
+void APIENTRY glDeleteFencesAPPLE(GLsizei n, const GLuint * fences)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteFencesAPPLE);
+}
+void APIENTRY glDeleteFencesNV(GLsizei n, const GLuint * fences)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteFencesNV);
+}
+void APIENTRY glDeleteFragmentShaderATI(GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteFragmentShaderATI);
+}
+void APIENTRY glDeleteFramebuffers(GLsizei n, const GLuint * framebuffers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteFramebuffers);
+}
+void APIENTRY glDeleteFramebuffersEXT(GLsizei n, const GLuint * framebuffers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteFramebuffersEXT);
+}
+void APIENTRY glDeleteLists(GLuint list, GLsizei range)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteLists);
+}
+void APIENTRY glDeleteMemoryObjectsEXT(GLsizei n, const GLuint * memoryObjects)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteMemoryObjectsEXT);
+}
+void APIENTRY glDeleteNamedStringARB(GLint namelen, const GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteNamedStringARB);
+}
+void APIENTRY glDeleteNamesAMD(GLenum identifier, GLuint num, const GLuint * names)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteNamesAMD);
+}
+void APIENTRY glDeleteObjectARB(GLhandleARB obj)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteObjectARB);
+}
+void APIENTRY glDeleteOcclusionQueriesNV(GLsizei n, const GLuint * ids)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteOcclusionQueriesNV);
+}
+void APIENTRY glDeletePathsNV(GLuint path, GLsizei range)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeletePathsNV);
+}
+void APIENTRY glDeletePerfMonitorsAMD(GLsizei n, GLuint * monitors)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeletePerfMonitorsAMD);
+}
+void APIENTRY glDeletePerfQueryINTEL(GLuint queryHandle)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeletePerfQueryINTEL);
+}
+void APIENTRY glDeleteProgram(GLuint program)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteProgram);
+}
+void APIENTRY glDeleteProgramPipelines(GLsizei n, const GLuint * pipelines)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteProgramPipelines);
+}
+void APIENTRY glDeleteProgramPipelinesEXT(GLsizei n, const GLuint * pipelines)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteProgramPipelinesEXT);
+}
+void APIENTRY glDeleteProgramsARB(GLsizei n, const GLuint * programs)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteProgramsARB);
+}
+void APIENTRY glDeleteProgramsNV(GLsizei n, const GLuint * programs)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteProgramsNV);
+}
+void APIENTRY glDeleteQueries(GLsizei n, const GLuint * ids)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteQueries);
+}
+void APIENTRY glDeleteQueriesARB(GLsizei n, const GLuint * ids)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteQueriesARB);
+}
+void APIENTRY glDeleteQueryResourceTagNV(GLsizei n, const GLint * tagIds)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteQueryResourceTagNV);
+}
+void APIENTRY glDeleteRenderbuffers(GLsizei n, const GLuint * renderbuffers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteRenderbuffers);
+}
+void APIENTRY glDeleteRenderbuffersEXT(GLsizei n, const GLuint * renderbuffers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteRenderbuffersEXT);
+}
+void APIENTRY glDeleteSamplers(GLsizei count, const GLuint * samplers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteSamplers);
+}
+void APIENTRY glDeleteSemaphoresEXT(GLsizei n, const GLuint * semaphores)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteSemaphoresEXT);
+}
+void APIENTRY glDeleteShader(GLuint shader)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteShader);
+}
+void APIENTRY glDeleteStatesNV(GLsizei n, const GLuint * states)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteStatesNV);
+}
+void APIENTRY glDeleteSync(GLsync sync)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteSync);
+}
+void APIENTRY glDeleteTextures(GLsizei n, const GLuint * textures)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteTextures);
+}
+void APIENTRY glDeleteTexturesEXT(GLsizei n, const GLuint * textures)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteTexturesEXT);
+}
+void APIENTRY glDeleteTransformFeedbacks(GLsizei n, const GLuint * ids)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteTransformFeedbacks);
+}
+void APIENTRY glDeleteTransformFeedbacksNV(GLsizei n, const GLuint * ids)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteTransformFeedbacksNV);
+}
+void APIENTRY glDeleteVertexArrays(GLsizei n, const GLuint * arrays)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteVertexArrays);
+}
+void APIENTRY glDeleteVertexArraysAPPLE(GLsizei n, const GLuint * arrays)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteVertexArraysAPPLE);
+}
+void APIENTRY glDeleteVertexShaderEXT(GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDeleteVertexShaderEXT);
+}
+void APIENTRY glDepthBoundsEXT(GLclampd zmin, GLclampd zmax)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDepthBoundsEXT);
+}
+void APIENTRY glDepthBoundsdNV(GLdouble zmin, GLdouble zmax)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDepthBoundsdNV);
+}
+void APIENTRY glDepthFunc(GLenum func)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDepthFunc);
+}
+void APIENTRY glDepthMask(GLboolean flag)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDepthMask);
+}
+void APIENTRY glDepthRange(GLdouble n, GLdouble f)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDepthRange);
+}
+void APIENTRY glDepthRangeArraydvNV(GLuint first, GLsizei count, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDepthRangeArraydvNV);
+}
+void APIENTRY glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDepthRangeArrayv);
+}
+void APIENTRY glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDepthRangeIndexed);
+}
+void APIENTRY glDepthRangeIndexeddNV(GLuint index, GLdouble n, GLdouble f)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDepthRangeIndexeddNV);
+}
+void APIENTRY glDepthRangedNV(GLdouble zNear, GLdouble zFar)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDepthRangedNV);
+}
+void APIENTRY glDepthRangef(GLfloat n, GLfloat f)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDepthRangef);
+}
+void APIENTRY glDepthRangefOES(GLclampf n, GLclampf f)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDepthRangefOES);
+}
+void APIENTRY glDepthRangexOES(GLfixed n, GLfixed f)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDepthRangexOES);
+}
+void APIENTRY glDetachObjectARB(GLhandleARB containerObj, GLhandleARB attachedObj)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDetachObjectARB);
+}
+void APIENTRY glDetachShader(GLuint program, GLuint shader)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDetachShader);
+}
+void APIENTRY glDetailTexFuncSGIS(GLenum target, GLsizei n, const GLfloat * points)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDetailTexFuncSGIS);
+}
+void APIENTRY glDisable(GLenum cap)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDisable);
+}
+void APIENTRY glDisableClientState(GLenum array)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDisableClientState);
+}
+void APIENTRY glDisableClientStateIndexedEXT(GLenum array, GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDisableClientStateIndexedEXT);
+}
+void APIENTRY glDisableClientStateiEXT(GLenum array, GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDisableClientStateiEXT);
+}
+void APIENTRY glDisableIndexedEXT(GLenum target, GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDisableIndexedEXT);
+}
+void APIENTRY glDisableVariantClientStateEXT(GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDisableVariantClientStateEXT);
+}
+void APIENTRY glDisableVertexArrayAttrib(GLuint vaobj, GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDisableVertexArrayAttrib);
+}
+void APIENTRY glDisableVertexArrayAttribEXT(GLuint vaobj, GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDisableVertexArrayAttribEXT);
+}
+void APIENTRY glDisableVertexArrayEXT(GLuint vaobj, GLenum array)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDisableVertexArrayEXT);
+}
+void APIENTRY glDisableVertexAttribAPPLE(GLuint index, GLenum pname)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDisableVertexAttribAPPLE);
+}
+void APIENTRY glDisableVertexAttribArray(GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDisableVertexAttribArray);
+}
+void APIENTRY glDisableVertexAttribArrayARB(GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDisableVertexAttribArrayARB);
+}
+void APIENTRY glDisablei(GLenum target, GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDisablei);
+}
+void APIENTRY glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDispatchCompute);
+}
+void APIENTRY glDispatchComputeGroupSizeARB(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z, GLuint group_size_x, GLuint group_size_y, GLuint group_size_z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDispatchComputeGroupSizeARB);
+}
+void APIENTRY glDispatchComputeIndirect(GLintptr indirect)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDispatchComputeIndirect);
+}
+void APIENTRY glDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawArrays);
+}
+void APIENTRY glDrawArraysEXT(GLenum mode, GLint first, GLsizei count)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawArraysEXT);
+}
+void APIENTRY glDrawArraysIndirect(GLenum mode, const void * indirect)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawArraysIndirect);
+}
+void APIENTRY glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawArraysInstanced);
+}
+void APIENTRY glDrawArraysInstancedARB(GLenum mode, GLint first, GLsizei count, GLsizei primcount)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawArraysInstancedARB);
+}
+void APIENTRY glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawArraysInstancedBaseInstance);
+}
+void APIENTRY glDrawArraysInstancedEXT(GLenum mode, GLint start, GLsizei count, GLsizei primcount)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawArraysInstancedEXT);
+}
+void APIENTRY glDrawBuffer(GLenum buf)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawBuffer);
+}
+void APIENTRY glDrawBuffers(GLsizei n, const GLenum * bufs)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawBuffers);
+}
+void APIENTRY glDrawBuffersARB(GLsizei n, const GLenum * bufs)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawBuffersARB);
+}
+void APIENTRY glDrawBuffersATI(GLsizei n, const GLenum * bufs)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawBuffersATI);
+}
+void APIENTRY glDrawCommandsAddressNV(GLenum primitiveMode, const GLuint64 * indirects, const GLsizei * sizes, GLuint count)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawCommandsAddressNV);
+}
+void APIENTRY glDrawCommandsNV(GLenum primitiveMode, GLuint buffer, const GLintptr * indirects, const GLsizei * sizes, GLuint count)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawCommandsNV);
+}
+void APIENTRY glDrawCommandsStatesAddressNV(const GLuint64 * indirects, const GLsizei * sizes, const GLuint * states, const GLuint * fbos, GLuint count)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawCommandsStatesAddressNV);
+}
+void APIENTRY glDrawCommandsStatesNV(GLuint buffer, const GLintptr * indirects, const GLsizei * sizes, const GLuint * states, const GLuint * fbos, GLuint count)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawCommandsStatesNV);
+}
+void APIENTRY glDrawElementArrayAPPLE(GLenum mode, GLint first, GLsizei count)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawElementArrayAPPLE);
+}
+void APIENTRY glDrawElementArrayATI(GLenum mode, GLsizei count)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawElementArrayATI);
+}
+void APIENTRY glDrawElements(GLenum mode, GLsizei count, GLenum type, const void * indices)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawElements);
+}
+void APIENTRY glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void * indices, GLint basevertex)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawElementsBaseVertex);
+}
+void APIENTRY glDrawElementsIndirect(GLenum mode, GLenum type, const void * indirect)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawElementsIndirect);
+}
+void APIENTRY glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawElementsInstanced);
+}
+void APIENTRY glDrawElementsInstancedARB(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei primcount)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawElementsInstancedARB);
+}
+void APIENTRY glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLuint baseinstance)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawElementsInstancedBaseInstance);
+}
+void APIENTRY glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLint basevertex)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawElementsInstancedBaseVertex);
+}
+void APIENTRY glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawElementsInstancedBaseVertexBaseInstance);
+}
+void APIENTRY glDrawElementsInstancedEXT(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei primcount)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawElementsInstancedEXT);
+}
+void APIENTRY glDrawMeshArraysSUN(GLenum mode, GLint first, GLsizei count, GLsizei width)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawMeshArraysSUN);
+}
+void APIENTRY glDrawMeshTasksIndirectNV(GLintptr indirect)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawMeshTasksIndirectNV);
+}
+void APIENTRY glDrawMeshTasksNV(GLuint first, GLuint count)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawMeshTasksNV);
+}
+void APIENTRY glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawPixels);
+}
+void APIENTRY glDrawRangeElementArrayAPPLE(GLenum mode, GLuint start, GLuint end, GLint first, GLsizei count)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawRangeElementArrayAPPLE);
+}
+void APIENTRY glDrawRangeElementArrayATI(GLenum mode, GLuint start, GLuint end, GLsizei count)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawRangeElementArrayATI);
+}
+void APIENTRY glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawRangeElements);
+}
+void APIENTRY glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices, GLint basevertex)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawRangeElementsBaseVertex);
+}
+void APIENTRY glDrawRangeElementsEXT(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawRangeElementsEXT);
+}
+void APIENTRY glDrawTextureNV(GLuint texture, GLuint sampler, GLfloat x0, GLfloat y0, GLfloat x1, GLfloat y1, GLfloat z, GLfloat s0, GLfloat t0, GLfloat s1, GLfloat t1)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawTextureNV);
+}
+void APIENTRY glDrawTransformFeedback(GLenum mode, GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawTransformFeedback);
+}
+void APIENTRY glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawTransformFeedbackInstanced);
+}
+void APIENTRY glDrawTransformFeedbackNV(GLenum mode, GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawTransformFeedbackNV);
+}
+void APIENTRY glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawTransformFeedbackStream);
+}
+void APIENTRY glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawTransformFeedbackStreamInstanced);
+}
+void APIENTRY glDrawVkImageNV(GLuint64 vkImage, GLuint sampler, GLfloat x0, GLfloat y0, GLfloat x1, GLfloat y1, GLfloat z, GLfloat s0, GLfloat t0, GLfloat s1, GLfloat t1)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glDrawVkImageNV);
+}
+void APIENTRY glEGLImageTargetTexStorageEXT(GLenum target, GLeglImageOES image, const GLint* attrib_list)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEGLImageTargetTexStorageEXT);
+}
+void APIENTRY glEGLImageTargetTextureStorageEXT(GLuint texture, GLeglImageOES image, const GLint* attrib_list)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEGLImageTargetTextureStorageEXT);
+}
+void APIENTRY glEdgeFlag(GLboolean flag)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEdgeFlag);
+}
+void APIENTRY glEdgeFlagFormatNV(GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEdgeFlagFormatNV);
+}
+void APIENTRY glEdgeFlagPointer(GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEdgeFlagPointer);
+}
+void APIENTRY glEdgeFlagPointerEXT(GLsizei stride, GLsizei count, const GLboolean * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEdgeFlagPointerEXT);
+}
+void APIENTRY glEdgeFlagPointerListIBM(GLint stride, const GLboolean ** pointer, GLint ptrstride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEdgeFlagPointerListIBM);
+}
+void APIENTRY glEdgeFlagv(const GLboolean * flag)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEdgeFlagv);
+}
+void APIENTRY glElementPointerAPPLE(GLenum type, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glElementPointerAPPLE);
+}
+void APIENTRY glElementPointerATI(GLenum type, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glElementPointerATI);
+}
+void APIENTRY glEnable(GLenum cap)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEnable);
+}
+void APIENTRY glEnableClientState(GLenum array)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEnableClientState);
+}
+void APIENTRY glEnableClientStateIndexedEXT(GLenum array, GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEnableClientStateIndexedEXT);
+}
+void APIENTRY glEnableClientStateiEXT(GLenum array, GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEnableClientStateiEXT);
+}
+void APIENTRY glEnableIndexedEXT(GLenum target, GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEnableIndexedEXT);
+}
+void APIENTRY glEnableVariantClientStateEXT(GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEnableVariantClientStateEXT);
+}
+void APIENTRY glEnableVertexArrayAttrib(GLuint vaobj, GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEnableVertexArrayAttrib);
+}
+void APIENTRY glEnableVertexArrayAttribEXT(GLuint vaobj, GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEnableVertexArrayAttribEXT);
+}
+void APIENTRY glEnableVertexArrayEXT(GLuint vaobj, GLenum array)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEnableVertexArrayEXT);
+}
+void APIENTRY glEnableVertexAttribAPPLE(GLuint index, GLenum pname)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEnableVertexAttribAPPLE);
+}
+void APIENTRY glEnableVertexAttribArray(GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEnableVertexAttribArray);
+}
+void APIENTRY glEnableVertexAttribArrayARB(GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEnableVertexAttribArrayARB);
+}
+void APIENTRY glEnablei(GLenum target, GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEnablei);
+}
+void APIENTRY glEnd(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEnd);
+}
+void APIENTRY glEndConditionalRender(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEndConditionalRender);
+}
+void APIENTRY glEndConditionalRenderNV(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEndConditionalRenderNV);
+}
+void APIENTRY glEndConditionalRenderNVX(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEndConditionalRenderNVX);
+}
+void APIENTRY glEndFragmentShaderATI(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEndFragmentShaderATI);
+}
+void APIENTRY glEndList(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEndList);
+}
+void APIENTRY glEndOcclusionQueryNV(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEndOcclusionQueryNV);
+}
+void APIENTRY glEndPerfMonitorAMD(GLuint monitor)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEndPerfMonitorAMD);
+}
+void APIENTRY glEndPerfQueryINTEL(GLuint queryHandle)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEndPerfQueryINTEL);
+}
+void APIENTRY glEndQuery(GLenum target)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEndQuery);
+}
+void APIENTRY glEndQueryARB(GLenum target)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEndQueryARB);
+}
+void APIENTRY glEndQueryIndexed(GLenum target, GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEndQueryIndexed);
+}
+void APIENTRY glEndTransformFeedback(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEndTransformFeedback);
+}
+void APIENTRY glEndTransformFeedbackEXT(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEndTransformFeedbackEXT);
+}
+void APIENTRY glEndTransformFeedbackNV(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEndTransformFeedbackNV);
+}
+void APIENTRY glEndVertexShaderEXT(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEndVertexShaderEXT);
+}
+void APIENTRY glEndVideoCaptureNV(GLuint video_capture_slot)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEndVideoCaptureNV);
+}
+void APIENTRY glEvalCoord1d(GLdouble u)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEvalCoord1d);
+}
+void APIENTRY glEvalCoord1dv(const GLdouble * u)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEvalCoord1dv);
+}
+void APIENTRY glEvalCoord1f(GLfloat u)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEvalCoord1f);
+}
+void APIENTRY glEvalCoord1fv(const GLfloat * u)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEvalCoord1fv);
+}
+void APIENTRY glEvalCoord1xOES(GLfixed u)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEvalCoord1xOES);
+}
+void APIENTRY glEvalCoord1xvOES(const GLfixed * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEvalCoord1xvOES);
+}
+void APIENTRY glEvalCoord2d(GLdouble u, GLdouble v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEvalCoord2d);
+}
+void APIENTRY glEvalCoord2dv(const GLdouble * u)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEvalCoord2dv);
+}
+void APIENTRY glEvalCoord2f(GLfloat u, GLfloat v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEvalCoord2f);
+}
+void APIENTRY glEvalCoord2fv(const GLfloat * u)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEvalCoord2fv);
+}
+void APIENTRY glEvalCoord2xOES(GLfixed u, GLfixed v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEvalCoord2xOES);
+}
+void APIENTRY glEvalCoord2xvOES(const GLfixed * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEvalCoord2xvOES);
+}
+void APIENTRY glEvalMapsNV(GLenum target, GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEvalMapsNV);
+}
+void APIENTRY glEvalMesh1(GLenum mode, GLint i1, GLint i2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEvalMesh1);
+}
+void APIENTRY glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEvalMesh2);
+}
+void APIENTRY glEvalPoint1(GLint i)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEvalPoint1);
+}
+void APIENTRY glEvalPoint2(GLint i, GLint j)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEvalPoint2);
+}
+void APIENTRY glEvaluateDepthValuesARB(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glEvaluateDepthValuesARB);
+}
+void APIENTRY glExecuteProgramNV(GLenum target, GLuint id, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glExecuteProgramNV);
+}
+void APIENTRY glExtractComponentEXT(GLuint res, GLuint src, GLuint num)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glExtractComponentEXT);
+}
+void APIENTRY glFeedbackBuffer(GLsizei size, GLenum type, GLfloat * buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFeedbackBuffer);
+}
+void APIENTRY glFeedbackBufferxOES(GLsizei n, GLenum type, const GLfixed * buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFeedbackBufferxOES);
+}
+GLsync APIENTRY glFenceSync(GLenum condition, GLbitfield flags)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFenceSync);
+    return (GLsync)0;
+}
+void APIENTRY glFinalCombinerInputNV(GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFinalCombinerInputNV);
+}
+void APIENTRY glFinish(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFinish);
+}
+GLint APIENTRY glFinishAsyncSGIX(GLuint * markerp)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFinishAsyncSGIX);
+    return (GLint)0;
+}
+void APIENTRY glFinishFenceAPPLE(GLuint fence)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFinishFenceAPPLE);
+}
+void APIENTRY glFinishFenceNV(GLuint fence)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFinishFenceNV);
+}
+void APIENTRY glFinishObjectAPPLE(GLenum object, GLint name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFinishObjectAPPLE);
+}
+void APIENTRY glFinishTextureSUNX(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFinishTextureSUNX);
+}
+void APIENTRY glFlush(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFlush);
+}
+void APIENTRY glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFlushMappedBufferRange);
+}
+void APIENTRY glFlushMappedBufferRangeAPPLE(GLenum target, GLintptr offset, GLsizeiptr size)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFlushMappedBufferRangeAPPLE);
+}
+void APIENTRY glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFlushMappedNamedBufferRange);
+}
+void APIENTRY glFlushMappedNamedBufferRangeEXT(GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFlushMappedNamedBufferRangeEXT);
+}
+void APIENTRY glFlushPixelDataRangeNV(GLenum target)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFlushPixelDataRangeNV);
+}
+void APIENTRY glFlushRasterSGIX(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFlushRasterSGIX);
+}
+void APIENTRY glFlushStaticDataIBM(GLenum target)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFlushStaticDataIBM);
+}
+void APIENTRY glFlushVertexArrayRangeAPPLE(GLsizei length, void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFlushVertexArrayRangeAPPLE);
+}
+void APIENTRY glFlushVertexArrayRangeNV(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFlushVertexArrayRangeNV);
+}
+void APIENTRY glFogCoordFormatNV(GLenum type, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFogCoordFormatNV);
+}
+void APIENTRY glFogCoordPointer(GLenum type, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFogCoordPointer);
+}
+void APIENTRY glFogCoordPointerEXT(GLenum type, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFogCoordPointerEXT);
+}
+void APIENTRY glFogCoordPointerListIBM(GLenum type, GLint stride, const void ** pointer, GLint ptrstride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFogCoordPointerListIBM);
+}
+void APIENTRY glFogCoordd(GLdouble coord)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFogCoordd);
+}
+void APIENTRY glFogCoorddEXT(GLdouble coord)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFogCoorddEXT);
+}
+void APIENTRY glFogCoorddv(const GLdouble * coord)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFogCoorddv);
+}
+void APIENTRY glFogCoorddvEXT(const GLdouble * coord)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFogCoorddvEXT);
+}
+void APIENTRY glFogCoordf(GLfloat coord)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFogCoordf);
+}
+void APIENTRY glFogCoordfEXT(GLfloat coord)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFogCoordfEXT);
+}
+void APIENTRY glFogCoordfv(const GLfloat * coord)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFogCoordfv);
+}
+void APIENTRY glFogCoordfvEXT(const GLfloat * coord)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFogCoordfvEXT);
+}
+void APIENTRY glFogCoordhNV(GLhalfNV fog)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFogCoordhNV);
+}
+void APIENTRY glFogCoordhvNV(const GLhalfNV * fog)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFogCoordhvNV);
+}
+void APIENTRY glFogFuncSGIS(GLsizei n, const GLfloat * points)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFogFuncSGIS);
+}
+void APIENTRY glFogf(GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFogf);
+}
+void APIENTRY glFogfv(GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFogfv);
+}
+void APIENTRY glFogi(GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFogi);
+}
+void APIENTRY glFogiv(GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFogiv);
+}
+void APIENTRY glFogxOES(GLenum pname, GLfixed param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFogxOES);
+}
+void APIENTRY glFogxvOES(GLenum pname, const GLfixed * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFogxvOES);
+}
+void APIENTRY glFragmentColorMaterialSGIX(GLenum face, GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFragmentColorMaterialSGIX);
+}
+void APIENTRY glFragmentCoverageColorNV(GLuint color)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFragmentCoverageColorNV);
+}
+void APIENTRY glFragmentLightModelfSGIX(GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFragmentLightModelfSGIX);
+}
+void APIENTRY glFragmentLightModelfvSGIX(GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFragmentLightModelfvSGIX);
+}
+void APIENTRY glFragmentLightModeliSGIX(GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFragmentLightModeliSGIX);
+}
+void APIENTRY glFragmentLightModelivSGIX(GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFragmentLightModelivSGIX);
+}
+void APIENTRY glFragmentLightfSGIX(GLenum light, GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFragmentLightfSGIX);
+}
+void APIENTRY glFragmentLightfvSGIX(GLenum light, GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFragmentLightfvSGIX);
+}
+void APIENTRY glFragmentLightiSGIX(GLenum light, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFragmentLightiSGIX);
+}
+void APIENTRY glFragmentLightivSGIX(GLenum light, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFragmentLightivSGIX);
+}
+void APIENTRY glFragmentMaterialfSGIX(GLenum face, GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFragmentMaterialfSGIX);
+}
+void APIENTRY glFragmentMaterialfvSGIX(GLenum face, GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFragmentMaterialfvSGIX);
+}
+void APIENTRY glFragmentMaterialiSGIX(GLenum face, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFragmentMaterialiSGIX);
+}
+void APIENTRY glFragmentMaterialivSGIX(GLenum face, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFragmentMaterialivSGIX);
+}
+void APIENTRY glFrameTerminatorGREMEDY(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFrameTerminatorGREMEDY);
+}
+void APIENTRY glFrameZoomSGIX(GLint factor)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFrameZoomSGIX);
+}
+void APIENTRY glFramebufferDrawBufferEXT(GLuint framebuffer, GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferDrawBufferEXT);
+}
+void APIENTRY glFramebufferDrawBuffersEXT(GLuint framebuffer, GLsizei n, const GLenum * bufs)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferDrawBuffersEXT);
+}
+void APIENTRY glFramebufferFetchBarrierEXT(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferFetchBarrierEXT);
+}
+void APIENTRY glFramebufferParameteri(GLenum target, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferParameteri);
+}
+void APIENTRY glFramebufferParameteriMESA(GLenum target, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferParameteriMESA);
+}
+void APIENTRY glFramebufferReadBufferEXT(GLuint framebuffer, GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferReadBufferEXT);
+}
+void APIENTRY glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferRenderbuffer);
+}
+void APIENTRY glFramebufferRenderbufferEXT(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferRenderbufferEXT);
+}
+void APIENTRY glFramebufferSampleLocationsfvARB(GLenum target, GLuint start, GLsizei count, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferSampleLocationsfvARB);
+}
+void APIENTRY glFramebufferSampleLocationsfvNV(GLenum target, GLuint start, GLsizei count, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferSampleLocationsfvNV);
+}
+void APIENTRY glFramebufferSamplePositionsfvAMD(GLenum target, GLuint numsamples, GLuint pixelindex, const GLfloat * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferSamplePositionsfvAMD);
+}
+void APIENTRY glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferTexture);
+}
+void APIENTRY glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferTexture1D);
+}
+void APIENTRY glFramebufferTexture1DEXT(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferTexture1DEXT);
+}
+void APIENTRY glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferTexture2D);
+}
+void APIENTRY glFramebufferTexture2DEXT(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferTexture2DEXT);
+}
+void APIENTRY glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferTexture3D);
+}
+void APIENTRY glFramebufferTexture3DEXT(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferTexture3DEXT);
+}
+void APIENTRY glFramebufferTextureARB(GLenum target, GLenum attachment, GLuint texture, GLint level)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferTextureARB);
+}
+void APIENTRY glFramebufferTextureEXT(GLenum target, GLenum attachment, GLuint texture, GLint level)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferTextureEXT);
+}
+void APIENTRY glFramebufferTextureFaceARB(GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferTextureFaceARB);
+}
+void APIENTRY glFramebufferTextureFaceEXT(GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferTextureFaceEXT);
+}
+void APIENTRY glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferTextureLayer);
+}
+void APIENTRY glFramebufferTextureLayerARB(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferTextureLayerARB);
+}
+void APIENTRY glFramebufferTextureLayerEXT(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferTextureLayerEXT);
+}
+void APIENTRY glFramebufferTextureMultiviewOVR(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint baseViewIndex, GLsizei numViews)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFramebufferTextureMultiviewOVR);
+}
+void APIENTRY glFreeObjectBufferATI(GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFreeObjectBufferATI);
+}
+void APIENTRY glFrontFace(GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFrontFace);
+}
+void APIENTRY glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFrustum);
+}
+void APIENTRY glFrustumfOES(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFrustumfOES);
+}
+void APIENTRY glFrustumxOES(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, GLfixed f)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glFrustumxOES);
+}
+GLuint APIENTRY glGenAsyncMarkersSGIX(GLsizei range)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenAsyncMarkersSGIX);
+    return (GLuint)0;
+}
+void APIENTRY glGenBuffers(GLsizei n, GLuint * buffers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenBuffers);
+}
+void APIENTRY glGenBuffersARB(GLsizei n, GLuint * buffers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenBuffersARB);
+}
+void APIENTRY glGenFencesAPPLE(GLsizei n, GLuint * fences)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenFencesAPPLE);
+}
+void APIENTRY glGenFencesNV(GLsizei n, GLuint * fences)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenFencesNV);
+}
+GLuint APIENTRY glGenFragmentShadersATI(GLuint range)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenFragmentShadersATI);
+    return (GLuint)0;
+}
+void APIENTRY glGenFramebuffers(GLsizei n, GLuint * framebuffers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenFramebuffers);
+}
+void APIENTRY glGenFramebuffersEXT(GLsizei n, GLuint * framebuffers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenFramebuffersEXT);
+}
+GLuint APIENTRY glGenLists(GLsizei range)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenLists);
+    return (GLuint)0;
+}
+void APIENTRY glGenNamesAMD(GLenum identifier, GLuint num, GLuint * names)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenNamesAMD);
+}
+void APIENTRY glGenOcclusionQueriesNV(GLsizei n, GLuint * ids)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenOcclusionQueriesNV);
+}
+GLuint APIENTRY glGenPathsNV(GLsizei range)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenPathsNV);
+    return (GLuint)0;
+}
+void APIENTRY glGenPerfMonitorsAMD(GLsizei n, GLuint * monitors)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenPerfMonitorsAMD);
+}
+void APIENTRY glGenProgramPipelines(GLsizei n, GLuint * pipelines)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenProgramPipelines);
+}
+void APIENTRY glGenProgramPipelinesEXT(GLsizei n, GLuint * pipelines)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenProgramPipelinesEXT);
+}
+void APIENTRY glGenProgramsARB(GLsizei n, GLuint * programs)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenProgramsARB);
+}
+void APIENTRY glGenProgramsNV(GLsizei n, GLuint * programs)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenProgramsNV);
+}
+void APIENTRY glGenQueries(GLsizei n, GLuint * ids)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenQueries);
+}
+void APIENTRY glGenQueriesARB(GLsizei n, GLuint * ids)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenQueriesARB);
+}
+void APIENTRY glGenQueryResourceTagNV(GLsizei n, GLint * tagIds)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenQueryResourceTagNV);
+}
+void APIENTRY glGenRenderbuffers(GLsizei n, GLuint * renderbuffers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenRenderbuffers);
+}
+void APIENTRY glGenRenderbuffersEXT(GLsizei n, GLuint * renderbuffers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenRenderbuffersEXT);
+}
+void APIENTRY glGenSamplers(GLsizei count, GLuint * samplers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenSamplers);
+}
+void APIENTRY glGenSemaphoresEXT(GLsizei n, GLuint * semaphores)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenSemaphoresEXT);
+}
+GLuint APIENTRY glGenSymbolsEXT(GLenum datatype, GLenum storagetype, GLenum range, GLuint components)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenSymbolsEXT);
+    return (GLuint)0;
+}
+void APIENTRY glGenTextures(GLsizei n, GLuint * textures)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenTextures);
+}
+void APIENTRY glGenTexturesEXT(GLsizei n, GLuint * textures)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenTexturesEXT);
+}
+void APIENTRY glGenTransformFeedbacks(GLsizei n, GLuint * ids)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenTransformFeedbacks);
+}
+void APIENTRY glGenTransformFeedbacksNV(GLsizei n, GLuint * ids)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenTransformFeedbacksNV);
+}
+void APIENTRY glGenVertexArrays(GLsizei n, GLuint * arrays)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenVertexArrays);
+}
+void APIENTRY glGenVertexArraysAPPLE(GLsizei n, GLuint * arrays)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenVertexArraysAPPLE);
+}
+GLuint APIENTRY glGenVertexShadersEXT(GLuint range)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenVertexShadersEXT);
+    return (GLuint)0;
+}
+void APIENTRY glGenerateMipmap(GLenum target)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenerateMipmap);
+}
+void APIENTRY glGenerateMipmapEXT(GLenum target)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenerateMipmapEXT);
+}
+void APIENTRY glGenerateMultiTexMipmapEXT(GLenum texunit, GLenum target)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenerateMultiTexMipmapEXT);
+}
+void APIENTRY glGenerateTextureMipmap(GLuint texture)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenerateTextureMipmap);
+}
+void APIENTRY glGenerateTextureMipmapEXT(GLuint texture, GLenum target)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGenerateTextureMipmapEXT);
+}
+void APIENTRY glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetActiveAtomicCounterBufferiv);
+}
+void APIENTRY glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetActiveAttrib);
+}
+void APIENTRY glGetActiveAttribARB(GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei * length, GLint * size, GLenum * type, GLcharARB * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetActiveAttribARB);
+}
+void APIENTRY glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei * length, GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetActiveSubroutineName);
+}
+void APIENTRY glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei * length, GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetActiveSubroutineUniformName);
+}
+void APIENTRY glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetActiveSubroutineUniformiv);
+}
+void APIENTRY glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetActiveUniform);
+}
+void APIENTRY glGetActiveUniformARB(GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei * length, GLint * size, GLenum * type, GLcharARB * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetActiveUniformARB);
+}
+void APIENTRY glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformBlockName)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetActiveUniformBlockName);
+}
+void APIENTRY glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetActiveUniformBlockiv);
+}
+void APIENTRY glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformName)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetActiveUniformName);
+}
+void APIENTRY glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint * uniformIndices, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetActiveUniformsiv);
+}
+void APIENTRY glGetActiveVaryingNV(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLsizei * size, GLenum * type, GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetActiveVaryingNV);
+}
+void APIENTRY glGetArrayObjectfvATI(GLenum array, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetArrayObjectfvATI);
+}
+void APIENTRY glGetArrayObjectivATI(GLenum array, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetArrayObjectivATI);
+}
+void APIENTRY glGetAttachedObjectsARB(GLhandleARB containerObj, GLsizei maxCount, GLsizei * count, GLhandleARB * obj)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetAttachedObjectsARB);
+}
+void APIENTRY glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei * count, GLuint * shaders)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetAttachedShaders);
+}
+GLint APIENTRY glGetAttribLocation(GLuint program, const GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetAttribLocation);
+    return (GLint)0;
+}
+GLint APIENTRY glGetAttribLocationARB(GLhandleARB programObj, const GLcharARB * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetAttribLocationARB);
+    return (GLint)0;
+}
+void APIENTRY glGetBooleanIndexedvEXT(GLenum target, GLuint index, GLboolean * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetBooleanIndexedvEXT);
+}
+void APIENTRY glGetBooleani_v(GLenum target, GLuint index, GLboolean * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetBooleani_v);
+}
+void APIENTRY glGetBooleanv(GLenum pname, GLboolean * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetBooleanv);
+}
+void APIENTRY glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetBufferParameteri64v);
+}
+void APIENTRY glGetBufferParameteriv(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetBufferParameteriv);
+}
+void APIENTRY glGetBufferParameterivARB(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetBufferParameterivARB);
+}
+void APIENTRY glGetBufferParameterui64vNV(GLenum target, GLenum pname, GLuint64EXT * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetBufferParameterui64vNV);
+}
+void APIENTRY glGetBufferPointerv(GLenum target, GLenum pname, void ** params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetBufferPointerv);
+}
+void APIENTRY glGetBufferPointervARB(GLenum target, GLenum pname, void ** params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetBufferPointervARB);
+}
+void APIENTRY glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetBufferSubData);
+}
+void APIENTRY glGetBufferSubDataARB(GLenum target, GLintptrARB offset, GLsizeiptrARB size, void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetBufferSubDataARB);
+}
+void APIENTRY glGetClipPlane(GLenum plane, GLdouble * equation)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetClipPlane);
+}
+void APIENTRY glGetClipPlanefOES(GLenum plane, GLfloat * equation)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetClipPlanefOES);
+}
+void APIENTRY glGetClipPlanexOES(GLenum plane, GLfixed * equation)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetClipPlanexOES);
+}
+void APIENTRY glGetColorTable(GLenum target, GLenum format, GLenum type, void * table)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetColorTable);
+}
+void APIENTRY glGetColorTableEXT(GLenum target, GLenum format, GLenum type, void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetColorTableEXT);
+}
+void APIENTRY glGetColorTableParameterfv(GLenum target, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetColorTableParameterfv);
+}
+void APIENTRY glGetColorTableParameterfvEXT(GLenum target, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetColorTableParameterfvEXT);
+}
+void APIENTRY glGetColorTableParameterfvSGI(GLenum target, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetColorTableParameterfvSGI);
+}
+void APIENTRY glGetColorTableParameteriv(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetColorTableParameteriv);
+}
+void APIENTRY glGetColorTableParameterivEXT(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetColorTableParameterivEXT);
+}
+void APIENTRY glGetColorTableParameterivSGI(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetColorTableParameterivSGI);
+}
+void APIENTRY glGetColorTableSGI(GLenum target, GLenum format, GLenum type, void * table)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetColorTableSGI);
+}
+void APIENTRY glGetCombinerInputParameterfvNV(GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetCombinerInputParameterfvNV);
+}
+void APIENTRY glGetCombinerInputParameterivNV(GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetCombinerInputParameterivNV);
+}
+void APIENTRY glGetCombinerOutputParameterfvNV(GLenum stage, GLenum portion, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetCombinerOutputParameterfvNV);
+}
+void APIENTRY glGetCombinerOutputParameterivNV(GLenum stage, GLenum portion, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetCombinerOutputParameterivNV);
+}
+void APIENTRY glGetCombinerStageParameterfvNV(GLenum stage, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetCombinerStageParameterfvNV);
+}
+GLuint APIENTRY glGetCommandHeaderNV(GLenum tokenID, GLuint size)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetCommandHeaderNV);
+    return (GLuint)0;
+}
+void APIENTRY glGetCompressedMultiTexImageEXT(GLenum texunit, GLenum target, GLint lod, void * img)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetCompressedMultiTexImageEXT);
+}
+void APIENTRY glGetCompressedTexImage(GLenum target, GLint level, void * img)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetCompressedTexImage);
+}
+void APIENTRY glGetCompressedTexImageARB(GLenum target, GLint level, void * img)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetCompressedTexImageARB);
+}
+void APIENTRY glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetCompressedTextureImage);
+}
+void APIENTRY glGetCompressedTextureImageEXT(GLuint texture, GLenum target, GLint lod, void * img)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetCompressedTextureImageEXT);
+}
+void APIENTRY glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetCompressedTextureSubImage);
+}
+void APIENTRY glGetConvolutionFilter(GLenum target, GLenum format, GLenum type, void * image)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetConvolutionFilter);
+}
+void APIENTRY glGetConvolutionFilterEXT(GLenum target, GLenum format, GLenum type, void * image)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetConvolutionFilterEXT);
+}
+void APIENTRY glGetConvolutionParameterfv(GLenum target, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetConvolutionParameterfv);
+}
+void APIENTRY glGetConvolutionParameterfvEXT(GLenum target, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetConvolutionParameterfvEXT);
+}
+void APIENTRY glGetConvolutionParameteriv(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetConvolutionParameteriv);
+}
+void APIENTRY glGetConvolutionParameterivEXT(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetConvolutionParameterivEXT);
+}
+void APIENTRY glGetConvolutionParameterxvOES(GLenum target, GLenum pname, GLfixed * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetConvolutionParameterxvOES);
+}
+void APIENTRY glGetCoverageModulationTableNV(GLsizei bufSize, GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetCoverageModulationTableNV);
+}
+GLuint APIENTRY glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum * sources, GLenum * types, GLuint * ids, GLenum * severities, GLsizei * lengths, GLchar * messageLog)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetDebugMessageLog);
+    return (GLuint)0;
+}
+GLuint APIENTRY glGetDebugMessageLogAMD(GLuint count, GLsizei bufSize, GLenum * categories, GLuint * severities, GLuint * ids, GLsizei * lengths, GLchar * message)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetDebugMessageLogAMD);
+    return (GLuint)0;
+}
+GLuint APIENTRY glGetDebugMessageLogARB(GLuint count, GLsizei bufSize, GLenum * sources, GLenum * types, GLuint * ids, GLenum * severities, GLsizei * lengths, GLchar * messageLog)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetDebugMessageLogARB);
+    return (GLuint)0;
+}
+GLuint APIENTRY glGetDebugMessageLogKHR(GLuint count, GLsizei bufSize, GLenum * sources, GLenum * types, GLuint * ids, GLenum * severities, GLsizei * lengths, GLchar * messageLog)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetDebugMessageLogKHR);
+    return (GLuint)0;
+}
+void APIENTRY glGetDetailTexFuncSGIS(GLenum target, GLfloat * points)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetDetailTexFuncSGIS);
+}
+void APIENTRY glGetDoubleIndexedvEXT(GLenum target, GLuint index, GLdouble * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetDoubleIndexedvEXT);
+}
+void APIENTRY glGetDoublei_v(GLenum target, GLuint index, GLdouble * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetDoublei_v);
+}
+void APIENTRY glGetDoublei_vEXT(GLenum pname, GLuint index, GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetDoublei_vEXT);
+}
+void APIENTRY glGetDoublev(GLenum pname, GLdouble * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetDoublev);
+}
+GLenum APIENTRY glGetError(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetError);
+    return (GLenum)0;
+}
+void APIENTRY glGetFenceivNV(GLuint fence, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFenceivNV);
+}
+void APIENTRY glGetFinalCombinerInputParameterfvNV(GLenum variable, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFinalCombinerInputParameterfvNV);
+}
+void APIENTRY glGetFinalCombinerInputParameterivNV(GLenum variable, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFinalCombinerInputParameterivNV);
+}
+void APIENTRY glGetFirstPerfQueryIdINTEL(GLuint * queryId)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFirstPerfQueryIdINTEL);
+}
+void APIENTRY glGetFixedvOES(GLenum pname, GLfixed * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFixedvOES);
+}
+void APIENTRY glGetFloatIndexedvEXT(GLenum target, GLuint index, GLfloat * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFloatIndexedvEXT);
+}
+void APIENTRY glGetFloati_v(GLenum target, GLuint index, GLfloat * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFloati_v);
+}
+void APIENTRY glGetFloati_vEXT(GLenum pname, GLuint index, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFloati_vEXT);
+}
+void APIENTRY glGetFloatv(GLenum pname, GLfloat * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFloatv);
+}
+void APIENTRY glGetFogFuncSGIS(GLfloat * points)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFogFuncSGIS);
+}
+GLint APIENTRY glGetFragDataIndex(GLuint program, const GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFragDataIndex);
+    return (GLint)0;
+}
+GLint APIENTRY glGetFragDataLocation(GLuint program, const GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFragDataLocation);
+    return (GLint)0;
+}
+GLint APIENTRY glGetFragDataLocationEXT(GLuint program, const GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFragDataLocationEXT);
+    return (GLint)0;
+}
+void APIENTRY glGetFragmentLightfvSGIX(GLenum light, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFragmentLightfvSGIX);
+}
+void APIENTRY glGetFragmentLightivSGIX(GLenum light, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFragmentLightivSGIX);
+}
+void APIENTRY glGetFragmentMaterialfvSGIX(GLenum face, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFragmentMaterialfvSGIX);
+}
+void APIENTRY glGetFragmentMaterialivSGIX(GLenum face, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFragmentMaterialivSGIX);
+}
+void APIENTRY glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFramebufferAttachmentParameteriv);
+}
+void APIENTRY glGetFramebufferAttachmentParameterivEXT(GLenum target, GLenum attachment, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFramebufferAttachmentParameterivEXT);
+}
+void APIENTRY glGetFramebufferParameterfvAMD(GLenum target, GLenum pname, GLuint numsamples, GLuint pixelindex, GLsizei size, GLfloat * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFramebufferParameterfvAMD);
+}
+void APIENTRY glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFramebufferParameteriv);
+}
+void APIENTRY glGetFramebufferParameterivEXT(GLuint framebuffer, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFramebufferParameterivEXT);
+}
+void APIENTRY glGetFramebufferParameterivMESA(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetFramebufferParameterivMESA);
+}
+GLenum APIENTRY glGetGraphicsResetStatus(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetGraphicsResetStatus);
+    return (GLenum)0;
+}
+GLenum APIENTRY glGetGraphicsResetStatusARB(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetGraphicsResetStatusARB);
+    return (GLenum)0;
+}
+GLenum APIENTRY glGetGraphicsResetStatusKHR(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetGraphicsResetStatusKHR);
+    return (GLenum)0;
+}
+GLhandleARB APIENTRY glGetHandleARB(GLenum pname)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetHandleARB);
+    return (GLhandleARB)0;
+}
+void APIENTRY glGetHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, void * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetHistogram);
+}
+void APIENTRY glGetHistogramEXT(GLenum target, GLboolean reset, GLenum format, GLenum type, void * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetHistogramEXT);
+}
+void APIENTRY glGetHistogramParameterfv(GLenum target, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetHistogramParameterfv);
+}
+void APIENTRY glGetHistogramParameterfvEXT(GLenum target, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetHistogramParameterfvEXT);
+}
+void APIENTRY glGetHistogramParameteriv(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetHistogramParameteriv);
+}
+void APIENTRY glGetHistogramParameterivEXT(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetHistogramParameterivEXT);
+}
+void APIENTRY glGetHistogramParameterxvOES(GLenum target, GLenum pname, GLfixed * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetHistogramParameterxvOES);
+}
+GLuint64 APIENTRY glGetImageHandleARB(GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetImageHandleARB);
+    return (GLuint64)0;
+}
+GLuint64 APIENTRY glGetImageHandleNV(GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetImageHandleNV);
+    return (GLuint64)0;
+}
+void APIENTRY glGetImageTransformParameterfvHP(GLenum target, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetImageTransformParameterfvHP);
+}
+void APIENTRY glGetImageTransformParameterivHP(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetImageTransformParameterivHP);
+}
+void APIENTRY glGetInfoLogARB(GLhandleARB obj, GLsizei maxLength, GLsizei * length, GLcharARB * infoLog)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetInfoLogARB);
+}
+GLint APIENTRY glGetInstrumentsSGIX(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetInstrumentsSGIX);
+    return (GLint)0;
+}
+void APIENTRY glGetInteger64i_v(GLenum target, GLuint index, GLint64 * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetInteger64i_v);
+}
+void APIENTRY glGetInteger64v(GLenum pname, GLint64 * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetInteger64v);
+}
+void APIENTRY glGetIntegerIndexedvEXT(GLenum target, GLuint index, GLint * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetIntegerIndexedvEXT);
+}
+void APIENTRY glGetIntegeri_v(GLenum target, GLuint index, GLint * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetIntegeri_v);
+}
+void APIENTRY glGetIntegerui64i_vNV(GLenum value, GLuint index, GLuint64EXT * result)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetIntegerui64i_vNV);
+}
+void APIENTRY glGetIntegerui64vNV(GLenum value, GLuint64EXT * result)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetIntegerui64vNV);
+}
+void APIENTRY glGetInternalformatSampleivNV(GLenum target, GLenum internalformat, GLsizei samples, GLenum pname, GLsizei count, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetInternalformatSampleivNV);
+}
+void APIENTRY glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetInternalformati64v);
+}
+void APIENTRY glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetInternalformativ);
+}
+void APIENTRY glGetInvariantBooleanvEXT(GLuint id, GLenum value, GLboolean * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetInvariantBooleanvEXT);
+}
+void APIENTRY glGetInvariantFloatvEXT(GLuint id, GLenum value, GLfloat * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetInvariantFloatvEXT);
+}
+void APIENTRY glGetInvariantIntegervEXT(GLuint id, GLenum value, GLint * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetInvariantIntegervEXT);
+}
+void APIENTRY glGetLightfv(GLenum light, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetLightfv);
+}
+void APIENTRY glGetLightiv(GLenum light, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetLightiv);
+}
+void APIENTRY glGetLightxOES(GLenum light, GLenum pname, GLfixed * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetLightxOES);
+}
+void APIENTRY glGetLightxvOES(GLenum light, GLenum pname, GLfixed * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetLightxvOES);
+}
+void APIENTRY glGetListParameterfvSGIX(GLuint list, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetListParameterfvSGIX);
+}
+void APIENTRY glGetListParameterivSGIX(GLuint list, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetListParameterivSGIX);
+}
+void APIENTRY glGetLocalConstantBooleanvEXT(GLuint id, GLenum value, GLboolean * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetLocalConstantBooleanvEXT);
+}
+void APIENTRY glGetLocalConstantFloatvEXT(GLuint id, GLenum value, GLfloat * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetLocalConstantFloatvEXT);
+}
+void APIENTRY glGetLocalConstantIntegervEXT(GLuint id, GLenum value, GLint * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetLocalConstantIntegervEXT);
+}
+void APIENTRY glGetMapAttribParameterfvNV(GLenum target, GLuint index, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMapAttribParameterfvNV);
+}
+void APIENTRY glGetMapAttribParameterivNV(GLenum target, GLuint index, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMapAttribParameterivNV);
+}
+void APIENTRY glGetMapControlPointsNV(GLenum target, GLuint index, GLenum type, GLsizei ustride, GLsizei vstride, GLboolean packed, void * points)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMapControlPointsNV);
+}
+void APIENTRY glGetMapParameterfvNV(GLenum target, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMapParameterfvNV);
+}
+void APIENTRY glGetMapParameterivNV(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMapParameterivNV);
+}
+void APIENTRY glGetMapdv(GLenum target, GLenum query, GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMapdv);
+}
+void APIENTRY glGetMapfv(GLenum target, GLenum query, GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMapfv);
+}
+void APIENTRY glGetMapiv(GLenum target, GLenum query, GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMapiv);
+}
+void APIENTRY glGetMapxvOES(GLenum target, GLenum query, GLfixed * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMapxvOES);
+}
+void APIENTRY glGetMaterialfv(GLenum face, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMaterialfv);
+}
+void APIENTRY glGetMaterialiv(GLenum face, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMaterialiv);
+}
+void APIENTRY glGetMaterialxOES(GLenum face, GLenum pname, GLfixed param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMaterialxOES);
+}
+void APIENTRY glGetMaterialxvOES(GLenum face, GLenum pname, GLfixed * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMaterialxvOES);
+}
+void APIENTRY glGetMemoryObjectDetachedResourcesuivNV(GLuint memory, GLenum pname, GLint first, GLsizei count, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMemoryObjectDetachedResourcesuivNV);
+}
+void APIENTRY glGetMemoryObjectParameterivEXT(GLuint memoryObject, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMemoryObjectParameterivEXT);
+}
+void APIENTRY glGetMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, void * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMinmax);
+}
+void APIENTRY glGetMinmaxEXT(GLenum target, GLboolean reset, GLenum format, GLenum type, void * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMinmaxEXT);
+}
+void APIENTRY glGetMinmaxParameterfv(GLenum target, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMinmaxParameterfv);
+}
+void APIENTRY glGetMinmaxParameterfvEXT(GLenum target, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMinmaxParameterfvEXT);
+}
+void APIENTRY glGetMinmaxParameteriv(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMinmaxParameteriv);
+}
+void APIENTRY glGetMinmaxParameterivEXT(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMinmaxParameterivEXT);
+}
+void APIENTRY glGetMultiTexEnvfvEXT(GLenum texunit, GLenum target, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMultiTexEnvfvEXT);
+}
+void APIENTRY glGetMultiTexEnvivEXT(GLenum texunit, GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMultiTexEnvivEXT);
+}
+void APIENTRY glGetMultiTexGendvEXT(GLenum texunit, GLenum coord, GLenum pname, GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMultiTexGendvEXT);
+}
+void APIENTRY glGetMultiTexGenfvEXT(GLenum texunit, GLenum coord, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMultiTexGenfvEXT);
+}
+void APIENTRY glGetMultiTexGenivEXT(GLenum texunit, GLenum coord, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMultiTexGenivEXT);
+}
+void APIENTRY glGetMultiTexImageEXT(GLenum texunit, GLenum target, GLint level, GLenum format, GLenum type, void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMultiTexImageEXT);
+}
+void APIENTRY glGetMultiTexLevelParameterfvEXT(GLenum texunit, GLenum target, GLint level, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMultiTexLevelParameterfvEXT);
+}
+void APIENTRY glGetMultiTexLevelParameterivEXT(GLenum texunit, GLenum target, GLint level, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMultiTexLevelParameterivEXT);
+}
+void APIENTRY glGetMultiTexParameterIivEXT(GLenum texunit, GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMultiTexParameterIivEXT);
+}
+void APIENTRY glGetMultiTexParameterIuivEXT(GLenum texunit, GLenum target, GLenum pname, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMultiTexParameterIuivEXT);
+}
+void APIENTRY glGetMultiTexParameterfvEXT(GLenum texunit, GLenum target, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMultiTexParameterfvEXT);
+}
+void APIENTRY glGetMultiTexParameterivEXT(GLenum texunit, GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMultiTexParameterivEXT);
+}
+void APIENTRY glGetMultisamplefv(GLenum pname, GLuint index, GLfloat * val)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMultisamplefv);
+}
+void APIENTRY glGetMultisamplefvNV(GLenum pname, GLuint index, GLfloat * val)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetMultisamplefvNV);
+}
+void APIENTRY glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedBufferParameteri64v);
+}
+void APIENTRY glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedBufferParameteriv);
+}
+void APIENTRY glGetNamedBufferParameterivEXT(GLuint buffer, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedBufferParameterivEXT);
+}
+void APIENTRY glGetNamedBufferParameterui64vNV(GLuint buffer, GLenum pname, GLuint64EXT * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedBufferParameterui64vNV);
+}
+void APIENTRY glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void ** params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedBufferPointerv);
+}
+void APIENTRY glGetNamedBufferPointervEXT(GLuint buffer, GLenum pname, void ** params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedBufferPointervEXT);
+}
+void APIENTRY glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedBufferSubData);
+}
+void APIENTRY glGetNamedBufferSubDataEXT(GLuint buffer, GLintptr offset, GLsizeiptr size, void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedBufferSubDataEXT);
+}
+void APIENTRY glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedFramebufferAttachmentParameteriv);
+}
+void APIENTRY glGetNamedFramebufferAttachmentParameterivEXT(GLuint framebuffer, GLenum attachment, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedFramebufferAttachmentParameterivEXT);
+}
+void APIENTRY glGetNamedFramebufferParameterfvAMD(GLuint framebuffer, GLenum pname, GLuint numsamples, GLuint pixelindex, GLsizei size, GLfloat * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedFramebufferParameterfvAMD);
+}
+void APIENTRY glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedFramebufferParameteriv);
+}
+void APIENTRY glGetNamedFramebufferParameterivEXT(GLuint framebuffer, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedFramebufferParameterivEXT);
+}
+void APIENTRY glGetNamedProgramLocalParameterIivEXT(GLuint program, GLenum target, GLuint index, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedProgramLocalParameterIivEXT);
+}
+void APIENTRY glGetNamedProgramLocalParameterIuivEXT(GLuint program, GLenum target, GLuint index, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedProgramLocalParameterIuivEXT);
+}
+void APIENTRY glGetNamedProgramLocalParameterdvEXT(GLuint program, GLenum target, GLuint index, GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedProgramLocalParameterdvEXT);
+}
+void APIENTRY glGetNamedProgramLocalParameterfvEXT(GLuint program, GLenum target, GLuint index, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedProgramLocalParameterfvEXT);
+}
+void APIENTRY glGetNamedProgramStringEXT(GLuint program, GLenum target, GLenum pname, void * string)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedProgramStringEXT);
+}
+void APIENTRY glGetNamedProgramivEXT(GLuint program, GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedProgramivEXT);
+}
+void APIENTRY glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedRenderbufferParameteriv);
+}
+void APIENTRY glGetNamedRenderbufferParameterivEXT(GLuint renderbuffer, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedRenderbufferParameterivEXT);
+}
+void APIENTRY glGetNamedStringARB(GLint namelen, const GLchar * name, GLsizei bufSize, GLint * stringlen, GLchar * string)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedStringARB);
+}
+void APIENTRY glGetNamedStringivARB(GLint namelen, const GLchar * name, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNamedStringivARB);
+}
+void APIENTRY glGetNextPerfQueryIdINTEL(GLuint queryId, GLuint * nextQueryId)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetNextPerfQueryIdINTEL);
+}
+void APIENTRY glGetObjectBufferfvATI(GLuint buffer, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetObjectBufferfvATI);
+}
+void APIENTRY glGetObjectBufferivATI(GLuint buffer, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetObjectBufferivATI);
+}
+void APIENTRY glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei * length, GLchar * label)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetObjectLabel);
+}
+void APIENTRY glGetObjectLabelEXT(GLenum type, GLuint object, GLsizei bufSize, GLsizei * length, GLchar * label)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetObjectLabelEXT);
+}
+void APIENTRY glGetObjectLabelKHR(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei * length, GLchar * label)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetObjectLabelKHR);
+}
+void APIENTRY glGetObjectParameterfvARB(GLhandleARB obj, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetObjectParameterfvARB);
+}
+void APIENTRY glGetObjectParameterivAPPLE(GLenum objectType, GLuint name, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetObjectParameterivAPPLE);
+}
+void APIENTRY glGetObjectParameterivARB(GLhandleARB obj, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetObjectParameterivARB);
+}
+void APIENTRY glGetObjectPtrLabel(const void * ptr, GLsizei bufSize, GLsizei * length, GLchar * label)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetObjectPtrLabel);
+}
+void APIENTRY glGetObjectPtrLabelKHR(const void * ptr, GLsizei bufSize, GLsizei * length, GLchar * label)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetObjectPtrLabelKHR);
+}
+void APIENTRY glGetOcclusionQueryivNV(GLuint id, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetOcclusionQueryivNV);
+}
+void APIENTRY glGetOcclusionQueryuivNV(GLuint id, GLenum pname, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetOcclusionQueryuivNV);
+}
+void APIENTRY glGetPathColorGenfvNV(GLenum color, GLenum pname, GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPathColorGenfvNV);
+}
+void APIENTRY glGetPathColorGenivNV(GLenum color, GLenum pname, GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPathColorGenivNV);
+}
+void APIENTRY glGetPathCommandsNV(GLuint path, GLubyte * commands)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPathCommandsNV);
+}
+void APIENTRY glGetPathCoordsNV(GLuint path, GLfloat * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPathCoordsNV);
+}
+void APIENTRY glGetPathDashArrayNV(GLuint path, GLfloat * dashArray)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPathDashArrayNV);
+}
+GLfloat APIENTRY glGetPathLengthNV(GLuint path, GLsizei startSegment, GLsizei numSegments)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPathLengthNV);
+    return (GLfloat)0;
+}
+void APIENTRY glGetPathMetricRangeNV(GLbitfield metricQueryMask, GLuint firstPathName, GLsizei numPaths, GLsizei stride, GLfloat * metrics)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPathMetricRangeNV);
+}
+void APIENTRY glGetPathMetricsNV(GLbitfield metricQueryMask, GLsizei numPaths, GLenum pathNameType, const void * paths, GLuint pathBase, GLsizei stride, GLfloat * metrics)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPathMetricsNV);
+}
+void APIENTRY glGetPathParameterfvNV(GLuint path, GLenum pname, GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPathParameterfvNV);
+}
+void APIENTRY glGetPathParameterivNV(GLuint path, GLenum pname, GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPathParameterivNV);
+}
+void APIENTRY glGetPathSpacingNV(GLenum pathListMode, GLsizei numPaths, GLenum pathNameType, const void * paths, GLuint pathBase, GLfloat advanceScale, GLfloat kerningScale, GLenum transformType, GLfloat * returnedSpacing)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPathSpacingNV);
+}
+void APIENTRY glGetPathTexGenfvNV(GLenum texCoordSet, GLenum pname, GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPathTexGenfvNV);
+}
+void APIENTRY glGetPathTexGenivNV(GLenum texCoordSet, GLenum pname, GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPathTexGenivNV);
+}
+void APIENTRY glGetPerfCounterInfoINTEL(GLuint queryId, GLuint counterId, GLuint counterNameLength, GLchar * counterName, GLuint counterDescLength, GLchar * counterDesc, GLuint * counterOffset, GLuint * counterDataSize, GLuint * counterTypeEnum, GLuint * counterDataTypeEnum, GLuint64 * rawCounterMaxValue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPerfCounterInfoINTEL);
+}
+void APIENTRY glGetPerfMonitorCounterDataAMD(GLuint monitor, GLenum pname, GLsizei dataSize, GLuint * data, GLint * bytesWritten)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPerfMonitorCounterDataAMD);
+}
+void APIENTRY glGetPerfMonitorCounterInfoAMD(GLuint group, GLuint counter, GLenum pname, void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPerfMonitorCounterInfoAMD);
+}
+void APIENTRY glGetPerfMonitorCounterStringAMD(GLuint group, GLuint counter, GLsizei bufSize, GLsizei * length, GLchar * counterString)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPerfMonitorCounterStringAMD);
+}
+void APIENTRY glGetPerfMonitorCountersAMD(GLuint group, GLint * numCounters, GLint * maxActiveCounters, GLsizei counterSize, GLuint * counters)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPerfMonitorCountersAMD);
+}
+void APIENTRY glGetPerfMonitorGroupStringAMD(GLuint group, GLsizei bufSize, GLsizei * length, GLchar * groupString)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPerfMonitorGroupStringAMD);
+}
+void APIENTRY glGetPerfMonitorGroupsAMD(GLint * numGroups, GLsizei groupsSize, GLuint * groups)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPerfMonitorGroupsAMD);
+}
+void APIENTRY glGetPerfQueryDataINTEL(GLuint queryHandle, GLuint flags, GLsizei dataSize, void * data, GLuint * bytesWritten)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPerfQueryDataINTEL);
+}
+void APIENTRY glGetPerfQueryIdByNameINTEL(GLchar * queryName, GLuint * queryId)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPerfQueryIdByNameINTEL);
+}
+void APIENTRY glGetPerfQueryInfoINTEL(GLuint queryId, GLuint queryNameLength, GLchar * queryName, GLuint * dataSize, GLuint * noCounters, GLuint * noInstances, GLuint * capsMask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPerfQueryInfoINTEL);
+}
+void APIENTRY glGetPixelMapfv(GLenum map, GLfloat * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPixelMapfv);
+}
+void APIENTRY glGetPixelMapuiv(GLenum map, GLuint * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPixelMapuiv);
+}
+void APIENTRY glGetPixelMapusv(GLenum map, GLushort * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPixelMapusv);
+}
+void APIENTRY glGetPixelMapxv(GLenum map, GLint size, GLfixed * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPixelMapxv);
+}
+void APIENTRY glGetPixelTexGenParameterfvSGIS(GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPixelTexGenParameterfvSGIS);
+}
+void APIENTRY glGetPixelTexGenParameterivSGIS(GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPixelTexGenParameterivSGIS);
+}
+void APIENTRY glGetPixelTransformParameterfvEXT(GLenum target, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPixelTransformParameterfvEXT);
+}
+void APIENTRY glGetPixelTransformParameterivEXT(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPixelTransformParameterivEXT);
+}
+void APIENTRY glGetPointerIndexedvEXT(GLenum target, GLuint index, void ** data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPointerIndexedvEXT);
+}
+void APIENTRY glGetPointeri_vEXT(GLenum pname, GLuint index, void ** params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPointeri_vEXT);
+}
+void APIENTRY glGetPointerv(GLenum pname, void ** params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPointerv);
+}
+void APIENTRY glGetPointervEXT(GLenum pname, void ** params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPointervEXT);
+}
+void APIENTRY glGetPointervKHR(GLenum pname, void ** params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPointervKHR);
+}
+void APIENTRY glGetPolygonStipple(GLubyte * mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetPolygonStipple);
+}
+void APIENTRY glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei * length, GLenum * binaryFormat, void * binary)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramBinary);
+}
+void APIENTRY glGetProgramEnvParameterIivNV(GLenum target, GLuint index, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramEnvParameterIivNV);
+}
+void APIENTRY glGetProgramEnvParameterIuivNV(GLenum target, GLuint index, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramEnvParameterIuivNV);
+}
+void APIENTRY glGetProgramEnvParameterdvARB(GLenum target, GLuint index, GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramEnvParameterdvARB);
+}
+void APIENTRY glGetProgramEnvParameterfvARB(GLenum target, GLuint index, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramEnvParameterfvARB);
+}
+void APIENTRY glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei * length, GLchar * infoLog)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramInfoLog);
+}
+void APIENTRY glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramInterfaceiv);
+}
+void APIENTRY glGetProgramLocalParameterIivNV(GLenum target, GLuint index, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramLocalParameterIivNV);
+}
+void APIENTRY glGetProgramLocalParameterIuivNV(GLenum target, GLuint index, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramLocalParameterIuivNV);
+}
+void APIENTRY glGetProgramLocalParameterdvARB(GLenum target, GLuint index, GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramLocalParameterdvARB);
+}
+void APIENTRY glGetProgramLocalParameterfvARB(GLenum target, GLuint index, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramLocalParameterfvARB);
+}
+void APIENTRY glGetProgramNamedParameterdvNV(GLuint id, GLsizei len, const GLubyte * name, GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramNamedParameterdvNV);
+}
+void APIENTRY glGetProgramNamedParameterfvNV(GLuint id, GLsizei len, const GLubyte * name, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramNamedParameterfvNV);
+}
+void APIENTRY glGetProgramParameterdvNV(GLenum target, GLuint index, GLenum pname, GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramParameterdvNV);
+}
+void APIENTRY glGetProgramParameterfvNV(GLenum target, GLuint index, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramParameterfvNV);
+}
+void APIENTRY glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei * length, GLchar * infoLog)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramPipelineInfoLog);
+}
+void APIENTRY glGetProgramPipelineInfoLogEXT(GLuint pipeline, GLsizei bufSize, GLsizei * length, GLchar * infoLog)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramPipelineInfoLogEXT);
+}
+void APIENTRY glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramPipelineiv);
+}
+void APIENTRY glGetProgramPipelineivEXT(GLuint pipeline, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramPipelineivEXT);
+}
+GLuint APIENTRY glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramResourceIndex);
+    return (GLuint)0;
+}
+GLint APIENTRY glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramResourceLocation);
+    return (GLint)0;
+}
+GLint APIENTRY glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramResourceLocationIndex);
+    return (GLint)0;
+}
+void APIENTRY glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei * length, GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramResourceName);
+}
+void APIENTRY glGetProgramResourcefvNV(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum * props, GLsizei count, GLsizei * length, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramResourcefvNV);
+}
+void APIENTRY glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum * props, GLsizei count, GLsizei * length, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramResourceiv);
+}
+void APIENTRY glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramStageiv);
+}
+void APIENTRY glGetProgramStringARB(GLenum target, GLenum pname, void * string)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramStringARB);
+}
+void APIENTRY glGetProgramStringNV(GLuint id, GLenum pname, GLubyte * program)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramStringNV);
+}
+void APIENTRY glGetProgramSubroutineParameteruivNV(GLenum target, GLuint index, GLuint * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramSubroutineParameteruivNV);
+}
+void APIENTRY glGetProgramiv(GLuint program, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramiv);
+}
+void APIENTRY glGetProgramivARB(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramivARB);
+}
+void APIENTRY glGetProgramivNV(GLuint id, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetProgramivNV);
+}
+void APIENTRY glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetQueryBufferObjecti64v);
+}
+void APIENTRY glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetQueryBufferObjectiv);
+}
+void APIENTRY glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetQueryBufferObjectui64v);
+}
+void APIENTRY glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetQueryBufferObjectuiv);
+}
+void APIENTRY glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetQueryIndexediv);
+}
+void APIENTRY glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetQueryObjecti64v);
+}
+void APIENTRY glGetQueryObjecti64vEXT(GLuint id, GLenum pname, GLint64 * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetQueryObjecti64vEXT);
+}
+void APIENTRY glGetQueryObjectiv(GLuint id, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetQueryObjectiv);
+}
+void APIENTRY glGetQueryObjectivARB(GLuint id, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetQueryObjectivARB);
+}
+void APIENTRY glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetQueryObjectui64v);
+}
+void APIENTRY glGetQueryObjectui64vEXT(GLuint id, GLenum pname, GLuint64 * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetQueryObjectui64vEXT);
+}
+void APIENTRY glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetQueryObjectuiv);
+}
+void APIENTRY glGetQueryObjectuivARB(GLuint id, GLenum pname, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetQueryObjectuivARB);
+}
+void APIENTRY glGetQueryiv(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetQueryiv);
+}
+void APIENTRY glGetQueryivARB(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetQueryivARB);
+}
+void APIENTRY glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetRenderbufferParameteriv);
+}
+void APIENTRY glGetRenderbufferParameterivEXT(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetRenderbufferParameterivEXT);
+}
+void APIENTRY glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetSamplerParameterIiv);
+}
+void APIENTRY glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetSamplerParameterIuiv);
+}
+void APIENTRY glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetSamplerParameterfv);
+}
+void APIENTRY glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetSamplerParameteriv);
+}
+void APIENTRY glGetSemaphoreParameterivNV(GLuint semaphore, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetSemaphoreParameterivNV);
+}
+void APIENTRY glGetSemaphoreParameterui64vEXT(GLuint semaphore, GLenum pname, GLuint64 * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetSemaphoreParameterui64vEXT);
+}
+void APIENTRY glGetSeparableFilter(GLenum target, GLenum format, GLenum type, void * row, void * column, void * span)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetSeparableFilter);
+}
+void APIENTRY glGetSeparableFilterEXT(GLenum target, GLenum format, GLenum type, void * row, void * column, void * span)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetSeparableFilterEXT);
+}
+void APIENTRY glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * infoLog)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetShaderInfoLog);
+}
+void APIENTRY glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint * range, GLint * precision)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetShaderPrecisionFormat);
+}
+void APIENTRY glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * source)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetShaderSource);
+}
+void APIENTRY glGetShaderSourceARB(GLhandleARB obj, GLsizei maxLength, GLsizei * length, GLcharARB * source)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetShaderSourceARB);
+}
+void APIENTRY glGetShaderiv(GLuint shader, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetShaderiv);
+}
+void APIENTRY glGetShadingRateImagePaletteNV(GLuint viewport, GLuint entry, GLenum * rate)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetShadingRateImagePaletteNV);
+}
+void APIENTRY glGetShadingRateSampleLocationivNV(GLenum rate, GLuint samples, GLuint index, GLint * location)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetShadingRateSampleLocationivNV);
+}
+void APIENTRY glGetSharpenTexFuncSGIS(GLenum target, GLfloat * points)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetSharpenTexFuncSGIS);
+}
+GLushort APIENTRY glGetStageIndexNV(GLenum shadertype)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetStageIndexNV);
+    return (GLushort)0;
+}
+GLuint APIENTRY glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetSubroutineIndex);
+    return (GLuint)0;
+}
+GLint APIENTRY glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetSubroutineUniformLocation);
+    return (GLint)0;
+}
+void APIENTRY glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei * length, GLint * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetSynciv);
+}
+void APIENTRY glGetTexBumpParameterfvATI(GLenum pname, GLfloat * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexBumpParameterfvATI);
+}
+void APIENTRY glGetTexBumpParameterivATI(GLenum pname, GLint * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexBumpParameterivATI);
+}
+void APIENTRY glGetTexEnvfv(GLenum target, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexEnvfv);
+}
+void APIENTRY glGetTexEnviv(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexEnviv);
+}
+void APIENTRY glGetTexEnvxvOES(GLenum target, GLenum pname, GLfixed * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexEnvxvOES);
+}
+void APIENTRY glGetTexFilterFuncSGIS(GLenum target, GLenum filter, GLfloat * weights)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexFilterFuncSGIS);
+}
+void APIENTRY glGetTexGendv(GLenum coord, GLenum pname, GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexGendv);
+}
+void APIENTRY glGetTexGenfv(GLenum coord, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexGenfv);
+}
+void APIENTRY glGetTexGeniv(GLenum coord, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexGeniv);
+}
+void APIENTRY glGetTexGenxvOES(GLenum coord, GLenum pname, GLfixed * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexGenxvOES);
+}
+void APIENTRY glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexImage);
+}
+void APIENTRY glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexLevelParameterfv);
+}
+void APIENTRY glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexLevelParameteriv);
+}
+void APIENTRY glGetTexLevelParameterxvOES(GLenum target, GLint level, GLenum pname, GLfixed * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexLevelParameterxvOES);
+}
+void APIENTRY glGetTexParameterIiv(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexParameterIiv);
+}
+void APIENTRY glGetTexParameterIivEXT(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexParameterIivEXT);
+}
+void APIENTRY glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexParameterIuiv);
+}
+void APIENTRY glGetTexParameterIuivEXT(GLenum target, GLenum pname, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexParameterIuivEXT);
+}
+void APIENTRY glGetTexParameterPointervAPPLE(GLenum target, GLenum pname, void ** params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexParameterPointervAPPLE);
+}
+void APIENTRY glGetTexParameterfv(GLenum target, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexParameterfv);
+}
+void APIENTRY glGetTexParameteriv(GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexParameteriv);
+}
+void APIENTRY glGetTexParameterxvOES(GLenum target, GLenum pname, GLfixed * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTexParameterxvOES);
+}
+GLuint64 APIENTRY glGetTextureHandleARB(GLuint texture)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTextureHandleARB);
+    return (GLuint64)0;
+}
+GLuint64 APIENTRY glGetTextureHandleNV(GLuint texture)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTextureHandleNV);
+    return (GLuint64)0;
+}
+void APIENTRY glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTextureImage);
+}
+void APIENTRY glGetTextureImageEXT(GLuint texture, GLenum target, GLint level, GLenum format, GLenum type, void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTextureImageEXT);
+}
+void APIENTRY glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTextureLevelParameterfv);
+}
+void APIENTRY glGetTextureLevelParameterfvEXT(GLuint texture, GLenum target, GLint level, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTextureLevelParameterfvEXT);
+}
+void APIENTRY glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTextureLevelParameteriv);
+}
+void APIENTRY glGetTextureLevelParameterivEXT(GLuint texture, GLenum target, GLint level, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTextureLevelParameterivEXT);
+}
+void APIENTRY glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTextureParameterIiv);
+}
+void APIENTRY glGetTextureParameterIivEXT(GLuint texture, GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTextureParameterIivEXT);
+}
+void APIENTRY glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTextureParameterIuiv);
+}
+void APIENTRY glGetTextureParameterIuivEXT(GLuint texture, GLenum target, GLenum pname, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTextureParameterIuivEXT);
+}
+void APIENTRY glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTextureParameterfv);
+}
+void APIENTRY glGetTextureParameterfvEXT(GLuint texture, GLenum target, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTextureParameterfvEXT);
+}
+void APIENTRY glGetTextureParameteriv(GLuint texture, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTextureParameteriv);
+}
+void APIENTRY glGetTextureParameterivEXT(GLuint texture, GLenum target, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTextureParameterivEXT);
+}
+GLuint64 APIENTRY glGetTextureSamplerHandleARB(GLuint texture, GLuint sampler)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTextureSamplerHandleARB);
+    return (GLuint64)0;
+}
+GLuint64 APIENTRY glGetTextureSamplerHandleNV(GLuint texture, GLuint sampler)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTextureSamplerHandleNV);
+    return (GLuint64)0;
+}
+void APIENTRY glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTextureSubImage);
+}
+void APIENTRY glGetTrackMatrixivNV(GLenum target, GLuint address, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTrackMatrixivNV);
+}
+void APIENTRY glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLsizei * size, GLenum * type, GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTransformFeedbackVarying);
+}
+void APIENTRY glGetTransformFeedbackVaryingEXT(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLsizei * size, GLenum * type, GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTransformFeedbackVaryingEXT);
+}
+void APIENTRY glGetTransformFeedbackVaryingNV(GLuint program, GLuint index, GLint * location)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTransformFeedbackVaryingNV);
+}
+void APIENTRY glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTransformFeedbacki64_v);
+}
+void APIENTRY glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTransformFeedbacki_v);
+}
+void APIENTRY glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetTransformFeedbackiv);
+}
+GLuint APIENTRY glGetUniformBlockIndex(GLuint program, const GLchar * uniformBlockName)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetUniformBlockIndex);
+    return (GLuint)0;
+}
+GLint APIENTRY glGetUniformBufferSizeEXT(GLuint program, GLint location)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetUniformBufferSizeEXT);
+    return (GLint)0;
+}
+void APIENTRY glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const* uniformNames, GLuint * uniformIndices)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetUniformIndices);
+}
+GLint APIENTRY glGetUniformLocation(GLuint program, const GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetUniformLocation);
+    return (GLint)0;
+}
+GLint APIENTRY glGetUniformLocationARB(GLhandleARB programObj, const GLcharARB * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetUniformLocationARB);
+    return (GLint)0;
+}
+GLintptr APIENTRY glGetUniformOffsetEXT(GLuint program, GLint location)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetUniformOffsetEXT);
+    return (GLintptr)0;
+}
+void APIENTRY glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetUniformSubroutineuiv);
+}
+void APIENTRY glGetUniformdv(GLuint program, GLint location, GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetUniformdv);
+}
+void APIENTRY glGetUniformfv(GLuint program, GLint location, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetUniformfv);
+}
+void APIENTRY glGetUniformfvARB(GLhandleARB programObj, GLint location, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetUniformfvARB);
+}
+void APIENTRY glGetUniformi64vARB(GLuint program, GLint location, GLint64 * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetUniformi64vARB);
+}
+void APIENTRY glGetUniformi64vNV(GLuint program, GLint location, GLint64EXT * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetUniformi64vNV);
+}
+void APIENTRY glGetUniformiv(GLuint program, GLint location, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetUniformiv);
+}
+void APIENTRY glGetUniformivARB(GLhandleARB programObj, GLint location, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetUniformivARB);
+}
+void APIENTRY glGetUniformui64vARB(GLuint program, GLint location, GLuint64 * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetUniformui64vARB);
+}
+void APIENTRY glGetUniformui64vNV(GLuint program, GLint location, GLuint64EXT * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetUniformui64vNV);
+}
+void APIENTRY glGetUniformuiv(GLuint program, GLint location, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetUniformuiv);
+}
+void APIENTRY glGetUniformuivEXT(GLuint program, GLint location, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetUniformuivEXT);
+}
+void APIENTRY glGetUnsignedBytei_vEXT(GLenum target, GLuint index, GLubyte * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetUnsignedBytei_vEXT);
+}
+void APIENTRY glGetUnsignedBytevEXT(GLenum pname, GLubyte * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetUnsignedBytevEXT);
+}
+void APIENTRY glGetVariantArrayObjectfvATI(GLuint id, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVariantArrayObjectfvATI);
+}
+void APIENTRY glGetVariantArrayObjectivATI(GLuint id, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVariantArrayObjectivATI);
+}
+void APIENTRY glGetVariantBooleanvEXT(GLuint id, GLenum value, GLboolean * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVariantBooleanvEXT);
+}
+void APIENTRY glGetVariantFloatvEXT(GLuint id, GLenum value, GLfloat * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVariantFloatvEXT);
+}
+void APIENTRY glGetVariantIntegervEXT(GLuint id, GLenum value, GLint * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVariantIntegervEXT);
+}
+void APIENTRY glGetVariantPointervEXT(GLuint id, GLenum value, void ** data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVariantPointervEXT);
+}
+GLint APIENTRY glGetVaryingLocationNV(GLuint program, const GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVaryingLocationNV);
+    return (GLint)0;
+}
+void APIENTRY glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexArrayIndexed64iv);
+}
+void APIENTRY glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexArrayIndexediv);
+}
+void APIENTRY glGetVertexArrayIntegeri_vEXT(GLuint vaobj, GLuint index, GLenum pname, GLint * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexArrayIntegeri_vEXT);
+}
+void APIENTRY glGetVertexArrayIntegervEXT(GLuint vaobj, GLenum pname, GLint * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexArrayIntegervEXT);
+}
+void APIENTRY glGetVertexArrayPointeri_vEXT(GLuint vaobj, GLuint index, GLenum pname, void ** param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexArrayPointeri_vEXT);
+}
+void APIENTRY glGetVertexArrayPointervEXT(GLuint vaobj, GLenum pname, void ** param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexArrayPointervEXT);
+}
+void APIENTRY glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexArrayiv);
+}
+void APIENTRY glGetVertexAttribArrayObjectfvATI(GLuint index, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribArrayObjectfvATI);
+}
+void APIENTRY glGetVertexAttribArrayObjectivATI(GLuint index, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribArrayObjectivATI);
+}
+void APIENTRY glGetVertexAttribIiv(GLuint index, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribIiv);
+}
+void APIENTRY glGetVertexAttribIivEXT(GLuint index, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribIivEXT);
+}
+void APIENTRY glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribIuiv);
+}
+void APIENTRY glGetVertexAttribIuivEXT(GLuint index, GLenum pname, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribIuivEXT);
+}
+void APIENTRY glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribLdv);
+}
+void APIENTRY glGetVertexAttribLdvEXT(GLuint index, GLenum pname, GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribLdvEXT);
+}
+void APIENTRY glGetVertexAttribLi64vNV(GLuint index, GLenum pname, GLint64EXT * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribLi64vNV);
+}
+void APIENTRY glGetVertexAttribLui64vARB(GLuint index, GLenum pname, GLuint64EXT * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribLui64vARB);
+}
+void APIENTRY glGetVertexAttribLui64vNV(GLuint index, GLenum pname, GLuint64EXT * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribLui64vNV);
+}
+void APIENTRY glGetVertexAttribPointerv(GLuint index, GLenum pname, void ** pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribPointerv);
+}
+void APIENTRY glGetVertexAttribPointervARB(GLuint index, GLenum pname, void ** pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribPointervARB);
+}
+void APIENTRY glGetVertexAttribPointervNV(GLuint index, GLenum pname, void ** pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribPointervNV);
+}
+void APIENTRY glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribdv);
+}
+void APIENTRY glGetVertexAttribdvARB(GLuint index, GLenum pname, GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribdvARB);
+}
+void APIENTRY glGetVertexAttribdvNV(GLuint index, GLenum pname, GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribdvNV);
+}
+void APIENTRY glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribfv);
+}
+void APIENTRY glGetVertexAttribfvARB(GLuint index, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribfvARB);
+}
+void APIENTRY glGetVertexAttribfvNV(GLuint index, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribfvNV);
+}
+void APIENTRY glGetVertexAttribiv(GLuint index, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribiv);
+}
+void APIENTRY glGetVertexAttribivARB(GLuint index, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribivARB);
+}
+void APIENTRY glGetVertexAttribivNV(GLuint index, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVertexAttribivNV);
+}
+void APIENTRY glGetVideoCaptureStreamdvNV(GLuint video_capture_slot, GLuint stream, GLenum pname, GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVideoCaptureStreamdvNV);
+}
+void APIENTRY glGetVideoCaptureStreamfvNV(GLuint video_capture_slot, GLuint stream, GLenum pname, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVideoCaptureStreamfvNV);
+}
+void APIENTRY glGetVideoCaptureStreamivNV(GLuint video_capture_slot, GLuint stream, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVideoCaptureStreamivNV);
+}
+void APIENTRY glGetVideoCaptureivNV(GLuint video_capture_slot, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVideoCaptureivNV);
+}
+void APIENTRY glGetVideoi64vNV(GLuint video_slot, GLenum pname, GLint64EXT * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVideoi64vNV);
+}
+void APIENTRY glGetVideoivNV(GLuint video_slot, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVideoivNV);
+}
+void APIENTRY glGetVideoui64vNV(GLuint video_slot, GLenum pname, GLuint64EXT * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVideoui64vNV);
+}
+void APIENTRY glGetVideouivNV(GLuint video_slot, GLenum pname, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVideouivNV);
+}
+GLVULKANPROCNV APIENTRY glGetVkProcAddrNV(const GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetVkProcAddrNV);
+    return (GLVULKANPROCNV)0;
+}
+void APIENTRY glGetnColorTable(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void * table)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnColorTable);
+}
+void APIENTRY glGetnColorTableARB(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void * table)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnColorTableARB);
+}
+void APIENTRY glGetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnCompressedTexImage);
+}
+void APIENTRY glGetnCompressedTexImageARB(GLenum target, GLint lod, GLsizei bufSize, void * img)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnCompressedTexImageARB);
+}
+void APIENTRY glGetnConvolutionFilter(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void * image)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnConvolutionFilter);
+}
+void APIENTRY glGetnConvolutionFilterARB(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void * image)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnConvolutionFilterARB);
+}
+void APIENTRY glGetnHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnHistogram);
+}
+void APIENTRY glGetnHistogramARB(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnHistogramARB);
+}
+void APIENTRY glGetnMapdv(GLenum target, GLenum query, GLsizei bufSize, GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnMapdv);
+}
+void APIENTRY glGetnMapdvARB(GLenum target, GLenum query, GLsizei bufSize, GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnMapdvARB);
+}
+void APIENTRY glGetnMapfv(GLenum target, GLenum query, GLsizei bufSize, GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnMapfv);
+}
+void APIENTRY glGetnMapfvARB(GLenum target, GLenum query, GLsizei bufSize, GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnMapfvARB);
+}
+void APIENTRY glGetnMapiv(GLenum target, GLenum query, GLsizei bufSize, GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnMapiv);
+}
+void APIENTRY glGetnMapivARB(GLenum target, GLenum query, GLsizei bufSize, GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnMapivARB);
+}
+void APIENTRY glGetnMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnMinmax);
+}
+void APIENTRY glGetnMinmaxARB(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnMinmaxARB);
+}
+void APIENTRY glGetnPixelMapfv(GLenum map, GLsizei bufSize, GLfloat * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnPixelMapfv);
+}
+void APIENTRY glGetnPixelMapfvARB(GLenum map, GLsizei bufSize, GLfloat * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnPixelMapfvARB);
+}
+void APIENTRY glGetnPixelMapuiv(GLenum map, GLsizei bufSize, GLuint * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnPixelMapuiv);
+}
+void APIENTRY glGetnPixelMapuivARB(GLenum map, GLsizei bufSize, GLuint * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnPixelMapuivARB);
+}
+void APIENTRY glGetnPixelMapusv(GLenum map, GLsizei bufSize, GLushort * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnPixelMapusv);
+}
+void APIENTRY glGetnPixelMapusvARB(GLenum map, GLsizei bufSize, GLushort * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnPixelMapusvARB);
+}
+void APIENTRY glGetnPolygonStipple(GLsizei bufSize, GLubyte * pattern)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnPolygonStipple);
+}
+void APIENTRY glGetnPolygonStippleARB(GLsizei bufSize, GLubyte * pattern)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnPolygonStippleARB);
+}
+void APIENTRY glGetnSeparableFilter(GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void * row, GLsizei columnBufSize, void * column, void * span)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnSeparableFilter);
+}
+void APIENTRY glGetnSeparableFilterARB(GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void * row, GLsizei columnBufSize, void * column, void * span)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnSeparableFilterARB);
+}
+void APIENTRY glGetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnTexImage);
+}
+void APIENTRY glGetnTexImageARB(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void * img)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnTexImageARB);
+}
+void APIENTRY glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnUniformdv);
+}
+void APIENTRY glGetnUniformdvARB(GLuint program, GLint location, GLsizei bufSize, GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnUniformdvARB);
+}
+void APIENTRY glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnUniformfv);
+}
+void APIENTRY glGetnUniformfvARB(GLuint program, GLint location, GLsizei bufSize, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnUniformfvARB);
+}
+void APIENTRY glGetnUniformfvKHR(GLuint program, GLint location, GLsizei bufSize, GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnUniformfvKHR);
+}
+void APIENTRY glGetnUniformi64vARB(GLuint program, GLint location, GLsizei bufSize, GLint64 * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnUniformi64vARB);
+}
+void APIENTRY glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnUniformiv);
+}
+void APIENTRY glGetnUniformivARB(GLuint program, GLint location, GLsizei bufSize, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnUniformivARB);
+}
+void APIENTRY glGetnUniformivKHR(GLuint program, GLint location, GLsizei bufSize, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnUniformivKHR);
+}
+void APIENTRY glGetnUniformui64vARB(GLuint program, GLint location, GLsizei bufSize, GLuint64 * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnUniformui64vARB);
+}
+void APIENTRY glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnUniformuiv);
+}
+void APIENTRY glGetnUniformuivARB(GLuint program, GLint location, GLsizei bufSize, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnUniformuivARB);
+}
+void APIENTRY glGetnUniformuivKHR(GLuint program, GLint location, GLsizei bufSize, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGetnUniformuivKHR);
+}
+void APIENTRY glGlobalAlphaFactorbSUN(GLbyte factor)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGlobalAlphaFactorbSUN);
+}
+void APIENTRY glGlobalAlphaFactordSUN(GLdouble factor)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGlobalAlphaFactordSUN);
+}
+void APIENTRY glGlobalAlphaFactorfSUN(GLfloat factor)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGlobalAlphaFactorfSUN);
+}
+void APIENTRY glGlobalAlphaFactoriSUN(GLint factor)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGlobalAlphaFactoriSUN);
+}
+void APIENTRY glGlobalAlphaFactorsSUN(GLshort factor)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGlobalAlphaFactorsSUN);
+}
+void APIENTRY glGlobalAlphaFactorubSUN(GLubyte factor)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGlobalAlphaFactorubSUN);
+}
+void APIENTRY glGlobalAlphaFactoruiSUN(GLuint factor)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGlobalAlphaFactoruiSUN);
+}
+void APIENTRY glGlobalAlphaFactorusSUN(GLushort factor)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glGlobalAlphaFactorusSUN);
+}
+void APIENTRY glHint(GLenum target, GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glHint);
+}
+void APIENTRY glHintPGI(GLenum target, GLint mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glHintPGI);
+}
+void APIENTRY glHistogram(GLenum target, GLsizei width, GLenum internalformat, GLboolean sink)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glHistogram);
+}
+void APIENTRY glHistogramEXT(GLenum target, GLsizei width, GLenum internalformat, GLboolean sink)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glHistogramEXT);
+}
+void APIENTRY glIglooInterfaceSGIX(GLenum pname, const void * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIglooInterfaceSGIX);
+}
+void APIENTRY glImageTransformParameterfHP(GLenum target, GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glImageTransformParameterfHP);
+}
+void APIENTRY glImageTransformParameterfvHP(GLenum target, GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glImageTransformParameterfvHP);
+}
+void APIENTRY glImageTransformParameteriHP(GLenum target, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glImageTransformParameteriHP);
+}
+void APIENTRY glImageTransformParameterivHP(GLenum target, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glImageTransformParameterivHP);
+}
+void APIENTRY glImportMemoryFdEXT(GLuint memory, GLuint64 size, GLenum handleType, GLint fd)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glImportMemoryFdEXT);
+}
+void APIENTRY glImportMemoryWin32HandleEXT(GLuint memory, GLuint64 size, GLenum handleType, void * handle)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glImportMemoryWin32HandleEXT);
+}
+void APIENTRY glImportMemoryWin32NameEXT(GLuint memory, GLuint64 size, GLenum handleType, const void * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glImportMemoryWin32NameEXT);
+}
+void APIENTRY glImportSemaphoreFdEXT(GLuint semaphore, GLenum handleType, GLint fd)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glImportSemaphoreFdEXT);
+}
+void APIENTRY glImportSemaphoreWin32HandleEXT(GLuint semaphore, GLenum handleType, void * handle)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glImportSemaphoreWin32HandleEXT);
+}
+void APIENTRY glImportSemaphoreWin32NameEXT(GLuint semaphore, GLenum handleType, const void * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glImportSemaphoreWin32NameEXT);
+}
+GLsync APIENTRY glImportSyncEXT(GLenum external_sync_type, GLintptr external_sync, GLbitfield flags)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glImportSyncEXT);
+    return (GLsync)0;
+}
+void APIENTRY glIndexFormatNV(GLenum type, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIndexFormatNV);
+}
+void APIENTRY glIndexFuncEXT(GLenum func, GLclampf ref)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIndexFuncEXT);
+}
+void APIENTRY glIndexMask(GLuint mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIndexMask);
+}
+void APIENTRY glIndexMaterialEXT(GLenum face, GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIndexMaterialEXT);
+}
+void APIENTRY glIndexPointer(GLenum type, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIndexPointer);
+}
+void APIENTRY glIndexPointerEXT(GLenum type, GLsizei stride, GLsizei count, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIndexPointerEXT);
+}
+void APIENTRY glIndexPointerListIBM(GLenum type, GLint stride, const void ** pointer, GLint ptrstride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIndexPointerListIBM);
+}
+void APIENTRY glIndexd(GLdouble c)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIndexd);
+}
+void APIENTRY glIndexdv(const GLdouble * c)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIndexdv);
+}
+void APIENTRY glIndexf(GLfloat c)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIndexf);
+}
+void APIENTRY glIndexfv(const GLfloat * c)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIndexfv);
+}
+void APIENTRY glIndexi(GLint c)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIndexi);
+}
+void APIENTRY glIndexiv(const GLint * c)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIndexiv);
+}
+void APIENTRY glIndexs(GLshort c)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIndexs);
+}
+void APIENTRY glIndexsv(const GLshort * c)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIndexsv);
+}
+void APIENTRY glIndexub(GLubyte c)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIndexub);
+}
+void APIENTRY glIndexubv(const GLubyte * c)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIndexubv);
+}
+void APIENTRY glIndexxOES(GLfixed component)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIndexxOES);
+}
+void APIENTRY glIndexxvOES(const GLfixed * component)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIndexxvOES);
+}
+void APIENTRY glInitNames(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glInitNames);
+}
+void APIENTRY glInsertComponentEXT(GLuint res, GLuint src, GLuint num)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glInsertComponentEXT);
+}
+void APIENTRY glInsertEventMarkerEXT(GLsizei length, const GLchar * marker)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glInsertEventMarkerEXT);
+}
+void APIENTRY glInstrumentsBufferSGIX(GLsizei size, GLint * buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glInstrumentsBufferSGIX);
+}
+void APIENTRY glInterleavedArrays(GLenum format, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glInterleavedArrays);
+}
+void APIENTRY glInterpolatePathsNV(GLuint resultPath, GLuint pathA, GLuint pathB, GLfloat weight)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glInterpolatePathsNV);
+}
+void APIENTRY glInvalidateBufferData(GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glInvalidateBufferData);
+}
+void APIENTRY glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glInvalidateBufferSubData);
+}
+void APIENTRY glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum * attachments)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glInvalidateFramebuffer);
+}
+void APIENTRY glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum * attachments)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glInvalidateNamedFramebufferData);
+}
+void APIENTRY glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum * attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glInvalidateNamedFramebufferSubData);
+}
+void APIENTRY glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum * attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glInvalidateSubFramebuffer);
+}
+void APIENTRY glInvalidateTexImage(GLuint texture, GLint level)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glInvalidateTexImage);
+}
+void APIENTRY glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glInvalidateTexSubImage);
+}
+GLboolean APIENTRY glIsAsyncMarkerSGIX(GLuint marker)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsAsyncMarkerSGIX);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsBuffer(GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsBuffer);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsBufferARB(GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsBufferARB);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsBufferResidentNV(GLenum target)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsBufferResidentNV);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsCommandListNV(GLuint list)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsCommandListNV);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsEnabled(GLenum cap)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsEnabled);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsEnabledIndexedEXT(GLenum target, GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsEnabledIndexedEXT);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsEnabledi(GLenum target, GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsEnabledi);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsFenceAPPLE(GLuint fence)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsFenceAPPLE);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsFenceNV(GLuint fence)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsFenceNV);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsFramebuffer(GLuint framebuffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsFramebuffer);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsFramebufferEXT(GLuint framebuffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsFramebufferEXT);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsImageHandleResidentARB(GLuint64 handle)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsImageHandleResidentARB);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsImageHandleResidentNV(GLuint64 handle)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsImageHandleResidentNV);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsList(GLuint list)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsList);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsMemoryObjectEXT(GLuint memoryObject)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsMemoryObjectEXT);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsNameAMD(GLenum identifier, GLuint name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsNameAMD);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsNamedBufferResidentNV(GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsNamedBufferResidentNV);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsNamedStringARB(GLint namelen, const GLchar * name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsNamedStringARB);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsObjectBufferATI(GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsObjectBufferATI);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsOcclusionQueryNV(GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsOcclusionQueryNV);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsPathNV(GLuint path)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsPathNV);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsPointInFillPathNV(GLuint path, GLuint mask, GLfloat x, GLfloat y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsPointInFillPathNV);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsPointInStrokePathNV(GLuint path, GLfloat x, GLfloat y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsPointInStrokePathNV);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsProgram(GLuint program)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsProgram);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsProgramARB(GLuint program)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsProgramARB);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsProgramNV(GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsProgramNV);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsProgramPipeline(GLuint pipeline)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsProgramPipeline);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsProgramPipelineEXT(GLuint pipeline)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsProgramPipelineEXT);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsQuery(GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsQuery);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsQueryARB(GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsQueryARB);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsRenderbuffer(GLuint renderbuffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsRenderbuffer);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsRenderbufferEXT(GLuint renderbuffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsRenderbufferEXT);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsSampler(GLuint sampler)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsSampler);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsSemaphoreEXT(GLuint semaphore)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsSemaphoreEXT);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsShader(GLuint shader)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsShader);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsStateNV(GLuint state)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsStateNV);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsSync(GLsync sync)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsSync);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsTexture(GLuint texture)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsTexture);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsTextureEXT(GLuint texture)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsTextureEXT);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsTextureHandleResidentARB(GLuint64 handle)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsTextureHandleResidentARB);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsTextureHandleResidentNV(GLuint64 handle)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsTextureHandleResidentNV);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsTransformFeedback(GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsTransformFeedback);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsTransformFeedbackNV(GLuint id)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsTransformFeedbackNV);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsVariantEnabledEXT(GLuint id, GLenum cap)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsVariantEnabledEXT);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsVertexArray(GLuint array)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsVertexArray);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsVertexArrayAPPLE(GLuint array)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsVertexArrayAPPLE);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glIsVertexAttribEnabledAPPLE(GLuint index, GLenum pname)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glIsVertexAttribEnabledAPPLE);
+    return (GLboolean)0;
+}
+void APIENTRY glLGPUCopyImageSubDataNVX(GLuint sourceGpu, GLbitfield destinationGpuMask, GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srxY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei width, GLsizei height, GLsizei depth)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLGPUCopyImageSubDataNVX);
+}
+void APIENTRY glLGPUInterlockNVX(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLGPUInterlockNVX);
+}
+void APIENTRY glLGPUNamedBufferSubDataNVX(GLbitfield gpuMask, GLuint buffer, GLintptr offset, GLsizeiptr size, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLGPUNamedBufferSubDataNVX);
+}
+void APIENTRY glLabelObjectEXT(GLenum type, GLuint object, GLsizei length, const GLchar * label)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLabelObjectEXT);
+}
+void APIENTRY glLightEnviSGIX(GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLightEnviSGIX);
+}
+void APIENTRY glLightModelf(GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLightModelf);
+}
+void APIENTRY glLightModelfv(GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLightModelfv);
+}
+void APIENTRY glLightModeli(GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLightModeli);
+}
+void APIENTRY glLightModeliv(GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLightModeliv);
+}
+void APIENTRY glLightModelxOES(GLenum pname, GLfixed param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLightModelxOES);
+}
+void APIENTRY glLightModelxvOES(GLenum pname, const GLfixed * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLightModelxvOES);
+}
+void APIENTRY glLightf(GLenum light, GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLightf);
+}
+void APIENTRY glLightfv(GLenum light, GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLightfv);
+}
+void APIENTRY glLighti(GLenum light, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLighti);
+}
+void APIENTRY glLightiv(GLenum light, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLightiv);
+}
+void APIENTRY glLightxOES(GLenum light, GLenum pname, GLfixed param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLightxOES);
+}
+void APIENTRY glLightxvOES(GLenum light, GLenum pname, const GLfixed * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLightxvOES);
+}
+void APIENTRY glLineStipple(GLint factor, GLushort pattern)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLineStipple);
+}
+void APIENTRY glLineWidth(GLfloat width)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLineWidth);
+}
+void APIENTRY glLineWidthxOES(GLfixed width)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLineWidthxOES);
+}
+void APIENTRY glLinkProgram(GLuint program)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLinkProgram);
+}
+void APIENTRY glLinkProgramARB(GLhandleARB programObj)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLinkProgramARB);
+}
+void APIENTRY glListBase(GLuint base)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glListBase);
+}
+void APIENTRY glListDrawCommandsStatesClientNV(GLuint list, GLuint segment, const void ** indirects, const GLsizei * sizes, const GLuint * states, const GLuint * fbos, GLuint count)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glListDrawCommandsStatesClientNV);
+}
+void APIENTRY glListParameterfSGIX(GLuint list, GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glListParameterfSGIX);
+}
+void APIENTRY glListParameterfvSGIX(GLuint list, GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glListParameterfvSGIX);
+}
+void APIENTRY glListParameteriSGIX(GLuint list, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glListParameteriSGIX);
+}
+void APIENTRY glListParameterivSGIX(GLuint list, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glListParameterivSGIX);
+}
+void APIENTRY glLoadIdentity(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLoadIdentity);
+}
+void APIENTRY glLoadIdentityDeformationMapSGIX(GLbitfield mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLoadIdentityDeformationMapSGIX);
+}
+void APIENTRY glLoadMatrixd(const GLdouble * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLoadMatrixd);
+}
+void APIENTRY glLoadMatrixf(const GLfloat * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLoadMatrixf);
+}
+void APIENTRY glLoadMatrixxOES(const GLfixed * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLoadMatrixxOES);
+}
+void APIENTRY glLoadName(GLuint name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLoadName);
+}
+void APIENTRY glLoadProgramNV(GLenum target, GLuint id, GLsizei len, const GLubyte * program)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLoadProgramNV);
+}
+void APIENTRY glLoadTransposeMatrixd(const GLdouble * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLoadTransposeMatrixd);
+}
+void APIENTRY glLoadTransposeMatrixdARB(const GLdouble * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLoadTransposeMatrixdARB);
+}
+void APIENTRY glLoadTransposeMatrixf(const GLfloat * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLoadTransposeMatrixf);
+}
+void APIENTRY glLoadTransposeMatrixfARB(const GLfloat * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLoadTransposeMatrixfARB);
+}
+void APIENTRY glLoadTransposeMatrixxOES(const GLfixed * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLoadTransposeMatrixxOES);
+}
+void APIENTRY glLockArraysEXT(GLint first, GLsizei count)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLockArraysEXT);
+}
+void APIENTRY glLogicOp(GLenum opcode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glLogicOp);
+}
+void APIENTRY glMakeBufferNonResidentNV(GLenum target)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMakeBufferNonResidentNV);
+}
+void APIENTRY glMakeBufferResidentNV(GLenum target, GLenum access)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMakeBufferResidentNV);
+}
+void APIENTRY glMakeImageHandleNonResidentARB(GLuint64 handle)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMakeImageHandleNonResidentARB);
+}
+void APIENTRY glMakeImageHandleNonResidentNV(GLuint64 handle)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMakeImageHandleNonResidentNV);
+}
+void APIENTRY glMakeImageHandleResidentARB(GLuint64 handle, GLenum access)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMakeImageHandleResidentARB);
+}
+void APIENTRY glMakeImageHandleResidentNV(GLuint64 handle, GLenum access)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMakeImageHandleResidentNV);
+}
+void APIENTRY glMakeNamedBufferNonResidentNV(GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMakeNamedBufferNonResidentNV);
+}
+void APIENTRY glMakeNamedBufferResidentNV(GLuint buffer, GLenum access)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMakeNamedBufferResidentNV);
+}
+void APIENTRY glMakeTextureHandleNonResidentARB(GLuint64 handle)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMakeTextureHandleNonResidentARB);
+}
+void APIENTRY glMakeTextureHandleNonResidentNV(GLuint64 handle)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMakeTextureHandleNonResidentNV);
+}
+void APIENTRY glMakeTextureHandleResidentARB(GLuint64 handle)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMakeTextureHandleResidentARB);
+}
+void APIENTRY glMakeTextureHandleResidentNV(GLuint64 handle)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMakeTextureHandleResidentNV);
+}
+void APIENTRY glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble * points)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMap1d);
+}
+void APIENTRY glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat * points)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMap1f);
+}
+void APIENTRY glMap1xOES(GLenum target, GLfixed u1, GLfixed u2, GLint stride, GLint order, GLfixed points)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMap1xOES);
+}
+void APIENTRY glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble * points)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMap2d);
+}
+void APIENTRY glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat * points)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMap2f);
+}
+void APIENTRY glMap2xOES(GLenum target, GLfixed u1, GLfixed u2, GLint ustride, GLint uorder, GLfixed v1, GLfixed v2, GLint vstride, GLint vorder, GLfixed points)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMap2xOES);
+}
+void * APIENTRY glMapBuffer(GLenum target, GLenum access)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapBuffer);
+    return (void *)0;
+}
+void * APIENTRY glMapBufferARB(GLenum target, GLenum access)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapBufferARB);
+    return (void *)0;
+}
+void * APIENTRY glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapBufferRange);
+    return (void *)0;
+}
+void APIENTRY glMapControlPointsNV(GLenum target, GLuint index, GLenum type, GLsizei ustride, GLsizei vstride, GLint uorder, GLint vorder, GLboolean packed, const void * points)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapControlPointsNV);
+}
+void APIENTRY glMapGrid1d(GLint un, GLdouble u1, GLdouble u2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapGrid1d);
+}
+void APIENTRY glMapGrid1f(GLint un, GLfloat u1, GLfloat u2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapGrid1f);
+}
+void APIENTRY glMapGrid1xOES(GLint n, GLfixed u1, GLfixed u2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapGrid1xOES);
+}
+void APIENTRY glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapGrid2d);
+}
+void APIENTRY glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapGrid2f);
+}
+void APIENTRY glMapGrid2xOES(GLint n, GLfixed u1, GLfixed u2, GLfixed v1, GLfixed v2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapGrid2xOES);
+}
+void * APIENTRY glMapNamedBuffer(GLuint buffer, GLenum access)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapNamedBuffer);
+    return (void *)0;
+}
+void * APIENTRY glMapNamedBufferEXT(GLuint buffer, GLenum access)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapNamedBufferEXT);
+    return (void *)0;
+}
+void * APIENTRY glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapNamedBufferRange);
+    return (void *)0;
+}
+void * APIENTRY glMapNamedBufferRangeEXT(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapNamedBufferRangeEXT);
+    return (void *)0;
+}
+void * APIENTRY glMapObjectBufferATI(GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapObjectBufferATI);
+    return (void *)0;
+}
+void APIENTRY glMapParameterfvNV(GLenum target, GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapParameterfvNV);
+}
+void APIENTRY glMapParameterivNV(GLenum target, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapParameterivNV);
+}
+void * APIENTRY glMapTexture2DINTEL(GLuint texture, GLint level, GLbitfield access, GLint * stride, GLenum * layout)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapTexture2DINTEL);
+    return (void *)0;
+}
+void APIENTRY glMapVertexAttrib1dAPPLE(GLuint index, GLuint size, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble * points)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapVertexAttrib1dAPPLE);
+}
+void APIENTRY glMapVertexAttrib1fAPPLE(GLuint index, GLuint size, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat * points)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapVertexAttrib1fAPPLE);
+}
+void APIENTRY glMapVertexAttrib2dAPPLE(GLuint index, GLuint size, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble * points)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapVertexAttrib2dAPPLE);
+}
+void APIENTRY glMapVertexAttrib2fAPPLE(GLuint index, GLuint size, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat * points)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMapVertexAttrib2fAPPLE);
+}
+void APIENTRY glMaterialf(GLenum face, GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMaterialf);
+}
+void APIENTRY glMaterialfv(GLenum face, GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMaterialfv);
+}
+void APIENTRY glMateriali(GLenum face, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMateriali);
+}
+void APIENTRY glMaterialiv(GLenum face, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMaterialiv);
+}
+void APIENTRY glMaterialxOES(GLenum face, GLenum pname, GLfixed param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMaterialxOES);
+}
+void APIENTRY glMaterialxvOES(GLenum face, GLenum pname, const GLfixed * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMaterialxvOES);
+}
+void APIENTRY glMatrixFrustumEXT(GLenum mode, GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixFrustumEXT);
+}
+void APIENTRY glMatrixIndexPointerARB(GLint size, GLenum type, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixIndexPointerARB);
+}
+void APIENTRY glMatrixIndexubvARB(GLint size, const GLubyte * indices)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixIndexubvARB);
+}
+void APIENTRY glMatrixIndexuivARB(GLint size, const GLuint * indices)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixIndexuivARB);
+}
+void APIENTRY glMatrixIndexusvARB(GLint size, const GLushort * indices)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixIndexusvARB);
+}
+void APIENTRY glMatrixLoad3x2fNV(GLenum matrixMode, const GLfloat * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixLoad3x2fNV);
+}
+void APIENTRY glMatrixLoad3x3fNV(GLenum matrixMode, const GLfloat * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixLoad3x3fNV);
+}
+void APIENTRY glMatrixLoadIdentityEXT(GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixLoadIdentityEXT);
+}
+void APIENTRY glMatrixLoadTranspose3x3fNV(GLenum matrixMode, const GLfloat * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixLoadTranspose3x3fNV);
+}
+void APIENTRY glMatrixLoadTransposedEXT(GLenum mode, const GLdouble * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixLoadTransposedEXT);
+}
+void APIENTRY glMatrixLoadTransposefEXT(GLenum mode, const GLfloat * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixLoadTransposefEXT);
+}
+void APIENTRY glMatrixLoaddEXT(GLenum mode, const GLdouble * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixLoaddEXT);
+}
+void APIENTRY glMatrixLoadfEXT(GLenum mode, const GLfloat * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixLoadfEXT);
+}
+void APIENTRY glMatrixMode(GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixMode);
+}
+void APIENTRY glMatrixMult3x2fNV(GLenum matrixMode, const GLfloat * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixMult3x2fNV);
+}
+void APIENTRY glMatrixMult3x3fNV(GLenum matrixMode, const GLfloat * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixMult3x3fNV);
+}
+void APIENTRY glMatrixMultTranspose3x3fNV(GLenum matrixMode, const GLfloat * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixMultTranspose3x3fNV);
+}
+void APIENTRY glMatrixMultTransposedEXT(GLenum mode, const GLdouble * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixMultTransposedEXT);
+}
+void APIENTRY glMatrixMultTransposefEXT(GLenum mode, const GLfloat * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixMultTransposefEXT);
+}
+void APIENTRY glMatrixMultdEXT(GLenum mode, const GLdouble * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixMultdEXT);
+}
+void APIENTRY glMatrixMultfEXT(GLenum mode, const GLfloat * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixMultfEXT);
+}
+void APIENTRY glMatrixOrthoEXT(GLenum mode, GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixOrthoEXT);
+}
+void APIENTRY glMatrixPopEXT(GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixPopEXT);
+}
+void APIENTRY glMatrixPushEXT(GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixPushEXT);
+}
+void APIENTRY glMatrixRotatedEXT(GLenum mode, GLdouble angle, GLdouble x, GLdouble y, GLdouble z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixRotatedEXT);
+}
+void APIENTRY glMatrixRotatefEXT(GLenum mode, GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixRotatefEXT);
+}
+void APIENTRY glMatrixScaledEXT(GLenum mode, GLdouble x, GLdouble y, GLdouble z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixScaledEXT);
+}
+void APIENTRY glMatrixScalefEXT(GLenum mode, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixScalefEXT);
+}
+void APIENTRY glMatrixTranslatedEXT(GLenum mode, GLdouble x, GLdouble y, GLdouble z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixTranslatedEXT);
+}
+void APIENTRY glMatrixTranslatefEXT(GLenum mode, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMatrixTranslatefEXT);
+}
+void APIENTRY glMaxShaderCompilerThreadsARB(GLuint count)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMaxShaderCompilerThreadsARB);
+}
+void APIENTRY glMaxShaderCompilerThreadsKHR(GLuint count)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMaxShaderCompilerThreadsKHR);
+}
+void APIENTRY glMemoryBarrier(GLbitfield barriers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMemoryBarrier);
+}
+void APIENTRY glMemoryBarrierByRegion(GLbitfield barriers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMemoryBarrierByRegion);
+}
+void APIENTRY glMemoryBarrierEXT(GLbitfield barriers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMemoryBarrierEXT);
+}
+void APIENTRY glMemoryObjectParameterivEXT(GLuint memoryObject, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMemoryObjectParameterivEXT);
+}
+void APIENTRY glMinSampleShading(GLfloat value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMinSampleShading);
+}
+void APIENTRY glMinSampleShadingARB(GLfloat value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMinSampleShadingARB);
+}
+void APIENTRY glMinmax(GLenum target, GLenum internalformat, GLboolean sink)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMinmax);
+}
+void APIENTRY glMinmaxEXT(GLenum target, GLenum internalformat, GLboolean sink)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMinmaxEXT);
+}
+void APIENTRY glMultMatrixd(const GLdouble * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultMatrixd);
+}
+void APIENTRY glMultMatrixf(const GLfloat * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultMatrixf);
+}
+void APIENTRY glMultMatrixxOES(const GLfixed * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultMatrixxOES);
+}
+void APIENTRY glMultTransposeMatrixd(const GLdouble * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultTransposeMatrixd);
+}
+void APIENTRY glMultTransposeMatrixdARB(const GLdouble * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultTransposeMatrixdARB);
+}
+void APIENTRY glMultTransposeMatrixf(const GLfloat * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultTransposeMatrixf);
+}
+void APIENTRY glMultTransposeMatrixfARB(const GLfloat * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultTransposeMatrixfARB);
+}
+void APIENTRY glMultTransposeMatrixxOES(const GLfixed * m)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultTransposeMatrixxOES);
+}
+void APIENTRY glMultiDrawArrays(GLenum mode, const GLint * first, const GLsizei * count, GLsizei drawcount)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiDrawArrays);
+}
+void APIENTRY glMultiDrawArraysEXT(GLenum mode, const GLint * first, const GLsizei * count, GLsizei primcount)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiDrawArraysEXT);
+}
+void APIENTRY glMultiDrawArraysIndirect(GLenum mode, const void * indirect, GLsizei drawcount, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiDrawArraysIndirect);
+}
+void APIENTRY glMultiDrawArraysIndirectAMD(GLenum mode, const void * indirect, GLsizei primcount, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiDrawArraysIndirectAMD);
+}
+void APIENTRY glMultiDrawArraysIndirectBindlessCountNV(GLenum mode, const void * indirect, GLsizei drawCount, GLsizei maxDrawCount, GLsizei stride, GLint vertexBufferCount)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiDrawArraysIndirectBindlessCountNV);
+}
+void APIENTRY glMultiDrawArraysIndirectBindlessNV(GLenum mode, const void * indirect, GLsizei drawCount, GLsizei stride, GLint vertexBufferCount)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiDrawArraysIndirectBindlessNV);
+}
+void APIENTRY glMultiDrawArraysIndirectCount(GLenum mode, const void * indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiDrawArraysIndirectCount);
+}
+void APIENTRY glMultiDrawArraysIndirectCountARB(GLenum mode, const void * indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiDrawArraysIndirectCountARB);
+}
+void APIENTRY glMultiDrawElementArrayAPPLE(GLenum mode, const GLint * first, const GLsizei * count, GLsizei primcount)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiDrawElementArrayAPPLE);
+}
+void APIENTRY glMultiDrawElements(GLenum mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei drawcount)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiDrawElements);
+}
+void APIENTRY glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei drawcount, const GLint * basevertex)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiDrawElementsBaseVertex);
+}
+void APIENTRY glMultiDrawElementsEXT(GLenum mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei primcount)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiDrawElementsEXT);
+}
+void APIENTRY glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void * indirect, GLsizei drawcount, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiDrawElementsIndirect);
+}
+void APIENTRY glMultiDrawElementsIndirectAMD(GLenum mode, GLenum type, const void * indirect, GLsizei primcount, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiDrawElementsIndirectAMD);
+}
+void APIENTRY glMultiDrawElementsIndirectBindlessCountNV(GLenum mode, GLenum type, const void * indirect, GLsizei drawCount, GLsizei maxDrawCount, GLsizei stride, GLint vertexBufferCount)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiDrawElementsIndirectBindlessCountNV);
+}
+void APIENTRY glMultiDrawElementsIndirectBindlessNV(GLenum mode, GLenum type, const void * indirect, GLsizei drawCount, GLsizei stride, GLint vertexBufferCount)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiDrawElementsIndirectBindlessNV);
+}
+void APIENTRY glMultiDrawElementsIndirectCount(GLenum mode, GLenum type, const void * indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiDrawElementsIndirectCount);
+}
+void APIENTRY glMultiDrawElementsIndirectCountARB(GLenum mode, GLenum type, const void * indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiDrawElementsIndirectCountARB);
+}
+void APIENTRY glMultiDrawMeshTasksIndirectCountNV(GLintptr indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiDrawMeshTasksIndirectCountNV);
+}
+void APIENTRY glMultiDrawMeshTasksIndirectNV(GLintptr indirect, GLsizei drawcount, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiDrawMeshTasksIndirectNV);
+}
+void APIENTRY glMultiDrawRangeElementArrayAPPLE(GLenum mode, GLuint start, GLuint end, const GLint * first, const GLsizei * count, GLsizei primcount)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiDrawRangeElementArrayAPPLE);
+}
+void APIENTRY glMultiModeDrawArraysIBM(const GLenum * mode, const GLint * first, const GLsizei * count, GLsizei primcount, GLint modestride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiModeDrawArraysIBM);
+}
+void APIENTRY glMultiModeDrawElementsIBM(const GLenum * mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei primcount, GLint modestride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiModeDrawElementsIBM);
+}
+void APIENTRY glMultiTexBufferEXT(GLenum texunit, GLenum target, GLenum internalformat, GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexBufferEXT);
+}
+void APIENTRY glMultiTexCoord1bOES(GLenum texture, GLbyte s)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1bOES);
+}
+void APIENTRY glMultiTexCoord1bvOES(GLenum texture, const GLbyte * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1bvOES);
+}
+void APIENTRY glMultiTexCoord1d(GLenum target, GLdouble s)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1d);
+}
+void APIENTRY glMultiTexCoord1dARB(GLenum target, GLdouble s)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1dARB);
+}
+void APIENTRY glMultiTexCoord1dv(GLenum target, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1dv);
+}
+void APIENTRY glMultiTexCoord1dvARB(GLenum target, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1dvARB);
+}
+void APIENTRY glMultiTexCoord1f(GLenum target, GLfloat s)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1f);
+}
+void APIENTRY glMultiTexCoord1fARB(GLenum target, GLfloat s)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1fARB);
+}
+void APIENTRY glMultiTexCoord1fv(GLenum target, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1fv);
+}
+void APIENTRY glMultiTexCoord1fvARB(GLenum target, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1fvARB);
+}
+void APIENTRY glMultiTexCoord1hNV(GLenum target, GLhalfNV s)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1hNV);
+}
+void APIENTRY glMultiTexCoord1hvNV(GLenum target, const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1hvNV);
+}
+void APIENTRY glMultiTexCoord1i(GLenum target, GLint s)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1i);
+}
+void APIENTRY glMultiTexCoord1iARB(GLenum target, GLint s)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1iARB);
+}
+void APIENTRY glMultiTexCoord1iv(GLenum target, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1iv);
+}
+void APIENTRY glMultiTexCoord1ivARB(GLenum target, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1ivARB);
+}
+void APIENTRY glMultiTexCoord1s(GLenum target, GLshort s)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1s);
+}
+void APIENTRY glMultiTexCoord1sARB(GLenum target, GLshort s)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1sARB);
+}
+void APIENTRY glMultiTexCoord1sv(GLenum target, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1sv);
+}
+void APIENTRY glMultiTexCoord1svARB(GLenum target, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1svARB);
+}
+void APIENTRY glMultiTexCoord1xOES(GLenum texture, GLfixed s)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1xOES);
+}
+void APIENTRY glMultiTexCoord1xvOES(GLenum texture, const GLfixed * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord1xvOES);
+}
+void APIENTRY glMultiTexCoord2bOES(GLenum texture, GLbyte s, GLbyte t)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2bOES);
+}
+void APIENTRY glMultiTexCoord2bvOES(GLenum texture, const GLbyte * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2bvOES);
+}
+void APIENTRY glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2d);
+}
+void APIENTRY glMultiTexCoord2dARB(GLenum target, GLdouble s, GLdouble t)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2dARB);
+}
+void APIENTRY glMultiTexCoord2dv(GLenum target, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2dv);
+}
+void APIENTRY glMultiTexCoord2dvARB(GLenum target, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2dvARB);
+}
+void APIENTRY glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2f);
+}
+void APIENTRY glMultiTexCoord2fARB(GLenum target, GLfloat s, GLfloat t)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2fARB);
+}
+void APIENTRY glMultiTexCoord2fv(GLenum target, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2fv);
+}
+void APIENTRY glMultiTexCoord2fvARB(GLenum target, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2fvARB);
+}
+void APIENTRY glMultiTexCoord2hNV(GLenum target, GLhalfNV s, GLhalfNV t)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2hNV);
+}
+void APIENTRY glMultiTexCoord2hvNV(GLenum target, const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2hvNV);
+}
+void APIENTRY glMultiTexCoord2i(GLenum target, GLint s, GLint t)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2i);
+}
+void APIENTRY glMultiTexCoord2iARB(GLenum target, GLint s, GLint t)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2iARB);
+}
+void APIENTRY glMultiTexCoord2iv(GLenum target, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2iv);
+}
+void APIENTRY glMultiTexCoord2ivARB(GLenum target, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2ivARB);
+}
+void APIENTRY glMultiTexCoord2s(GLenum target, GLshort s, GLshort t)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2s);
+}
+void APIENTRY glMultiTexCoord2sARB(GLenum target, GLshort s, GLshort t)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2sARB);
+}
+void APIENTRY glMultiTexCoord2sv(GLenum target, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2sv);
+}
+void APIENTRY glMultiTexCoord2svARB(GLenum target, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2svARB);
+}
+void APIENTRY glMultiTexCoord2xOES(GLenum texture, GLfixed s, GLfixed t)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2xOES);
+}
+void APIENTRY glMultiTexCoord2xvOES(GLenum texture, const GLfixed * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord2xvOES);
+}
+void APIENTRY glMultiTexCoord3bOES(GLenum texture, GLbyte s, GLbyte t, GLbyte r)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3bOES);
+}
+void APIENTRY glMultiTexCoord3bvOES(GLenum texture, const GLbyte * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3bvOES);
+}
+void APIENTRY glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3d);
+}
+void APIENTRY glMultiTexCoord3dARB(GLenum target, GLdouble s, GLdouble t, GLdouble r)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3dARB);
+}
+void APIENTRY glMultiTexCoord3dv(GLenum target, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3dv);
+}
+void APIENTRY glMultiTexCoord3dvARB(GLenum target, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3dvARB);
+}
+void APIENTRY glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3f);
+}
+void APIENTRY glMultiTexCoord3fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3fARB);
+}
+void APIENTRY glMultiTexCoord3fv(GLenum target, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3fv);
+}
+void APIENTRY glMultiTexCoord3fvARB(GLenum target, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3fvARB);
+}
+void APIENTRY glMultiTexCoord3hNV(GLenum target, GLhalfNV s, GLhalfNV t, GLhalfNV r)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3hNV);
+}
+void APIENTRY glMultiTexCoord3hvNV(GLenum target, const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3hvNV);
+}
+void APIENTRY glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3i);
+}
+void APIENTRY glMultiTexCoord3iARB(GLenum target, GLint s, GLint t, GLint r)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3iARB);
+}
+void APIENTRY glMultiTexCoord3iv(GLenum target, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3iv);
+}
+void APIENTRY glMultiTexCoord3ivARB(GLenum target, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3ivARB);
+}
+void APIENTRY glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3s);
+}
+void APIENTRY glMultiTexCoord3sARB(GLenum target, GLshort s, GLshort t, GLshort r)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3sARB);
+}
+void APIENTRY glMultiTexCoord3sv(GLenum target, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3sv);
+}
+void APIENTRY glMultiTexCoord3svARB(GLenum target, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3svARB);
+}
+void APIENTRY glMultiTexCoord3xOES(GLenum texture, GLfixed s, GLfixed t, GLfixed r)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3xOES);
+}
+void APIENTRY glMultiTexCoord3xvOES(GLenum texture, const GLfixed * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord3xvOES);
+}
+void APIENTRY glMultiTexCoord4bOES(GLenum texture, GLbyte s, GLbyte t, GLbyte r, GLbyte q)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4bOES);
+}
+void APIENTRY glMultiTexCoord4bvOES(GLenum texture, const GLbyte * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4bvOES);
+}
+void APIENTRY glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4d);
+}
+void APIENTRY glMultiTexCoord4dARB(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4dARB);
+}
+void APIENTRY glMultiTexCoord4dv(GLenum target, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4dv);
+}
+void APIENTRY glMultiTexCoord4dvARB(GLenum target, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4dvARB);
+}
+void APIENTRY glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4f);
+}
+void APIENTRY glMultiTexCoord4fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4fARB);
+}
+void APIENTRY glMultiTexCoord4fv(GLenum target, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4fv);
+}
+void APIENTRY glMultiTexCoord4fvARB(GLenum target, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4fvARB);
+}
+void APIENTRY glMultiTexCoord4hNV(GLenum target, GLhalfNV s, GLhalfNV t, GLhalfNV r, GLhalfNV q)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4hNV);
+}
+void APIENTRY glMultiTexCoord4hvNV(GLenum target, const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4hvNV);
+}
+void APIENTRY glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4i);
+}
+void APIENTRY glMultiTexCoord4iARB(GLenum target, GLint s, GLint t, GLint r, GLint q)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4iARB);
+}
+void APIENTRY glMultiTexCoord4iv(GLenum target, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4iv);
+}
+void APIENTRY glMultiTexCoord4ivARB(GLenum target, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4ivARB);
+}
+void APIENTRY glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4s);
+}
+void APIENTRY glMultiTexCoord4sARB(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4sARB);
+}
+void APIENTRY glMultiTexCoord4sv(GLenum target, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4sv);
+}
+void APIENTRY glMultiTexCoord4svARB(GLenum target, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4svARB);
+}
+void APIENTRY glMultiTexCoord4xOES(GLenum texture, GLfixed s, GLfixed t, GLfixed r, GLfixed q)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4xOES);
+}
+void APIENTRY glMultiTexCoord4xvOES(GLenum texture, const GLfixed * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoord4xvOES);
+}
+void APIENTRY glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoordP1ui);
+}
+void APIENTRY glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoordP1uiv);
+}
+void APIENTRY glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoordP2ui);
+}
+void APIENTRY glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoordP2uiv);
+}
+void APIENTRY glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoordP3ui);
+}
+void APIENTRY glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoordP3uiv);
+}
+void APIENTRY glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoordP4ui);
+}
+void APIENTRY glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoordP4uiv);
+}
+void APIENTRY glMultiTexCoordPointerEXT(GLenum texunit, GLint size, GLenum type, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexCoordPointerEXT);
+}
+void APIENTRY glMultiTexEnvfEXT(GLenum texunit, GLenum target, GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexEnvfEXT);
+}
+void APIENTRY glMultiTexEnvfvEXT(GLenum texunit, GLenum target, GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexEnvfvEXT);
+}
+void APIENTRY glMultiTexEnviEXT(GLenum texunit, GLenum target, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexEnviEXT);
+}
+void APIENTRY glMultiTexEnvivEXT(GLenum texunit, GLenum target, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexEnvivEXT);
+}
+void APIENTRY glMultiTexGendEXT(GLenum texunit, GLenum coord, GLenum pname, GLdouble param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexGendEXT);
+}
+void APIENTRY glMultiTexGendvEXT(GLenum texunit, GLenum coord, GLenum pname, const GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexGendvEXT);
+}
+void APIENTRY glMultiTexGenfEXT(GLenum texunit, GLenum coord, GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexGenfEXT);
+}
+void APIENTRY glMultiTexGenfvEXT(GLenum texunit, GLenum coord, GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexGenfvEXT);
+}
+void APIENTRY glMultiTexGeniEXT(GLenum texunit, GLenum coord, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexGeniEXT);
+}
+void APIENTRY glMultiTexGenivEXT(GLenum texunit, GLenum coord, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexGenivEXT);
+}
+void APIENTRY glMultiTexImage1DEXT(GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexImage1DEXT);
+}
+void APIENTRY glMultiTexImage2DEXT(GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexImage2DEXT);
+}
+void APIENTRY glMultiTexImage3DEXT(GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexImage3DEXT);
+}
+void APIENTRY glMultiTexParameterIivEXT(GLenum texunit, GLenum target, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexParameterIivEXT);
+}
+void APIENTRY glMultiTexParameterIuivEXT(GLenum texunit, GLenum target, GLenum pname, const GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexParameterIuivEXT);
+}
+void APIENTRY glMultiTexParameterfEXT(GLenum texunit, GLenum target, GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexParameterfEXT);
+}
+void APIENTRY glMultiTexParameterfvEXT(GLenum texunit, GLenum target, GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexParameterfvEXT);
+}
+void APIENTRY glMultiTexParameteriEXT(GLenum texunit, GLenum target, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexParameteriEXT);
+}
+void APIENTRY glMultiTexParameterivEXT(GLenum texunit, GLenum target, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexParameterivEXT);
+}
+void APIENTRY glMultiTexRenderbufferEXT(GLenum texunit, GLenum target, GLuint renderbuffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexRenderbufferEXT);
+}
+void APIENTRY glMultiTexSubImage1DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexSubImage1DEXT);
+}
+void APIENTRY glMultiTexSubImage2DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexSubImage2DEXT);
+}
+void APIENTRY glMultiTexSubImage3DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMultiTexSubImage3DEXT);
+}
+void APIENTRY glMulticastBarrierNV(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMulticastBarrierNV);
+}
+void APIENTRY glMulticastBlitFramebufferNV(GLuint srcGpu, GLuint dstGpu, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMulticastBlitFramebufferNV);
+}
+void APIENTRY glMulticastBufferSubDataNV(GLbitfield gpuMask, GLuint buffer, GLintptr offset, GLsizeiptr size, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMulticastBufferSubDataNV);
+}
+void APIENTRY glMulticastCopyBufferSubDataNV(GLuint readGpu, GLbitfield writeGpuMask, GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMulticastCopyBufferSubDataNV);
+}
+void APIENTRY glMulticastCopyImageSubDataNV(GLuint srcGpu, GLbitfield dstGpuMask, GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMulticastCopyImageSubDataNV);
+}
+void APIENTRY glMulticastFramebufferSampleLocationsfvNV(GLuint gpu, GLuint framebuffer, GLuint start, GLsizei count, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMulticastFramebufferSampleLocationsfvNV);
+}
+void APIENTRY glMulticastGetQueryObjecti64vNV(GLuint gpu, GLuint id, GLenum pname, GLint64 * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMulticastGetQueryObjecti64vNV);
+}
+void APIENTRY glMulticastGetQueryObjectivNV(GLuint gpu, GLuint id, GLenum pname, GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMulticastGetQueryObjectivNV);
+}
+void APIENTRY glMulticastGetQueryObjectui64vNV(GLuint gpu, GLuint id, GLenum pname, GLuint64 * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMulticastGetQueryObjectui64vNV);
+}
+void APIENTRY glMulticastGetQueryObjectuivNV(GLuint gpu, GLuint id, GLenum pname, GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMulticastGetQueryObjectuivNV);
+}
+void APIENTRY glMulticastScissorArrayvNVX(GLuint gpu, GLuint first, GLsizei count, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMulticastScissorArrayvNVX);
+}
+void APIENTRY glMulticastViewportArrayvNVX(GLuint gpu, GLuint first, GLsizei count, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMulticastViewportArrayvNVX);
+}
+void APIENTRY glMulticastViewportPositionWScaleNVX(GLuint gpu, GLuint index, GLfloat xcoeff, GLfloat ycoeff)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMulticastViewportPositionWScaleNVX);
+}
+void APIENTRY glMulticastWaitSyncNV(GLuint signalGpu, GLbitfield waitGpuMask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glMulticastWaitSyncNV);
+}
+void APIENTRY glNamedBufferAttachMemoryNV(GLuint buffer, GLuint memory, GLuint64 offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedBufferAttachMemoryNV);
+}
+void APIENTRY glNamedBufferData(GLuint buffer, GLsizeiptr size, const void * data, GLenum usage)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedBufferData);
+}
+void APIENTRY glNamedBufferDataEXT(GLuint buffer, GLsizeiptr size, const void * data, GLenum usage)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedBufferDataEXT);
+}
+void APIENTRY glNamedBufferPageCommitmentARB(GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedBufferPageCommitmentARB);
+}
+void APIENTRY glNamedBufferPageCommitmentEXT(GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedBufferPageCommitmentEXT);
+}
+void APIENTRY glNamedBufferPageCommitmentMemNV(GLuint buffer, GLintptr offset, GLsizeiptr size, GLuint memory, GLuint64 memOffset, GLboolean commit)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedBufferPageCommitmentMemNV);
+}
+void APIENTRY glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void * data, GLbitfield flags)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedBufferStorage);
+}
+void APIENTRY glNamedBufferStorageEXT(GLuint buffer, GLsizeiptr size, const void * data, GLbitfield flags)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedBufferStorageEXT);
+}
+void APIENTRY glNamedBufferStorageExternalEXT(GLuint buffer, GLintptr offset, GLsizeiptr size, GLeglClientBufferEXT clientBuffer, GLbitfield flags)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedBufferStorageExternalEXT);
+}
+void APIENTRY glNamedBufferStorageMemEXT(GLuint buffer, GLsizeiptr size, GLuint memory, GLuint64 offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedBufferStorageMemEXT);
+}
+void APIENTRY glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedBufferSubData);
+}
+void APIENTRY glNamedBufferSubDataEXT(GLuint buffer, GLintptr offset, GLsizeiptr size, const void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedBufferSubDataEXT);
+}
+void APIENTRY glNamedCopyBufferSubDataEXT(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedCopyBufferSubDataEXT);
+}
+void APIENTRY glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedFramebufferDrawBuffer);
+}
+void APIENTRY glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum * bufs)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedFramebufferDrawBuffers);
+}
+void APIENTRY glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedFramebufferParameteri);
+}
+void APIENTRY glNamedFramebufferParameteriEXT(GLuint framebuffer, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedFramebufferParameteriEXT);
+}
+void APIENTRY glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedFramebufferReadBuffer);
+}
+void APIENTRY glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedFramebufferRenderbuffer);
+}
+void APIENTRY glNamedFramebufferRenderbufferEXT(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedFramebufferRenderbufferEXT);
+}
+void APIENTRY glNamedFramebufferSampleLocationsfvARB(GLuint framebuffer, GLuint start, GLsizei count, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedFramebufferSampleLocationsfvARB);
+}
+void APIENTRY glNamedFramebufferSampleLocationsfvNV(GLuint framebuffer, GLuint start, GLsizei count, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedFramebufferSampleLocationsfvNV);
+}
+void APIENTRY glNamedFramebufferSamplePositionsfvAMD(GLuint framebuffer, GLuint numsamples, GLuint pixelindex, const GLfloat * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedFramebufferSamplePositionsfvAMD);
+}
+void APIENTRY glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedFramebufferTexture);
+}
+void APIENTRY glNamedFramebufferTexture1DEXT(GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedFramebufferTexture1DEXT);
+}
+void APIENTRY glNamedFramebufferTexture2DEXT(GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedFramebufferTexture2DEXT);
+}
+void APIENTRY glNamedFramebufferTexture3DEXT(GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedFramebufferTexture3DEXT);
+}
+void APIENTRY glNamedFramebufferTextureEXT(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedFramebufferTextureEXT);
+}
+void APIENTRY glNamedFramebufferTextureFaceEXT(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLenum face)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedFramebufferTextureFaceEXT);
+}
+void APIENTRY glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedFramebufferTextureLayer);
+}
+void APIENTRY glNamedFramebufferTextureLayerEXT(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedFramebufferTextureLayerEXT);
+}
+void APIENTRY glNamedProgramLocalParameter4dEXT(GLuint program, GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedProgramLocalParameter4dEXT);
+}
+void APIENTRY glNamedProgramLocalParameter4dvEXT(GLuint program, GLenum target, GLuint index, const GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedProgramLocalParameter4dvEXT);
+}
+void APIENTRY glNamedProgramLocalParameter4fEXT(GLuint program, GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedProgramLocalParameter4fEXT);
+}
+void APIENTRY glNamedProgramLocalParameter4fvEXT(GLuint program, GLenum target, GLuint index, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedProgramLocalParameter4fvEXT);
+}
+void APIENTRY glNamedProgramLocalParameterI4iEXT(GLuint program, GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedProgramLocalParameterI4iEXT);
+}
+void APIENTRY glNamedProgramLocalParameterI4ivEXT(GLuint program, GLenum target, GLuint index, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedProgramLocalParameterI4ivEXT);
+}
+void APIENTRY glNamedProgramLocalParameterI4uiEXT(GLuint program, GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedProgramLocalParameterI4uiEXT);
+}
+void APIENTRY glNamedProgramLocalParameterI4uivEXT(GLuint program, GLenum target, GLuint index, const GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedProgramLocalParameterI4uivEXT);
+}
+void APIENTRY glNamedProgramLocalParameters4fvEXT(GLuint program, GLenum target, GLuint index, GLsizei count, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedProgramLocalParameters4fvEXT);
+}
+void APIENTRY glNamedProgramLocalParametersI4ivEXT(GLuint program, GLenum target, GLuint index, GLsizei count, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedProgramLocalParametersI4ivEXT);
+}
+void APIENTRY glNamedProgramLocalParametersI4uivEXT(GLuint program, GLenum target, GLuint index, GLsizei count, const GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedProgramLocalParametersI4uivEXT);
+}
+void APIENTRY glNamedProgramStringEXT(GLuint program, GLenum target, GLenum format, GLsizei len, const void * string)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedProgramStringEXT);
+}
+void APIENTRY glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedRenderbufferStorage);
+}
+void APIENTRY glNamedRenderbufferStorageEXT(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedRenderbufferStorageEXT);
+}
+void APIENTRY glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedRenderbufferStorageMultisample);
+}
+void APIENTRY glNamedRenderbufferStorageMultisampleAdvancedAMD(GLuint renderbuffer, GLsizei samples, GLsizei storageSamples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedRenderbufferStorageMultisampleAdvancedAMD);
+}
+void APIENTRY glNamedRenderbufferStorageMultisampleCoverageEXT(GLuint renderbuffer, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedRenderbufferStorageMultisampleCoverageEXT);
+}
+void APIENTRY glNamedRenderbufferStorageMultisampleEXT(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedRenderbufferStorageMultisampleEXT);
+}
+void APIENTRY glNamedStringARB(GLenum type, GLint namelen, const GLchar * name, GLint stringlen, const GLchar * string)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNamedStringARB);
+}
+void APIENTRY glNewList(GLuint list, GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNewList);
+}
+GLuint APIENTRY glNewObjectBufferATI(GLsizei size, const void * pointer, GLenum usage)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNewObjectBufferATI);
+    return (GLuint)0;
+}
+void APIENTRY glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormal3b);
+}
+void APIENTRY glNormal3bv(const GLbyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormal3bv);
+}
+void APIENTRY glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormal3d);
+}
+void APIENTRY glNormal3dv(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormal3dv);
+}
+void APIENTRY glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormal3f);
+}
+void APIENTRY glNormal3fVertex3fSUN(GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormal3fVertex3fSUN);
+}
+void APIENTRY glNormal3fVertex3fvSUN(const GLfloat * n, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormal3fVertex3fvSUN);
+}
+void APIENTRY glNormal3fv(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormal3fv);
+}
+void APIENTRY glNormal3hNV(GLhalfNV nx, GLhalfNV ny, GLhalfNV nz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormal3hNV);
+}
+void APIENTRY glNormal3hvNV(const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormal3hvNV);
+}
+void APIENTRY glNormal3i(GLint nx, GLint ny, GLint nz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormal3i);
+}
+void APIENTRY glNormal3iv(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormal3iv);
+}
+void APIENTRY glNormal3s(GLshort nx, GLshort ny, GLshort nz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormal3s);
+}
+void APIENTRY glNormal3sv(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormal3sv);
+}
+void APIENTRY glNormal3xOES(GLfixed nx, GLfixed ny, GLfixed nz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormal3xOES);
+}
+void APIENTRY glNormal3xvOES(const GLfixed * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormal3xvOES);
+}
+void APIENTRY glNormalFormatNV(GLenum type, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormalFormatNV);
+}
+void APIENTRY glNormalP3ui(GLenum type, GLuint coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormalP3ui);
+}
+void APIENTRY glNormalP3uiv(GLenum type, const GLuint * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormalP3uiv);
+}
+void APIENTRY glNormalPointer(GLenum type, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormalPointer);
+}
+void APIENTRY glNormalPointerEXT(GLenum type, GLsizei stride, GLsizei count, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormalPointerEXT);
+}
+void APIENTRY glNormalPointerListIBM(GLenum type, GLint stride, const void ** pointer, GLint ptrstride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormalPointerListIBM);
+}
+void APIENTRY glNormalPointervINTEL(GLenum type, const void ** pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormalPointervINTEL);
+}
+void APIENTRY glNormalStream3bATI(GLenum stream, GLbyte nx, GLbyte ny, GLbyte nz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormalStream3bATI);
+}
+void APIENTRY glNormalStream3bvATI(GLenum stream, const GLbyte * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormalStream3bvATI);
+}
+void APIENTRY glNormalStream3dATI(GLenum stream, GLdouble nx, GLdouble ny, GLdouble nz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormalStream3dATI);
+}
+void APIENTRY glNormalStream3dvATI(GLenum stream, const GLdouble * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormalStream3dvATI);
+}
+void APIENTRY glNormalStream3fATI(GLenum stream, GLfloat nx, GLfloat ny, GLfloat nz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormalStream3fATI);
+}
+void APIENTRY glNormalStream3fvATI(GLenum stream, const GLfloat * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormalStream3fvATI);
+}
+void APIENTRY glNormalStream3iATI(GLenum stream, GLint nx, GLint ny, GLint nz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormalStream3iATI);
+}
+void APIENTRY glNormalStream3ivATI(GLenum stream, const GLint * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormalStream3ivATI);
+}
+void APIENTRY glNormalStream3sATI(GLenum stream, GLshort nx, GLshort ny, GLshort nz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormalStream3sATI);
+}
+void APIENTRY glNormalStream3svATI(GLenum stream, const GLshort * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glNormalStream3svATI);
+}
+void APIENTRY glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar * label)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glObjectLabel);
+}
+void APIENTRY glObjectLabelKHR(GLenum identifier, GLuint name, GLsizei length, const GLchar * label)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glObjectLabelKHR);
+}
+void APIENTRY glObjectPtrLabel(const void * ptr, GLsizei length, const GLchar * label)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glObjectPtrLabel);
+}
+void APIENTRY glObjectPtrLabelKHR(const void * ptr, GLsizei length, const GLchar * label)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glObjectPtrLabelKHR);
+}
+GLenum APIENTRY glObjectPurgeableAPPLE(GLenum objectType, GLuint name, GLenum option)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glObjectPurgeableAPPLE);
+    return (GLenum)0;
+}
+GLenum APIENTRY glObjectUnpurgeableAPPLE(GLenum objectType, GLuint name, GLenum option)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glObjectUnpurgeableAPPLE);
+    return (GLenum)0;
+}
+void APIENTRY glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glOrtho);
+}
+void APIENTRY glOrthofOES(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glOrthofOES);
+}
+void APIENTRY glOrthoxOES(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, GLfixed f)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glOrthoxOES);
+}
+void APIENTRY glPNTrianglesfATI(GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPNTrianglesfATI);
+}
+void APIENTRY glPNTrianglesiATI(GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPNTrianglesiATI);
+}
+void APIENTRY glPassTexCoordATI(GLuint dst, GLuint coord, GLenum swizzle)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPassTexCoordATI);
+}
+void APIENTRY glPassThrough(GLfloat token)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPassThrough);
+}
+void APIENTRY glPassThroughxOES(GLfixed token)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPassThroughxOES);
+}
+void APIENTRY glPatchParameterfv(GLenum pname, const GLfloat * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPatchParameterfv);
+}
+void APIENTRY glPatchParameteri(GLenum pname, GLint value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPatchParameteri);
+}
+void APIENTRY glPathColorGenNV(GLenum color, GLenum genMode, GLenum colorFormat, const GLfloat * coeffs)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPathColorGenNV);
+}
+void APIENTRY glPathCommandsNV(GLuint path, GLsizei numCommands, const GLubyte * commands, GLsizei numCoords, GLenum coordType, const void * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPathCommandsNV);
+}
+void APIENTRY glPathCoordsNV(GLuint path, GLsizei numCoords, GLenum coordType, const void * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPathCoordsNV);
+}
+void APIENTRY glPathCoverDepthFuncNV(GLenum func)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPathCoverDepthFuncNV);
+}
+void APIENTRY glPathDashArrayNV(GLuint path, GLsizei dashCount, const GLfloat * dashArray)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPathDashArrayNV);
+}
+void APIENTRY glPathFogGenNV(GLenum genMode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPathFogGenNV);
+}
+GLenum APIENTRY glPathGlyphIndexArrayNV(GLuint firstPathName, GLenum fontTarget, const void * fontName, GLbitfield fontStyle, GLuint firstGlyphIndex, GLsizei numGlyphs, GLuint pathParameterTemplate, GLfloat emScale)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPathGlyphIndexArrayNV);
+    return (GLenum)0;
+}
+GLenum APIENTRY glPathGlyphIndexRangeNV(GLenum fontTarget, const void * fontName, GLbitfield fontStyle, GLuint pathParameterTemplate, GLfloat emScale, GLuint baseAndCount)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPathGlyphIndexRangeNV);
+    return (GLenum)0;
+}
+void APIENTRY glPathGlyphRangeNV(GLuint firstPathName, GLenum fontTarget, const void * fontName, GLbitfield fontStyle, GLuint firstGlyph, GLsizei numGlyphs, GLenum handleMissingGlyphs, GLuint pathParameterTemplate, GLfloat emScale)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPathGlyphRangeNV);
+}
+void APIENTRY glPathGlyphsNV(GLuint firstPathName, GLenum fontTarget, const void * fontName, GLbitfield fontStyle, GLsizei numGlyphs, GLenum type, const void * charcodes, GLenum handleMissingGlyphs, GLuint pathParameterTemplate, GLfloat emScale)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPathGlyphsNV);
+}
+GLenum APIENTRY glPathMemoryGlyphIndexArrayNV(GLuint firstPathName, GLenum fontTarget, GLsizeiptr fontSize, const void * fontData, GLsizei faceIndex, GLuint firstGlyphIndex, GLsizei numGlyphs, GLuint pathParameterTemplate, GLfloat emScale)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPathMemoryGlyphIndexArrayNV);
+    return (GLenum)0;
+}
+void APIENTRY glPathParameterfNV(GLuint path, GLenum pname, GLfloat value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPathParameterfNV);
+}
+void APIENTRY glPathParameterfvNV(GLuint path, GLenum pname, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPathParameterfvNV);
+}
+void APIENTRY glPathParameteriNV(GLuint path, GLenum pname, GLint value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPathParameteriNV);
+}
+void APIENTRY glPathParameterivNV(GLuint path, GLenum pname, const GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPathParameterivNV);
+}
+void APIENTRY glPathStencilDepthOffsetNV(GLfloat factor, GLfloat units)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPathStencilDepthOffsetNV);
+}
+void APIENTRY glPathStencilFuncNV(GLenum func, GLint ref, GLuint mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPathStencilFuncNV);
+}
+void APIENTRY glPathStringNV(GLuint path, GLenum format, GLsizei length, const void * pathString)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPathStringNV);
+}
+void APIENTRY glPathSubCommandsNV(GLuint path, GLsizei commandStart, GLsizei commandsToDelete, GLsizei numCommands, const GLubyte * commands, GLsizei numCoords, GLenum coordType, const void * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPathSubCommandsNV);
+}
+void APIENTRY glPathSubCoordsNV(GLuint path, GLsizei coordStart, GLsizei numCoords, GLenum coordType, const void * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPathSubCoordsNV);
+}
+void APIENTRY glPathTexGenNV(GLenum texCoordSet, GLenum genMode, GLint components, const GLfloat * coeffs)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPathTexGenNV);
+}
+void APIENTRY glPauseTransformFeedback(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPauseTransformFeedback);
+}
+void APIENTRY glPauseTransformFeedbackNV(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPauseTransformFeedbackNV);
+}
+void APIENTRY glPixelDataRangeNV(GLenum target, GLsizei length, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelDataRangeNV);
+}
+void APIENTRY glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelMapfv);
+}
+void APIENTRY glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelMapuiv);
+}
+void APIENTRY glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelMapusv);
+}
+void APIENTRY glPixelMapx(GLenum map, GLint size, const GLfixed * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelMapx);
+}
+void APIENTRY glPixelStoref(GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelStoref);
+}
+void APIENTRY glPixelStorei(GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelStorei);
+}
+void APIENTRY glPixelStorex(GLenum pname, GLfixed param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelStorex);
+}
+void APIENTRY glPixelTexGenParameterfSGIS(GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelTexGenParameterfSGIS);
+}
+void APIENTRY glPixelTexGenParameterfvSGIS(GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelTexGenParameterfvSGIS);
+}
+void APIENTRY glPixelTexGenParameteriSGIS(GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelTexGenParameteriSGIS);
+}
+void APIENTRY glPixelTexGenParameterivSGIS(GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelTexGenParameterivSGIS);
+}
+void APIENTRY glPixelTexGenSGIX(GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelTexGenSGIX);
+}
+void APIENTRY glPixelTransferf(GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelTransferf);
+}
+void APIENTRY glPixelTransferi(GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelTransferi);
+}
+void APIENTRY glPixelTransferxOES(GLenum pname, GLfixed param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelTransferxOES);
+}
+void APIENTRY glPixelTransformParameterfEXT(GLenum target, GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelTransformParameterfEXT);
+}
+void APIENTRY glPixelTransformParameterfvEXT(GLenum target, GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelTransformParameterfvEXT);
+}
+void APIENTRY glPixelTransformParameteriEXT(GLenum target, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelTransformParameteriEXT);
+}
+void APIENTRY glPixelTransformParameterivEXT(GLenum target, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelTransformParameterivEXT);
+}
+void APIENTRY glPixelZoom(GLfloat xfactor, GLfloat yfactor)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelZoom);
+}
+void APIENTRY glPixelZoomxOES(GLfixed xfactor, GLfixed yfactor)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPixelZoomxOES);
+}
+GLboolean APIENTRY glPointAlongPathNV(GLuint path, GLsizei startSegment, GLsizei numSegments, GLfloat distance, GLfloat * x, GLfloat * y, GLfloat * tangentX, GLfloat * tangentY)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPointAlongPathNV);
+    return (GLboolean)0;
+}
+void APIENTRY glPointParameterf(GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPointParameterf);
+}
+void APIENTRY glPointParameterfARB(GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPointParameterfARB);
+}
+void APIENTRY glPointParameterfEXT(GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPointParameterfEXT);
+}
+void APIENTRY glPointParameterfSGIS(GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPointParameterfSGIS);
+}
+void APIENTRY glPointParameterfv(GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPointParameterfv);
+}
+void APIENTRY glPointParameterfvARB(GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPointParameterfvARB);
+}
+void APIENTRY glPointParameterfvEXT(GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPointParameterfvEXT);
+}
+void APIENTRY glPointParameterfvSGIS(GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPointParameterfvSGIS);
+}
+void APIENTRY glPointParameteri(GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPointParameteri);
+}
+void APIENTRY glPointParameteriNV(GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPointParameteriNV);
+}
+void APIENTRY glPointParameteriv(GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPointParameteriv);
+}
+void APIENTRY glPointParameterivNV(GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPointParameterivNV);
+}
+void APIENTRY glPointParameterxOES(GLenum pname, GLfixed param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPointParameterxOES);
+}
+void APIENTRY glPointParameterxvOES(GLenum pname, const GLfixed * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPointParameterxvOES);
+}
+void APIENTRY glPointSize(GLfloat size)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPointSize);
+}
+void APIENTRY glPointSizexOES(GLfixed size)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPointSizexOES);
+}
+GLint APIENTRY glPollAsyncSGIX(GLuint * markerp)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPollAsyncSGIX);
+    return (GLint)0;
+}
+GLint APIENTRY glPollInstrumentsSGIX(GLint * marker_p)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPollInstrumentsSGIX);
+    return (GLint)0;
+}
+void APIENTRY glPolygonMode(GLenum face, GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPolygonMode);
+}
+void APIENTRY glPolygonOffset(GLfloat factor, GLfloat units)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPolygonOffset);
+}
+void APIENTRY glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPolygonOffsetClamp);
+}
+void APIENTRY glPolygonOffsetClampEXT(GLfloat factor, GLfloat units, GLfloat clamp)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPolygonOffsetClampEXT);
+}
+void APIENTRY glPolygonOffsetEXT(GLfloat factor, GLfloat bias)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPolygonOffsetEXT);
+}
+void APIENTRY glPolygonOffsetxOES(GLfixed factor, GLfixed units)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPolygonOffsetxOES);
+}
+void APIENTRY glPolygonStipple(const GLubyte * mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPolygonStipple);
+}
+void APIENTRY glPopAttrib(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPopAttrib);
+}
+void APIENTRY glPopClientAttrib(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPopClientAttrib);
+}
+void APIENTRY glPopDebugGroup(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPopDebugGroup);
+}
+void APIENTRY glPopDebugGroupKHR(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPopDebugGroupKHR);
+}
+void APIENTRY glPopGroupMarkerEXT(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPopGroupMarkerEXT);
+}
+void APIENTRY glPopMatrix(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPopMatrix);
+}
+void APIENTRY glPopName(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPopName);
+}
+void APIENTRY glPresentFrameDualFillNV(GLuint video_slot, GLuint64EXT minPresentTime, GLuint beginPresentTimeId, GLuint presentDurationId, GLenum type, GLenum target0, GLuint fill0, GLenum target1, GLuint fill1, GLenum target2, GLuint fill2, GLenum target3, GLuint fill3)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPresentFrameDualFillNV);
+}
+void APIENTRY glPresentFrameKeyedNV(GLuint video_slot, GLuint64EXT minPresentTime, GLuint beginPresentTimeId, GLuint presentDurationId, GLenum type, GLenum target0, GLuint fill0, GLuint key0, GLenum target1, GLuint fill1, GLuint key1)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPresentFrameKeyedNV);
+}
+void APIENTRY glPrimitiveBoundingBoxARB(GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPrimitiveBoundingBoxARB);
+}
+void APIENTRY glPrimitiveRestartIndex(GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPrimitiveRestartIndex);
+}
+void APIENTRY glPrimitiveRestartIndexNV(GLuint index)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPrimitiveRestartIndexNV);
+}
+void APIENTRY glPrimitiveRestartNV(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPrimitiveRestartNV);
+}
+void APIENTRY glPrioritizeTextures(GLsizei n, const GLuint * textures, const GLfloat * priorities)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPrioritizeTextures);
+}
+void APIENTRY glPrioritizeTexturesEXT(GLsizei n, const GLuint * textures, const GLclampf * priorities)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPrioritizeTexturesEXT);
+}
+void APIENTRY glPrioritizeTexturesxOES(GLsizei n, const GLuint * textures, const GLfixed * priorities)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPrioritizeTexturesxOES);
+}
+void APIENTRY glProgramBinary(GLuint program, GLenum binaryFormat, const void * binary, GLsizei length)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramBinary);
+}
+void APIENTRY glProgramBufferParametersIivNV(GLenum target, GLuint bindingIndex, GLuint wordIndex, GLsizei count, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramBufferParametersIivNV);
+}
+void APIENTRY glProgramBufferParametersIuivNV(GLenum target, GLuint bindingIndex, GLuint wordIndex, GLsizei count, const GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramBufferParametersIuivNV);
+}
+void APIENTRY glProgramBufferParametersfvNV(GLenum target, GLuint bindingIndex, GLuint wordIndex, GLsizei count, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramBufferParametersfvNV);
+}
+void APIENTRY glProgramEnvParameter4dARB(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramEnvParameter4dARB);
+}
+void APIENTRY glProgramEnvParameter4dvARB(GLenum target, GLuint index, const GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramEnvParameter4dvARB);
+}
+void APIENTRY glProgramEnvParameter4fARB(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramEnvParameter4fARB);
+}
+void APIENTRY glProgramEnvParameter4fvARB(GLenum target, GLuint index, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramEnvParameter4fvARB);
+}
+void APIENTRY glProgramEnvParameterI4iNV(GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramEnvParameterI4iNV);
+}
+void APIENTRY glProgramEnvParameterI4ivNV(GLenum target, GLuint index, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramEnvParameterI4ivNV);
+}
+void APIENTRY glProgramEnvParameterI4uiNV(GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramEnvParameterI4uiNV);
+}
+void APIENTRY glProgramEnvParameterI4uivNV(GLenum target, GLuint index, const GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramEnvParameterI4uivNV);
+}
+void APIENTRY glProgramEnvParameters4fvEXT(GLenum target, GLuint index, GLsizei count, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramEnvParameters4fvEXT);
+}
+void APIENTRY glProgramEnvParametersI4ivNV(GLenum target, GLuint index, GLsizei count, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramEnvParametersI4ivNV);
+}
+void APIENTRY glProgramEnvParametersI4uivNV(GLenum target, GLuint index, GLsizei count, const GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramEnvParametersI4uivNV);
+}
+void APIENTRY glProgramLocalParameter4dARB(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramLocalParameter4dARB);
+}
+void APIENTRY glProgramLocalParameter4dvARB(GLenum target, GLuint index, const GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramLocalParameter4dvARB);
+}
+void APIENTRY glProgramLocalParameter4fARB(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramLocalParameter4fARB);
+}
+void APIENTRY glProgramLocalParameter4fvARB(GLenum target, GLuint index, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramLocalParameter4fvARB);
+}
+void APIENTRY glProgramLocalParameterI4iNV(GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramLocalParameterI4iNV);
+}
+void APIENTRY glProgramLocalParameterI4ivNV(GLenum target, GLuint index, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramLocalParameterI4ivNV);
+}
+void APIENTRY glProgramLocalParameterI4uiNV(GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramLocalParameterI4uiNV);
+}
+void APIENTRY glProgramLocalParameterI4uivNV(GLenum target, GLuint index, const GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramLocalParameterI4uivNV);
+}
+void APIENTRY glProgramLocalParameters4fvEXT(GLenum target, GLuint index, GLsizei count, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramLocalParameters4fvEXT);
+}
+void APIENTRY glProgramLocalParametersI4ivNV(GLenum target, GLuint index, GLsizei count, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramLocalParametersI4ivNV);
+}
+void APIENTRY glProgramLocalParametersI4uivNV(GLenum target, GLuint index, GLsizei count, const GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramLocalParametersI4uivNV);
+}
+void APIENTRY glProgramNamedParameter4dNV(GLuint id, GLsizei len, const GLubyte * name, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramNamedParameter4dNV);
+}
+void APIENTRY glProgramNamedParameter4dvNV(GLuint id, GLsizei len, const GLubyte * name, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramNamedParameter4dvNV);
+}
+void APIENTRY glProgramNamedParameter4fNV(GLuint id, GLsizei len, const GLubyte * name, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramNamedParameter4fNV);
+}
+void APIENTRY glProgramNamedParameter4fvNV(GLuint id, GLsizei len, const GLubyte * name, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramNamedParameter4fvNV);
+}
+void APIENTRY glProgramParameter4dNV(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramParameter4dNV);
+}
+void APIENTRY glProgramParameter4dvNV(GLenum target, GLuint index, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramParameter4dvNV);
+}
+void APIENTRY glProgramParameter4fNV(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramParameter4fNV);
+}
+void APIENTRY glProgramParameter4fvNV(GLenum target, GLuint index, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramParameter4fvNV);
+}
+void APIENTRY glProgramParameteri(GLuint program, GLenum pname, GLint value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramParameteri);
+}
+void APIENTRY glProgramParameteriARB(GLuint program, GLenum pname, GLint value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramParameteriARB);
+}
+void APIENTRY glProgramParameteriEXT(GLuint program, GLenum pname, GLint value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramParameteriEXT);
+}
+void APIENTRY glProgramParameters4dvNV(GLenum target, GLuint index, GLsizei count, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramParameters4dvNV);
+}
+void APIENTRY glProgramParameters4fvNV(GLenum target, GLuint index, GLsizei count, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramParameters4fvNV);
+}
+void APIENTRY glProgramPathFragmentInputGenNV(GLuint program, GLint location, GLenum genMode, GLint components, const GLfloat * coeffs)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramPathFragmentInputGenNV);
+}
+void APIENTRY glProgramStringARB(GLenum target, GLenum format, GLsizei len, const void * string)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramStringARB);
+}
+void APIENTRY glProgramSubroutineParametersuivNV(GLenum target, GLsizei count, const GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramSubroutineParametersuivNV);
+}
+void APIENTRY glProgramUniform1d(GLuint program, GLint location, GLdouble v0)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1d);
+}
+void APIENTRY glProgramUniform1dEXT(GLuint program, GLint location, GLdouble x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1dEXT);
+}
+void APIENTRY glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1dv);
+}
+void APIENTRY glProgramUniform1dvEXT(GLuint program, GLint location, GLsizei count, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1dvEXT);
+}
+void APIENTRY glProgramUniform1f(GLuint program, GLint location, GLfloat v0)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1f);
+}
+void APIENTRY glProgramUniform1fEXT(GLuint program, GLint location, GLfloat v0)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1fEXT);
+}
+void APIENTRY glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1fv);
+}
+void APIENTRY glProgramUniform1fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1fvEXT);
+}
+void APIENTRY glProgramUniform1i(GLuint program, GLint location, GLint v0)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1i);
+}
+void APIENTRY glProgramUniform1i64ARB(GLuint program, GLint location, GLint64 x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1i64ARB);
+}
+void APIENTRY glProgramUniform1i64NV(GLuint program, GLint location, GLint64EXT x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1i64NV);
+}
+void APIENTRY glProgramUniform1i64vARB(GLuint program, GLint location, GLsizei count, const GLint64 * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1i64vARB);
+}
+void APIENTRY glProgramUniform1i64vNV(GLuint program, GLint location, GLsizei count, const GLint64EXT * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1i64vNV);
+}
+void APIENTRY glProgramUniform1iEXT(GLuint program, GLint location, GLint v0)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1iEXT);
+}
+void APIENTRY glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1iv);
+}
+void APIENTRY glProgramUniform1ivEXT(GLuint program, GLint location, GLsizei count, const GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1ivEXT);
+}
+void APIENTRY glProgramUniform1ui(GLuint program, GLint location, GLuint v0)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1ui);
+}
+void APIENTRY glProgramUniform1ui64ARB(GLuint program, GLint location, GLuint64 x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1ui64ARB);
+}
+void APIENTRY glProgramUniform1ui64NV(GLuint program, GLint location, GLuint64EXT x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1ui64NV);
+}
+void APIENTRY glProgramUniform1ui64vARB(GLuint program, GLint location, GLsizei count, const GLuint64 * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1ui64vARB);
+}
+void APIENTRY glProgramUniform1ui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64EXT * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1ui64vNV);
+}
+void APIENTRY glProgramUniform1uiEXT(GLuint program, GLint location, GLuint v0)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1uiEXT);
+}
+void APIENTRY glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1uiv);
+}
+void APIENTRY glProgramUniform1uivEXT(GLuint program, GLint location, GLsizei count, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform1uivEXT);
+}
+void APIENTRY glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2d);
+}
+void APIENTRY glProgramUniform2dEXT(GLuint program, GLint location, GLdouble x, GLdouble y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2dEXT);
+}
+void APIENTRY glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2dv);
+}
+void APIENTRY glProgramUniform2dvEXT(GLuint program, GLint location, GLsizei count, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2dvEXT);
+}
+void APIENTRY glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2f);
+}
+void APIENTRY glProgramUniform2fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2fEXT);
+}
+void APIENTRY glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2fv);
+}
+void APIENTRY glProgramUniform2fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2fvEXT);
+}
+void APIENTRY glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2i);
+}
+void APIENTRY glProgramUniform2i64ARB(GLuint program, GLint location, GLint64 x, GLint64 y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2i64ARB);
+}
+void APIENTRY glProgramUniform2i64NV(GLuint program, GLint location, GLint64EXT x, GLint64EXT y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2i64NV);
+}
+void APIENTRY glProgramUniform2i64vARB(GLuint program, GLint location, GLsizei count, const GLint64 * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2i64vARB);
+}
+void APIENTRY glProgramUniform2i64vNV(GLuint program, GLint location, GLsizei count, const GLint64EXT * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2i64vNV);
+}
+void APIENTRY glProgramUniform2iEXT(GLuint program, GLint location, GLint v0, GLint v1)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2iEXT);
+}
+void APIENTRY glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2iv);
+}
+void APIENTRY glProgramUniform2ivEXT(GLuint program, GLint location, GLsizei count, const GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2ivEXT);
+}
+void APIENTRY glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2ui);
+}
+void APIENTRY glProgramUniform2ui64ARB(GLuint program, GLint location, GLuint64 x, GLuint64 y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2ui64ARB);
+}
+void APIENTRY glProgramUniform2ui64NV(GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2ui64NV);
+}
+void APIENTRY glProgramUniform2ui64vARB(GLuint program, GLint location, GLsizei count, const GLuint64 * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2ui64vARB);
+}
+void APIENTRY glProgramUniform2ui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64EXT * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2ui64vNV);
+}
+void APIENTRY glProgramUniform2uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2uiEXT);
+}
+void APIENTRY glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2uiv);
+}
+void APIENTRY glProgramUniform2uivEXT(GLuint program, GLint location, GLsizei count, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform2uivEXT);
+}
+void APIENTRY glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3d);
+}
+void APIENTRY glProgramUniform3dEXT(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3dEXT);
+}
+void APIENTRY glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3dv);
+}
+void APIENTRY glProgramUniform3dvEXT(GLuint program, GLint location, GLsizei count, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3dvEXT);
+}
+void APIENTRY glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3f);
+}
+void APIENTRY glProgramUniform3fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3fEXT);
+}
+void APIENTRY glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3fv);
+}
+void APIENTRY glProgramUniform3fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3fvEXT);
+}
+void APIENTRY glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3i);
+}
+void APIENTRY glProgramUniform3i64ARB(GLuint program, GLint location, GLint64 x, GLint64 y, GLint64 z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3i64ARB);
+}
+void APIENTRY glProgramUniform3i64NV(GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3i64NV);
+}
+void APIENTRY glProgramUniform3i64vARB(GLuint program, GLint location, GLsizei count, const GLint64 * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3i64vARB);
+}
+void APIENTRY glProgramUniform3i64vNV(GLuint program, GLint location, GLsizei count, const GLint64EXT * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3i64vNV);
+}
+void APIENTRY glProgramUniform3iEXT(GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3iEXT);
+}
+void APIENTRY glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3iv);
+}
+void APIENTRY glProgramUniform3ivEXT(GLuint program, GLint location, GLsizei count, const GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3ivEXT);
+}
+void APIENTRY glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3ui);
+}
+void APIENTRY glProgramUniform3ui64ARB(GLuint program, GLint location, GLuint64 x, GLuint64 y, GLuint64 z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3ui64ARB);
+}
+void APIENTRY glProgramUniform3ui64NV(GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3ui64NV);
+}
+void APIENTRY glProgramUniform3ui64vARB(GLuint program, GLint location, GLsizei count, const GLuint64 * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3ui64vARB);
+}
+void APIENTRY glProgramUniform3ui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64EXT * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3ui64vNV);
+}
+void APIENTRY glProgramUniform3uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3uiEXT);
+}
+void APIENTRY glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3uiv);
+}
+void APIENTRY glProgramUniform3uivEXT(GLuint program, GLint location, GLsizei count, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform3uivEXT);
+}
+void APIENTRY glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4d);
+}
+void APIENTRY glProgramUniform4dEXT(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4dEXT);
+}
+void APIENTRY glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4dv);
+}
+void APIENTRY glProgramUniform4dvEXT(GLuint program, GLint location, GLsizei count, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4dvEXT);
+}
+void APIENTRY glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4f);
+}
+void APIENTRY glProgramUniform4fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4fEXT);
+}
+void APIENTRY glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4fv);
+}
+void APIENTRY glProgramUniform4fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4fvEXT);
+}
+void APIENTRY glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4i);
+}
+void APIENTRY glProgramUniform4i64ARB(GLuint program, GLint location, GLint64 x, GLint64 y, GLint64 z, GLint64 w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4i64ARB);
+}
+void APIENTRY glProgramUniform4i64NV(GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4i64NV);
+}
+void APIENTRY glProgramUniform4i64vARB(GLuint program, GLint location, GLsizei count, const GLint64 * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4i64vARB);
+}
+void APIENTRY glProgramUniform4i64vNV(GLuint program, GLint location, GLsizei count, const GLint64EXT * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4i64vNV);
+}
+void APIENTRY glProgramUniform4iEXT(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4iEXT);
+}
+void APIENTRY glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4iv);
+}
+void APIENTRY glProgramUniform4ivEXT(GLuint program, GLint location, GLsizei count, const GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4ivEXT);
+}
+void APIENTRY glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4ui);
+}
+void APIENTRY glProgramUniform4ui64ARB(GLuint program, GLint location, GLuint64 x, GLuint64 y, GLuint64 z, GLuint64 w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4ui64ARB);
+}
+void APIENTRY glProgramUniform4ui64NV(GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4ui64NV);
+}
+void APIENTRY glProgramUniform4ui64vARB(GLuint program, GLint location, GLsizei count, const GLuint64 * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4ui64vARB);
+}
+void APIENTRY glProgramUniform4ui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64EXT * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4ui64vNV);
+}
+void APIENTRY glProgramUniform4uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4uiEXT);
+}
+void APIENTRY glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4uiv);
+}
+void APIENTRY glProgramUniform4uivEXT(GLuint program, GLint location, GLsizei count, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniform4uivEXT);
+}
+void APIENTRY glProgramUniformHandleui64ARB(GLuint program, GLint location, GLuint64 value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformHandleui64ARB);
+}
+void APIENTRY glProgramUniformHandleui64NV(GLuint program, GLint location, GLuint64 value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformHandleui64NV);
+}
+void APIENTRY glProgramUniformHandleui64vARB(GLuint program, GLint location, GLsizei count, const GLuint64 * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformHandleui64vARB);
+}
+void APIENTRY glProgramUniformHandleui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64 * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformHandleui64vNV);
+}
+void APIENTRY glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix2dv);
+}
+void APIENTRY glProgramUniformMatrix2dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix2dvEXT);
+}
+void APIENTRY glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix2fv);
+}
+void APIENTRY glProgramUniformMatrix2fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix2fvEXT);
+}
+void APIENTRY glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix2x3dv);
+}
+void APIENTRY glProgramUniformMatrix2x3dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix2x3dvEXT);
+}
+void APIENTRY glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix2x3fv);
+}
+void APIENTRY glProgramUniformMatrix2x3fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix2x3fvEXT);
+}
+void APIENTRY glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix2x4dv);
+}
+void APIENTRY glProgramUniformMatrix2x4dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix2x4dvEXT);
+}
+void APIENTRY glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix2x4fv);
+}
+void APIENTRY glProgramUniformMatrix2x4fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix2x4fvEXT);
+}
+void APIENTRY glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix3dv);
+}
+void APIENTRY glProgramUniformMatrix3dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix3dvEXT);
+}
+void APIENTRY glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix3fv);
+}
+void APIENTRY glProgramUniformMatrix3fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix3fvEXT);
+}
+void APIENTRY glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix3x2dv);
+}
+void APIENTRY glProgramUniformMatrix3x2dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix3x2dvEXT);
+}
+void APIENTRY glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix3x2fv);
+}
+void APIENTRY glProgramUniformMatrix3x2fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix3x2fvEXT);
+}
+void APIENTRY glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix3x4dv);
+}
+void APIENTRY glProgramUniformMatrix3x4dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix3x4dvEXT);
+}
+void APIENTRY glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix3x4fv);
+}
+void APIENTRY glProgramUniformMatrix3x4fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix3x4fvEXT);
+}
+void APIENTRY glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix4dv);
+}
+void APIENTRY glProgramUniformMatrix4dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix4dvEXT);
+}
+void APIENTRY glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix4fv);
+}
+void APIENTRY glProgramUniformMatrix4fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix4fvEXT);
+}
+void APIENTRY glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix4x2dv);
+}
+void APIENTRY glProgramUniformMatrix4x2dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix4x2dvEXT);
+}
+void APIENTRY glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix4x2fv);
+}
+void APIENTRY glProgramUniformMatrix4x2fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix4x2fvEXT);
+}
+void APIENTRY glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix4x3dv);
+}
+void APIENTRY glProgramUniformMatrix4x3dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix4x3dvEXT);
+}
+void APIENTRY glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix4x3fv);
+}
+void APIENTRY glProgramUniformMatrix4x3fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformMatrix4x3fvEXT);
+}
+void APIENTRY glProgramUniformui64NV(GLuint program, GLint location, GLuint64EXT value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformui64NV);
+}
+void APIENTRY glProgramUniformui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64EXT * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramUniformui64vNV);
+}
+void APIENTRY glProgramVertexLimitNV(GLenum target, GLint limit)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProgramVertexLimitNV);
+}
+void APIENTRY glProvokingVertex(GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProvokingVertex);
+}
+void APIENTRY glProvokingVertexEXT(GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glProvokingVertexEXT);
+}
+void APIENTRY glPushAttrib(GLbitfield mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPushAttrib);
+}
+void APIENTRY glPushClientAttrib(GLbitfield mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPushClientAttrib);
+}
+void APIENTRY glPushClientAttribDefaultEXT(GLbitfield mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPushClientAttribDefaultEXT);
+}
+void APIENTRY glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar * message)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPushDebugGroup);
+}
+void APIENTRY glPushDebugGroupKHR(GLenum source, GLuint id, GLsizei length, const GLchar * message)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPushDebugGroupKHR);
+}
+void APIENTRY glPushGroupMarkerEXT(GLsizei length, const GLchar * marker)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPushGroupMarkerEXT);
+}
+void APIENTRY glPushMatrix(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPushMatrix);
+}
+void APIENTRY glPushName(GLuint name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glPushName);
+}
+void APIENTRY glQueryCounter(GLuint id, GLenum target)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glQueryCounter);
+}
+GLbitfield APIENTRY glQueryMatrixxOES(GLfixed * mantissa, GLint * exponent)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glQueryMatrixxOES);
+    return (GLbitfield)0;
+}
+void APIENTRY glQueryObjectParameteruiAMD(GLenum target, GLuint id, GLenum pname, GLuint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glQueryObjectParameteruiAMD);
+}
+GLint APIENTRY glQueryResourceNV(GLenum queryType, GLint tagId, GLuint count, GLint * buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glQueryResourceNV);
+    return (GLint)0;
+}
+void APIENTRY glQueryResourceTagNV(GLint tagId, const GLchar * tagString)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glQueryResourceTagNV);
+}
+void APIENTRY glRasterPos2d(GLdouble x, GLdouble y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos2d);
+}
+void APIENTRY glRasterPos2dv(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos2dv);
+}
+void APIENTRY glRasterPos2f(GLfloat x, GLfloat y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos2f);
+}
+void APIENTRY glRasterPos2fv(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos2fv);
+}
+void APIENTRY glRasterPos2i(GLint x, GLint y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos2i);
+}
+void APIENTRY glRasterPos2iv(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos2iv);
+}
+void APIENTRY glRasterPos2s(GLshort x, GLshort y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos2s);
+}
+void APIENTRY glRasterPos2sv(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos2sv);
+}
+void APIENTRY glRasterPos2xOES(GLfixed x, GLfixed y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos2xOES);
+}
+void APIENTRY glRasterPos2xvOES(const GLfixed * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos2xvOES);
+}
+void APIENTRY glRasterPos3d(GLdouble x, GLdouble y, GLdouble z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos3d);
+}
+void APIENTRY glRasterPos3dv(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos3dv);
+}
+void APIENTRY glRasterPos3f(GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos3f);
+}
+void APIENTRY glRasterPos3fv(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos3fv);
+}
+void APIENTRY glRasterPos3i(GLint x, GLint y, GLint z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos3i);
+}
+void APIENTRY glRasterPos3iv(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos3iv);
+}
+void APIENTRY glRasterPos3s(GLshort x, GLshort y, GLshort z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos3s);
+}
+void APIENTRY glRasterPos3sv(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos3sv);
+}
+void APIENTRY glRasterPos3xOES(GLfixed x, GLfixed y, GLfixed z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos3xOES);
+}
+void APIENTRY glRasterPos3xvOES(const GLfixed * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos3xvOES);
+}
+void APIENTRY glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos4d);
+}
+void APIENTRY glRasterPos4dv(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos4dv);
+}
+void APIENTRY glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos4f);
+}
+void APIENTRY glRasterPos4fv(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos4fv);
+}
+void APIENTRY glRasterPos4i(GLint x, GLint y, GLint z, GLint w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos4i);
+}
+void APIENTRY glRasterPos4iv(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos4iv);
+}
+void APIENTRY glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos4s);
+}
+void APIENTRY glRasterPos4sv(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos4sv);
+}
+void APIENTRY glRasterPos4xOES(GLfixed x, GLfixed y, GLfixed z, GLfixed w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos4xOES);
+}
+void APIENTRY glRasterPos4xvOES(const GLfixed * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterPos4xvOES);
+}
+void APIENTRY glRasterSamplesEXT(GLuint samples, GLboolean fixedsamplelocations)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRasterSamplesEXT);
+}
+void APIENTRY glReadBuffer(GLenum src)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReadBuffer);
+}
+void APIENTRY glReadInstrumentsSGIX(GLint marker)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReadInstrumentsSGIX);
+}
+void APIENTRY glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReadPixels);
+}
+void APIENTRY glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReadnPixels);
+}
+void APIENTRY glReadnPixelsARB(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReadnPixelsARB);
+}
+void APIENTRY glReadnPixelsKHR(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReadnPixelsKHR);
+}
+void APIENTRY glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRectd);
+}
+void APIENTRY glRectdv(const GLdouble * v1, const GLdouble * v2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRectdv);
+}
+void APIENTRY glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRectf);
+}
+void APIENTRY glRectfv(const GLfloat * v1, const GLfloat * v2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRectfv);
+}
+void APIENTRY glRecti(GLint x1, GLint y1, GLint x2, GLint y2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRecti);
+}
+void APIENTRY glRectiv(const GLint * v1, const GLint * v2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRectiv);
+}
+void APIENTRY glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRects);
+}
+void APIENTRY glRectsv(const GLshort * v1, const GLshort * v2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRectsv);
+}
+void APIENTRY glRectxOES(GLfixed x1, GLfixed y1, GLfixed x2, GLfixed y2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRectxOES);
+}
+void APIENTRY glRectxvOES(const GLfixed * v1, const GLfixed * v2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRectxvOES);
+}
+void APIENTRY glReferencePlaneSGIX(const GLdouble * equation)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReferencePlaneSGIX);
+}
+GLboolean APIENTRY glReleaseKeyedMutexWin32EXT(GLuint memory, GLuint64 key)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReleaseKeyedMutexWin32EXT);
+    return (GLboolean)0;
+}
+void APIENTRY glReleaseShaderCompiler(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReleaseShaderCompiler);
+}
+void APIENTRY glRenderGpuMaskNV(GLbitfield mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRenderGpuMaskNV);
+}
+GLint APIENTRY glRenderMode(GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRenderMode);
+    return (GLint)0;
+}
+void APIENTRY glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRenderbufferStorage);
+}
+void APIENTRY glRenderbufferStorageEXT(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRenderbufferStorageEXT);
+}
+void APIENTRY glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRenderbufferStorageMultisample);
+}
+void APIENTRY glRenderbufferStorageMultisampleAdvancedAMD(GLenum target, GLsizei samples, GLsizei storageSamples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRenderbufferStorageMultisampleAdvancedAMD);
+}
+void APIENTRY glRenderbufferStorageMultisampleCoverageNV(GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRenderbufferStorageMultisampleCoverageNV);
+}
+void APIENTRY glRenderbufferStorageMultisampleEXT(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRenderbufferStorageMultisampleEXT);
+}
+void APIENTRY glReplacementCodePointerSUN(GLenum type, GLsizei stride, const void ** pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodePointerSUN);
+}
+void APIENTRY glReplacementCodeubSUN(GLubyte code)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeubSUN);
+}
+void APIENTRY glReplacementCodeubvSUN(const GLubyte * code)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeubvSUN);
+}
+void APIENTRY glReplacementCodeuiColor3fVertex3fSUN(GLuint rc, GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeuiColor3fVertex3fSUN);
+}
+void APIENTRY glReplacementCodeuiColor3fVertex3fvSUN(const GLuint * rc, const GLfloat * c, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeuiColor3fVertex3fvSUN);
+}
+void APIENTRY glReplacementCodeuiColor4fNormal3fVertex3fSUN(GLuint rc, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeuiColor4fNormal3fVertex3fSUN);
+}
+void APIENTRY glReplacementCodeuiColor4fNormal3fVertex3fvSUN(const GLuint * rc, const GLfloat * c, const GLfloat * n, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeuiColor4fNormal3fVertex3fvSUN);
+}
+void APIENTRY glReplacementCodeuiColor4ubVertex3fSUN(GLuint rc, GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeuiColor4ubVertex3fSUN);
+}
+void APIENTRY glReplacementCodeuiColor4ubVertex3fvSUN(const GLuint * rc, const GLubyte * c, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeuiColor4ubVertex3fvSUN);
+}
+void APIENTRY glReplacementCodeuiNormal3fVertex3fSUN(GLuint rc, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeuiNormal3fVertex3fSUN);
+}
+void APIENTRY glReplacementCodeuiNormal3fVertex3fvSUN(const GLuint * rc, const GLfloat * n, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeuiNormal3fVertex3fvSUN);
+}
+void APIENTRY glReplacementCodeuiSUN(GLuint code)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeuiSUN);
+}
+void APIENTRY glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN(GLuint rc, GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN);
+}
+void APIENTRY glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN(const GLuint * rc, const GLfloat * tc, const GLfloat * c, const GLfloat * n, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN);
+}
+void APIENTRY glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN(GLuint rc, GLfloat s, GLfloat t, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN);
+}
+void APIENTRY glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN(const GLuint * rc, const GLfloat * tc, const GLfloat * n, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN);
+}
+void APIENTRY glReplacementCodeuiTexCoord2fVertex3fSUN(GLuint rc, GLfloat s, GLfloat t, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeuiTexCoord2fVertex3fSUN);
+}
+void APIENTRY glReplacementCodeuiTexCoord2fVertex3fvSUN(const GLuint * rc, const GLfloat * tc, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeuiTexCoord2fVertex3fvSUN);
+}
+void APIENTRY glReplacementCodeuiVertex3fSUN(GLuint rc, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeuiVertex3fSUN);
+}
+void APIENTRY glReplacementCodeuiVertex3fvSUN(const GLuint * rc, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeuiVertex3fvSUN);
+}
+void APIENTRY glReplacementCodeuivSUN(const GLuint * code)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeuivSUN);
+}
+void APIENTRY glReplacementCodeusSUN(GLushort code)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeusSUN);
+}
+void APIENTRY glReplacementCodeusvSUN(const GLushort * code)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glReplacementCodeusvSUN);
+}
+void APIENTRY glRequestResidentProgramsNV(GLsizei n, const GLuint * programs)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRequestResidentProgramsNV);
+}
+void APIENTRY glResetHistogram(GLenum target)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glResetHistogram);
+}
+void APIENTRY glResetHistogramEXT(GLenum target)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glResetHistogramEXT);
+}
+void APIENTRY glResetMemoryObjectParameterNV(GLuint memory, GLenum pname)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glResetMemoryObjectParameterNV);
+}
+void APIENTRY glResetMinmax(GLenum target)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glResetMinmax);
+}
+void APIENTRY glResetMinmaxEXT(GLenum target)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glResetMinmaxEXT);
+}
+void APIENTRY glResizeBuffersMESA(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glResizeBuffersMESA);
+}
+void APIENTRY glResolveDepthValuesNV(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glResolveDepthValuesNV);
+}
+void APIENTRY glResumeTransformFeedback(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glResumeTransformFeedback);
+}
+void APIENTRY glResumeTransformFeedbackNV(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glResumeTransformFeedbackNV);
+}
+void APIENTRY glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRotated);
+}
+void APIENTRY glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRotatef);
+}
+void APIENTRY glRotatexOES(GLfixed angle, GLfixed x, GLfixed y, GLfixed z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glRotatexOES);
+}
+void APIENTRY glSampleCoverage(GLfloat value, GLboolean invert)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSampleCoverage);
+}
+void APIENTRY glSampleCoverageARB(GLfloat value, GLboolean invert)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSampleCoverageARB);
+}
+void APIENTRY glSampleCoveragexOES(GLclampx value, GLboolean invert)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSampleCoveragexOES);
+}
+void APIENTRY glSampleMapATI(GLuint dst, GLuint interp, GLenum swizzle)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSampleMapATI);
+}
+void APIENTRY glSampleMaskEXT(GLclampf value, GLboolean invert)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSampleMaskEXT);
+}
+void APIENTRY glSampleMaskIndexedNV(GLuint index, GLbitfield mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSampleMaskIndexedNV);
+}
+void APIENTRY glSampleMaskSGIS(GLclampf value, GLboolean invert)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSampleMaskSGIS);
+}
+void APIENTRY glSampleMaski(GLuint maskNumber, GLbitfield mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSampleMaski);
+}
+void APIENTRY glSamplePatternEXT(GLenum pattern)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSamplePatternEXT);
+}
+void APIENTRY glSamplePatternSGIS(GLenum pattern)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSamplePatternSGIS);
+}
+void APIENTRY glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSamplerParameterIiv);
+}
+void APIENTRY glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSamplerParameterIuiv);
+}
+void APIENTRY glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSamplerParameterf);
+}
+void APIENTRY glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSamplerParameterfv);
+}
+void APIENTRY glSamplerParameteri(GLuint sampler, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSamplerParameteri);
+}
+void APIENTRY glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSamplerParameteriv);
+}
+void APIENTRY glScaled(GLdouble x, GLdouble y, GLdouble z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glScaled);
+}
+void APIENTRY glScalef(GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glScalef);
+}
+void APIENTRY glScalexOES(GLfixed x, GLfixed y, GLfixed z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glScalexOES);
+}
+void APIENTRY glScissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glScissor);
+}
+void APIENTRY glScissorArrayv(GLuint first, GLsizei count, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glScissorArrayv);
+}
+void APIENTRY glScissorExclusiveArrayvNV(GLuint first, GLsizei count, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glScissorExclusiveArrayvNV);
+}
+void APIENTRY glScissorExclusiveNV(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glScissorExclusiveNV);
+}
+void APIENTRY glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glScissorIndexed);
+}
+void APIENTRY glScissorIndexedv(GLuint index, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glScissorIndexedv);
+}
+void APIENTRY glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3b);
+}
+void APIENTRY glSecondaryColor3bEXT(GLbyte red, GLbyte green, GLbyte blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3bEXT);
+}
+void APIENTRY glSecondaryColor3bv(const GLbyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3bv);
+}
+void APIENTRY glSecondaryColor3bvEXT(const GLbyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3bvEXT);
+}
+void APIENTRY glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3d);
+}
+void APIENTRY glSecondaryColor3dEXT(GLdouble red, GLdouble green, GLdouble blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3dEXT);
+}
+void APIENTRY glSecondaryColor3dv(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3dv);
+}
+void APIENTRY glSecondaryColor3dvEXT(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3dvEXT);
+}
+void APIENTRY glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3f);
+}
+void APIENTRY glSecondaryColor3fEXT(GLfloat red, GLfloat green, GLfloat blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3fEXT);
+}
+void APIENTRY glSecondaryColor3fv(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3fv);
+}
+void APIENTRY glSecondaryColor3fvEXT(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3fvEXT);
+}
+void APIENTRY glSecondaryColor3hNV(GLhalfNV red, GLhalfNV green, GLhalfNV blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3hNV);
+}
+void APIENTRY glSecondaryColor3hvNV(const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3hvNV);
+}
+void APIENTRY glSecondaryColor3i(GLint red, GLint green, GLint blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3i);
+}
+void APIENTRY glSecondaryColor3iEXT(GLint red, GLint green, GLint blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3iEXT);
+}
+void APIENTRY glSecondaryColor3iv(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3iv);
+}
+void APIENTRY glSecondaryColor3ivEXT(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3ivEXT);
+}
+void APIENTRY glSecondaryColor3s(GLshort red, GLshort green, GLshort blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3s);
+}
+void APIENTRY glSecondaryColor3sEXT(GLshort red, GLshort green, GLshort blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3sEXT);
+}
+void APIENTRY glSecondaryColor3sv(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3sv);
+}
+void APIENTRY glSecondaryColor3svEXT(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3svEXT);
+}
+void APIENTRY glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3ub);
+}
+void APIENTRY glSecondaryColor3ubEXT(GLubyte red, GLubyte green, GLubyte blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3ubEXT);
+}
+void APIENTRY glSecondaryColor3ubv(const GLubyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3ubv);
+}
+void APIENTRY glSecondaryColor3ubvEXT(const GLubyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3ubvEXT);
+}
+void APIENTRY glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3ui);
+}
+void APIENTRY glSecondaryColor3uiEXT(GLuint red, GLuint green, GLuint blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3uiEXT);
+}
+void APIENTRY glSecondaryColor3uiv(const GLuint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3uiv);
+}
+void APIENTRY glSecondaryColor3uivEXT(const GLuint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3uivEXT);
+}
+void APIENTRY glSecondaryColor3us(GLushort red, GLushort green, GLushort blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3us);
+}
+void APIENTRY glSecondaryColor3usEXT(GLushort red, GLushort green, GLushort blue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3usEXT);
+}
+void APIENTRY glSecondaryColor3usv(const GLushort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3usv);
+}
+void APIENTRY glSecondaryColor3usvEXT(const GLushort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColor3usvEXT);
+}
+void APIENTRY glSecondaryColorFormatNV(GLint size, GLenum type, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColorFormatNV);
+}
+void APIENTRY glSecondaryColorP3ui(GLenum type, GLuint color)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColorP3ui);
+}
+void APIENTRY glSecondaryColorP3uiv(GLenum type, const GLuint * color)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColorP3uiv);
+}
+void APIENTRY glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColorPointer);
+}
+void APIENTRY glSecondaryColorPointerEXT(GLint size, GLenum type, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColorPointerEXT);
+}
+void APIENTRY glSecondaryColorPointerListIBM(GLint size, GLenum type, GLint stride, const void ** pointer, GLint ptrstride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSecondaryColorPointerListIBM);
+}
+void APIENTRY glSelectBuffer(GLsizei size, GLuint * buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSelectBuffer);
+}
+void APIENTRY glSelectPerfMonitorCountersAMD(GLuint monitor, GLboolean enable, GLuint group, GLint numCounters, GLuint * counterList)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSelectPerfMonitorCountersAMD);
+}
+void APIENTRY glSemaphoreParameterivNV(GLuint semaphore, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSemaphoreParameterivNV);
+}
+void APIENTRY glSemaphoreParameterui64vEXT(GLuint semaphore, GLenum pname, const GLuint64 * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSemaphoreParameterui64vEXT);
+}
+void APIENTRY glSeparableFilter2D(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * row, const void * column)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSeparableFilter2D);
+}
+void APIENTRY glSeparableFilter2DEXT(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * row, const void * column)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSeparableFilter2DEXT);
+}
+void APIENTRY glSetFenceAPPLE(GLuint fence)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSetFenceAPPLE);
+}
+void APIENTRY glSetFenceNV(GLuint fence, GLenum condition)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSetFenceNV);
+}
+void APIENTRY glSetFragmentShaderConstantATI(GLuint dst, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSetFragmentShaderConstantATI);
+}
+void APIENTRY glSetInvariantEXT(GLuint id, GLenum type, const void * addr)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSetInvariantEXT);
+}
+void APIENTRY glSetLocalConstantEXT(GLuint id, GLenum type, const void * addr)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSetLocalConstantEXT);
+}
+void APIENTRY glSetMultisamplefvAMD(GLenum pname, GLuint index, const GLfloat * val)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSetMultisamplefvAMD);
+}
+void APIENTRY glShadeModel(GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glShadeModel);
+}
+void APIENTRY glShaderBinary(GLsizei count, const GLuint * shaders, GLenum binaryformat, const void * binary, GLsizei length)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glShaderBinary);
+}
+void APIENTRY glShaderOp1EXT(GLenum op, GLuint res, GLuint arg1)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glShaderOp1EXT);
+}
+void APIENTRY glShaderOp2EXT(GLenum op, GLuint res, GLuint arg1, GLuint arg2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glShaderOp2EXT);
+}
+void APIENTRY glShaderOp3EXT(GLenum op, GLuint res, GLuint arg1, GLuint arg2, GLuint arg3)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glShaderOp3EXT);
+}
+void APIENTRY glShaderSource(GLuint shader, GLsizei count, const GLchar *const* string, const GLint * length)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glShaderSource);
+}
+void APIENTRY glShaderSourceARB(GLhandleARB shaderObj, GLsizei count, const GLcharARB ** string, const GLint * length)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glShaderSourceARB);
+}
+void APIENTRY glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glShaderStorageBlockBinding);
+}
+void APIENTRY glShadingRateImageBarrierNV(GLboolean synchronize)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glShadingRateImageBarrierNV);
+}
+void APIENTRY glShadingRateImagePaletteNV(GLuint viewport, GLuint first, GLsizei count, const GLenum * rates)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glShadingRateImagePaletteNV);
+}
+void APIENTRY glShadingRateSampleOrderCustomNV(GLenum rate, GLuint samples, const GLint * locations)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glShadingRateSampleOrderCustomNV);
+}
+void APIENTRY glShadingRateSampleOrderNV(GLenum order)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glShadingRateSampleOrderNV);
+}
+void APIENTRY glSharpenTexFuncSGIS(GLenum target, GLsizei n, const GLfloat * points)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSharpenTexFuncSGIS);
+}
+void APIENTRY glSignalSemaphoreEXT(GLuint semaphore, GLuint numBufferBarriers, const GLuint * buffers, GLuint numTextureBarriers, const GLuint * textures, const GLenum * dstLayouts)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSignalSemaphoreEXT);
+}
+void APIENTRY glSignalSemaphoreui64NVX(GLuint signalGpu, GLsizei fenceObjectCount, const GLuint * semaphoreArray, const GLuint64 * fenceValueArray)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSignalSemaphoreui64NVX);
+}
+void APIENTRY glSignalVkFenceNV(GLuint64 vkFence)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSignalVkFenceNV);
+}
+void APIENTRY glSignalVkSemaphoreNV(GLuint64 vkSemaphore)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSignalVkSemaphoreNV);
+}
+void APIENTRY glSpecializeShader(GLuint shader, const GLchar * pEntryPoint, GLuint numSpecializationConstants, const GLuint * pConstantIndex, const GLuint * pConstantValue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSpecializeShader);
+}
+void APIENTRY glSpecializeShaderARB(GLuint shader, const GLchar * pEntryPoint, GLuint numSpecializationConstants, const GLuint * pConstantIndex, const GLuint * pConstantValue)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSpecializeShaderARB);
+}
+void APIENTRY glSpriteParameterfSGIX(GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSpriteParameterfSGIX);
+}
+void APIENTRY glSpriteParameterfvSGIX(GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSpriteParameterfvSGIX);
+}
+void APIENTRY glSpriteParameteriSGIX(GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSpriteParameteriSGIX);
+}
+void APIENTRY glSpriteParameterivSGIX(GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSpriteParameterivSGIX);
+}
+void APIENTRY glStartInstrumentsSGIX(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStartInstrumentsSGIX);
+}
+void APIENTRY glStateCaptureNV(GLuint state, GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStateCaptureNV);
+}
+void APIENTRY glStencilClearTagEXT(GLsizei stencilTagBits, GLuint stencilClearTag)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStencilClearTagEXT);
+}
+void APIENTRY glStencilFillPathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void * paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum transformType, const GLfloat * transformValues)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStencilFillPathInstancedNV);
+}
+void APIENTRY glStencilFillPathNV(GLuint path, GLenum fillMode, GLuint mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStencilFillPathNV);
+}
+void APIENTRY glStencilFunc(GLenum func, GLint ref, GLuint mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStencilFunc);
+}
+void APIENTRY glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStencilFuncSeparate);
+}
+void APIENTRY glStencilFuncSeparateATI(GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStencilFuncSeparateATI);
+}
+void APIENTRY glStencilMask(GLuint mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStencilMask);
+}
+void APIENTRY glStencilMaskSeparate(GLenum face, GLuint mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStencilMaskSeparate);
+}
+void APIENTRY glStencilOp(GLenum fail, GLenum zfail, GLenum zpass)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStencilOp);
+}
+void APIENTRY glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStencilOpSeparate);
+}
+void APIENTRY glStencilOpSeparateATI(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStencilOpSeparateATI);
+}
+void APIENTRY glStencilOpValueAMD(GLenum face, GLuint value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStencilOpValueAMD);
+}
+void APIENTRY glStencilStrokePathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void * paths, GLuint pathBase, GLint reference, GLuint mask, GLenum transformType, const GLfloat * transformValues)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStencilStrokePathInstancedNV);
+}
+void APIENTRY glStencilStrokePathNV(GLuint path, GLint reference, GLuint mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStencilStrokePathNV);
+}
+void APIENTRY glStencilThenCoverFillPathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void * paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat * transformValues)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStencilThenCoverFillPathInstancedNV);
+}
+void APIENTRY glStencilThenCoverFillPathNV(GLuint path, GLenum fillMode, GLuint mask, GLenum coverMode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStencilThenCoverFillPathNV);
+}
+void APIENTRY glStencilThenCoverStrokePathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void * paths, GLuint pathBase, GLint reference, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat * transformValues)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStencilThenCoverStrokePathInstancedNV);
+}
+void APIENTRY glStencilThenCoverStrokePathNV(GLuint path, GLint reference, GLuint mask, GLenum coverMode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStencilThenCoverStrokePathNV);
+}
+void APIENTRY glStopInstrumentsSGIX(GLint marker)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStopInstrumentsSGIX);
+}
+void APIENTRY glStringMarkerGREMEDY(GLsizei len, const void * string)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glStringMarkerGREMEDY);
+}
+void APIENTRY glSubpixelPrecisionBiasNV(GLuint xbits, GLuint ybits)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSubpixelPrecisionBiasNV);
+}
+void APIENTRY glSwizzleEXT(GLuint res, GLuint in, GLenum outX, GLenum outY, GLenum outZ, GLenum outW)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSwizzleEXT);
+}
+void APIENTRY glSyncTextureINTEL(GLuint texture)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glSyncTextureINTEL);
+}
+void APIENTRY glTagSampleBufferSGIX(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTagSampleBufferSGIX);
+}
+void APIENTRY glTangent3bEXT(GLbyte tx, GLbyte ty, GLbyte tz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTangent3bEXT);
+}
+void APIENTRY glTangent3bvEXT(const GLbyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTangent3bvEXT);
+}
+void APIENTRY glTangent3dEXT(GLdouble tx, GLdouble ty, GLdouble tz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTangent3dEXT);
+}
+void APIENTRY glTangent3dvEXT(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTangent3dvEXT);
+}
+void APIENTRY glTangent3fEXT(GLfloat tx, GLfloat ty, GLfloat tz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTangent3fEXT);
+}
+void APIENTRY glTangent3fvEXT(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTangent3fvEXT);
+}
+void APIENTRY glTangent3iEXT(GLint tx, GLint ty, GLint tz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTangent3iEXT);
+}
+void APIENTRY glTangent3ivEXT(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTangent3ivEXT);
+}
+void APIENTRY glTangent3sEXT(GLshort tx, GLshort ty, GLshort tz)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTangent3sEXT);
+}
+void APIENTRY glTangent3svEXT(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTangent3svEXT);
+}
+void APIENTRY glTangentPointerEXT(GLenum type, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTangentPointerEXT);
+}
+void APIENTRY glTbufferMask3DFX(GLuint mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTbufferMask3DFX);
+}
+void APIENTRY glTessellationFactorAMD(GLfloat factor)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTessellationFactorAMD);
+}
+void APIENTRY glTessellationModeAMD(GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTessellationModeAMD);
+}
+GLboolean APIENTRY glTestFenceAPPLE(GLuint fence)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTestFenceAPPLE);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glTestFenceNV(GLuint fence)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTestFenceNV);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glTestObjectAPPLE(GLenum object, GLuint name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTestObjectAPPLE);
+    return (GLboolean)0;
+}
+void APIENTRY glTexAttachMemoryNV(GLenum target, GLuint memory, GLuint64 offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexAttachMemoryNV);
+}
+void APIENTRY glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexBuffer);
+}
+void APIENTRY glTexBufferARB(GLenum target, GLenum internalformat, GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexBufferARB);
+}
+void APIENTRY glTexBufferEXT(GLenum target, GLenum internalformat, GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexBufferEXT);
+}
+void APIENTRY glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexBufferRange);
+}
+void APIENTRY glTexBumpParameterfvATI(GLenum pname, const GLfloat * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexBumpParameterfvATI);
+}
+void APIENTRY glTexBumpParameterivATI(GLenum pname, const GLint * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexBumpParameterivATI);
+}
+void APIENTRY glTexCoord1bOES(GLbyte s)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord1bOES);
+}
+void APIENTRY glTexCoord1bvOES(const GLbyte * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord1bvOES);
+}
+void APIENTRY glTexCoord1d(GLdouble s)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord1d);
+}
+void APIENTRY glTexCoord1dv(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord1dv);
+}
+void APIENTRY glTexCoord1f(GLfloat s)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord1f);
+}
+void APIENTRY glTexCoord1fv(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord1fv);
+}
+void APIENTRY glTexCoord1hNV(GLhalfNV s)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord1hNV);
+}
+void APIENTRY glTexCoord1hvNV(const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord1hvNV);
+}
+void APIENTRY glTexCoord1i(GLint s)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord1i);
+}
+void APIENTRY glTexCoord1iv(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord1iv);
+}
+void APIENTRY glTexCoord1s(GLshort s)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord1s);
+}
+void APIENTRY glTexCoord1sv(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord1sv);
+}
+void APIENTRY glTexCoord1xOES(GLfixed s)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord1xOES);
+}
+void APIENTRY glTexCoord1xvOES(const GLfixed * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord1xvOES);
+}
+void APIENTRY glTexCoord2bOES(GLbyte s, GLbyte t)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2bOES);
+}
+void APIENTRY glTexCoord2bvOES(const GLbyte * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2bvOES);
+}
+void APIENTRY glTexCoord2d(GLdouble s, GLdouble t)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2d);
+}
+void APIENTRY glTexCoord2dv(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2dv);
+}
+void APIENTRY glTexCoord2f(GLfloat s, GLfloat t)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2f);
+}
+void APIENTRY glTexCoord2fColor3fVertex3fSUN(GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2fColor3fVertex3fSUN);
+}
+void APIENTRY glTexCoord2fColor3fVertex3fvSUN(const GLfloat * tc, const GLfloat * c, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2fColor3fVertex3fvSUN);
+}
+void APIENTRY glTexCoord2fColor4fNormal3fVertex3fSUN(GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2fColor4fNormal3fVertex3fSUN);
+}
+void APIENTRY glTexCoord2fColor4fNormal3fVertex3fvSUN(const GLfloat * tc, const GLfloat * c, const GLfloat * n, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2fColor4fNormal3fVertex3fvSUN);
+}
+void APIENTRY glTexCoord2fColor4ubVertex3fSUN(GLfloat s, GLfloat t, GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2fColor4ubVertex3fSUN);
+}
+void APIENTRY glTexCoord2fColor4ubVertex3fvSUN(const GLfloat * tc, const GLubyte * c, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2fColor4ubVertex3fvSUN);
+}
+void APIENTRY glTexCoord2fNormal3fVertex3fSUN(GLfloat s, GLfloat t, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2fNormal3fVertex3fSUN);
+}
+void APIENTRY glTexCoord2fNormal3fVertex3fvSUN(const GLfloat * tc, const GLfloat * n, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2fNormal3fVertex3fvSUN);
+}
+void APIENTRY glTexCoord2fVertex3fSUN(GLfloat s, GLfloat t, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2fVertex3fSUN);
+}
+void APIENTRY glTexCoord2fVertex3fvSUN(const GLfloat * tc, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2fVertex3fvSUN);
+}
+void APIENTRY glTexCoord2fv(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2fv);
+}
+void APIENTRY glTexCoord2hNV(GLhalfNV s, GLhalfNV t)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2hNV);
+}
+void APIENTRY glTexCoord2hvNV(const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2hvNV);
+}
+void APIENTRY glTexCoord2i(GLint s, GLint t)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2i);
+}
+void APIENTRY glTexCoord2iv(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2iv);
+}
+void APIENTRY glTexCoord2s(GLshort s, GLshort t)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2s);
+}
+void APIENTRY glTexCoord2sv(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2sv);
+}
+void APIENTRY glTexCoord2xOES(GLfixed s, GLfixed t)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2xOES);
+}
+void APIENTRY glTexCoord2xvOES(const GLfixed * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord2xvOES);
+}
+void APIENTRY glTexCoord3bOES(GLbyte s, GLbyte t, GLbyte r)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord3bOES);
+}
+void APIENTRY glTexCoord3bvOES(const GLbyte * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord3bvOES);
+}
+void APIENTRY glTexCoord3d(GLdouble s, GLdouble t, GLdouble r)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord3d);
+}
+void APIENTRY glTexCoord3dv(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord3dv);
+}
+void APIENTRY glTexCoord3f(GLfloat s, GLfloat t, GLfloat r)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord3f);
+}
+void APIENTRY glTexCoord3fv(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord3fv);
+}
+void APIENTRY glTexCoord3hNV(GLhalfNV s, GLhalfNV t, GLhalfNV r)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord3hNV);
+}
+void APIENTRY glTexCoord3hvNV(const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord3hvNV);
+}
+void APIENTRY glTexCoord3i(GLint s, GLint t, GLint r)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord3i);
+}
+void APIENTRY glTexCoord3iv(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord3iv);
+}
+void APIENTRY glTexCoord3s(GLshort s, GLshort t, GLshort r)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord3s);
+}
+void APIENTRY glTexCoord3sv(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord3sv);
+}
+void APIENTRY glTexCoord3xOES(GLfixed s, GLfixed t, GLfixed r)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord3xOES);
+}
+void APIENTRY glTexCoord3xvOES(const GLfixed * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord3xvOES);
+}
+void APIENTRY glTexCoord4bOES(GLbyte s, GLbyte t, GLbyte r, GLbyte q)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord4bOES);
+}
+void APIENTRY glTexCoord4bvOES(const GLbyte * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord4bvOES);
+}
+void APIENTRY glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord4d);
+}
+void APIENTRY glTexCoord4dv(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord4dv);
+}
+void APIENTRY glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord4f);
+}
+void APIENTRY glTexCoord4fColor4fNormal3fVertex4fSUN(GLfloat s, GLfloat t, GLfloat p, GLfloat q, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord4fColor4fNormal3fVertex4fSUN);
+}
+void APIENTRY glTexCoord4fColor4fNormal3fVertex4fvSUN(const GLfloat * tc, const GLfloat * c, const GLfloat * n, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord4fColor4fNormal3fVertex4fvSUN);
+}
+void APIENTRY glTexCoord4fVertex4fSUN(GLfloat s, GLfloat t, GLfloat p, GLfloat q, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord4fVertex4fSUN);
+}
+void APIENTRY glTexCoord4fVertex4fvSUN(const GLfloat * tc, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord4fVertex4fvSUN);
+}
+void APIENTRY glTexCoord4fv(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord4fv);
+}
+void APIENTRY glTexCoord4hNV(GLhalfNV s, GLhalfNV t, GLhalfNV r, GLhalfNV q)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord4hNV);
+}
+void APIENTRY glTexCoord4hvNV(const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord4hvNV);
+}
+void APIENTRY glTexCoord4i(GLint s, GLint t, GLint r, GLint q)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord4i);
+}
+void APIENTRY glTexCoord4iv(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord4iv);
+}
+void APIENTRY glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord4s);
+}
+void APIENTRY glTexCoord4sv(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord4sv);
+}
+void APIENTRY glTexCoord4xOES(GLfixed s, GLfixed t, GLfixed r, GLfixed q)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord4xOES);
+}
+void APIENTRY glTexCoord4xvOES(const GLfixed * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoord4xvOES);
+}
+void APIENTRY glTexCoordFormatNV(GLint size, GLenum type, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoordFormatNV);
+}
+void APIENTRY glTexCoordP1ui(GLenum type, GLuint coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoordP1ui);
+}
+void APIENTRY glTexCoordP1uiv(GLenum type, const GLuint * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoordP1uiv);
+}
+void APIENTRY glTexCoordP2ui(GLenum type, GLuint coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoordP2ui);
+}
+void APIENTRY glTexCoordP2uiv(GLenum type, const GLuint * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoordP2uiv);
+}
+void APIENTRY glTexCoordP3ui(GLenum type, GLuint coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoordP3ui);
+}
+void APIENTRY glTexCoordP3uiv(GLenum type, const GLuint * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoordP3uiv);
+}
+void APIENTRY glTexCoordP4ui(GLenum type, GLuint coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoordP4ui);
+}
+void APIENTRY glTexCoordP4uiv(GLenum type, const GLuint * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoordP4uiv);
+}
+void APIENTRY glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoordPointer);
+}
+void APIENTRY glTexCoordPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei count, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoordPointerEXT);
+}
+void APIENTRY glTexCoordPointerListIBM(GLint size, GLenum type, GLint stride, const void ** pointer, GLint ptrstride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoordPointerListIBM);
+}
+void APIENTRY glTexCoordPointervINTEL(GLint size, GLenum type, const void ** pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexCoordPointervINTEL);
+}
+void APIENTRY glTexEnvf(GLenum target, GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexEnvf);
+}
+void APIENTRY glTexEnvfv(GLenum target, GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexEnvfv);
+}
+void APIENTRY glTexEnvi(GLenum target, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexEnvi);
+}
+void APIENTRY glTexEnviv(GLenum target, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexEnviv);
+}
+void APIENTRY glTexEnvxOES(GLenum target, GLenum pname, GLfixed param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexEnvxOES);
+}
+void APIENTRY glTexEnvxvOES(GLenum target, GLenum pname, const GLfixed * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexEnvxvOES);
+}
+void APIENTRY glTexFilterFuncSGIS(GLenum target, GLenum filter, GLsizei n, const GLfloat * weights)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexFilterFuncSGIS);
+}
+void APIENTRY glTexGend(GLenum coord, GLenum pname, GLdouble param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexGend);
+}
+void APIENTRY glTexGendv(GLenum coord, GLenum pname, const GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexGendv);
+}
+void APIENTRY glTexGenf(GLenum coord, GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexGenf);
+}
+void APIENTRY glTexGenfv(GLenum coord, GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexGenfv);
+}
+void APIENTRY glTexGeni(GLenum coord, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexGeni);
+}
+void APIENTRY glTexGeniv(GLenum coord, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexGeniv);
+}
+void APIENTRY glTexGenxOES(GLenum coord, GLenum pname, GLfixed param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexGenxOES);
+}
+void APIENTRY glTexGenxvOES(GLenum coord, GLenum pname, const GLfixed * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexGenxvOES);
+}
+void APIENTRY glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexImage1D);
+}
+void APIENTRY glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexImage2D);
+}
+void APIENTRY glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexImage2DMultisample);
+}
+void APIENTRY glTexImage2DMultisampleCoverageNV(GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexImage2DMultisampleCoverageNV);
+}
+void APIENTRY glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexImage3D);
+}
+void APIENTRY glTexImage3DEXT(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexImage3DEXT);
+}
+void APIENTRY glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexImage3DMultisample);
+}
+void APIENTRY glTexImage3DMultisampleCoverageNV(GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexImage3DMultisampleCoverageNV);
+}
+void APIENTRY glTexImage4DSGIS(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLint border, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexImage4DSGIS);
+}
+void APIENTRY glTexPageCommitmentARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexPageCommitmentARB);
+}
+void APIENTRY glTexPageCommitmentMemNV(GLenum target, GLint layer, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset, GLboolean commit)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexPageCommitmentMemNV);
+}
+void APIENTRY glTexParameterIiv(GLenum target, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexParameterIiv);
+}
+void APIENTRY glTexParameterIivEXT(GLenum target, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexParameterIivEXT);
+}
+void APIENTRY glTexParameterIuiv(GLenum target, GLenum pname, const GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexParameterIuiv);
+}
+void APIENTRY glTexParameterIuivEXT(GLenum target, GLenum pname, const GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexParameterIuivEXT);
+}
+void APIENTRY glTexParameterf(GLenum target, GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexParameterf);
+}
+void APIENTRY glTexParameterfv(GLenum target, GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexParameterfv);
+}
+void APIENTRY glTexParameteri(GLenum target, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexParameteri);
+}
+void APIENTRY glTexParameteriv(GLenum target, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexParameteriv);
+}
+void APIENTRY glTexParameterxOES(GLenum target, GLenum pname, GLfixed param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexParameterxOES);
+}
+void APIENTRY glTexParameterxvOES(GLenum target, GLenum pname, const GLfixed * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexParameterxvOES);
+}
+void APIENTRY glTexRenderbufferNV(GLenum target, GLuint renderbuffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexRenderbufferNV);
+}
+void APIENTRY glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexStorage1D);
+}
+void APIENTRY glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexStorage2D);
+}
+void APIENTRY glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexStorage2DMultisample);
+}
+void APIENTRY glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexStorage3D);
+}
+void APIENTRY glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexStorage3DMultisample);
+}
+void APIENTRY glTexStorageMem1DEXT(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexStorageMem1DEXT);
+}
+void APIENTRY glTexStorageMem2DEXT(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexStorageMem2DEXT);
+}
+void APIENTRY glTexStorageMem2DMultisampleEXT(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexStorageMem2DMultisampleEXT);
+}
+void APIENTRY glTexStorageMem3DEXT(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexStorageMem3DEXT);
+}
+void APIENTRY glTexStorageMem3DMultisampleEXT(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexStorageMem3DMultisampleEXT);
+}
+void APIENTRY glTexStorageSparseAMD(GLenum target, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLsizei layers, GLbitfield flags)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexStorageSparseAMD);
+}
+void APIENTRY glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexSubImage1D);
+}
+void APIENTRY glTexSubImage1DEXT(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexSubImage1DEXT);
+}
+void APIENTRY glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexSubImage2D);
+}
+void APIENTRY glTexSubImage2DEXT(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexSubImage2DEXT);
+}
+void APIENTRY glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexSubImage3D);
+}
+void APIENTRY glTexSubImage3DEXT(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexSubImage3DEXT);
+}
+void APIENTRY glTexSubImage4DSGIS(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint woffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexSubImage4DSGIS);
+}
+void APIENTRY glTextureAttachMemoryNV(GLuint texture, GLuint memory, GLuint64 offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureAttachMemoryNV);
+}
+void APIENTRY glTextureBarrier(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureBarrier);
+}
+void APIENTRY glTextureBarrierNV(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureBarrierNV);
+}
+void APIENTRY glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureBuffer);
+}
+void APIENTRY glTextureBufferEXT(GLuint texture, GLenum target, GLenum internalformat, GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureBufferEXT);
+}
+void APIENTRY glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureBufferRange);
+}
+void APIENTRY glTextureBufferRangeEXT(GLuint texture, GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureBufferRangeEXT);
+}
+void APIENTRY glTextureColorMaskSGIS(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureColorMaskSGIS);
+}
+void APIENTRY glTextureImage1DEXT(GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureImage1DEXT);
+}
+void APIENTRY glTextureImage2DEXT(GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureImage2DEXT);
+}
+void APIENTRY glTextureImage2DMultisampleCoverageNV(GLuint texture, GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureImage2DMultisampleCoverageNV);
+}
+void APIENTRY glTextureImage2DMultisampleNV(GLuint texture, GLenum target, GLsizei samples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureImage2DMultisampleNV);
+}
+void APIENTRY glTextureImage3DEXT(GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureImage3DEXT);
+}
+void APIENTRY glTextureImage3DMultisampleCoverageNV(GLuint texture, GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureImage3DMultisampleCoverageNV);
+}
+void APIENTRY glTextureImage3DMultisampleNV(GLuint texture, GLenum target, GLsizei samples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureImage3DMultisampleNV);
+}
+void APIENTRY glTextureLightEXT(GLenum pname)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureLightEXT);
+}
+void APIENTRY glTextureMaterialEXT(GLenum face, GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureMaterialEXT);
+}
+void APIENTRY glTextureNormalEXT(GLenum mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureNormalEXT);
+}
+void APIENTRY glTexturePageCommitmentEXT(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexturePageCommitmentEXT);
+}
+void APIENTRY glTexturePageCommitmentMemNV(GLuint texture, GLint layer, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset, GLboolean commit)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTexturePageCommitmentMemNV);
+}
+void APIENTRY glTextureParameterIiv(GLuint texture, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureParameterIiv);
+}
+void APIENTRY glTextureParameterIivEXT(GLuint texture, GLenum target, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureParameterIivEXT);
+}
+void APIENTRY glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureParameterIuiv);
+}
+void APIENTRY glTextureParameterIuivEXT(GLuint texture, GLenum target, GLenum pname, const GLuint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureParameterIuivEXT);
+}
+void APIENTRY glTextureParameterf(GLuint texture, GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureParameterf);
+}
+void APIENTRY glTextureParameterfEXT(GLuint texture, GLenum target, GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureParameterfEXT);
+}
+void APIENTRY glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureParameterfv);
+}
+void APIENTRY glTextureParameterfvEXT(GLuint texture, GLenum target, GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureParameterfvEXT);
+}
+void APIENTRY glTextureParameteri(GLuint texture, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureParameteri);
+}
+void APIENTRY glTextureParameteriEXT(GLuint texture, GLenum target, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureParameteriEXT);
+}
+void APIENTRY glTextureParameteriv(GLuint texture, GLenum pname, const GLint * param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureParameteriv);
+}
+void APIENTRY glTextureParameterivEXT(GLuint texture, GLenum target, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureParameterivEXT);
+}
+void APIENTRY glTextureRangeAPPLE(GLenum target, GLsizei length, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureRangeAPPLE);
+}
+void APIENTRY glTextureRenderbufferEXT(GLuint texture, GLenum target, GLuint renderbuffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureRenderbufferEXT);
+}
+void APIENTRY glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureStorage1D);
+}
+void APIENTRY glTextureStorage1DEXT(GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureStorage1DEXT);
+}
+void APIENTRY glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureStorage2D);
+}
+void APIENTRY glTextureStorage2DEXT(GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureStorage2DEXT);
+}
+void APIENTRY glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureStorage2DMultisample);
+}
+void APIENTRY glTextureStorage2DMultisampleEXT(GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureStorage2DMultisampleEXT);
+}
+void APIENTRY glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureStorage3D);
+}
+void APIENTRY glTextureStorage3DEXT(GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureStorage3DEXT);
+}
+void APIENTRY glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureStorage3DMultisample);
+}
+void APIENTRY glTextureStorage3DMultisampleEXT(GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureStorage3DMultisampleEXT);
+}
+void APIENTRY glTextureStorageMem1DEXT(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureStorageMem1DEXT);
+}
+void APIENTRY glTextureStorageMem2DEXT(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureStorageMem2DEXT);
+}
+void APIENTRY glTextureStorageMem2DMultisampleEXT(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureStorageMem2DMultisampleEXT);
+}
+void APIENTRY glTextureStorageMem3DEXT(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureStorageMem3DEXT);
+}
+void APIENTRY glTextureStorageMem3DMultisampleEXT(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureStorageMem3DMultisampleEXT);
+}
+void APIENTRY glTextureStorageSparseAMD(GLuint texture, GLenum target, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLsizei layers, GLbitfield flags)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureStorageSparseAMD);
+}
+void APIENTRY glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureSubImage1D);
+}
+void APIENTRY glTextureSubImage1DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureSubImage1DEXT);
+}
+void APIENTRY glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureSubImage2D);
+}
+void APIENTRY glTextureSubImage2DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureSubImage2DEXT);
+}
+void APIENTRY glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureSubImage3D);
+}
+void APIENTRY glTextureSubImage3DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureSubImage3DEXT);
+}
+void APIENTRY glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTextureView);
+}
+void APIENTRY glTrackMatrixNV(GLenum target, GLuint address, GLenum matrix, GLenum transform)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTrackMatrixNV);
+}
+void APIENTRY glTransformFeedbackAttribsNV(GLsizei count, const GLint * attribs, GLenum bufferMode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTransformFeedbackAttribsNV);
+}
+void APIENTRY glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTransformFeedbackBufferBase);
+}
+void APIENTRY glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTransformFeedbackBufferRange);
+}
+void APIENTRY glTransformFeedbackStreamAttribsNV(GLsizei count, const GLint * attribs, GLsizei nbuffers, const GLint * bufstreams, GLenum bufferMode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTransformFeedbackStreamAttribsNV);
+}
+void APIENTRY glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const* varyings, GLenum bufferMode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTransformFeedbackVaryings);
+}
+void APIENTRY glTransformFeedbackVaryingsEXT(GLuint program, GLsizei count, const GLchar *const* varyings, GLenum bufferMode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTransformFeedbackVaryingsEXT);
+}
+void APIENTRY glTransformFeedbackVaryingsNV(GLuint program, GLsizei count, const GLint * locations, GLenum bufferMode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTransformFeedbackVaryingsNV);
+}
+void APIENTRY glTransformPathNV(GLuint resultPath, GLuint srcPath, GLenum transformType, const GLfloat * transformValues)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTransformPathNV);
+}
+void APIENTRY glTranslated(GLdouble x, GLdouble y, GLdouble z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTranslated);
+}
+void APIENTRY glTranslatef(GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTranslatef);
+}
+void APIENTRY glTranslatexOES(GLfixed x, GLfixed y, GLfixed z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glTranslatexOES);
+}
+void APIENTRY glUniform1d(GLint location, GLdouble x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1d);
+}
+void APIENTRY glUniform1dv(GLint location, GLsizei count, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1dv);
+}
+void APIENTRY glUniform1f(GLint location, GLfloat v0)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1f);
+}
+void APIENTRY glUniform1fARB(GLint location, GLfloat v0)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1fARB);
+}
+void APIENTRY glUniform1fv(GLint location, GLsizei count, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1fv);
+}
+void APIENTRY glUniform1fvARB(GLint location, GLsizei count, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1fvARB);
+}
+void APIENTRY glUniform1i(GLint location, GLint v0)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1i);
+}
+void APIENTRY glUniform1i64ARB(GLint location, GLint64 x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1i64ARB);
+}
+void APIENTRY glUniform1i64NV(GLint location, GLint64EXT x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1i64NV);
+}
+void APIENTRY glUniform1i64vARB(GLint location, GLsizei count, const GLint64 * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1i64vARB);
+}
+void APIENTRY glUniform1i64vNV(GLint location, GLsizei count, const GLint64EXT * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1i64vNV);
+}
+void APIENTRY glUniform1iARB(GLint location, GLint v0)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1iARB);
+}
+void APIENTRY glUniform1iv(GLint location, GLsizei count, const GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1iv);
+}
+void APIENTRY glUniform1ivARB(GLint location, GLsizei count, const GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1ivARB);
+}
+void APIENTRY glUniform1ui(GLint location, GLuint v0)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1ui);
+}
+void APIENTRY glUniform1ui64ARB(GLint location, GLuint64 x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1ui64ARB);
+}
+void APIENTRY glUniform1ui64NV(GLint location, GLuint64EXT x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1ui64NV);
+}
+void APIENTRY glUniform1ui64vARB(GLint location, GLsizei count, const GLuint64 * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1ui64vARB);
+}
+void APIENTRY glUniform1ui64vNV(GLint location, GLsizei count, const GLuint64EXT * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1ui64vNV);
+}
+void APIENTRY glUniform1uiEXT(GLint location, GLuint v0)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1uiEXT);
+}
+void APIENTRY glUniform1uiv(GLint location, GLsizei count, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1uiv);
+}
+void APIENTRY glUniform1uivEXT(GLint location, GLsizei count, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform1uivEXT);
+}
+void APIENTRY glUniform2d(GLint location, GLdouble x, GLdouble y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2d);
+}
+void APIENTRY glUniform2dv(GLint location, GLsizei count, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2dv);
+}
+void APIENTRY glUniform2f(GLint location, GLfloat v0, GLfloat v1)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2f);
+}
+void APIENTRY glUniform2fARB(GLint location, GLfloat v0, GLfloat v1)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2fARB);
+}
+void APIENTRY glUniform2fv(GLint location, GLsizei count, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2fv);
+}
+void APIENTRY glUniform2fvARB(GLint location, GLsizei count, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2fvARB);
+}
+void APIENTRY glUniform2i(GLint location, GLint v0, GLint v1)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2i);
+}
+void APIENTRY glUniform2i64ARB(GLint location, GLint64 x, GLint64 y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2i64ARB);
+}
+void APIENTRY glUniform2i64NV(GLint location, GLint64EXT x, GLint64EXT y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2i64NV);
+}
+void APIENTRY glUniform2i64vARB(GLint location, GLsizei count, const GLint64 * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2i64vARB);
+}
+void APIENTRY glUniform2i64vNV(GLint location, GLsizei count, const GLint64EXT * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2i64vNV);
+}
+void APIENTRY glUniform2iARB(GLint location, GLint v0, GLint v1)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2iARB);
+}
+void APIENTRY glUniform2iv(GLint location, GLsizei count, const GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2iv);
+}
+void APIENTRY glUniform2ivARB(GLint location, GLsizei count, const GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2ivARB);
+}
+void APIENTRY glUniform2ui(GLint location, GLuint v0, GLuint v1)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2ui);
+}
+void APIENTRY glUniform2ui64ARB(GLint location, GLuint64 x, GLuint64 y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2ui64ARB);
+}
+void APIENTRY glUniform2ui64NV(GLint location, GLuint64EXT x, GLuint64EXT y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2ui64NV);
+}
+void APIENTRY glUniform2ui64vARB(GLint location, GLsizei count, const GLuint64 * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2ui64vARB);
+}
+void APIENTRY glUniform2ui64vNV(GLint location, GLsizei count, const GLuint64EXT * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2ui64vNV);
+}
+void APIENTRY glUniform2uiEXT(GLint location, GLuint v0, GLuint v1)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2uiEXT);
+}
+void APIENTRY glUniform2uiv(GLint location, GLsizei count, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2uiv);
+}
+void APIENTRY glUniform2uivEXT(GLint location, GLsizei count, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform2uivEXT);
+}
+void APIENTRY glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3d);
+}
+void APIENTRY glUniform3dv(GLint location, GLsizei count, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3dv);
+}
+void APIENTRY glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3f);
+}
+void APIENTRY glUniform3fARB(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3fARB);
+}
+void APIENTRY glUniform3fv(GLint location, GLsizei count, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3fv);
+}
+void APIENTRY glUniform3fvARB(GLint location, GLsizei count, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3fvARB);
+}
+void APIENTRY glUniform3i(GLint location, GLint v0, GLint v1, GLint v2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3i);
+}
+void APIENTRY glUniform3i64ARB(GLint location, GLint64 x, GLint64 y, GLint64 z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3i64ARB);
+}
+void APIENTRY glUniform3i64NV(GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3i64NV);
+}
+void APIENTRY glUniform3i64vARB(GLint location, GLsizei count, const GLint64 * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3i64vARB);
+}
+void APIENTRY glUniform3i64vNV(GLint location, GLsizei count, const GLint64EXT * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3i64vNV);
+}
+void APIENTRY glUniform3iARB(GLint location, GLint v0, GLint v1, GLint v2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3iARB);
+}
+void APIENTRY glUniform3iv(GLint location, GLsizei count, const GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3iv);
+}
+void APIENTRY glUniform3ivARB(GLint location, GLsizei count, const GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3ivARB);
+}
+void APIENTRY glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3ui);
+}
+void APIENTRY glUniform3ui64ARB(GLint location, GLuint64 x, GLuint64 y, GLuint64 z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3ui64ARB);
+}
+void APIENTRY glUniform3ui64NV(GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3ui64NV);
+}
+void APIENTRY glUniform3ui64vARB(GLint location, GLsizei count, const GLuint64 * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3ui64vARB);
+}
+void APIENTRY glUniform3ui64vNV(GLint location, GLsizei count, const GLuint64EXT * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3ui64vNV);
+}
+void APIENTRY glUniform3uiEXT(GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3uiEXT);
+}
+void APIENTRY glUniform3uiv(GLint location, GLsizei count, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3uiv);
+}
+void APIENTRY glUniform3uivEXT(GLint location, GLsizei count, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform3uivEXT);
+}
+void APIENTRY glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4d);
+}
+void APIENTRY glUniform4dv(GLint location, GLsizei count, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4dv);
+}
+void APIENTRY glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4f);
+}
+void APIENTRY glUniform4fARB(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4fARB);
+}
+void APIENTRY glUniform4fv(GLint location, GLsizei count, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4fv);
+}
+void APIENTRY glUniform4fvARB(GLint location, GLsizei count, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4fvARB);
+}
+void APIENTRY glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4i);
+}
+void APIENTRY glUniform4i64ARB(GLint location, GLint64 x, GLint64 y, GLint64 z, GLint64 w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4i64ARB);
+}
+void APIENTRY glUniform4i64NV(GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4i64NV);
+}
+void APIENTRY glUniform4i64vARB(GLint location, GLsizei count, const GLint64 * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4i64vARB);
+}
+void APIENTRY glUniform4i64vNV(GLint location, GLsizei count, const GLint64EXT * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4i64vNV);
+}
+void APIENTRY glUniform4iARB(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4iARB);
+}
+void APIENTRY glUniform4iv(GLint location, GLsizei count, const GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4iv);
+}
+void APIENTRY glUniform4ivARB(GLint location, GLsizei count, const GLint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4ivARB);
+}
+void APIENTRY glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4ui);
+}
+void APIENTRY glUniform4ui64ARB(GLint location, GLuint64 x, GLuint64 y, GLuint64 z, GLuint64 w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4ui64ARB);
+}
+void APIENTRY glUniform4ui64NV(GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4ui64NV);
+}
+void APIENTRY glUniform4ui64vARB(GLint location, GLsizei count, const GLuint64 * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4ui64vARB);
+}
+void APIENTRY glUniform4ui64vNV(GLint location, GLsizei count, const GLuint64EXT * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4ui64vNV);
+}
+void APIENTRY glUniform4uiEXT(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4uiEXT);
+}
+void APIENTRY glUniform4uiv(GLint location, GLsizei count, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4uiv);
+}
+void APIENTRY glUniform4uivEXT(GLint location, GLsizei count, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniform4uivEXT);
+}
+void APIENTRY glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformBlockBinding);
+}
+void APIENTRY glUniformBufferEXT(GLuint program, GLint location, GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformBufferEXT);
+}
+void APIENTRY glUniformHandleui64ARB(GLint location, GLuint64 value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformHandleui64ARB);
+}
+void APIENTRY glUniformHandleui64NV(GLint location, GLuint64 value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformHandleui64NV);
+}
+void APIENTRY glUniformHandleui64vARB(GLint location, GLsizei count, const GLuint64 * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformHandleui64vARB);
+}
+void APIENTRY glUniformHandleui64vNV(GLint location, GLsizei count, const GLuint64 * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformHandleui64vNV);
+}
+void APIENTRY glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformMatrix2dv);
+}
+void APIENTRY glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformMatrix2fv);
+}
+void APIENTRY glUniformMatrix2fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformMatrix2fvARB);
+}
+void APIENTRY glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformMatrix2x3dv);
+}
+void APIENTRY glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformMatrix2x3fv);
+}
+void APIENTRY glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformMatrix2x4dv);
+}
+void APIENTRY glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformMatrix2x4fv);
+}
+void APIENTRY glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformMatrix3dv);
+}
+void APIENTRY glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformMatrix3fv);
+}
+void APIENTRY glUniformMatrix3fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformMatrix3fvARB);
+}
+void APIENTRY glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformMatrix3x2dv);
+}
+void APIENTRY glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformMatrix3x2fv);
+}
+void APIENTRY glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformMatrix3x4dv);
+}
+void APIENTRY glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformMatrix3x4fv);
+}
+void APIENTRY glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformMatrix4dv);
+}
+void APIENTRY glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformMatrix4fv);
+}
+void APIENTRY glUniformMatrix4fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformMatrix4fvARB);
+}
+void APIENTRY glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformMatrix4x2dv);
+}
+void APIENTRY glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformMatrix4x2fv);
+}
+void APIENTRY glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformMatrix4x3dv);
+}
+void APIENTRY glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformMatrix4x3fv);
+}
+void APIENTRY glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint * indices)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformSubroutinesuiv);
+}
+void APIENTRY glUniformui64NV(GLint location, GLuint64EXT value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformui64NV);
+}
+void APIENTRY glUniformui64vNV(GLint location, GLsizei count, const GLuint64EXT * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUniformui64vNV);
+}
+void APIENTRY glUnlockArraysEXT(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUnlockArraysEXT);
+}
+GLboolean APIENTRY glUnmapBuffer(GLenum target)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUnmapBuffer);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glUnmapBufferARB(GLenum target)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUnmapBufferARB);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glUnmapNamedBuffer(GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUnmapNamedBuffer);
+    return (GLboolean)0;
+}
+GLboolean APIENTRY glUnmapNamedBufferEXT(GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUnmapNamedBufferEXT);
+    return (GLboolean)0;
+}
+void APIENTRY glUnmapObjectBufferATI(GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUnmapObjectBufferATI);
+}
+void APIENTRY glUnmapTexture2DINTEL(GLuint texture, GLint level)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUnmapTexture2DINTEL);
+}
+void APIENTRY glUpdateObjectBufferATI(GLuint buffer, GLuint offset, GLsizei size, const void * pointer, GLenum preserve)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUpdateObjectBufferATI);
+}
+void APIENTRY glUploadGpuMaskNVX(GLbitfield mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUploadGpuMaskNVX);
+}
+void APIENTRY glUseProgram(GLuint program)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUseProgram);
+}
+void APIENTRY glUseProgramObjectARB(GLhandleARB programObj)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUseProgramObjectARB);
+}
+void APIENTRY glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUseProgramStages);
+}
+void APIENTRY glUseProgramStagesEXT(GLuint pipeline, GLbitfield stages, GLuint program)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUseProgramStagesEXT);
+}
+void APIENTRY glUseShaderProgramEXT(GLenum type, GLuint program)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glUseShaderProgramEXT);
+}
+void APIENTRY glVDPAUFiniNV(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVDPAUFiniNV);
+}
+void APIENTRY glVDPAUGetSurfaceivNV(GLvdpauSurfaceNV surface, GLenum pname, GLsizei count, GLsizei * length, GLint * values)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVDPAUGetSurfaceivNV);
+}
+void APIENTRY glVDPAUInitNV(const void * vdpDevice, const void * getProcAddress)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVDPAUInitNV);
+}
+GLboolean APIENTRY glVDPAUIsSurfaceNV(GLvdpauSurfaceNV surface)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVDPAUIsSurfaceNV);
+    return (GLboolean)0;
+}
+void APIENTRY glVDPAUMapSurfacesNV(GLsizei numSurfaces, const GLvdpauSurfaceNV * surfaces)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVDPAUMapSurfacesNV);
+}
+GLvdpauSurfaceNV APIENTRY glVDPAURegisterOutputSurfaceNV(const void * vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint * textureNames)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVDPAURegisterOutputSurfaceNV);
+    return (GLvdpauSurfaceNV)0;
+}
+GLvdpauSurfaceNV APIENTRY glVDPAURegisterVideoSurfaceNV(const void * vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint * textureNames)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVDPAURegisterVideoSurfaceNV);
+    return (GLvdpauSurfaceNV)0;
+}
+GLvdpauSurfaceNV APIENTRY glVDPAURegisterVideoSurfaceWithPictureStructureNV(const void * vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint * textureNames, GLboolean isFrameStructure)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVDPAURegisterVideoSurfaceWithPictureStructureNV);
+    return (GLvdpauSurfaceNV)0;
+}
+void APIENTRY glVDPAUSurfaceAccessNV(GLvdpauSurfaceNV surface, GLenum access)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVDPAUSurfaceAccessNV);
+}
+void APIENTRY glVDPAUUnmapSurfacesNV(GLsizei numSurface, const GLvdpauSurfaceNV * surfaces)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVDPAUUnmapSurfacesNV);
+}
+void APIENTRY glVDPAUUnregisterSurfaceNV(GLvdpauSurfaceNV surface)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVDPAUUnregisterSurfaceNV);
+}
+void APIENTRY glValidateProgram(GLuint program)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glValidateProgram);
+}
+void APIENTRY glValidateProgramARB(GLhandleARB programObj)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glValidateProgramARB);
+}
+void APIENTRY glValidateProgramPipeline(GLuint pipeline)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glValidateProgramPipeline);
+}
+void APIENTRY glValidateProgramPipelineEXT(GLuint pipeline)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glValidateProgramPipelineEXT);
+}
+void APIENTRY glVariantArrayObjectATI(GLuint id, GLenum type, GLsizei stride, GLuint buffer, GLuint offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVariantArrayObjectATI);
+}
+void APIENTRY glVariantPointerEXT(GLuint id, GLenum type, GLuint stride, const void * addr)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVariantPointerEXT);
+}
+void APIENTRY glVariantbvEXT(GLuint id, const GLbyte * addr)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVariantbvEXT);
+}
+void APIENTRY glVariantdvEXT(GLuint id, const GLdouble * addr)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVariantdvEXT);
+}
+void APIENTRY glVariantfvEXT(GLuint id, const GLfloat * addr)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVariantfvEXT);
+}
+void APIENTRY glVariantivEXT(GLuint id, const GLint * addr)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVariantivEXT);
+}
+void APIENTRY glVariantsvEXT(GLuint id, const GLshort * addr)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVariantsvEXT);
+}
+void APIENTRY glVariantubvEXT(GLuint id, const GLubyte * addr)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVariantubvEXT);
+}
+void APIENTRY glVariantuivEXT(GLuint id, const GLuint * addr)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVariantuivEXT);
+}
+void APIENTRY glVariantusvEXT(GLuint id, const GLushort * addr)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVariantusvEXT);
+}
+void APIENTRY glVertex2bOES(GLbyte x, GLbyte y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex2bOES);
+}
+void APIENTRY glVertex2bvOES(const GLbyte * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex2bvOES);
+}
+void APIENTRY glVertex2d(GLdouble x, GLdouble y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex2d);
+}
+void APIENTRY glVertex2dv(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex2dv);
+}
+void APIENTRY glVertex2f(GLfloat x, GLfloat y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex2f);
+}
+void APIENTRY glVertex2fv(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex2fv);
+}
+void APIENTRY glVertex2hNV(GLhalfNV x, GLhalfNV y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex2hNV);
+}
+void APIENTRY glVertex2hvNV(const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex2hvNV);
+}
+void APIENTRY glVertex2i(GLint x, GLint y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex2i);
+}
+void APIENTRY glVertex2iv(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex2iv);
+}
+void APIENTRY glVertex2s(GLshort x, GLshort y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex2s);
+}
+void APIENTRY glVertex2sv(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex2sv);
+}
+void APIENTRY glVertex2xOES(GLfixed x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex2xOES);
+}
+void APIENTRY glVertex2xvOES(const GLfixed * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex2xvOES);
+}
+void APIENTRY glVertex3bOES(GLbyte x, GLbyte y, GLbyte z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex3bOES);
+}
+void APIENTRY glVertex3bvOES(const GLbyte * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex3bvOES);
+}
+void APIENTRY glVertex3d(GLdouble x, GLdouble y, GLdouble z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex3d);
+}
+void APIENTRY glVertex3dv(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex3dv);
+}
+void APIENTRY glVertex3f(GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex3f);
+}
+void APIENTRY glVertex3fv(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex3fv);
+}
+void APIENTRY glVertex3hNV(GLhalfNV x, GLhalfNV y, GLhalfNV z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex3hNV);
+}
+void APIENTRY glVertex3hvNV(const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex3hvNV);
+}
+void APIENTRY glVertex3i(GLint x, GLint y, GLint z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex3i);
+}
+void APIENTRY glVertex3iv(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex3iv);
+}
+void APIENTRY glVertex3s(GLshort x, GLshort y, GLshort z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex3s);
+}
+void APIENTRY glVertex3sv(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex3sv);
+}
+void APIENTRY glVertex3xOES(GLfixed x, GLfixed y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex3xOES);
+}
+void APIENTRY glVertex3xvOES(const GLfixed * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex3xvOES);
+}
+void APIENTRY glVertex4bOES(GLbyte x, GLbyte y, GLbyte z, GLbyte w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex4bOES);
+}
+void APIENTRY glVertex4bvOES(const GLbyte * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex4bvOES);
+}
+void APIENTRY glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex4d);
+}
+void APIENTRY glVertex4dv(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex4dv);
+}
+void APIENTRY glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex4f);
+}
+void APIENTRY glVertex4fv(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex4fv);
+}
+void APIENTRY glVertex4hNV(GLhalfNV x, GLhalfNV y, GLhalfNV z, GLhalfNV w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex4hNV);
+}
+void APIENTRY glVertex4hvNV(const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex4hvNV);
+}
+void APIENTRY glVertex4i(GLint x, GLint y, GLint z, GLint w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex4i);
+}
+void APIENTRY glVertex4iv(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex4iv);
+}
+void APIENTRY glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex4s);
+}
+void APIENTRY glVertex4sv(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex4sv);
+}
+void APIENTRY glVertex4xOES(GLfixed x, GLfixed y, GLfixed z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex4xOES);
+}
+void APIENTRY glVertex4xvOES(const GLfixed * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertex4xvOES);
+}
+void APIENTRY glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayAttribBinding);
+}
+void APIENTRY glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayAttribFormat);
+}
+void APIENTRY glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayAttribIFormat);
+}
+void APIENTRY glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayAttribLFormat);
+}
+void APIENTRY glVertexArrayBindVertexBufferEXT(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayBindVertexBufferEXT);
+}
+void APIENTRY glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayBindingDivisor);
+}
+void APIENTRY glVertexArrayColorOffsetEXT(GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayColorOffsetEXT);
+}
+void APIENTRY glVertexArrayEdgeFlagOffsetEXT(GLuint vaobj, GLuint buffer, GLsizei stride, GLintptr offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayEdgeFlagOffsetEXT);
+}
+void APIENTRY glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayElementBuffer);
+}
+void APIENTRY glVertexArrayFogCoordOffsetEXT(GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayFogCoordOffsetEXT);
+}
+void APIENTRY glVertexArrayIndexOffsetEXT(GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayIndexOffsetEXT);
+}
+void APIENTRY glVertexArrayMultiTexCoordOffsetEXT(GLuint vaobj, GLuint buffer, GLenum texunit, GLint size, GLenum type, GLsizei stride, GLintptr offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayMultiTexCoordOffsetEXT);
+}
+void APIENTRY glVertexArrayNormalOffsetEXT(GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayNormalOffsetEXT);
+}
+void APIENTRY glVertexArrayParameteriAPPLE(GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayParameteriAPPLE);
+}
+void APIENTRY glVertexArrayRangeAPPLE(GLsizei length, void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayRangeAPPLE);
+}
+void APIENTRY glVertexArrayRangeNV(GLsizei length, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayRangeNV);
+}
+void APIENTRY glVertexArraySecondaryColorOffsetEXT(GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArraySecondaryColorOffsetEXT);
+}
+void APIENTRY glVertexArrayTexCoordOffsetEXT(GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayTexCoordOffsetEXT);
+}
+void APIENTRY glVertexArrayVertexAttribBindingEXT(GLuint vaobj, GLuint attribindex, GLuint bindingindex)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayVertexAttribBindingEXT);
+}
+void APIENTRY glVertexArrayVertexAttribDivisorEXT(GLuint vaobj, GLuint index, GLuint divisor)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayVertexAttribDivisorEXT);
+}
+void APIENTRY glVertexArrayVertexAttribFormatEXT(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayVertexAttribFormatEXT);
+}
+void APIENTRY glVertexArrayVertexAttribIFormatEXT(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayVertexAttribIFormatEXT);
+}
+void APIENTRY glVertexArrayVertexAttribIOffsetEXT(GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLsizei stride, GLintptr offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayVertexAttribIOffsetEXT);
+}
+void APIENTRY glVertexArrayVertexAttribLFormatEXT(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayVertexAttribLFormatEXT);
+}
+void APIENTRY glVertexArrayVertexAttribLOffsetEXT(GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLsizei stride, GLintptr offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayVertexAttribLOffsetEXT);
+}
+void APIENTRY glVertexArrayVertexAttribOffsetEXT(GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, GLintptr offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayVertexAttribOffsetEXT);
+}
+void APIENTRY glVertexArrayVertexBindingDivisorEXT(GLuint vaobj, GLuint bindingindex, GLuint divisor)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayVertexBindingDivisorEXT);
+}
+void APIENTRY glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayVertexBuffer);
+}
+void APIENTRY glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint * buffers, const GLintptr * offsets, const GLsizei * strides)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayVertexBuffers);
+}
+void APIENTRY glVertexArrayVertexOffsetEXT(GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexArrayVertexOffsetEXT);
+}
+void APIENTRY glVertexAttrib1d(GLuint index, GLdouble x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib1d);
+}
+void APIENTRY glVertexAttrib1dARB(GLuint index, GLdouble x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib1dARB);
+}
+void APIENTRY glVertexAttrib1dNV(GLuint index, GLdouble x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib1dNV);
+}
+void APIENTRY glVertexAttrib1dv(GLuint index, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib1dv);
+}
+void APIENTRY glVertexAttrib1dvARB(GLuint index, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib1dvARB);
+}
+void APIENTRY glVertexAttrib1dvNV(GLuint index, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib1dvNV);
+}
+void APIENTRY glVertexAttrib1f(GLuint index, GLfloat x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib1f);
+}
+void APIENTRY glVertexAttrib1fARB(GLuint index, GLfloat x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib1fARB);
+}
+void APIENTRY glVertexAttrib1fNV(GLuint index, GLfloat x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib1fNV);
+}
+void APIENTRY glVertexAttrib1fv(GLuint index, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib1fv);
+}
+void APIENTRY glVertexAttrib1fvARB(GLuint index, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib1fvARB);
+}
+void APIENTRY glVertexAttrib1fvNV(GLuint index, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib1fvNV);
+}
+void APIENTRY glVertexAttrib1hNV(GLuint index, GLhalfNV x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib1hNV);
+}
+void APIENTRY glVertexAttrib1hvNV(GLuint index, const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib1hvNV);
+}
+void APIENTRY glVertexAttrib1s(GLuint index, GLshort x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib1s);
+}
+void APIENTRY glVertexAttrib1sARB(GLuint index, GLshort x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib1sARB);
+}
+void APIENTRY glVertexAttrib1sNV(GLuint index, GLshort x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib1sNV);
+}
+void APIENTRY glVertexAttrib1sv(GLuint index, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib1sv);
+}
+void APIENTRY glVertexAttrib1svARB(GLuint index, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib1svARB);
+}
+void APIENTRY glVertexAttrib1svNV(GLuint index, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib1svNV);
+}
+void APIENTRY glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib2d);
+}
+void APIENTRY glVertexAttrib2dARB(GLuint index, GLdouble x, GLdouble y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib2dARB);
+}
+void APIENTRY glVertexAttrib2dNV(GLuint index, GLdouble x, GLdouble y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib2dNV);
+}
+void APIENTRY glVertexAttrib2dv(GLuint index, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib2dv);
+}
+void APIENTRY glVertexAttrib2dvARB(GLuint index, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib2dvARB);
+}
+void APIENTRY glVertexAttrib2dvNV(GLuint index, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib2dvNV);
+}
+void APIENTRY glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib2f);
+}
+void APIENTRY glVertexAttrib2fARB(GLuint index, GLfloat x, GLfloat y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib2fARB);
+}
+void APIENTRY glVertexAttrib2fNV(GLuint index, GLfloat x, GLfloat y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib2fNV);
+}
+void APIENTRY glVertexAttrib2fv(GLuint index, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib2fv);
+}
+void APIENTRY glVertexAttrib2fvARB(GLuint index, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib2fvARB);
+}
+void APIENTRY glVertexAttrib2fvNV(GLuint index, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib2fvNV);
+}
+void APIENTRY glVertexAttrib2hNV(GLuint index, GLhalfNV x, GLhalfNV y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib2hNV);
+}
+void APIENTRY glVertexAttrib2hvNV(GLuint index, const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib2hvNV);
+}
+void APIENTRY glVertexAttrib2s(GLuint index, GLshort x, GLshort y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib2s);
+}
+void APIENTRY glVertexAttrib2sARB(GLuint index, GLshort x, GLshort y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib2sARB);
+}
+void APIENTRY glVertexAttrib2sNV(GLuint index, GLshort x, GLshort y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib2sNV);
+}
+void APIENTRY glVertexAttrib2sv(GLuint index, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib2sv);
+}
+void APIENTRY glVertexAttrib2svARB(GLuint index, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib2svARB);
+}
+void APIENTRY glVertexAttrib2svNV(GLuint index, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib2svNV);
+}
+void APIENTRY glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib3d);
+}
+void APIENTRY glVertexAttrib3dARB(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib3dARB);
+}
+void APIENTRY glVertexAttrib3dNV(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib3dNV);
+}
+void APIENTRY glVertexAttrib3dv(GLuint index, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib3dv);
+}
+void APIENTRY glVertexAttrib3dvARB(GLuint index, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib3dvARB);
+}
+void APIENTRY glVertexAttrib3dvNV(GLuint index, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib3dvNV);
+}
+void APIENTRY glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib3f);
+}
+void APIENTRY glVertexAttrib3fARB(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib3fARB);
+}
+void APIENTRY glVertexAttrib3fNV(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib3fNV);
+}
+void APIENTRY glVertexAttrib3fv(GLuint index, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib3fv);
+}
+void APIENTRY glVertexAttrib3fvARB(GLuint index, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib3fvARB);
+}
+void APIENTRY glVertexAttrib3fvNV(GLuint index, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib3fvNV);
+}
+void APIENTRY glVertexAttrib3hNV(GLuint index, GLhalfNV x, GLhalfNV y, GLhalfNV z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib3hNV);
+}
+void APIENTRY glVertexAttrib3hvNV(GLuint index, const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib3hvNV);
+}
+void APIENTRY glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib3s);
+}
+void APIENTRY glVertexAttrib3sARB(GLuint index, GLshort x, GLshort y, GLshort z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib3sARB);
+}
+void APIENTRY glVertexAttrib3sNV(GLuint index, GLshort x, GLshort y, GLshort z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib3sNV);
+}
+void APIENTRY glVertexAttrib3sv(GLuint index, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib3sv);
+}
+void APIENTRY glVertexAttrib3svARB(GLuint index, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib3svARB);
+}
+void APIENTRY glVertexAttrib3svNV(GLuint index, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib3svNV);
+}
+void APIENTRY glVertexAttrib4Nbv(GLuint index, const GLbyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4Nbv);
+}
+void APIENTRY glVertexAttrib4NbvARB(GLuint index, const GLbyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4NbvARB);
+}
+void APIENTRY glVertexAttrib4Niv(GLuint index, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4Niv);
+}
+void APIENTRY glVertexAttrib4NivARB(GLuint index, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4NivARB);
+}
+void APIENTRY glVertexAttrib4Nsv(GLuint index, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4Nsv);
+}
+void APIENTRY glVertexAttrib4NsvARB(GLuint index, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4NsvARB);
+}
+void APIENTRY glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4Nub);
+}
+void APIENTRY glVertexAttrib4NubARB(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4NubARB);
+}
+void APIENTRY glVertexAttrib4Nubv(GLuint index, const GLubyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4Nubv);
+}
+void APIENTRY glVertexAttrib4NubvARB(GLuint index, const GLubyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4NubvARB);
+}
+void APIENTRY glVertexAttrib4Nuiv(GLuint index, const GLuint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4Nuiv);
+}
+void APIENTRY glVertexAttrib4NuivARB(GLuint index, const GLuint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4NuivARB);
+}
+void APIENTRY glVertexAttrib4Nusv(GLuint index, const GLushort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4Nusv);
+}
+void APIENTRY glVertexAttrib4NusvARB(GLuint index, const GLushort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4NusvARB);
+}
+void APIENTRY glVertexAttrib4bv(GLuint index, const GLbyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4bv);
+}
+void APIENTRY glVertexAttrib4bvARB(GLuint index, const GLbyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4bvARB);
+}
+void APIENTRY glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4d);
+}
+void APIENTRY glVertexAttrib4dARB(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4dARB);
+}
+void APIENTRY glVertexAttrib4dNV(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4dNV);
+}
+void APIENTRY glVertexAttrib4dv(GLuint index, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4dv);
+}
+void APIENTRY glVertexAttrib4dvARB(GLuint index, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4dvARB);
+}
+void APIENTRY glVertexAttrib4dvNV(GLuint index, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4dvNV);
+}
+void APIENTRY glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4f);
+}
+void APIENTRY glVertexAttrib4fARB(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4fARB);
+}
+void APIENTRY glVertexAttrib4fNV(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4fNV);
+}
+void APIENTRY glVertexAttrib4fv(GLuint index, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4fv);
+}
+void APIENTRY glVertexAttrib4fvARB(GLuint index, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4fvARB);
+}
+void APIENTRY glVertexAttrib4fvNV(GLuint index, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4fvNV);
+}
+void APIENTRY glVertexAttrib4hNV(GLuint index, GLhalfNV x, GLhalfNV y, GLhalfNV z, GLhalfNV w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4hNV);
+}
+void APIENTRY glVertexAttrib4hvNV(GLuint index, const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4hvNV);
+}
+void APIENTRY glVertexAttrib4iv(GLuint index, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4iv);
+}
+void APIENTRY glVertexAttrib4ivARB(GLuint index, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4ivARB);
+}
+void APIENTRY glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4s);
+}
+void APIENTRY glVertexAttrib4sARB(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4sARB);
+}
+void APIENTRY glVertexAttrib4sNV(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4sNV);
+}
+void APIENTRY glVertexAttrib4sv(GLuint index, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4sv);
+}
+void APIENTRY glVertexAttrib4svARB(GLuint index, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4svARB);
+}
+void APIENTRY glVertexAttrib4svNV(GLuint index, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4svNV);
+}
+void APIENTRY glVertexAttrib4ubNV(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4ubNV);
+}
+void APIENTRY glVertexAttrib4ubv(GLuint index, const GLubyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4ubv);
+}
+void APIENTRY glVertexAttrib4ubvARB(GLuint index, const GLubyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4ubvARB);
+}
+void APIENTRY glVertexAttrib4ubvNV(GLuint index, const GLubyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4ubvNV);
+}
+void APIENTRY glVertexAttrib4uiv(GLuint index, const GLuint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4uiv);
+}
+void APIENTRY glVertexAttrib4uivARB(GLuint index, const GLuint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4uivARB);
+}
+void APIENTRY glVertexAttrib4usv(GLuint index, const GLushort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4usv);
+}
+void APIENTRY glVertexAttrib4usvARB(GLuint index, const GLushort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttrib4usvARB);
+}
+void APIENTRY glVertexAttribArrayObjectATI(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, GLuint buffer, GLuint offset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribArrayObjectATI);
+}
+void APIENTRY glVertexAttribBinding(GLuint attribindex, GLuint bindingindex)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribBinding);
+}
+void APIENTRY glVertexAttribDivisor(GLuint index, GLuint divisor)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribDivisor);
+}
+void APIENTRY glVertexAttribDivisorARB(GLuint index, GLuint divisor)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribDivisorARB);
+}
+void APIENTRY glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribFormat);
+}
+void APIENTRY glVertexAttribFormatNV(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribFormatNV);
+}
+void APIENTRY glVertexAttribI1i(GLuint index, GLint x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI1i);
+}
+void APIENTRY glVertexAttribI1iEXT(GLuint index, GLint x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI1iEXT);
+}
+void APIENTRY glVertexAttribI1iv(GLuint index, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI1iv);
+}
+void APIENTRY glVertexAttribI1ivEXT(GLuint index, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI1ivEXT);
+}
+void APIENTRY glVertexAttribI1ui(GLuint index, GLuint x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI1ui);
+}
+void APIENTRY glVertexAttribI1uiEXT(GLuint index, GLuint x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI1uiEXT);
+}
+void APIENTRY glVertexAttribI1uiv(GLuint index, const GLuint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI1uiv);
+}
+void APIENTRY glVertexAttribI1uivEXT(GLuint index, const GLuint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI1uivEXT);
+}
+void APIENTRY glVertexAttribI2i(GLuint index, GLint x, GLint y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI2i);
+}
+void APIENTRY glVertexAttribI2iEXT(GLuint index, GLint x, GLint y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI2iEXT);
+}
+void APIENTRY glVertexAttribI2iv(GLuint index, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI2iv);
+}
+void APIENTRY glVertexAttribI2ivEXT(GLuint index, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI2ivEXT);
+}
+void APIENTRY glVertexAttribI2ui(GLuint index, GLuint x, GLuint y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI2ui);
+}
+void APIENTRY glVertexAttribI2uiEXT(GLuint index, GLuint x, GLuint y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI2uiEXT);
+}
+void APIENTRY glVertexAttribI2uiv(GLuint index, const GLuint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI2uiv);
+}
+void APIENTRY glVertexAttribI2uivEXT(GLuint index, const GLuint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI2uivEXT);
+}
+void APIENTRY glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI3i);
+}
+void APIENTRY glVertexAttribI3iEXT(GLuint index, GLint x, GLint y, GLint z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI3iEXT);
+}
+void APIENTRY glVertexAttribI3iv(GLuint index, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI3iv);
+}
+void APIENTRY glVertexAttribI3ivEXT(GLuint index, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI3ivEXT);
+}
+void APIENTRY glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI3ui);
+}
+void APIENTRY glVertexAttribI3uiEXT(GLuint index, GLuint x, GLuint y, GLuint z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI3uiEXT);
+}
+void APIENTRY glVertexAttribI3uiv(GLuint index, const GLuint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI3uiv);
+}
+void APIENTRY glVertexAttribI3uivEXT(GLuint index, const GLuint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI3uivEXT);
+}
+void APIENTRY glVertexAttribI4bv(GLuint index, const GLbyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI4bv);
+}
+void APIENTRY glVertexAttribI4bvEXT(GLuint index, const GLbyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI4bvEXT);
+}
+void APIENTRY glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI4i);
+}
+void APIENTRY glVertexAttribI4iEXT(GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI4iEXT);
+}
+void APIENTRY glVertexAttribI4iv(GLuint index, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI4iv);
+}
+void APIENTRY glVertexAttribI4ivEXT(GLuint index, const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI4ivEXT);
+}
+void APIENTRY glVertexAttribI4sv(GLuint index, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI4sv);
+}
+void APIENTRY glVertexAttribI4svEXT(GLuint index, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI4svEXT);
+}
+void APIENTRY glVertexAttribI4ubv(GLuint index, const GLubyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI4ubv);
+}
+void APIENTRY glVertexAttribI4ubvEXT(GLuint index, const GLubyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI4ubvEXT);
+}
+void APIENTRY glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI4ui);
+}
+void APIENTRY glVertexAttribI4uiEXT(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI4uiEXT);
+}
+void APIENTRY glVertexAttribI4uiv(GLuint index, const GLuint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI4uiv);
+}
+void APIENTRY glVertexAttribI4uivEXT(GLuint index, const GLuint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI4uivEXT);
+}
+void APIENTRY glVertexAttribI4usv(GLuint index, const GLushort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI4usv);
+}
+void APIENTRY glVertexAttribI4usvEXT(GLuint index, const GLushort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribI4usvEXT);
+}
+void APIENTRY glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribIFormat);
+}
+void APIENTRY glVertexAttribIFormatNV(GLuint index, GLint size, GLenum type, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribIFormatNV);
+}
+void APIENTRY glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribIPointer);
+}
+void APIENTRY glVertexAttribIPointerEXT(GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribIPointerEXT);
+}
+void APIENTRY glVertexAttribL1d(GLuint index, GLdouble x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL1d);
+}
+void APIENTRY glVertexAttribL1dEXT(GLuint index, GLdouble x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL1dEXT);
+}
+void APIENTRY glVertexAttribL1dv(GLuint index, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL1dv);
+}
+void APIENTRY glVertexAttribL1dvEXT(GLuint index, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL1dvEXT);
+}
+void APIENTRY glVertexAttribL1i64NV(GLuint index, GLint64EXT x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL1i64NV);
+}
+void APIENTRY glVertexAttribL1i64vNV(GLuint index, const GLint64EXT * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL1i64vNV);
+}
+void APIENTRY glVertexAttribL1ui64ARB(GLuint index, GLuint64EXT x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL1ui64ARB);
+}
+void APIENTRY glVertexAttribL1ui64NV(GLuint index, GLuint64EXT x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL1ui64NV);
+}
+void APIENTRY glVertexAttribL1ui64vARB(GLuint index, const GLuint64EXT * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL1ui64vARB);
+}
+void APIENTRY glVertexAttribL1ui64vNV(GLuint index, const GLuint64EXT * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL1ui64vNV);
+}
+void APIENTRY glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL2d);
+}
+void APIENTRY glVertexAttribL2dEXT(GLuint index, GLdouble x, GLdouble y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL2dEXT);
+}
+void APIENTRY glVertexAttribL2dv(GLuint index, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL2dv);
+}
+void APIENTRY glVertexAttribL2dvEXT(GLuint index, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL2dvEXT);
+}
+void APIENTRY glVertexAttribL2i64NV(GLuint index, GLint64EXT x, GLint64EXT y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL2i64NV);
+}
+void APIENTRY glVertexAttribL2i64vNV(GLuint index, const GLint64EXT * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL2i64vNV);
+}
+void APIENTRY glVertexAttribL2ui64NV(GLuint index, GLuint64EXT x, GLuint64EXT y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL2ui64NV);
+}
+void APIENTRY glVertexAttribL2ui64vNV(GLuint index, const GLuint64EXT * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL2ui64vNV);
+}
+void APIENTRY glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL3d);
+}
+void APIENTRY glVertexAttribL3dEXT(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL3dEXT);
+}
+void APIENTRY glVertexAttribL3dv(GLuint index, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL3dv);
+}
+void APIENTRY glVertexAttribL3dvEXT(GLuint index, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL3dvEXT);
+}
+void APIENTRY glVertexAttribL3i64NV(GLuint index, GLint64EXT x, GLint64EXT y, GLint64EXT z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL3i64NV);
+}
+void APIENTRY glVertexAttribL3i64vNV(GLuint index, const GLint64EXT * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL3i64vNV);
+}
+void APIENTRY glVertexAttribL3ui64NV(GLuint index, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL3ui64NV);
+}
+void APIENTRY glVertexAttribL3ui64vNV(GLuint index, const GLuint64EXT * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL3ui64vNV);
+}
+void APIENTRY glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL4d);
+}
+void APIENTRY glVertexAttribL4dEXT(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL4dEXT);
+}
+void APIENTRY glVertexAttribL4dv(GLuint index, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL4dv);
+}
+void APIENTRY glVertexAttribL4dvEXT(GLuint index, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL4dvEXT);
+}
+void APIENTRY glVertexAttribL4i64NV(GLuint index, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL4i64NV);
+}
+void APIENTRY glVertexAttribL4i64vNV(GLuint index, const GLint64EXT * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL4i64vNV);
+}
+void APIENTRY glVertexAttribL4ui64NV(GLuint index, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL4ui64NV);
+}
+void APIENTRY glVertexAttribL4ui64vNV(GLuint index, const GLuint64EXT * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribL4ui64vNV);
+}
+void APIENTRY glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribLFormat);
+}
+void APIENTRY glVertexAttribLFormatNV(GLuint index, GLint size, GLenum type, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribLFormatNV);
+}
+void APIENTRY glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribLPointer);
+}
+void APIENTRY glVertexAttribLPointerEXT(GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribLPointerEXT);
+}
+void APIENTRY glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribP1ui);
+}
+void APIENTRY glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribP1uiv);
+}
+void APIENTRY glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribP2ui);
+}
+void APIENTRY glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribP2uiv);
+}
+void APIENTRY glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribP3ui);
+}
+void APIENTRY glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribP3uiv);
+}
+void APIENTRY glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribP4ui);
+}
+void APIENTRY glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribP4uiv);
+}
+void APIENTRY glVertexAttribParameteriAMD(GLuint index, GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribParameteriAMD);
+}
+void APIENTRY glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribPointer);
+}
+void APIENTRY glVertexAttribPointerARB(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribPointerARB);
+}
+void APIENTRY glVertexAttribPointerNV(GLuint index, GLint fsize, GLenum type, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribPointerNV);
+}
+void APIENTRY glVertexAttribs1dvNV(GLuint index, GLsizei count, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribs1dvNV);
+}
+void APIENTRY glVertexAttribs1fvNV(GLuint index, GLsizei count, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribs1fvNV);
+}
+void APIENTRY glVertexAttribs1hvNV(GLuint index, GLsizei n, const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribs1hvNV);
+}
+void APIENTRY glVertexAttribs1svNV(GLuint index, GLsizei count, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribs1svNV);
+}
+void APIENTRY glVertexAttribs2dvNV(GLuint index, GLsizei count, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribs2dvNV);
+}
+void APIENTRY glVertexAttribs2fvNV(GLuint index, GLsizei count, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribs2fvNV);
+}
+void APIENTRY glVertexAttribs2hvNV(GLuint index, GLsizei n, const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribs2hvNV);
+}
+void APIENTRY glVertexAttribs2svNV(GLuint index, GLsizei count, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribs2svNV);
+}
+void APIENTRY glVertexAttribs3dvNV(GLuint index, GLsizei count, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribs3dvNV);
+}
+void APIENTRY glVertexAttribs3fvNV(GLuint index, GLsizei count, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribs3fvNV);
+}
+void APIENTRY glVertexAttribs3hvNV(GLuint index, GLsizei n, const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribs3hvNV);
+}
+void APIENTRY glVertexAttribs3svNV(GLuint index, GLsizei count, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribs3svNV);
+}
+void APIENTRY glVertexAttribs4dvNV(GLuint index, GLsizei count, const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribs4dvNV);
+}
+void APIENTRY glVertexAttribs4fvNV(GLuint index, GLsizei count, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribs4fvNV);
+}
+void APIENTRY glVertexAttribs4hvNV(GLuint index, GLsizei n, const GLhalfNV * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribs4hvNV);
+}
+void APIENTRY glVertexAttribs4svNV(GLuint index, GLsizei count, const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribs4svNV);
+}
+void APIENTRY glVertexAttribs4ubvNV(GLuint index, GLsizei count, const GLubyte * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexAttribs4ubvNV);
+}
+void APIENTRY glVertexBindingDivisor(GLuint bindingindex, GLuint divisor)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexBindingDivisor);
+}
+void APIENTRY glVertexBlendARB(GLint count)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexBlendARB);
+}
+void APIENTRY glVertexBlendEnvfATI(GLenum pname, GLfloat param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexBlendEnvfATI);
+}
+void APIENTRY glVertexBlendEnviATI(GLenum pname, GLint param)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexBlendEnviATI);
+}
+void APIENTRY glVertexFormatNV(GLint size, GLenum type, GLsizei stride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexFormatNV);
+}
+void APIENTRY glVertexP2ui(GLenum type, GLuint value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexP2ui);
+}
+void APIENTRY glVertexP2uiv(GLenum type, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexP2uiv);
+}
+void APIENTRY glVertexP3ui(GLenum type, GLuint value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexP3ui);
+}
+void APIENTRY glVertexP3uiv(GLenum type, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexP3uiv);
+}
+void APIENTRY glVertexP4ui(GLenum type, GLuint value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexP4ui);
+}
+void APIENTRY glVertexP4uiv(GLenum type, const GLuint * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexP4uiv);
+}
+void APIENTRY glVertexPointer(GLint size, GLenum type, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexPointer);
+}
+void APIENTRY glVertexPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei count, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexPointerEXT);
+}
+void APIENTRY glVertexPointerListIBM(GLint size, GLenum type, GLint stride, const void ** pointer, GLint ptrstride)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexPointerListIBM);
+}
+void APIENTRY glVertexPointervINTEL(GLint size, GLenum type, const void ** pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexPointervINTEL);
+}
+void APIENTRY glVertexStream1dATI(GLenum stream, GLdouble x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream1dATI);
+}
+void APIENTRY glVertexStream1dvATI(GLenum stream, const GLdouble * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream1dvATI);
+}
+void APIENTRY glVertexStream1fATI(GLenum stream, GLfloat x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream1fATI);
+}
+void APIENTRY glVertexStream1fvATI(GLenum stream, const GLfloat * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream1fvATI);
+}
+void APIENTRY glVertexStream1iATI(GLenum stream, GLint x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream1iATI);
+}
+void APIENTRY glVertexStream1ivATI(GLenum stream, const GLint * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream1ivATI);
+}
+void APIENTRY glVertexStream1sATI(GLenum stream, GLshort x)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream1sATI);
+}
+void APIENTRY glVertexStream1svATI(GLenum stream, const GLshort * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream1svATI);
+}
+void APIENTRY glVertexStream2dATI(GLenum stream, GLdouble x, GLdouble y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream2dATI);
+}
+void APIENTRY glVertexStream2dvATI(GLenum stream, const GLdouble * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream2dvATI);
+}
+void APIENTRY glVertexStream2fATI(GLenum stream, GLfloat x, GLfloat y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream2fATI);
+}
+void APIENTRY glVertexStream2fvATI(GLenum stream, const GLfloat * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream2fvATI);
+}
+void APIENTRY glVertexStream2iATI(GLenum stream, GLint x, GLint y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream2iATI);
+}
+void APIENTRY glVertexStream2ivATI(GLenum stream, const GLint * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream2ivATI);
+}
+void APIENTRY glVertexStream2sATI(GLenum stream, GLshort x, GLshort y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream2sATI);
+}
+void APIENTRY glVertexStream2svATI(GLenum stream, const GLshort * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream2svATI);
+}
+void APIENTRY glVertexStream3dATI(GLenum stream, GLdouble x, GLdouble y, GLdouble z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream3dATI);
+}
+void APIENTRY glVertexStream3dvATI(GLenum stream, const GLdouble * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream3dvATI);
+}
+void APIENTRY glVertexStream3fATI(GLenum stream, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream3fATI);
+}
+void APIENTRY glVertexStream3fvATI(GLenum stream, const GLfloat * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream3fvATI);
+}
+void APIENTRY glVertexStream3iATI(GLenum stream, GLint x, GLint y, GLint z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream3iATI);
+}
+void APIENTRY glVertexStream3ivATI(GLenum stream, const GLint * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream3ivATI);
+}
+void APIENTRY glVertexStream3sATI(GLenum stream, GLshort x, GLshort y, GLshort z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream3sATI);
+}
+void APIENTRY glVertexStream3svATI(GLenum stream, const GLshort * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream3svATI);
+}
+void APIENTRY glVertexStream4dATI(GLenum stream, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream4dATI);
+}
+void APIENTRY glVertexStream4dvATI(GLenum stream, const GLdouble * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream4dvATI);
+}
+void APIENTRY glVertexStream4fATI(GLenum stream, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream4fATI);
+}
+void APIENTRY glVertexStream4fvATI(GLenum stream, const GLfloat * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream4fvATI);
+}
+void APIENTRY glVertexStream4iATI(GLenum stream, GLint x, GLint y, GLint z, GLint w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream4iATI);
+}
+void APIENTRY glVertexStream4ivATI(GLenum stream, const GLint * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream4ivATI);
+}
+void APIENTRY glVertexStream4sATI(GLenum stream, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream4sATI);
+}
+void APIENTRY glVertexStream4svATI(GLenum stream, const GLshort * coords)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexStream4svATI);
+}
+void APIENTRY glVertexWeightPointerEXT(GLint size, GLenum type, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexWeightPointerEXT);
+}
+void APIENTRY glVertexWeightfEXT(GLfloat weight)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexWeightfEXT);
+}
+void APIENTRY glVertexWeightfvEXT(const GLfloat * weight)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexWeightfvEXT);
+}
+void APIENTRY glVertexWeighthNV(GLhalfNV weight)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexWeighthNV);
+}
+void APIENTRY glVertexWeighthvNV(const GLhalfNV * weight)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVertexWeighthvNV);
+}
+GLenum APIENTRY glVideoCaptureNV(GLuint video_capture_slot, GLuint * sequence_num, GLuint64EXT * capture_time)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVideoCaptureNV);
+    return (GLenum)0;
+}
+void APIENTRY glVideoCaptureStreamParameterdvNV(GLuint video_capture_slot, GLuint stream, GLenum pname, const GLdouble * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVideoCaptureStreamParameterdvNV);
+}
+void APIENTRY glVideoCaptureStreamParameterfvNV(GLuint video_capture_slot, GLuint stream, GLenum pname, const GLfloat * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVideoCaptureStreamParameterfvNV);
+}
+void APIENTRY glVideoCaptureStreamParameterivNV(GLuint video_capture_slot, GLuint stream, GLenum pname, const GLint * params)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glVideoCaptureStreamParameterivNV);
+}
+void APIENTRY glViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glViewport);
+}
+void APIENTRY glViewportArrayv(GLuint first, GLsizei count, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glViewportArrayv);
+}
+void APIENTRY glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glViewportIndexedf);
+}
+void APIENTRY glViewportIndexedfv(GLuint index, const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glViewportIndexedfv);
+}
+void APIENTRY glViewportPositionWScaleNV(GLuint index, GLfloat xcoeff, GLfloat ycoeff)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glViewportPositionWScaleNV);
+}
+void APIENTRY glViewportSwizzleNV(GLuint index, GLenum swizzlex, GLenum swizzley, GLenum swizzlez, GLenum swizzlew)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glViewportSwizzleNV);
+}
+void APIENTRY glWaitSemaphoreEXT(GLuint semaphore, GLuint numBufferBarriers, const GLuint * buffers, GLuint numTextureBarriers, const GLuint * textures, const GLenum * srcLayouts)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWaitSemaphoreEXT);
+}
+void APIENTRY glWaitSemaphoreui64NVX(GLuint waitGpu, GLsizei fenceObjectCount, const GLuint * semaphoreArray, const GLuint64 * fenceValueArray)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWaitSemaphoreui64NVX);
+}
+void APIENTRY glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWaitSync);
+}
+void APIENTRY glWaitVkSemaphoreNV(GLuint64 vkSemaphore)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWaitVkSemaphoreNV);
+}
+void APIENTRY glWeightPathsNV(GLuint resultPath, GLsizei numPaths, const GLuint * paths, const GLfloat * weights)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWeightPathsNV);
+}
+void APIENTRY glWeightPointerARB(GLint size, GLenum type, GLsizei stride, const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWeightPointerARB);
+}
+void APIENTRY glWeightbvARB(GLint size, const GLbyte * weights)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWeightbvARB);
+}
+void APIENTRY glWeightdvARB(GLint size, const GLdouble * weights)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWeightdvARB);
+}
+void APIENTRY glWeightfvARB(GLint size, const GLfloat * weights)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWeightfvARB);
+}
+void APIENTRY glWeightivARB(GLint size, const GLint * weights)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWeightivARB);
+}
+void APIENTRY glWeightsvARB(GLint size, const GLshort * weights)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWeightsvARB);
+}
+void APIENTRY glWeightubvARB(GLint size, const GLubyte * weights)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWeightubvARB);
+}
+void APIENTRY glWeightuivARB(GLint size, const GLuint * weights)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWeightuivARB);
+}
+void APIENTRY glWeightusvARB(GLint size, const GLushort * weights)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWeightusvARB);
+}
+void APIENTRY glWindowPos2d(GLdouble x, GLdouble y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2d);
+}
+void APIENTRY glWindowPos2dARB(GLdouble x, GLdouble y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2dARB);
+}
+void APIENTRY glWindowPos2dMESA(GLdouble x, GLdouble y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2dMESA);
+}
+void APIENTRY glWindowPos2dv(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2dv);
+}
+void APIENTRY glWindowPos2dvARB(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2dvARB);
+}
+void APIENTRY glWindowPos2dvMESA(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2dvMESA);
+}
+void APIENTRY glWindowPos2f(GLfloat x, GLfloat y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2f);
+}
+void APIENTRY glWindowPos2fARB(GLfloat x, GLfloat y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2fARB);
+}
+void APIENTRY glWindowPos2fMESA(GLfloat x, GLfloat y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2fMESA);
+}
+void APIENTRY glWindowPos2fv(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2fv);
+}
+void APIENTRY glWindowPos2fvARB(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2fvARB);
+}
+void APIENTRY glWindowPos2fvMESA(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2fvMESA);
+}
+void APIENTRY glWindowPos2i(GLint x, GLint y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2i);
+}
+void APIENTRY glWindowPos2iARB(GLint x, GLint y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2iARB);
+}
+void APIENTRY glWindowPos2iMESA(GLint x, GLint y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2iMESA);
+}
+void APIENTRY glWindowPos2iv(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2iv);
+}
+void APIENTRY glWindowPos2ivARB(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2ivARB);
+}
+void APIENTRY glWindowPos2ivMESA(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2ivMESA);
+}
+void APIENTRY glWindowPos2s(GLshort x, GLshort y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2s);
+}
+void APIENTRY glWindowPos2sARB(GLshort x, GLshort y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2sARB);
+}
+void APIENTRY glWindowPos2sMESA(GLshort x, GLshort y)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2sMESA);
+}
+void APIENTRY glWindowPos2sv(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2sv);
+}
+void APIENTRY glWindowPos2svARB(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2svARB);
+}
+void APIENTRY glWindowPos2svMESA(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos2svMESA);
+}
+void APIENTRY glWindowPos3d(GLdouble x, GLdouble y, GLdouble z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3d);
+}
+void APIENTRY glWindowPos3dARB(GLdouble x, GLdouble y, GLdouble z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3dARB);
+}
+void APIENTRY glWindowPos3dMESA(GLdouble x, GLdouble y, GLdouble z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3dMESA);
+}
+void APIENTRY glWindowPos3dv(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3dv);
+}
+void APIENTRY glWindowPos3dvARB(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3dvARB);
+}
+void APIENTRY glWindowPos3dvMESA(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3dvMESA);
+}
+void APIENTRY glWindowPos3f(GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3f);
+}
+void APIENTRY glWindowPos3fARB(GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3fARB);
+}
+void APIENTRY glWindowPos3fMESA(GLfloat x, GLfloat y, GLfloat z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3fMESA);
+}
+void APIENTRY glWindowPos3fv(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3fv);
+}
+void APIENTRY glWindowPos3fvARB(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3fvARB);
+}
+void APIENTRY glWindowPos3fvMESA(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3fvMESA);
+}
+void APIENTRY glWindowPos3i(GLint x, GLint y, GLint z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3i);
+}
+void APIENTRY glWindowPos3iARB(GLint x, GLint y, GLint z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3iARB);
+}
+void APIENTRY glWindowPos3iMESA(GLint x, GLint y, GLint z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3iMESA);
+}
+void APIENTRY glWindowPos3iv(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3iv);
+}
+void APIENTRY glWindowPos3ivARB(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3ivARB);
+}
+void APIENTRY glWindowPos3ivMESA(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3ivMESA);
+}
+void APIENTRY glWindowPos3s(GLshort x, GLshort y, GLshort z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3s);
+}
+void APIENTRY glWindowPos3sARB(GLshort x, GLshort y, GLshort z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3sARB);
+}
+void APIENTRY glWindowPos3sMESA(GLshort x, GLshort y, GLshort z)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3sMESA);
+}
+void APIENTRY glWindowPos3sv(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3sv);
+}
+void APIENTRY glWindowPos3svARB(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3svARB);
+}
+void APIENTRY glWindowPos3svMESA(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos3svMESA);
+}
+void APIENTRY glWindowPos4dMESA(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos4dMESA);
+}
+void APIENTRY glWindowPos4dvMESA(const GLdouble * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos4dvMESA);
+}
+void APIENTRY glWindowPos4fMESA(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos4fMESA);
+}
+void APIENTRY glWindowPos4fvMESA(const GLfloat * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos4fvMESA);
+}
+void APIENTRY glWindowPos4iMESA(GLint x, GLint y, GLint z, GLint w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos4iMESA);
+}
+void APIENTRY glWindowPos4ivMESA(const GLint * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos4ivMESA);
+}
+void APIENTRY glWindowPos4sMESA(GLshort x, GLshort y, GLshort z, GLshort w)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos4sMESA);
+}
+void APIENTRY glWindowPos4svMESA(const GLshort * v)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowPos4svMESA);
+}
+void APIENTRY glWindowRectanglesEXT(GLenum mode, GLsizei count, const GLint * box)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWindowRectanglesEXT);
+}
+void APIENTRY glWriteMaskEXT(GLuint res, GLuint in, GLenum outX, GLenum outY, GLenum outZ, GLenum outW)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glWriteMaskEXT);
+}
+int APIENTRY glXBindChannelToWindowSGIX(glbind_Display* display, int screen, int channel, glbind_Window window)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXBindChannelToWindowSGIX);
+    return (int)0;
+}
+int APIENTRY glXBindHyperpipeSGIX(glbind_Display* dpy, int hpId)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXBindHyperpipeSGIX);
+    return (int)0;
+}
+glbind_Bool APIENTRY glXBindSwapBarrierNV(glbind_Display* dpy, GLuint group, GLuint barrier)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXBindSwapBarrierNV);
+    return (glbind_Bool)0;
+}
+void APIENTRY glXBindSwapBarrierSGIX(glbind_Display* dpy, GLXDrawable drawable, int barrier)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXBindSwapBarrierSGIX);
+}
+void APIENTRY glXBindTexImageEXT(glbind_Display* dpy, GLXDrawable drawable, int buffer, const int * attrib_list)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXBindTexImageEXT);
+}
+int APIENTRY glXBindVideoCaptureDeviceNV(glbind_Display* dpy, unsigned int video_capture_slot, GLXVideoCaptureDeviceNV device)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXBindVideoCaptureDeviceNV);
+    return (int)0;
+}
+int APIENTRY glXBindVideoDeviceNV(glbind_Display* dpy, unsigned int video_slot, unsigned int video_device, const int * attrib_list)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXBindVideoDeviceNV);
+    return (int)0;
+}
+int APIENTRY glXBindVideoImageNV(glbind_Display* dpy, GLXVideoDeviceNV VideoDevice, GLXPbuffer pbuf, int iVideoBuffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXBindVideoImageNV);
+    return (int)0;
+}
+void APIENTRY glXBlitContextFramebufferAMD(GLXContext dstCtx, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXBlitContextFramebufferAMD);
+}
+int APIENTRY glXChannelRectSGIX(glbind_Display* display, int screen, int channel, int x, int y, int w, int h)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXChannelRectSGIX);
+    return (int)0;
+}
+int APIENTRY glXChannelRectSyncSGIX(glbind_Display* display, int screen, int channel, GLenum synctype)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXChannelRectSyncSGIX);
+    return (int)0;
+}
+GLXFBConfigSGIX * APIENTRY glXChooseFBConfigSGIX(glbind_Display* dpy, int screen, int * attrib_list, int * nelements)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXChooseFBConfigSGIX);
+    return (GLXFBConfigSGIX *)0;
+}
+void APIENTRY glXCopyBufferSubDataNV(glbind_Display* dpy, GLXContext readCtx, GLXContext writeCtx, GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXCopyBufferSubDataNV);
+}
+void APIENTRY glXCopyContext(glbind_Display* dpy, GLXContext src, GLXContext dst, unsigned long mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXCopyContext);
+}
+void APIENTRY glXCopyImageSubDataNV(glbind_Display* dpy, GLXContext srcCtx, GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLXContext dstCtx, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei width, GLsizei height, GLsizei depth)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXCopyImageSubDataNV);
+}
+void APIENTRY glXCopySubBufferMESA(glbind_Display* dpy, GLXDrawable drawable, int x, int y, int width, int height)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXCopySubBufferMESA);
+}
+GLXContext APIENTRY glXCreateAssociatedContextAMD(unsigned int id, GLXContext share_list)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXCreateAssociatedContextAMD);
+    return (GLXContext)0;
+}
+GLXContext APIENTRY glXCreateAssociatedContextAttribsAMD(unsigned int id, GLXContext share_context, const int * attribList)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXCreateAssociatedContextAttribsAMD);
+    return (GLXContext)0;
+}
+GLXContext APIENTRY glXCreateContextAttribsARB(glbind_Display* dpy, GLXFBConfig config, GLXContext share_context, glbind_Bool direct, const int * attrib_list)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXCreateContextAttribsARB);
+    return (GLXContext)0;
+}
+GLXContext APIENTRY glXCreateContextWithConfigSGIX(glbind_Display* dpy, GLXFBConfigSGIX config, int render_type, GLXContext share_list, glbind_Bool direct)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXCreateContextWithConfigSGIX);
+    return (GLXContext)0;
+}
+GLXPbufferSGIX APIENTRY glXCreateGLXPbufferSGIX(glbind_Display* dpy, GLXFBConfigSGIX config, unsigned int width, unsigned int height, int * attrib_list)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXCreateGLXPbufferSGIX);
+    return (GLXPbufferSGIX)0;
+}
+GLXPixmap APIENTRY glXCreateGLXPixmap(glbind_Display* dpy, glbind_XVisualInfo* visual, glbind_Pixmap pixmap)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXCreateGLXPixmap);
+    return (GLXPixmap)0;
+}
+GLXPixmap APIENTRY glXCreateGLXPixmapMESA(glbind_Display* dpy, glbind_XVisualInfo* visual, glbind_Pixmap pixmap, glbind_Colormap cmap)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXCreateGLXPixmapMESA);
+    return (GLXPixmap)0;
+}
+GLXPixmap APIENTRY glXCreateGLXPixmapWithConfigSGIX(glbind_Display* dpy, GLXFBConfigSGIX config, glbind_Pixmap pixmap)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXCreateGLXPixmapWithConfigSGIX);
+    return (GLXPixmap)0;
+}
+GLXPixmap APIENTRY glXCreatePixmap(glbind_Display* dpy, GLXFBConfig config, glbind_Pixmap pixmap, const int * attrib_list)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXCreatePixmap);
+    return (GLXPixmap)0;
+}
+GLXWindow APIENTRY glXCreateWindow(glbind_Display* dpy, GLXFBConfig config, glbind_Window win, const int * attrib_list)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXCreateWindow);
+    return (GLXWindow)0;
+}
+void APIENTRY glXCushionSGI(glbind_Display* dpy, glbind_Window window, float cushion)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXCushionSGI);
+}
+glbind_Bool APIENTRY glXDelayBeforeSwapNV(glbind_Display* dpy, GLXDrawable drawable, GLfloat seconds)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXDelayBeforeSwapNV);
+    return (glbind_Bool)0;
+}
+glbind_Bool APIENTRY glXDeleteAssociatedContextAMD(GLXContext ctx)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXDeleteAssociatedContextAMD);
+    return (glbind_Bool)0;
+}
+void APIENTRY glXDestroyGLXPbufferSGIX(glbind_Display* dpy, GLXPbufferSGIX pbuf)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXDestroyGLXPbufferSGIX);
+}
+void APIENTRY glXDestroyGLXPixmap(glbind_Display* dpy, GLXPixmap pixmap)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXDestroyGLXPixmap);
+}
+int APIENTRY glXDestroyHyperpipeConfigSGIX(glbind_Display* dpy, int hpId)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXDestroyHyperpipeConfigSGIX);
+    return (int)0;
+}
+void APIENTRY glXDestroyPixmap(glbind_Display* dpy, GLXPixmap pixmap)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXDestroyPixmap);
+}
+void APIENTRY glXDestroyWindow(glbind_Display* dpy, GLXWindow win)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXDestroyWindow);
+}
+GLXVideoCaptureDeviceNV * APIENTRY glXEnumerateVideoCaptureDevicesNV(glbind_Display* dpy, int screen, int * nelements)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXEnumerateVideoCaptureDevicesNV);
+    return (GLXVideoCaptureDeviceNV *)0;
+}
+unsigned int * APIENTRY glXEnumerateVideoDevicesNV(glbind_Display* dpy, int screen, int * nelements)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXEnumerateVideoDevicesNV);
+    return (unsigned int *)0;
+}
+void APIENTRY glXFreeContextEXT(glbind_Display* dpy, GLXContext context)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXFreeContextEXT);
+}
+unsigned int APIENTRY glXGetAGPOffsetMESA(const void * pointer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetAGPOffsetMESA);
+    return (unsigned int)0;
+}
+const char * APIENTRY glXGetClientString(glbind_Display* dpy, int name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetClientString);
+    return (const char *)0;
+}
+int APIENTRY glXGetConfig(glbind_Display* dpy, glbind_XVisualInfo* visual, int attrib, int * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetConfig);
+    return (int)0;
+}
+unsigned int APIENTRY glXGetContextGPUIDAMD(GLXContext ctx)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetContextGPUIDAMD);
+    return (unsigned int)0;
+}
+GLXContextID APIENTRY glXGetContextIDEXT(const GLXContext context)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetContextIDEXT);
+    return (GLXContextID)0;
+}
+GLXContext APIENTRY glXGetCurrentAssociatedContextAMD(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetCurrentAssociatedContextAMD);
+    return (GLXContext)0;
+}
+glbind_Display* APIENTRY glXGetCurrentDisplayEXT(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetCurrentDisplayEXT);
+    return (glbind_Display*)0;
+}
+GLXDrawable APIENTRY glXGetCurrentReadDrawable(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetCurrentReadDrawable);
+    return (GLXDrawable)0;
+}
+GLXDrawable APIENTRY glXGetCurrentReadDrawableSGI(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetCurrentReadDrawableSGI);
+    return (GLXDrawable)0;
+}
+int APIENTRY glXGetFBConfigAttrib(glbind_Display* dpy, GLXFBConfig config, int attribute, int * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetFBConfigAttrib);
+    return (int)0;
+}
+int APIENTRY glXGetFBConfigAttribSGIX(glbind_Display* dpy, GLXFBConfigSGIX config, int attribute, int * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetFBConfigAttribSGIX);
+    return (int)0;
+}
+GLXFBConfigSGIX APIENTRY glXGetFBConfigFromVisualSGIX(glbind_Display* dpy, glbind_XVisualInfo* vis)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetFBConfigFromVisualSGIX);
+    return (GLXFBConfigSGIX)0;
+}
+GLXFBConfig * APIENTRY glXGetFBConfigs(glbind_Display* dpy, int screen, int * nelements)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetFBConfigs);
+    return (GLXFBConfig *)0;
+}
+unsigned int APIENTRY glXGetGPUIDsAMD(unsigned int maxCount, unsigned int * ids)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetGPUIDsAMD);
+    return (unsigned int)0;
+}
+int APIENTRY glXGetGPUInfoAMD(unsigned int id, int property, GLenum dataType, unsigned int size, void * data)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetGPUInfoAMD);
+    return (int)0;
+}
+glbind_Bool APIENTRY glXGetMscRateOML(glbind_Display* dpy, GLXDrawable drawable, int32_t * numerator, int32_t * denominator)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetMscRateOML);
+    return (glbind_Bool)0;
+}
+void APIENTRY glXGetSelectedEvent(glbind_Display* dpy, GLXDrawable draw, unsigned long * event_mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetSelectedEvent);
+}
+void APIENTRY glXGetSelectedEventSGIX(glbind_Display* dpy, GLXDrawable drawable, unsigned long * mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetSelectedEventSGIX);
+}
+int APIENTRY glXGetSwapIntervalMESA(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetSwapIntervalMESA);
+    return (int)0;
+}
+glbind_Bool APIENTRY glXGetSyncValuesOML(glbind_Display* dpy, GLXDrawable drawable, int64_t * ust, int64_t * msc, int64_t * sbc)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetSyncValuesOML);
+    return (glbind_Bool)0;
+}
+glbind_Status APIENTRY glXGetTransparentIndexSUN(glbind_Display* dpy, glbind_Window overlay, glbind_Window underlay, unsigned long * pTransparentIndex)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetTransparentIndexSUN);
+    return (glbind_Status)0;
+}
+int APIENTRY glXGetVideoDeviceNV(glbind_Display* dpy, int screen, int numVideoDevices, GLXVideoDeviceNV * pVideoDevice)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetVideoDeviceNV);
+    return (int)0;
+}
+int APIENTRY glXGetVideoInfoNV(glbind_Display* dpy, int screen, GLXVideoDeviceNV VideoDevice, unsigned long * pulCounterOutputPbuffer, unsigned long * pulCounterOutputVideo)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetVideoInfoNV);
+    return (int)0;
+}
+int APIENTRY glXGetVideoSyncSGI(unsigned int * count)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetVideoSyncSGI);
+    return (int)0;
+}
+glbind_XVisualInfo* APIENTRY glXGetVisualFromFBConfigSGIX(glbind_Display* dpy, GLXFBConfigSGIX config)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetVisualFromFBConfigSGIX);
+    return (glbind_XVisualInfo*)0;
+}
+int APIENTRY glXHyperpipeAttribSGIX(glbind_Display* dpy, int timeSlice, int attrib, int size, void * attribList)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXHyperpipeAttribSGIX);
+    return (int)0;
+}
+int APIENTRY glXHyperpipeConfigSGIX(glbind_Display* dpy, int networkId, int npipes, GLXHyperpipeConfigSGIX * cfg, int * hpId)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXHyperpipeConfigSGIX);
+    return (int)0;
+}
+GLXContext APIENTRY glXImportContextEXT(glbind_Display* dpy, GLXContextID contextID)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXImportContextEXT);
+    return (GLXContext)0;
+}
+glbind_Bool APIENTRY glXIsDirect(glbind_Display* dpy, GLXContext ctx)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXIsDirect);
+    return (glbind_Bool)0;
+}
+glbind_Bool APIENTRY glXJoinSwapGroupNV(glbind_Display* dpy, GLXDrawable drawable, GLuint group)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXJoinSwapGroupNV);
+    return (glbind_Bool)0;
+}
+void APIENTRY glXJoinSwapGroupSGIX(glbind_Display* dpy, GLXDrawable drawable, GLXDrawable member)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXJoinSwapGroupSGIX);
+}
+void APIENTRY glXLockVideoCaptureDeviceNV(glbind_Display* dpy, GLXVideoCaptureDeviceNV device)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXLockVideoCaptureDeviceNV);
+}
+glbind_Bool APIENTRY glXMakeAssociatedContextCurrentAMD(GLXContext ctx)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXMakeAssociatedContextCurrentAMD);
+    return (glbind_Bool)0;
+}
+glbind_Bool APIENTRY glXMakeContextCurrent(glbind_Display* dpy, GLXDrawable draw, GLXDrawable read, GLXContext ctx)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXMakeContextCurrent);
+    return (glbind_Bool)0;
+}
+glbind_Bool APIENTRY glXMakeCurrentReadSGI(glbind_Display* dpy, GLXDrawable draw, GLXDrawable read, GLXContext ctx)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXMakeCurrentReadSGI);
+    return (glbind_Bool)0;
+}
+void APIENTRY glXNamedCopyBufferSubDataNV(glbind_Display* dpy, GLXContext readCtx, GLXContext writeCtx, GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXNamedCopyBufferSubDataNV);
+}
+int APIENTRY glXQueryChannelDeltasSGIX(glbind_Display* display, int screen, int channel, int * x, int * y, int * w, int * h)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryChannelDeltasSGIX);
+    return (int)0;
+}
+int APIENTRY glXQueryChannelRectSGIX(glbind_Display* display, int screen, int channel, int * dx, int * dy, int * dw, int * dh)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryChannelRectSGIX);
+    return (int)0;
+}
+int APIENTRY glXQueryContext(glbind_Display* dpy, GLXContext ctx, int attribute, int * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryContext);
+    return (int)0;
+}
+int APIENTRY glXQueryContextInfoEXT(glbind_Display* dpy, GLXContext context, int attribute, int * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryContextInfoEXT);
+    return (int)0;
+}
+glbind_Bool APIENTRY glXQueryCurrentRendererIntegerMESA(int attribute, unsigned int * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryCurrentRendererIntegerMESA);
+    return (glbind_Bool)0;
+}
+const char * APIENTRY glXQueryCurrentRendererStringMESA(int attribute)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryCurrentRendererStringMESA);
+    return (const char *)0;
+}
+void APIENTRY glXQueryDrawable(glbind_Display* dpy, GLXDrawable draw, int attribute, unsigned int * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryDrawable);
+}
+glbind_Bool APIENTRY glXQueryExtension(glbind_Display* dpy, int * errorb, int * event)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryExtension);
+    return (glbind_Bool)0;
+}
+glbind_Bool APIENTRY glXQueryFrameCountNV(glbind_Display* dpy, int screen, GLuint * count)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryFrameCountNV);
+    return (glbind_Bool)0;
+}
+void APIENTRY glXQueryGLXPbufferSGIX(glbind_Display* dpy, GLXPbufferSGIX pbuf, int attribute, unsigned int * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryGLXPbufferSGIX);
+}
+int APIENTRY glXQueryHyperpipeAttribSGIX(glbind_Display* dpy, int timeSlice, int attrib, int size, void * returnAttribList)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryHyperpipeAttribSGIX);
+    return (int)0;
+}
+int APIENTRY glXQueryHyperpipeBestAttribSGIX(glbind_Display* dpy, int timeSlice, int attrib, int size, void * attribList, void * returnAttribList)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryHyperpipeBestAttribSGIX);
+    return (int)0;
+}
+GLXHyperpipeConfigSGIX * APIENTRY glXQueryHyperpipeConfigSGIX(glbind_Display* dpy, int hpId, int * npipes)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryHyperpipeConfigSGIX);
+    return (GLXHyperpipeConfigSGIX *)0;
+}
+GLXHyperpipeNetworkSGIX * APIENTRY glXQueryHyperpipeNetworkSGIX(glbind_Display* dpy, int * npipes)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryHyperpipeNetworkSGIX);
+    return (GLXHyperpipeNetworkSGIX *)0;
+}
+glbind_Bool APIENTRY glXQueryMaxSwapBarriersSGIX(glbind_Display* dpy, int screen, int * max)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryMaxSwapBarriersSGIX);
+    return (glbind_Bool)0;
+}
+glbind_Bool APIENTRY glXQueryMaxSwapGroupsNV(glbind_Display* dpy, int screen, GLuint * maxGroups, GLuint * maxBarriers)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryMaxSwapGroupsNV);
+    return (glbind_Bool)0;
+}
+glbind_Bool APIENTRY glXQueryRendererIntegerMESA(glbind_Display* dpy, int screen, int renderer, int attribute, unsigned int * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryRendererIntegerMESA);
+    return (glbind_Bool)0;
+}
+const char * APIENTRY glXQueryRendererStringMESA(glbind_Display* dpy, int screen, int renderer, int attribute)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryRendererStringMESA);
+    return (const char *)0;
+}
+const char * APIENTRY glXQueryServerString(glbind_Display* dpy, int screen, int name)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryServerString);
+    return (const char *)0;
+}
+glbind_Bool APIENTRY glXQuerySwapGroupNV(glbind_Display* dpy, GLXDrawable drawable, GLuint * group, GLuint * barrier)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQuerySwapGroupNV);
+    return (glbind_Bool)0;
+}
+glbind_Bool APIENTRY glXQueryVersion(glbind_Display* dpy, int * maj, int * min)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryVersion);
+    return (glbind_Bool)0;
+}
+int APIENTRY glXQueryVideoCaptureDeviceNV(glbind_Display* dpy, GLXVideoCaptureDeviceNV device, int attribute, int * value)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXQueryVideoCaptureDeviceNV);
+    return (int)0;
+}
+glbind_Bool APIENTRY glXReleaseBuffersMESA(glbind_Display* dpy, GLXDrawable drawable)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXReleaseBuffersMESA);
+    return (glbind_Bool)0;
+}
+void APIENTRY glXReleaseTexImageEXT(glbind_Display* dpy, GLXDrawable drawable, int buffer)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXReleaseTexImageEXT);
+}
+void APIENTRY glXReleaseVideoCaptureDeviceNV(glbind_Display* dpy, GLXVideoCaptureDeviceNV device)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXReleaseVideoCaptureDeviceNV);
+}
+int APIENTRY glXReleaseVideoDeviceNV(glbind_Display* dpy, int screen, GLXVideoDeviceNV VideoDevice)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXReleaseVideoDeviceNV);
+    return (int)0;
+}
+int APIENTRY glXReleaseVideoImageNV(glbind_Display* dpy, GLXPbuffer pbuf)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXReleaseVideoImageNV);
+    return (int)0;
+}
+glbind_Bool APIENTRY glXResetFrameCountNV(glbind_Display* dpy, int screen)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXResetFrameCountNV);
+    return (glbind_Bool)0;
+}
+void APIENTRY glXSelectEvent(glbind_Display* dpy, GLXDrawable draw, unsigned long event_mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXSelectEvent);
+}
+void APIENTRY glXSelectEventSGIX(glbind_Display* dpy, GLXDrawable drawable, unsigned long mask)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXSelectEventSGIX);
+}
+int APIENTRY glXSendPbufferToVideoNV(glbind_Display* dpy, GLXPbuffer pbuf, int iBufferType, unsigned long * pulCounterPbuffer, GLboolean bBlock)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXSendPbufferToVideoNV);
+    return (int)0;
+}
+GLboolean APIENTRY glXSet3DfxModeMESA(GLint mode)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXSet3DfxModeMESA);
+    return (GLboolean)0;
+}
+int64_t APIENTRY glXSwapBuffersMscOML(glbind_Display* dpy, GLXDrawable drawable, int64_t target_msc, int64_t divisor, int64_t remainder)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXSwapBuffersMscOML);
+    return (int64_t)0;
+}
+void APIENTRY glXSwapIntervalEXT(glbind_Display* dpy, GLXDrawable drawable, int interval)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXSwapIntervalEXT);
+}
+int APIENTRY glXSwapIntervalMESA(unsigned int interval)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXSwapIntervalMESA);
+    return (int)0;
+}
+int APIENTRY glXSwapIntervalSGI(int interval)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXSwapIntervalSGI);
+    return (int)0;
+}
+void APIENTRY glXUseXFont(glbind_Font font, int first, int count, int list)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXUseXFont);
+}
+glbind_Bool APIENTRY glXWaitForMscOML(glbind_Display* dpy, GLXDrawable drawable, int64_t target_msc, int64_t divisor, int64_t remainder, int64_t * ust, int64_t * msc, int64_t * sbc)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXWaitForMscOML);
+    return (glbind_Bool)0;
+}
+glbind_Bool APIENTRY glXWaitForSbcOML(glbind_Display* dpy, GLXDrawable drawable, int64_t target_sbc, int64_t * ust, int64_t * msc, int64_t * sbc)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXWaitForSbcOML);
+    return (glbind_Bool)0;
+}
+void APIENTRY glXWaitGL(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXWaitGL);
+}
+int APIENTRY glXWaitVideoSyncSGI(int divisor, int remainder, unsigned int * count)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXWaitVideoSyncSGI);
+    return (int)0;
+}
+void APIENTRY glXWaitX(void)
+{
+    GLB_STUB_CALL(GLB_STUB_PROC_glXWaitX);
+}
+
+
+/* Sorted by name for glXGetProcAddress(). */
+static const glbStubProcEntry g_glbStubProcs[] = {
+    {"glAccum", (GLBproc)glAccum},
+    {"glAccumxOES", (GLBproc)glAccumxOES},
+    {"glAcquireKeyedMutexWin32EXT", (GLBproc)glAcquireKeyedMutexWin32EXT},
+    {"glActiveProgramEXT", (GLBproc)glActiveProgramEXT},
+    {"glActiveShaderProgram", (GLBproc)glActiveShaderProgram},
+    {"glActiveShaderProgramEXT", (GLBproc)glActiveShaderProgramEXT},
+    {"glActiveStencilFaceEXT", (GLBproc)glActiveStencilFaceEXT},
+    {"glActiveTexture", (GLBproc)glActiveTexture},
+    {"glActiveTextureARB", (GLBproc)glActiveTextureARB},
+    {"glActiveVaryingNV", (GLBproc)glActiveVaryingNV},
+    {"glAlphaFragmentOp1ATI", (GLBproc)glAlphaFragmentOp1ATI},
+    {"glAlphaFragmentOp2ATI", (GLBproc)glAlphaFragmentOp2ATI},
+    {"glAlphaFragmentOp3ATI", (GLBproc)glAlphaFragmentOp3ATI},
+    {"glAlphaFunc", (GLBproc)glAlphaFunc},
+    {"glAlphaFuncxOES", (GLBproc)glAlphaFuncxOES},
+    {"glAlphaToCoverageDitherControlNV", (GLBproc)glAlphaToCoverageDitherControlNV},
+    {"glApplyFramebufferAttachmentCMAAINTEL", (GLBproc)glApplyFramebufferAttachmentCMAAINTEL},
+    {"glApplyTextureEXT", (GLBproc)glApplyTextureEXT},
+    {"glAreProgramsResidentNV", (GLBproc)glAreProgramsResidentNV},
+    {"glAreTexturesResident", (GLBproc)glAreTexturesResident},
+    {"glAreTexturesResidentEXT", (GLBproc)glAreTexturesResidentEXT},
+    {"glArrayElement", (GLBproc)glArrayElement},
+    {"glArrayElementEXT", (GLBproc)glArrayElementEXT},
+    {"glArrayObjectATI", (GLBproc)glArrayObjectATI},
+    {"glAsyncCopyBufferSubDataNVX", (GLBproc)glAsyncCopyBufferSubDataNVX},
+    {"glAsyncCopyImageSubDataNVX", (GLBproc)glAsyncCopyImageSubDataNVX},
+    {"glAsyncMarkerSGIX", (GLBproc)glAsyncMarkerSGIX},
+    {"glAttachObjectARB", (GLBproc)glAttachObjectARB},
+    {"glAttachShader", (GLBproc)glAttachShader},
+    {"glBegin", (GLBproc)glBegin},
+    {"glBeginConditionalRender", (GLBproc)glBeginConditionalRender},
+    {"glBeginConditionalRenderNV", (GLBproc)glBeginConditionalRenderNV},
+    {"glBeginConditionalRenderNVX", (GLBproc)glBeginConditionalRenderNVX},
+    {"glBeginFragmentShaderATI", (GLBproc)glBeginFragmentShaderATI},
+    {"glBeginOcclusionQueryNV", (GLBproc)glBeginOcclusionQueryNV},
+    {"glBeginPerfMonitorAMD", (GLBproc)glBeginPerfMonitorAMD},
+    {"glBeginPerfQueryINTEL", (GLBproc)glBeginPerfQueryINTEL},
+    {"glBeginQuery", (GLBproc)glBeginQuery},
+    {"glBeginQueryARB", (GLBproc)glBeginQueryARB},
+    {"glBeginQueryIndexed", (GLBproc)glBeginQueryIndexed},
+    {"glBeginTransformFeedback", (GLBproc)glBeginTransformFeedback},
+    {"glBeginTransformFeedbackEXT", (GLBproc)glBeginTransformFeedbackEXT},
+    {"glBeginTransformFeedbackNV", (GLBproc)glBeginTransformFeedbackNV},
+    {"glBeginVertexShaderEXT", (GLBproc)glBeginVertexShaderEXT},
+    {"glBeginVideoCaptureNV", (GLBproc)glBeginVideoCaptureNV},
+    {"glBindAttribLocation", (GLBproc)glBindAttribLocation},
+    {"glBindAttribLocationARB", (GLBproc)glBindAttribLocationARB},
+    {"glBindBuffer", (GLBproc)glBindBuffer},
+    {"glBindBufferARB", (GLBproc)glBindBufferARB},
+    {"glBindBufferBase", (GLBproc)glBindBufferBase},
+    {"glBindBufferBaseEXT", (GLBproc)glBindBufferBaseEXT},
+    {"glBindBufferBaseNV", (GLBproc)glBindBufferBaseNV},
+    {"glBindBufferOffsetEXT", (GLBproc)glBindBufferOffsetEXT},
+    {"glBindBufferOffsetNV", (GLBproc)glBindBufferOffsetNV},
+    {"glBindBufferRange", (GLBproc)glBindBufferRange},
+    {"glBindBufferRangeEXT", (GLBproc)glBindBufferRangeEXT},
+    {"glBindBufferRangeNV", (GLBproc)glBindBufferRangeNV},
+    {"glBindBuffersBase", (GLBproc)glBindBuffersBase},
+    {"glBindBuffersRange", (GLBproc)glBindBuffersRange},
+    {"glBindFragDataLocation", (GLBproc)glBindFragDataLocation},
+    {"glBindFragDataLocationEXT", (GLBproc)glBindFragDataLocationEXT},
+    {"glBindFragDataLocationIndexed", (GLBproc)glBindFragDataLocationIndexed},
+    {"glBindFragmentShaderATI", (GLBproc)glBindFragmentShaderATI},
+    {"glBindFramebuffer", (GLBproc)glBindFramebuffer},
+    {"glBindFramebufferEXT", (GLBproc)glBindFramebufferEXT},
+    {"glBindImageTexture", (GLBproc)glBindImageTexture},
+    {"glBindImageTextureEXT", (GLBproc)glBindImageTextureEXT},
+    {"glBindImageTextures", (GLBproc)glBindImageTextures},
+    {"glBindLightParameterEXT", (GLBproc)glBindLightParameterEXT},
+    {"glBindMaterialParameterEXT", (GLBproc)glBindMaterialParameterEXT},
+    {"glBindMultiTextureEXT", (GLBproc)glBindMultiTextureEXT},
+    {"glBindParameterEXT", (GLBproc)glBindParameterEXT},
+    {"glBindProgramARB", (GLBproc)glBindProgramARB},
+    {"glBindProgramNV", (GLBproc)glBindProgramNV},
+    {"glBindProgramPipeline", (GLBproc)glBindProgramPipeline},
+    {"glBindProgramPipelineEXT", (GLBproc)glBindProgramPipelineEXT},
+    {"glBindRenderbuffer", (GLBproc)glBindRenderbuffer},
+    {"glBindRenderbufferEXT", (GLBproc)glBindRenderbufferEXT},
+    {"glBindSampler", (GLBproc)glBindSampler},
+    {"glBindSamplers", (GLBproc)glBindSamplers},
+    {"glBindShadingRateImageNV", (GLBproc)glBindShadingRateImageNV},
+    {"glBindTexGenParameterEXT", (GLBproc)glBindTexGenParameterEXT},
+    {"glBindTexture", (GLBproc)glBindTexture},
+    {"glBindTextureEXT", (GLBproc)glBindTextureEXT},
+    {"glBindTextureUnit", (GLBproc)glBindTextureUnit},
+    {"glBindTextureUnitParameterEXT", (GLBproc)glBindTextureUnitParameterEXT},
+    {"glBindTextures", (GLBproc)glBindTextures},
+    {"glBindTransformFeedback", (GLBproc)glBindTransformFeedback},
+    {"glBindTransformFeedbackNV", (GLBproc)glBindTransformFeedbackNV},
+    {"glBindVertexArray", (GLBproc)glBindVertexArray},
+    {"glBindVertexArrayAPPLE", (GLBproc)glBindVertexArrayAPPLE},
+    {"glBindVertexBuffer", (GLBproc)glBindVertexBuffer},
+    {"glBindVertexBuffers", (GLBproc)glBindVertexBuffers},
+    {"glBindVertexShaderEXT", (GLBproc)glBindVertexShaderEXT},
+    {"glBindVideoCaptureStreamBufferNV", (GLBproc)glBindVideoCaptureStreamBufferNV},
+    {"glBindVideoCaptureStreamTextureNV", (GLBproc)glBindVideoCaptureStreamTextureNV},
+    {"glBinormal3bEXT", (GLBproc)glBinormal3bEXT},
+    {"glBinormal3bvEXT", (GLBproc)glBinormal3bvEXT},
+    {"glBinormal3dEXT", (GLBproc)glBinormal3dEXT},
+    {"glBinormal3dvEXT", (GLBproc)glBinormal3dvEXT},
+    {"glBinormal3fEXT", (GLBproc)glBinormal3fEXT},
+    {"glBinormal3fvEXT", (GLBproc)glBinormal3fvEXT},
+    {"glBinormal3iEXT", (GLBproc)glBinormal3iEXT},
+    {"glBinormal3ivEXT", (GLBproc)glBinormal3ivEXT},
+    {"glBinormal3sEXT", (GLBproc)glBinormal3sEXT},
+    {"glBinormal3svEXT", (GLBproc)glBinormal3svEXT},
+    {"glBinormalPointerEXT", (GLBproc)glBinormalPointerEXT},
+    {"glBitmap", (GLBproc)glBitmap},
+    {"glBitmapxOES", (GLBproc)glBitmapxOES},
+    {"glBlendBarrierKHR", (GLBproc)glBlendBarrierKHR},
+    {"glBlendBarrierNV", (GLBproc)glBlendBarrierNV},
+    {"glBlendColor", (GLBproc)glBlendColor},
+    {"glBlendColorEXT", (GLBproc)glBlendColorEXT},
+    {"glBlendColorxOES", (GLBproc)glBlendColorxOES},
+    {"glBlendEquation", (GLBproc)glBlendEquation},
+    {"glBlendEquationEXT", (GLBproc)glBlendEquationEXT},
+    {"glBlendEquationIndexedAMD", (GLBproc)glBlendEquationIndexedAMD},
+    {"glBlendEquationSeparate", (GLBproc)glBlendEquationSeparate},
+    {"glBlendEquationSeparateEXT", (GLBproc)glBlendEquationSeparateEXT},
+    {"glBlendEquationSeparateIndexedAMD", (GLBproc)glBlendEquationSeparateIndexedAMD},
+    {"glBlendEquationSeparatei", (GLBproc)glBlendEquationSeparatei},
+    {"glBlendEquationSeparateiARB", (GLBproc)glBlendEquationSeparateiARB},
+    {"glBlendEquationi", (GLBproc)glBlendEquationi},
+    {"glBlendEquationiARB", (GLBproc)glBlendEquationiARB},
+    {"glBlendFunc", (GLBproc)glBlendFunc},
+    {"glBlendFuncIndexedAMD", (GLBproc)glBlendFuncIndexedAMD},
+    {"glBlendFuncSeparate", (GLBproc)glBlendFuncSeparate},
+    {"glBlendFuncSeparateEXT", (GLBproc)glBlendFuncSeparateEXT},
+    {"glBlendFuncSeparateINGR", (GLBproc)glBlendFuncSeparateINGR},
+    {"glBlendFuncSeparateIndexedAMD", (GLBproc)glBlendFuncSeparateIndexedAMD},
+    {"glBlendFuncSeparatei", (GLBproc)glBlendFuncSeparatei},
+    {"glBlendFuncSeparateiARB", (GLBproc)glBlendFuncSeparateiARB},
+    {"glBlendFunci", (GLBproc)glBlendFunci},
+    {"glBlendFunciARB", (GLBproc)glBlendFunciARB},
+    {"glBlendParameteriNV", (GLBproc)glBlendParameteriNV},
+    {"glBlitFramebuffer", (GLBproc)glBlitFramebuffer},
+    {"glBlitFramebufferEXT", (GLBproc)glBlitFramebufferEXT},
+    {"glBlitNamedFramebuffer", (GLBproc)glBlitNamedFramebuffer},
+    {"glBufferAddressRangeNV", (GLBproc)glBufferAddressRangeNV},
+    {"glBufferAttachMemoryNV", (GLBproc)glBufferAttachMemoryNV},
+    {"glBufferData", (GLBproc)glBufferData},
+    {"glBufferDataARB", (GLBproc)glBufferDataARB},
+    {"glBufferPageCommitmentARB", (GLBproc)glBufferPageCommitmentARB},
+    {"glBufferPageCommitmentMemNV", (GLBproc)glBufferPageCommitmentMemNV},
+    {"glBufferParameteriAPPLE", (GLBproc)glBufferParameteriAPPLE},
+    {"glBufferStorage", (GLBproc)glBufferStorage},
+    {"glBufferStorageExternalEXT", (GLBproc)glBufferStorageExternalEXT},
+    {"glBufferStorageMemEXT", (GLBproc)glBufferStorageMemEXT},
+    {"glBufferSubData", (GLBproc)glBufferSubData},
+    {"glBufferSubDataARB", (GLBproc)glBufferSubDataARB},
+    {"glCallCommandListNV", (GLBproc)glCallCommandListNV},
+    {"glCallList", (GLBproc)glCallList},
+    {"glCallLists", (GLBproc)glCallLists},
+    {"glCheckFramebufferStatus", (GLBproc)glCheckFramebufferStatus},
+    {"glCheckFramebufferStatusEXT", (GLBproc)glCheckFramebufferStatusEXT},
+    {"glCheckNamedFramebufferStatus", (GLBproc)glCheckNamedFramebufferStatus},
+    {"glCheckNamedFramebufferStatusEXT", (GLBproc)glCheckNamedFramebufferStatusEXT},
+    {"glClampColor", (GLBproc)glClampColor},
+    {"glClampColorARB", (GLBproc)glClampColorARB},
+    {"glClear", (GLBproc)glClear},
+    {"glClearAccum", (GLBproc)glClearAccum},
+    {"glClearAccumxOES", (GLBproc)glClearAccumxOES},
+    {"glClearBufferData", (GLBproc)glClearBufferData},
+    {"glClearBufferSubData", (GLBproc)glClearBufferSubData},
+    {"glClearBufferfi", (GLBproc)glClearBufferfi},
+    {"glClearBufferfv", (GLBproc)glClearBufferfv},
+    {"glClearBufferiv", (GLBproc)glClearBufferiv},
+    {"glClearBufferuiv", (GLBproc)glClearBufferuiv},
+    {"glClearColor", (GLBproc)glClearColor},
+    {"glClearColorIiEXT", (GLBproc)glClearColorIiEXT},
+    {"glClearColorIuiEXT", (GLBproc)glClearColorIuiEXT},
+    {"glClearColorxOES", (GLBproc)glClearColorxOES},
+    {"glClearDepth", (GLBproc)glClearDepth},
+    {"glClearDepthdNV", (GLBproc)glClearDepthdNV},
+    {"glClearDepthf", (GLBproc)glClearDepthf},
+    {"glClearDepthfOES", (GLBproc)glClearDepthfOES},
+    {"glClearDepthxOES", (GLBproc)glClearDepthxOES},
+    {"glClearIndex", (GLBproc)glClearIndex},
+    {"glClearNamedBufferData", (GLBproc)glClearNamedBufferData},
+    {"glClearNamedBufferDataEXT", (GLBproc)glClearNamedBufferDataEXT},
+    {"glClearNamedBufferSubData", (GLBproc)glClearNamedBufferSubData},
+    {"glClearNamedBufferSubDataEXT", (GLBproc)glClearNamedBufferSubDataEXT},
+    {"glClearNamedFramebufferfi", (GLBproc)glClearNamedFramebufferfi},
+    {"glClearNamedFramebufferfv", (GLBproc)glClearNamedFramebufferfv},
+    {"glClearNamedFramebufferiv", (GLBproc)glClearNamedFramebufferiv},
+    {"glClearNamedFramebufferuiv", (GLBproc)glClearNamedFramebufferuiv},
+    {"glClearStencil", (GLBproc)glClearStencil},
+    {"glClearTexImage", (GLBproc)glClearTexImage},
+    {"glClearTexSubImage", (GLBproc)glClearTexSubImage},
+    {"glClientActiveTexture", (GLBproc)glClientActiveTexture},
+    {"glClientActiveTextureARB", (GLBproc)glClientActiveTextureARB},
+    {"glClientActiveVertexStreamATI", (GLBproc)glClientActiveVertexStreamATI},
+    {"glClientAttribDefaultEXT", (GLBproc)glClientAttribDefaultEXT},
+    {"glClientWaitSemaphoreui64NVX", (GLBproc)glClientWaitSemaphoreui64NVX},
+    {"glClientWaitSync", (GLBproc)glClientWaitSync},
+    {"glClipControl", (GLBproc)glClipControl},
+    {"glClipPlane", (GLBproc)glClipPlane},
+    {"glClipPlanefOES", (GLBproc)glClipPlanefOES},
+    {"glClipPlanexOES", (GLBproc)glClipPlanexOES},
+    {"glColor3b", (GLBproc)glColor3b},
+    {"glColor3bv", (GLBproc)glColor3bv},
+    {"glColor3d", (GLBproc)glColor3d},
+    {"glColor3dv", (GLBproc)glColor3dv},
+    {"glColor3f", (GLBproc)glColor3f},
+    {"glColor3fVertex3fSUN", (GLBproc)glColor3fVertex3fSUN},
+    {"glColor3fVertex3fvSUN", (GLBproc)glColor3fVertex3fvSUN},
+    {"glColor3fv", (GLBproc)glColor3fv},
+    {"glColor3hNV", (GLBproc)glColor3hNV},
+    {"glColor3hvNV", (GLBproc)glColor3hvNV},
+    {"glColor3i", (GLBproc)glColor3i},
+    {"glColor3iv", (GLBproc)glColor3iv},
+    {"glColor3s", (GLBproc)glColor3s},
+    {"glColor3sv", (GLBproc)glColor3sv},
+    {"glColor3ub", (GLBproc)glColor3ub},
+    {"glColor3ubv", (GLBproc)glColor3ubv},
+    {"glColor3ui", (GLBproc)glColor3ui},
+    {"glColor3uiv", (GLBproc)glColor3uiv},
+    {"glColor3us", (GLBproc)glColor3us},
+    {"glColor3usv", (GLBproc)glColor3usv},
+    {"glColor3xOES", (GLBproc)glColor3xOES},
+    {"glColor3xvOES", (GLBproc)glColor3xvOES},
+    {"glColor4b", (GLBproc)glColor4b},
+    {"glColor4bv", (GLBproc)glColor4bv},
+    {"glColor4d", (GLBproc)glColor4d},
+    {"glColor4dv", (GLBproc)glColor4dv},
+    {"glColor4f", (GLBproc)glColor4f},
+    {"glColor4fNormal3fVertex3fSUN", (GLBproc)glColor4fNormal3fVertex3fSUN},
+    {"glColor4fNormal3fVertex3fvSUN", (GLBproc)glColor4fNormal3fVertex3fvSUN},
+    {"glColor4fv", (GLBproc)glColor4fv},
+    {"glColor4hNV", (GLBproc)glColor4hNV},
+    {"glColor4hvNV", (GLBproc)glColor4hvNV},
+    {"glColor4i", (GLBproc)glColor4i},
+    {"glColor4iv", (GLBproc)glColor4iv},
+    {"glColor4s", (GLBproc)glColor4s},
+    {"glColor4sv", (GLBproc)glColor4sv},
+    {"glColor4ub", (GLBproc)glColor4ub},
+    {"glColor4ubVertex2fSUN", (GLBproc)glColor4ubVertex2fSUN},
+    {"glColor4ubVertex2fvSUN", (GLBproc)glColor4ubVertex2fvSUN},
+    {"glColor4ubVertex3fSUN", (GLBproc)glColor4ubVertex3fSUN},
+    {"glColor4ubVertex3fvSUN", (GLBproc)glColor4ubVertex3fvSUN},
+    {"glColor4ubv", (GLBproc)glColor4ubv},
+    {"glColor4ui", (GLBproc)glColor4ui},
+    {"glColor4uiv", (GLBproc)glColor4uiv},
+    {"glColor4us", (GLBproc)glColor4us},
+    {"glColor4usv", (GLBproc)glColor4usv},
+    {"glColor4xOES", (GLBproc)glColor4xOES},
+    {"glColor4xvOES", (GLBproc)glColor4xvOES},
+    {"glColorFormatNV", (GLBproc)glColorFormatNV},
+    {"glColorFragmentOp1ATI", (GLBproc)glColorFragmentOp1ATI},
+    {"glColorFragmentOp2ATI", (GLBproc)glColorFragmentOp2ATI},
+    {"glColorFragmentOp3ATI", (GLBproc)glColorFragmentOp3ATI},
+    {"glColorMask", (GLBproc)glColorMask},
+    {"glColorMaskIndexedEXT", (GLBproc)glColorMaskIndexedEXT},
+    {"glColorMaski", (GLBproc)glColorMaski},
+    {"glColorMaterial", (GLBproc)glColorMaterial},
+    {"glColorP3ui", (GLBproc)glColorP3ui},
+    {"glColorP3uiv", (GLBproc)glColorP3uiv},
+    {"glColorP4ui", (GLBproc)glColorP4ui},
+    {"glColorP4uiv", (GLBproc)glColorP4uiv},
+    {"glColorPointer", (GLBproc)glColorPointer},
+    {"glColorPointerEXT", (GLBproc)glColorPointerEXT},
+    {"glColorPointerListIBM", (GLBproc)glColorPointerListIBM},
+    {"glColorPointervINTEL", (GLBproc)glColorPointervINTEL},
+    {"glColorSubTable", (GLBproc)glColorSubTable},
+    {"glColorSubTableEXT", (GLBproc)glColorSubTableEXT},
+    {"glColorTable", (GLBproc)glColorTable},
+    {"glColorTableEXT", (GLBproc)glColorTableEXT},
+    {"glColorTableParameterfv", (GLBproc)glColorTableParameterfv},
+    {"glColorTableParameterfvSGI", (GLBproc)glColorTableParameterfvSGI},
+    {"glColorTableParameteriv", (GLBproc)glColorTableParameteriv},
+    {"glColorTableParameterivSGI", (GLBproc)glColorTableParameterivSGI},
+    {"glColorTableSGI", (GLBproc)glColorTableSGI},
+    {"glCombinerInputNV", (GLBproc)glCombinerInputNV},
+    {"glCombinerOutputNV", (GLBproc)glCombinerOutputNV},
+    {"glCombinerParameterfNV", (GLBproc)glCombinerParameterfNV},
+    {"glCombinerParameterfvNV", (GLBproc)glCombinerParameterfvNV},
+    {"glCombinerParameteriNV", (GLBproc)glCombinerParameteriNV},
+    {"glCombinerParameterivNV", (GLBproc)glCombinerParameterivNV},
+    {"glCombinerStageParameterfvNV", (GLBproc)glCombinerStageParameterfvNV},
+    {"glCommandListSegmentsNV", (GLBproc)glCommandListSegmentsNV},
+    {"glCompileCommandListNV", (GLBproc)glCompileCommandListNV},
+    {"glCompileShader", (GLBproc)glCompileShader},
+    {"glCompileShaderARB", (GLBproc)glCompileShaderARB},
+    {"glCompileShaderIncludeARB", (GLBproc)glCompileShaderIncludeARB},
+    {"glCompressedMultiTexImage1DEXT", (GLBproc)glCompressedMultiTexImage1DEXT},
+    {"glCompressedMultiTexImage2DEXT", (GLBproc)glCompressedMultiTexImage2DEXT},
+    {"glCompressedMultiTexImage3DEXT", (GLBproc)glCompressedMultiTexImage3DEXT},
+    {"glCompressedMultiTexSubImage1DEXT", (GLBproc)glCompressedMultiTexSubImage1DEXT},
+    {"glCompressedMultiTexSubImage2DEXT", (GLBproc)glCompressedMultiTexSubImage2DEXT},
+    {"glCompressedMultiTexSubImage3DEXT", (GLBproc)glCompressedMultiTexSubImage3DEXT},
+    {"glCompressedTexImage1D", (GLBproc)glCompressedTexImage1D},
+    {"glCompressedTexImage1DARB", (GLBproc)glCompressedTexImage1DARB},
+    {"glCompressedTexImage2D", (GLBproc)glCompressedTexImage2D},
+    {"glCompressedTexImage2DARB", (GLBproc)glCompressedTexImage2DARB},
+    {"glCompressedTexImage3D", (GLBproc)glCompressedTexImage3D},
+    {"glCompressedTexImage3DARB", (GLBproc)glCompressedTexImage3DARB},
+    {"glCompressedTexSubImage1D", (GLBproc)glCompressedTexSubImage1D},
+    {"glCompressedTexSubImage1DARB", (GLBproc)glCompressedTexSubImage1DARB},
+    {"glCompressedTexSubImage2D", (GLBproc)glCompressedTexSubImage2D},
+    {"glCompressedTexSubImage2DARB", (GLBproc)glCompressedTexSubImage2DARB},
+    {"glCompressedTexSubImage3D", (GLBproc)glCompressedTexSubImage3D},
+    {"glCompressedTexSubImage3DARB", (GLBproc)glCompressedTexSubImage3DARB},
+    {"glCompressedTextureImage1DEXT", (GLBproc)glCompressedTextureImage1DEXT},
+    {"glCompressedTextureImage2DEXT", (GLBproc)glCompressedTextureImage2DEXT},
+    {"glCompressedTextureImage3DEXT", (GLBproc)glCompressedTextureImage3DEXT},
+    {"glCompressedTextureSubImage1D", (GLBproc)glCompressedTextureSubImage1D},
+    {"glCompressedTextureSubImage1DEXT", (GLBproc)glCompressedTextureSubImage1DEXT},
+    {"glCompressedTextureSubImage2D", (GLBproc)glCompressedTextureSubImage2D},
+    {"glCompressedTextureSubImage2DEXT", (GLBproc)glCompressedTextureSubImage2DEXT},
+    {"glCompressedTextureSubImage3D", (GLBproc)glCompressedTextureSubImage3D},
+    {"glCompressedTextureSubImage3DEXT", (GLBproc)glCompressedTextureSubImage3DEXT},
+    {"glConservativeRasterParameterfNV", (GLBproc)glConservativeRasterParameterfNV},
+    {"glConservativeRasterParameteriNV", (GLBproc)glConservativeRasterParameteriNV},
+    {"glConvolutionFilter1D", (GLBproc)glConvolutionFilter1D},
+    {"glConvolutionFilter1DEXT", (GLBproc)glConvolutionFilter1DEXT},
+    {"glConvolutionFilter2D", (GLBproc)glConvolutionFilter2D},
+    {"glConvolutionFilter2DEXT", (GLBproc)glConvolutionFilter2DEXT},
+    {"glConvolutionParameterf", (GLBproc)glConvolutionParameterf},
+    {"glConvolutionParameterfEXT", (GLBproc)glConvolutionParameterfEXT},
+    {"glConvolutionParameterfv", (GLBproc)glConvolutionParameterfv},
+    {"glConvolutionParameterfvEXT", (GLBproc)glConvolutionParameterfvEXT},
+    {"glConvolutionParameteri", (GLBproc)glConvolutionParameteri},
+    {"glConvolutionParameteriEXT", (GLBproc)glConvolutionParameteriEXT},
+    {"glConvolutionParameteriv", (GLBproc)glConvolutionParameteriv},
+    {"glConvolutionParameterivEXT", (GLBproc)glConvolutionParameterivEXT},
+    {"glConvolutionParameterxOES", (GLBproc)glConvolutionParameterxOES},
+    {"glConvolutionParameterxvOES", (GLBproc)glConvolutionParameterxvOES},
+    {"glCopyBufferSubData", (GLBproc)glCopyBufferSubData},
+    {"glCopyColorSubTable", (GLBproc)glCopyColorSubTable},
+    {"glCopyColorSubTableEXT", (GLBproc)glCopyColorSubTableEXT},
+    {"glCopyColorTable", (GLBproc)glCopyColorTable},
+    {"glCopyColorTableSGI", (GLBproc)glCopyColorTableSGI},
+    {"glCopyConvolutionFilter1D", (GLBproc)glCopyConvolutionFilter1D},
+    {"glCopyConvolutionFilter1DEXT", (GLBproc)glCopyConvolutionFilter1DEXT},
+    {"glCopyConvolutionFilter2D", (GLBproc)glCopyConvolutionFilter2D},
+    {"glCopyConvolutionFilter2DEXT", (GLBproc)glCopyConvolutionFilter2DEXT},
+    {"glCopyImageSubData", (GLBproc)glCopyImageSubData},
+    {"glCopyImageSubDataNV", (GLBproc)glCopyImageSubDataNV},
+    {"glCopyMultiTexImage1DEXT", (GLBproc)glCopyMultiTexImage1DEXT},
+    {"glCopyMultiTexImage2DEXT", (GLBproc)glCopyMultiTexImage2DEXT},
+    {"glCopyMultiTexSubImage1DEXT", (GLBproc)glCopyMultiTexSubImage1DEXT},
+    {"glCopyMultiTexSubImage2DEXT", (GLBproc)glCopyMultiTexSubImage2DEXT},
+    {"glCopyMultiTexSubImage3DEXT", (GLBproc)glCopyMultiTexSubImage3DEXT},
+    {"glCopyNamedBufferSubData", (GLBproc)glCopyNamedBufferSubData},
+    {"glCopyPathNV", (GLBproc)glCopyPathNV},
+    {"glCopyPixels", (GLBproc)glCopyPixels},
+    {"glCopyTexImage1D", (GLBproc)glCopyTexImage1D},
+    {"glCopyTexImage1DEXT", (GLBproc)glCopyTexImage1DEXT},
+    {"glCopyTexImage2D", (GLBproc)glCopyTexImage2D},
+    {"glCopyTexImage2DEXT", (GLBproc)glCopyTexImage2DEXT},
+    {"glCopyTexSubImage1D", (GLBproc)glCopyTexSubImage1D},
+    {"glCopyTexSubImage1DEXT", (GLBproc)glCopyTexSubImage1DEXT},
+    {"glCopyTexSubImage2D", (GLBproc)glCopyTexSubImage2D},
+    {"glCopyTexSubImage2DEXT", (GLBproc)glCopyTexSubImage2DEXT},
+    {"glCopyTexSubImage3D", (GLBproc)glCopyTexSubImage3D},
+    {"glCopyTexSubImage3DEXT", (GLBproc)glCopyTexSubImage3DEXT},
+    {"glCopyTextureImage1DEXT", (GLBproc)glCopyTextureImage1DEXT},
+    {"glCopyTextureImage2DEXT", (GLBproc)glCopyTextureImage2DEXT},
+    {"glCopyTextureSubImage1D", (GLBproc)glCopyTextureSubImage1D},
+    {"glCopyTextureSubImage1DEXT", (GLBproc)glCopyTextureSubImage1DEXT},
+    {"glCopyTextureSubImage2D", (GLBproc)glCopyTextureSubImage2D},
+    {"glCopyTextureSubImage2DEXT", (GLBproc)glCopyTextureSubImage2DEXT},
+    {"glCopyTextureSubImage3D", (GLBproc)glCopyTextureSubImage3D},
+    {"glCopyTextureSubImage3DEXT", (GLBproc)glCopyTextureSubImage3DEXT},
+    {"glCoverFillPathInstancedNV", (GLBproc)glCoverFillPathInstancedNV},
+    {"glCoverFillPathNV", (GLBproc)glCoverFillPathNV},
+    {"glCoverStrokePathInstancedNV", (GLBproc)glCoverStrokePathInstancedNV},
+    {"glCoverStrokePathNV", (GLBproc)glCoverStrokePathNV},
+    {"glCoverageModulationNV", (GLBproc)glCoverageModulationNV},
+    {"glCoverageModulationTableNV", (GLBproc)glCoverageModulationTableNV},
+    {"glCreateBuffers", (GLBproc)glCreateBuffers},
+    {"glCreateCommandListsNV", (GLBproc)glCreateCommandListsNV},
+    {"glCreateFramebuffers", (GLBproc)glCreateFramebuffers},
+    {"glCreateMemoryObjectsEXT", (GLBproc)glCreateMemoryObjectsEXT},
+    {"glCreatePerfQueryINTEL", (GLBproc)glCreatePerfQueryINTEL},
+    {"glCreateProgram", (GLBproc)glCreateProgram},
+    {"glCreateProgramObjectARB", (GLBproc)glCreateProgramObjectARB},
+    {"glCreateProgramPipelines", (GLBproc)glCreateProgramPipelines},
+    {"glCreateProgressFenceNVX", (GLBproc)glCreateProgressFenceNVX},
+    {"glCreateQueries", (GLBproc)glCreateQueries},
+    {"glCreateRenderbuffers", (GLBproc)glCreateRenderbuffers},
+    {"glCreateSamplers", (GLBproc)glCreateSamplers},
+    {"glCreateSemaphoresNV", (GLBproc)glCreateSemaphoresNV},
+    {"glCreateShader", (GLBproc)glCreateShader},
+    {"glCreateShaderObjectARB", (GLBproc)glCreateShaderObjectARB},
+    {"glCreateShaderProgramEXT", (GLBproc)glCreateShaderProgramEXT},
+    {"glCreateShaderProgramv", (GLBproc)glCreateShaderProgramv},
+    {"glCreateShaderProgramvEXT", (GLBproc)glCreateShaderProgramvEXT},
+    {"glCreateStatesNV", (GLBproc)glCreateStatesNV},
+    {"glCreateSyncFromCLeventARB", (GLBproc)glCreateSyncFromCLeventARB},
+    {"glCreateTextures", (GLBproc)glCreateTextures},
+    {"glCreateTransformFeedbacks", (GLBproc)glCreateTransformFeedbacks},
+    {"glCreateVertexArrays", (GLBproc)glCreateVertexArrays},
+    {"glCullFace", (GLBproc)glCullFace},
+    {"glCullParameterdvEXT", (GLBproc)glCullParameterdvEXT},
+    {"glCullParameterfvEXT", (GLBproc)glCullParameterfvEXT},
+    {"glCurrentPaletteMatrixARB", (GLBproc)glCurrentPaletteMatrixARB},
+    {"glDebugMessageCallback", (GLBproc)glDebugMessageCallback},
+    {"glDebugMessageCallbackAMD", (GLBproc)glDebugMessageCallbackAMD},
+    {"glDebugMessageCallbackARB", (GLBproc)glDebugMessageCallbackARB},
+    {"glDebugMessageCallbackKHR", (GLBproc)glDebugMessageCallbackKHR},
+    {"glDebugMessageControl", (GLBproc)glDebugMessageControl},
+    {"glDebugMessageControlARB", (GLBproc)glDebugMessageControlARB},
+    {"glDebugMessageControlKHR", (GLBproc)glDebugMessageControlKHR},
+    {"glDebugMessageEnableAMD", (GLBproc)glDebugMessageEnableAMD},
+    {"glDebugMessageInsert", (GLBproc)glDebugMessageInsert},
+    {"glDebugMessageInsertAMD", (GLBproc)glDebugMessageInsertAMD},
+    {"glDebugMessageInsertARB", (GLBproc)glDebugMessageInsertARB},
+    {"glDebugMessageInsertKHR", (GLBproc)glDebugMessageInsertKHR},
+    {"glDeformSGIX", (GLBproc)glDeformSGIX},
+    {"glDeformationMap3dSGIX", (GLBproc)glDeformationMap3dSGIX},
+    {"glDeformationMap3fSGIX", (GLBproc)glDeformationMap3fSGIX},
+    {"glDeleteAsyncMarkersSGIX", (GLBproc)glDeleteAsyncMarkersSGIX},
+    {"glDeleteBuffers", (GLBproc)glDeleteBuffers},
+    {"glDeleteBuffersARB", (GLBproc)glDeleteBuffersARB},
+    {"glDeleteCommandListsNV", (GLBproc)glDeleteCommandListsNV},
+    {"glDeleteFencesAPPLE", (GLBproc)glDeleteFencesAPPLE},
+    {"glDeleteFencesNV", (GLBproc)glDeleteFencesNV},
+    {"glDeleteFragmentShaderATI", (GLBproc)glDeleteFragmentShaderATI},
+    {"glDeleteFramebuffers", (GLBproc)glDeleteFramebuffers},
+    {"glDeleteFramebuffersEXT", (GLBproc)glDeleteFramebuffersEXT},
+    {"glDeleteLists", (GLBproc)glDeleteLists},
+    {"glDeleteMemoryObjectsEXT", (GLBproc)glDeleteMemoryObjectsEXT},
+    {"glDeleteNamedStringARB", (GLBproc)glDeleteNamedStringARB},
+    {"glDeleteNamesAMD", (GLBproc)glDeleteNamesAMD},
+    {"glDeleteObjectARB", (GLBproc)glDeleteObjectARB},
+    {"glDeleteOcclusionQueriesNV", (GLBproc)glDeleteOcclusionQueriesNV},
+    {"glDeletePathsNV", (GLBproc)glDeletePathsNV},
+    {"glDeletePerfMonitorsAMD", (GLBproc)glDeletePerfMonitorsAMD},
+    {"glDeletePerfQueryINTEL", (GLBproc)glDeletePerfQueryINTEL},
+    {"glDeleteProgram", (GLBproc)glDeleteProgram},
+    {"glDeleteProgramPipelines", (GLBproc)glDeleteProgramPipelines},
+    {"glDeleteProgramPipelinesEXT", (GLBproc)glDeleteProgramPipelinesEXT},
+    {"glDeleteProgramsARB", (GLBproc)glDeleteProgramsARB},
+    {"glDeleteProgramsNV", (GLBproc)glDeleteProgramsNV},
+    {"glDeleteQueries", (GLBproc)glDeleteQueries},
+    {"glDeleteQueriesARB", (GLBproc)glDeleteQueriesARB},
+    {"glDeleteQueryResourceTagNV", (GLBproc)glDeleteQueryResourceTagNV},
+    {"glDeleteRenderbuffers", (GLBproc)glDeleteRenderbuffers},
+    {"glDeleteRenderbuffersEXT", (GLBproc)glDeleteRenderbuffersEXT},
+    {"glDeleteSamplers", (GLBproc)glDeleteSamplers},
+    {"glDeleteSemaphoresEXT", (GLBproc)glDeleteSemaphoresEXT},
+    {"glDeleteShader", (GLBproc)glDeleteShader},
+    {"glDeleteStatesNV", (GLBproc)glDeleteStatesNV},
+    {"glDeleteSync", (GLBproc)glDeleteSync},
+    {"glDeleteTextures", (GLBproc)glDeleteTextures},
+    {"glDeleteTexturesEXT", (GLBproc)glDeleteTexturesEXT},
+    {"glDeleteTransformFeedbacks", (GLBproc)glDeleteTransformFeedbacks},
+    {"glDeleteTransformFeedbacksNV", (GLBproc)glDeleteTransformFeedbacksNV},
+    {"glDeleteVertexArrays", (GLBproc)glDeleteVertexArrays},
+    {"glDeleteVertexArraysAPPLE", (GLBproc)glDeleteVertexArraysAPPLE},
+    {"glDeleteVertexShaderEXT", (GLBproc)glDeleteVertexShaderEXT},
+    {"glDepthBoundsEXT", (GLBproc)glDepthBoundsEXT},
+    {"glDepthBoundsdNV", (GLBproc)glDepthBoundsdNV},
+    {"glDepthFunc", (GLBproc)glDepthFunc},
+    {"glDepthMask", (GLBproc)glDepthMask},
+    {"glDepthRange", (GLBproc)glDepthRange},
+    {"glDepthRangeArraydvNV", (GLBproc)glDepthRangeArraydvNV},
+    {"glDepthRangeArrayv", (GLBproc)glDepthRangeArrayv},
+    {"glDepthRangeIndexed", (GLBproc)glDepthRangeIndexed},
+    {"glDepthRangeIndexeddNV", (GLBproc)glDepthRangeIndexeddNV},
+    {"glDepthRangedNV", (GLBproc)glDepthRangedNV},
+    {"glDepthRangef", (GLBproc)glDepthRangef},
+    {"glDepthRangefOES", (GLBproc)glDepthRangefOES},
+    {"glDepthRangexOES", (GLBproc)glDepthRangexOES},
+    {"glDetachObjectARB", (GLBproc)glDetachObjectARB},
+    {"glDetachShader", (GLBproc)glDetachShader},
+    {"glDetailTexFuncSGIS", (GLBproc)glDetailTexFuncSGIS},
+    {"glDisable", (GLBproc)glDisable},
+    {"glDisableClientState", (GLBproc)glDisableClientState},
+    {"glDisableClientStateIndexedEXT", (GLBproc)glDisableClientStateIndexedEXT},
+    {"glDisableClientStateiEXT", (GLBproc)glDisableClientStateiEXT},
+    {"glDisableIndexedEXT", (GLBproc)glDisableIndexedEXT},
+    {"glDisableVariantClientStateEXT", (GLBproc)glDisableVariantClientStateEXT},
+    {"glDisableVertexArrayAttrib", (GLBproc)glDisableVertexArrayAttrib},
+    {"glDisableVertexArrayAttribEXT", (GLBproc)glDisableVertexArrayAttribEXT},
+    {"glDisableVertexArrayEXT", (GLBproc)glDisableVertexArrayEXT},
+    {"glDisableVertexAttribAPPLE", (GLBproc)glDisableVertexAttribAPPLE},
+    {"glDisableVertexAttribArray", (GLBproc)glDisableVertexAttribArray},
+    {"glDisableVertexAttribArrayARB", (GLBproc)glDisableVertexAttribArrayARB},
+    {"glDisablei", (GLBproc)glDisablei},
+    {"glDispatchCompute", (GLBproc)glDispatchCompute},
+    {"glDispatchComputeGroupSizeARB", (GLBproc)glDispatchComputeGroupSizeARB},
+    {"glDispatchComputeIndirect", (GLBproc)glDispatchComputeIndirect},
+    {"glDrawArrays", (GLBproc)glDrawArrays},
+    {"glDrawArraysEXT", (GLBproc)glDrawArraysEXT},
+    {"glDrawArraysIndirect", (GLBproc)glDrawArraysIndirect},
+    {"glDrawArraysInstanced", (GLBproc)glDrawArraysInstanced},
+    {"glDrawArraysInstancedARB", (GLBproc)glDrawArraysInstancedARB},
+    {"glDrawArraysInstancedBaseInstance", (GLBproc)glDrawArraysInstancedBaseInstance},
+    {"glDrawArraysInstancedEXT", (GLBproc)glDrawArraysInstancedEXT},
+    {"glDrawBuffer", (GLBproc)glDrawBuffer},
+    {"glDrawBuffers", (GLBproc)glDrawBuffers},
+    {"glDrawBuffersARB", (GLBproc)glDrawBuffersARB},
+    {"glDrawBuffersATI", (GLBproc)glDrawBuffersATI},
+    {"glDrawCommandsAddressNV", (GLBproc)glDrawCommandsAddressNV},
+    {"glDrawCommandsNV", (GLBproc)glDrawCommandsNV},
+    {"glDrawCommandsStatesAddressNV", (GLBproc)glDrawCommandsStatesAddressNV},
+    {"glDrawCommandsStatesNV", (GLBproc)glDrawCommandsStatesNV},
+    {"glDrawElementArrayAPPLE", (GLBproc)glDrawElementArrayAPPLE},
+    {"glDrawElementArrayATI", (GLBproc)glDrawElementArrayATI},
+    {"glDrawElements", (GLBproc)glDrawElements},
+    {"glDrawElementsBaseVertex", (GLBproc)glDrawElementsBaseVertex},
+    {"glDrawElementsIndirect", (GLBproc)glDrawElementsIndirect},
+    {"glDrawElementsInstanced", (GLBproc)glDrawElementsInstanced},
+    {"glDrawElementsInstancedARB", (GLBproc)glDrawElementsInstancedARB},
+    {"glDrawElementsInstancedBaseInstance", (GLBproc)glDrawElementsInstancedBaseInstance},
+    {"glDrawElementsInstancedBaseVertex", (GLBproc)glDrawElementsInstancedBaseVertex},
+    {"glDrawElementsInstancedBaseVertexBaseInstance", (GLBproc)glDrawElementsInstancedBaseVertexBaseInstance},
+    {"glDrawElementsInstancedEXT", (GLBproc)glDrawElementsInstancedEXT},
+    {"glDrawMeshArraysSUN", (GLBproc)glDrawMeshArraysSUN},
+    {"glDrawMeshTasksIndirectNV", (GLBproc)glDrawMeshTasksIndirectNV},
+    {"glDrawMeshTasksNV", (GLBproc)glDrawMeshTasksNV},
+    {"glDrawPixels", (GLBproc)glDrawPixels},
+    {"glDrawRangeElementArrayAPPLE", (GLBproc)glDrawRangeElementArrayAPPLE},
+    {"glDrawRangeElementArrayATI", (GLBproc)glDrawRangeElementArrayATI},
+    {"glDrawRangeElements", (GLBproc)glDrawRangeElements},
+    {"glDrawRangeElementsBaseVertex", (GLBproc)glDrawRangeElementsBaseVertex},
+    {"glDrawRangeElementsEXT", (GLBproc)glDrawRangeElementsEXT},
+    {"glDrawTextureNV", (GLBproc)glDrawTextureNV},
+    {"glDrawTransformFeedback", (GLBproc)glDrawTransformFeedback},
+    {"glDrawTransformFeedbackInstanced", (GLBproc)glDrawTransformFeedbackInstanced},
+    {"glDrawTransformFeedbackNV", (GLBproc)glDrawTransformFeedbackNV},
+    {"glDrawTransformFeedbackStream", (GLBproc)glDrawTransformFeedbackStream},
+    {"glDrawTransformFeedbackStreamInstanced", (GLBproc)glDrawTransformFeedbackStreamInstanced},
+    {"glDrawVkImageNV", (GLBproc)glDrawVkImageNV},
+    {"glEGLImageTargetTexStorageEXT", (GLBproc)glEGLImageTargetTexStorageEXT},
+    {"glEGLImageTargetTextureStorageEXT", (GLBproc)glEGLImageTargetTextureStorageEXT},
+    {"glEdgeFlag", (GLBproc)glEdgeFlag},
+    {"glEdgeFlagFormatNV", (GLBproc)glEdgeFlagFormatNV},
+    {"glEdgeFlagPointer", (GLBproc)glEdgeFlagPointer},
+    {"glEdgeFlagPointerEXT", (GLBproc)glEdgeFlagPointerEXT},
+    {"glEdgeFlagPointerListIBM", (GLBproc)glEdgeFlagPointerListIBM},
+    {"glEdgeFlagv", (GLBproc)glEdgeFlagv},
+    {"glElementPointerAPPLE", (GLBproc)glElementPointerAPPLE},
+    {"glElementPointerATI", (GLBproc)glElementPointerATI},
+    {"glEnable", (GLBproc)glEnable},
+    {"glEnableClientState", (GLBproc)glEnableClientState},
+    {"glEnableClientStateIndexedEXT", (GLBproc)glEnableClientStateIndexedEXT},
+    {"glEnableClientStateiEXT", (GLBproc)glEnableClientStateiEXT},
+    {"glEnableIndexedEXT", (GLBproc)glEnableIndexedEXT},
+    {"glEnableVariantClientStateEXT", (GLBproc)glEnableVariantClientStateEXT},
+    {"glEnableVertexArrayAttrib", (GLBproc)glEnableVertexArrayAttrib},
+    {"glEnableVertexArrayAttribEXT", (GLBproc)glEnableVertexArrayAttribEXT},
+    {"glEnableVertexArrayEXT", (GLBproc)glEnableVertexArrayEXT},
+    {"glEnableVertexAttribAPPLE", (GLBproc)glEnableVertexAttribAPPLE},
+    {"glEnableVertexAttribArray", (GLBproc)glEnableVertexAttribArray},
+    {"glEnableVertexAttribArrayARB", (GLBproc)glEnableVertexAttribArrayARB},
+    {"glEnablei", (GLBproc)glEnablei},
+    {"glEnd", (GLBproc)glEnd},
+    {"glEndConditionalRender", (GLBproc)glEndConditionalRender},
+    {"glEndConditionalRenderNV", (GLBproc)glEndConditionalRenderNV},
+    {"glEndConditionalRenderNVX", (GLBproc)glEndConditionalRenderNVX},
+    {"glEndFragmentShaderATI", (GLBproc)glEndFragmentShaderATI},
+    {"glEndList", (GLBproc)glEndList},
+    {"glEndOcclusionQueryNV", (GLBproc)glEndOcclusionQueryNV},
+    {"glEndPerfMonitorAMD", (GLBproc)glEndPerfMonitorAMD},
+    {"glEndPerfQueryINTEL", (GLBproc)glEndPerfQueryINTEL},
+    {"glEndQuery", (GLBproc)glEndQuery},
+    {"glEndQueryARB", (GLBproc)glEndQueryARB},
+    {"glEndQueryIndexed", (GLBproc)glEndQueryIndexed},
+    {"glEndTransformFeedback", (GLBproc)glEndTransformFeedback},
+    {"glEndTransformFeedbackEXT", (GLBproc)glEndTransformFeedbackEXT},
+    {"glEndTransformFeedbackNV", (GLBproc)glEndTransformFeedbackNV},
+    {"glEndVertexShaderEXT", (GLBproc)glEndVertexShaderEXT},
+    {"glEndVideoCaptureNV", (GLBproc)glEndVideoCaptureNV},
+    {"glEvalCoord1d", (GLBproc)glEvalCoord1d},
+    {"glEvalCoord1dv", (GLBproc)glEvalCoord1dv},
+    {"glEvalCoord1f", (GLBproc)glEvalCoord1f},
+    {"glEvalCoord1fv", (GLBproc)glEvalCoord1fv},
+    {"glEvalCoord1xOES", (GLBproc)glEvalCoord1xOES},
+    {"glEvalCoord1xvOES", (GLBproc)glEvalCoord1xvOES},
+    {"glEvalCoord2d", (GLBproc)glEvalCoord2d},
+    {"glEvalCoord2dv", (GLBproc)glEvalCoord2dv},
+    {"glEvalCoord2f", (GLBproc)glEvalCoord2f},
+    {"glEvalCoord2fv", (GLBproc)glEvalCoord2fv},
+    {"glEvalCoord2xOES", (GLBproc)glEvalCoord2xOES},
+    {"glEvalCoord2xvOES", (GLBproc)glEvalCoord2xvOES},
+    {"glEvalMapsNV", (GLBproc)glEvalMapsNV},
+    {"glEvalMesh1", (GLBproc)glEvalMesh1},
+    {"glEvalMesh2", (GLBproc)glEvalMesh2},
+    {"glEvalPoint1", (GLBproc)glEvalPoint1},
+    {"glEvalPoint2", (GLBproc)glEvalPoint2},
+    {"glEvaluateDepthValuesARB", (GLBproc)glEvaluateDepthValuesARB},
+    {"glExecuteProgramNV", (GLBproc)glExecuteProgramNV},
+    {"glExtractComponentEXT", (GLBproc)glExtractComponentEXT},
+    {"glFeedbackBuffer", (GLBproc)glFeedbackBuffer},
+    {"glFeedbackBufferxOES", (GLBproc)glFeedbackBufferxOES},
+    {"glFenceSync", (GLBproc)glFenceSync},
+    {"glFinalCombinerInputNV", (GLBproc)glFinalCombinerInputNV},
+    {"glFinish", (GLBproc)glFinish},
+    {"glFinishAsyncSGIX", (GLBproc)glFinishAsyncSGIX},
+    {"glFinishFenceAPPLE", (GLBproc)glFinishFenceAPPLE},
+    {"glFinishFenceNV", (GLBproc)glFinishFenceNV},
+    {"glFinishObjectAPPLE", (GLBproc)glFinishObjectAPPLE},
+    {"glFinishTextureSUNX", (GLBproc)glFinishTextureSUNX},
+    {"glFlush", (GLBproc)glFlush},
+    {"glFlushMappedBufferRange", (GLBproc)glFlushMappedBufferRange},
+    {"glFlushMappedBufferRangeAPPLE", (GLBproc)glFlushMappedBufferRangeAPPLE},
+    {"glFlushMappedNamedBufferRange", (GLBproc)glFlushMappedNamedBufferRange},
+    {"glFlushMappedNamedBufferRangeEXT", (GLBproc)glFlushMappedNamedBufferRangeEXT},
+    {"glFlushPixelDataRangeNV", (GLBproc)glFlushPixelDataRangeNV},
+    {"glFlushRasterSGIX", (GLBproc)glFlushRasterSGIX},
+    {"glFlushStaticDataIBM", (GLBproc)glFlushStaticDataIBM},
+    {"glFlushVertexArrayRangeAPPLE", (GLBproc)glFlushVertexArrayRangeAPPLE},
+    {"glFlushVertexArrayRangeNV", (GLBproc)glFlushVertexArrayRangeNV},
+    {"glFogCoordFormatNV", (GLBproc)glFogCoordFormatNV},
+    {"glFogCoordPointer", (GLBproc)glFogCoordPointer},
+    {"glFogCoordPointerEXT", (GLBproc)glFogCoordPointerEXT},
+    {"glFogCoordPointerListIBM", (GLBproc)glFogCoordPointerListIBM},
+    {"glFogCoordd", (GLBproc)glFogCoordd},
+    {"glFogCoorddEXT", (GLBproc)glFogCoorddEXT},
+    {"glFogCoorddv", (GLBproc)glFogCoorddv},
+    {"glFogCoorddvEXT", (GLBproc)glFogCoorddvEXT},
+    {"glFogCoordf", (GLBproc)glFogCoordf},
+    {"glFogCoordfEXT", (GLBproc)glFogCoordfEXT},
+    {"glFogCoordfv", (GLBproc)glFogCoordfv},
+    {"glFogCoordfvEXT", (GLBproc)glFogCoordfvEXT},
+    {"glFogCoordhNV", (GLBproc)glFogCoordhNV},
+    {"glFogCoordhvNV", (GLBproc)glFogCoordhvNV},
+    {"glFogFuncSGIS", (GLBproc)glFogFuncSGIS},
+    {"glFogf", (GLBproc)glFogf},
+    {"glFogfv", (GLBproc)glFogfv},
+    {"glFogi", (GLBproc)glFogi},
+    {"glFogiv", (GLBproc)glFogiv},
+    {"glFogxOES", (GLBproc)glFogxOES},
+    {"glFogxvOES", (GLBproc)glFogxvOES},
+    {"glFragmentColorMaterialSGIX", (GLBproc)glFragmentColorMaterialSGIX},
+    {"glFragmentCoverageColorNV", (GLBproc)glFragmentCoverageColorNV},
+    {"glFragmentLightModelfSGIX", (GLBproc)glFragmentLightModelfSGIX},
+    {"glFragmentLightModelfvSGIX", (GLBproc)glFragmentLightModelfvSGIX},
+    {"glFragmentLightModeliSGIX", (GLBproc)glFragmentLightModeliSGIX},
+    {"glFragmentLightModelivSGIX", (GLBproc)glFragmentLightModelivSGIX},
+    {"glFragmentLightfSGIX", (GLBproc)glFragmentLightfSGIX},
+    {"glFragmentLightfvSGIX", (GLBproc)glFragmentLightfvSGIX},
+    {"glFragmentLightiSGIX", (GLBproc)glFragmentLightiSGIX},
+    {"glFragmentLightivSGIX", (GLBproc)glFragmentLightivSGIX},
+    {"glFragmentMaterialfSGIX", (GLBproc)glFragmentMaterialfSGIX},
+    {"glFragmentMaterialfvSGIX", (GLBproc)glFragmentMaterialfvSGIX},
+    {"glFragmentMaterialiSGIX", (GLBproc)glFragmentMaterialiSGIX},
+    {"glFragmentMaterialivSGIX", (GLBproc)glFragmentMaterialivSGIX},
+    {"glFrameTerminatorGREMEDY", (GLBproc)glFrameTerminatorGREMEDY},
+    {"glFrameZoomSGIX", (GLBproc)glFrameZoomSGIX},
+    {"glFramebufferDrawBufferEXT", (GLBproc)glFramebufferDrawBufferEXT},
+    {"glFramebufferDrawBuffersEXT", (GLBproc)glFramebufferDrawBuffersEXT},
+    {"glFramebufferFetchBarrierEXT", (GLBproc)glFramebufferFetchBarrierEXT},
+    {"glFramebufferParameteri", (GLBproc)glFramebufferParameteri},
+    {"glFramebufferParameteriMESA", (GLBproc)glFramebufferParameteriMESA},
+    {"glFramebufferReadBufferEXT", (GLBproc)glFramebufferReadBufferEXT},
+    {"glFramebufferRenderbuffer", (GLBproc)glFramebufferRenderbuffer},
+    {"glFramebufferRenderbufferEXT", (GLBproc)glFramebufferRenderbufferEXT},
+    {"glFramebufferSampleLocationsfvARB", (GLBproc)glFramebufferSampleLocationsfvARB},
+    {"glFramebufferSampleLocationsfvNV", (GLBproc)glFramebufferSampleLocationsfvNV},
+    {"glFramebufferSamplePositionsfvAMD", (GLBproc)glFramebufferSamplePositionsfvAMD},
+    {"glFramebufferTexture", (GLBproc)glFramebufferTexture},
+    {"glFramebufferTexture1D", (GLBproc)glFramebufferTexture1D},
+    {"glFramebufferTexture1DEXT", (GLBproc)glFramebufferTexture1DEXT},
+    {"glFramebufferTexture2D", (GLBproc)glFramebufferTexture2D},
+    {"glFramebufferTexture2DEXT", (GLBproc)glFramebufferTexture2DEXT},
+    {"glFramebufferTexture3D", (GLBproc)glFramebufferTexture3D},
+    {"glFramebufferTexture3DEXT", (GLBproc)glFramebufferTexture3DEXT},
+    {"glFramebufferTextureARB", (GLBproc)glFramebufferTextureARB},
+    {"glFramebufferTextureEXT", (GLBproc)glFramebufferTextureEXT},
+    {"glFramebufferTextureFaceARB", (GLBproc)glFramebufferTextureFaceARB},
+    {"glFramebufferTextureFaceEXT", (GLBproc)glFramebufferTextureFaceEXT},
+    {"glFramebufferTextureLayer", (GLBproc)glFramebufferTextureLayer},
+    {"glFramebufferTextureLayerARB", (GLBproc)glFramebufferTextureLayerARB},
+    {"glFramebufferTextureLayerEXT", (GLBproc)glFramebufferTextureLayerEXT},
+    {"glFramebufferTextureMultiviewOVR", (GLBproc)glFramebufferTextureMultiviewOVR},
+    {"glFreeObjectBufferATI", (GLBproc)glFreeObjectBufferATI},
+    {"glFrontFace", (GLBproc)glFrontFace},
+    {"glFrustum", (GLBproc)glFrustum},
+    {"glFrustumfOES", (GLBproc)glFrustumfOES},
+    {"glFrustumxOES", (GLBproc)glFrustumxOES},
+    {"glGenAsyncMarkersSGIX", (GLBproc)glGenAsyncMarkersSGIX},
+    {"glGenBuffers", (GLBproc)glGenBuffers},
+    {"glGenBuffersARB", (GLBproc)glGenBuffersARB},
+    {"glGenFencesAPPLE", (GLBproc)glGenFencesAPPLE},
+    {"glGenFencesNV", (GLBproc)glGenFencesNV},
+    {"glGenFragmentShadersATI", (GLBproc)glGenFragmentShadersATI},
+    {"glGenFramebuffers", (GLBproc)glGenFramebuffers},
+    {"glGenFramebuffersEXT", (GLBproc)glGenFramebuffersEXT},
+    {"glGenLists", (GLBproc)glGenLists},
+    {"glGenNamesAMD", (GLBproc)glGenNamesAMD},
+    {"glGenOcclusionQueriesNV", (GLBproc)glGenOcclusionQueriesNV},
+    {"glGenPathsNV", (GLBproc)glGenPathsNV},
+    {"glGenPerfMonitorsAMD", (GLBproc)glGenPerfMonitorsAMD},
+    {"glGenProgramPipelines", (GLBproc)glGenProgramPipelines},
+    {"glGenProgramPipelinesEXT", (GLBproc)glGenProgramPipelinesEXT},
+    {"glGenProgramsARB", (GLBproc)glGenProgramsARB},
+    {"glGenProgramsNV", (GLBproc)glGenProgramsNV},
+    {"glGenQueries", (GLBproc)glGenQueries},
+    {"glGenQueriesARB", (GLBproc)glGenQueriesARB},
+    {"glGenQueryResourceTagNV", (GLBproc)glGenQueryResourceTagNV},
+    {"glGenRenderbuffers", (GLBproc)glGenRenderbuffers},
+    {"glGenRenderbuffersEXT", (GLBproc)glGenRenderbuffersEXT},
+    {"glGenSamplers", (GLBproc)glGenSamplers},
+    {"glGenSemaphoresEXT", (GLBproc)glGenSemaphoresEXT},
+    {"glGenSymbolsEXT", (GLBproc)glGenSymbolsEXT},
+    {"glGenTextures", (GLBproc)glGenTextures},
+    {"glGenTexturesEXT", (GLBproc)glGenTexturesEXT},
+    {"glGenTransformFeedbacks", (GLBproc)glGenTransformFeedbacks},
+    {"glGenTransformFeedbacksNV", (GLBproc)glGenTransformFeedbacksNV},
+    {"glGenVertexArrays", (GLBproc)glGenVertexArrays},
+    {"glGenVertexArraysAPPLE", (GLBproc)glGenVertexArraysAPPLE},
+    {"glGenVertexShadersEXT", (GLBproc)glGenVertexShadersEXT},
+    {"glGenerateMipmap", (GLBproc)glGenerateMipmap},
+    {"glGenerateMipmapEXT", (GLBproc)glGenerateMipmapEXT},
+    {"glGenerateMultiTexMipmapEXT", (GLBproc)glGenerateMultiTexMipmapEXT},
+    {"glGenerateTextureMipmap", (GLBproc)glGenerateTextureMipmap},
+    {"glGenerateTextureMipmapEXT", (GLBproc)glGenerateTextureMipmapEXT},
+    {"glGetActiveAtomicCounterBufferiv", (GLBproc)glGetActiveAtomicCounterBufferiv},
+    {"glGetActiveAttrib", (GLBproc)glGetActiveAttrib},
+    {"glGetActiveAttribARB", (GLBproc)glGetActiveAttribARB},
+    {"glGetActiveSubroutineName", (GLBproc)glGetActiveSubroutineName},
+    {"glGetActiveSubroutineUniformName", (GLBproc)glGetActiveSubroutineUniformName},
+    {"glGetActiveSubroutineUniformiv", (GLBproc)glGetActiveSubroutineUniformiv},
+    {"glGetActiveUniform", (GLBproc)glGetActiveUniform},
+    {"glGetActiveUniformARB", (GLBproc)glGetActiveUniformARB},
+    {"glGetActiveUniformBlockName", (GLBproc)glGetActiveUniformBlockName},
+    {"glGetActiveUniformBlockiv", (GLBproc)glGetActiveUniformBlockiv},
+    {"glGetActiveUniformName", (GLBproc)glGetActiveUniformName},
+    {"glGetActiveUniformsiv", (GLBproc)glGetActiveUniformsiv},
+    {"glGetActiveVaryingNV", (GLBproc)glGetActiveVaryingNV},
+    {"glGetArrayObjectfvATI", (GLBproc)glGetArrayObjectfvATI},
+    {"glGetArrayObjectivATI", (GLBproc)glGetArrayObjectivATI},
+    {"glGetAttachedObjectsARB", (GLBproc)glGetAttachedObjectsARB},
+    {"glGetAttachedShaders", (GLBproc)glGetAttachedShaders},
+    {"glGetAttribLocation", (GLBproc)glGetAttribLocation},
+    {"glGetAttribLocationARB", (GLBproc)glGetAttribLocationARB},
+    {"glGetBooleanIndexedvEXT", (GLBproc)glGetBooleanIndexedvEXT},
+    {"glGetBooleani_v", (GLBproc)glGetBooleani_v},
+    {"glGetBooleanv", (GLBproc)glGetBooleanv},
+    {"glGetBufferParameteri64v", (GLBproc)glGetBufferParameteri64v},
+    {"glGetBufferParameteriv", (GLBproc)glGetBufferParameteriv},
+    {"glGetBufferParameterivARB", (GLBproc)glGetBufferParameterivARB},
+    {"glGetBufferParameterui64vNV", (GLBproc)glGetBufferParameterui64vNV},
+    {"glGetBufferPointerv", (GLBproc)glGetBufferPointerv},
+    {"glGetBufferPointervARB", (GLBproc)glGetBufferPointervARB},
+    {"glGetBufferSubData", (GLBproc)glGetBufferSubData},
+    {"glGetBufferSubDataARB", (GLBproc)glGetBufferSubDataARB},
+    {"glGetClipPlane", (GLBproc)glGetClipPlane},
+    {"glGetClipPlanefOES", (GLBproc)glGetClipPlanefOES},
+    {"glGetClipPlanexOES", (GLBproc)glGetClipPlanexOES},
+    {"glGetColorTable", (GLBproc)glGetColorTable},
+    {"glGetColorTableEXT", (GLBproc)glGetColorTableEXT},
+    {"glGetColorTableParameterfv", (GLBproc)glGetColorTableParameterfv},
+    {"glGetColorTableParameterfvEXT", (GLBproc)glGetColorTableParameterfvEXT},
+    {"glGetColorTableParameterfvSGI", (GLBproc)glGetColorTableParameterfvSGI},
+    {"glGetColorTableParameteriv", (GLBproc)glGetColorTableParameteriv},
+    {"glGetColorTableParameterivEXT", (GLBproc)glGetColorTableParameterivEXT},
+    {"glGetColorTableParameterivSGI", (GLBproc)glGetColorTableParameterivSGI},
+    {"glGetColorTableSGI", (GLBproc)glGetColorTableSGI},
+    {"glGetCombinerInputParameterfvNV", (GLBproc)glGetCombinerInputParameterfvNV},
+    {"glGetCombinerInputParameterivNV", (GLBproc)glGetCombinerInputParameterivNV},
+    {"glGetCombinerOutputParameterfvNV", (GLBproc)glGetCombinerOutputParameterfvNV},
+    {"glGetCombinerOutputParameterivNV", (GLBproc)glGetCombinerOutputParameterivNV},
+    {"glGetCombinerStageParameterfvNV", (GLBproc)glGetCombinerStageParameterfvNV},
+    {"glGetCommandHeaderNV", (GLBproc)glGetCommandHeaderNV},
+    {"glGetCompressedMultiTexImageEXT", (GLBproc)glGetCompressedMultiTexImageEXT},
+    {"glGetCompressedTexImage", (GLBproc)glGetCompressedTexImage},
+    {"glGetCompressedTexImageARB", (GLBproc)glGetCompressedTexImageARB},
+    {"glGetCompressedTextureImage", (GLBproc)glGetCompressedTextureImage},
+    {"glGetCompressedTextureImageEXT", (GLBproc)glGetCompressedTextureImageEXT},
+    {"glGetCompressedTextureSubImage", (GLBproc)glGetCompressedTextureSubImage},
+    {"glGetConvolutionFilter", (GLBproc)glGetConvolutionFilter},
+    {"glGetConvolutionFilterEXT", (GLBproc)glGetConvolutionFilterEXT},
+    {"glGetConvolutionParameterfv", (GLBproc)glGetConvolutionParameterfv},
+    {"glGetConvolutionParameterfvEXT", (GLBproc)glGetConvolutionParameterfvEXT},
+    {"glGetConvolutionParameteriv", (GLBproc)glGetConvolutionParameteriv},
+    {"glGetConvolutionParameterivEXT", (GLBproc)glGetConvolutionParameterivEXT},
+    {"glGetConvolutionParameterxvOES", (GLBproc)glGetConvolutionParameterxvOES},
+    {"glGetCoverageModulationTableNV", (GLBproc)glGetCoverageModulationTableNV},
+    {"glGetDebugMessageLog", (GLBproc)glGetDebugMessageLog},
+    {"glGetDebugMessageLogAMD", (GLBproc)glGetDebugMessageLogAMD},
+    {"glGetDebugMessageLogARB", (GLBproc)glGetDebugMessageLogARB},
+    {"glGetDebugMessageLogKHR", (GLBproc)glGetDebugMessageLogKHR},
+    {"glGetDetailTexFuncSGIS", (GLBproc)glGetDetailTexFuncSGIS},
+    {"glGetDoubleIndexedvEXT", (GLBproc)glGetDoubleIndexedvEXT},
+    {"glGetDoublei_v", (GLBproc)glGetDoublei_v},
+    {"glGetDoublei_vEXT", (GLBproc)glGetDoublei_vEXT},
+    {"glGetDoublev", (GLBproc)glGetDoublev},
+    {"glGetError", (GLBproc)glGetError},
+    {"glGetFenceivNV", (GLBproc)glGetFenceivNV},
+    {"glGetFinalCombinerInputParameterfvNV", (GLBproc)glGetFinalCombinerInputParameterfvNV},
+    {"glGetFinalCombinerInputParameterivNV", (GLBproc)glGetFinalCombinerInputParameterivNV},
+    {"glGetFirstPerfQueryIdINTEL", (GLBproc)glGetFirstPerfQueryIdINTEL},
+    {"glGetFixedvOES", (GLBproc)glGetFixedvOES},
+    {"glGetFloatIndexedvEXT", (GLBproc)glGetFloatIndexedvEXT},
+    {"glGetFloati_v", (GLBproc)glGetFloati_v},
+    {"glGetFloati_vEXT", (GLBproc)glGetFloati_vEXT},
+    {"glGetFloatv", (GLBproc)glGetFloatv},
+    {"glGetFogFuncSGIS", (GLBproc)glGetFogFuncSGIS},
+    {"glGetFragDataIndex", (GLBproc)glGetFragDataIndex},
+    {"glGetFragDataLocation", (GLBproc)glGetFragDataLocation},
+    {"glGetFragDataLocationEXT", (GLBproc)glGetFragDataLocationEXT},
+    {"glGetFragmentLightfvSGIX", (GLBproc)glGetFragmentLightfvSGIX},
+    {"glGetFragmentLightivSGIX", (GLBproc)glGetFragmentLightivSGIX},
+    {"glGetFragmentMaterialfvSGIX", (GLBproc)glGetFragmentMaterialfvSGIX},
+    {"glGetFragmentMaterialivSGIX", (GLBproc)glGetFragmentMaterialivSGIX},
+    {"glGetFramebufferAttachmentParameteriv", (GLBproc)glGetFramebufferAttachmentParameteriv},
+    {"glGetFramebufferAttachmentParameterivEXT", (GLBproc)glGetFramebufferAttachmentParameterivEXT},
+    {"glGetFramebufferParameterfvAMD", (GLBproc)glGetFramebufferParameterfvAMD},
+    {"glGetFramebufferParameteriv", (GLBproc)glGetFramebufferParameteriv},
+    {"glGetFramebufferParameterivEXT", (GLBproc)glGetFramebufferParameterivEXT},
+    {"glGetFramebufferParameterivMESA", (GLBproc)glGetFramebufferParameterivMESA},
+    {"glGetGraphicsResetStatus", (GLBproc)glGetGraphicsResetStatus},
+    {"glGetGraphicsResetStatusARB", (GLBproc)glGetGraphicsResetStatusARB},
+    {"glGetGraphicsResetStatusKHR", (GLBproc)glGetGraphicsResetStatusKHR},
+    {"glGetHandleARB", (GLBproc)glGetHandleARB},
+    {"glGetHistogram", (GLBproc)glGetHistogram},
+    {"glGetHistogramEXT", (GLBproc)glGetHistogramEXT},
+    {"glGetHistogramParameterfv", (GLBproc)glGetHistogramParameterfv},
+    {"glGetHistogramParameterfvEXT", (GLBproc)glGetHistogramParameterfvEXT},
+    {"glGetHistogramParameteriv", (GLBproc)glGetHistogramParameteriv},
+    {"glGetHistogramParameterivEXT", (GLBproc)glGetHistogramParameterivEXT},
+    {"glGetHistogramParameterxvOES", (GLBproc)glGetHistogramParameterxvOES},
+    {"glGetImageHandleARB", (GLBproc)glGetImageHandleARB},
+    {"glGetImageHandleNV", (GLBproc)glGetImageHandleNV},
+    {"glGetImageTransformParameterfvHP", (GLBproc)glGetImageTransformParameterfvHP},
+    {"glGetImageTransformParameterivHP", (GLBproc)glGetImageTransformParameterivHP},
+    {"glGetInfoLogARB", (GLBproc)glGetInfoLogARB},
+    {"glGetInstrumentsSGIX", (GLBproc)glGetInstrumentsSGIX},
+    {"glGetInteger64i_v", (GLBproc)glGetInteger64i_v},
+    {"glGetInteger64v", (GLBproc)glGetInteger64v},
+    {"glGetIntegerIndexedvEXT", (GLBproc)glGetIntegerIndexedvEXT},
+    {"glGetIntegeri_v", (GLBproc)glGetIntegeri_v},
+    {"glGetIntegerui64i_vNV", (GLBproc)glGetIntegerui64i_vNV},
+    {"glGetIntegerui64vNV", (GLBproc)glGetIntegerui64vNV},
+    {"glGetIntegerv", (GLBproc)glGetIntegerv},
+    {"glGetInternalformatSampleivNV", (GLBproc)glGetInternalformatSampleivNV},
+    {"glGetInternalformati64v", (GLBproc)glGetInternalformati64v},
+    {"glGetInternalformativ", (GLBproc)glGetInternalformativ},
+    {"glGetInvariantBooleanvEXT", (GLBproc)glGetInvariantBooleanvEXT},
+    {"glGetInvariantFloatvEXT", (GLBproc)glGetInvariantFloatvEXT},
+    {"glGetInvariantIntegervEXT", (GLBproc)glGetInvariantIntegervEXT},
+    {"glGetLightfv", (GLBproc)glGetLightfv},
+    {"glGetLightiv", (GLBproc)glGetLightiv},
+    {"glGetLightxOES", (GLBproc)glGetLightxOES},
+    {"glGetLightxvOES", (GLBproc)glGetLightxvOES},
+    {"glGetListParameterfvSGIX", (GLBproc)glGetListParameterfvSGIX},
+    {"glGetListParameterivSGIX", (GLBproc)glGetListParameterivSGIX},
+    {"glGetLocalConstantBooleanvEXT", (GLBproc)glGetLocalConstantBooleanvEXT},
+    {"glGetLocalConstantFloatvEXT", (GLBproc)glGetLocalConstantFloatvEXT},
+    {"glGetLocalConstantIntegervEXT", (GLBproc)glGetLocalConstantIntegervEXT},
+    {"glGetMapAttribParameterfvNV", (GLBproc)glGetMapAttribParameterfvNV},
+    {"glGetMapAttribParameterivNV", (GLBproc)glGetMapAttribParameterivNV},
+    {"glGetMapControlPointsNV", (GLBproc)glGetMapControlPointsNV},
+    {"glGetMapParameterfvNV", (GLBproc)glGetMapParameterfvNV},
+    {"glGetMapParameterivNV", (GLBproc)glGetMapParameterivNV},
+    {"glGetMapdv", (GLBproc)glGetMapdv},
+    {"glGetMapfv", (GLBproc)glGetMapfv},
+    {"glGetMapiv", (GLBproc)glGetMapiv},
+    {"glGetMapxvOES", (GLBproc)glGetMapxvOES},
+    {"glGetMaterialfv", (GLBproc)glGetMaterialfv},
+    {"glGetMaterialiv", (GLBproc)glGetMaterialiv},
+    {"glGetMaterialxOES", (GLBproc)glGetMaterialxOES},
+    {"glGetMaterialxvOES", (GLBproc)glGetMaterialxvOES},
+    {"glGetMemoryObjectDetachedResourcesuivNV", (GLBproc)glGetMemoryObjectDetachedResourcesuivNV},
+    {"glGetMemoryObjectParameterivEXT", (GLBproc)glGetMemoryObjectParameterivEXT},
+    {"glGetMinmax", (GLBproc)glGetMinmax},
+    {"glGetMinmaxEXT", (GLBproc)glGetMinmaxEXT},
+    {"glGetMinmaxParameterfv", (GLBproc)glGetMinmaxParameterfv},
+    {"glGetMinmaxParameterfvEXT", (GLBproc)glGetMinmaxParameterfvEXT},
+    {"glGetMinmaxParameteriv", (GLBproc)glGetMinmaxParameteriv},
+    {"glGetMinmaxParameterivEXT", (GLBproc)glGetMinmaxParameterivEXT},
+    {"glGetMultiTexEnvfvEXT", (GLBproc)glGetMultiTexEnvfvEXT},
+    {"glGetMultiTexEnvivEXT", (GLBproc)glGetMultiTexEnvivEXT},
+    {"glGetMultiTexGendvEXT", (GLBproc)glGetMultiTexGendvEXT},
+    {"glGetMultiTexGenfvEXT", (GLBproc)glGetMultiTexGenfvEXT},
+    {"glGetMultiTexGenivEXT", (GLBproc)glGetMultiTexGenivEXT},
+    {"glGetMultiTexImageEXT", (GLBproc)glGetMultiTexImageEXT},
+    {"glGetMultiTexLevelParameterfvEXT", (GLBproc)glGetMultiTexLevelParameterfvEXT},
+    {"glGetMultiTexLevelParameterivEXT", (GLBproc)glGetMultiTexLevelParameterivEXT},
+    {"glGetMultiTexParameterIivEXT", (GLBproc)glGetMultiTexParameterIivEXT},
+    {"glGetMultiTexParameterIuivEXT", (GLBproc)glGetMultiTexParameterIuivEXT},
+    {"glGetMultiTexParameterfvEXT", (GLBproc)glGetMultiTexParameterfvEXT},
+    {"glGetMultiTexParameterivEXT", (GLBproc)glGetMultiTexParameterivEXT},
+    {"glGetMultisamplefv", (GLBproc)glGetMultisamplefv},
+    {"glGetMultisamplefvNV", (GLBproc)glGetMultisamplefvNV},
+    {"glGetNamedBufferParameteri64v", (GLBproc)glGetNamedBufferParameteri64v},
+    {"glGetNamedBufferParameteriv", (GLBproc)glGetNamedBufferParameteriv},
+    {"glGetNamedBufferParameterivEXT", (GLBproc)glGetNamedBufferParameterivEXT},
+    {"glGetNamedBufferParameterui64vNV", (GLBproc)glGetNamedBufferParameterui64vNV},
+    {"glGetNamedBufferPointerv", (GLBproc)glGetNamedBufferPointerv},
+    {"glGetNamedBufferPointervEXT", (GLBproc)glGetNamedBufferPointervEXT},
+    {"glGetNamedBufferSubData", (GLBproc)glGetNamedBufferSubData},
+    {"glGetNamedBufferSubDataEXT", (GLBproc)glGetNamedBufferSubDataEXT},
+    {"glGetNamedFramebufferAttachmentParameteriv", (GLBproc)glGetNamedFramebufferAttachmentParameteriv},
+    {"glGetNamedFramebufferAttachmentParameterivEXT", (GLBproc)glGetNamedFramebufferAttachmentParameterivEXT},
+    {"glGetNamedFramebufferParameterfvAMD", (GLBproc)glGetNamedFramebufferParameterfvAMD},
+    {"glGetNamedFramebufferParameteriv", (GLBproc)glGetNamedFramebufferParameteriv},
+    {"glGetNamedFramebufferParameterivEXT", (GLBproc)glGetNamedFramebufferParameterivEXT},
+    {"glGetNamedProgramLocalParameterIivEXT", (GLBproc)glGetNamedProgramLocalParameterIivEXT},
+    {"glGetNamedProgramLocalParameterIuivEXT", (GLBproc)glGetNamedProgramLocalParameterIuivEXT},
+    {"glGetNamedProgramLocalParameterdvEXT", (GLBproc)glGetNamedProgramLocalParameterdvEXT},
+    {"glGetNamedProgramLocalParameterfvEXT", (GLBproc)glGetNamedProgramLocalParameterfvEXT},
+    {"glGetNamedProgramStringEXT", (GLBproc)glGetNamedProgramStringEXT},
+    {"glGetNamedProgramivEXT", (GLBproc)glGetNamedProgramivEXT},
+    {"glGetNamedRenderbufferParameteriv", (GLBproc)glGetNamedRenderbufferParameteriv},
+    {"glGetNamedRenderbufferParameterivEXT", (GLBproc)glGetNamedRenderbufferParameterivEXT},
+    {"glGetNamedStringARB", (GLBproc)glGetNamedStringARB},
+    {"glGetNamedStringivARB", (GLBproc)glGetNamedStringivARB},
+    {"glGetNextPerfQueryIdINTEL", (GLBproc)glGetNextPerfQueryIdINTEL},
+    {"glGetObjectBufferfvATI", (GLBproc)glGetObjectBufferfvATI},
+    {"glGetObjectBufferivATI", (GLBproc)glGetObjectBufferivATI},
+    {"glGetObjectLabel", (GLBproc)glGetObjectLabel},
+    {"glGetObjectLabelEXT", (GLBproc)glGetObjectLabelEXT},
+    {"glGetObjectLabelKHR", (GLBproc)glGetObjectLabelKHR},
+    {"glGetObjectParameterfvARB", (GLBproc)glGetObjectParameterfvARB},
+    {"glGetObjectParameterivAPPLE", (GLBproc)glGetObjectParameterivAPPLE},
+    {"glGetObjectParameterivARB", (GLBproc)glGetObjectParameterivARB},
+    {"glGetObjectPtrLabel", (GLBproc)glGetObjectPtrLabel},
+    {"glGetObjectPtrLabelKHR", (GLBproc)glGetObjectPtrLabelKHR},
+    {"glGetOcclusionQueryivNV", (GLBproc)glGetOcclusionQueryivNV},
+    {"glGetOcclusionQueryuivNV", (GLBproc)glGetOcclusionQueryuivNV},
+    {"glGetPathColorGenfvNV", (GLBproc)glGetPathColorGenfvNV},
+    {"glGetPathColorGenivNV", (GLBproc)glGetPathColorGenivNV},
+    {"glGetPathCommandsNV", (GLBproc)glGetPathCommandsNV},
+    {"glGetPathCoordsNV", (GLBproc)glGetPathCoordsNV},
+    {"glGetPathDashArrayNV", (GLBproc)glGetPathDashArrayNV},
+    {"glGetPathLengthNV", (GLBproc)glGetPathLengthNV},
+    {"glGetPathMetricRangeNV", (GLBproc)glGetPathMetricRangeNV},
+    {"glGetPathMetricsNV", (GLBproc)glGetPathMetricsNV},
+    {"glGetPathParameterfvNV", (GLBproc)glGetPathParameterfvNV},
+    {"glGetPathParameterivNV", (GLBproc)glGetPathParameterivNV},
+    {"glGetPathSpacingNV", (GLBproc)glGetPathSpacingNV},
+    {"glGetPathTexGenfvNV", (GLBproc)glGetPathTexGenfvNV},
+    {"glGetPathTexGenivNV", (GLBproc)glGetPathTexGenivNV},
+    {"glGetPerfCounterInfoINTEL", (GLBproc)glGetPerfCounterInfoINTEL},
+    {"glGetPerfMonitorCounterDataAMD", (GLBproc)glGetPerfMonitorCounterDataAMD},
+    {"glGetPerfMonitorCounterInfoAMD", (GLBproc)glGetPerfMonitorCounterInfoAMD},
+    {"glGetPerfMonitorCounterStringAMD", (GLBproc)glGetPerfMonitorCounterStringAMD},
+    {"glGetPerfMonitorCountersAMD", (GLBproc)glGetPerfMonitorCountersAMD},
+    {"glGetPerfMonitorGroupStringAMD", (GLBproc)glGetPerfMonitorGroupStringAMD},
+    {"glGetPerfMonitorGroupsAMD", (GLBproc)glGetPerfMonitorGroupsAMD},
+    {"glGetPerfQueryDataINTEL", (GLBproc)glGetPerfQueryDataINTEL},
+    {"glGetPerfQueryIdByNameINTEL", (GLBproc)glGetPerfQueryIdByNameINTEL},
+    {"glGetPerfQueryInfoINTEL", (GLBproc)glGetPerfQueryInfoINTEL},
+    {"glGetPixelMapfv", (GLBproc)glGetPixelMapfv},
+    {"glGetPixelMapuiv", (GLBproc)glGetPixelMapuiv},
+    {"glGetPixelMapusv", (GLBproc)glGetPixelMapusv},
+    {"glGetPixelMapxv", (GLBproc)glGetPixelMapxv},
+    {"glGetPixelTexGenParameterfvSGIS", (GLBproc)glGetPixelTexGenParameterfvSGIS},
+    {"glGetPixelTexGenParameterivSGIS", (GLBproc)glGetPixelTexGenParameterivSGIS},
+    {"glGetPixelTransformParameterfvEXT", (GLBproc)glGetPixelTransformParameterfvEXT},
+    {"glGetPixelTransformParameterivEXT", (GLBproc)glGetPixelTransformParameterivEXT},
+    {"glGetPointerIndexedvEXT", (GLBproc)glGetPointerIndexedvEXT},
+    {"glGetPointeri_vEXT", (GLBproc)glGetPointeri_vEXT},
+    {"glGetPointerv", (GLBproc)glGetPointerv},
+    {"glGetPointervEXT", (GLBproc)glGetPointervEXT},
+    {"glGetPointervKHR", (GLBproc)glGetPointervKHR},
+    {"glGetPolygonStipple", (GLBproc)glGetPolygonStipple},
+    {"glGetProgramBinary", (GLBproc)glGetProgramBinary},
+    {"glGetProgramEnvParameterIivNV", (GLBproc)glGetProgramEnvParameterIivNV},
+    {"glGetProgramEnvParameterIuivNV", (GLBproc)glGetProgramEnvParameterIuivNV},
+    {"glGetProgramEnvParameterdvARB", (GLBproc)glGetProgramEnvParameterdvARB},
+    {"glGetProgramEnvParameterfvARB", (GLBproc)glGetProgramEnvParameterfvARB},
+    {"glGetProgramInfoLog", (GLBproc)glGetProgramInfoLog},
+    {"glGetProgramInterfaceiv", (GLBproc)glGetProgramInterfaceiv},
+    {"glGetProgramLocalParameterIivNV", (GLBproc)glGetProgramLocalParameterIivNV},
+    {"glGetProgramLocalParameterIuivNV", (GLBproc)glGetProgramLocalParameterIuivNV},
+    {"glGetProgramLocalParameterdvARB", (GLBproc)glGetProgramLocalParameterdvARB},
+    {"glGetProgramLocalParameterfvARB", (GLBproc)glGetProgramLocalParameterfvARB},
+    {"glGetProgramNamedParameterdvNV", (GLBproc)glGetProgramNamedParameterdvNV},
+    {"glGetProgramNamedParameterfvNV", (GLBproc)glGetProgramNamedParameterfvNV},
+    {"glGetProgramParameterdvNV", (GLBproc)glGetProgramParameterdvNV},
+    {"glGetProgramParameterfvNV", (GLBproc)glGetProgramParameterfvNV},
+    {"glGetProgramPipelineInfoLog", (GLBproc)glGetProgramPipelineInfoLog},
+    {"glGetProgramPipelineInfoLogEXT", (GLBproc)glGetProgramPipelineInfoLogEXT},
+    {"glGetProgramPipelineiv", (GLBproc)glGetProgramPipelineiv},
+    {"glGetProgramPipelineivEXT", (GLBproc)glGetProgramPipelineivEXT},
+    {"glGetProgramResourceIndex", (GLBproc)glGetProgramResourceIndex},
+    {"glGetProgramResourceLocation", (GLBproc)glGetProgramResourceLocation},
+    {"glGetProgramResourceLocationIndex", (GLBproc)glGetProgramResourceLocationIndex},
+    {"glGetProgramResourceName", (GLBproc)glGetProgramResourceName},
+    {"glGetProgramResourcefvNV", (GLBproc)glGetProgramResourcefvNV},
+    {"glGetProgramResourceiv", (GLBproc)glGetProgramResourceiv},
+    {"glGetProgramStageiv", (GLBproc)glGetProgramStageiv},
+    {"glGetProgramStringARB", (GLBproc)glGetProgramStringARB},
+    {"glGetProgramStringNV", (GLBproc)glGetProgramStringNV},
+    {"glGetProgramSubroutineParameteruivNV", (GLBproc)glGetProgramSubroutineParameteruivNV},
+    {"glGetProgramiv", (GLBproc)glGetProgramiv},
+    {"glGetProgramivARB", (GLBproc)glGetProgramivARB},
+    {"glGetProgramivNV", (GLBproc)glGetProgramivNV},
+    {"glGetQueryBufferObjecti64v", (GLBproc)glGetQueryBufferObjecti64v},
+    {"glGetQueryBufferObjectiv", (GLBproc)glGetQueryBufferObjectiv},
+    {"glGetQueryBufferObjectui64v", (GLBproc)glGetQueryBufferObjectui64v},
+    {"glGetQueryBufferObjectuiv", (GLBproc)glGetQueryBufferObjectuiv},
+    {"glGetQueryIndexediv", (GLBproc)glGetQueryIndexediv},
+    {"glGetQueryObjecti64v", (GLBproc)glGetQueryObjecti64v},
+    {"glGetQueryObjecti64vEXT", (GLBproc)glGetQueryObjecti64vEXT},
+    {"glGetQueryObjectiv", (GLBproc)glGetQueryObjectiv},
+    {"glGetQueryObjectivARB", (GLBproc)glGetQueryObjectivARB},
+    {"glGetQueryObjectui64v", (GLBproc)glGetQueryObjectui64v},
+    {"glGetQueryObjectui64vEXT", (GLBproc)glGetQueryObjectui64vEXT},
+    {"glGetQueryObjectuiv", (GLBproc)glGetQueryObjectuiv},
+    {"glGetQueryObjectuivARB", (GLBproc)glGetQueryObjectuivARB},
+    {"glGetQueryiv", (GLBproc)glGetQueryiv},
+    {"glGetQueryivARB", (GLBproc)glGetQueryivARB},
+    {"glGetRenderbufferParameteriv", (GLBproc)glGetRenderbufferParameteriv},
+    {"glGetRenderbufferParameterivEXT", (GLBproc)glGetRenderbufferParameterivEXT},
+    {"glGetSamplerParameterIiv", (GLBproc)glGetSamplerParameterIiv},
+    {"glGetSamplerParameterIuiv", (GLBproc)glGetSamplerParameterIuiv},
+    {"glGetSamplerParameterfv", (GLBproc)glGetSamplerParameterfv},
+    {"glGetSamplerParameteriv", (GLBproc)glGetSamplerParameteriv},
+    {"glGetSemaphoreParameterivNV", (GLBproc)glGetSemaphoreParameterivNV},
+    {"glGetSemaphoreParameterui64vEXT", (GLBproc)glGetSemaphoreParameterui64vEXT},
+    {"glGetSeparableFilter", (GLBproc)glGetSeparableFilter},
+    {"glGetSeparableFilterEXT", (GLBproc)glGetSeparableFilterEXT},
+    {"glGetShaderInfoLog", (GLBproc)glGetShaderInfoLog},
+    {"glGetShaderPrecisionFormat", (GLBproc)glGetShaderPrecisionFormat},
+    {"glGetShaderSource", (GLBproc)glGetShaderSource},
+    {"glGetShaderSourceARB", (GLBproc)glGetShaderSourceARB},
+    {"glGetShaderiv", (GLBproc)glGetShaderiv},
+    {"glGetShadingRateImagePaletteNV", (GLBproc)glGetShadingRateImagePaletteNV},
+    {"glGetShadingRateSampleLocationivNV", (GLBproc)glGetShadingRateSampleLocationivNV},
+    {"glGetSharpenTexFuncSGIS", (GLBproc)glGetSharpenTexFuncSGIS},
+    {"glGetStageIndexNV", (GLBproc)glGetStageIndexNV},
+    {"glGetString", (GLBproc)glGetString},
+    {"glGetStringi", (GLBproc)glGetStringi},
+    {"glGetSubroutineIndex", (GLBproc)glGetSubroutineIndex},
+    {"glGetSubroutineUniformLocation", (GLBproc)glGetSubroutineUniformLocation},
+    {"glGetSynciv", (GLBproc)glGetSynciv},
+    {"glGetTexBumpParameterfvATI", (GLBproc)glGetTexBumpParameterfvATI},
+    {"glGetTexBumpParameterivATI", (GLBproc)glGetTexBumpParameterivATI},
+    {"glGetTexEnvfv", (GLBproc)glGetTexEnvfv},
+    {"glGetTexEnviv", (GLBproc)glGetTexEnviv},
+    {"glGetTexEnvxvOES", (GLBproc)glGetTexEnvxvOES},
+    {"glGetTexFilterFuncSGIS", (GLBproc)glGetTexFilterFuncSGIS},
+    {"glGetTexGendv", (GLBproc)glGetTexGendv},
+    {"glGetTexGenfv", (GLBproc)glGetTexGenfv},
+    {"glGetTexGeniv", (GLBproc)glGetTexGeniv},
+    {"glGetTexGenxvOES", (GLBproc)glGetTexGenxvOES},
+    {"glGetTexImage", (GLBproc)glGetTexImage},
+    {"glGetTexLevelParameterfv", (GLBproc)glGetTexLevelParameterfv},
+    {"glGetTexLevelParameteriv", (GLBproc)glGetTexLevelParameteriv},
+    {"glGetTexLevelParameterxvOES", (GLBproc)glGetTexLevelParameterxvOES},
+    {"glGetTexParameterIiv", (GLBproc)glGetTexParameterIiv},
+    {"glGetTexParameterIivEXT", (GLBproc)glGetTexParameterIivEXT},
+    {"glGetTexParameterIuiv", (GLBproc)glGetTexParameterIuiv},
+    {"glGetTexParameterIuivEXT", (GLBproc)glGetTexParameterIuivEXT},
+    {"glGetTexParameterPointervAPPLE", (GLBproc)glGetTexParameterPointervAPPLE},
+    {"glGetTexParameterfv", (GLBproc)glGetTexParameterfv},
+    {"glGetTexParameteriv", (GLBproc)glGetTexParameteriv},
+    {"glGetTexParameterxvOES", (GLBproc)glGetTexParameterxvOES},
+    {"glGetTextureHandleARB", (GLBproc)glGetTextureHandleARB},
+    {"glGetTextureHandleNV", (GLBproc)glGetTextureHandleNV},
+    {"glGetTextureImage", (GLBproc)glGetTextureImage},
+    {"glGetTextureImageEXT", (GLBproc)glGetTextureImageEXT},
+    {"glGetTextureLevelParameterfv", (GLBproc)glGetTextureLevelParameterfv},
+    {"glGetTextureLevelParameterfvEXT", (GLBproc)glGetTextureLevelParameterfvEXT},
+    {"glGetTextureLevelParameteriv", (GLBproc)glGetTextureLevelParameteriv},
+    {"glGetTextureLevelParameterivEXT", (GLBproc)glGetTextureLevelParameterivEXT},
+    {"glGetTextureParameterIiv", (GLBproc)glGetTextureParameterIiv},
+    {"glGetTextureParameterIivEXT", (GLBproc)glGetTextureParameterIivEXT},
+    {"glGetTextureParameterIuiv", (GLBproc)glGetTextureParameterIuiv},
+    {"glGetTextureParameterIuivEXT", (GLBproc)glGetTextureParameterIuivEXT},
+    {"glGetTextureParameterfv", (GLBproc)glGetTextureParameterfv},
+    {"glGetTextureParameterfvEXT", (GLBproc)glGetTextureParameterfvEXT},
+    {"glGetTextureParameteriv", (GLBproc)glGetTextureParameteriv},
+    {"glGetTextureParameterivEXT", (GLBproc)glGetTextureParameterivEXT},
+    {"glGetTextureSamplerHandleARB", (GLBproc)glGetTextureSamplerHandleARB},
+    {"glGetTextureSamplerHandleNV", (GLBproc)glGetTextureSamplerHandleNV},
+    {"glGetTextureSubImage", (GLBproc)glGetTextureSubImage},
+    {"glGetTrackMatrixivNV", (GLBproc)glGetTrackMatrixivNV},
+    {"glGetTransformFeedbackVarying", (GLBproc)glGetTransformFeedbackVarying},
+    {"glGetTransformFeedbackVaryingEXT", (GLBproc)glGetTransformFeedbackVaryingEXT},
+    {"glGetTransformFeedbackVaryingNV", (GLBproc)glGetTransformFeedbackVaryingNV},
+    {"glGetTransformFeedbacki64_v", (GLBproc)glGetTransformFeedbacki64_v},
+    {"glGetTransformFeedbacki_v", (GLBproc)glGetTransformFeedbacki_v},
+    {"glGetTransformFeedbackiv", (GLBproc)glGetTransformFeedbackiv},
+    {"glGetUniformBlockIndex", (GLBproc)glGetUniformBlockIndex},
+    {"glGetUniformBufferSizeEXT", (GLBproc)glGetUniformBufferSizeEXT},
+    {"glGetUniformIndices", (GLBproc)glGetUniformIndices},
+    {"glGetUniformLocation", (GLBproc)glGetUniformLocation},
+    {"glGetUniformLocationARB", (GLBproc)glGetUniformLocationARB},
+    {"glGetUniformOffsetEXT", (GLBproc)glGetUniformOffsetEXT},
+    {"glGetUniformSubroutineuiv", (GLBproc)glGetUniformSubroutineuiv},
+    {"glGetUniformdv", (GLBproc)glGetUniformdv},
+    {"glGetUniformfv", (GLBproc)glGetUniformfv},
+    {"glGetUniformfvARB", (GLBproc)glGetUniformfvARB},
+    {"glGetUniformi64vARB", (GLBproc)glGetUniformi64vARB},
+    {"glGetUniformi64vNV", (GLBproc)glGetUniformi64vNV},
+    {"glGetUniformiv", (GLBproc)glGetUniformiv},
+    {"glGetUniformivARB", (GLBproc)glGetUniformivARB},
+    {"glGetUniformui64vARB", (GLBproc)glGetUniformui64vARB},
+    {"glGetUniformui64vNV", (GLBproc)glGetUniformui64vNV},
+    {"glGetUniformuiv", (GLBproc)glGetUniformuiv},
+    {"glGetUniformuivEXT", (GLBproc)glGetUniformuivEXT},
+    {"glGetUnsignedBytei_vEXT", (GLBproc)glGetUnsignedBytei_vEXT},
+    {"glGetUnsignedBytevEXT", (GLBproc)glGetUnsignedBytevEXT},
+    {"glGetVariantArrayObjectfvATI", (GLBproc)glGetVariantArrayObjectfvATI},
+    {"glGetVariantArrayObjectivATI", (GLBproc)glGetVariantArrayObjectivATI},
+    {"glGetVariantBooleanvEXT", (GLBproc)glGetVariantBooleanvEXT},
+    {"glGetVariantFloatvEXT", (GLBproc)glGetVariantFloatvEXT},
+    {"glGetVariantIntegervEXT", (GLBproc)glGetVariantIntegervEXT},
+    {"glGetVariantPointervEXT", (GLBproc)glGetVariantPointervEXT},
+    {"glGetVaryingLocationNV", (GLBproc)glGetVaryingLocationNV},
+    {"glGetVertexArrayIndexed64iv", (GLBproc)glGetVertexArrayIndexed64iv},
+    {"glGetVertexArrayIndexediv", (GLBproc)glGetVertexArrayIndexediv},
+    {"glGetVertexArrayIntegeri_vEXT", (GLBproc)glGetVertexArrayIntegeri_vEXT},
+    {"glGetVertexArrayIntegervEXT", (GLBproc)glGetVertexArrayIntegervEXT},
+    {"glGetVertexArrayPointeri_vEXT", (GLBproc)glGetVertexArrayPointeri_vEXT},
+    {"glGetVertexArrayPointervEXT", (GLBproc)glGetVertexArrayPointervEXT},
+    {"glGetVertexArrayiv", (GLBproc)glGetVertexArrayiv},
+    {"glGetVertexAttribArrayObjectfvATI", (GLBproc)glGetVertexAttribArrayObjectfvATI},
+    {"glGetVertexAttribArrayObjectivATI", (GLBproc)glGetVertexAttribArrayObjectivATI},
+    {"glGetVertexAttribIiv", (GLBproc)glGetVertexAttribIiv},
+    {"glGetVertexAttribIivEXT", (GLBproc)glGetVertexAttribIivEXT},
+    {"glGetVertexAttribIuiv", (GLBproc)glGetVertexAttribIuiv},
+    {"glGetVertexAttribIuivEXT", (GLBproc)glGetVertexAttribIuivEXT},
+    {"glGetVertexAttribLdv", (GLBproc)glGetVertexAttribLdv},
+    {"glGetVertexAttribLdvEXT", (GLBproc)glGetVertexAttribLdvEXT},
+    {"glGetVertexAttribLi64vNV", (GLBproc)glGetVertexAttribLi64vNV},
+    {"glGetVertexAttribLui64vARB", (GLBproc)glGetVertexAttribLui64vARB},
+    {"glGetVertexAttribLui64vNV", (GLBproc)glGetVertexAttribLui64vNV},
+    {"glGetVertexAttribPointerv", (GLBproc)glGetVertexAttribPointerv},
+    {"glGetVertexAttribPointervARB", (GLBproc)glGetVertexAttribPointervARB},
+    {"glGetVertexAttribPointervNV", (GLBproc)glGetVertexAttribPointervNV},
+    {"glGetVertexAttribdv", (GLBproc)glGetVertexAttribdv},
+    {"glGetVertexAttribdvARB", (GLBproc)glGetVertexAttribdvARB},
+    {"glGetVertexAttribdvNV", (GLBproc)glGetVertexAttribdvNV},
+    {"glGetVertexAttribfv", (GLBproc)glGetVertexAttribfv},
+    {"glGetVertexAttribfvARB", (GLBproc)glGetVertexAttribfvARB},
+    {"glGetVertexAttribfvNV", (GLBproc)glGetVertexAttribfvNV},
+    {"glGetVertexAttribiv", (GLBproc)glGetVertexAttribiv},
+    {"glGetVertexAttribivARB", (GLBproc)glGetVertexAttribivARB},
+    {"glGetVertexAttribivNV", (GLBproc)glGetVertexAttribivNV},
+    {"glGetVideoCaptureStreamdvNV", (GLBproc)glGetVideoCaptureStreamdvNV},
+    {"glGetVideoCaptureStreamfvNV", (GLBproc)glGetVideoCaptureStreamfvNV},
+    {"glGetVideoCaptureStreamivNV", (GLBproc)glGetVideoCaptureStreamivNV},
+    {"glGetVideoCaptureivNV", (GLBproc)glGetVideoCaptureivNV},
+    {"glGetVideoi64vNV", (GLBproc)glGetVideoi64vNV},
+    {"glGetVideoivNV", (GLBproc)glGetVideoivNV},
+    {"glGetVideoui64vNV", (GLBproc)glGetVideoui64vNV},
+    {"glGetVideouivNV", (GLBproc)glGetVideouivNV},
+    {"glGetVkProcAddrNV", (GLBproc)glGetVkProcAddrNV},
+    {"glGetnColorTable", (GLBproc)glGetnColorTable},
+    {"glGetnColorTableARB", (GLBproc)glGetnColorTableARB},
+    {"glGetnCompressedTexImage", (GLBproc)glGetnCompressedTexImage},
+    {"glGetnCompressedTexImageARB", (GLBproc)glGetnCompressedTexImageARB},
+    {"glGetnConvolutionFilter", (GLBproc)glGetnConvolutionFilter},
+    {"glGetnConvolutionFilterARB", (GLBproc)glGetnConvolutionFilterARB},
+    {"glGetnHistogram", (GLBproc)glGetnHistogram},
+    {"glGetnHistogramARB", (GLBproc)glGetnHistogramARB},
+    {"glGetnMapdv", (GLBproc)glGetnMapdv},
+    {"glGetnMapdvARB", (GLBproc)glGetnMapdvARB},
+    {"glGetnMapfv", (GLBproc)glGetnMapfv},
+    {"glGetnMapfvARB", (GLBproc)glGetnMapfvARB},
+    {"glGetnMapiv", (GLBproc)glGetnMapiv},
+    {"glGetnMapivARB", (GLBproc)glGetnMapivARB},
+    {"glGetnMinmax", (GLBproc)glGetnMinmax},
+    {"glGetnMinmaxARB", (GLBproc)glGetnMinmaxARB},
+    {"glGetnPixelMapfv", (GLBproc)glGetnPixelMapfv},
+    {"glGetnPixelMapfvARB", (GLBproc)glGetnPixelMapfvARB},
+    {"glGetnPixelMapuiv", (GLBproc)glGetnPixelMapuiv},
+    {"glGetnPixelMapuivARB", (GLBproc)glGetnPixelMapuivARB},
+    {"glGetnPixelMapusv", (GLBproc)glGetnPixelMapusv},
+    {"glGetnPixelMapusvARB", (GLBproc)glGetnPixelMapusvARB},
+    {"glGetnPolygonStipple", (GLBproc)glGetnPolygonStipple},
+    {"glGetnPolygonStippleARB", (GLBproc)glGetnPolygonStippleARB},
+    {"glGetnSeparableFilter", (GLBproc)glGetnSeparableFilter},
+    {"glGetnSeparableFilterARB", (GLBproc)glGetnSeparableFilterARB},
+    {"glGetnTexImage", (GLBproc)glGetnTexImage},
+    {"glGetnTexImageARB", (GLBproc)glGetnTexImageARB},
+    {"glGetnUniformdv", (GLBproc)glGetnUniformdv},
+    {"glGetnUniformdvARB", (GLBproc)glGetnUniformdvARB},
+    {"glGetnUniformfv", (GLBproc)glGetnUniformfv},
+    {"glGetnUniformfvARB", (GLBproc)glGetnUniformfvARB},
+    {"glGetnUniformfvKHR", (GLBproc)glGetnUniformfvKHR},
+    {"glGetnUniformi64vARB", (GLBproc)glGetnUniformi64vARB},
+    {"glGetnUniformiv", (GLBproc)glGetnUniformiv},
+    {"glGetnUniformivARB", (GLBproc)glGetnUniformivARB},
+    {"glGetnUniformivKHR", (GLBproc)glGetnUniformivKHR},
+    {"glGetnUniformui64vARB", (GLBproc)glGetnUniformui64vARB},
+    {"glGetnUniformuiv", (GLBproc)glGetnUniformuiv},
+    {"glGetnUniformuivARB", (GLBproc)glGetnUniformuivARB},
+    {"glGetnUniformuivKHR", (GLBproc)glGetnUniformuivKHR},
+    {"glGlobalAlphaFactorbSUN", (GLBproc)glGlobalAlphaFactorbSUN},
+    {"glGlobalAlphaFactordSUN", (GLBproc)glGlobalAlphaFactordSUN},
+    {"glGlobalAlphaFactorfSUN", (GLBproc)glGlobalAlphaFactorfSUN},
+    {"glGlobalAlphaFactoriSUN", (GLBproc)glGlobalAlphaFactoriSUN},
+    {"glGlobalAlphaFactorsSUN", (GLBproc)glGlobalAlphaFactorsSUN},
+    {"glGlobalAlphaFactorubSUN", (GLBproc)glGlobalAlphaFactorubSUN},
+    {"glGlobalAlphaFactoruiSUN", (GLBproc)glGlobalAlphaFactoruiSUN},
+    {"glGlobalAlphaFactorusSUN", (GLBproc)glGlobalAlphaFactorusSUN},
+    {"glHint", (GLBproc)glHint},
+    {"glHintPGI", (GLBproc)glHintPGI},
+    {"glHistogram", (GLBproc)glHistogram},
+    {"glHistogramEXT", (GLBproc)glHistogramEXT},
+    {"glIglooInterfaceSGIX", (GLBproc)glIglooInterfaceSGIX},
+    {"glImageTransformParameterfHP", (GLBproc)glImageTransformParameterfHP},
+    {"glImageTransformParameterfvHP", (GLBproc)glImageTransformParameterfvHP},
+    {"glImageTransformParameteriHP", (GLBproc)glImageTransformParameteriHP},
+    {"glImageTransformParameterivHP", (GLBproc)glImageTransformParameterivHP},
+    {"glImportMemoryFdEXT", (GLBproc)glImportMemoryFdEXT},
+    {"glImportMemoryWin32HandleEXT", (GLBproc)glImportMemoryWin32HandleEXT},
+    {"glImportMemoryWin32NameEXT", (GLBproc)glImportMemoryWin32NameEXT},
+    {"glImportSemaphoreFdEXT", (GLBproc)glImportSemaphoreFdEXT},
+    {"glImportSemaphoreWin32HandleEXT", (GLBproc)glImportSemaphoreWin32HandleEXT},
+    {"glImportSemaphoreWin32NameEXT", (GLBproc)glImportSemaphoreWin32NameEXT},
+    {"glImportSyncEXT", (GLBproc)glImportSyncEXT},
+    {"glIndexFormatNV", (GLBproc)glIndexFormatNV},
+    {"glIndexFuncEXT", (GLBproc)glIndexFuncEXT},
+    {"glIndexMask", (GLBproc)glIndexMask},
+    {"glIndexMaterialEXT", (GLBproc)glIndexMaterialEXT},
+    {"glIndexPointer", (GLBproc)glIndexPointer},
+    {"glIndexPointerEXT", (GLBproc)glIndexPointerEXT},
+    {"glIndexPointerListIBM", (GLBproc)glIndexPointerListIBM},
+    {"glIndexd", (GLBproc)glIndexd},
+    {"glIndexdv", (GLBproc)glIndexdv},
+    {"glIndexf", (GLBproc)glIndexf},
+    {"glIndexfv", (GLBproc)glIndexfv},
+    {"glIndexi", (GLBproc)glIndexi},
+    {"glIndexiv", (GLBproc)glIndexiv},
+    {"glIndexs", (GLBproc)glIndexs},
+    {"glIndexsv", (GLBproc)glIndexsv},
+    {"glIndexub", (GLBproc)glIndexub},
+    {"glIndexubv", (GLBproc)glIndexubv},
+    {"glIndexxOES", (GLBproc)glIndexxOES},
+    {"glIndexxvOES", (GLBproc)glIndexxvOES},
+    {"glInitNames", (GLBproc)glInitNames},
+    {"glInsertComponentEXT", (GLBproc)glInsertComponentEXT},
+    {"glInsertEventMarkerEXT", (GLBproc)glInsertEventMarkerEXT},
+    {"glInstrumentsBufferSGIX", (GLBproc)glInstrumentsBufferSGIX},
+    {"glInterleavedArrays", (GLBproc)glInterleavedArrays},
+    {"glInterpolatePathsNV", (GLBproc)glInterpolatePathsNV},
+    {"glInvalidateBufferData", (GLBproc)glInvalidateBufferData},
+    {"glInvalidateBufferSubData", (GLBproc)glInvalidateBufferSubData},
+    {"glInvalidateFramebuffer", (GLBproc)glInvalidateFramebuffer},
+    {"glInvalidateNamedFramebufferData", (GLBproc)glInvalidateNamedFramebufferData},
+    {"glInvalidateNamedFramebufferSubData", (GLBproc)glInvalidateNamedFramebufferSubData},
+    {"glInvalidateSubFramebuffer", (GLBproc)glInvalidateSubFramebuffer},
+    {"glInvalidateTexImage", (GLBproc)glInvalidateTexImage},
+    {"glInvalidateTexSubImage", (GLBproc)glInvalidateTexSubImage},
+    {"glIsAsyncMarkerSGIX", (GLBproc)glIsAsyncMarkerSGIX},
+    {"glIsBuffer", (GLBproc)glIsBuffer},
+    {"glIsBufferARB", (GLBproc)glIsBufferARB},
+    {"glIsBufferResidentNV", (GLBproc)glIsBufferResidentNV},
+    {"glIsCommandListNV", (GLBproc)glIsCommandListNV},
+    {"glIsEnabled", (GLBproc)glIsEnabled},
+    {"glIsEnabledIndexedEXT", (GLBproc)glIsEnabledIndexedEXT},
+    {"glIsEnabledi", (GLBproc)glIsEnabledi},
+    {"glIsFenceAPPLE", (GLBproc)glIsFenceAPPLE},
+    {"glIsFenceNV", (GLBproc)glIsFenceNV},
+    {"glIsFramebuffer", (GLBproc)glIsFramebuffer},
+    {"glIsFramebufferEXT", (GLBproc)glIsFramebufferEXT},
+    {"glIsImageHandleResidentARB", (GLBproc)glIsImageHandleResidentARB},
+    {"glIsImageHandleResidentNV", (GLBproc)glIsImageHandleResidentNV},
+    {"glIsList", (GLBproc)glIsList},
+    {"glIsMemoryObjectEXT", (GLBproc)glIsMemoryObjectEXT},
+    {"glIsNameAMD", (GLBproc)glIsNameAMD},
+    {"glIsNamedBufferResidentNV", (GLBproc)glIsNamedBufferResidentNV},
+    {"glIsNamedStringARB", (GLBproc)glIsNamedStringARB},
+    {"glIsObjectBufferATI", (GLBproc)glIsObjectBufferATI},
+    {"glIsOcclusionQueryNV", (GLBproc)glIsOcclusionQueryNV},
+    {"glIsPathNV", (GLBproc)glIsPathNV},
+    {"glIsPointInFillPathNV", (GLBproc)glIsPointInFillPathNV},
+    {"glIsPointInStrokePathNV", (GLBproc)glIsPointInStrokePathNV},
+    {"glIsProgram", (GLBproc)glIsProgram},
+    {"glIsProgramARB", (GLBproc)glIsProgramARB},
+    {"glIsProgramNV", (GLBproc)glIsProgramNV},
+    {"glIsProgramPipeline", (GLBproc)glIsProgramPipeline},
+    {"glIsProgramPipelineEXT", (GLBproc)glIsProgramPipelineEXT},
+    {"glIsQuery", (GLBproc)glIsQuery},
+    {"glIsQueryARB", (GLBproc)glIsQueryARB},
+    {"glIsRenderbuffer", (GLBproc)glIsRenderbuffer},
+    {"glIsRenderbufferEXT", (GLBproc)glIsRenderbufferEXT},
+    {"glIsSampler", (GLBproc)glIsSampler},
+    {"glIsSemaphoreEXT", (GLBproc)glIsSemaphoreEXT},
+    {"glIsShader", (GLBproc)glIsShader},
+    {"glIsStateNV", (GLBproc)glIsStateNV},
+    {"glIsSync", (GLBproc)glIsSync},
+    {"glIsTexture", (GLBproc)glIsTexture},
+    {"glIsTextureEXT", (GLBproc)glIsTextureEXT},
+    {"glIsTextureHandleResidentARB", (GLBproc)glIsTextureHandleResidentARB},
+    {"glIsTextureHandleResidentNV", (GLBproc)glIsTextureHandleResidentNV},
+    {"glIsTransformFeedback", (GLBproc)glIsTransformFeedback},
+    {"glIsTransformFeedbackNV", (GLBproc)glIsTransformFeedbackNV},
+    {"glIsVariantEnabledEXT", (GLBproc)glIsVariantEnabledEXT},
+    {"glIsVertexArray", (GLBproc)glIsVertexArray},
+    {"glIsVertexArrayAPPLE", (GLBproc)glIsVertexArrayAPPLE},
+    {"glIsVertexAttribEnabledAPPLE", (GLBproc)glIsVertexAttribEnabledAPPLE},
+    {"glLGPUCopyImageSubDataNVX", (GLBproc)glLGPUCopyImageSubDataNVX},
+    {"glLGPUInterlockNVX", (GLBproc)glLGPUInterlockNVX},
+    {"glLGPUNamedBufferSubDataNVX", (GLBproc)glLGPUNamedBufferSubDataNVX},
+    {"glLabelObjectEXT", (GLBproc)glLabelObjectEXT},
+    {"glLightEnviSGIX", (GLBproc)glLightEnviSGIX},
+    {"glLightModelf", (GLBproc)glLightModelf},
+    {"glLightModelfv", (GLBproc)glLightModelfv},
+    {"glLightModeli", (GLBproc)glLightModeli},
+    {"glLightModeliv", (GLBproc)glLightModeliv},
+    {"glLightModelxOES", (GLBproc)glLightModelxOES},
+    {"glLightModelxvOES", (GLBproc)glLightModelxvOES},
+    {"glLightf", (GLBproc)glLightf},
+    {"glLightfv", (GLBproc)glLightfv},
+    {"glLighti", (GLBproc)glLighti},
+    {"glLightiv", (GLBproc)glLightiv},
+    {"glLightxOES", (GLBproc)glLightxOES},
+    {"glLightxvOES", (GLBproc)glLightxvOES},
+    {"glLineStipple", (GLBproc)glLineStipple},
+    {"glLineWidth", (GLBproc)glLineWidth},
+    {"glLineWidthxOES", (GLBproc)glLineWidthxOES},
+    {"glLinkProgram", (GLBproc)glLinkProgram},
+    {"glLinkProgramARB", (GLBproc)glLinkProgramARB},
+    {"glListBase", (GLBproc)glListBase},
+    {"glListDrawCommandsStatesClientNV", (GLBproc)glListDrawCommandsStatesClientNV},
+    {"glListParameterfSGIX", (GLBproc)glListParameterfSGIX},
+    {"glListParameterfvSGIX", (GLBproc)glListParameterfvSGIX},
+    {"glListParameteriSGIX", (GLBproc)glListParameteriSGIX},
+    {"glListParameterivSGIX", (GLBproc)glListParameterivSGIX},
+    {"glLoadIdentity", (GLBproc)glLoadIdentity},
+    {"glLoadIdentityDeformationMapSGIX", (GLBproc)glLoadIdentityDeformationMapSGIX},
+    {"glLoadMatrixd", (GLBproc)glLoadMatrixd},
+    {"glLoadMatrixf", (GLBproc)glLoadMatrixf},
+    {"glLoadMatrixxOES", (GLBproc)glLoadMatrixxOES},
+    {"glLoadName", (GLBproc)glLoadName},
+    {"glLoadProgramNV", (GLBproc)glLoadProgramNV},
+    {"glLoadTransposeMatrixd", (GLBproc)glLoadTransposeMatrixd},
+    {"glLoadTransposeMatrixdARB", (GLBproc)glLoadTransposeMatrixdARB},
+    {"glLoadTransposeMatrixf", (GLBproc)glLoadTransposeMatrixf},
+    {"glLoadTransposeMatrixfARB", (GLBproc)glLoadTransposeMatrixfARB},
+    {"glLoadTransposeMatrixxOES", (GLBproc)glLoadTransposeMatrixxOES},
+    {"glLockArraysEXT", (GLBproc)glLockArraysEXT},
+    {"glLogicOp", (GLBproc)glLogicOp},
+    {"glMakeBufferNonResidentNV", (GLBproc)glMakeBufferNonResidentNV},
+    {"glMakeBufferResidentNV", (GLBproc)glMakeBufferResidentNV},
+    {"glMakeImageHandleNonResidentARB", (GLBproc)glMakeImageHandleNonResidentARB},
+    {"glMakeImageHandleNonResidentNV", (GLBproc)glMakeImageHandleNonResidentNV},
+    {"glMakeImageHandleResidentARB", (GLBproc)glMakeImageHandleResidentARB},
+    {"glMakeImageHandleResidentNV", (GLBproc)glMakeImageHandleResidentNV},
+    {"glMakeNamedBufferNonResidentNV", (GLBproc)glMakeNamedBufferNonResidentNV},
+    {"glMakeNamedBufferResidentNV", (GLBproc)glMakeNamedBufferResidentNV},
+    {"glMakeTextureHandleNonResidentARB", (GLBproc)glMakeTextureHandleNonResidentARB},
+    {"glMakeTextureHandleNonResidentNV", (GLBproc)glMakeTextureHandleNonResidentNV},
+    {"glMakeTextureHandleResidentARB", (GLBproc)glMakeTextureHandleResidentARB},
+    {"glMakeTextureHandleResidentNV", (GLBproc)glMakeTextureHandleResidentNV},
+    {"glMap1d", (GLBproc)glMap1d},
+    {"glMap1f", (GLBproc)glMap1f},
+    {"glMap1xOES", (GLBproc)glMap1xOES},
+    {"glMap2d", (GLBproc)glMap2d},
+    {"glMap2f", (GLBproc)glMap2f},
+    {"glMap2xOES", (GLBproc)glMap2xOES},
+    {"glMapBuffer", (GLBproc)glMapBuffer},
+    {"glMapBufferARB", (GLBproc)glMapBufferARB},
+    {"glMapBufferRange", (GLBproc)glMapBufferRange},
+    {"glMapControlPointsNV", (GLBproc)glMapControlPointsNV},
+    {"glMapGrid1d", (GLBproc)glMapGrid1d},
+    {"glMapGrid1f", (GLBproc)glMapGrid1f},
+    {"glMapGrid1xOES", (GLBproc)glMapGrid1xOES},
+    {"glMapGrid2d", (GLBproc)glMapGrid2d},
+    {"glMapGrid2f", (GLBproc)glMapGrid2f},
+    {"glMapGrid2xOES", (GLBproc)glMapGrid2xOES},
+    {"glMapNamedBuffer", (GLBproc)glMapNamedBuffer},
+    {"glMapNamedBufferEXT", (GLBproc)glMapNamedBufferEXT},
+    {"glMapNamedBufferRange", (GLBproc)glMapNamedBufferRange},
+    {"glMapNamedBufferRangeEXT", (GLBproc)glMapNamedBufferRangeEXT},
+    {"glMapObjectBufferATI", (GLBproc)glMapObjectBufferATI},
+    {"glMapParameterfvNV", (GLBproc)glMapParameterfvNV},
+    {"glMapParameterivNV", (GLBproc)glMapParameterivNV},
+    {"glMapTexture2DINTEL", (GLBproc)glMapTexture2DINTEL},
+    {"glMapVertexAttrib1dAPPLE", (GLBproc)glMapVertexAttrib1dAPPLE},
+    {"glMapVertexAttrib1fAPPLE", (GLBproc)glMapVertexAttrib1fAPPLE},
+    {"glMapVertexAttrib2dAPPLE", (GLBproc)glMapVertexAttrib2dAPPLE},
+    {"glMapVertexAttrib2fAPPLE", (GLBproc)glMapVertexAttrib2fAPPLE},
+    {"glMaterialf", (GLBproc)glMaterialf},
+    {"glMaterialfv", (GLBproc)glMaterialfv},
+    {"glMateriali", (GLBproc)glMateriali},
+    {"glMaterialiv", (GLBproc)glMaterialiv},
+    {"glMaterialxOES", (GLBproc)glMaterialxOES},
+    {"glMaterialxvOES", (GLBproc)glMaterialxvOES},
+    {"glMatrixFrustumEXT", (GLBproc)glMatrixFrustumEXT},
+    {"glMatrixIndexPointerARB", (GLBproc)glMatrixIndexPointerARB},
+    {"glMatrixIndexubvARB", (GLBproc)glMatrixIndexubvARB},
+    {"glMatrixIndexuivARB", (GLBproc)glMatrixIndexuivARB},
+    {"glMatrixIndexusvARB", (GLBproc)glMatrixIndexusvARB},
+    {"glMatrixLoad3x2fNV", (GLBproc)glMatrixLoad3x2fNV},
+    {"glMatrixLoad3x3fNV", (GLBproc)glMatrixLoad3x3fNV},
+    {"glMatrixLoadIdentityEXT", (GLBproc)glMatrixLoadIdentityEXT},
+    {"glMatrixLoadTranspose3x3fNV", (GLBproc)glMatrixLoadTranspose3x3fNV},
+    {"glMatrixLoadTransposedEXT", (GLBproc)glMatrixLoadTransposedEXT},
+    {"glMatrixLoadTransposefEXT", (GLBproc)glMatrixLoadTransposefEXT},
+    {"glMatrixLoaddEXT", (GLBproc)glMatrixLoaddEXT},
+    {"glMatrixLoadfEXT", (GLBproc)glMatrixLoadfEXT},
+    {"glMatrixMode", (GLBproc)glMatrixMode},
+    {"glMatrixMult3x2fNV", (GLBproc)glMatrixMult3x2fNV},
+    {"glMatrixMult3x3fNV", (GLBproc)glMatrixMult3x3fNV},
+    {"glMatrixMultTranspose3x3fNV", (GLBproc)glMatrixMultTranspose3x3fNV},
+    {"glMatrixMultTransposedEXT", (GLBproc)glMatrixMultTransposedEXT},
+    {"glMatrixMultTransposefEXT", (GLBproc)glMatrixMultTransposefEXT},
+    {"glMatrixMultdEXT", (GLBproc)glMatrixMultdEXT},
+    {"glMatrixMultfEXT", (GLBproc)glMatrixMultfEXT},
+    {"glMatrixOrthoEXT", (GLBproc)glMatrixOrthoEXT},
+    {"glMatrixPopEXT", (GLBproc)glMatrixPopEXT},
+    {"glMatrixPushEXT", (GLBproc)glMatrixPushEXT},
+    {"glMatrixRotatedEXT", (GLBproc)glMatrixRotatedEXT},
+    {"glMatrixRotatefEXT", (GLBproc)glMatrixRotatefEXT},
+    {"glMatrixScaledEXT", (GLBproc)glMatrixScaledEXT},
+    {"glMatrixScalefEXT", (GLBproc)glMatrixScalefEXT},
+    {"glMatrixTranslatedEXT", (GLBproc)glMatrixTranslatedEXT},
+    {"glMatrixTranslatefEXT", (GLBproc)glMatrixTranslatefEXT},
+    {"glMaxShaderCompilerThreadsARB", (GLBproc)glMaxShaderCompilerThreadsARB},
+    {"glMaxShaderCompilerThreadsKHR", (GLBproc)glMaxShaderCompilerThreadsKHR},
+    {"glMemoryBarrier", (GLBproc)glMemoryBarrier},
+    {"glMemoryBarrierByRegion", (GLBproc)glMemoryBarrierByRegion},
+    {"glMemoryBarrierEXT", (GLBproc)glMemoryBarrierEXT},
+    {"glMemoryObjectParameterivEXT", (GLBproc)glMemoryObjectParameterivEXT},
+    {"glMinSampleShading", (GLBproc)glMinSampleShading},
+    {"glMinSampleShadingARB", (GLBproc)glMinSampleShadingARB},
+    {"glMinmax", (GLBproc)glMinmax},
+    {"glMinmaxEXT", (GLBproc)glMinmaxEXT},
+    {"glMultMatrixd", (GLBproc)glMultMatrixd},
+    {"glMultMatrixf", (GLBproc)glMultMatrixf},
+    {"glMultMatrixxOES", (GLBproc)glMultMatrixxOES},
+    {"glMultTransposeMatrixd", (GLBproc)glMultTransposeMatrixd},
+    {"glMultTransposeMatrixdARB", (GLBproc)glMultTransposeMatrixdARB},
+    {"glMultTransposeMatrixf", (GLBproc)glMultTransposeMatrixf},
+    {"glMultTransposeMatrixfARB", (GLBproc)glMultTransposeMatrixfARB},
+    {"glMultTransposeMatrixxOES", (GLBproc)glMultTransposeMatrixxOES},
+    {"glMultiDrawArrays", (GLBproc)glMultiDrawArrays},
+    {"glMultiDrawArraysEXT", (GLBproc)glMultiDrawArraysEXT},
+    {"glMultiDrawArraysIndirect", (GLBproc)glMultiDrawArraysIndirect},
+    {"glMultiDrawArraysIndirectAMD", (GLBproc)glMultiDrawArraysIndirectAMD},
+    {"glMultiDrawArraysIndirectBindlessCountNV", (GLBproc)glMultiDrawArraysIndirectBindlessCountNV},
+    {"glMultiDrawArraysIndirectBindlessNV", (GLBproc)glMultiDrawArraysIndirectBindlessNV},
+    {"glMultiDrawArraysIndirectCount", (GLBproc)glMultiDrawArraysIndirectCount},
+    {"glMultiDrawArraysIndirectCountARB", (GLBproc)glMultiDrawArraysIndirectCountARB},
+    {"glMultiDrawElementArrayAPPLE", (GLBproc)glMultiDrawElementArrayAPPLE},
+    {"glMultiDrawElements", (GLBproc)glMultiDrawElements},
+    {"glMultiDrawElementsBaseVertex", (GLBproc)glMultiDrawElementsBaseVertex},
+    {"glMultiDrawElementsEXT", (GLBproc)glMultiDrawElementsEXT},
+    {"glMultiDrawElementsIndirect", (GLBproc)glMultiDrawElementsIndirect},
+    {"glMultiDrawElementsIndirectAMD", (GLBproc)glMultiDrawElementsIndirectAMD},
+    {"glMultiDrawElementsIndirectBindlessCountNV", (GLBproc)glMultiDrawElementsIndirectBindlessCountNV},
+    {"glMultiDrawElementsIndirectBindlessNV", (GLBproc)glMultiDrawElementsIndirectBindlessNV},
+    {"glMultiDrawElementsIndirectCount", (GLBproc)glMultiDrawElementsIndirectCount},
+    {"glMultiDrawElementsIndirectCountARB", (GLBproc)glMultiDrawElementsIndirectCountARB},
+    {"glMultiDrawMeshTasksIndirectCountNV", (GLBproc)glMultiDrawMeshTasksIndirectCountNV},
+    {"glMultiDrawMeshTasksIndirectNV", (GLBproc)glMultiDrawMeshTasksIndirectNV},
+    {"glMultiDrawRangeElementArrayAPPLE", (GLBproc)glMultiDrawRangeElementArrayAPPLE},
+    {"glMultiModeDrawArraysIBM", (GLBproc)glMultiModeDrawArraysIBM},
+    {"glMultiModeDrawElementsIBM", (GLBproc)glMultiModeDrawElementsIBM},
+    {"glMultiTexBufferEXT", (GLBproc)glMultiTexBufferEXT},
+    {"glMultiTexCoord1bOES", (GLBproc)glMultiTexCoord1bOES},
+    {"glMultiTexCoord1bvOES", (GLBproc)glMultiTexCoord1bvOES},
+    {"glMultiTexCoord1d", (GLBproc)glMultiTexCoord1d},
+    {"glMultiTexCoord1dARB", (GLBproc)glMultiTexCoord1dARB},
+    {"glMultiTexCoord1dv", (GLBproc)glMultiTexCoord1dv},
+    {"glMultiTexCoord1dvARB", (GLBproc)glMultiTexCoord1dvARB},
+    {"glMultiTexCoord1f", (GLBproc)glMultiTexCoord1f},
+    {"glMultiTexCoord1fARB", (GLBproc)glMultiTexCoord1fARB},
+    {"glMultiTexCoord1fv", (GLBproc)glMultiTexCoord1fv},
+    {"glMultiTexCoord1fvARB", (GLBproc)glMultiTexCoord1fvARB},
+    {"glMultiTexCoord1hNV", (GLBproc)glMultiTexCoord1hNV},
+    {"glMultiTexCoord1hvNV", (GLBproc)glMultiTexCoord1hvNV},
+    {"glMultiTexCoord1i", (GLBproc)glMultiTexCoord1i},
+    {"glMultiTexCoord1iARB", (GLBproc)glMultiTexCoord1iARB},
+    {"glMultiTexCoord1iv", (GLBproc)glMultiTexCoord1iv},
+    {"glMultiTexCoord1ivARB", (GLBproc)glMultiTexCoord1ivARB},
+    {"glMultiTexCoord1s", (GLBproc)glMultiTexCoord1s},
+    {"glMultiTexCoord1sARB", (GLBproc)glMultiTexCoord1sARB},
+    {"glMultiTexCoord1sv", (GLBproc)glMultiTexCoord1sv},
+    {"glMultiTexCoord1svARB", (GLBproc)glMultiTexCoord1svARB},
+    {"glMultiTexCoord1xOES", (GLBproc)glMultiTexCoord1xOES},
+    {"glMultiTexCoord1xvOES", (GLBproc)glMultiTexCoord1xvOES},
+    {"glMultiTexCoord2bOES", (GLBproc)glMultiTexCoord2bOES},
+    {"glMultiTexCoord2bvOES", (GLBproc)glMultiTexCoord2bvOES},
+    {"glMultiTexCoord2d", (GLBproc)glMultiTexCoord2d},
+    {"glMultiTexCoord2dARB", (GLBproc)glMultiTexCoord2dARB},
+    {"glMultiTexCoord2dv", (GLBproc)glMultiTexCoord2dv},
+    {"glMultiTexCoord2dvARB", (GLBproc)glMultiTexCoord2dvARB},
+    {"glMultiTexCoord2f", (GLBproc)glMultiTexCoord2f},
+    {"glMultiTexCoord2fARB", (GLBproc)glMultiTexCoord2fARB},
+    {"glMultiTexCoord2fv", (GLBproc)glMultiTexCoord2fv},
+    {"glMultiTexCoord2fvARB", (GLBproc)glMultiTexCoord2fvARB},
+    {"glMultiTexCoord2hNV", (GLBproc)glMultiTexCoord2hNV},
+    {"glMultiTexCoord2hvNV", (GLBproc)glMultiTexCoord2hvNV},
+    {"glMultiTexCoord2i", (GLBproc)glMultiTexCoord2i},
+    {"glMultiTexCoord2iARB", (GLBproc)glMultiTexCoord2iARB},
+    {"glMultiTexCoord2iv", (GLBproc)glMultiTexCoord2iv},
+    {"glMultiTexCoord2ivARB", (GLBproc)glMultiTexCoord2ivARB},
+    {"glMultiTexCoord2s", (GLBproc)glMultiTexCoord2s},
+    {"glMultiTexCoord2sARB", (GLBproc)glMultiTexCoord2sARB},
+    {"glMultiTexCoord2sv", (GLBproc)glMultiTexCoord2sv},
+    {"glMultiTexCoord2svARB", (GLBproc)glMultiTexCoord2svARB},
+    {"glMultiTexCoord2xOES", (GLBproc)glMultiTexCoord2xOES},
+    {"glMultiTexCoord2xvOES", (GLBproc)glMultiTexCoord2xvOES},
+    {"glMultiTexCoord3bOES", (GLBproc)glMultiTexCoord3bOES},
+    {"glMultiTexCoord3bvOES", (GLBproc)glMultiTexCoord3bvOES},
+    {"glMultiTexCoord3d", (GLBproc)glMultiTexCoord3d},
+    {"glMultiTexCoord3dARB", (GLBproc)glMultiTexCoord3dARB},
+    {"glMultiTexCoord3dv", (GLBproc)glMultiTexCoord3dv},
+    {"glMultiTexCoord3dvARB", (GLBproc)glMultiTexCoord3dvARB},
+    {"glMultiTexCoord3f", (GLBproc)glMultiTexCoord3f},
+    {"glMultiTexCoord3fARB", (GLBproc)glMultiTexCoord3fARB},
+    {"glMultiTexCoord3fv", (GLBproc)glMultiTexCoord3fv},
+    {"glMultiTexCoord3fvARB", (GLBproc)glMultiTexCoord3fvARB},
+    {"glMultiTexCoord3hNV", (GLBproc)glMultiTexCoord3hNV},
+    {"glMultiTexCoord3hvNV", (GLBproc)glMultiTexCoord3hvNV},
+    {"glMultiTexCoord3i", (GLBproc)glMultiTexCoord3i},
+    {"glMultiTexCoord3iARB", (GLBproc)glMultiTexCoord3iARB},
+    {"glMultiTexCoord3iv", (GLBproc)glMultiTexCoord3iv},
+    {"glMultiTexCoord3ivARB", (GLBproc)glMultiTexCoord3ivARB},
+    {"glMultiTexCoord3s", (GLBproc)glMultiTexCoord3s},
+    {"glMultiTexCoord3sARB", (GLBproc)glMultiTexCoord3sARB},
+    {"glMultiTexCoord3sv", (GLBproc)glMultiTexCoord3sv},
+    {"glMultiTexCoord3svARB", (GLBproc)glMultiTexCoord3svARB},
+    {"glMultiTexCoord3xOES", (GLBproc)glMultiTexCoord3xOES},
+    {"glMultiTexCoord3xvOES", (GLBproc)glMultiTexCoord3xvOES},
+    {"glMultiTexCoord4bOES", (GLBproc)glMultiTexCoord4bOES},
+    {"glMultiTexCoord4bvOES", (GLBproc)glMultiTexCoord4bvOES},
+    {"glMultiTexCoord4d", (GLBproc)glMultiTexCoord4d},
+    {"glMultiTexCoord4dARB", (GLBproc)glMultiTexCoord4dARB},
+    {"glMultiTexCoord4dv", (GLBproc)glMultiTexCoord4dv},
+    {"glMultiTexCoord4dvARB", (GLBproc)glMultiTexCoord4dvARB},
+    {"glMultiTexCoord4f", (GLBproc)glMultiTexCoord4f},
+    {"glMultiTexCoord4fARB", (GLBproc)glMultiTexCoord4fARB},
+    {"glMultiTexCoord4fv", (GLBproc)glMultiTexCoord4fv},
+    {"glMultiTexCoord4fvARB", (GLBproc)glMultiTexCoord4fvARB},
+    {"glMultiTexCoord4hNV", (GLBproc)glMultiTexCoord4hNV},
+    {"glMultiTexCoord4hvNV", (GLBproc)glMultiTexCoord4hvNV},
+    {"glMultiTexCoord4i", (GLBproc)glMultiTexCoord4i},
+    {"glMultiTexCoord4iARB", (GLBproc)glMultiTexCoord4iARB},
+    {"glMultiTexCoord4iv", (GLBproc)glMultiTexCoord4iv},
+    {"glMultiTexCoord4ivARB", (GLBproc)glMultiTexCoord4ivARB},
+    {"glMultiTexCoord4s", (GLBproc)glMultiTexCoord4s},
+    {"glMultiTexCoord4sARB", (GLBproc)glMultiTexCoord4sARB},
+    {"glMultiTexCoord4sv", (GLBproc)glMultiTexCoord4sv},
+    {"glMultiTexCoord4svARB", (GLBproc)glMultiTexCoord4svARB},
+    {"glMultiTexCoord4xOES", (GLBproc)glMultiTexCoord4xOES},
+    {"glMultiTexCoord4xvOES", (GLBproc)glMultiTexCoord4xvOES},
+    {"glMultiTexCoordP1ui", (GLBproc)glMultiTexCoordP1ui},
+    {"glMultiTexCoordP1uiv", (GLBproc)glMultiTexCoordP1uiv},
+    {"glMultiTexCoordP2ui", (GLBproc)glMultiTexCoordP2ui},
+    {"glMultiTexCoordP2uiv", (GLBproc)glMultiTexCoordP2uiv},
+    {"glMultiTexCoordP3ui", (GLBproc)glMultiTexCoordP3ui},
+    {"glMultiTexCoordP3uiv", (GLBproc)glMultiTexCoordP3uiv},
+    {"glMultiTexCoordP4ui", (GLBproc)glMultiTexCoordP4ui},
+    {"glMultiTexCoordP4uiv", (GLBproc)glMultiTexCoordP4uiv},
+    {"glMultiTexCoordPointerEXT", (GLBproc)glMultiTexCoordPointerEXT},
+    {"glMultiTexEnvfEXT", (GLBproc)glMultiTexEnvfEXT},
+    {"glMultiTexEnvfvEXT", (GLBproc)glMultiTexEnvfvEXT},
+    {"glMultiTexEnviEXT", (GLBproc)glMultiTexEnviEXT},
+    {"glMultiTexEnvivEXT", (GLBproc)glMultiTexEnvivEXT},
+    {"glMultiTexGendEXT", (GLBproc)glMultiTexGendEXT},
+    {"glMultiTexGendvEXT", (GLBproc)glMultiTexGendvEXT},
+    {"glMultiTexGenfEXT", (GLBproc)glMultiTexGenfEXT},
+    {"glMultiTexGenfvEXT", (GLBproc)glMultiTexGenfvEXT},
+    {"glMultiTexGeniEXT", (GLBproc)glMultiTexGeniEXT},
+    {"glMultiTexGenivEXT", (GLBproc)glMultiTexGenivEXT},
+    {"glMultiTexImage1DEXT", (GLBproc)glMultiTexImage1DEXT},
+    {"glMultiTexImage2DEXT", (GLBproc)glMultiTexImage2DEXT},
+    {"glMultiTexImage3DEXT", (GLBproc)glMultiTexImage3DEXT},
+    {"glMultiTexParameterIivEXT", (GLBproc)glMultiTexParameterIivEXT},
+    {"glMultiTexParameterIuivEXT", (GLBproc)glMultiTexParameterIuivEXT},
+    {"glMultiTexParameterfEXT", (GLBproc)glMultiTexParameterfEXT},
+    {"glMultiTexParameterfvEXT", (GLBproc)glMultiTexParameterfvEXT},
+    {"glMultiTexParameteriEXT", (GLBproc)glMultiTexParameteriEXT},
+    {"glMultiTexParameterivEXT", (GLBproc)glMultiTexParameterivEXT},
+    {"glMultiTexRenderbufferEXT", (GLBproc)glMultiTexRenderbufferEXT},
+    {"glMultiTexSubImage1DEXT", (GLBproc)glMultiTexSubImage1DEXT},
+    {"glMultiTexSubImage2DEXT", (GLBproc)glMultiTexSubImage2DEXT},
+    {"glMultiTexSubImage3DEXT", (GLBproc)glMultiTexSubImage3DEXT},
+    {"glMulticastBarrierNV", (GLBproc)glMulticastBarrierNV},
+    {"glMulticastBlitFramebufferNV", (GLBproc)glMulticastBlitFramebufferNV},
+    {"glMulticastBufferSubDataNV", (GLBproc)glMulticastBufferSubDataNV},
+    {"glMulticastCopyBufferSubDataNV", (GLBproc)glMulticastCopyBufferSubDataNV},
+    {"glMulticastCopyImageSubDataNV", (GLBproc)glMulticastCopyImageSubDataNV},
+    {"glMulticastFramebufferSampleLocationsfvNV", (GLBproc)glMulticastFramebufferSampleLocationsfvNV},
+    {"glMulticastGetQueryObjecti64vNV", (GLBproc)glMulticastGetQueryObjecti64vNV},
+    {"glMulticastGetQueryObjectivNV", (GLBproc)glMulticastGetQueryObjectivNV},
+    {"glMulticastGetQueryObjectui64vNV", (GLBproc)glMulticastGetQueryObjectui64vNV},
+    {"glMulticastGetQueryObjectuivNV", (GLBproc)glMulticastGetQueryObjectuivNV},
+    {"glMulticastScissorArrayvNVX", (GLBproc)glMulticastScissorArrayvNVX},
+    {"glMulticastViewportArrayvNVX", (GLBproc)glMulticastViewportArrayvNVX},
+    {"glMulticastViewportPositionWScaleNVX", (GLBproc)glMulticastViewportPositionWScaleNVX},
+    {"glMulticastWaitSyncNV", (GLBproc)glMulticastWaitSyncNV},
+    {"glNamedBufferAttachMemoryNV", (GLBproc)glNamedBufferAttachMemoryNV},
+    {"glNamedBufferData", (GLBproc)glNamedBufferData},
+    {"glNamedBufferDataEXT", (GLBproc)glNamedBufferDataEXT},
+    {"glNamedBufferPageCommitmentARB", (GLBproc)glNamedBufferPageCommitmentARB},
+    {"glNamedBufferPageCommitmentEXT", (GLBproc)glNamedBufferPageCommitmentEXT},
+    {"glNamedBufferPageCommitmentMemNV", (GLBproc)glNamedBufferPageCommitmentMemNV},
+    {"glNamedBufferStorage", (GLBproc)glNamedBufferStorage},
+    {"glNamedBufferStorageEXT", (GLBproc)glNamedBufferStorageEXT},
+    {"glNamedBufferStorageExternalEXT", (GLBproc)glNamedBufferStorageExternalEXT},
+    {"glNamedBufferStorageMemEXT", (GLBproc)glNamedBufferStorageMemEXT},
+    {"glNamedBufferSubData", (GLBproc)glNamedBufferSubData},
+    {"glNamedBufferSubDataEXT", (GLBproc)glNamedBufferSubDataEXT},
+    {"glNamedCopyBufferSubDataEXT", (GLBproc)glNamedCopyBufferSubDataEXT},
+    {"glNamedFramebufferDrawBuffer", (GLBproc)glNamedFramebufferDrawBuffer},
+    {"glNamedFramebufferDrawBuffers", (GLBproc)glNamedFramebufferDrawBuffers},
+    {"glNamedFramebufferParameteri", (GLBproc)glNamedFramebufferParameteri},
+    {"glNamedFramebufferParameteriEXT", (GLBproc)glNamedFramebufferParameteriEXT},
+    {"glNamedFramebufferReadBuffer", (GLBproc)glNamedFramebufferReadBuffer},
+    {"glNamedFramebufferRenderbuffer", (GLBproc)glNamedFramebufferRenderbuffer},
+    {"glNamedFramebufferRenderbufferEXT", (GLBproc)glNamedFramebufferRenderbufferEXT},
+    {"glNamedFramebufferSampleLocationsfvARB", (GLBproc)glNamedFramebufferSampleLocationsfvARB},
+    {"glNamedFramebufferSampleLocationsfvNV", (GLBproc)glNamedFramebufferSampleLocationsfvNV},
+    {"glNamedFramebufferSamplePositionsfvAMD", (GLBproc)glNamedFramebufferSamplePositionsfvAMD},
+    {"glNamedFramebufferTexture", (GLBproc)glNamedFramebufferTexture},
+    {"glNamedFramebufferTexture1DEXT", (GLBproc)glNamedFramebufferTexture1DEXT},
+    {"glNamedFramebufferTexture2DEXT", (GLBproc)glNamedFramebufferTexture2DEXT},
+    {"glNamedFramebufferTexture3DEXT", (GLBproc)glNamedFramebufferTexture3DEXT},
+    {"glNamedFramebufferTextureEXT", (GLBproc)glNamedFramebufferTextureEXT},
+    {"glNamedFramebufferTextureFaceEXT", (GLBproc)glNamedFramebufferTextureFaceEXT},
+    {"glNamedFramebufferTextureLayer", (GLBproc)glNamedFramebufferTextureLayer},
+    {"glNamedFramebufferTextureLayerEXT", (GLBproc)glNamedFramebufferTextureLayerEXT},
+    {"glNamedProgramLocalParameter4dEXT", (GLBproc)glNamedProgramLocalParameter4dEXT},
+    {"glNamedProgramLocalParameter4dvEXT", (GLBproc)glNamedProgramLocalParameter4dvEXT},
+    {"glNamedProgramLocalParameter4fEXT", (GLBproc)glNamedProgramLocalParameter4fEXT},
+    {"glNamedProgramLocalParameter4fvEXT", (GLBproc)glNamedProgramLocalParameter4fvEXT},
+    {"glNamedProgramLocalParameterI4iEXT", (GLBproc)glNamedProgramLocalParameterI4iEXT},
+    {"glNamedProgramLocalParameterI4ivEXT", (GLBproc)glNamedProgramLocalParameterI4ivEXT},
+    {"glNamedProgramLocalParameterI4uiEXT", (GLBproc)glNamedProgramLocalParameterI4uiEXT},
+    {"glNamedProgramLocalParameterI4uivEXT", (GLBproc)glNamedProgramLocalParameterI4uivEXT},
+    {"glNamedProgramLocalParameters4fvEXT", (GLBproc)glNamedProgramLocalParameters4fvEXT},
+    {"glNamedProgramLocalParametersI4ivEXT", (GLBproc)glNamedProgramLocalParametersI4ivEXT},
+    {"glNamedProgramLocalParametersI4uivEXT", (GLBproc)glNamedProgramLocalParametersI4uivEXT},
+    {"glNamedProgramStringEXT", (GLBproc)glNamedProgramStringEXT},
+    {"glNamedRenderbufferStorage", (GLBproc)glNamedRenderbufferStorage},
+    {"glNamedRenderbufferStorageEXT", (GLBproc)glNamedRenderbufferStorageEXT},
+    {"glNamedRenderbufferStorageMultisample", (GLBproc)glNamedRenderbufferStorageMultisample},
+    {"glNamedRenderbufferStorageMultisampleAdvancedAMD", (GLBproc)glNamedRenderbufferStorageMultisampleAdvancedAMD},
+    {"glNamedRenderbufferStorageMultisampleCoverageEXT", (GLBproc)glNamedRenderbufferStorageMultisampleCoverageEXT},
+    {"glNamedRenderbufferStorageMultisampleEXT", (GLBproc)glNamedRenderbufferStorageMultisampleEXT},
+    {"glNamedStringARB", (GLBproc)glNamedStringARB},
+    {"glNewList", (GLBproc)glNewList},
+    {"glNewObjectBufferATI", (GLBproc)glNewObjectBufferATI},
+    {"glNormal3b", (GLBproc)glNormal3b},
+    {"glNormal3bv", (GLBproc)glNormal3bv},
+    {"glNormal3d", (GLBproc)glNormal3d},
+    {"glNormal3dv", (GLBproc)glNormal3dv},
+    {"glNormal3f", (GLBproc)glNormal3f},
+    {"glNormal3fVertex3fSUN", (GLBproc)glNormal3fVertex3fSUN},
+    {"glNormal3fVertex3fvSUN", (GLBproc)glNormal3fVertex3fvSUN},
+    {"glNormal3fv", (GLBproc)glNormal3fv},
+    {"glNormal3hNV", (GLBproc)glNormal3hNV},
+    {"glNormal3hvNV", (GLBproc)glNormal3hvNV},
+    {"glNormal3i", (GLBproc)glNormal3i},
+    {"glNormal3iv", (GLBproc)glNormal3iv},
+    {"glNormal3s", (GLBproc)glNormal3s},
+    {"glNormal3sv", (GLBproc)glNormal3sv},
+    {"glNormal3xOES", (GLBproc)glNormal3xOES},
+    {"glNormal3xvOES", (GLBproc)glNormal3xvOES},
+    {"glNormalFormatNV", (GLBproc)glNormalFormatNV},
+    {"glNormalP3ui", (GLBproc)glNormalP3ui},
+    {"glNormalP3uiv", (GLBproc)glNormalP3uiv},
+    {"glNormalPointer", (GLBproc)glNormalPointer},
+    {"glNormalPointerEXT", (GLBproc)glNormalPointerEXT},
+    {"glNormalPointerListIBM", (GLBproc)glNormalPointerListIBM},
+    {"glNormalPointervINTEL", (GLBproc)glNormalPointervINTEL},
+    {"glNormalStream3bATI", (GLBproc)glNormalStream3bATI},
+    {"glNormalStream3bvATI", (GLBproc)glNormalStream3bvATI},
+    {"glNormalStream3dATI", (GLBproc)glNormalStream3dATI},
+    {"glNormalStream3dvATI", (GLBproc)glNormalStream3dvATI},
+    {"glNormalStream3fATI", (GLBproc)glNormalStream3fATI},
+    {"glNormalStream3fvATI", (GLBproc)glNormalStream3fvATI},
+    {"glNormalStream3iATI", (GLBproc)glNormalStream3iATI},
+    {"glNormalStream3ivATI", (GLBproc)glNormalStream3ivATI},
+    {"glNormalStream3sATI", (GLBproc)glNormalStream3sATI},
+    {"glNormalStream3svATI", (GLBproc)glNormalStream3svATI},
+    {"glObjectLabel", (GLBproc)glObjectLabel},
+    {"glObjectLabelKHR", (GLBproc)glObjectLabelKHR},
+    {"glObjectPtrLabel", (GLBproc)glObjectPtrLabel},
+    {"glObjectPtrLabelKHR", (GLBproc)glObjectPtrLabelKHR},
+    {"glObjectPurgeableAPPLE", (GLBproc)glObjectPurgeableAPPLE},
+    {"glObjectUnpurgeableAPPLE", (GLBproc)glObjectUnpurgeableAPPLE},
+    {"glOrtho", (GLBproc)glOrtho},
+    {"glOrthofOES", (GLBproc)glOrthofOES},
+    {"glOrthoxOES", (GLBproc)glOrthoxOES},
+    {"glPNTrianglesfATI", (GLBproc)glPNTrianglesfATI},
+    {"glPNTrianglesiATI", (GLBproc)glPNTrianglesiATI},
+    {"glPassTexCoordATI", (GLBproc)glPassTexCoordATI},
+    {"glPassThrough", (GLBproc)glPassThrough},
+    {"glPassThroughxOES", (GLBproc)glPassThroughxOES},
+    {"glPatchParameterfv", (GLBproc)glPatchParameterfv},
+    {"glPatchParameteri", (GLBproc)glPatchParameteri},
+    {"glPathColorGenNV", (GLBproc)glPathColorGenNV},
+    {"glPathCommandsNV", (GLBproc)glPathCommandsNV},
+    {"glPathCoordsNV", (GLBproc)glPathCoordsNV},
+    {"glPathCoverDepthFuncNV", (GLBproc)glPathCoverDepthFuncNV},
+    {"glPathDashArrayNV", (GLBproc)glPathDashArrayNV},
+    {"glPathFogGenNV", (GLBproc)glPathFogGenNV},
+    {"glPathGlyphIndexArrayNV", (GLBproc)glPathGlyphIndexArrayNV},
+    {"glPathGlyphIndexRangeNV", (GLBproc)glPathGlyphIndexRangeNV},
+    {"glPathGlyphRangeNV", (GLBproc)glPathGlyphRangeNV},
+    {"glPathGlyphsNV", (GLBproc)glPathGlyphsNV},
+    {"glPathMemoryGlyphIndexArrayNV", (GLBproc)glPathMemoryGlyphIndexArrayNV},
+    {"glPathParameterfNV", (GLBproc)glPathParameterfNV},
+    {"glPathParameterfvNV", (GLBproc)glPathParameterfvNV},
+    {"glPathParameteriNV", (GLBproc)glPathParameteriNV},
+    {"glPathParameterivNV", (GLBproc)glPathParameterivNV},
+    {"glPathStencilDepthOffsetNV", (GLBproc)glPathStencilDepthOffsetNV},
+    {"glPathStencilFuncNV", (GLBproc)glPathStencilFuncNV},
+    {"glPathStringNV", (GLBproc)glPathStringNV},
+    {"glPathSubCommandsNV", (GLBproc)glPathSubCommandsNV},
+    {"glPathSubCoordsNV", (GLBproc)glPathSubCoordsNV},
+    {"glPathTexGenNV", (GLBproc)glPathTexGenNV},
+    {"glPauseTransformFeedback", (GLBproc)glPauseTransformFeedback},
+    {"glPauseTransformFeedbackNV", (GLBproc)glPauseTransformFeedbackNV},
+    {"glPixelDataRangeNV", (GLBproc)glPixelDataRangeNV},
+    {"glPixelMapfv", (GLBproc)glPixelMapfv},
+    {"glPixelMapuiv", (GLBproc)glPixelMapuiv},
+    {"glPixelMapusv", (GLBproc)glPixelMapusv},
+    {"glPixelMapx", (GLBproc)glPixelMapx},
+    {"glPixelStoref", (GLBproc)glPixelStoref},
+    {"glPixelStorei", (GLBproc)glPixelStorei},
+    {"glPixelStorex", (GLBproc)glPixelStorex},
+    {"glPixelTexGenParameterfSGIS", (GLBproc)glPixelTexGenParameterfSGIS},
+    {"glPixelTexGenParameterfvSGIS", (GLBproc)glPixelTexGenParameterfvSGIS},
+    {"glPixelTexGenParameteriSGIS", (GLBproc)glPixelTexGenParameteriSGIS},
+    {"glPixelTexGenParameterivSGIS", (GLBproc)glPixelTexGenParameterivSGIS},
+    {"glPixelTexGenSGIX", (GLBproc)glPixelTexGenSGIX},
+    {"glPixelTransferf", (GLBproc)glPixelTransferf},
+    {"glPixelTransferi", (GLBproc)glPixelTransferi},
+    {"glPixelTransferxOES", (GLBproc)glPixelTransferxOES},
+    {"glPixelTransformParameterfEXT", (GLBproc)glPixelTransformParameterfEXT},
+    {"glPixelTransformParameterfvEXT", (GLBproc)glPixelTransformParameterfvEXT},
+    {"glPixelTransformParameteriEXT", (GLBproc)glPixelTransformParameteriEXT},
+    {"glPixelTransformParameterivEXT", (GLBproc)glPixelTransformParameterivEXT},
+    {"glPixelZoom", (GLBproc)glPixelZoom},
+    {"glPixelZoomxOES", (GLBproc)glPixelZoomxOES},
+    {"glPointAlongPathNV", (GLBproc)glPointAlongPathNV},
+    {"glPointParameterf", (GLBproc)glPointParameterf},
+    {"glPointParameterfARB", (GLBproc)glPointParameterfARB},
+    {"glPointParameterfEXT", (GLBproc)glPointParameterfEXT},
+    {"glPointParameterfSGIS", (GLBproc)glPointParameterfSGIS},
+    {"glPointParameterfv", (GLBproc)glPointParameterfv},
+    {"glPointParameterfvARB", (GLBproc)glPointParameterfvARB},
+    {"glPointParameterfvEXT", (GLBproc)glPointParameterfvEXT},
+    {"glPointParameterfvSGIS", (GLBproc)glPointParameterfvSGIS},
+    {"glPointParameteri", (GLBproc)glPointParameteri},
+    {"glPointParameteriNV", (GLBproc)glPointParameteriNV},
+    {"glPointParameteriv", (GLBproc)glPointParameteriv},
+    {"glPointParameterivNV", (GLBproc)glPointParameterivNV},
+    {"glPointParameterxOES", (GLBproc)glPointParameterxOES},
+    {"glPointParameterxvOES", (GLBproc)glPointParameterxvOES},
+    {"glPointSize", (GLBproc)glPointSize},
+    {"glPointSizexOES", (GLBproc)glPointSizexOES},
+    {"glPollAsyncSGIX", (GLBproc)glPollAsyncSGIX},
+    {"glPollInstrumentsSGIX", (GLBproc)glPollInstrumentsSGIX},
+    {"glPolygonMode", (GLBproc)glPolygonMode},
+    {"glPolygonOffset", (GLBproc)glPolygonOffset},
+    {"glPolygonOffsetClamp", (GLBproc)glPolygonOffsetClamp},
+    {"glPolygonOffsetClampEXT", (GLBproc)glPolygonOffsetClampEXT},
+    {"glPolygonOffsetEXT", (GLBproc)glPolygonOffsetEXT},
+    {"glPolygonOffsetxOES", (GLBproc)glPolygonOffsetxOES},
+    {"glPolygonStipple", (GLBproc)glPolygonStipple},
+    {"glPopAttrib", (GLBproc)glPopAttrib},
+    {"glPopClientAttrib", (GLBproc)glPopClientAttrib},
+    {"glPopDebugGroup", (GLBproc)glPopDebugGroup},
+    {"glPopDebugGroupKHR", (GLBproc)glPopDebugGroupKHR},
+    {"glPopGroupMarkerEXT", (GLBproc)glPopGroupMarkerEXT},
+    {"glPopMatrix", (GLBproc)glPopMatrix},
+    {"glPopName", (GLBproc)glPopName},
+    {"glPresentFrameDualFillNV", (GLBproc)glPresentFrameDualFillNV},
+    {"glPresentFrameKeyedNV", (GLBproc)glPresentFrameKeyedNV},
+    {"glPrimitiveBoundingBoxARB", (GLBproc)glPrimitiveBoundingBoxARB},
+    {"glPrimitiveRestartIndex", (GLBproc)glPrimitiveRestartIndex},
+    {"glPrimitiveRestartIndexNV", (GLBproc)glPrimitiveRestartIndexNV},
+    {"glPrimitiveRestartNV", (GLBproc)glPrimitiveRestartNV},
+    {"glPrioritizeTextures", (GLBproc)glPrioritizeTextures},
+    {"glPrioritizeTexturesEXT", (GLBproc)glPrioritizeTexturesEXT},
+    {"glPrioritizeTexturesxOES", (GLBproc)glPrioritizeTexturesxOES},
+    {"glProgramBinary", (GLBproc)glProgramBinary},
+    {"glProgramBufferParametersIivNV", (GLBproc)glProgramBufferParametersIivNV},
+    {"glProgramBufferParametersIuivNV", (GLBproc)glProgramBufferParametersIuivNV},
+    {"glProgramBufferParametersfvNV", (GLBproc)glProgramBufferParametersfvNV},
+    {"glProgramEnvParameter4dARB", (GLBproc)glProgramEnvParameter4dARB},
+    {"glProgramEnvParameter4dvARB", (GLBproc)glProgramEnvParameter4dvARB},
+    {"glProgramEnvParameter4fARB", (GLBproc)glProgramEnvParameter4fARB},
+    {"glProgramEnvParameter4fvARB", (GLBproc)glProgramEnvParameter4fvARB},
+    {"glProgramEnvParameterI4iNV", (GLBproc)glProgramEnvParameterI4iNV},
+    {"glProgramEnvParameterI4ivNV", (GLBproc)glProgramEnvParameterI4ivNV},
+    {"glProgramEnvParameterI4uiNV", (GLBproc)glProgramEnvParameterI4uiNV},
+    {"glProgramEnvParameterI4uivNV", (GLBproc)glProgramEnvParameterI4uivNV},
+    {"glProgramEnvParameters4fvEXT", (GLBproc)glProgramEnvParameters4fvEXT},
+    {"glProgramEnvParametersI4ivNV", (GLBproc)glProgramEnvParametersI4ivNV},
+    {"glProgramEnvParametersI4uivNV", (GLBproc)glProgramEnvParametersI4uivNV},
+    {"glProgramLocalParameter4dARB", (GLBproc)glProgramLocalParameter4dARB},
+    {"glProgramLocalParameter4dvARB", (GLBproc)glProgramLocalParameter4dvARB},
+    {"glProgramLocalParameter4fARB", (GLBproc)glProgramLocalParameter4fARB},
+    {"glProgramLocalParameter4fvARB", (GLBproc)glProgramLocalParameter4fvARB},
+    {"glProgramLocalParameterI4iNV", (GLBproc)glProgramLocalParameterI4iNV},
+    {"glProgramLocalParameterI4ivNV", (GLBproc)glProgramLocalParameterI4ivNV},
+    {"glProgramLocalParameterI4uiNV", (GLBproc)glProgramLocalParameterI4uiNV},
+    {"glProgramLocalParameterI4uivNV", (GLBproc)glProgramLocalParameterI4uivNV},
+    {"glProgramLocalParameters4fvEXT", (GLBproc)glProgramLocalParameters4fvEXT},
+    {"glProgramLocalParametersI4ivNV", (GLBproc)glProgramLocalParametersI4ivNV},
+    {"glProgramLocalParametersI4uivNV", (GLBproc)glProgramLocalParametersI4uivNV},
+    {"glProgramNamedParameter4dNV", (GLBproc)glProgramNamedParameter4dNV},
+    {"glProgramNamedParameter4dvNV", (GLBproc)glProgramNamedParameter4dvNV},
+    {"glProgramNamedParameter4fNV", (GLBproc)glProgramNamedParameter4fNV},
+    {"glProgramNamedParameter4fvNV", (GLBproc)glProgramNamedParameter4fvNV},
+    {"glProgramParameter4dNV", (GLBproc)glProgramParameter4dNV},
+    {"glProgramParameter4dvNV", (GLBproc)glProgramParameter4dvNV},
+    {"glProgramParameter4fNV", (GLBproc)glProgramParameter4fNV},
+    {"glProgramParameter4fvNV", (GLBproc)glProgramParameter4fvNV},
+    {"glProgramParameteri", (GLBproc)glProgramParameteri},
+    {"glProgramParameteriARB", (GLBproc)glProgramParameteriARB},
+    {"glProgramParameteriEXT", (GLBproc)glProgramParameteriEXT},
+    {"glProgramParameters4dvNV", (GLBproc)glProgramParameters4dvNV},
+    {"glProgramParameters4fvNV", (GLBproc)glProgramParameters4fvNV},
+    {"glProgramPathFragmentInputGenNV", (GLBproc)glProgramPathFragmentInputGenNV},
+    {"glProgramStringARB", (GLBproc)glProgramStringARB},
+    {"glProgramSubroutineParametersuivNV", (GLBproc)glProgramSubroutineParametersuivNV},
+    {"glProgramUniform1d", (GLBproc)glProgramUniform1d},
+    {"glProgramUniform1dEXT", (GLBproc)glProgramUniform1dEXT},
+    {"glProgramUniform1dv", (GLBproc)glProgramUniform1dv},
+    {"glProgramUniform1dvEXT", (GLBproc)glProgramUniform1dvEXT},
+    {"glProgramUniform1f", (GLBproc)glProgramUniform1f},
+    {"glProgramUniform1fEXT", (GLBproc)glProgramUniform1fEXT},
+    {"glProgramUniform1fv", (GLBproc)glProgramUniform1fv},
+    {"glProgramUniform1fvEXT", (GLBproc)glProgramUniform1fvEXT},
+    {"glProgramUniform1i", (GLBproc)glProgramUniform1i},
+    {"glProgramUniform1i64ARB", (GLBproc)glProgramUniform1i64ARB},
+    {"glProgramUniform1i64NV", (GLBproc)glProgramUniform1i64NV},
+    {"glProgramUniform1i64vARB", (GLBproc)glProgramUniform1i64vARB},
+    {"glProgramUniform1i64vNV", (GLBproc)glProgramUniform1i64vNV},
+    {"glProgramUniform1iEXT", (GLBproc)glProgramUniform1iEXT},
+    {"glProgramUniform1iv", (GLBproc)glProgramUniform1iv},
+    {"glProgramUniform1ivEXT", (GLBproc)glProgramUniform1ivEXT},
+    {"glProgramUniform1ui", (GLBproc)glProgramUniform1ui},
+    {"glProgramUniform1ui64ARB", (GLBproc)glProgramUniform1ui64ARB},
+    {"glProgramUniform1ui64NV", (GLBproc)glProgramUniform1ui64NV},
+    {"glProgramUniform1ui64vARB", (GLBproc)glProgramUniform1ui64vARB},
+    {"glProgramUniform1ui64vNV", (GLBproc)glProgramUniform1ui64vNV},
+    {"glProgramUniform1uiEXT", (GLBproc)glProgramUniform1uiEXT},
+    {"glProgramUniform1uiv", (GLBproc)glProgramUniform1uiv},
+    {"glProgramUniform1uivEXT", (GLBproc)glProgramUniform1uivEXT},
+    {"glProgramUniform2d", (GLBproc)glProgramUniform2d},
+    {"glProgramUniform2dEXT", (GLBproc)glProgramUniform2dEXT},
+    {"glProgramUniform2dv", (GLBproc)glProgramUniform2dv},
+    {"glProgramUniform2dvEXT", (GLBproc)glProgramUniform2dvEXT},
+    {"glProgramUniform2f", (GLBproc)glProgramUniform2f},
+    {"glProgramUniform2fEXT", (GLBproc)glProgramUniform2fEXT},
+    {"glProgramUniform2fv", (GLBproc)glProgramUniform2fv},
+    {"glProgramUniform2fvEXT", (GLBproc)glProgramUniform2fvEXT},
+    {"glProgramUniform2i", (GLBproc)glProgramUniform2i},
+    {"glProgramUniform2i64ARB", (GLBproc)glProgramUniform2i64ARB},
+    {"glProgramUniform2i64NV", (GLBproc)glProgramUniform2i64NV},
+    {"glProgramUniform2i64vARB", (GLBproc)glProgramUniform2i64vARB},
+    {"glProgramUniform2i64vNV", (GLBproc)glProgramUniform2i64vNV},
+    {"glProgramUniform2iEXT", (GLBproc)glProgramUniform2iEXT},
+    {"glProgramUniform2iv", (GLBproc)glProgramUniform2iv},
+    {"glProgramUniform2ivEXT", (GLBproc)glProgramUniform2ivEXT},
+    {"glProgramUniform2ui", (GLBproc)glProgramUniform2ui},
+    {"glProgramUniform2ui64ARB", (GLBproc)glProgramUniform2ui64ARB},
+    {"glProgramUniform2ui64NV", (GLBproc)glProgramUniform2ui64NV},
+    {"glProgramUniform2ui64vARB", (GLBproc)glProgramUniform2ui64vARB},
+    {"glProgramUniform2ui64vNV", (GLBproc)glProgramUniform2ui64vNV},
+    {"glProgramUniform2uiEXT", (GLBproc)glProgramUniform2uiEXT},
+    {"glProgramUniform2uiv", (GLBproc)glProgramUniform2uiv},
+    {"glProgramUniform2uivEXT", (GLBproc)glProgramUniform2uivEXT},
+    {"glProgramUniform3d", (GLBproc)glProgramUniform3d},
+    {"glProgramUniform3dEXT", (GLBproc)glProgramUniform3dEXT},
+    {"glProgramUniform3dv", (GLBproc)glProgramUniform3dv},
+    {"glProgramUniform3dvEXT", (GLBproc)glProgramUniform3dvEXT},
+    {"glProgramUniform3f", (GLBproc)glProgramUniform3f},
+    {"glProgramUniform3fEXT", (GLBproc)glProgramUniform3fEXT},
+    {"glProgramUniform3fv", (GLBproc)glProgramUniform3fv},
+    {"glProgramUniform3fvEXT", (GLBproc)glProgramUniform3fvEXT},
+    {"glProgramUniform3i", (GLBproc)glProgramUniform3i},
+    {"glProgramUniform3i64ARB", (GLBproc)glProgramUniform3i64ARB},
+    {"glProgramUniform3i64NV", (GLBproc)glProgramUniform3i64NV},
+    {"glProgramUniform3i64vARB", (GLBproc)glProgramUniform3i64vARB},
+    {"glProgramUniform3i64vNV", (GLBproc)glProgramUniform3i64vNV},
+    {"glProgramUniform3iEXT", (GLBproc)glProgramUniform3iEXT},
+    {"glProgramUniform3iv", (GLBproc)glProgramUniform3iv},
+    {"glProgramUniform3ivEXT", (GLBproc)glProgramUniform3ivEXT},
+    {"glProgramUniform3ui", (GLBproc)glProgramUniform3ui},
+    {"glProgramUniform3ui64ARB", (GLBproc)glProgramUniform3ui64ARB},
+    {"glProgramUniform3ui64NV", (GLBproc)glProgramUniform3ui64NV},
+    {"glProgramUniform3ui64vARB", (GLBproc)glProgramUniform3ui64vARB},
+    {"glProgramUniform3ui64vNV", (GLBproc)glProgramUniform3ui64vNV},
+    {"glProgramUniform3uiEXT", (GLBproc)glProgramUniform3uiEXT},
+    {"glProgramUniform3uiv", (GLBproc)glProgramUniform3uiv},
+    {"glProgramUniform3uivEXT", (GLBproc)glProgramUniform3uivEXT},
+    {"glProgramUniform4d", (GLBproc)glProgramUniform4d},
+    {"glProgramUniform4dEXT", (GLBproc)glProgramUniform4dEXT},
+    {"glProgramUniform4dv", (GLBproc)glProgramUniform4dv},
+    {"glProgramUniform4dvEXT", (GLBproc)glProgramUniform4dvEXT},
+    {"glProgramUniform4f", (GLBproc)glProgramUniform4f},
+    {"glProgramUniform4fEXT", (GLBproc)glProgramUniform4fEXT},
+    {"glProgramUniform4fv", (GLBproc)glProgramUniform4fv},
+    {"glProgramUniform4fvEXT", (GLBproc)glProgramUniform4fvEXT},
+    {"glProgramUniform4i", (GLBproc)glProgramUniform4i},
+    {"glProgramUniform4i64ARB", (GLBproc)glProgramUniform4i64ARB},
+    {"glProgramUniform4i64NV", (GLBproc)glProgramUniform4i64NV},
+    {"glProgramUniform4i64vARB", (GLBproc)glProgramUniform4i64vARB},
+    {"glProgramUniform4i64vNV", (GLBproc)glProgramUniform4i64vNV},
+    {"glProgramUniform4iEXT", (GLBproc)glProgramUniform4iEXT},
+    {"glProgramUniform4iv", (GLBproc)glProgramUniform4iv},
+    {"glProgramUniform4ivEXT", (GLBproc)glProgramUniform4ivEXT},
+    {"glProgramUniform4ui", (GLBproc)glProgramUniform4ui},
+    {"glProgramUniform4ui64ARB", (GLBproc)glProgramUniform4ui64ARB},
+    {"glProgramUniform4ui64NV", (GLBproc)glProgramUniform4ui64NV},
+    {"glProgramUniform4ui64vARB", (GLBproc)glProgramUniform4ui64vARB},
+    {"glProgramUniform4ui64vNV", (GLBproc)glProgramUniform4ui64vNV},
+    {"glProgramUniform4uiEXT", (GLBproc)glProgramUniform4uiEXT},
+    {"glProgramUniform4uiv", (GLBproc)glProgramUniform4uiv},
+    {"glProgramUniform4uivEXT", (GLBproc)glProgramUniform4uivEXT},
+    {"glProgramUniformHandleui64ARB", (GLBproc)glProgramUniformHandleui64ARB},
+    {"glProgramUniformHandleui64NV", (GLBproc)glProgramUniformHandleui64NV},
+    {"glProgramUniformHandleui64vARB", (GLBproc)glProgramUniformHandleui64vARB},
+    {"glProgramUniformHandleui64vNV", (GLBproc)glProgramUniformHandleui64vNV},
+    {"glProgramUniformMatrix2dv", (GLBproc)glProgramUniformMatrix2dv},
+    {"glProgramUniformMatrix2dvEXT", (GLBproc)glProgramUniformMatrix2dvEXT},
+    {"glProgramUniformMatrix2fv", (GLBproc)glProgramUniformMatrix2fv},
+    {"glProgramUniformMatrix2fvEXT", (GLBproc)glProgramUniformMatrix2fvEXT},
+    {"glProgramUniformMatrix2x3dv", (GLBproc)glProgramUniformMatrix2x3dv},
+    {"glProgramUniformMatrix2x3dvEXT", (GLBproc)glProgramUniformMatrix2x3dvEXT},
+    {"glProgramUniformMatrix2x3fv", (GLBproc)glProgramUniformMatrix2x3fv},
+    {"glProgramUniformMatrix2x3fvEXT", (GLBproc)glProgramUniformMatrix2x3fvEXT},
+    {"glProgramUniformMatrix2x4dv", (GLBproc)glProgramUniformMatrix2x4dv},
+    {"glProgramUniformMatrix2x4dvEXT", (GLBproc)glProgramUniformMatrix2x4dvEXT},
+    {"glProgramUniformMatrix2x4fv", (GLBproc)glProgramUniformMatrix2x4fv},
+    {"glProgramUniformMatrix2x4fvEXT", (GLBproc)glProgramUniformMatrix2x4fvEXT},
+    {"glProgramUniformMatrix3dv", (GLBproc)glProgramUniformMatrix3dv},
+    {"glProgramUniformMatrix3dvEXT", (GLBproc)glProgramUniformMatrix3dvEXT},
+    {"glProgramUniformMatrix3fv", (GLBproc)glProgramUniformMatrix3fv},
+    {"glProgramUniformMatrix3fvEXT", (GLBproc)glProgramUniformMatrix3fvEXT},
+    {"glProgramUniformMatrix3x2dv", (GLBproc)glProgramUniformMatrix3x2dv},
+    {"glProgramUniformMatrix3x2dvEXT", (GLBproc)glProgramUniformMatrix3x2dvEXT},
+    {"glProgramUniformMatrix3x2fv", (GLBproc)glProgramUniformMatrix3x2fv},
+    {"glProgramUniformMatrix3x2fvEXT", (GLBproc)glProgramUniformMatrix3x2fvEXT},
+    {"glProgramUniformMatrix3x4dv", (GLBproc)glProgramUniformMatrix3x4dv},
+    {"glProgramUniformMatrix3x4dvEXT", (GLBproc)glProgramUniformMatrix3x4dvEXT},
+    {"glProgramUniformMatrix3x4fv", (GLBproc)glProgramUniformMatrix3x4fv},
+    {"glProgramUniformMatrix3x4fvEXT", (GLBproc)glProgramUniformMatrix3x4fvEXT},
+    {"glProgramUniformMatrix4dv", (GLBproc)glProgramUniformMatrix4dv},
+    {"glProgramUniformMatrix4dvEXT", (GLBproc)glProgramUniformMatrix4dvEXT},
+    {"glProgramUniformMatrix4fv", (GLBproc)glProgramUniformMatrix4fv},
+    {"glProgramUniformMatrix4fvEXT", (GLBproc)glProgramUniformMatrix4fvEXT},
+    {"glProgramUniformMatrix4x2dv", (GLBproc)glProgramUniformMatrix4x2dv},
+    {"glProgramUniformMatrix4x2dvEXT", (GLBproc)glProgramUniformMatrix4x2dvEXT},
+    {"glProgramUniformMatrix4x2fv", (GLBproc)glProgramUniformMatrix4x2fv},
+    {"glProgramUniformMatrix4x2fvEXT", (GLBproc)glProgramUniformMatrix4x2fvEXT},
+    {"glProgramUniformMatrix4x3dv", (GLBproc)glProgramUniformMatrix4x3dv},
+    {"glProgramUniformMatrix4x3dvEXT", (GLBproc)glProgramUniformMatrix4x3dvEXT},
+    {"glProgramUniformMatrix4x3fv", (GLBproc)glProgramUniformMatrix4x3fv},
+    {"glProgramUniformMatrix4x3fvEXT", (GLBproc)glProgramUniformMatrix4x3fvEXT},
+    {"glProgramUniformui64NV", (GLBproc)glProgramUniformui64NV},
+    {"glProgramUniformui64vNV", (GLBproc)glProgramUniformui64vNV},
+    {"glProgramVertexLimitNV", (GLBproc)glProgramVertexLimitNV},
+    {"glProvokingVertex", (GLBproc)glProvokingVertex},
+    {"glProvokingVertexEXT", (GLBproc)glProvokingVertexEXT},
+    {"glPushAttrib", (GLBproc)glPushAttrib},
+    {"glPushClientAttrib", (GLBproc)glPushClientAttrib},
+    {"glPushClientAttribDefaultEXT", (GLBproc)glPushClientAttribDefaultEXT},
+    {"glPushDebugGroup", (GLBproc)glPushDebugGroup},
+    {"glPushDebugGroupKHR", (GLBproc)glPushDebugGroupKHR},
+    {"glPushGroupMarkerEXT", (GLBproc)glPushGroupMarkerEXT},
+    {"glPushMatrix", (GLBproc)glPushMatrix},
+    {"glPushName", (GLBproc)glPushName},
+    {"glQueryCounter", (GLBproc)glQueryCounter},
+    {"glQueryMatrixxOES", (GLBproc)glQueryMatrixxOES},
+    {"glQueryObjectParameteruiAMD", (GLBproc)glQueryObjectParameteruiAMD},
+    {"glQueryResourceNV", (GLBproc)glQueryResourceNV},
+    {"glQueryResourceTagNV", (GLBproc)glQueryResourceTagNV},
+    {"glRasterPos2d", (GLBproc)glRasterPos2d},
+    {"glRasterPos2dv", (GLBproc)glRasterPos2dv},
+    {"glRasterPos2f", (GLBproc)glRasterPos2f},
+    {"glRasterPos2fv", (GLBproc)glRasterPos2fv},
+    {"glRasterPos2i", (GLBproc)glRasterPos2i},
+    {"glRasterPos2iv", (GLBproc)glRasterPos2iv},
+    {"glRasterPos2s", (GLBproc)glRasterPos2s},
+    {"glRasterPos2sv", (GLBproc)glRasterPos2sv},
+    {"glRasterPos2xOES", (GLBproc)glRasterPos2xOES},
+    {"glRasterPos2xvOES", (GLBproc)glRasterPos2xvOES},
+    {"glRasterPos3d", (GLBproc)glRasterPos3d},
+    {"glRasterPos3dv", (GLBproc)glRasterPos3dv},
+    {"glRasterPos3f", (GLBproc)glRasterPos3f},
+    {"glRasterPos3fv", (GLBproc)glRasterPos3fv},
+    {"glRasterPos3i", (GLBproc)glRasterPos3i},
+    {"glRasterPos3iv", (GLBproc)glRasterPos3iv},
+    {"glRasterPos3s", (GLBproc)glRasterPos3s},
+    {"glRasterPos3sv", (GLBproc)glRasterPos3sv},
+    {"glRasterPos3xOES", (GLBproc)glRasterPos3xOES},
+    {"glRasterPos3xvOES", (GLBproc)glRasterPos3xvOES},
+    {"glRasterPos4d", (GLBproc)glRasterPos4d},
+    {"glRasterPos4dv", (GLBproc)glRasterPos4dv},
+    {"glRasterPos4f", (GLBproc)glRasterPos4f},
+    {"glRasterPos4fv", (GLBproc)glRasterPos4fv},
+    {"glRasterPos4i", (GLBproc)glRasterPos4i},
+    {"glRasterPos4iv", (GLBproc)glRasterPos4iv},
+    {"glRasterPos4s", (GLBproc)glRasterPos4s},
+    {"glRasterPos4sv", (GLBproc)glRasterPos4sv},
+    {"glRasterPos4xOES", (GLBproc)glRasterPos4xOES},
+    {"glRasterPos4xvOES", (GLBproc)glRasterPos4xvOES},
+    {"glRasterSamplesEXT", (GLBproc)glRasterSamplesEXT},
+    {"glReadBuffer", (GLBproc)glReadBuffer},
+    {"glReadInstrumentsSGIX", (GLBproc)glReadInstrumentsSGIX},
+    {"glReadPixels", (GLBproc)glReadPixels},
+    {"glReadnPixels", (GLBproc)glReadnPixels},
+    {"glReadnPixelsARB", (GLBproc)glReadnPixelsARB},
+    {"glReadnPixelsKHR", (GLBproc)glReadnPixelsKHR},
+    {"glRectd", (GLBproc)glRectd},
+    {"glRectdv", (GLBproc)glRectdv},
+    {"glRectf", (GLBproc)glRectf},
+    {"glRectfv", (GLBproc)glRectfv},
+    {"glRecti", (GLBproc)glRecti},
+    {"glRectiv", (GLBproc)glRectiv},
+    {"glRects", (GLBproc)glRects},
+    {"glRectsv", (GLBproc)glRectsv},
+    {"glRectxOES", (GLBproc)glRectxOES},
+    {"glRectxvOES", (GLBproc)glRectxvOES},
+    {"glReferencePlaneSGIX", (GLBproc)glReferencePlaneSGIX},
+    {"glReleaseKeyedMutexWin32EXT", (GLBproc)glReleaseKeyedMutexWin32EXT},
+    {"glReleaseShaderCompiler", (GLBproc)glReleaseShaderCompiler},
+    {"glRenderGpuMaskNV", (GLBproc)glRenderGpuMaskNV},
+    {"glRenderMode", (GLBproc)glRenderMode},
+    {"glRenderbufferStorage", (GLBproc)glRenderbufferStorage},
+    {"glRenderbufferStorageEXT", (GLBproc)glRenderbufferStorageEXT},
+    {"glRenderbufferStorageMultisample", (GLBproc)glRenderbufferStorageMultisample},
+    {"glRenderbufferStorageMultisampleAdvancedAMD", (GLBproc)glRenderbufferStorageMultisampleAdvancedAMD},
+    {"glRenderbufferStorageMultisampleCoverageNV", (GLBproc)glRenderbufferStorageMultisampleCoverageNV},
+    {"glRenderbufferStorageMultisampleEXT", (GLBproc)glRenderbufferStorageMultisampleEXT},
+    {"glReplacementCodePointerSUN", (GLBproc)glReplacementCodePointerSUN},
+    {"glReplacementCodeubSUN", (GLBproc)glReplacementCodeubSUN},
+    {"glReplacementCodeubvSUN", (GLBproc)glReplacementCodeubvSUN},
+    {"glReplacementCodeuiColor3fVertex3fSUN", (GLBproc)glReplacementCodeuiColor3fVertex3fSUN},
+    {"glReplacementCodeuiColor3fVertex3fvSUN", (GLBproc)glReplacementCodeuiColor3fVertex3fvSUN},
+    {"glReplacementCodeuiColor4fNormal3fVertex3fSUN", (GLBproc)glReplacementCodeuiColor4fNormal3fVertex3fSUN},
+    {"glReplacementCodeuiColor4fNormal3fVertex3fvSUN", (GLBproc)glReplacementCodeuiColor4fNormal3fVertex3fvSUN},
+    {"glReplacementCodeuiColor4ubVertex3fSUN", (GLBproc)glReplacementCodeuiColor4ubVertex3fSUN},
+    {"glReplacementCodeuiColor4ubVertex3fvSUN", (GLBproc)glReplacementCodeuiColor4ubVertex3fvSUN},
+    {"glReplacementCodeuiNormal3fVertex3fSUN", (GLBproc)glReplacementCodeuiNormal3fVertex3fSUN},
+    {"glReplacementCodeuiNormal3fVertex3fvSUN", (GLBproc)glReplacementCodeuiNormal3fVertex3fvSUN},
+    {"glReplacementCodeuiSUN", (GLBproc)glReplacementCodeuiSUN},
+    {"glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN", (GLBproc)glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN},
+    {"glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN", (GLBproc)glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN},
+    {"glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN", (GLBproc)glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN},
+    {"glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN", (GLBproc)glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN},
+    {"glReplacementCodeuiTexCoord2fVertex3fSUN", (GLBproc)glReplacementCodeuiTexCoord2fVertex3fSUN},
+    {"glReplacementCodeuiTexCoord2fVertex3fvSUN", (GLBproc)glReplacementCodeuiTexCoord2fVertex3fvSUN},
+    {"glReplacementCodeuiVertex3fSUN", (GLBproc)glReplacementCodeuiVertex3fSUN},
+    {"glReplacementCodeuiVertex3fvSUN", (GLBproc)glReplacementCodeuiVertex3fvSUN},
+    {"glReplacementCodeuivSUN", (GLBproc)glReplacementCodeuivSUN},
+    {"glReplacementCodeusSUN", (GLBproc)glReplacementCodeusSUN},
+    {"glReplacementCodeusvSUN", (GLBproc)glReplacementCodeusvSUN},
+    {"glRequestResidentProgramsNV", (GLBproc)glRequestResidentProgramsNV},
+    {"glResetHistogram", (GLBproc)glResetHistogram},
+    {"glResetHistogramEXT", (GLBproc)glResetHistogramEXT},
+    {"glResetMemoryObjectParameterNV", (GLBproc)glResetMemoryObjectParameterNV},
+    {"glResetMinmax", (GLBproc)glResetMinmax},
+    {"glResetMinmaxEXT", (GLBproc)glResetMinmaxEXT},
+    {"glResizeBuffersMESA", (GLBproc)glResizeBuffersMESA},
+    {"glResolveDepthValuesNV", (GLBproc)glResolveDepthValuesNV},
+    {"glResumeTransformFeedback", (GLBproc)glResumeTransformFeedback},
+    {"glResumeTransformFeedbackNV", (GLBproc)glResumeTransformFeedbackNV},
+    {"glRotated", (GLBproc)glRotated},
+    {"glRotatef", (GLBproc)glRotatef},
+    {"glRotatexOES", (GLBproc)glRotatexOES},
+    {"glSampleCoverage", (GLBproc)glSampleCoverage},
+    {"glSampleCoverageARB", (GLBproc)glSampleCoverageARB},
+    {"glSampleCoveragexOES", (GLBproc)glSampleCoveragexOES},
+    {"glSampleMapATI", (GLBproc)glSampleMapATI},
+    {"glSampleMaskEXT", (GLBproc)glSampleMaskEXT},
+    {"glSampleMaskIndexedNV", (GLBproc)glSampleMaskIndexedNV},
+    {"glSampleMaskSGIS", (GLBproc)glSampleMaskSGIS},
+    {"glSampleMaski", (GLBproc)glSampleMaski},
+    {"glSamplePatternEXT", (GLBproc)glSamplePatternEXT},
+    {"glSamplePatternSGIS", (GLBproc)glSamplePatternSGIS},
+    {"glSamplerParameterIiv", (GLBproc)glSamplerParameterIiv},
+    {"glSamplerParameterIuiv", (GLBproc)glSamplerParameterIuiv},
+    {"glSamplerParameterf", (GLBproc)glSamplerParameterf},
+    {"glSamplerParameterfv", (GLBproc)glSamplerParameterfv},
+    {"glSamplerParameteri", (GLBproc)glSamplerParameteri},
+    {"glSamplerParameteriv", (GLBproc)glSamplerParameteriv},
+    {"glScaled", (GLBproc)glScaled},
+    {"glScalef", (GLBproc)glScalef},
+    {"glScalexOES", (GLBproc)glScalexOES},
+    {"glScissor", (GLBproc)glScissor},
+    {"glScissorArrayv", (GLBproc)glScissorArrayv},
+    {"glScissorExclusiveArrayvNV", (GLBproc)glScissorExclusiveArrayvNV},
+    {"glScissorExclusiveNV", (GLBproc)glScissorExclusiveNV},
+    {"glScissorIndexed", (GLBproc)glScissorIndexed},
+    {"glScissorIndexedv", (GLBproc)glScissorIndexedv},
+    {"glSecondaryColor3b", (GLBproc)glSecondaryColor3b},
+    {"glSecondaryColor3bEXT", (GLBproc)glSecondaryColor3bEXT},
+    {"glSecondaryColor3bv", (GLBproc)glSecondaryColor3bv},
+    {"glSecondaryColor3bvEXT", (GLBproc)glSecondaryColor3bvEXT},
+    {"glSecondaryColor3d", (GLBproc)glSecondaryColor3d},
+    {"glSecondaryColor3dEXT", (GLBproc)glSecondaryColor3dEXT},
+    {"glSecondaryColor3dv", (GLBproc)glSecondaryColor3dv},
+    {"glSecondaryColor3dvEXT", (GLBproc)glSecondaryColor3dvEXT},
+    {"glSecondaryColor3f", (GLBproc)glSecondaryColor3f},
+    {"glSecondaryColor3fEXT", (GLBproc)glSecondaryColor3fEXT},
+    {"glSecondaryColor3fv", (GLBproc)glSecondaryColor3fv},
+    {"glSecondaryColor3fvEXT", (GLBproc)glSecondaryColor3fvEXT},
+    {"glSecondaryColor3hNV", (GLBproc)glSecondaryColor3hNV},
+    {"glSecondaryColor3hvNV", (GLBproc)glSecondaryColor3hvNV},
+    {"glSecondaryColor3i", (GLBproc)glSecondaryColor3i},
+    {"glSecondaryColor3iEXT", (GLBproc)glSecondaryColor3iEXT},
+    {"glSecondaryColor3iv", (GLBproc)glSecondaryColor3iv},
+    {"glSecondaryColor3ivEXT", (GLBproc)glSecondaryColor3ivEXT},
+    {"glSecondaryColor3s", (GLBproc)glSecondaryColor3s},
+    {"glSecondaryColor3sEXT", (GLBproc)glSecondaryColor3sEXT},
+    {"glSecondaryColor3sv", (GLBproc)glSecondaryColor3sv},
+    {"glSecondaryColor3svEXT", (GLBproc)glSecondaryColor3svEXT},
+    {"glSecondaryColor3ub", (GLBproc)glSecondaryColor3ub},
+    {"glSecondaryColor3ubEXT", (GLBproc)glSecondaryColor3ubEXT},
+    {"glSecondaryColor3ubv", (GLBproc)glSecondaryColor3ubv},
+    {"glSecondaryColor3ubvEXT", (GLBproc)glSecondaryColor3ubvEXT},
+    {"glSecondaryColor3ui", (GLBproc)glSecondaryColor3ui},
+    {"glSecondaryColor3uiEXT", (GLBproc)glSecondaryColor3uiEXT},
+    {"glSecondaryColor3uiv", (GLBproc)glSecondaryColor3uiv},
+    {"glSecondaryColor3uivEXT", (GLBproc)glSecondaryColor3uivEXT},
+    {"glSecondaryColor3us", (GLBproc)glSecondaryColor3us},
+    {"glSecondaryColor3usEXT", (GLBproc)glSecondaryColor3usEXT},
+    {"glSecondaryColor3usv", (GLBproc)glSecondaryColor3usv},
+    {"glSecondaryColor3usvEXT", (GLBproc)glSecondaryColor3usvEXT},
+    {"glSecondaryColorFormatNV", (GLBproc)glSecondaryColorFormatNV},
+    {"glSecondaryColorP3ui", (GLBproc)glSecondaryColorP3ui},
+    {"glSecondaryColorP3uiv", (GLBproc)glSecondaryColorP3uiv},
+    {"glSecondaryColorPointer", (GLBproc)glSecondaryColorPointer},
+    {"glSecondaryColorPointerEXT", (GLBproc)glSecondaryColorPointerEXT},
+    {"glSecondaryColorPointerListIBM", (GLBproc)glSecondaryColorPointerListIBM},
+    {"glSelectBuffer", (GLBproc)glSelectBuffer},
+    {"glSelectPerfMonitorCountersAMD", (GLBproc)glSelectPerfMonitorCountersAMD},
+    {"glSemaphoreParameterivNV", (GLBproc)glSemaphoreParameterivNV},
+    {"glSemaphoreParameterui64vEXT", (GLBproc)glSemaphoreParameterui64vEXT},
+    {"glSeparableFilter2D", (GLBproc)glSeparableFilter2D},
+    {"glSeparableFilter2DEXT", (GLBproc)glSeparableFilter2DEXT},
+    {"glSetFenceAPPLE", (GLBproc)glSetFenceAPPLE},
+    {"glSetFenceNV", (GLBproc)glSetFenceNV},
+    {"glSetFragmentShaderConstantATI", (GLBproc)glSetFragmentShaderConstantATI},
+    {"glSetInvariantEXT", (GLBproc)glSetInvariantEXT},
+    {"glSetLocalConstantEXT", (GLBproc)glSetLocalConstantEXT},
+    {"glSetMultisamplefvAMD", (GLBproc)glSetMultisamplefvAMD},
+    {"glShadeModel", (GLBproc)glShadeModel},
+    {"glShaderBinary", (GLBproc)glShaderBinary},
+    {"glShaderOp1EXT", (GLBproc)glShaderOp1EXT},
+    {"glShaderOp2EXT", (GLBproc)glShaderOp2EXT},
+    {"glShaderOp3EXT", (GLBproc)glShaderOp3EXT},
+    {"glShaderSource", (GLBproc)glShaderSource},
+    {"glShaderSourceARB", (GLBproc)glShaderSourceARB},
+    {"glShaderStorageBlockBinding", (GLBproc)glShaderStorageBlockBinding},
+    {"glShadingRateImageBarrierNV", (GLBproc)glShadingRateImageBarrierNV},
+    {"glShadingRateImagePaletteNV", (GLBproc)glShadingRateImagePaletteNV},
+    {"glShadingRateSampleOrderCustomNV", (GLBproc)glShadingRateSampleOrderCustomNV},
+    {"glShadingRateSampleOrderNV", (GLBproc)glShadingRateSampleOrderNV},
+    {"glSharpenTexFuncSGIS", (GLBproc)glSharpenTexFuncSGIS},
+    {"glSignalSemaphoreEXT", (GLBproc)glSignalSemaphoreEXT},
+    {"glSignalSemaphoreui64NVX", (GLBproc)glSignalSemaphoreui64NVX},
+    {"glSignalVkFenceNV", (GLBproc)glSignalVkFenceNV},
+    {"glSignalVkSemaphoreNV", (GLBproc)glSignalVkSemaphoreNV},
+    {"glSpecializeShader", (GLBproc)glSpecializeShader},
+    {"glSpecializeShaderARB", (GLBproc)glSpecializeShaderARB},
+    {"glSpriteParameterfSGIX", (GLBproc)glSpriteParameterfSGIX},
+    {"glSpriteParameterfvSGIX", (GLBproc)glSpriteParameterfvSGIX},
+    {"glSpriteParameteriSGIX", (GLBproc)glSpriteParameteriSGIX},
+    {"glSpriteParameterivSGIX", (GLBproc)glSpriteParameterivSGIX},
+    {"glStartInstrumentsSGIX", (GLBproc)glStartInstrumentsSGIX},
+    {"glStateCaptureNV", (GLBproc)glStateCaptureNV},
+    {"glStencilClearTagEXT", (GLBproc)glStencilClearTagEXT},
+    {"glStencilFillPathInstancedNV", (GLBproc)glStencilFillPathInstancedNV},
+    {"glStencilFillPathNV", (GLBproc)glStencilFillPathNV},
+    {"glStencilFunc", (GLBproc)glStencilFunc},
+    {"glStencilFuncSeparate", (GLBproc)glStencilFuncSeparate},
+    {"glStencilFuncSeparateATI", (GLBproc)glStencilFuncSeparateATI},
+    {"glStencilMask", (GLBproc)glStencilMask},
+    {"glStencilMaskSeparate", (GLBproc)glStencilMaskSeparate},
+    {"glStencilOp", (GLBproc)glStencilOp},
+    {"glStencilOpSeparate", (GLBproc)glStencilOpSeparate},
+    {"glStencilOpSeparateATI", (GLBproc)glStencilOpSeparateATI},
+    {"glStencilOpValueAMD", (GLBproc)glStencilOpValueAMD},
+    {"glStencilStrokePathInstancedNV", (GLBproc)glStencilStrokePathInstancedNV},
+    {"glStencilStrokePathNV", (GLBproc)glStencilStrokePathNV},
+    {"glStencilThenCoverFillPathInstancedNV", (GLBproc)glStencilThenCoverFillPathInstancedNV},
+    {"glStencilThenCoverFillPathNV", (GLBproc)glStencilThenCoverFillPathNV},
+    {"glStencilThenCoverStrokePathInstancedNV", (GLBproc)glStencilThenCoverStrokePathInstancedNV},
+    {"glStencilThenCoverStrokePathNV", (GLBproc)glStencilThenCoverStrokePathNV},
+    {"glStopInstrumentsSGIX", (GLBproc)glStopInstrumentsSGIX},
+    {"glStringMarkerGREMEDY", (GLBproc)glStringMarkerGREMEDY},
+    {"glSubpixelPrecisionBiasNV", (GLBproc)glSubpixelPrecisionBiasNV},
+    {"glSwizzleEXT", (GLBproc)glSwizzleEXT},
+    {"glSyncTextureINTEL", (GLBproc)glSyncTextureINTEL},
+    {"glTagSampleBufferSGIX", (GLBproc)glTagSampleBufferSGIX},
+    {"glTangent3bEXT", (GLBproc)glTangent3bEXT},
+    {"glTangent3bvEXT", (GLBproc)glTangent3bvEXT},
+    {"glTangent3dEXT", (GLBproc)glTangent3dEXT},
+    {"glTangent3dvEXT", (GLBproc)glTangent3dvEXT},
+    {"glTangent3fEXT", (GLBproc)glTangent3fEXT},
+    {"glTangent3fvEXT", (GLBproc)glTangent3fvEXT},
+    {"glTangent3iEXT", (GLBproc)glTangent3iEXT},
+    {"glTangent3ivEXT", (GLBproc)glTangent3ivEXT},
+    {"glTangent3sEXT", (GLBproc)glTangent3sEXT},
+    {"glTangent3svEXT", (GLBproc)glTangent3svEXT},
+    {"glTangentPointerEXT", (GLBproc)glTangentPointerEXT},
+    {"glTbufferMask3DFX", (GLBproc)glTbufferMask3DFX},
+    {"glTessellationFactorAMD", (GLBproc)glTessellationFactorAMD},
+    {"glTessellationModeAMD", (GLBproc)glTessellationModeAMD},
+    {"glTestFenceAPPLE", (GLBproc)glTestFenceAPPLE},
+    {"glTestFenceNV", (GLBproc)glTestFenceNV},
+    {"glTestObjectAPPLE", (GLBproc)glTestObjectAPPLE},
+    {"glTexAttachMemoryNV", (GLBproc)glTexAttachMemoryNV},
+    {"glTexBuffer", (GLBproc)glTexBuffer},
+    {"glTexBufferARB", (GLBproc)glTexBufferARB},
+    {"glTexBufferEXT", (GLBproc)glTexBufferEXT},
+    {"glTexBufferRange", (GLBproc)glTexBufferRange},
+    {"glTexBumpParameterfvATI", (GLBproc)glTexBumpParameterfvATI},
+    {"glTexBumpParameterivATI", (GLBproc)glTexBumpParameterivATI},
+    {"glTexCoord1bOES", (GLBproc)glTexCoord1bOES},
+    {"glTexCoord1bvOES", (GLBproc)glTexCoord1bvOES},
+    {"glTexCoord1d", (GLBproc)glTexCoord1d},
+    {"glTexCoord1dv", (GLBproc)glTexCoord1dv},
+    {"glTexCoord1f", (GLBproc)glTexCoord1f},
+    {"glTexCoord1fv", (GLBproc)glTexCoord1fv},
+    {"glTexCoord1hNV", (GLBproc)glTexCoord1hNV},
+    {"glTexCoord1hvNV", (GLBproc)glTexCoord1hvNV},
+    {"glTexCoord1i", (GLBproc)glTexCoord1i},
+    {"glTexCoord1iv", (GLBproc)glTexCoord1iv},
+    {"glTexCoord1s", (GLBproc)glTexCoord1s},
+    {"glTexCoord1sv", (GLBproc)glTexCoord1sv},
+    {"glTexCoord1xOES", (GLBproc)glTexCoord1xOES},
+    {"glTexCoord1xvOES", (GLBproc)glTexCoord1xvOES},
+    {"glTexCoord2bOES", (GLBproc)glTexCoord2bOES},
+    {"glTexCoord2bvOES", (GLBproc)glTexCoord2bvOES},
+    {"glTexCoord2d", (GLBproc)glTexCoord2d},
+    {"glTexCoord2dv", (GLBproc)glTexCoord2dv},
+    {"glTexCoord2f", (GLBproc)glTexCoord2f},
+    {"glTexCoord2fColor3fVertex3fSUN", (GLBproc)glTexCoord2fColor3fVertex3fSUN},
+    {"glTexCoord2fColor3fVertex3fvSUN", (GLBproc)glTexCoord2fColor3fVertex3fvSUN},
+    {"glTexCoord2fColor4fNormal3fVertex3fSUN", (GLBproc)glTexCoord2fColor4fNormal3fVertex3fSUN},
+    {"glTexCoord2fColor4fNormal3fVertex3fvSUN", (GLBproc)glTexCoord2fColor4fNormal3fVertex3fvSUN},
+    {"glTexCoord2fColor4ubVertex3fSUN", (GLBproc)glTexCoord2fColor4ubVertex3fSUN},
+    {"glTexCoord2fColor4ubVertex3fvSUN", (GLBproc)glTexCoord2fColor4ubVertex3fvSUN},
+    {"glTexCoord2fNormal3fVertex3fSUN", (GLBproc)glTexCoord2fNormal3fVertex3fSUN},
+    {"glTexCoord2fNormal3fVertex3fvSUN", (GLBproc)glTexCoord2fNormal3fVertex3fvSUN},
+    {"glTexCoord2fVertex3fSUN", (GLBproc)glTexCoord2fVertex3fSUN},
+    {"glTexCoord2fVertex3fvSUN", (GLBproc)glTexCoord2fVertex3fvSUN},
+    {"glTexCoord2fv", (GLBproc)glTexCoord2fv},
+    {"glTexCoord2hNV", (GLBproc)glTexCoord2hNV},
+    {"glTexCoord2hvNV", (GLBproc)glTexCoord2hvNV},
+    {"glTexCoord2i", (GLBproc)glTexCoord2i},
+    {"glTexCoord2iv", (GLBproc)glTexCoord2iv},
+    {"glTexCoord2s", (GLBproc)glTexCoord2s},
+    {"glTexCoord2sv", (GLBproc)glTexCoord2sv},
+    {"glTexCoord2xOES", (GLBproc)glTexCoord2xOES},
+    {"glTexCoord2xvOES", (GLBproc)glTexCoord2xvOES},
+    {"glTexCoord3bOES", (GLBproc)glTexCoord3bOES},
+    {"glTexCoord3bvOES", (GLBproc)glTexCoord3bvOES},
+    {"glTexCoord3d", (GLBproc)glTexCoord3d},
+    {"glTexCoord3dv", (GLBproc)glTexCoord3dv},
+    {"glTexCoord3f", (GLBproc)glTexCoord3f},
+    {"glTexCoord3fv", (GLBproc)glTexCoord3fv},
+    {"glTexCoord3hNV", (GLBproc)glTexCoord3hNV},
+    {"glTexCoord3hvNV", (GLBproc)glTexCoord3hvNV},
+    {"glTexCoord3i", (GLBproc)glTexCoord3i},
+    {"glTexCoord3iv", (GLBproc)glTexCoord3iv},
+    {"glTexCoord3s", (GLBproc)glTexCoord3s},
+    {"glTexCoord3sv", (GLBproc)glTexCoord3sv},
+    {"glTexCoord3xOES", (GLBproc)glTexCoord3xOES},
+    {"glTexCoord3xvOES", (GLBproc)glTexCoord3xvOES},
+    {"glTexCoord4bOES", (GLBproc)glTexCoord4bOES},
+    {"glTexCoord4bvOES", (GLBproc)glTexCoord4bvOES},
+    {"glTexCoord4d", (GLBproc)glTexCoord4d},
+    {"glTexCoord4dv", (GLBproc)glTexCoord4dv},
+    {"glTexCoord4f", (GLBproc)glTexCoord4f},
+    {"glTexCoord4fColor4fNormal3fVertex4fSUN", (GLBproc)glTexCoord4fColor4fNormal3fVertex4fSUN},
+    {"glTexCoord4fColor4fNormal3fVertex4fvSUN", (GLBproc)glTexCoord4fColor4fNormal3fVertex4fvSUN},
+    {"glTexCoord4fVertex4fSUN", (GLBproc)glTexCoord4fVertex4fSUN},
+    {"glTexCoord4fVertex4fvSUN", (GLBproc)glTexCoord4fVertex4fvSUN},
+    {"glTexCoord4fv", (GLBproc)glTexCoord4fv},
+    {"glTexCoord4hNV", (GLBproc)glTexCoord4hNV},
+    {"glTexCoord4hvNV", (GLBproc)glTexCoord4hvNV},
+    {"glTexCoord4i", (GLBproc)glTexCoord4i},
+    {"glTexCoord4iv", (GLBproc)glTexCoord4iv},
+    {"glTexCoord4s", (GLBproc)glTexCoord4s},
+    {"glTexCoord4sv", (GLBproc)glTexCoord4sv},
+    {"glTexCoord4xOES", (GLBproc)glTexCoord4xOES},
+    {"glTexCoord4xvOES", (GLBproc)glTexCoord4xvOES},
+    {"glTexCoordFormatNV", (GLBproc)glTexCoordFormatNV},
+    {"glTexCoordP1ui", (GLBproc)glTexCoordP1ui},
+    {"glTexCoordP1uiv", (GLBproc)glTexCoordP1uiv},
+    {"glTexCoordP2ui", (GLBproc)glTexCoordP2ui},
+    {"glTexCoordP2uiv", (GLBproc)glTexCoordP2uiv},
+    {"glTexCoordP3ui", (GLBproc)glTexCoordP3ui},
+    {"glTexCoordP3uiv", (GLBproc)glTexCoordP3uiv},
+    {"glTexCoordP4ui", (GLBproc)glTexCoordP4ui},
+    {"glTexCoordP4uiv", (GLBproc)glTexCoordP4uiv},
+    {"glTexCoordPointer", (GLBproc)glTexCoordPointer},
+    {"glTexCoordPointerEXT", (GLBproc)glTexCoordPointerEXT},
+    {"glTexCoordPointerListIBM", (GLBproc)glTexCoordPointerListIBM},
+    {"glTexCoordPointervINTEL", (GLBproc)glTexCoordPointervINTEL},
+    {"glTexEnvf", (GLBproc)glTexEnvf},
+    {"glTexEnvfv", (GLBproc)glTexEnvfv},
+    {"glTexEnvi", (GLBproc)glTexEnvi},
+    {"glTexEnviv", (GLBproc)glTexEnviv},
+    {"glTexEnvxOES", (GLBproc)glTexEnvxOES},
+    {"glTexEnvxvOES", (GLBproc)glTexEnvxvOES},
+    {"glTexFilterFuncSGIS", (GLBproc)glTexFilterFuncSGIS},
+    {"glTexGend", (GLBproc)glTexGend},
+    {"glTexGendv", (GLBproc)glTexGendv},
+    {"glTexGenf", (GLBproc)glTexGenf},
+    {"glTexGenfv", (GLBproc)glTexGenfv},
+    {"glTexGeni", (GLBproc)glTexGeni},
+    {"glTexGeniv", (GLBproc)glTexGeniv},
+    {"glTexGenxOES", (GLBproc)glTexGenxOES},
+    {"glTexGenxvOES", (GLBproc)glTexGenxvOES},
+    {"glTexImage1D", (GLBproc)glTexImage1D},
+    {"glTexImage2D", (GLBproc)glTexImage2D},
+    {"glTexImage2DMultisample", (GLBproc)glTexImage2DMultisample},
+    {"glTexImage2DMultisampleCoverageNV", (GLBproc)glTexImage2DMultisampleCoverageNV},
+    {"glTexImage3D", (GLBproc)glTexImage3D},
+    {"glTexImage3DEXT", (GLBproc)glTexImage3DEXT},
+    {"glTexImage3DMultisample", (GLBproc)glTexImage3DMultisample},
+    {"glTexImage3DMultisampleCoverageNV", (GLBproc)glTexImage3DMultisampleCoverageNV},
+    {"glTexImage4DSGIS", (GLBproc)glTexImage4DSGIS},
+    {"glTexPageCommitmentARB", (GLBproc)glTexPageCommitmentARB},
+    {"glTexPageCommitmentMemNV", (GLBproc)glTexPageCommitmentMemNV},
+    {"glTexParameterIiv", (GLBproc)glTexParameterIiv},
+    {"glTexParameterIivEXT", (GLBproc)glTexParameterIivEXT},
+    {"glTexParameterIuiv", (GLBproc)glTexParameterIuiv},
+    {"glTexParameterIuivEXT", (GLBproc)glTexParameterIuivEXT},
+    {"glTexParameterf", (GLBproc)glTexParameterf},
+    {"glTexParameterfv", (GLBproc)glTexParameterfv},
+    {"glTexParameteri", (GLBproc)glTexParameteri},
+    {"glTexParameteriv", (GLBproc)glTexParameteriv},
+    {"glTexParameterxOES", (GLBproc)glTexParameterxOES},
+    {"glTexParameterxvOES", (GLBproc)glTexParameterxvOES},
+    {"glTexRenderbufferNV", (GLBproc)glTexRenderbufferNV},
+    {"glTexStorage1D", (GLBproc)glTexStorage1D},
+    {"glTexStorage2D", (GLBproc)glTexStorage2D},
+    {"glTexStorage2DMultisample", (GLBproc)glTexStorage2DMultisample},
+    {"glTexStorage3D", (GLBproc)glTexStorage3D},
+    {"glTexStorage3DMultisample", (GLBproc)glTexStorage3DMultisample},
+    {"glTexStorageMem1DEXT", (GLBproc)glTexStorageMem1DEXT},
+    {"glTexStorageMem2DEXT", (GLBproc)glTexStorageMem2DEXT},
+    {"glTexStorageMem2DMultisampleEXT", (GLBproc)glTexStorageMem2DMultisampleEXT},
+    {"glTexStorageMem3DEXT", (GLBproc)glTexStorageMem3DEXT},
+    {"glTexStorageMem3DMultisampleEXT", (GLBproc)glTexStorageMem3DMultisampleEXT},
+    {"glTexStorageSparseAMD", (GLBproc)glTexStorageSparseAMD},
+    {"glTexSubImage1D", (GLBproc)glTexSubImage1D},
+    {"glTexSubImage1DEXT", (GLBproc)glTexSubImage1DEXT},
+    {"glTexSubImage2D", (GLBproc)glTexSubImage2D},
+    {"glTexSubImage2DEXT", (GLBproc)glTexSubImage2DEXT},
+    {"glTexSubImage3D", (GLBproc)glTexSubImage3D},
+    {"glTexSubImage3DEXT", (GLBproc)glTexSubImage3DEXT},
+    {"glTexSubImage4DSGIS", (GLBproc)glTexSubImage4DSGIS},
+    {"glTextureAttachMemoryNV", (GLBproc)glTextureAttachMemoryNV},
+    {"glTextureBarrier", (GLBproc)glTextureBarrier},
+    {"glTextureBarrierNV", (GLBproc)glTextureBarrierNV},
+    {"glTextureBuffer", (GLBproc)glTextureBuffer},
+    {"glTextureBufferEXT", (GLBproc)glTextureBufferEXT},
+    {"glTextureBufferRange", (GLBproc)glTextureBufferRange},
+    {"glTextureBufferRangeEXT", (GLBproc)glTextureBufferRangeEXT},
+    {"glTextureColorMaskSGIS", (GLBproc)glTextureColorMaskSGIS},
+    {"glTextureImage1DEXT", (GLBproc)glTextureImage1DEXT},
+    {"glTextureImage2DEXT", (GLBproc)glTextureImage2DEXT},
+    {"glTextureImage2DMultisampleCoverageNV", (GLBproc)glTextureImage2DMultisampleCoverageNV},
+    {"glTextureImage2DMultisampleNV", (GLBproc)glTextureImage2DMultisampleNV},
+    {"glTextureImage3DEXT", (GLBproc)glTextureImage3DEXT},
+    {"glTextureImage3DMultisampleCoverageNV", (GLBproc)glTextureImage3DMultisampleCoverageNV},
+    {"glTextureImage3DMultisampleNV", (GLBproc)glTextureImage3DMultisampleNV},
+    {"glTextureLightEXT", (GLBproc)glTextureLightEXT},
+    {"glTextureMaterialEXT", (GLBproc)glTextureMaterialEXT},
+    {"glTextureNormalEXT", (GLBproc)glTextureNormalEXT},
+    {"glTexturePageCommitmentEXT", (GLBproc)glTexturePageCommitmentEXT},
+    {"glTexturePageCommitmentMemNV", (GLBproc)glTexturePageCommitmentMemNV},
+    {"glTextureParameterIiv", (GLBproc)glTextureParameterIiv},
+    {"glTextureParameterIivEXT", (GLBproc)glTextureParameterIivEXT},
+    {"glTextureParameterIuiv", (GLBproc)glTextureParameterIuiv},
+    {"glTextureParameterIuivEXT", (GLBproc)glTextureParameterIuivEXT},
+    {"glTextureParameterf", (GLBproc)glTextureParameterf},
+    {"glTextureParameterfEXT", (GLBproc)glTextureParameterfEXT},
+    {"glTextureParameterfv", (GLBproc)glTextureParameterfv},
+    {"glTextureParameterfvEXT", (GLBproc)glTextureParameterfvEXT},
+    {"glTextureParameteri", (GLBproc)glTextureParameteri},
+    {"glTextureParameteriEXT", (GLBproc)glTextureParameteriEXT},
+    {"glTextureParameteriv", (GLBproc)glTextureParameteriv},
+    {"glTextureParameterivEXT", (GLBproc)glTextureParameterivEXT},
+    {"glTextureRangeAPPLE", (GLBproc)glTextureRangeAPPLE},
+    {"glTextureRenderbufferEXT", (GLBproc)glTextureRenderbufferEXT},
+    {"glTextureStorage1D", (GLBproc)glTextureStorage1D},
+    {"glTextureStorage1DEXT", (GLBproc)glTextureStorage1DEXT},
+    {"glTextureStorage2D", (GLBproc)glTextureStorage2D},
+    {"glTextureStorage2DEXT", (GLBproc)glTextureStorage2DEXT},
+    {"glTextureStorage2DMultisample", (GLBproc)glTextureStorage2DMultisample},
+    {"glTextureStorage2DMultisampleEXT", (GLBproc)glTextureStorage2DMultisampleEXT},
+    {"glTextureStorage3D", (GLBproc)glTextureStorage3D},
+    {"glTextureStorage3DEXT", (GLBproc)glTextureStorage3DEXT},
+    {"glTextureStorage3DMultisample", (GLBproc)glTextureStorage3DMultisample},
+    {"glTextureStorage3DMultisampleEXT", (GLBproc)glTextureStorage3DMultisampleEXT},
+    {"glTextureStorageMem1DEXT", (GLBproc)glTextureStorageMem1DEXT},
+    {"glTextureStorageMem2DEXT", (GLBproc)glTextureStorageMem2DEXT},
+    {"glTextureStorageMem2DMultisampleEXT", (GLBproc)glTextureStorageMem2DMultisampleEXT},
+    {"glTextureStorageMem3DEXT", (GLBproc)glTextureStorageMem3DEXT},
+    {"glTextureStorageMem3DMultisampleEXT", (GLBproc)glTextureStorageMem3DMultisampleEXT},
+    {"glTextureStorageSparseAMD", (GLBproc)glTextureStorageSparseAMD},
+    {"glTextureSubImage1D", (GLBproc)glTextureSubImage1D},
+    {"glTextureSubImage1DEXT", (GLBproc)glTextureSubImage1DEXT},
+    {"glTextureSubImage2D", (GLBproc)glTextureSubImage2D},
+    {"glTextureSubImage2DEXT", (GLBproc)glTextureSubImage2DEXT},
+    {"glTextureSubImage3D", (GLBproc)glTextureSubImage3D},
+    {"glTextureSubImage3DEXT", (GLBproc)glTextureSubImage3DEXT},
+    {"glTextureView", (GLBproc)glTextureView},
+    {"glTrackMatrixNV", (GLBproc)glTrackMatrixNV},
+    {"glTransformFeedbackAttribsNV", (GLBproc)glTransformFeedbackAttribsNV},
+    {"glTransformFeedbackBufferBase", (GLBproc)glTransformFeedbackBufferBase},
+    {"glTransformFeedbackBufferRange", (GLBproc)glTransformFeedbackBufferRange},
+    {"glTransformFeedbackStreamAttribsNV", (GLBproc)glTransformFeedbackStreamAttribsNV},
+    {"glTransformFeedbackVaryings", (GLBproc)glTransformFeedbackVaryings},
+    {"glTransformFeedbackVaryingsEXT", (GLBproc)glTransformFeedbackVaryingsEXT},
+    {"glTransformFeedbackVaryingsNV", (GLBproc)glTransformFeedbackVaryingsNV},
+    {"glTransformPathNV", (GLBproc)glTransformPathNV},
+    {"glTranslated", (GLBproc)glTranslated},
+    {"glTranslatef", (GLBproc)glTranslatef},
+    {"glTranslatexOES", (GLBproc)glTranslatexOES},
+    {"glUniform1d", (GLBproc)glUniform1d},
+    {"glUniform1dv", (GLBproc)glUniform1dv},
+    {"glUniform1f", (GLBproc)glUniform1f},
+    {"glUniform1fARB", (GLBproc)glUniform1fARB},
+    {"glUniform1fv", (GLBproc)glUniform1fv},
+    {"glUniform1fvARB", (GLBproc)glUniform1fvARB},
+    {"glUniform1i", (GLBproc)glUniform1i},
+    {"glUniform1i64ARB", (GLBproc)glUniform1i64ARB},
+    {"glUniform1i64NV", (GLBproc)glUniform1i64NV},
+    {"glUniform1i64vARB", (GLBproc)glUniform1i64vARB},
+    {"glUniform1i64vNV", (GLBproc)glUniform1i64vNV},
+    {"glUniform1iARB", (GLBproc)glUniform1iARB},
+    {"glUniform1iv", (GLBproc)glUniform1iv},
+    {"glUniform1ivARB", (GLBproc)glUniform1ivARB},
+    {"glUniform1ui", (GLBproc)glUniform1ui},
+    {"glUniform1ui64ARB", (GLBproc)glUniform1ui64ARB},
+    {"glUniform1ui64NV", (GLBproc)glUniform1ui64NV},
+    {"glUniform1ui64vARB", (GLBproc)glUniform1ui64vARB},
+    {"glUniform1ui64vNV", (GLBproc)glUniform1ui64vNV},
+    {"glUniform1uiEXT", (GLBproc)glUniform1uiEXT},
+    {"glUniform1uiv", (GLBproc)glUniform1uiv},
+    {"glUniform1uivEXT", (GLBproc)glUniform1uivEXT},
+    {"glUniform2d", (GLBproc)glUniform2d},
+    {"glUniform2dv", (GLBproc)glUniform2dv},
+    {"glUniform2f", (GLBproc)glUniform2f},
+    {"glUniform2fARB", (GLBproc)glUniform2fARB},
+    {"glUniform2fv", (GLBproc)glUniform2fv},
+    {"glUniform2fvARB", (GLBproc)glUniform2fvARB},
+    {"glUniform2i", (GLBproc)glUniform2i},
+    {"glUniform2i64ARB", (GLBproc)glUniform2i64ARB},
+    {"glUniform2i64NV", (GLBproc)glUniform2i64NV},
+    {"glUniform2i64vARB", (GLBproc)glUniform2i64vARB},
+    {"glUniform2i64vNV", (GLBproc)glUniform2i64vNV},
+    {"glUniform2iARB", (GLBproc)glUniform2iARB},
+    {"glUniform2iv", (GLBproc)glUniform2iv},
+    {"glUniform2ivARB", (GLBproc)glUniform2ivARB},
+    {"glUniform2ui", (GLBproc)glUniform2ui},
+    {"glUniform2ui64ARB", (GLBproc)glUniform2ui64ARB},
+    {"glUniform2ui64NV", (GLBproc)glUniform2ui64NV},
+    {"glUniform2ui64vARB", (GLBproc)glUniform2ui64vARB},
+    {"glUniform2ui64vNV", (GLBproc)glUniform2ui64vNV},
+    {"glUniform2uiEXT", (GLBproc)glUniform2uiEXT},
+    {"glUniform2uiv", (GLBproc)glUniform2uiv},
+    {"glUniform2uivEXT", (GLBproc)glUniform2uivEXT},
+    {"glUniform3d", (GLBproc)glUniform3d},
+    {"glUniform3dv", (GLBproc)glUniform3dv},
+    {"glUniform3f", (GLBproc)glUniform3f},
+    {"glUniform3fARB", (GLBproc)glUniform3fARB},
+    {"glUniform3fv", (GLBproc)glUniform3fv},
+    {"glUniform3fvARB", (GLBproc)glUniform3fvARB},
+    {"glUniform3i", (GLBproc)glUniform3i},
+    {"glUniform3i64ARB", (GLBproc)glUniform3i64ARB},
+    {"glUniform3i64NV", (GLBproc)glUniform3i64NV},
+    {"glUniform3i64vARB", (GLBproc)glUniform3i64vARB},
+    {"glUniform3i64vNV", (GLBproc)glUniform3i64vNV},
+    {"glUniform3iARB", (GLBproc)glUniform3iARB},
+    {"glUniform3iv", (GLBproc)glUniform3iv},
+    {"glUniform3ivARB", (GLBproc)glUniform3ivARB},
+    {"glUniform3ui", (GLBproc)glUniform3ui},
+    {"glUniform3ui64ARB", (GLBproc)glUniform3ui64ARB},
+    {"glUniform3ui64NV", (GLBproc)glUniform3ui64NV},
+    {"glUniform3ui64vARB", (GLBproc)glUniform3ui64vARB},
+    {"glUniform3ui64vNV", (GLBproc)glUniform3ui64vNV},
+    {"glUniform3uiEXT", (GLBproc)glUniform3uiEXT},
+    {"glUniform3uiv", (GLBproc)glUniform3uiv},
+    {"glUniform3uivEXT", (GLBproc)glUniform3uivEXT},
+    {"glUniform4d", (GLBproc)glUniform4d},
+    {"glUniform4dv", (GLBproc)glUniform4dv},
+    {"glUniform4f", (GLBproc)glUniform4f},
+    {"glUniform4fARB", (GLBproc)glUniform4fARB},
+    {"glUniform4fv", (GLBproc)glUniform4fv},
+    {"glUniform4fvARB", (GLBproc)glUniform4fvARB},
+    {"glUniform4i", (GLBproc)glUniform4i},
+    {"glUniform4i64ARB", (GLBproc)glUniform4i64ARB},
+    {"glUniform4i64NV", (GLBproc)glUniform4i64NV},
+    {"glUniform4i64vARB", (GLBproc)glUniform4i64vARB},
+    {"glUniform4i64vNV", (GLBproc)glUniform4i64vNV},
+    {"glUniform4iARB", (GLBproc)glUniform4iARB},
+    {"glUniform4iv", (GLBproc)glUniform4iv},
+    {"glUniform4ivARB", (GLBproc)glUniform4ivARB},
+    {"glUniform4ui", (GLBproc)glUniform4ui},
+    {"glUniform4ui64ARB", (GLBproc)glUniform4ui64ARB},
+    {"glUniform4ui64NV", (GLBproc)glUniform4ui64NV},
+    {"glUniform4ui64vARB", (GLBproc)glUniform4ui64vARB},
+    {"glUniform4ui64vNV", (GLBproc)glUniform4ui64vNV},
+    {"glUniform4uiEXT", (GLBproc)glUniform4uiEXT},
+    {"glUniform4uiv", (GLBproc)glUniform4uiv},
+    {"glUniform4uivEXT", (GLBproc)glUniform4uivEXT},
+    {"glUniformBlockBinding", (GLBproc)glUniformBlockBinding},
+    {"glUniformBufferEXT", (GLBproc)glUniformBufferEXT},
+    {"glUniformHandleui64ARB", (GLBproc)glUniformHandleui64ARB},
+    {"glUniformHandleui64NV", (GLBproc)glUniformHandleui64NV},
+    {"glUniformHandleui64vARB", (GLBproc)glUniformHandleui64vARB},
+    {"glUniformHandleui64vNV", (GLBproc)glUniformHandleui64vNV},
+    {"glUniformMatrix2dv", (GLBproc)glUniformMatrix2dv},
+    {"glUniformMatrix2fv", (GLBproc)glUniformMatrix2fv},
+    {"glUniformMatrix2fvARB", (GLBproc)glUniformMatrix2fvARB},
+    {"glUniformMatrix2x3dv", (GLBproc)glUniformMatrix2x3dv},
+    {"glUniformMatrix2x3fv", (GLBproc)glUniformMatrix2x3fv},
+    {"glUniformMatrix2x4dv", (GLBproc)glUniformMatrix2x4dv},
+    {"glUniformMatrix2x4fv", (GLBproc)glUniformMatrix2x4fv},
+    {"glUniformMatrix3dv", (GLBproc)glUniformMatrix3dv},
+    {"glUniformMatrix3fv", (GLBproc)glUniformMatrix3fv},
+    {"glUniformMatrix3fvARB", (GLBproc)glUniformMatrix3fvARB},
+    {"glUniformMatrix3x2dv", (GLBproc)glUniformMatrix3x2dv},
+    {"glUniformMatrix3x2fv", (GLBproc)glUniformMatrix3x2fv},
+    {"glUniformMatrix3x4dv", (GLBproc)glUniformMatrix3x4dv},
+    {"glUniformMatrix3x4fv", (GLBproc)glUniformMatrix3x4fv},
+    {"glUniformMatrix4dv", (GLBproc)glUniformMatrix4dv},
+    {"glUniformMatrix4fv", (GLBproc)glUniformMatrix4fv},
+    {"glUniformMatrix4fvARB", (GLBproc)glUniformMatrix4fvARB},
+    {"glUniformMatrix4x2dv", (GLBproc)glUniformMatrix4x2dv},
+    {"glUniformMatrix4x2fv", (GLBproc)glUniformMatrix4x2fv},
+    {"glUniformMatrix4x3dv", (GLBproc)glUniformMatrix4x3dv},
+    {"glUniformMatrix4x3fv", (GLBproc)glUniformMatrix4x3fv},
+    {"glUniformSubroutinesuiv", (GLBproc)glUniformSubroutinesuiv},
+    {"glUniformui64NV", (GLBproc)glUniformui64NV},
+    {"glUniformui64vNV", (GLBproc)glUniformui64vNV},
+    {"glUnlockArraysEXT", (GLBproc)glUnlockArraysEXT},
+    {"glUnmapBuffer", (GLBproc)glUnmapBuffer},
+    {"glUnmapBufferARB", (GLBproc)glUnmapBufferARB},
+    {"glUnmapNamedBuffer", (GLBproc)glUnmapNamedBuffer},
+    {"glUnmapNamedBufferEXT", (GLBproc)glUnmapNamedBufferEXT},
+    {"glUnmapObjectBufferATI", (GLBproc)glUnmapObjectBufferATI},
+    {"glUnmapTexture2DINTEL", (GLBproc)glUnmapTexture2DINTEL},
+    {"glUpdateObjectBufferATI", (GLBproc)glUpdateObjectBufferATI},
+    {"glUploadGpuMaskNVX", (GLBproc)glUploadGpuMaskNVX},
+    {"glUseProgram", (GLBproc)glUseProgram},
+    {"glUseProgramObjectARB", (GLBproc)glUseProgramObjectARB},
+    {"glUseProgramStages", (GLBproc)glUseProgramStages},
+    {"glUseProgramStagesEXT", (GLBproc)glUseProgramStagesEXT},
+    {"glUseShaderProgramEXT", (GLBproc)glUseShaderProgramEXT},
+    {"glVDPAUFiniNV", (GLBproc)glVDPAUFiniNV},
+    {"glVDPAUGetSurfaceivNV", (GLBproc)glVDPAUGetSurfaceivNV},
+    {"glVDPAUInitNV", (GLBproc)glVDPAUInitNV},
+    {"glVDPAUIsSurfaceNV", (GLBproc)glVDPAUIsSurfaceNV},
+    {"glVDPAUMapSurfacesNV", (GLBproc)glVDPAUMapSurfacesNV},
+    {"glVDPAURegisterOutputSurfaceNV", (GLBproc)glVDPAURegisterOutputSurfaceNV},
+    {"glVDPAURegisterVideoSurfaceNV", (GLBproc)glVDPAURegisterVideoSurfaceNV},
+    {"glVDPAURegisterVideoSurfaceWithPictureStructureNV", (GLBproc)glVDPAURegisterVideoSurfaceWithPictureStructureNV},
+    {"glVDPAUSurfaceAccessNV", (GLBproc)glVDPAUSurfaceAccessNV},
+    {"glVDPAUUnmapSurfacesNV", (GLBproc)glVDPAUUnmapSurfacesNV},
+    {"glVDPAUUnregisterSurfaceNV", (GLBproc)glVDPAUUnregisterSurfaceNV},
+    {"glValidateProgram", (GLBproc)glValidateProgram},
+    {"glValidateProgramARB", (GLBproc)glValidateProgramARB},
+    {"glValidateProgramPipeline", (GLBproc)glValidateProgramPipeline},
+    {"glValidateProgramPipelineEXT", (GLBproc)glValidateProgramPipelineEXT},
+    {"glVariantArrayObjectATI", (GLBproc)glVariantArrayObjectATI},
+    {"glVariantPointerEXT", (GLBproc)glVariantPointerEXT},
+    {"glVariantbvEXT", (GLBproc)glVariantbvEXT},
+    {"glVariantdvEXT", (GLBproc)glVariantdvEXT},
+    {"glVariantfvEXT", (GLBproc)glVariantfvEXT},
+    {"glVariantivEXT", (GLBproc)glVariantivEXT},
+    {"glVariantsvEXT", (GLBproc)glVariantsvEXT},
+    {"glVariantubvEXT", (GLBproc)glVariantubvEXT},
+    {"glVariantuivEXT", (GLBproc)glVariantuivEXT},
+    {"glVariantusvEXT", (GLBproc)glVariantusvEXT},
+    {"glVertex2bOES", (GLBproc)glVertex2bOES},
+    {"glVertex2bvOES", (GLBproc)glVertex2bvOES},
+    {"glVertex2d", (GLBproc)glVertex2d},
+    {"glVertex2dv", (GLBproc)glVertex2dv},
+    {"glVertex2f", (GLBproc)glVertex2f},
+    {"glVertex2fv", (GLBproc)glVertex2fv},
+    {"glVertex2hNV", (GLBproc)glVertex2hNV},
+    {"glVertex2hvNV", (GLBproc)glVertex2hvNV},
+    {"glVertex2i", (GLBproc)glVertex2i},
+    {"glVertex2iv", (GLBproc)glVertex2iv},
+    {"glVertex2s", (GLBproc)glVertex2s},
+    {"glVertex2sv", (GLBproc)glVertex2sv},
+    {"glVertex2xOES", (GLBproc)glVertex2xOES},
+    {"glVertex2xvOES", (GLBproc)glVertex2xvOES},
+    {"glVertex3bOES", (GLBproc)glVertex3bOES},
+    {"glVertex3bvOES", (GLBproc)glVertex3bvOES},
+    {"glVertex3d", (GLBproc)glVertex3d},
+    {"glVertex3dv", (GLBproc)glVertex3dv},
+    {"glVertex3f", (GLBproc)glVertex3f},
+    {"glVertex3fv", (GLBproc)glVertex3fv},
+    {"glVertex3hNV", (GLBproc)glVertex3hNV},
+    {"glVertex3hvNV", (GLBproc)glVertex3hvNV},
+    {"glVertex3i", (GLBproc)glVertex3i},
+    {"glVertex3iv", (GLBproc)glVertex3iv},
+    {"glVertex3s", (GLBproc)glVertex3s},
+    {"glVertex3sv", (GLBproc)glVertex3sv},
+    {"glVertex3xOES", (GLBproc)glVertex3xOES},
+    {"glVertex3xvOES", (GLBproc)glVertex3xvOES},
+    {"glVertex4bOES", (GLBproc)glVertex4bOES},
+    {"glVertex4bvOES", (GLBproc)glVertex4bvOES},
+    {"glVertex4d", (GLBproc)glVertex4d},
+    {"glVertex4dv", (GLBproc)glVertex4dv},
+    {"glVertex4f", (GLBproc)glVertex4f},
+    {"glVertex4fv", (GLBproc)glVertex4fv},
+    {"glVertex4hNV", (GLBproc)glVertex4hNV},
+    {"glVertex4hvNV", (GLBproc)glVertex4hvNV},
+    {"glVertex4i", (GLBproc)glVertex4i},
+    {"glVertex4iv", (GLBproc)glVertex4iv},
+    {"glVertex4s", (GLBproc)glVertex4s},
+    {"glVertex4sv", (GLBproc)glVertex4sv},
+    {"glVertex4xOES", (GLBproc)glVertex4xOES},
+    {"glVertex4xvOES", (GLBproc)glVertex4xvOES},
+    {"glVertexArrayAttribBinding", (GLBproc)glVertexArrayAttribBinding},
+    {"glVertexArrayAttribFormat", (GLBproc)glVertexArrayAttribFormat},
+    {"glVertexArrayAttribIFormat", (GLBproc)glVertexArrayAttribIFormat},
+    {"glVertexArrayAttribLFormat", (GLBproc)glVertexArrayAttribLFormat},
+    {"glVertexArrayBindVertexBufferEXT", (GLBproc)glVertexArrayBindVertexBufferEXT},
+    {"glVertexArrayBindingDivisor", (GLBproc)glVertexArrayBindingDivisor},
+    {"glVertexArrayColorOffsetEXT", (GLBproc)glVertexArrayColorOffsetEXT},
+    {"glVertexArrayEdgeFlagOffsetEXT", (GLBproc)glVertexArrayEdgeFlagOffsetEXT},
+    {"glVertexArrayElementBuffer", (GLBproc)glVertexArrayElementBuffer},
+    {"glVertexArrayFogCoordOffsetEXT", (GLBproc)glVertexArrayFogCoordOffsetEXT},
+    {"glVertexArrayIndexOffsetEXT", (GLBproc)glVertexArrayIndexOffsetEXT},
+    {"glVertexArrayMultiTexCoordOffsetEXT", (GLBproc)glVertexArrayMultiTexCoordOffsetEXT},
+    {"glVertexArrayNormalOffsetEXT", (GLBproc)glVertexArrayNormalOffsetEXT},
+    {"glVertexArrayParameteriAPPLE", (GLBproc)glVertexArrayParameteriAPPLE},
+    {"glVertexArrayRangeAPPLE", (GLBproc)glVertexArrayRangeAPPLE},
+    {"glVertexArrayRangeNV", (GLBproc)glVertexArrayRangeNV},
+    {"glVertexArraySecondaryColorOffsetEXT", (GLBproc)glVertexArraySecondaryColorOffsetEXT},
+    {"glVertexArrayTexCoordOffsetEXT", (GLBproc)glVertexArrayTexCoordOffsetEXT},
+    {"glVertexArrayVertexAttribBindingEXT", (GLBproc)glVertexArrayVertexAttribBindingEXT},
+    {"glVertexArrayVertexAttribDivisorEXT", (GLBproc)glVertexArrayVertexAttribDivisorEXT},
+    {"glVertexArrayVertexAttribFormatEXT", (GLBproc)glVertexArrayVertexAttribFormatEXT},
+    {"glVertexArrayVertexAttribIFormatEXT", (GLBproc)glVertexArrayVertexAttribIFormatEXT},
+    {"glVertexArrayVertexAttribIOffsetEXT", (GLBproc)glVertexArrayVertexAttribIOffsetEXT},
+    {"glVertexArrayVertexAttribLFormatEXT", (GLBproc)glVertexArrayVertexAttribLFormatEXT},
+    {"glVertexArrayVertexAttribLOffsetEXT", (GLBproc)glVertexArrayVertexAttribLOffsetEXT},
+    {"glVertexArrayVertexAttribOffsetEXT", (GLBproc)glVertexArrayVertexAttribOffsetEXT},
+    {"glVertexArrayVertexBindingDivisorEXT", (GLBproc)glVertexArrayVertexBindingDivisorEXT},
+    {"glVertexArrayVertexBuffer", (GLBproc)glVertexArrayVertexBuffer},
+    {"glVertexArrayVertexBuffers", (GLBproc)glVertexArrayVertexBuffers},
+    {"glVertexArrayVertexOffsetEXT", (GLBproc)glVertexArrayVertexOffsetEXT},
+    {"glVertexAttrib1d", (GLBproc)glVertexAttrib1d},
+    {"glVertexAttrib1dARB", (GLBproc)glVertexAttrib1dARB},
+    {"glVertexAttrib1dNV", (GLBproc)glVertexAttrib1dNV},
+    {"glVertexAttrib1dv", (GLBproc)glVertexAttrib1dv},
+    {"glVertexAttrib1dvARB", (GLBproc)glVertexAttrib1dvARB},
+    {"glVertexAttrib1dvNV", (GLBproc)glVertexAttrib1dvNV},
+    {"glVertexAttrib1f", (GLBproc)glVertexAttrib1f},
+    {"glVertexAttrib1fARB", (GLBproc)glVertexAttrib1fARB},
+    {"glVertexAttrib1fNV", (GLBproc)glVertexAttrib1fNV},
+    {"glVertexAttrib1fv", (GLBproc)glVertexAttrib1fv},
+    {"glVertexAttrib1fvARB", (GLBproc)glVertexAttrib1fvARB},
+    {"glVertexAttrib1fvNV", (GLBproc)glVertexAttrib1fvNV},
+    {"glVertexAttrib1hNV", (GLBproc)glVertexAttrib1hNV},
+    {"glVertexAttrib1hvNV", (GLBproc)glVertexAttrib1hvNV},
+    {"glVertexAttrib1s", (GLBproc)glVertexAttrib1s},
+    {"glVertexAttrib1sARB", (GLBproc)glVertexAttrib1sARB},
+    {"glVertexAttrib1sNV", (GLBproc)glVertexAttrib1sNV},
+    {"glVertexAttrib1sv", (GLBproc)glVertexAttrib1sv},
+    {"glVertexAttrib1svARB", (GLBproc)glVertexAttrib1svARB},
+    {"glVertexAttrib1svNV", (GLBproc)glVertexAttrib1svNV},
+    {"glVertexAttrib2d", (GLBproc)glVertexAttrib2d},
+    {"glVertexAttrib2dARB", (GLBproc)glVertexAttrib2dARB},
+    {"glVertexAttrib2dNV", (GLBproc)glVertexAttrib2dNV},
+    {"glVertexAttrib2dv", (GLBproc)glVertexAttrib2dv},
+    {"glVertexAttrib2dvARB", (GLBproc)glVertexAttrib2dvARB},
+    {"glVertexAttrib2dvNV", (GLBproc)glVertexAttrib2dvNV},
+    {"glVertexAttrib2f", (GLBproc)glVertexAttrib2f},
+    {"glVertexAttrib2fARB", (GLBproc)glVertexAttrib2fARB},
+    {"glVertexAttrib2fNV", (GLBproc)glVertexAttrib2fNV},
+    {"glVertexAttrib2fv", (GLBproc)glVertexAttrib2fv},
+    {"glVertexAttrib2fvARB", (GLBproc)glVertexAttrib2fvARB},
+    {"glVertexAttrib2fvNV", (GLBproc)glVertexAttrib2fvNV},
+    {"glVertexAttrib2hNV", (GLBproc)glVertexAttrib2hNV},
+    {"glVertexAttrib2hvNV", (GLBproc)glVertexAttrib2hvNV},
+    {"glVertexAttrib2s", (GLBproc)glVertexAttrib2s},
+    {"glVertexAttrib2sARB", (GLBproc)glVertexAttrib2sARB},
+    {"glVertexAttrib2sNV", (GLBproc)glVertexAttrib2sNV},
+    {"glVertexAttrib2sv", (GLBproc)glVertexAttrib2sv},
+    {"glVertexAttrib2svARB", (GLBproc)glVertexAttrib2svARB},
+    {"glVertexAttrib2svNV", (GLBproc)glVertexAttrib2svNV},
+    {"glVertexAttrib3d", (GLBproc)glVertexAttrib3d},
+    {"glVertexAttrib3dARB", (GLBproc)glVertexAttrib3dARB},
+    {"glVertexAttrib3dNV", (GLBproc)glVertexAttrib3dNV},
+    {"glVertexAttrib3dv", (GLBproc)glVertexAttrib3dv},
+    {"glVertexAttrib3dvARB", (GLBproc)glVertexAttrib3dvARB},
+    {"glVertexAttrib3dvNV", (GLBproc)glVertexAttrib3dvNV},
+    {"glVertexAttrib3f", (GLBproc)glVertexAttrib3f},
+    {"glVertexAttrib3fARB", (GLBproc)glVertexAttrib3fARB},
+    {"glVertexAttrib3fNV", (GLBproc)glVertexAttrib3fNV},
+    {"glVertexAttrib3fv", (GLBproc)glVertexAttrib3fv},
+    {"glVertexAttrib3fvARB", (GLBproc)glVertexAttrib3fvARB},
+    {"glVertexAttrib3fvNV", (GLBproc)glVertexAttrib3fvNV},
+    {"glVertexAttrib3hNV", (GLBproc)glVertexAttrib3hNV},
+    {"glVertexAttrib3hvNV", (GLBproc)glVertexAttrib3hvNV},
+    {"glVertexAttrib3s", (GLBproc)glVertexAttrib3s},
+    {"glVertexAttrib3sARB", (GLBproc)glVertexAttrib3sARB},
+    {"glVertexAttrib3sNV", (GLBproc)glVertexAttrib3sNV},
+    {"glVertexAttrib3sv", (GLBproc)glVertexAttrib3sv},
+    {"glVertexAttrib3svARB", (GLBproc)glVertexAttrib3svARB},
+    {"glVertexAttrib3svNV", (GLBproc)glVertexAttrib3svNV},
+    {"glVertexAttrib4Nbv", (GLBproc)glVertexAttrib4Nbv},
+    {"glVertexAttrib4NbvARB", (GLBproc)glVertexAttrib4NbvARB},
+    {"glVertexAttrib4Niv", (GLBproc)glVertexAttrib4Niv},
+    {"glVertexAttrib4NivARB", (GLBproc)glVertexAttrib4NivARB},
+    {"glVertexAttrib4Nsv", (GLBproc)glVertexAttrib4Nsv},
+    {"glVertexAttrib4NsvARB", (GLBproc)glVertexAttrib4NsvARB},
+    {"glVertexAttrib4Nub", (GLBproc)glVertexAttrib4Nub},
+    {"glVertexAttrib4NubARB", (GLBproc)glVertexAttrib4NubARB},
+    {"glVertexAttrib4Nubv", (GLBproc)glVertexAttrib4Nubv},
+    {"glVertexAttrib4NubvARB", (GLBproc)glVertexAttrib4NubvARB},
+    {"glVertexAttrib4Nuiv", (GLBproc)glVertexAttrib4Nuiv},
+    {"glVertexAttrib4NuivARB", (GLBproc)glVertexAttrib4NuivARB},
+    {"glVertexAttrib4Nusv", (GLBproc)glVertexAttrib4Nusv},
+    {"glVertexAttrib4NusvARB", (GLBproc)glVertexAttrib4NusvARB},
+    {"glVertexAttrib4bv", (GLBproc)glVertexAttrib4bv},
+    {"glVertexAttrib4bvARB", (GLBproc)glVertexAttrib4bvARB},
+    {"glVertexAttrib4d", (GLBproc)glVertexAttrib4d},
+    {"glVertexAttrib4dARB", (GLBproc)glVertexAttrib4dARB},
+    {"glVertexAttrib4dNV", (GLBproc)glVertexAttrib4dNV},
+    {"glVertexAttrib4dv", (GLBproc)glVertexAttrib4dv},
+    {"glVertexAttrib4dvARB", (GLBproc)glVertexAttrib4dvARB},
+    {"glVertexAttrib4dvNV", (GLBproc)glVertexAttrib4dvNV},
+    {"glVertexAttrib4f", (GLBproc)glVertexAttrib4f},
+    {"glVertexAttrib4fARB", (GLBproc)glVertexAttrib4fARB},
+    {"glVertexAttrib4fNV", (GLBproc)glVertexAttrib4fNV},
+    {"glVertexAttrib4fv", (GLBproc)glVertexAttrib4fv},
+    {"glVertexAttrib4fvARB", (GLBproc)glVertexAttrib4fvARB},
+    {"glVertexAttrib4fvNV", (GLBproc)glVertexAttrib4fvNV},
+    {"glVertexAttrib4hNV", (GLBproc)glVertexAttrib4hNV},
+    {"glVertexAttrib4hvNV", (GLBproc)glVertexAttrib4hvNV},
+    {"glVertexAttrib4iv", (GLBproc)glVertexAttrib4iv},
+    {"glVertexAttrib4ivARB", (GLBproc)glVertexAttrib4ivARB},
+    {"glVertexAttrib4s", (GLBproc)glVertexAttrib4s},
+    {"glVertexAttrib4sARB", (GLBproc)glVertexAttrib4sARB},
+    {"glVertexAttrib4sNV", (GLBproc)glVertexAttrib4sNV},
+    {"glVertexAttrib4sv", (GLBproc)glVertexAttrib4sv},
+    {"glVertexAttrib4svARB", (GLBproc)glVertexAttrib4svARB},
+    {"glVertexAttrib4svNV", (GLBproc)glVertexAttrib4svNV},
+    {"glVertexAttrib4ubNV", (GLBproc)glVertexAttrib4ubNV},
+    {"glVertexAttrib4ubv", (GLBproc)glVertexAttrib4ubv},
+    {"glVertexAttrib4ubvARB", (GLBproc)glVertexAttrib4ubvARB},
+    {"glVertexAttrib4ubvNV", (GLBproc)glVertexAttrib4ubvNV},
+    {"glVertexAttrib4uiv", (GLBproc)glVertexAttrib4uiv},
+    {"glVertexAttrib4uivARB", (GLBproc)glVertexAttrib4uivARB},
+    {"glVertexAttrib4usv", (GLBproc)glVertexAttrib4usv},
+    {"glVertexAttrib4usvARB", (GLBproc)glVertexAttrib4usvARB},
+    {"glVertexAttribArrayObjectATI", (GLBproc)glVertexAttribArrayObjectATI},
+    {"glVertexAttribBinding", (GLBproc)glVertexAttribBinding},
+    {"glVertexAttribDivisor", (GLBproc)glVertexAttribDivisor},
+    {"glVertexAttribDivisorARB", (GLBproc)glVertexAttribDivisorARB},
+    {"glVertexAttribFormat", (GLBproc)glVertexAttribFormat},
+    {"glVertexAttribFormatNV", (GLBproc)glVertexAttribFormatNV},
+    {"glVertexAttribI1i", (GLBproc)glVertexAttribI1i},
+    {"glVertexAttribI1iEXT", (GLBproc)glVertexAttribI1iEXT},
+    {"glVertexAttribI1iv", (GLBproc)glVertexAttribI1iv},
+    {"glVertexAttribI1ivEXT", (GLBproc)glVertexAttribI1ivEXT},
+    {"glVertexAttribI1ui", (GLBproc)glVertexAttribI1ui},
+    {"glVertexAttribI1uiEXT", (GLBproc)glVertexAttribI1uiEXT},
+    {"glVertexAttribI1uiv", (GLBproc)glVertexAttribI1uiv},
+    {"glVertexAttribI1uivEXT", (GLBproc)glVertexAttribI1uivEXT},
+    {"glVertexAttribI2i", (GLBproc)glVertexAttribI2i},
+    {"glVertexAttribI2iEXT", (GLBproc)glVertexAttribI2iEXT},
+    {"glVertexAttribI2iv", (GLBproc)glVertexAttribI2iv},
+    {"glVertexAttribI2ivEXT", (GLBproc)glVertexAttribI2ivEXT},
+    {"glVertexAttribI2ui", (GLBproc)glVertexAttribI2ui},
+    {"glVertexAttribI2uiEXT", (GLBproc)glVertexAttribI2uiEXT},
+    {"glVertexAttribI2uiv", (GLBproc)glVertexAttribI2uiv},
+    {"glVertexAttribI2uivEXT", (GLBproc)glVertexAttribI2uivEXT},
+    {"glVertexAttribI3i", (GLBproc)glVertexAttribI3i},
+    {"glVertexAttribI3iEXT", (GLBproc)glVertexAttribI3iEXT},
+    {"glVertexAttribI3iv", (GLBproc)glVertexAttribI3iv},
+    {"glVertexAttribI3ivEXT", (GLBproc)glVertexAttribI3ivEXT},
+    {"glVertexAttribI3ui", (GLBproc)glVertexAttribI3ui},
+    {"glVertexAttribI3uiEXT", (GLBproc)glVertexAttribI3uiEXT},
+    {"glVertexAttribI3uiv", (GLBproc)glVertexAttribI3uiv},
+    {"glVertexAttribI3uivEXT", (GLBproc)glVertexAttribI3uivEXT},
+    {"glVertexAttribI4bv", (GLBproc)glVertexAttribI4bv},
+    {"glVertexAttribI4bvEXT", (GLBproc)glVertexAttribI4bvEXT},
+    {"glVertexAttribI4i", (GLBproc)glVertexAttribI4i},
+    {"glVertexAttribI4iEXT", (GLBproc)glVertexAttribI4iEXT},
+    {"glVertexAttribI4iv", (GLBproc)glVertexAttribI4iv},
+    {"glVertexAttribI4ivEXT", (GLBproc)glVertexAttribI4ivEXT},
+    {"glVertexAttribI4sv", (GLBproc)glVertexAttribI4sv},
+    {"glVertexAttribI4svEXT", (GLBproc)glVertexAttribI4svEXT},
+    {"glVertexAttribI4ubv", (GLBproc)glVertexAttribI4ubv},
+    {"glVertexAttribI4ubvEXT", (GLBproc)glVertexAttribI4ubvEXT},
+    {"glVertexAttribI4ui", (GLBproc)glVertexAttribI4ui},
+    {"glVertexAttribI4uiEXT", (GLBproc)glVertexAttribI4uiEXT},
+    {"glVertexAttribI4uiv", (GLBproc)glVertexAttribI4uiv},
+    {"glVertexAttribI4uivEXT", (GLBproc)glVertexAttribI4uivEXT},
+    {"glVertexAttribI4usv", (GLBproc)glVertexAttribI4usv},
+    {"glVertexAttribI4usvEXT", (GLBproc)glVertexAttribI4usvEXT},
+    {"glVertexAttribIFormat", (GLBproc)glVertexAttribIFormat},
+    {"glVertexAttribIFormatNV", (GLBproc)glVertexAttribIFormatNV},
+    {"glVertexAttribIPointer", (GLBproc)glVertexAttribIPointer},
+    {"glVertexAttribIPointerEXT", (GLBproc)glVertexAttribIPointerEXT},
+    {"glVertexAttribL1d", (GLBproc)glVertexAttribL1d},
+    {"glVertexAttribL1dEXT", (GLBproc)glVertexAttribL1dEXT},
+    {"glVertexAttribL1dv", (GLBproc)glVertexAttribL1dv},
+    {"glVertexAttribL1dvEXT", (GLBproc)glVertexAttribL1dvEXT},
+    {"glVertexAttribL1i64NV", (GLBproc)glVertexAttribL1i64NV},
+    {"glVertexAttribL1i64vNV", (GLBproc)glVertexAttribL1i64vNV},
+    {"glVertexAttribL1ui64ARB", (GLBproc)glVertexAttribL1ui64ARB},
+    {"glVertexAttribL1ui64NV", (GLBproc)glVertexAttribL1ui64NV},
+    {"glVertexAttribL1ui64vARB", (GLBproc)glVertexAttribL1ui64vARB},
+    {"glVertexAttribL1ui64vNV", (GLBproc)glVertexAttribL1ui64vNV},
+    {"glVertexAttribL2d", (GLBproc)glVertexAttribL2d},
+    {"glVertexAttribL2dEXT", (GLBproc)glVertexAttribL2dEXT},
+    {"glVertexAttribL2dv", (GLBproc)glVertexAttribL2dv},
+    {"glVertexAttribL2dvEXT", (GLBproc)glVertexAttribL2dvEXT},
+    {"glVertexAttribL2i64NV", (GLBproc)glVertexAttribL2i64NV},
+    {"glVertexAttribL2i64vNV", (GLBproc)glVertexAttribL2i64vNV},
+    {"glVertexAttribL2ui64NV", (GLBproc)glVertexAttribL2ui64NV},
+    {"glVertexAttribL2ui64vNV", (GLBproc)glVertexAttribL2ui64vNV},
+    {"glVertexAttribL3d", (GLBproc)glVertexAttribL3d},
+    {"glVertexAttribL3dEXT", (GLBproc)glVertexAttribL3dEXT},
+    {"glVertexAttribL3dv", (GLBproc)glVertexAttribL3dv},
+    {"glVertexAttribL3dvEXT", (GLBproc)glVertexAttribL3dvEXT},
+    {"glVertexAttribL3i64NV", (GLBproc)glVertexAttribL3i64NV},
+    {"glVertexAttribL3i64vNV", (GLBproc)glVertexAttribL3i64vNV},
+    {"glVertexAttribL3ui64NV", (GLBproc)glVertexAttribL3ui64NV},
+    {"glVertexAttribL3ui64vNV", (GLBproc)glVertexAttribL3ui64vNV},
+    {"glVertexAttribL4d", (GLBproc)glVertexAttribL4d},
+    {"glVertexAttribL4dEXT", (GLBproc)glVertexAttribL4dEXT},
+    {"glVertexAttribL4dv", (GLBproc)glVertexAttribL4dv},
+    {"glVertexAttribL4dvEXT", (GLBproc)glVertexAttribL4dvEXT},
+    {"glVertexAttribL4i64NV", (GLBproc)glVertexAttribL4i64NV},
+    {"glVertexAttribL4i64vNV", (GLBproc)glVertexAttribL4i64vNV},
+    {"glVertexAttribL4ui64NV", (GLBproc)glVertexAttribL4ui64NV},
+    {"glVertexAttribL4ui64vNV", (GLBproc)glVertexAttribL4ui64vNV},
+    {"glVertexAttribLFormat", (GLBproc)glVertexAttribLFormat},
+    {"glVertexAttribLFormatNV", (GLBproc)glVertexAttribLFormatNV},
+    {"glVertexAttribLPointer", (GLBproc)glVertexAttribLPointer},
+    {"glVertexAttribLPointerEXT", (GLBproc)glVertexAttribLPointerEXT},
+    {"glVertexAttribP1ui", (GLBproc)glVertexAttribP1ui},
+    {"glVertexAttribP1uiv", (GLBproc)glVertexAttribP1uiv},
+    {"glVertexAttribP2ui", (GLBproc)glVertexAttribP2ui},
+    {"glVertexAttribP2uiv", (GLBproc)glVertexAttribP2uiv},
+    {"glVertexAttribP3ui", (GLBproc)glVertexAttribP3ui},
+    {"glVertexAttribP3uiv", (GLBproc)glVertexAttribP3uiv},
+    {"glVertexAttribP4ui", (GLBproc)glVertexAttribP4ui},
+    {"glVertexAttribP4uiv", (GLBproc)glVertexAttribP4uiv},
+    {"glVertexAttribParameteriAMD", (GLBproc)glVertexAttribParameteriAMD},
+    {"glVertexAttribPointer", (GLBproc)glVertexAttribPointer},
+    {"glVertexAttribPointerARB", (GLBproc)glVertexAttribPointerARB},
+    {"glVertexAttribPointerNV", (GLBproc)glVertexAttribPointerNV},
+    {"glVertexAttribs1dvNV", (GLBproc)glVertexAttribs1dvNV},
+    {"glVertexAttribs1fvNV", (GLBproc)glVertexAttribs1fvNV},
+    {"glVertexAttribs1hvNV", (GLBproc)glVertexAttribs1hvNV},
+    {"glVertexAttribs1svNV", (GLBproc)glVertexAttribs1svNV},
+    {"glVertexAttribs2dvNV", (GLBproc)glVertexAttribs2dvNV},
+    {"glVertexAttribs2fvNV", (GLBproc)glVertexAttribs2fvNV},
+    {"glVertexAttribs2hvNV", (GLBproc)glVertexAttribs2hvNV},
+    {"glVertexAttribs2svNV", (GLBproc)glVertexAttribs2svNV},
+    {"glVertexAttribs3dvNV", (GLBproc)glVertexAttribs3dvNV},
+    {"glVertexAttribs3fvNV", (GLBproc)glVertexAttribs3fvNV},
+    {"glVertexAttribs3hvNV", (GLBproc)glVertexAttribs3hvNV},
+    {"glVertexAttribs3svNV", (GLBproc)glVertexAttribs3svNV},
+    {"glVertexAttribs4dvNV", (GLBproc)glVertexAttribs4dvNV},
+    {"glVertexAttribs4fvNV", (GLBproc)glVertexAttribs4fvNV},
+    {"glVertexAttribs4hvNV", (GLBproc)glVertexAttribs4hvNV},
+    {"glVertexAttribs4svNV", (GLBproc)glVertexAttribs4svNV},
+    {"glVertexAttribs4ubvNV", (GLBproc)glVertexAttribs4ubvNV},
+    {"glVertexBindingDivisor", (GLBproc)glVertexBindingDivisor},
+    {"glVertexBlendARB", (GLBproc)glVertexBlendARB},
+    {"glVertexBlendEnvfATI", (GLBproc)glVertexBlendEnvfATI},
+    {"glVertexBlendEnviATI", (GLBproc)glVertexBlendEnviATI},
+    {"glVertexFormatNV", (GLBproc)glVertexFormatNV},
+    {"glVertexP2ui", (GLBproc)glVertexP2ui},
+    {"glVertexP2uiv", (GLBproc)glVertexP2uiv},
+    {"glVertexP3ui", (GLBproc)glVertexP3ui},
+    {"glVertexP3uiv", (GLBproc)glVertexP3uiv},
+    {"glVertexP4ui", (GLBproc)glVertexP4ui},
+    {"glVertexP4uiv", (GLBproc)glVertexP4uiv},
+    {"glVertexPointer", (GLBproc)glVertexPointer},
+    {"glVertexPointerEXT", (GLBproc)glVertexPointerEXT},
+    {"glVertexPointerListIBM", (GLBproc)glVertexPointerListIBM},
+    {"glVertexPointervINTEL", (GLBproc)glVertexPointervINTEL},
+    {"glVertexStream1dATI", (GLBproc)glVertexStream1dATI},
+    {"glVertexStream1dvATI", (GLBproc)glVertexStream1dvATI},
+    {"glVertexStream1fATI", (GLBproc)glVertexStream1fATI},
+    {"glVertexStream1fvATI", (GLBproc)glVertexStream1fvATI},
+    {"glVertexStream1iATI", (GLBproc)glVertexStream1iATI},
+    {"glVertexStream1ivATI", (GLBproc)glVertexStream1ivATI},
+    {"glVertexStream1sATI", (GLBproc)glVertexStream1sATI},
+    {"glVertexStream1svATI", (GLBproc)glVertexStream1svATI},
+    {"glVertexStream2dATI", (GLBproc)glVertexStream2dATI},
+    {"glVertexStream2dvATI", (GLBproc)glVertexStream2dvATI},
+    {"glVertexStream2fATI", (GLBproc)glVertexStream2fATI},
+    {"glVertexStream2fvATI", (GLBproc)glVertexStream2fvATI},
+    {"glVertexStream2iATI", (GLBproc)glVertexStream2iATI},
+    {"glVertexStream2ivATI", (GLBproc)glVertexStream2ivATI},
+    {"glVertexStream2sATI", (GLBproc)glVertexStream2sATI},
+    {"glVertexStream2svATI", (GLBproc)glVertexStream2svATI},
+    {"glVertexStream3dATI", (GLBproc)glVertexStream3dATI},
+    {"glVertexStream3dvATI", (GLBproc)glVertexStream3dvATI},
+    {"glVertexStream3fATI", (GLBproc)glVertexStream3fATI},
+    {"glVertexStream3fvATI", (GLBproc)glVertexStream3fvATI},
+    {"glVertexStream3iATI", (GLBproc)glVertexStream3iATI},
+    {"glVertexStream3ivATI", (GLBproc)glVertexStream3ivATI},
+    {"glVertexStream3sATI", (GLBproc)glVertexStream3sATI},
+    {"glVertexStream3svATI", (GLBproc)glVertexStream3svATI},
+    {"glVertexStream4dATI", (GLBproc)glVertexStream4dATI},
+    {"glVertexStream4dvATI", (GLBproc)glVertexStream4dvATI},
+    {"glVertexStream4fATI", (GLBproc)glVertexStream4fATI},
+    {"glVertexStream4fvATI", (GLBproc)glVertexStream4fvATI},
+    {"glVertexStream4iATI", (GLBproc)glVertexStream4iATI},
+    {"glVertexStream4ivATI", (GLBproc)glVertexStream4ivATI},
+    {"glVertexStream4sATI", (GLBproc)glVertexStream4sATI},
+    {"glVertexStream4svATI", (GLBproc)glVertexStream4svATI},
+    {"glVertexWeightPointerEXT", (GLBproc)glVertexWeightPointerEXT},
+    {"glVertexWeightfEXT", (GLBproc)glVertexWeightfEXT},
+    {"glVertexWeightfvEXT", (GLBproc)glVertexWeightfvEXT},
+    {"glVertexWeighthNV", (GLBproc)glVertexWeighthNV},
+    {"glVertexWeighthvNV", (GLBproc)glVertexWeighthvNV},
+    {"glVideoCaptureNV", (GLBproc)glVideoCaptureNV},
+    {"glVideoCaptureStreamParameterdvNV", (GLBproc)glVideoCaptureStreamParameterdvNV},
+    {"glVideoCaptureStreamParameterfvNV", (GLBproc)glVideoCaptureStreamParameterfvNV},
+    {"glVideoCaptureStreamParameterivNV", (GLBproc)glVideoCaptureStreamParameterivNV},
+    {"glViewport", (GLBproc)glViewport},
+    {"glViewportArrayv", (GLBproc)glViewportArrayv},
+    {"glViewportIndexedf", (GLBproc)glViewportIndexedf},
+    {"glViewportIndexedfv", (GLBproc)glViewportIndexedfv},
+    {"glViewportPositionWScaleNV", (GLBproc)glViewportPositionWScaleNV},
+    {"glViewportSwizzleNV", (GLBproc)glViewportSwizzleNV},
+    {"glWaitSemaphoreEXT", (GLBproc)glWaitSemaphoreEXT},
+    {"glWaitSemaphoreui64NVX", (GLBproc)glWaitSemaphoreui64NVX},
+    {"glWaitSync", (GLBproc)glWaitSync},
+    {"glWaitVkSemaphoreNV", (GLBproc)glWaitVkSemaphoreNV},
+    {"glWeightPathsNV", (GLBproc)glWeightPathsNV},
+    {"glWeightPointerARB", (GLBproc)glWeightPointerARB},
+    {"glWeightbvARB", (GLBproc)glWeightbvARB},
+    {"glWeightdvARB", (GLBproc)glWeightdvARB},
+    {"glWeightfvARB", (GLBproc)glWeightfvARB},
+    {"glWeightivARB", (GLBproc)glWeightivARB},
+    {"glWeightsvARB", (GLBproc)glWeightsvARB},
+    {"glWeightubvARB", (GLBproc)glWeightubvARB},
+    {"glWeightuivARB", (GLBproc)glWeightuivARB},
+    {"glWeightusvARB", (GLBproc)glWeightusvARB},
+    {"glWindowPos2d", (GLBproc)glWindowPos2d},
+    {"glWindowPos2dARB", (GLBproc)glWindowPos2dARB},
+    {"glWindowPos2dMESA", (GLBproc)glWindowPos2dMESA},
+    {"glWindowPos2dv", (GLBproc)glWindowPos2dv},
+    {"glWindowPos2dvARB", (GLBproc)glWindowPos2dvARB},
+    {"glWindowPos2dvMESA", (GLBproc)glWindowPos2dvMESA},
+    {"glWindowPos2f", (GLBproc)glWindowPos2f},
+    {"glWindowPos2fARB", (GLBproc)glWindowPos2fARB},
+    {"glWindowPos2fMESA", (GLBproc)glWindowPos2fMESA},
+    {"glWindowPos2fv", (GLBproc)glWindowPos2fv},
+    {"glWindowPos2fvARB", (GLBproc)glWindowPos2fvARB},
+    {"glWindowPos2fvMESA", (GLBproc)glWindowPos2fvMESA},
+    {"glWindowPos2i", (GLBproc)glWindowPos2i},
+    {"glWindowPos2iARB", (GLBproc)glWindowPos2iARB},
+    {"glWindowPos2iMESA", (GLBproc)glWindowPos2iMESA},
+    {"glWindowPos2iv", (GLBproc)glWindowPos2iv},
+    {"glWindowPos2ivARB", (GLBproc)glWindowPos2ivARB},
+    {"glWindowPos2ivMESA", (GLBproc)glWindowPos2ivMESA},
+    {"glWindowPos2s", (GLBproc)glWindowPos2s},
+    {"glWindowPos2sARB", (GLBproc)glWindowPos2sARB},
+    {"glWindowPos2sMESA", (GLBproc)glWindowPos2sMESA},
+    {"glWindowPos2sv", (GLBproc)glWindowPos2sv},
+    {"glWindowPos2svARB", (GLBproc)glWindowPos2svARB},
+    {"glWindowPos2svMESA", (GLBproc)glWindowPos2svMESA},
+    {"glWindowPos3d", (GLBproc)glWindowPos3d},
+    {"glWindowPos3dARB", (GLBproc)glWindowPos3dARB},
+    {"glWindowPos3dMESA", (GLBproc)glWindowPos3dMESA},
+    {"glWindowPos3dv", (GLBproc)glWindowPos3dv},
+    {"glWindowPos3dvARB", (GLBproc)glWindowPos3dvARB},
+    {"glWindowPos3dvMESA", (GLBproc)glWindowPos3dvMESA},
+    {"glWindowPos3f", (GLBproc)glWindowPos3f},
+    {"glWindowPos3fARB", (GLBproc)glWindowPos3fARB},
+    {"glWindowPos3fMESA", (GLBproc)glWindowPos3fMESA},
+    {"glWindowPos3fv", (GLBproc)glWindowPos3fv},
+    {"glWindowPos3fvARB", (GLBproc)glWindowPos3fvARB},
+    {"glWindowPos3fvMESA", (GLBproc)glWindowPos3fvMESA},
+    {"glWindowPos3i", (GLBproc)glWindowPos3i},
+    {"glWindowPos3iARB", (GLBproc)glWindowPos3iARB},
+    {"glWindowPos3iMESA", (GLBproc)glWindowPos3iMESA},
+    {"glWindowPos3iv", (GLBproc)glWindowPos3iv},
+    {"glWindowPos3ivARB", (GLBproc)glWindowPos3ivARB},
+    {"glWindowPos3ivMESA", (GLBproc)glWindowPos3ivMESA},
+    {"glWindowPos3s", (GLBproc)glWindowPos3s},
+    {"glWindowPos3sARB", (GLBproc)glWindowPos3sARB},
+    {"glWindowPos3sMESA", (GLBproc)glWindowPos3sMESA},
+    {"glWindowPos3sv", (GLBproc)glWindowPos3sv},
+    {"glWindowPos3svARB", (GLBproc)glWindowPos3svARB},
+    {"glWindowPos3svMESA", (GLBproc)glWindowPos3svMESA},
+    {"glWindowPos4dMESA", (GLBproc)glWindowPos4dMESA},
+    {"glWindowPos4dvMESA", (GLBproc)glWindowPos4dvMESA},
+    {"glWindowPos4fMESA", (GLBproc)glWindowPos4fMESA},
+    {"glWindowPos4fvMESA", (GLBproc)glWindowPos4fvMESA},
+    {"glWindowPos4iMESA", (GLBproc)glWindowPos4iMESA},
+    {"glWindowPos4ivMESA", (GLBproc)glWindowPos4ivMESA},
+    {"glWindowPos4sMESA", (GLBproc)glWindowPos4sMESA},
+    {"glWindowPos4svMESA", (GLBproc)glWindowPos4svMESA},
+    {"glWindowRectanglesEXT", (GLBproc)glWindowRectanglesEXT},
+    {"glWriteMaskEXT", (GLBproc)glWriteMaskEXT},
+    {"glXBindChannelToWindowSGIX", (GLBproc)glXBindChannelToWindowSGIX},
+    {"glXBindHyperpipeSGIX", (GLBproc)glXBindHyperpipeSGIX},
+    {"glXBindSwapBarrierNV", (GLBproc)glXBindSwapBarrierNV},
+    {"glXBindSwapBarrierSGIX", (GLBproc)glXBindSwapBarrierSGIX},
+    {"glXBindTexImageEXT", (GLBproc)glXBindTexImageEXT},
+    {"glXBindVideoCaptureDeviceNV", (GLBproc)glXBindVideoCaptureDeviceNV},
+    {"glXBindVideoDeviceNV", (GLBproc)glXBindVideoDeviceNV},
+    {"glXBindVideoImageNV", (GLBproc)glXBindVideoImageNV},
+    {"glXBlitContextFramebufferAMD", (GLBproc)glXBlitContextFramebufferAMD},
+    {"glXChannelRectSGIX", (GLBproc)glXChannelRectSGIX},
+    {"glXChannelRectSyncSGIX", (GLBproc)glXChannelRectSyncSGIX},
+    {"glXChooseFBConfig", (GLBproc)glXChooseFBConfig},
+    {"glXChooseFBConfigSGIX", (GLBproc)glXChooseFBConfigSGIX},
+    {"glXChooseVisual", (GLBproc)glXChooseVisual},
+    {"glXCopyBufferSubDataNV", (GLBproc)glXCopyBufferSubDataNV},
+    {"glXCopyContext", (GLBproc)glXCopyContext},
+    {"glXCopyImageSubDataNV", (GLBproc)glXCopyImageSubDataNV},
+    {"glXCopySubBufferMESA", (GLBproc)glXCopySubBufferMESA},
+    {"glXCreateAssociatedContextAMD", (GLBproc)glXCreateAssociatedContextAMD},
+    {"glXCreateAssociatedContextAttribsAMD", (GLBproc)glXCreateAssociatedContextAttribsAMD},
+    {"glXCreateContext", (GLBproc)glXCreateContext},
+    {"glXCreateContextAttribsARB", (GLBproc)glXCreateContextAttribsARB},
+    {"glXCreateContextWithConfigSGIX", (GLBproc)glXCreateContextWithConfigSGIX},
+    {"glXCreateGLXPbufferSGIX", (GLBproc)glXCreateGLXPbufferSGIX},
+    {"glXCreateGLXPixmap", (GLBproc)glXCreateGLXPixmap},
+    {"glXCreateGLXPixmapMESA", (GLBproc)glXCreateGLXPixmapMESA},
+    {"glXCreateGLXPixmapWithConfigSGIX", (GLBproc)glXCreateGLXPixmapWithConfigSGIX},
+    {"glXCreateNewContext", (GLBproc)glXCreateNewContext},
+    {"glXCreatePbuffer", (GLBproc)glXCreatePbuffer},
+    {"glXCreatePixmap", (GLBproc)glXCreatePixmap},
+    {"glXCreateWindow", (GLBproc)glXCreateWindow},
+    {"glXCushionSGI", (GLBproc)glXCushionSGI},
+    {"glXDelayBeforeSwapNV", (GLBproc)glXDelayBeforeSwapNV},
+    {"glXDeleteAssociatedContextAMD", (GLBproc)glXDeleteAssociatedContextAMD},
+    {"glXDestroyContext", (GLBproc)glXDestroyContext},
+    {"glXDestroyGLXPbufferSGIX", (GLBproc)glXDestroyGLXPbufferSGIX},
+    {"glXDestroyGLXPixmap", (GLBproc)glXDestroyGLXPixmap},
+    {"glXDestroyHyperpipeConfigSGIX", (GLBproc)glXDestroyHyperpipeConfigSGIX},
+    {"glXDestroyPbuffer", (GLBproc)glXDestroyPbuffer},
+    {"glXDestroyPixmap", (GLBproc)glXDestroyPixmap},
+    {"glXDestroyWindow", (GLBproc)glXDestroyWindow},
+    {"glXEnumerateVideoCaptureDevicesNV", (GLBproc)glXEnumerateVideoCaptureDevicesNV},
+    {"glXEnumerateVideoDevicesNV", (GLBproc)glXEnumerateVideoDevicesNV},
+    {"glXFreeContextEXT", (GLBproc)glXFreeContextEXT},
+    {"glXGetAGPOffsetMESA", (GLBproc)glXGetAGPOffsetMESA},
+    {"glXGetClientString", (GLBproc)glXGetClientString},
+    {"glXGetConfig", (GLBproc)glXGetConfig},
+    {"glXGetContextGPUIDAMD", (GLBproc)glXGetContextGPUIDAMD},
+    {"glXGetContextIDEXT", (GLBproc)glXGetContextIDEXT},
+    {"glXGetCurrentAssociatedContextAMD", (GLBproc)glXGetCurrentAssociatedContextAMD},
+    {"glXGetCurrentContext", (GLBproc)glXGetCurrentContext},
+    {"glXGetCurrentDisplay", (GLBproc)glXGetCurrentDisplay},
+    {"glXGetCurrentDisplayEXT", (GLBproc)glXGetCurrentDisplayEXT},
+    {"glXGetCurrentDrawable", (GLBproc)glXGetCurrentDrawable},
+    {"glXGetCurrentReadDrawable", (GLBproc)glXGetCurrentReadDrawable},
+    {"glXGetCurrentReadDrawableSGI", (GLBproc)glXGetCurrentReadDrawableSGI},
+    {"glXGetFBConfigAttrib", (GLBproc)glXGetFBConfigAttrib},
+    {"glXGetFBConfigAttribSGIX", (GLBproc)glXGetFBConfigAttribSGIX},
+    {"glXGetFBConfigFromVisualSGIX", (GLBproc)glXGetFBConfigFromVisualSGIX},
+    {"glXGetFBConfigs", (GLBproc)glXGetFBConfigs},
+    {"glXGetGPUIDsAMD", (GLBproc)glXGetGPUIDsAMD},
+    {"glXGetGPUInfoAMD", (GLBproc)glXGetGPUInfoAMD},
+    {"glXGetMscRateOML", (GLBproc)glXGetMscRateOML},
+    {"glXGetProcAddress", (GLBproc)glXGetProcAddress},
+    {"glXGetProcAddressARB", (GLBproc)glXGetProcAddressARB},
+    {"glXGetSelectedEvent", (GLBproc)glXGetSelectedEvent},
+    {"glXGetSelectedEventSGIX", (GLBproc)glXGetSelectedEventSGIX},
+    {"glXGetSwapIntervalMESA", (GLBproc)glXGetSwapIntervalMESA},
+    {"glXGetSyncValuesOML", (GLBproc)glXGetSyncValuesOML},
+    {"glXGetTransparentIndexSUN", (GLBproc)glXGetTransparentIndexSUN},
+    {"glXGetVideoDeviceNV", (GLBproc)glXGetVideoDeviceNV},
+    {"glXGetVideoInfoNV", (GLBproc)glXGetVideoInfoNV},
+    {"glXGetVideoSyncSGI", (GLBproc)glXGetVideoSyncSGI},
+    {"glXGetVisualFromFBConfig", (GLBproc)glXGetVisualFromFBConfig},
+    {"glXGetVisualFromFBConfigSGIX", (GLBproc)glXGetVisualFromFBConfigSGIX},
+    {"glXHyperpipeAttribSGIX", (GLBproc)glXHyperpipeAttribSGIX},
+    {"glXHyperpipeConfigSGIX", (GLBproc)glXHyperpipeConfigSGIX},
+    {"glXImportContextEXT", (GLBproc)glXImportContextEXT},
+    {"glXIsDirect", (GLBproc)glXIsDirect},
+    {"glXJoinSwapGroupNV", (GLBproc)glXJoinSwapGroupNV},
+    {"glXJoinSwapGroupSGIX", (GLBproc)glXJoinSwapGroupSGIX},
+    {"glXLockVideoCaptureDeviceNV", (GLBproc)glXLockVideoCaptureDeviceNV},
+    {"glXMakeAssociatedContextCurrentAMD", (GLBproc)glXMakeAssociatedContextCurrentAMD},
+    {"glXMakeContextCurrent", (GLBproc)glXMakeContextCurrent},
+    {"glXMakeCurrent", (GLBproc)glXMakeCurrent},
+    {"glXMakeCurrentReadSGI", (GLBproc)glXMakeCurrentReadSGI},
+    {"glXNamedCopyBufferSubDataNV", (GLBproc)glXNamedCopyBufferSubDataNV},
+    {"glXQueryChannelDeltasSGIX", (GLBproc)glXQueryChannelDeltasSGIX},
+    {"glXQueryChannelRectSGIX", (GLBproc)glXQueryChannelRectSGIX},
+    {"glXQueryContext", (GLBproc)glXQueryContext},
+    {"glXQueryContextInfoEXT", (GLBproc)glXQueryContextInfoEXT},
+    {"glXQueryCurrentRendererIntegerMESA", (GLBproc)glXQueryCurrentRendererIntegerMESA},
+    {"glXQueryCurrentRendererStringMESA", (GLBproc)glXQueryCurrentRendererStringMESA},
+    {"glXQueryDrawable", (GLBproc)glXQueryDrawable},
+    {"glXQueryExtension", (GLBproc)glXQueryExtension},
+    {"glXQueryExtensionsString", (GLBproc)glXQueryExtensionsString},
+    {"glXQueryFrameCountNV", (GLBproc)glXQueryFrameCountNV},
+    {"glXQueryGLXPbufferSGIX", (GLBproc)glXQueryGLXPbufferSGIX},
+    {"glXQueryHyperpipeAttribSGIX", (GLBproc)glXQueryHyperpipeAttribSGIX},
+    {"glXQueryHyperpipeBestAttribSGIX", (GLBproc)glXQueryHyperpipeBestAttribSGIX},
+    {"glXQueryHyperpipeConfigSGIX", (GLBproc)glXQueryHyperpipeConfigSGIX},
+    {"glXQueryHyperpipeNetworkSGIX", (GLBproc)glXQueryHyperpipeNetworkSGIX},
+    {"glXQueryMaxSwapBarriersSGIX", (GLBproc)glXQueryMaxSwapBarriersSGIX},
+    {"glXQueryMaxSwapGroupsNV", (GLBproc)glXQueryMaxSwapGroupsNV},
+    {"glXQueryRendererIntegerMESA", (GLBproc)glXQueryRendererIntegerMESA},
+    {"glXQueryRendererStringMESA", (GLBproc)glXQueryRendererStringMESA},
+    {"glXQueryServerString", (GLBproc)glXQueryServerString},
+    {"glXQuerySwapGroupNV", (GLBproc)glXQuerySwapGroupNV},
+    {"glXQueryVersion", (GLBproc)glXQueryVersion},
+    {"glXQueryVideoCaptureDeviceNV", (GLBproc)glXQueryVideoCaptureDeviceNV},
+    {"glXReleaseBuffersMESA", (GLBproc)glXReleaseBuffersMESA},
+    {"glXReleaseTexImageEXT", (GLBproc)glXReleaseTexImageEXT},
+    {"glXReleaseVideoCaptureDeviceNV", (GLBproc)glXReleaseVideoCaptureDeviceNV},
+    {"glXReleaseVideoDeviceNV", (GLBproc)glXReleaseVideoDeviceNV},
+    {"glXReleaseVideoImageNV", (GLBproc)glXReleaseVideoImageNV},
+    {"glXResetFrameCountNV", (GLBproc)glXResetFrameCountNV},
+    {"glXSelectEvent", (GLBproc)glXSelectEvent},
+    {"glXSelectEventSGIX", (GLBproc)glXSelectEventSGIX},
+    {"glXSendPbufferToVideoNV", (GLBproc)glXSendPbufferToVideoNV},
+    {"glXSet3DfxModeMESA", (GLBproc)glXSet3DfxModeMESA},
+    {"glXSwapBuffers", (GLBproc)glXSwapBuffers},
+    {"glXSwapBuffersMscOML", (GLBproc)glXSwapBuffersMscOML},
+    {"glXSwapIntervalEXT", (GLBproc)glXSwapIntervalEXT},
+    {"glXSwapIntervalMESA", (GLBproc)glXSwapIntervalMESA},
+    {"glXSwapIntervalSGI", (GLBproc)glXSwapIntervalSGI},
+    {"glXUseXFont", (GLBproc)glXUseXFont},
+    {"glXWaitForMscOML", (GLBproc)glXWaitForMscOML},
+    {"glXWaitForSbcOML", (GLBproc)glXWaitForSbcOML},
+    {"glXWaitGL", (GLBproc)glXWaitGL},
+    {"glXWaitVideoSyncSGI", (GLBproc)glXWaitVideoSyncSGI},
+    {"glXWaitX", (GLBproc)glXWaitX},
+};
+
+static int glbStubCompareProcEntry(const void* pName, const void* pEntry)
+{
+    return strcmp((const char*)pName, ((const glbStubProcEntry*)pEntry)->pName);
+}
+
+static const glbStubProcEntry* glbStubFindProc(const char* pName)
+{
+    return (const glbStubProcEntry*)bsearch(pName, g_glbStubProcs, GLB_STUB_PROC_COUNT, sizeof(g_glbStubProcs[0]), glbStubCompareProcEntry);
+}
+
+GLB_STUB_EXPORT __GLXextFuncPtr APIENTRY glXGetProcAddress(const GLubyte * procName)
+{
+    const glbStubProcEntry* pEntry;
+
+    GLB_STUB_CALL(GLB_STUB_PROC_glXGetProcAddress);
+    g_glbStubLookupCount += 1;
+
+    glbStubInit();
+
+    if (procName == NULL || glbStubIsNameInList((const char*)procName, g_glbStubNullProcs)) {
+        return NULL;
+    }
+
+    pEntry = glbStubFindProc((const char*)procName);
+    if (pEntry == NULL) {
+        return NULL;
+    }
+
+    return (__GLXextFuncPtr)pEntry->proc;
+}
+
+GLB_STUB_EXPORT unsigned long glbStubGetCallCount(const char* pName)
+{
+    const glbStubProcEntry* pEntry;
+
+    if (pName == NULL) {
+        return 0;
+    }
+
+    pEntry = glbStubFindProc(pName);
+    if (pEntry == NULL) {
+        return 0;
+    }
+
+    return g_glbStubCallCounts[pEntry - g_glbStubProcs];
+}
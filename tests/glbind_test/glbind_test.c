@@ -0,0 +1,453 @@
+/*
+Tests the loader against the stub library in tests/glbind_stub, which is put in front of the real libGL with LD_LIBRARY_PATH. This is
+compiled once for each way of loading the APIs (see CMakeLists.txt) and expects the stub to be configured like this:
+
+    GLBIND_STUB_VERSION=3.3
+    GLBIND_STUB_EXTENSIONS="GL_ARB_direct_state_access GL_KHR_debug"
+    GLBIND_STUB_GLX_EXTENSIONS="GLX_ARB_create_context"
+    GLBIND_STUB_NULL_PROCS="glClear glDrawArrays"
+
+Returns 0 if every check passes.
+*/
+#if defined(GLBIND_TLS_DISPATCH)
+#define _POSIX_C_SOURCE 200112L     /* For pthread_barrier_t. */
+#include <pthread.h>
+#endif
+
+#define GLBIND_IMPLEMENTATION
+#include "../../glbind.h"
+
+#include <stdio.h>
+
+#define GLB_TEST_NULL_PROC_COUNT    2   /* The number of commands in GLBIND_STUB_NULL_PROCS. */
+
+typedef unsigned long (* GLB_PFNGLBSTUBGETCALLCOUNTPROC)(const char* pName);
+typedef void (* GLB_PFNGLBSTUBSETCONTEXTPROFILEPROC)(int profileMask, int contextFlags);
+
+static int g_glbTestFailCount = 0;
+
+#define GLB_TEST_CHECK(condition) glbTestCheck((condition) ? GL_TRUE : GL_FALSE, #condition, __LINE__)
+
+void glbTestCheck(GLboolean passed, const char* pCondition, int line)
+{
+    if (!passed) {
+        printf("glbind_test.c:%d: FAILED: %s\n", line, pCondition);
+        g_glbTestFailCount += 1;
+    }
+}
+
+/* The number of times the stub's no-op for a command has been called. Counts are reset when the library is unloaded by glbUninit(). */
+unsigned long glbTestGetCallCount(const char* pName)
+{
+    GLB_PFNGLBSTUBGETCALLCOUNTPROC _glbStubGetCallCount = (GLB_PFNGLBSTUBGETCALLCOUNTPROC)glb_dlsym(g_glbOpenGLSO, "glbStubGetCallCount");
+    if (_glbStubGetCallCount == NULL) {
+        return 0;
+    }
+
+    return _glbStubGetCallCount(pName);
+}
+
+size_t glbTestCountLoadedProcs(GLBapi* pAPI)
+{
+    GLBproc* pProcs = GLB_PROCS(pAPI);
+    size_t loadedCount = 0;
+    size_t iProc;
+
+    for (iProc = 0; iProc < GLB_PROC_COUNT; ++iProc) {
+        if (pProcs[iProc] != NULL) {
+            loadedCount += 1;
+        }
+    }
+
+    return loadedCount;
+}
+
+/* A loader for glbInitFromLoader() which counts how many times it's called. */
+GLBproc glbTestLoadProc(const char* pName, void* pUserData)
+{
+    *(size_t*)pUserData += 1;
+    return glbGetProcAddress(pName);
+}
+
+/* A loader for glbInitFromLoader() which goes straight to glXGetProcAddress() like an application's windowing library would. */
+GLBproc glbTestLoadProcFromGLX(const char* pName, void* pUserData)
+{
+    return (*(GLB_PFNGLXGETPROCADDRESSPROC*)pUserData)((const GLubyte*)pName);
+}
+
+/* The flags and function pointers that are expected of any API object retrieved from the stub. */
+void glbTestCheckAPI(GLBapi* pAPI)
+{
+    /* Versions. */
+    GLB_TEST_CHECK(pAPI->GLB_GL_VERSION_1_0);
+    GLB_TEST_CHECK(pAPI->GLB_GL_VERSION_3_3);
+    GLB_TEST_CHECK(!pAPI->GLB_GL_VERSION_4_0);
+
+    /* Extensions, by name, by index and by flag. */
+    GLB_TEST_CHECK( glbIsExtensionSupported(pAPI, "GL_ARB_direct_state_access"));
+    GLB_TEST_CHECK( glbIsExtensionSupported(pAPI, "GL_KHR_debug"));
+    GLB_TEST_CHECK(!glbIsExtensionSupported(pAPI, "GL_ARB_bindless_texture"));
+    GLB_TEST_CHECK( glbIsExtensionSupported(pAPI, "GLX_ARB_create_context"));
+    GLB_TEST_CHECK(!glbIsExtensionSupported(pAPI, "GLX_EXT_swap_control"));
+    GLB_TEST_CHECK( glbIsExtensionSupportedByIndex(pAPI, GLB_EXTENSION_GL_ARB_direct_state_access));
+    GLB_TEST_CHECK(!glbIsExtensionSupportedByIndex(pAPI, GLB_EXTENSION_GL_ARB_bindless_texture));
+    GLB_TEST_CHECK( pAPI->GLB_HAS_GL_ARB_direct_state_access);
+    GLB_TEST_CHECK( pAPI->GLB_HAS_GL_KHR_debug);
+    GLB_TEST_CHECK(!pAPI->GLB_HAS_GL_ARB_bindless_texture);
+    GLB_TEST_CHECK( pAPI->GLB_HAS_GLX_ARB_create_context);
+    GLB_TEST_CHECK(!pAPI->GLB_HAS_GLX_EXT_swap_control);
+
+    /* The stub returns a no-op for everything except the commands in GLBIND_STUB_NULL_PROCS. */
+    GLB_TEST_CHECK(pAPI->glClear      == NULL);
+    GLB_TEST_CHECK(pAPI->glDrawArrays == NULL);
+    GLB_TEST_CHECK(pAPI->glViewport   != NULL);
+    GLB_TEST_CHECK(pAPI->glDebugMessageCallbackKHR != NULL);  /* GL_KHR_debug. The registry lists no commands for GL_ARB_direct_state_access. */
+
+#if defined(GLBIND_LOAD_SUPPORTED_ONLY)
+    GLB_TEST_CHECK(pAPI->glGetTextureHandleARB == NULL);    /* GL_ARB_bindless_texture isn't advertised. */
+    GLB_TEST_CHECK(pAPI->glSpecializeShader    == NULL);    /* OpenGL 4.6. */
+    GLB_TEST_CHECK(glbTestCountLoadedProcs(pAPI) < GLB_PROC_COUNT - GLB_TEST_NULL_PROC_COUNT);
+#else
+    GLB_TEST_CHECK(glbTestCountLoadedProcs(pAPI) == GLB_PROC_COUNT - GLB_TEST_NULL_PROC_COUNT);
+#endif
+}
+
+#if defined(GLBIND_LAZY)
+/*
+The global function pointers resolve themselves the first time they're called. glbUninit() needs to point them back at their trampolines
+or they'd be left pointing into the library it unloads, which the next glbInit() wouldn't fix.
+*/
+void glbTestLazy(GLBconfig* pConfig)
+{
+    int iRun;
+
+    for (iRun = 0; iRun < 2; ++iRun) {
+        GLenum result;
+
+        GLB_TEST_CHECK(glViewport == glbind_Lazy_glViewport);
+
+        result = glbInit(NULL, pConfig);
+        GLB_TEST_CHECK(result == GL_NO_ERROR);
+        if (result != GL_NO_ERROR) {
+            return;
+        }
+
+        glViewport(0, 0, 1, 1);
+        GLB_TEST_CHECK(glViewport != glbind_Lazy_glViewport);
+        GLB_TEST_CHECK(glbTestGetCallCount("glViewport") == 1);
+
+        glbUninit();
+    }
+}
+#endif
+
+#if !defined(GLBIND_NO_CONTEXT_API_CACHE)
+/* Whether or not the last glbInitContextAPI() copied the API object from the cache. */
+GLboolean glbTestInitContextAPIFromCache(glbind_Display* pDisplay, GLBconfig* pConfig)
+{
+    GLBapi contextAPI;
+    GLBinitStats stats;
+
+    GLB_TEST_CHECK(glbInitContextAPI(pDisplay, pConfig->drawable, pConfig->rc, &contextAPI) == GL_NO_ERROR);
+    glbTestCheckAPI(&contextAPI);
+
+    glbGetInitStats(&stats);
+    return stats.fromCache;
+}
+
+/* The driver strings don't change between core and compatibility contexts, or between displays, so they can't be all the cache goes by. */
+void glbTestContextAPICacheKey(GLBconfig* pConfig)
+{
+    GLB_PFNGLBSTUBSETCONTEXTPROFILEPROC _glbStubSetContextProfile = (GLB_PFNGLBSTUBSETCONTEXTPROFILEPROC)glb_dlsym(g_glbOpenGLSO, "glbStubSetContextProfile");
+    int otherStubObject = 0;
+
+    GLB_TEST_CHECK(_glbStubSetContextProfile != NULL);
+    if (_glbStubSetContextProfile == NULL) {
+        return;
+    }
+
+    _glbStubSetContextProfile(GL_CONTEXT_COMPATIBILITY_PROFILE_BIT, 0);
+    GLB_TEST_CHECK(!glbTestInitContextAPIFromCache(pConfig->pDisplay, pConfig));
+    GLB_TEST_CHECK( glbTestInitContextAPIFromCache(pConfig->pDisplay, pConfig));
+
+    _glbStubSetContextProfile(GL_CONTEXT_COMPATIBILITY_PROFILE_BIT, GL_CONTEXT_FLAG_DEBUG_BIT);
+    GLB_TEST_CHECK(!glbTestInitContextAPIFromCache(pConfig->pDisplay, pConfig));
+
+    GLB_TEST_CHECK(!glbTestInitContextAPIFromCache((glbind_Display*)&otherStubObject, pConfig));
+    GLB_TEST_CHECK( glbTestInitContextAPIFromCache((glbind_Display*)&otherStubObject, pConfig));
+
+    /* Back to the context the cache was first populated with. */
+    _glbStubSetContextProfile(0, 0);
+    GLB_TEST_CHECK( glbTestInitContextAPIFromCache(pConfig->pDisplay, pConfig));
+}
+#endif
+
+/*
+An application can use glbInitFromLoader() without ever calling glbInit(), in which case none of glbind's own libraries, display or
+function pointers exist. Querying an extension glbind doesn't know about goes to the driver's extension strings and must not touch them.
+*/
+void glbTestLoaderWithoutInit(void)
+{
+    GLBhandle hOpenGL;
+    GLB_PFNGLXGETPROCADDRESSPROC _glXGetProcAddress;
+    GLB_PFNGLXMAKECURRENTPROC _glXMakeCurrent;
+    GLBapi api;
+    int stubObject = 0;
+
+    hOpenGL = glb_dlopen("libGL.so.1");
+    GLB_TEST_CHECK(hOpenGL != NULL);
+    if (hOpenGL == NULL) {
+        return;
+    }
+
+    _glXGetProcAddress = (GLB_PFNGLXGETPROCADDRESSPROC)glb_dlsym(hOpenGL, "glXGetProcAddress");
+    _glXMakeCurrent    = (GLB_PFNGLXMAKECURRENTPROC   )glb_dlsym(hOpenGL, "glXMakeCurrent");
+    GLB_TEST_CHECK(_glXGetProcAddress != NULL && _glXMakeCurrent != NULL);
+    if (_glXGetProcAddress == NULL || _glXMakeCurrent == NULL) {
+        glb_dlclose(hOpenGL);
+        return;
+    }
+
+    /* No display is current so the GLX extensions can't be queried at all. */
+    GLB_TEST_CHECK(glbInitFromLoader(glbTestLoadProcFromGLX, &_glXGetProcAddress, &api) == GL_NO_ERROR);
+    GLB_TEST_CHECK(!glbIsExtensionSupported(&api, "GL_glbind_unknown_extension"));
+
+    /* With a current context the screen comes from glXQueryContext() since X11 was never loaded. */
+    _glXMakeCurrent((glbind_Display*)&stubObject, 1, (GLXContext)&stubObject);
+    GLB_TEST_CHECK(glbInitFromLoader(glbTestLoadProcFromGLX, &_glXGetProcAddress, &api) == GL_NO_ERROR);
+    glbTestCheckAPI(&api);
+    GLB_TEST_CHECK(!glbIsExtensionSupported(&api, "GL_glbind_unknown_extension"));
+
+    _glXMakeCurrent(NULL, 0, NULL);
+    glb_dlclose(hOpenGL);
+}
+
+#if defined(GLBIND_TLS_DISPATCH)
+#define GLB_TEST_THREAD_COUNT   2
+
+typedef struct
+{
+    const GLBapi* pAPI;             /* The API the thread makes current. */
+    const GLBapi* pBoundAPI;        /* What glbGetCurrentAPI() is expected to return before and after. */
+    GLBconfig* pConfig;             /* When set, the API is made current with glbMakeCurrent() rather than glbSetCurrentAPI(). */
+    int clearCount;                 /* The number of times the thread calls glClear(). */
+    GLboolean startedWithBoundAPI;
+    GLboolean madeCurrent;
+    GLboolean endedWithBoundAPI;
+} glbTestThread;
+
+static pthread_barrier_t g_glbTestBarrier;
+static unsigned long g_glbTestClearCounts[GLB_TEST_THREAD_COUNT];
+
+/* Each thread's API gets its own glClear() so that the calls can be told apart. The stub returns NULL for the real one. */
+void APIENTRY glbTestClear0(GLbitfield mask)
+{
+    (void)mask;
+    g_glbTestClearCounts[0] += 1;
+}
+
+void APIENTRY glbTestClear1(GLbitfield mask)
+{
+    (void)mask;
+    g_glbTestClearCounts[1] += 1;
+}
+
+void* glbTestThreadProc(void* pUserData)
+{
+    glbTestThread* pThread = (glbTestThread*)pUserData;
+    int iClear;
+
+    /* A new thread dispatches through whatever was bound with glbBindAPI(). */
+    pThread->startedWithBoundAPI = glbGetCurrentAPI() == pThread->pBoundAPI;
+
+    if (pThread->pConfig != NULL) {
+        pThread->madeCurrent = glbMakeCurrent(pThread->pConfig->pDisplay, pThread->pConfig->drawable, pThread->pConfig->rc, pThread->pAPI);
+    } else {
+        glbSetCurrentAPI(pThread->pAPI);
+        pThread->madeCurrent = GL_TRUE;
+    }
+    pThread->madeCurrent = pThread->madeCurrent && glbGetCurrentAPI() == pThread->pAPI;
+
+    /* Both threads have their own API current by the time either of them calls anything. */
+    pthread_barrier_wait(&g_glbTestBarrier);
+
+    for (iClear = 0; iClear < pThread->clearCount; ++iClear) {
+        glClear(GL_COLOR_BUFFER_BIT);
+    }
+
+    /* And neither goes back to the bound API until both are done. */
+    pthread_barrier_wait(&g_glbTestBarrier);
+
+    glbSetCurrentAPI(NULL);
+    pThread->endedWithBoundAPI = glbGetCurrentAPI() == pThread->pBoundAPI;
+
+    return NULL;
+}
+
+/* The global names dispatch through an API pointer that's local to each thread. */
+void glbTestTLSDispatch(GLBapi* pAPI, GLBconfig* pConfig)
+{
+    GLBapi threadAPIs[GLB_TEST_THREAD_COUNT];
+    glbTestThread threads[GLB_TEST_THREAD_COUNT];
+    pthread_t threadHandles[GLB_TEST_THREAD_COUNT];
+    const GLBapi* pBoundAPI;
+    int iThread;
+    int result;
+
+    GLB_TEST_CHECK(glbBindAPI(pAPI) == GL_NO_ERROR);
+    pBoundAPI = glbGetCurrentAPI();
+    GLB_TEST_CHECK(pBoundAPI != NULL && pBoundAPI->glViewport == pAPI->glViewport);
+
+    threadAPIs[0] = *pAPI;
+    threadAPIs[1] = *pAPI;
+    threadAPIs[0].glClear = glbTestClear0;
+    threadAPIs[1].glClear = glbTestClear1;
+
+    g_glbTestClearCounts[0] = 0;
+    g_glbTestClearCounts[1] = 0;
+
+    result = pthread_barrier_init(&g_glbTestBarrier, NULL, GLB_TEST_THREAD_COUNT);
+    GLB_TEST_CHECK(result == 0);
+    if (result != 0) {
+        return;
+    }
+
+    for (iThread = 0; iThread < GLB_TEST_THREAD_COUNT; ++iThread) {
+        threads[iThread].pAPI                = &threadAPIs[iThread];
+        threads[iThread].pBoundAPI           = pBoundAPI;
+        threads[iThread].pConfig             = (iThread == 1) ? pConfig : NULL;
+        threads[iThread].clearCount          = 3 + iThread;
+        threads[iThread].startedWithBoundAPI = GL_FALSE;
+        threads[iThread].madeCurrent         = GL_FALSE;
+        threads[iThread].endedWithBoundAPI   = GL_FALSE;
+    }
+
+    for (iThread = 0; iThread < GLB_TEST_THREAD_COUNT; ++iThread) {
+        GLB_TEST_CHECK(pthread_create(&threadHandles[iThread], NULL, glbTestThreadProc, &threads[iThread]) == 0);
+    }
+    for (iThread = 0; iThread < GLB_TEST_THREAD_COUNT; ++iThread) {
+        pthread_join(threadHandles[iThread], NULL);
+    }
+
+    pthread_barrier_destroy(&g_glbTestBarrier);
+
+    for (iThread = 0; iThread < GLB_TEST_THREAD_COUNT; ++iThread) {
+        GLB_TEST_CHECK(threads[iThread].startedWithBoundAPI);
+        GLB_TEST_CHECK(threads[iThread].madeCurrent);
+        GLB_TEST_CHECK(threads[iThread].endedWithBoundAPI);
+        GLB_TEST_CHECK(g_glbTestClearCounts[iThread] == (unsigned long)threads[iThread].clearCount);
+    }
+
+    /* None of that changed anything for this thread. */
+    GLB_TEST_CHECK(glbGetCurrentAPI() == pBoundAPI);
+    GLB_TEST_CHECK(glbGetCurrentAPI()->glClear == NULL);
+}
+#endif
+
+int main(void)
+{
+    GLenum result;
+    GLBapi api;
+    GLBapi contextAPI;
+    GLBapi loaderAPI;
+    GLBconfig config;
+    GLBinitStats stats;
+    size_t loaderCallCount = 0;
+    int stubObject = 0;
+
+    /* There's no X server behind the stub so it needs to be given a display and a context. See glbind_stub_template.c. */
+    config = glbConfigInit();
+    config.pDisplay = (glbind_Display*)&stubObject;
+    config.rc       = (GLXContext)&stubObject;
+    config.drawable = 1;
+
+    /* A context is useless without the display it was created on. */
+    {
+        GLBconfig badConfig = config;
+        badConfig.pDisplay = NULL;
+        GLB_TEST_CHECK(glbInit(NULL, &badConfig) == GL_INVALID_VALUE);
+        GLB_TEST_CHECK(g_glbOpenGLSO == NULL);
+    }
+
+    glbTestLoaderWithoutInit();
+
+#if defined(GLBIND_LAZY)
+    glbTestLazy(&config);
+#endif
+
+    result = glbInit(&api, &config);
+    GLB_TEST_CHECK(result == GL_NO_ERROR);
+    if (result != GL_NO_ERROR) {
+        return 1;
+    }
+
+    if (glb_dlsym(g_glbOpenGLSO, "glbStubGetCallCount") == NULL) {
+        printf("This needs to be run against the stub library in tests/glbind_stub.\n");
+        glbUninit();
+        return 1;
+    }
+
+    glbTestCheckAPI(&api);
+
+    /* Every lookup is counted, including the ones that came back null. The stub doesn't export GL commands so dlsym() can't find them either. */
+    glbGetInitStats(&stats);
+    GLB_TEST_CHECK(stats.result == GL_NO_ERROR);
+    GLB_TEST_CHECK(stats.timeEnd >= stats.timeBeg);
+    GLB_TEST_CHECK(stats.phases[GLB_INIT_PHASE_LOAD_LIBRARIES].timeBeg != 0);
+    GLB_TEST_CHECK(stats.phases[GLB_INIT_PHASE_LOAD_PROCS].timeEnd >= stats.phases[GLB_INIT_PHASE_LOAD_PROCS].timeBeg);
+    GLB_TEST_CHECK(stats.phases[GLB_INIT_PHASE_OPEN_DISPLAY].timeBeg == 0);  /* The display was supplied. */
+    GLB_TEST_CHECK(stats.nullLookupCount    == GLB_TEST_NULL_PROC_COUNT);
+    GLB_TEST_CHECK(stats.dlsymFallbackCount == GLB_TEST_NULL_PROC_COUNT);
+    GLB_TEST_CHECK(!stats.fromCache);
+#if defined(GLBIND_LOAD_SUPPORTED_ONLY)
+    GLB_TEST_CHECK(stats.lookupCount < GLB_PROC_COUNT);
+#else
+    GLB_TEST_CHECK(stats.lookupCount >= GLB_PROC_COUNT);
+#endif
+
+    /* glbInit() binds the API to global scope. */
+    glViewport(0, 0, 1, 1);
+    GLB_TEST_CHECK(glbTestGetCallCount("glViewport") == 1);
+    GLB_TEST_CHECK(glbIsExtensionSupported(NULL, "GL_ARB_direct_state_access"));
+    GLB_TEST_CHECK(GLB_HAS_GL_ARB_direct_state_access);
+    GLB_TEST_CHECK(!GLB_HAS_GL_ARB_bindless_texture);
+    GLB_TEST_CHECK(GLB_GL_VERSION_3_3);
+    GLB_TEST_CHECK(!GLB_GL_VERSION_4_0);
+
+#if defined(GLBIND_TLS_DISPATCH)
+    glbTestTLSDispatch(&api, &config);
+#endif
+
+    /* The second context of the same driver is copied from the cache. */
+    result = glbInitContextAPI(config.pDisplay, config.drawable, config.rc, &contextAPI);
+    GLB_TEST_CHECK(result == GL_NO_ERROR);
+    glbTestCheckAPI(&contextAPI);
+
+    glbGetInitStats(&stats);
+    GLB_TEST_CHECK(stats.result == GL_NO_ERROR);
+#if !defined(GLBIND_NO_CONTEXT_API_CACHE)
+    GLB_TEST_CHECK(stats.fromCache);
+    GLB_TEST_CHECK(stats.lookupCount < GLB_PROC_COUNT);
+#endif
+
+#if !defined(GLBIND_NO_CONTEXT_API_CACHE)
+    glbTestContextAPICacheKey(&config);
+#endif
+
+    /* The application's own loader is used for everything and isn't counted in the stats. */
+    result = glbInitFromLoader(glbTestLoadProc, &loaderCallCount, &loaderAPI);
+    GLB_TEST_CHECK(result == GL_NO_ERROR);
+    GLB_TEST_CHECK(loaderCallCount > 0);
+    glbTestCheckAPI(&loaderAPI);
+    GLB_TEST_CHECK(!glbIsExtensionSupported(&loaderAPI, "GL_glbind_unknown_extension"));
+
+    glbUninit();
+
+    if (g_glbTestFailCount > 0) {
+        printf("%d checks failed.\n", g_glbTestFailCount);
+        return 1;
+    }
+
+    printf("All checks passed.\n");
+    return 0;
+}